@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include "apm32f4xx.h"
+#include "Bench.h"
+
+#if defined(APM32_HOST)
+#include "HostSim.h"
+#endif
+
+#ifndef BENCH_REVISION
+#define BENCH_REVISION "unknown"
+#endif
+
+#ifndef BENCH_TARGET
+#if defined(APM32_HOST)
+#define BENCH_TARGET "host"
+#elif defined(BENCH_QEMU)
+#define BENCH_TARGET "qemu-netduinoplus2"
+#else
+#define BENCH_TARGET "apm32f407"
+#endif
+#endif
+
+#if defined(APM32_HOST)
+
+/*!
+ * @brief       Nothing to start: the host clock is the simulator cycle source.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void BenchClockInit(void)
+{
+}
+
+/*!
+ * @brief       Current bench time in BENCH_CLOCK_HZ ticks.
+ *
+ * @param       None
+ *
+ * @retval      Ticks since an arbitrary origin
+ */
+uint64_t BenchClock(void)
+{
+    return HostSimCycles();
+}
+
+#else
+
+/* SysTick wraps, extends the 24-bit counter to 64 bits */
+static volatile uint32_t benchWraps;
+
+void SysTick_Handler(void)
+{
+    benchWraps++;
+}
+
+/*!
+ * @brief       Start SysTick as a free-running core clock counter.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Under QEMU with -icount shift=0 the core clock is derived from
+ *              virtual time (1 ns per instruction), so ticks are an
+ *              instruction count scaled by BENCH_CLOCK_HZ / 1e9.
+ */
+void BenchClockInit(void)
+{
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    NVIC_SetPriority(SysTick_IRQn, 0);
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/*!
+ * @brief       Current bench time in BENCH_CLOCK_HZ ticks.
+ *
+ * @param       None
+ *
+ * @retval      Ticks since BenchClockInit()
+ */
+uint64_t BenchClock(void)
+{
+    uint32_t wraps, val;
+
+    /* Retry if the wrap interrupt ran between the two reads */
+    do
+    {
+        wraps = benchWraps;
+        val = SysTick->VAL;
+    } while (wraps != benchWraps);
+
+    return ((uint64_t)wraps << 24) + (SysTick_LOAD_RELOAD_Msk - val);
+}
+
+#endif
+
+/* newlib-nano printf has neither %llu nor %f */
+static const char* BenchU64(char* buf, uint64_t value)
+{
+    char* p = buf + 21;
+
+    *p = '\0';
+    do
+    {
+        *--p = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while (value != 0);
+
+    return p;
+}
+
+/* value / div with two decimals */
+static void BenchPrintRatio(const char* key, uint64_t value, uint64_t div)
+{
+    char buf[22];
+    uint64_t x100 = (div != 0) ? ((value * 100U + div / 2U) / div) : 0;
+
+    printf(", \"%s\": %s.%02u", key, BenchU64(buf, x100 / 100U), (unsigned)(x100 % 100U));
+}
+
+static void BenchNop(void)
+{
+    __asm volatile("" : : : "memory");
+}
+
+static uint64_t BenchTime(void (*run)(void), uint32_t iterations)
+{
+    uint64_t start;
+    uint32_t i;
+
+    start = BenchClock();
+    for (i = 0; i < iterations; i++)
+    {
+        run();
+    }
+
+    return BenchClock() - start;
+}
+
+/*!
+ * @brief       Run benchmark cases and print the results as one JSON
+ *              document on stdout.
+ *
+ * @param       cases:  Cases
+ *
+ * @param       count:  Number of cases
+ *
+ * @retval      None
+ *
+ * @note        Ticks exclude the loop and call overhead, measured with an
+ *              empty case. Fields:
+ *              ticks_per_iter      BENCH_CLOCK_HZ ticks per iteration
+ *              ns_per_iter         Same in nanoseconds (instructions under QEMU -icount shift=0)
+ *              ticks_per_byte      For throughput cases
+ *              ticks_per_sample    For signal processing cases
+ */
+void BenchRun(const BenchCase_T* cases, uint32_t count)
+{
+    uint32_t clockHz = BENCH_CLOCK_HZ;
+    uint32_t i;
+    char buf[22];
+
+    BenchClockInit();
+
+    printf("{\n  \"target\": \"%s\",\n  \"revision\": \"%s\",\n  \"clock_hz\": %lu,\n  \"results\": [\n",
+           BENCH_TARGET, BENCH_REVISION, (unsigned long)clockHz);
+
+    for (i = 0; i < count; i++)
+    {
+        const BenchCase_T* bench = &cases[i];
+        uint32_t iterations = (bench->iterations != 0) ? bench->iterations : BENCH_ITERATIONS;
+        uint64_t overhead, ticks;
+
+        if (bench->setup != NULL)
+        {
+            bench->setup();
+        }
+
+        /* Warm up caches and lazy initialization */
+        bench->run();
+
+        overhead = BenchTime(BenchNop, iterations);
+        ticks = BenchTime(bench->run, iterations);
+        ticks = (ticks > overhead) ? (ticks - overhead) : 0;
+
+        printf("    { \"name\": \"%s\", \"iterations\": %lu, \"bytes\": %lu, \"ticks\": %s",
+               bench->name, (unsigned long)iterations, (unsigned long)bench->bytes, BenchU64(buf, ticks));
+        BenchPrintRatio("ticks_per_iter", ticks, iterations);
+        BenchPrintRatio("ns_per_iter", ticks * 1000U, (uint64_t)iterations * (clockHz / 1000000U));
+        if (bench->bytes != 0)
+        {
+            BenchPrintRatio("ticks_per_byte", ticks, (uint64_t)iterations * bench->bytes);
+        }
+        if (bench->samples != 0)
+        {
+            BenchPrintRatio("ticks_per_sample", ticks, (uint64_t)iterations * bench->samples);
+        }
+        printf(" }%s\n", (i + 1 < count) ? "," : "");
+    }
+
+    printf("  ]\n}\n");
+    fflush(stdout);
+}
@@ -0,0 +1,46 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+/* Clock the bench timer counts in; SysTick runs on the core clock */
+#ifndef BENCH_CLOCK_HZ
+#if defined(BENCH_QEMU)
+/* netduinoplus2 system clock, independent of the (unmodelled) RCM setup */
+#define BENCH_CLOCK_HZ 168000000U
+#else
+#define BENCH_CLOCK_HZ SystemCoreClock
+#endif
+#endif
+
+/* Default repetitions per case; each case may override */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 1000U
+#endif
+
+/**
+ * @brief Benchmark case
+ */
+typedef struct
+{
+    const char* name;                           /*!< Stable name, used as JSON key */
+    void        (*setup)(void);                 /*!< Called once before timing (may be NULL) */
+    void        (*run)(void);                   /*!< One iteration */
+    uint32_t    bytes;                          /*!< Bytes processed per iteration (0: not a throughput case) */
+    uint32_t    iterations;                     /*!< Repetitions (0: BENCH_ITERATIONS) */
+    uint32_t    samples;                        /*!< Signal samples per iteration (0: not a DSP case) */
+} BenchCase_T;
+
+/* Keep a result alive so the compiler cannot drop the work producing it */
+#define BENCH_KEEP(x)   __asm volatile("" : : "r"(x) : "memory")
+
+void BenchClockInit(void);
+uint64_t BenchClock(void);
+
+void BenchRun(const BenchCase_T* cases, uint32_t count);
+
+/* Suites (BenchSuite.c) */
+extern const BenchCase_T benchSuite[];
+extern const uint32_t benchSuiteSize;
+
+#endif // BENCH_H
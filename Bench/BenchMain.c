@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include "apm32f4xx.h"
+#include "Bench.h"
+
+#if defined(APM32_HOST)
+#include "HostSim.h"
+#else
+/* newlib rdimon: route stdio through semihosting */
+extern void initialise_monitor_handles(void);
+#endif
+
+/*!
+ * @brief       Benchmark firmware entry point. Prints the JSON report and
+ *              exits, which ends the QEMU session through semihosting.
+ *
+ * @param       None
+ *
+ * @retval      Exit status
+ */
+int main(void)
+{
+#if defined(APM32_HOST)
+    HostSimInit();
+    SystemInit();
+#else
+    initialise_monitor_handles();
+#endif
+
+    BenchRun(benchSuite, benchSuiteSize);
+
+    exit(0);
+}
@@ -0,0 +1,699 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_crc.h"
+#include "apm32f4xx_dma.h"
+#include "apm32f4xx_gpio.h"
+#include "apm32f4xx_rcm.h"
+#include "apm32f4xx_spi.h"
+#include "apm32f4xx_usart.h"
+#include "Aes.h"
+#include "AesAead.h"
+#include "BlockCache.h"
+#include "Crc.h"
+#include "Digest.h"
+#include "Dsp.h"
+#include "Sha256.h"
+#include "SpiBus.h"
+#include "Net.h"
+#include "RingBuf.h"
+#include "Bench.h"
+
+#define BENCH_BLOCK     1024U
+#define BENCH_CHUNK     64U
+
+/* Keep GCC from turning the open-coded loops back into memcpy/memset calls */
+#define BENCH_NO_LIBCALL __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+
+static uint32_t srcWords[BENCH_BLOCK / 4U + 2U];
+static uint32_t dstWords[BENCH_BLOCK / 4U + 2U];
+static uint8_t* const src = (uint8_t*)srcWords;
+static uint8_t* const dst = (uint8_t*)dstWords;
+
+static AesContext_T aes;
+static AesAead_T aead;
+static uint8_t aeadTag[16];
+
+static RingBuf_T ring;
+static uint8_t ringStorage[256];
+
+static void BenchFillSource(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(srcWords); i++)
+    {
+        src[i] = (uint8_t)(i * 7U + 1U);
+    }
+}
+
+/* CRC ********************************************************************/
+
+static void CrcSetup(void)
+{
+    BenchFillSource();
+    RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_CRC);
+}
+
+static void CrcHardware(void)
+{
+    CRC_ResetDATA();
+    BENCH_KEEP(CRC_CalculateBlockCRC(srcWords, BENCH_BLOCK / 4U));
+}
+
+/* CRC-32/MPEG-2 one bit at a time, the baseline any table method must beat */
+static void CrcSoftwareBitwise(void)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    uint32_t i, bit;
+
+    for (i = 0; i < BENCH_BLOCK; i++)
+    {
+        crc ^= (uint32_t)src[i] << 24;
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80000000U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+        }
+    }
+    BENCH_KEEP(crc);
+}
+
+/* Table engines: the presets at 8 and 4 bytes per step, and one byte per step */
+static CrcModel_T crcModel;
+
+static void Crc32Slice8Setup(void)
+{
+    BenchFillSource();
+    crcModel = crcCrc32;
+}
+
+static void Crc32Slice4Setup(void)
+{
+    Crc32Slice8Setup();
+    crcModel.slices = 4;
+}
+
+static void Crc32TableSetup(void)
+{
+    Crc32Slice8Setup();
+    crcModel.slices = 1;
+}
+
+static void Crc16Slice4Setup(void)
+{
+    BenchFillSource();
+    crcModel = crcCcittFalse;
+}
+
+static void Crc16ReflectedSetup(void)
+{
+    BenchFillSource();
+    crcModel = crcModbus;
+}
+
+static void CrcSoftware(void)
+{
+    BENCH_KEEP(CrcCompute(&crcModel, src, BENCH_BLOCK));
+}
+
+#if !defined(BENCH_QEMU)
+/* QEMU has no DMA model to complete the transfer */
+static void CrcHardwareDma(void)
+{
+    BENCH_KEEP(CrcHwCompute(src, BENCH_BLOCK));
+}
+#endif
+
+/* CPU writes (unaligned source) plus a three-byte software tail */
+static void CrcHardwareUnaligned(void)
+{
+    BENCH_KEEP(CrcHwCompute(src + 1, BENCH_BLOCK - 1U));
+}
+
+/* Internet checksum ******************************************************/
+
+static void InetChecksum(void)
+{
+    BENCH_KEEP(NetChecksum(src, BENCH_BLOCK));
+}
+
+static void InetChecksumUnaligned(void)
+{
+    BENCH_KEEP(NetChecksum(src + 1, BENCH_BLOCK));
+}
+
+/* AES ********************************************************************/
+
+static void AesCtrSetup(void)
+{
+    BenchFillSource();
+    AesInit(&aes, AES_MODE_CTR, AES_ENCRYPT, src, 128, src + 16);
+}
+
+static void AesCbcDecryptSetup(void)
+{
+    BenchFillSource();
+    AesInit(&aes, AES_MODE_CBC, AES_DECRYPT, src, 128, src + 16);
+}
+
+/* Continues the stream on every iteration, as bulk encryption would */
+static void AesStream(void)
+{
+    AesUpdate(&aes, src, BENCH_BLOCK, dst);
+    BENCH_KEEP(dst);
+}
+
+static void AeadSetup(void)
+{
+    BenchFillSource();
+    AesAeadInit(&aead, src, 128);
+}
+
+/* One 1 KiB message with 16 bytes of AAD and a 96-bit IV / 13-byte nonce */
+static void AesGcm(void)
+{
+    AesGcmEncrypt(&aead, src + 16, 12, src + 32, 16, src, BENCH_BLOCK, dst, aeadTag, 16);
+    BENCH_KEEP(aeadTag);
+}
+
+static void AesCcm(void)
+{
+    AesCcmEncrypt(&aead, src + 16, 13, src + 32, 16, src, BENCH_BLOCK, dst, aeadTag, 16);
+    BENCH_KEEP(aeadTag);
+}
+
+/* Digests ****************************************************************/
+
+static void DigestSha1(void)
+{
+    uint8_t digest[DIGEST_MAX_SIZE];
+
+    DigestCompute(DIGEST_SHA1, src, BENCH_BLOCK, digest);
+    BENCH_KEEP(digest);
+}
+
+static void DigestMd5(void)
+{
+    uint8_t digest[DIGEST_MAX_SIZE];
+
+    DigestCompute(DIGEST_MD5, src, BENCH_BLOCK, digest);
+    BENCH_KEEP(digest);
+}
+
+static void DigestSha256(void)
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    Sha256Compute(src, BENCH_BLOCK, digest);
+    BENCH_KEEP(digest);
+}
+
+static void HmacSha256(void)
+{
+    uint8_t digest[SHA256_DIGEST_SIZE];
+
+    HmacSha256Compute(dst, 32, src, BENCH_BLOCK, digest);
+    BENCH_KEEP(digest);
+}
+
+/* DSP ********************************************************************/
+
+#define BENCH_SAMPLES   256U
+#define BENCH_TAPS      32U
+
+static int16_t dspInput[BENCH_SAMPLES] __attribute__((aligned(4)));
+static int16_t dspOutput[BENCH_SAMPLES] __attribute__((aligned(4)));
+static int16_t dspCoeffs[BENCH_TAPS];
+static int16_t dspState[DSP_FIR_STATE(BENCH_TAPS, BENCH_SAMPLES)] __attribute__((aligned(4)));
+static int16_t dspFftQ15[2U * BENCH_SAMPLES] __attribute__((aligned(4)));
+static float dspFftF32[2U * BENCH_SAMPLES];
+static DspFirQ15_T dspFir;
+static DspBiquadQ15_T dspBiquad;
+static DspFft_T dspFft[2];
+static uint32_t dspPass;
+
+/* Lowpass, fc = fs / 10, Q14: {b0, 0, b1, b2, a1, a2} per stage */
+static const int16_t dspBiquadCoeffs[12] __attribute__((aligned(4))) =
+{
+    1106, 0, 2212, 1106, 18727, -6763,
+    1106, 0, 2212, 1106, 18727, -6763,
+};
+
+static void DspSetup(void)
+{
+    uint32_t i;
+
+    BenchFillSource();
+    memcpy(dspInput, src, sizeof(dspInput));
+    for (i = 0; i < BENCH_TAPS; i++)
+    {
+        dspCoeffs[i] = (int16_t)(dspInput[i] >> 4);
+    }
+    for (i = 0; i < 2U * BENCH_SAMPLES; i++)
+    {
+        dspFftQ15[i] = dspInput[i % BENCH_SAMPLES];
+        dspFftF32[i] = (float)dspFftQ15[i] / 32768.0f;
+    }
+    dspPass = 0;
+    DspFftInit(&dspFft[0], BENCH_SAMPLES, 0);
+    DspFftInit(&dspFft[1], BENCH_SAMPLES, 1);
+}
+
+static void DspFirSetup(void)
+{
+    DspSetup();
+    DspFirQ15Init(&dspFir, dspCoeffs, BENCH_TAPS, dspState, BENCH_SAMPLES);
+}
+
+static void DspDecimateSetup(void)
+{
+    DspSetup();
+    DspDecimateQ15Init(&dspFir, dspCoeffs, BENCH_TAPS, 4, dspState, BENCH_SAMPLES);
+}
+
+static void DspBiquadSetup(void)
+{
+    DspSetup();
+    DspBiquadQ15Init(&dspBiquad, dspBiquadCoeffs, 2, 1, dspState);
+}
+
+static void DspFir(void)
+{
+    DspFirQ15(&dspFir, dspInput, dspOutput, BENCH_SAMPLES);
+    BENCH_KEEP(dspOutput);
+}
+
+/* The same filter one multiply at a time, the baseline for the SIMD kernel */
+static void DspFirNaive(void)
+{
+    uint32_t n, k;
+
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        int64_t acc = 0;
+
+        for (k = 0; (k < BENCH_TAPS) && (k <= n); k++)
+        {
+            acc += (int32_t)dspCoeffs[k] * dspInput[n - k];
+        }
+        acc >>= 15;
+        dspOutput[n] = (int16_t)((acc > 32767) ? 32767 : ((acc < -32768) ? -32768 : acc));
+    }
+    BENCH_KEEP(dspOutput);
+}
+
+static void DspDecimate(void)
+{
+    BENCH_KEEP(DspDecimateQ15(&dspFir, dspInput, dspOutput, BENCH_SAMPLES));
+}
+
+static void DspBiquad(void)
+{
+    DspBiquadQ15(&dspBiquad, dspInput, dspOutput, BENCH_SAMPLES);
+    BENCH_KEEP(dspOutput);
+}
+
+static void DspRms(void)
+{
+    BENCH_KEEP(DspRmsQ15(dspInput, BENCH_SAMPLES));
+}
+
+static void DspPeak(void)
+{
+    BENCH_KEEP(DspPeakQ15(dspInput, BENCH_SAMPLES, NULL));
+}
+
+/* Forward and inverse in turn keep the data in range */
+static void DspFftQ15Pass(void)
+{
+    DspFftQ15(&dspFft[dspPass++ & 1U], dspFftQ15);
+    BENCH_KEEP(dspFftQ15);
+}
+
+static void DspFftF32Pass(void)
+{
+    DspFftF32(&dspFft[dspPass++ & 1U], dspFftF32);
+    BENCH_KEEP(dspFftF32);
+}
+
+/* SPI ********************************************************************/
+
+#if !defined(BENCH_QEMU)
+/* QEMU runs without the DMA interrupts the bus completes on */
+#define BENCH_SPI_BURST 4096U
+
+static SpiBus_T spiBus;
+static SpiDevice_T spiDevice;
+static uint8_t spiTx[BENCH_SPI_BURST];
+static uint8_t spiRx[BENCH_SPI_BURST];
+
+/* SPI1 at PCLK2 / 2, the fastest the prescaler allows */
+static void SpiSetup(void)
+{
+    uint32_t i;
+
+    if (spiBus.spi == NULL)
+    {
+        SpiBusInit(&spiBus, SPI1);
+        SpiDeviceInit(&spiDevice, &spiBus, GPIOA, GPIO_PIN_4, 0, 0xFFFFFFFFU, 0);
+    }
+    for (i = 0; i < BENCH_SPI_BURST; i++)
+    {
+        spiTx[i] = (uint8_t)(i * 7U + 1U);
+    }
+
+    /* Leaves SPI1 enabled in the device's mode for the polled loop */
+    SpiExchange(&spiDevice, spiTx, spiRx, 1);
+}
+
+static void SpiDma(void)
+{
+    BENCH_KEEP(SpiExchange(&spiDevice, spiTx, spiRx, BENCH_SPI_BURST));
+}
+
+/* One frame at a time on the flags, what drivers did before the bus */
+static void SpiPolled(void)
+{
+    uint32_t i;
+
+    GPIO_ResetBit(GPIOA, GPIO_PIN_4);
+    for (i = 0; i < BENCH_SPI_BURST; i++)
+    {
+        while (SPI_I2S_ReadStatusFlag(SPI1, SPI_FLAG_TXBE) == RESET)
+        {
+        }
+        SPI_I2S_TxData(SPI1, spiTx[i]);
+        while (SPI_I2S_ReadStatusFlag(SPI1, SPI_FLAG_RXBNE) == RESET)
+        {
+        }
+        spiRx[i] = (uint8_t)SPI_I2S_RxData(SPI1);
+    }
+    GPIO_SetBit(GPIOA, GPIO_PIN_4);
+    BENCH_KEEP(spiRx);
+}
+#endif
+
+/* Block cache ************************************************************/
+
+#if !defined(BENCH_QEMU)
+/* A RAM disk that takes as long as an SD card: a fixed time per command
+   plus the transfer at about 20 MB/s */
+#define BENCH_DISK_BLOCKS       2048U
+#define BENCH_DISK_COMMAND_US   100U
+#define BENCH_DISK_BLOCK_US     25U
+#define BENCH_DISK_DATA         64U     /* First file data block */
+#define BENCH_DISK_PASS         64U     /* Blocks of file data per iteration */
+
+static uint32_t benchDisk[BENCH_DISK_BLOCKS * SDCARD_BLOCK_SIZE / 4U];
+static uint32_t benchCacheStorage[(BLOCKCACHE_BATCH + BLOCKCACHE_LINES) * SDCARD_BLOCK_SIZE / 4U];
+static uint32_t benchDiskBuffer[SDCARD_BLOCK_SIZE / 4U];
+static BlockDev_T benchSlowDisk;
+static BlockCache_T benchCache;
+static BlockDev_T* benchDevice;
+static uint32_t benchDiskPosition;
+
+static void BenchDiskWait(uint32_t count)
+{
+    uint64_t end = BenchClock() +
+                   (uint64_t)(BENCH_DISK_COMMAND_US + count * BENCH_DISK_BLOCK_US) * (BENCH_CLOCK_HZ / 1000000U);
+
+    while (BenchClock() < end)
+    {
+    }
+}
+
+static uint8_t BenchDiskRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    BenchDiskWait(count);
+    memcpy(buffer, (uint8_t*)benchDisk + block * dev->blockSize, count * dev->blockSize);
+
+    return SUCCESS;
+}
+
+static uint8_t BenchDiskWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    BenchDiskWait(count);
+    memcpy((uint8_t*)benchDisk + block * dev->blockSize, buffer, count * dev->blockSize);
+
+    return SUCCESS;
+}
+
+static void DiskSetup(void)
+{
+    BlockDevRamInit(&benchSlowDisk, (uint8_t*)benchDisk, SDCARD_BLOCK_SIZE, BENCH_DISK_BLOCKS);
+    benchSlowDisk.read = BenchDiskRead;
+    benchSlowDisk.write = BenchDiskWrite;
+    benchDevice = &benchSlowDisk;
+    benchDiskPosition = 0;
+}
+
+static void DiskLruSetup(void)
+{
+    DiskSetup();
+    BlockCacheInit(&benchCache, &benchSlowDisk, benchCacheStorage, sizeof(benchCacheStorage), BLOCKCACHE_LRU);
+    benchDevice = &benchCache.device;
+}
+
+static void Disk2QSetup(void)
+{
+    DiskSetup();
+    BlockCacheInit(&benchCache, &benchSlowDisk, benchCacheStorage, sizeof(benchCacheStorage), BLOCKCACHE_2Q);
+    benchDevice = &benchCache.device;
+}
+
+/* A file read the way a FAT filesystem does: allocation table sector and
+   directory entry next to every data block */
+static void DiskMetadata(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DISK_PASS; i++)
+    {
+        BlockDevRead(benchDevice, (benchDiskPosition / 128U) % 4U, benchDiskBuffer, 1);
+        BlockDevRead(benchDevice, 8, benchDiskBuffer, 1);
+        BlockDevRead(benchDevice, BENCH_DISK_DATA + benchDiskPosition, benchDiskBuffer, 1);
+        benchDiskPosition = (benchDiskPosition + 1U) % (BENCH_DISK_BLOCKS - BENCH_DISK_DATA);
+    }
+    BENCH_KEEP(benchDiskBuffer);
+}
+
+static void DiskSequential(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DISK_PASS; i++)
+    {
+        BlockDevRead(benchDevice, BENCH_DISK_DATA + benchDiskPosition, benchDiskBuffer, 1);
+        benchDiskPosition = (benchDiskPosition + 1U) % (BENCH_DISK_BLOCKS - BENCH_DISK_DATA);
+    }
+    BENCH_KEEP(benchDiskBuffer);
+}
+
+/* Appending one block at a time, then a flush */
+static void DiskSmallWrites(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DISK_PASS; i++)
+    {
+        benchDiskBuffer[0] = i;
+        BlockDevWrite(benchDevice, BENCH_DISK_DATA + benchDiskPosition, benchDiskBuffer, 1);
+        benchDiskPosition = (benchDiskPosition + 1U) % (BENCH_DISK_BLOCKS - BENCH_DISK_DATA);
+    }
+    BlockDevSync(benchDevice);
+}
+#endif
+
+/* memcpy / memset ********************************************************/
+
+static void MemcpyAligned(void)
+{
+    memcpy(dst, src, BENCH_BLOCK);
+    BENCH_KEEP(dst);
+}
+
+static void MemcpyUnaligned(void)
+{
+    memcpy(dst + 1, src + 3, BENCH_BLOCK);
+    BENCH_KEEP(dst);
+}
+
+static BENCH_NO_LIBCALL void MemcpyByteLoop(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BLOCK; i++)
+    {
+        dst[i] = src[i];
+    }
+    BENCH_KEEP(dst);
+}
+
+static BENCH_NO_LIBCALL void MemcpyWordLoop(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BLOCK / 4U; i++)
+    {
+        dstWords[i] = srcWords[i];
+    }
+    BENCH_KEEP(dst);
+}
+
+static void Memset(void)
+{
+    memset(dst, 0x5A, BENCH_BLOCK);
+    BENCH_KEEP(dst);
+}
+
+static BENCH_NO_LIBCALL void MemsetWordLoop(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BLOCK / 4U; i++)
+    {
+        dstWords[i] = 0x5A5A5A5AU;
+    }
+    BENCH_KEEP(dst);
+}
+
+/* Ring buffer ************************************************************/
+
+static void RingSetup(void)
+{
+    BenchFillSource();
+    RingBufInit(&ring, ringStorage, sizeof(ringStorage));
+}
+
+static void RingChunk(void)
+{
+    RingBufWrite(&ring, src, BENCH_CHUNK);
+    BENCH_KEEP(RingBufRead(&ring, dst, BENCH_CHUNK));
+}
+
+static void RingByte(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_CHUNK; i++)
+    {
+        RingBufWrite(&ring, &src[i], 1);
+    }
+    for (i = 0; i < BENCH_CHUNK; i++)
+    {
+        RingBufRead(&ring, &dst[i], 1);
+    }
+    BENCH_KEEP(dst);
+}
+
+/* Driver software paths **************************************************/
+
+static void DriverSetup(void)
+{
+    RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_GPIOA);
+    RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_USART1);
+}
+
+static void GpioConfig(void)
+{
+    GPIO_Config_T config;
+
+    GPIO_ConfigStructInit(&config);
+    config.pin = GPIO_PIN_5;
+    config.mode = GPIO_MODE_OUT;
+    GPIO_Config(GPIOA, &config);
+}
+
+static void GpioToggle(void)
+{
+    GPIO_SetBit(GPIOA, GPIO_PIN_5);
+    GPIO_ResetBit(GPIOA, GPIO_PIN_5);
+}
+
+static void UsartConfig(void)
+{
+    USART_Config_T config;
+
+    USART_ConfigStructInit(&config);
+    config.baudRate = 115200;
+    USART_Config(USART1, &config);
+}
+
+static void DmaConfig(void)
+{
+    DMA_Config_T config;
+
+    DMA_ConfigStructInit(&config);
+    config.peripheralBaseAddr = (uint32_t)&USART1->DATA;
+    config.memoryBaseAddr = (uint32_t)dst;
+    config.dir = DMA_DIR_MEMORYTOPERIPHERAL;
+    config.bufferSize = BENCH_CHUNK;
+    config.memoryInc = DMA_MEMORY_INC_ENABLE;
+    DMA_Config(DMA2_Stream7, &config);
+}
+
+static void RcmClockFreq(void)
+{
+    uint32_t pclk1, pclk2;
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    BENCH_KEEP(pclk1 + pclk2 + RCM_ReadHCLKFreq());
+}
+
+const BenchCase_T benchSuite[] =
+{
+    { "crc32_hw_1k",            CrcSetup,       CrcHardware,        BENCH_BLOCK,    0, 0 },
+    { "crc32_sw_bitwise_1k",    CrcSetup,       CrcSoftwareBitwise, BENCH_BLOCK,    100, 0 },
+#if !defined(BENCH_QEMU)
+    { "crc32_hw_dma_1k",        CrcSetup,       CrcHardwareDma,     BENCH_BLOCK,    0, 0 },
+#endif
+    { "crc32_hw_unaligned_1k",  CrcSetup,       CrcHardwareUnaligned, BENCH_BLOCK - 1U, 0, 0 },
+    { "crc32_slice8_1k",        Crc32Slice8Setup, CrcSoftware,      BENCH_BLOCK,    0, 0 },
+    { "crc32_slice4_1k",        Crc32Slice4Setup, CrcSoftware,      BENCH_BLOCK,    0, 0 },
+    { "crc32_table_1k",         Crc32TableSetup, CrcSoftware,       BENCH_BLOCK,    0, 0 },
+    { "crc16_ccitt_slice4_1k",  Crc16Slice4Setup, CrcSoftware,      BENCH_BLOCK,    0, 0 },
+    { "crc16_modbus_slice4_1k", Crc16ReflectedSetup, CrcSoftware,   BENCH_BLOCK,    0, 0 },
+    { "inet_checksum_1k",       BenchFillSource, InetChecksum,      BENCH_BLOCK,    0, 0 },
+    { "inet_checksum_unaligned_1k", BenchFillSource, InetChecksumUnaligned, BENCH_BLOCK, 0, 0 },
+    { "aes128_ctr_1k",          AesCtrSetup,    AesStream,          BENCH_BLOCK,    0, 0 },
+    { "aes128_cbc_decrypt_1k",  AesCbcDecryptSetup, AesStream,      BENCH_BLOCK,    0, 0 },
+    { "aes128_gcm_1k",          AeadSetup,      AesGcm,             BENCH_BLOCK,    0, 0 },
+    { "aes128_ccm_1k",          AeadSetup,      AesCcm,             BENCH_BLOCK,    0, 0 },
+    { "sha1_1k",                BenchFillSource, DigestSha1,        BENCH_BLOCK,    0, 0 },
+    { "md5_1k",                 BenchFillSource, DigestMd5,         BENCH_BLOCK,    0, 0 },
+    { "sha256_1k",              BenchFillSource, DigestSha256,      BENCH_BLOCK,    0, 0 },
+    { "hmac_sha256_1k",         BenchFillSource, HmacSha256,        BENCH_BLOCK,    0, 0 },
+    { "fir_q15_32tap_256",      DspFirSetup,    DspFir,             0,              0, BENCH_SAMPLES },
+    { "fir_q15_32tap_naive_256", DspFirSetup,   DspFirNaive,        0,              0, BENCH_SAMPLES },
+    { "decimate_q15_4x_32tap_256", DspDecimateSetup, DspDecimate,   0,              0, BENCH_SAMPLES },
+    { "biquad_q15_2stage_256",  DspBiquadSetup, DspBiquad,          0,              0, BENCH_SAMPLES },
+    { "rms_q15_256",            DspSetup,       DspRms,             0,              0, BENCH_SAMPLES },
+    { "peak_q15_256",           DspSetup,       DspPeak,            0,              0, BENCH_SAMPLES },
+    { "fft_q15_256",            DspSetup,       DspFftQ15Pass,      0,              0, BENCH_SAMPLES },
+    { "fft_f32_256",            DspSetup,       DspFftF32Pass,      0,              0, BENCH_SAMPLES },
+#if !defined(BENCH_QEMU)
+    { "spi_dma_4k",             SpiSetup,       SpiDma,             BENCH_SPI_BURST, 100, 0 },
+    { "spi_polled_4k",          SpiSetup,       SpiPolled,          BENCH_SPI_BURST, 10, 0 },
+    { "disk_metadata_uncached", DiskSetup,      DiskMetadata,       BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_metadata_lru",      DiskLruSetup,   DiskMetadata,       BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_metadata_2q",       Disk2QSetup,    DiskMetadata,       BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_sequential_uncached", DiskSetup,    DiskSequential,     BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_sequential_lru",    DiskLruSetup,   DiskSequential,     BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_small_writes_uncached", DiskSetup,  DiskSmallWrites,    BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+    { "disk_small_writes_lru",  DiskLruSetup,   DiskSmallWrites,    BENCH_DISK_PASS * SDCARD_BLOCK_SIZE, 10, 0 },
+#endif
+    { "memcpy_aligned_1k",      BenchFillSource, MemcpyAligned,     BENCH_BLOCK,    0, 0 },
+    { "memcpy_unaligned_1k",    BenchFillSource, MemcpyUnaligned,   BENCH_BLOCK,    0, 0 },
+    { "memcpy_byte_loop_1k",    BenchFillSource, MemcpyByteLoop,    BENCH_BLOCK,    0, 0 },
+    { "memcpy_word_loop_1k",    BenchFillSource, MemcpyWordLoop,    BENCH_BLOCK,    0, 0 },
+    { "memset_1k",              NULL,           Memset,             BENCH_BLOCK,    0, 0 },
+    { "memset_word_loop_1k",    NULL,           MemsetWordLoop,     BENCH_BLOCK,    0, 0 },
+    { "ringbuf_chunk_64",       RingSetup,      RingChunk,          BENCH_CHUNK,    0, 0 },
+    { "ringbuf_byte_64",        RingSetup,      RingByte,           BENCH_CHUNK,    0, 0 },
+    { "gpio_config",            DriverSetup,    GpioConfig,         0,              0, 0 },
+    { "gpio_set_reset",         DriverSetup,    GpioToggle,         0,              0, 0 },
+    { "usart_config",           DriverSetup,    UsartConfig,        0,              0, 0 },
+    { "dma_config",             DriverSetup,    DmaConfig,          0,              0, 0 },
+    { "rcm_read_clock_freq",    NULL,           RcmClockFreq,       0,              0, 0 },
+};
+
+const uint32_t benchSuiteSize = sizeof(benchSuite) / sizeof(benchSuite[0]);
@@ -0,0 +1,173 @@
+/*!
+ * @file        HostSim.h
+ *
+ * @brief       Host-native simulation of the APM32F407 register space.
+ *
+ *              The peripheral, Cortex-M private and memory regions of the
+ *              device are mapped at their real addresses in the host process,
+ *              so the StdPeriph drivers run unmodified against them. Plain
+ *              registers are just RAM. Address ranges claimed by a behavioral
+ *              model are access-protected: every CPU access to them traps, the
+ *              model's read hook runs before a load and its write hook after a
+ *              store (x86-64 Linux, single-stepping through SIGSEGV/SIGTRAP).
+ *
+ *              Models see registers through an always-writable alias mapping
+ *              (HostSimReg) and may raise interrupts, which are delivered to
+ *              the same IRQ handlers the firmware defines.
+ *
+ *              Buffers handed to DMA must have 32-bit addresses: use static
+ *              storage (the host build links with -no-pie) or HostSimSram.
+ */
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Simulated core clock, also the DWT cycle counter rate */
+#define HOST_SIM_CORE_CLOCK 168000000U
+
+struct HostModel;
+
+typedef void (*HostModelHook_T)(struct HostModel* model, uint32_t offset);
+typedef void (*HostModelWriteHook_T)(struct HostModel* model, uint32_t offset, uint32_t oldValue);
+
+/**
+ * @brief Behavioral model of a register block
+ */
+typedef struct HostModel
+{
+    const char*             name;       /*!< Model name */
+    uint32_t                base;       /*!< Device address of the block */
+    uint32_t                size;       /*!< Block size in bytes */
+    HostModelHook_T         reset;      /*!< Load reset values (may be NULL) */
+    HostModelHook_T         read;       /*!< Before a load of the word at offset (may be NULL) */
+    HostModelWriteHook_T    write;      /*!< After a store to the word at offset (may be NULL) */
+    uint8_t                 paced;      /*!< Peripheral issues its own DMA requests */
+    void*                   ctx;        /*!< Model private state */
+    struct HostModel*       next;       /*!< Registered model list */
+} HostModel_T;
+
+/* Simulator */
+void HostSimInit(void);
+void HostSimReset(void);
+void HostSimAddModel(HostModel_T* model);
+void HostSimRemoveModel(HostModel_T* model);
+HostModel_T* HostSimFindModel(uint32_t addr);
+
+/* Register access for models and test code, bypasses the access traps */
+volatile uint32_t* HostSimReg(uint32_t addr);
+uint32_t HostSimBusRead(uint32_t addr, uint32_t size);
+void HostSimBusWrite(uint32_t addr, uint32_t value, uint32_t size);
+void* HostSimSram(uint32_t size);
+
+/* Defer interrupt delivery while a model updates several registers */
+void HostSimLock(void);
+void HostSimUnlock(void);
+
+/* Interrupts */
+void HostSimSetPending(IRQn_Type irq);
+void HostSimClearPending(IRQn_Type irq);
+uint8_t HostSimIsEnabled(IRQn_Type irq);
+void HostSimDeliver(void);
+
+/* Core timing */
+uint64_t HostSimCycles(void);
+void HostSimSetCycleSource(uint64_t (*source)(void));
+
+/*
+ * DMA (HostDma.c). Memory-to-memory and memory-to-peripheral transfers run to
+ * completion when the stream is enabled, unless the peripheral model is
+ * paced. Peripheral-to-memory transfers and paced peripherals move one item
+ * per request; returns 1 when an enabled stream served it. HostDmaRequestDir()
+ * serves only the stream of one direction (output: memory to peripheral).
+ */
+uint8_t HostDmaRequest(uint32_t peripheralAddr);
+uint8_t HostDmaRequestDir(uint32_t peripheralAddr, uint8_t output);
+
+/* Built-in models */
+void HostCoreModelsAdd(void);
+void HostRcmModelAdd(void);
+void HostCrcModelAdd(void);
+void HostDmaModelAdd(void);
+void HostUsartModelAdd(void);
+void HostEthModelAdd(void);
+void HostCanModelAdd(void);
+void HostSpiModelAdd(void);
+void HostGpioModelAdd(void);
+void HostSdioModelAdd(void);
+
+/* USART model: transmitted bytes go to the sink, received bytes are injected */
+typedef void (*HostUsartSink_T)(USART_T* usart, uint8_t data);
+void HostUsartSetSink(HostUsartSink_T sink);
+void HostUsartInject(USART_T* usart, const uint8_t* data, uint32_t len);
+
+/* Ethernet DMA model: transmitted frames go to the sink, received frames are injected */
+typedef void (*HostEthSink_T)(const uint8_t* frame, uint32_t len);
+void HostEthSetSink(HostEthSink_T sink);
+uint8_t HostEthInject(const uint8_t* frame, uint32_t len);
+
+/*
+ * SPI1-3 model: a master exchanges one frame per write to DATA, instantly,
+ * with the device of that bus (default: MOSI looped back to MISO). With
+ * TXDEN set the model pulls the transmit stream dry; with RXDEN set every
+ * received frame is a request to the receive stream.
+ */
+typedef uint16_t (*HostSpiDevice_T)(SPI_T* spi, uint16_t mosi);
+void HostSpiSetDevice(SPI_T* spi, HostSpiDevice_T device);
+
+/*
+ * GPIO model: writes to BSCL/BSCH update ODATA, and the watcher of a port
+ * sees every change of its outputs (changed: the pins that toggled).
+ */
+typedef void (*HostGpioWatch_T)(GPIO_T* port, uint16_t odr, uint16_t changed);
+void HostGpioSetWatch(GPIO_T* port, HostGpioWatch_T watch);
+
+/*
+ * Serial NOR flash (HostNor.c): 25-series commands and SFDP, on an SPI
+ * model with a GPIO chip select; returns the flash array, erased.
+ * HostNorSetSfdp() serves a recorded basic parameter table instead of
+ * the one describing the model.
+ */
+uint8_t* HostNorAttach(SPI_T* spi, GPIO_T* csPort, uint16_t csPin, uint32_t size);
+void HostNorSetSfdp(const uint32_t* bfpt, uint32_t count);
+
+/*
+ * SDIO model (HostSdio.c) with an SD card inserted by HostSdAttach():
+ * commands are answered at once, data moves a word per FIFO access or
+ * DMA request. Returns the card contents, zeroed. HostSdPreErase() is the
+ * block count of the last ACMD23. HostSdSetRegisters() makes the card
+ * report recorded CSD and SCR contents.
+ */
+uint8_t* HostSdAttach(uint32_t blocks, uint8_t highCapacity);
+uint32_t HostSdPreErase(void);
+void HostSdSetRegisters(const uint32_t* csd, const uint8_t* scr);
+
+/*
+ * CAN1 model: test code steps the bus. Frames are mailbox register images:
+ * identifier in the RXMID layout (TXREQ clear), DLC, data words.
+ */
+typedef struct
+{
+    uint32_t mid;
+    uint32_t dlc;
+    uint32_t dataLow;
+    uint32_t dataHigh;
+} HostCanFrame_T;
+
+typedef void (*HostCanSink_T)(const HostCanFrame_T* frame);
+void HostCanSetSink(HostCanSink_T sink);
+uint8_t HostCanStep(void);
+uint8_t HostCanInject(const HostCanFrame_T* frame);
+void HostCanSetErrors(uint32_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SIM_H */
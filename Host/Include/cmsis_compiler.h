@@ -0,0 +1,111 @@
+/*!
+ * @file        cmsis_compiler.h
+ *
+ * @brief       Host build replacement for the CMSIS compiler header.
+ *
+ *              Included through Host/Include/core_cm4.h. Pulls in
+ *              the GCC CMSIS header for the compiler abstraction macros and
+ *              replaces the Cortex-M instructions that have no host
+ *              equivalent (interrupt masking, barriers, WFI, ...) with calls
+ *              into the simulator (Host/Source/HostSim.c).
+ */
+
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+/* Move the Arm versions out of the way; they are never instantiated on the host */
+#define __enable_irq    __arm_enable_irq
+#define __disable_irq   __arm_disable_irq
+#define __get_PRIMASK   __arm_get_PRIMASK
+#define __set_PRIMASK   __arm_set_PRIMASK
+#define __get_IPSR      __arm_get_IPSR
+#define __ISB           __arm_ISB
+#define __DSB           __arm_DSB
+#define __DMB           __arm_DMB
+
+#include "../../CMSIS/Include/cmsis_gcc.h"
+
+#undef __enable_irq
+#undef __disable_irq
+#undef __get_PRIMASK
+#undef __set_PRIMASK
+#undef __get_IPSR
+#undef __ISB
+#undef __DSB
+#undef __DMB
+#undef __NOP
+#undef __WFI
+#undef __WFE
+#undef __SEV
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t HostSimGetPrimask(void);
+void HostSimSetPrimask(uint32_t primask);
+uint32_t HostSimGetIpsr(void);
+void HostSimWaitForInterrupt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+    HostSimSetPrimask(0);
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+    HostSimSetPrimask(1);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+    return HostSimGetPrimask();
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+    HostSimSetPrimask(priMask);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+    return HostSimGetIpsr();
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+    return 0;
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)
+{
+    (void)basePri;
+}
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#define __NOP()     __COMPILER_BARRIER()
+#define __WFI()     HostSimWaitForInterrupt()
+#define __WFE()     HostSimWaitForInterrupt()
+#define __SEV()     __COMPILER_BARRIER()
+
+#endif /* __CMSIS_COMPILER_H */
@@ -0,0 +1,18 @@
+/*!
+ * @file        core_cm4.h
+ *
+ * @brief       Host build wrapper for the CMSIS Cortex-M4 core header.
+ *
+ *              core_cm4.h includes "cmsis_compiler.h" from its own directory,
+ *              which would bypass the host replacement. Including the host
+ *              cmsis_compiler.h first claims its include guard, so the CMSIS
+ *              one is skipped.
+ */
+
+#ifndef HOST_CORE_CM4_H
+#define HOST_CORE_CM4_H
+
+#include "cmsis_compiler.h"
+#include "../../CMSIS/Include/core_cm4.h"
+
+#endif /* HOST_CORE_CM4_H */
@@ -0,0 +1,573 @@
+/*!
+ * @file        HostCan.c
+ *
+ * @brief       CAN1 (bxCAN) model for the host build.
+ *
+ *              Test code drives the bus: HostCanStep() sends the mailbox
+ *              that wins arbitration (identifier priority, or request order
+ *              with TXFPCFG) and HostCanInject() delivers a frame from another
+ *              node. Received frames go through the acceptance filters
+ *              (scale, mode, FIFO assignment, match index numbering and
+ *              priority as in the reference manual) into three-deep FIFOs
+ *              with overrun and FIFO lock handling. Mailbox aborts complete
+ *              at once, since no frame is ever on the wire between steps.
+ *              Loopback mode also receives the node's own frames, silent
+ *              mode keeps them off the sink. Bit timing is not modelled.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+#define CAN_REG(field)          offsetof(CAN_T, field)
+
+#define CAN_MCTRL_INITREQ       (1UL << 0)
+#define CAN_MCTRL_SLEEPREQ      (1UL << 1)
+#define CAN_MCTRL_TXFPCFG       (1UL << 2)
+#define CAN_MCTRL_RXFLOCK       (1UL << 3)
+#define CAN_MCTRL_SWRST         (1UL << 15)
+#define CAN_MCTRL_RESET         0x00010002UL
+
+#define CAN_MSTS_INITFLG        (1UL << 0)
+#define CAN_MSTS_SLEEPFLG       (1UL << 1)
+#define CAN_MSTS_ERRIFLG        (1UL << 2)
+#define CAN_MSTS_CLEARABLE      ((1UL << 2) | (1UL << 3) | (1UL << 4))
+#define CAN_MSTS_RESET          0x00000C02UL
+
+#define CAN_TXSTS_RQCP(n)       (1UL << ((n) * 8U))
+#define CAN_TXSTS_TXOK(n)       (2UL << ((n) * 8U))
+#define CAN_TXSTS_FLAGS(n)      (0x0FUL << ((n) * 8U))
+#define CAN_TXSTS_ABRQ(n)       (0x80UL << ((n) * 8U))
+#define CAN_TXSTS_TME(n)        (1UL << (26U + (n)))
+#define CAN_TXSTS_RESET         0x1C000000UL
+
+#define CAN_RXF_FMNUM           0x03UL
+#define CAN_RXF_FULL            (1UL << 3)
+#define CAN_RXF_FOVR            (1UL << 4)
+#define CAN_RXF_RFOM            (1UL << 5)
+
+#define CAN_INTEN_TXME          (1UL << 0)
+#define CAN_INTEN_FMP(f)        (1UL << (1U + (f) * 3U))
+#define CAN_INTEN_FFULL(f)      (1UL << (2U + (f) * 3U))
+#define CAN_INTEN_FOVR(f)       (1UL << (3U + (f) * 3U))
+#define CAN_INTEN_ERRFLAGS_POS  8U
+#define CAN_INTEN_ERR           (1UL << 15)
+
+#define CAN_ERRSTS_FLAGS        0x07UL
+
+#define CAN_BITTIM_LBKMEN       (1UL << 30)
+#define CAN_BITTIM_SILMEN       (1UL << 31)
+#define CAN_BITTIM_RESET        0x01230000UL
+
+#define CAN_FCTRL_CAN2SB_POS    8U
+#define CAN_FCTRL_CAN2SB_MSK    (0x3FUL << CAN_FCTRL_CAN2SB_POS)
+#define CAN_FCTRL_RESET         0x2A1C0E01UL
+
+#define CAN_MID_TXREQ           (1UL << 0)
+#define CAN_MID_RTR             (1UL << 1)
+#define CAN_MID_IDE             (1UL << 2)
+
+#define CAN_MAILBOXES           3U
+#define CAN_FIFO_DEPTH          3U
+#define CAN_FILTER_BANKS        28U
+
+static HostModel_T canModel;
+static HostCanFrame_T rxFifo[2][CAN_FIFO_DEPTH];
+static uint32_t rxIndex[2][CAN_FIFO_DEPTH];         /* Filter match index per stored frame */
+static uint32_t rxCount[2];
+static uint32_t txOrder[CAN_MAILBOXES];             /* Request order, for TXFPCFG */
+static uint32_t txOrderNext;
+static HostCanSink_T sink;
+
+static volatile uint32_t* HostCanReg(uint32_t offset)
+{
+    return HostSimReg(canModel.base + offset);
+}
+
+/* Level-sensitive interrupt lines */
+static void HostCanUpdate(void)
+{
+    uint32_t inten = *HostCanReg(CAN_REG(INTEN));
+    uint32_t txsts = *HostCanReg(CAN_REG(TXSTS));
+    uint32_t rxf, mailbox, fifo;
+    uint8_t active = 0;
+
+    for (mailbox = 0; mailbox < CAN_MAILBOXES; mailbox++)
+    {
+        active |= ((txsts & CAN_TXSTS_RQCP(mailbox)) != 0);
+    }
+    if (active && ((inten & CAN_INTEN_TXME) != 0))
+    {
+        HostSimSetPending(CAN1_TX_IRQn);
+    }
+    else
+    {
+        HostSimClearPending(CAN1_TX_IRQn);
+    }
+
+    for (fifo = 0; fifo < 2U; fifo++)
+    {
+        rxf = *HostCanReg((fifo == 0) ? CAN_REG(RXF0) : CAN_REG(RXF1));
+        if ((((rxf & CAN_RXF_FMNUM) != 0) && ((inten & CAN_INTEN_FMP(fifo)) != 0)) ||
+            (((rxf & CAN_RXF_FULL) != 0) && ((inten & CAN_INTEN_FFULL(fifo)) != 0)) ||
+            (((rxf & CAN_RXF_FOVR) != 0) && ((inten & CAN_INTEN_FOVR(fifo)) != 0)))
+        {
+            HostSimSetPending((fifo == 0) ? CAN1_RX0_IRQn : CAN1_RX1_IRQn);
+        }
+        else
+        {
+            HostSimClearPending((fifo == 0) ? CAN1_RX0_IRQn : CAN1_RX1_IRQn);
+        }
+    }
+
+    if (((*HostCanReg(CAN_REG(MSTS)) & CAN_MSTS_ERRIFLG) != 0) && ((inten & CAN_INTEN_ERR) != 0))
+    {
+        HostSimSetPending(CAN1_SCE_IRQn);
+    }
+    else
+    {
+        HostSimClearPending(CAN1_SCE_IRQn);
+    }
+}
+
+/* Show the oldest message of a FIFO in its output mailbox */
+static void HostCanShowFifo(uint32_t fifo)
+{
+    volatile uint32_t* rxf = HostCanReg((fifo == 0) ? CAN_REG(RXF0) : CAN_REG(RXF1));
+    volatile uint32_t* out = HostCanReg(CAN_REG(sRxMailBox[fifo]));
+    const HostCanFrame_T* frame = &rxFifo[fifo][0];
+
+    *rxf = (*rxf & ~CAN_RXF_FMNUM) | rxCount[fifo];
+    if (rxCount[fifo] != 0)
+    {
+        /* RXMID, RXDLEN, RXMDL, RXMDH */
+        out[0] = frame->mid & ~CAN_MID_TXREQ;
+        out[1] = (frame->dlc & 0x0FU) | (rxIndex[fifo][0] << 8);
+        out[2] = frame->dataLow;
+        out[3] = frame->dataHigh;
+    }
+}
+
+/* Bus arbitration order: lower wins; a standard frame beats an extended one with the same base ID */
+static uint32_t HostCanArbKey(uint32_t mid)
+{
+    uint32_t rtr = ((mid & CAN_MID_RTR) != 0) ? 1U : 0U;
+
+    if ((mid & CAN_MID_IDE) == 0)
+    {
+        return (mid & 0xFFE00000UL) | (rtr << 20);
+    }
+
+    return (mid & 0xFFE00000UL) | (3UL << 19) | (((mid >> 3) & 0x3FFFFUL) << 1) | rtr;
+}
+
+/*!
+ * @brief       Run a frame through the acceptance filters.
+ *
+ * @param       mid:    Identifier register image
+ *
+ * @param       fifo:   FIFO of the winning filter
+ *
+ * @param       index:  Its filter match index
+ *
+ * @retval      1 when a filter accepted the frame
+ *
+ * @note        Match indices count the filters of each FIFO in bank order,
+ *              active or not. Among several matches a 32-bit filter wins
+ *              over a 16-bit one, then list mode over mask mode, then the
+ *              lower filter number.
+ */
+static uint8_t HostCanFilter(uint32_t mid, uint32_t* fifo, uint32_t* index)
+{
+    uint32_t fmcfg = *HostCanReg(CAN_REG(FMCFG));
+    uint32_t fscfg = *HostCanReg(CAN_REG(FSCFG));
+    uint32_t ffass = *HostCanReg(CAN_REG(FFASS));
+    uint32_t fact = *HostCanReg(CAN_REG(FACT));
+    uint32_t banks = (*HostCanReg(CAN_REG(FCTRL)) & CAN_FCTRL_CAN2SB_MSK) >> CAN_FCTRL_CAN2SB_POS;
+    uint32_t image32 = mid & ~CAN_MID_TXREQ;
+    uint32_t image16 = ((mid >> 21) << 5) | (((mid & CAN_MID_RTR) != 0) ? 0x10U : 0U) |
+                       (((mid & CAN_MID_IDE) != 0) ? 0x08U : 0U) | ((mid >> 18) & 0x07U);
+    uint32_t next[2] = { 0, 0 };
+    uint32_t bestRank = 4;
+    uint32_t bank, bankFifo, count, k, fr[2], rank;
+    uint8_t scale32, list, match;
+
+    if ((banks == 0) || (banks > CAN_FILTER_BANKS))
+    {
+        banks = CAN_FILTER_BANKS;
+    }
+
+    for (bank = 0; bank < banks; bank++)
+    {
+        bankFifo = (ffass >> bank) & 1U;
+        scale32 = ((fscfg >> bank) & 1U) != 0;
+        list = ((fmcfg >> bank) & 1U) != 0;
+        count = scale32 ? (list ? 2U : 1U) : (list ? 4U : 2U);
+        rank = (scale32 ? 0U : 2U) + (list ? 0U : 1U);
+        fr[0] = *HostCanReg(CAN_REG(sFilterRegister[bank].FBANK1));
+        fr[1] = *HostCanReg(CAN_REG(sFilterRegister[bank].FBANK2));
+
+        for (k = 0; (k < count) && (((fact >> bank) & 1U) != 0); k++)
+        {
+            if (scale32 && list)
+            {
+                match = ((image32 ^ fr[k]) & ~CAN_MID_TXREQ) == 0;
+            }
+            else if (scale32)
+            {
+                match = ((image32 ^ fr[0]) & fr[1] & ~CAN_MID_TXREQ) == 0;
+            }
+            else if (list)
+            {
+                match = image16 == ((fr[k / 2U] >> ((k & 1U) * 16U)) & 0xFFFFU);
+            }
+            else
+            {
+                match = ((image16 ^ fr[k]) & (fr[k] >> 16) & 0xFFFFU) == 0;
+            }
+
+            if (match && (rank < bestRank))
+            {
+                bestRank = rank;
+                *fifo = bankFifo;
+                *index = next[bankFifo] + k;
+            }
+        }
+        next[bankFifo] += count;
+    }
+
+    return bestRank != 4U;
+}
+
+/* A frame on the bus reaches the receiver */
+static uint8_t HostCanReceive(const HostCanFrame_T* frame)
+{
+    volatile uint32_t* rxf;
+    uint32_t fifo = 0, index = 0, slot;
+
+    if ((*HostCanReg(CAN_REG(MSTS)) & (CAN_MSTS_INITFLG | CAN_MSTS_SLEEPFLG)) != 0)
+    {
+        return 0;
+    }
+    if (!HostCanFilter(frame->mid, &fifo, &index))
+    {
+        return 0;
+    }
+
+    rxf = HostCanReg((fifo == 0) ? CAN_REG(RXF0) : CAN_REG(RXF1));
+    if (rxCount[fifo] == CAN_FIFO_DEPTH)
+    {
+        /* Overrun: locked FIFOs drop the new message, others overwrite the newest */
+        *rxf |= CAN_RXF_FOVR;
+        if ((*HostCanReg(CAN_REG(MCTRL)) & CAN_MCTRL_RXFLOCK) != 0)
+        {
+            return 1;
+        }
+        slot = CAN_FIFO_DEPTH - 1U;
+    }
+    else
+    {
+        slot = rxCount[fifo]++;
+        if (rxCount[fifo] == CAN_FIFO_DEPTH)
+        {
+            *rxf |= CAN_RXF_FULL;
+        }
+    }
+
+    rxFifo[fifo][slot] = *frame;
+    rxIndex[fifo][slot] = index;
+    HostCanShowFifo(fifo);
+
+    return 1;
+}
+
+static void HostCanReset(HostModel_T* model, uint32_t offset)
+{
+    uint32_t mailbox;
+
+    (void)offset;
+
+    for (offset = 0; offset < model->size; offset += 4U)
+    {
+        *HostCanReg(offset) = 0;
+    }
+    *HostCanReg(CAN_REG(MCTRL)) = CAN_MCTRL_RESET;
+    *HostCanReg(CAN_REG(MSTS)) = CAN_MSTS_RESET;
+    *HostCanReg(CAN_REG(TXSTS)) = CAN_TXSTS_RESET;
+    *HostCanReg(CAN_REG(BITTIM)) = CAN_BITTIM_RESET;
+    *HostCanReg(CAN_REG(FCTRL)) = CAN_FCTRL_RESET;
+
+    rxCount[0] = 0;
+    rxCount[1] = 0;
+    for (mailbox = 0; mailbox < CAN_MAILBOXES; mailbox++)
+    {
+        txOrder[mailbox] = 0;
+    }
+    txOrderNext = 0;
+}
+
+static void HostCanWriteTxsts(uint32_t oldValue)
+{
+    volatile uint32_t* txsts = HostCanReg(CAN_REG(TXSTS));
+    uint32_t written = *txsts;
+    uint32_t value = oldValue;
+    uint32_t mailbox;
+    volatile uint32_t* mid;
+
+    for (mailbox = 0; mailbox < CAN_MAILBOXES; mailbox++)
+    {
+        if ((written & CAN_TXSTS_RQCP(mailbox)) != 0)
+        {
+            value &= ~CAN_TXSTS_FLAGS(mailbox);
+        }
+
+        /* Abort a pending request: completes without TXOK */
+        mid = HostCanReg(CAN_REG(sTxMailBox[mailbox].TXMID));
+        if (((written & CAN_TXSTS_ABRQ(mailbox)) != 0) && ((*mid & CAN_MID_TXREQ) != 0))
+        {
+            *mid &= ~CAN_MID_TXREQ;
+            value &= ~CAN_TXSTS_FLAGS(mailbox);
+            value |= CAN_TXSTS_RQCP(mailbox) | CAN_TXSTS_TME(mailbox);
+        }
+    }
+
+    *txsts = value;
+}
+
+static void HostCanWriteRxf(uint32_t fifo, uint32_t oldValue)
+{
+    volatile uint32_t* rxf = HostCanReg((fifo == 0) ? CAN_REG(RXF0) : CAN_REG(RXF1));
+    uint32_t written = *rxf;
+    uint32_t i;
+
+    *rxf = oldValue & ~(written & (CAN_RXF_FULL | CAN_RXF_FOVR));
+
+    if (((written & CAN_RXF_RFOM) != 0) && (rxCount[fifo] != 0))
+    {
+        for (i = 1; i < rxCount[fifo]; i++)
+        {
+            rxFifo[fifo][i - 1U] = rxFifo[fifo][i];
+            rxIndex[fifo][i - 1U] = rxIndex[fifo][i];
+        }
+        rxCount[fifo]--;
+    }
+    HostCanShowFifo(fifo);
+}
+
+static void HostCanWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* reg = HostCanReg(offset);
+    volatile uint32_t* msts = HostCanReg(CAN_REG(MSTS));
+    uint32_t mailbox;
+
+    switch (offset)
+    {
+        case CAN_REG(MCTRL):
+            if ((*reg & CAN_MCTRL_SWRST) != 0)
+            {
+                HostCanReset(model, 0);
+                break;
+            }
+            /* Mode changes are acknowledged at once */
+            *msts &= ~(CAN_MSTS_INITFLG | CAN_MSTS_SLEEPFLG);
+            if ((*reg & CAN_MCTRL_INITREQ) != 0)
+            {
+                *msts |= CAN_MSTS_INITFLG;
+            }
+            else if ((*reg & CAN_MCTRL_SLEEPREQ) != 0)
+            {
+                *msts |= CAN_MSTS_SLEEPFLG;
+            }
+            break;
+
+        case CAN_REG(MSTS):
+            *reg = oldValue & ~(*reg & CAN_MSTS_CLEARABLE);
+            break;
+
+        case CAN_REG(TXSTS):
+            HostCanWriteTxsts(oldValue);
+            break;
+
+        case CAN_REG(RXF0):
+            HostCanWriteRxf(0, oldValue);
+            break;
+
+        case CAN_REG(RXF1):
+            HostCanWriteRxf(1, oldValue);
+            break;
+
+        case CAN_REG(ERRSTS):
+            /* Only the last error code is writable */
+            *reg = (oldValue & ~0x70UL) | (*reg & 0x70UL);
+            break;
+
+        default:
+            if ((offset >= CAN_REG(sTxMailBox[0])) && (offset < CAN_REG(sRxMailBox[0])))
+            {
+                mailbox = (offset - CAN_REG(sTxMailBox[0])) / sizeof(CAN_TxMailBox_T);
+
+                /* A mailbox is write-protected while its request is pending */
+                if ((*HostCanReg(CAN_REG(TXSTS)) & CAN_TXSTS_TME(mailbox)) == 0)
+                {
+                    *reg = oldValue;
+                }
+                else if ((offset == CAN_REG(sTxMailBox[mailbox].TXMID)) && ((*reg & CAN_MID_TXREQ) != 0))
+                {
+                    *HostCanReg(CAN_REG(TXSTS)) &= ~CAN_TXSTS_TME(mailbox);
+                    txOrder[mailbox] = txOrderNext++;
+                }
+            }
+            else if ((offset >= CAN_REG(sRxMailBox[0])) && (offset < CAN_REG(FCTRL)))
+            {
+                /* Receive mailboxes are read-only */
+                *reg = oldValue;
+            }
+            break;
+    }
+
+    HostCanUpdate();
+}
+
+static HostModel_T canModel =
+{
+    .name = "CAN1",
+    .base = CAN1_BASE,
+    .size = 0x400,
+    .reset = HostCanReset,
+    .write = HostCanWrite,
+};
+
+/*!
+ * @brief       Set where transmitted frames go.
+ *
+ * @param       newSink:  Sink, NULL discards them
+ *
+ * @retval      None
+ */
+void HostCanSetSink(HostCanSink_T newSink)
+{
+    sink = newSink;
+}
+
+/*!
+ * @brief       Send the pending mailbox that wins arbitration.
+ *
+ * @param       None
+ *
+ * @retval      1 when a frame was sent, 0 when no mailbox is pending
+ *
+ * @note        Each call is one frame time on the bus.
+ */
+uint8_t HostCanStep(void)
+{
+    volatile uint32_t* mid;
+    HostCanFrame_T frame;
+    uint32_t best = CAN_MAILBOXES;
+    uint32_t mailbox, bittim;
+    uint8_t fifoOrder = (*HostCanReg(CAN_REG(MCTRL)) & CAN_MCTRL_TXFPCFG) != 0;
+
+    if ((*HostCanReg(CAN_REG(MSTS)) & (CAN_MSTS_INITFLG | CAN_MSTS_SLEEPFLG)) != 0)
+    {
+        return 0;
+    }
+
+    for (mailbox = 0; mailbox < CAN_MAILBOXES; mailbox++)
+    {
+        mid = HostCanReg(CAN_REG(sTxMailBox[mailbox].TXMID));
+        if ((*mid & CAN_MID_TXREQ) == 0)
+        {
+            continue;
+        }
+        if ((best == CAN_MAILBOXES) ||
+            (fifoOrder && ((int32_t)(txOrder[mailbox] - txOrder[best]) < 0)) ||
+            (!fifoOrder && (HostCanArbKey(*mid) < HostCanArbKey(*HostCanReg(CAN_REG(sTxMailBox[best].TXMID))))))
+        {
+            best = mailbox;
+        }
+    }
+    if (best == CAN_MAILBOXES)
+    {
+        return 0;
+    }
+
+    HostSimLock();
+
+    mid = HostCanReg(CAN_REG(sTxMailBox[best].TXMID));
+    frame.mid = *mid & ~CAN_MID_TXREQ;
+    frame.dlc = *HostCanReg(CAN_REG(sTxMailBox[best].TXDLEN)) & 0x0FU;
+    frame.dataLow = *HostCanReg(CAN_REG(sTxMailBox[best].TXMDL));
+    frame.dataHigh = *HostCanReg(CAN_REG(sTxMailBox[best].TXMDH));
+
+    *mid &= ~CAN_MID_TXREQ;
+    *HostCanReg(CAN_REG(TXSTS)) |= CAN_TXSTS_RQCP(best) | CAN_TXSTS_TXOK(best) | CAN_TXSTS_TME(best);
+
+    bittim = *HostCanReg(CAN_REG(BITTIM));
+    if (((bittim & CAN_BITTIM_SILMEN) == 0) && (sink != NULL))
+    {
+        sink(&frame);
+    }
+    if ((bittim & CAN_BITTIM_LBKMEN) != 0)
+    {
+        HostCanReceive(&frame);
+    }
+    HostCanUpdate();
+
+    HostSimUnlock();
+
+    return 1;
+}
+
+/*!
+ * @brief       Deliver a frame sent by another node.
+ *
+ * @param       frame:  Identifier register image (RXMID layout), DLC, data
+ *
+ * @retval      1 when a filter accepted it (stored, or lost to an overrun)
+ */
+uint8_t HostCanInject(const HostCanFrame_T* frame)
+{
+    uint8_t accepted;
+
+    HostSimLock();
+    accepted = HostCanReceive(frame);
+    HostCanUpdate();
+    HostSimUnlock();
+
+    return accepted;
+}
+
+/*!
+ * @brief       Set the error state flags, as the error counters would.
+ *
+ * @param       flags:  ERRSTS bits 0..2 (warning, passive, bus-off)
+ *
+ * @retval      None
+ *
+ * @note        Newly set flags enabled in INTEN raise the status change
+ *              interrupt.
+ */
+void HostCanSetErrors(uint32_t flags)
+{
+    volatile uint32_t* errsts = HostCanReg(CAN_REG(ERRSTS));
+    uint32_t raised = flags & ~*errsts & CAN_ERRSTS_FLAGS;
+
+    HostSimLock();
+    *errsts = (*errsts & ~CAN_ERRSTS_FLAGS) | (flags & CAN_ERRSTS_FLAGS);
+    if ((raised & (*HostCanReg(CAN_REG(INTEN)) >> CAN_INTEN_ERRFLAGS_POS)) != 0)
+    {
+        *HostCanReg(CAN_REG(MSTS)) |= CAN_MSTS_ERRIFLG;
+    }
+    HostCanUpdate();
+    HostSimUnlock();
+}
+
+/*!
+ * @brief       Register the CAN1 model.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostCanModelAdd(void)
+{
+    HostSimAddModel(&canModel);
+}
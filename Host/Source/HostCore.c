@@ -0,0 +1,124 @@
+/*!
+ * @file        HostCore.c
+ *
+ * @brief       Cortex-M4 core peripheral models for the host build:
+ *              NVIC set/clear registers and the DWT cycle counter.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+void HostSimNvicWrite(uint32_t offset, uint32_t value);
+uint32_t HostSimNvicRead(uint32_t offset);
+
+/* NVIC_Type layout: ISER/ICER/ISPR/ICPR/IABR banks at 0x80 byte strides */
+#define NVIC_BANK_END   0x200U
+
+static void HostNvicRead(HostModel_T* model, uint32_t offset)
+{
+    if (offset < NVIC_BANK_END)
+    {
+        *HostSimReg(model->base + offset) = HostSimNvicRead(offset);
+    }
+}
+
+static void HostNvicWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    uint32_t value = *HostSimReg(model->base + offset);
+
+    (void)oldValue;
+
+    if (offset < NVIC_BANK_END)
+    {
+        HostSimNvicWrite(offset, value);
+        *HostSimReg(model->base + offset) = HostSimNvicRead(offset);
+    }
+    else if (offset == offsetof(NVIC_Type, STIR))
+    {
+        HostSimSetPending((IRQn_Type)(value & 0x1FFU));
+    }
+}
+
+static HostModel_T nvicModel =
+{
+    .name = "NVIC",
+    .base = NVIC_BASE,
+    .size = sizeof(NVIC_Type),
+    .read = HostNvicRead,
+    .write = HostNvicWrite,
+};
+
+/* Cycle count at the last CYCCNT write */
+static uint64_t dwtOrigin;
+static uint32_t dwtValue;
+
+static void HostDwtReset(HostModel_T* model, uint32_t offset)
+{
+    (void)model;
+    (void)offset;
+
+    dwtOrigin = HostSimCycles();
+    dwtValue = 0;
+}
+
+static void HostDwtRead(HostModel_T* model, uint32_t offset)
+{
+    volatile uint32_t* ctrl = HostSimReg(model->base + offsetof(DWT_Type, CTRL));
+
+    if (offset == offsetof(DWT_Type, CYCCNT))
+    {
+        if ((*ctrl & DWT_CTRL_CYCCNTENA_Msk) != 0)
+        {
+            *HostSimReg(model->base + offset) = dwtValue + (uint32_t)(HostSimCycles() - dwtOrigin);
+        }
+    }
+}
+
+static void HostDwtWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* cyccnt = HostSimReg(model->base + offsetof(DWT_Type, CYCCNT));
+
+    if (offset == offsetof(DWT_Type, CYCCNT))
+    {
+        dwtValue = *cyccnt;
+        dwtOrigin = HostSimCycles();
+    }
+    else if (offset == offsetof(DWT_Type, CTRL))
+    {
+        uint32_t ctrl = *HostSimReg(model->base + offset);
+
+        /* Freeze or resume counting */
+        if (((oldValue ^ ctrl) & DWT_CTRL_CYCCNTENA_Msk) != 0)
+        {
+            if ((ctrl & DWT_CTRL_CYCCNTENA_Msk) == 0)
+            {
+                dwtValue += (uint32_t)(HostSimCycles() - dwtOrigin);
+                *cyccnt = dwtValue;
+            }
+            dwtOrigin = HostSimCycles();
+        }
+    }
+}
+
+static HostModel_T dwtModel =
+{
+    .name = "DWT",
+    .base = DWT_BASE,
+    .size = sizeof(DWT_Type),
+    .reset = HostDwtReset,
+    .read = HostDwtRead,
+    .write = HostDwtWrite,
+};
+
+/*!
+ * @brief       Register the NVIC and DWT models.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostCoreModelsAdd(void)
+{
+    HostSimAddModel(&nvicModel);
+    HostSimAddModel(&dwtModel);
+}
@@ -0,0 +1,76 @@
+/*!
+ * @file        HostCrc.c
+ *
+ * @brief       CRC unit model for the host build: CRC-32/MPEG-2
+ *              (polynomial 0x04C11DB7, MSB first, no reflection), one
+ *              32-bit word per DATA write.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+static uint32_t crcValue;
+
+static void HostCrcReset(HostModel_T* model, uint32_t offset)
+{
+    (void)offset;
+
+    crcValue = 0xFFFFFFFFU;
+    *HostSimReg(model->base + offsetof(CRC_T, DATA)) = crcValue;
+}
+
+static void HostCrcWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* reg = HostSimReg(model->base + offset);
+    uint32_t bit;
+
+    (void)oldValue;
+
+    switch (offset)
+    {
+        case offsetof(CRC_T, DATA):
+            crcValue ^= *reg;
+            for (bit = 0; bit < 32; bit++)
+            {
+                crcValue = (crcValue & 0x80000000U) ? ((crcValue << 1) ^ 0x04C11DB7U) : (crcValue << 1);
+            }
+            *reg = crcValue;
+            break;
+
+        case offsetof(CRC_T, INDATA):
+            *reg &= 0xFFU;
+            break;
+
+        case offsetof(CRC_T, CTRL):
+            if ((*reg & 1U) != 0)
+            {
+                HostCrcReset(model, 0);
+            }
+            *reg = 0;
+            break;
+
+        default:
+            break;
+    }
+}
+
+static HostModel_T crcModel =
+{
+    .name = "CRC",
+    .base = CRC_BASE,
+    .size = sizeof(CRC_T),
+    .reset = HostCrcReset,
+    .write = HostCrcWrite,
+};
+
+/*!
+ * @brief       Register the CRC model.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostCrcModelAdd(void)
+{
+    HostSimAddModel(&crcModel);
+}
@@ -0,0 +1,279 @@
+/*!
+ * @file        HostDma.c
+ *
+ * @brief       DMA1/DMA2 stream model for the host build.
+ *
+ *              Memory-to-memory and memory-to-peripheral streams run a full
+ *              pass as soon as they are enabled (unless the peripheral model
+ *              is paced); peripheral-to-memory streams and paced peripherals
+ *              move one item per HostDmaRequest(). Items are PERSIZECFG wide
+ *              on both sides, FIFO packing is not modelled. Circular streams
+ *              reload NDATA (and swap targets in double-buffer mode) at the
+ *              end of each pass; an instant circular stream stops after one
+ *              pass instead of spinning forever.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+#define DMA_SCFG_EN         (1UL << 0)
+#define DMA_SCFG_HTXIEN     (1UL << 3)
+#define DMA_SCFG_TXCIEN     (1UL << 4)
+#define DMA_SCFG_CIRCMEN    (1UL << 8)
+#define DMA_SCFG_PERIM      (1UL << 9)
+#define DMA_SCFG_MEMIM      (1UL << 10)
+#define DMA_SCFG_DBM        (1UL << 18)
+#define DMA_SCFG_CTARG      (1UL << 19)
+
+#define DMA_FLAG_HTX        (1UL << 4)
+#define DMA_FLAG_TXC        (1UL << 5)
+
+#define DMA_DIR_P2M         0U
+#define DMA_DIR_M2P         1U
+#define DMA_DIR_M2M         2U
+
+#define DMA_STREAMS         8U
+#define DMA_STREAM_OFFSET(s) (0x10U + 0x18U * (s))
+
+/**
+ * @brief DMA controller state
+ */
+typedef struct
+{
+    HostModel_T model;
+    IRQn_Type   irq[DMA_STREAMS];
+    uint16_t    reload[DMA_STREAMS];    /*!< NDATA at enable */
+} HostDma_T;
+
+static HostDma_T dmas[] =
+{
+    {
+        .model = { .name = "DMA1", .base = DMA1_BASE },
+        .irq = { DMA1_STR0_IRQn, DMA1_STR1_IRQn, DMA1_STR2_IRQn, DMA1_STR3_IRQn,
+                 DMA1_STR4_IRQn, DMA1_STR5_IRQn, DMA1_STR6_IRQn, DMA1_STR7_IRQn },
+    },
+    {
+        .model = { .name = "DMA2", .base = DMA2_BASE },
+        .irq = { DMA2_STR0_IRQn, DMA2_STR1_IRQn, DMA2_STR2_IRQn, DMA2_STR3_IRQn,
+                 DMA2_STR4_IRQn, DMA2_STR5_IRQn, DMA2_STR6_IRQn, DMA2_STR7_IRQn },
+    },
+};
+
+#define DMA_COUNT (sizeof(dmas) / sizeof(dmas[0]))
+
+static const uint8_t flagShift[4] = { 0, 6, 16, 22 };
+
+static volatile uint32_t* HostDmaStreamReg(HostDma_T* dma, uint32_t stream, uint32_t offset)
+{
+    return HostSimReg(dma->model.base + DMA_STREAM_OFFSET(stream) + offset);
+}
+
+static void HostDmaFlag(HostDma_T* dma, uint32_t stream, uint32_t flag, uint32_t enableMask)
+{
+    uint32_t offset = (stream < 4) ? offsetof(DMA_T, LINTSTS) : offsetof(DMA_T, HINTSTS);
+
+    *HostSimReg(dma->model.base + offset) |= flag << flagShift[stream & 3U];
+
+    if ((*HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, SCFG)) & enableMask) != 0)
+    {
+        HostSimSetPending(dma->irq[stream]);
+    }
+}
+
+/* Move one item; returns 1 at the end of a pass */
+static uint8_t HostDmaStep(HostDma_T* dma, uint32_t stream)
+{
+    volatile uint32_t* scfgReg = HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, SCFG));
+    volatile uint32_t* ndataReg = HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, NDATA));
+    uint32_t scfg = *scfgReg;
+    uint32_t size = 1UL << ((scfg >> 11) & 3U);
+    uint32_t dir = (scfg >> 6) & 3U;
+    uint32_t reload = dma->reload[stream];
+    uint32_t index = reload - (*ndataReg & 0xFFFFU);
+    uint32_t paddr = *HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, PADDR));
+    uint32_t maddr = *HostDmaStreamReg(dma, stream, ((scfg & DMA_SCFG_CTARG) != 0) ?
+                                       offsetof(DMA_Stream_T, M1ADDR) : offsetof(DMA_Stream_T, M0ADDR));
+    uint32_t remaining;
+
+    if ((scfg & DMA_SCFG_PERIM) != 0)
+    {
+        paddr += index * size;
+    }
+    if ((scfg & DMA_SCFG_MEMIM) != 0)
+    {
+        maddr += index * size;
+    }
+
+    if (dir == DMA_DIR_P2M)
+    {
+        HostSimBusWrite(maddr, HostSimBusRead(paddr, size), size);
+    }
+    else
+    {
+        /* M2M reads from PADDR and writes to M0ADDR */
+        uint32_t src = (dir == DMA_DIR_M2M) ? paddr : maddr;
+        uint32_t dst = (dir == DMA_DIR_M2M) ? maddr : paddr;
+
+        HostSimBusWrite(dst, HostSimBusRead(src, size), size);
+    }
+
+    remaining = (*ndataReg & 0xFFFFU) - 1U;
+    *ndataReg = remaining;
+
+    if (remaining == reload / 2U)
+    {
+        HostDmaFlag(dma, stream, DMA_FLAG_HTX, DMA_SCFG_HTXIEN);
+    }
+    if (remaining != 0)
+    {
+        return 0;
+    }
+
+    if (((scfg & (DMA_SCFG_CIRCMEN | DMA_SCFG_DBM)) != 0) && (dir != DMA_DIR_M2M))
+    {
+        *ndataReg = reload;
+        if ((scfg & DMA_SCFG_DBM) != 0)
+        {
+            *scfgReg ^= DMA_SCFG_CTARG;
+        }
+    }
+    else
+    {
+        *scfgReg &= ~DMA_SCFG_EN;
+    }
+    HostDmaFlag(dma, stream, DMA_FLAG_TXC, DMA_SCFG_TXCIEN);
+
+    return 1;
+}
+
+static void HostDmaStart(HostDma_T* dma, uint32_t stream)
+{
+    uint32_t scfg = *HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, SCFG));
+    uint32_t dir = (scfg >> 6) & 3U;
+    uint32_t paddr = *HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, PADDR));
+    HostModel_T* peripheral = HostSimFindModel(paddr);
+
+    dma->reload[stream] = (uint16_t)*HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, NDATA));
+    if (dma->reload[stream] == 0)
+    {
+        *HostDmaStreamReg(dma, stream, offsetof(DMA_Stream_T, SCFG)) &= ~DMA_SCFG_EN;
+        return;
+    }
+
+    if ((dir == DMA_DIR_M2M) || ((dir == DMA_DIR_M2P) && ((peripheral == NULL) || !peripheral->paced)))
+    {
+        while (HostDmaStep(dma, stream) == 0)
+        {
+        }
+    }
+}
+
+static void HostDmaWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    HostDma_T* dma = (HostDma_T*)model;
+    volatile uint32_t* reg = HostSimReg(model->base + offset);
+    uint32_t stream;
+
+    switch (offset)
+    {
+        case offsetof(DMA_T, LIFCLR):
+            *HostSimReg(model->base + offsetof(DMA_T, LINTSTS)) &= ~*reg;
+            *reg = 0;
+            return;
+
+        case offsetof(DMA_T, HIFCLR):
+            *HostSimReg(model->base + offsetof(DMA_T, HINTSTS)) &= ~*reg;
+            *reg = 0;
+            return;
+
+        case offsetof(DMA_T, LINTSTS):
+        case offsetof(DMA_T, HINTSTS):
+            /* Read-only */
+            *reg = oldValue;
+            return;
+
+        default:
+            break;
+    }
+
+    stream = (offset - DMA_STREAM_OFFSET(0)) / 0x18U;
+    if ((stream < DMA_STREAMS) && (offset == DMA_STREAM_OFFSET(stream) + offsetof(DMA_Stream_T, SCFG)))
+    {
+        if (((oldValue & DMA_SCFG_EN) == 0) && ((*reg & DMA_SCFG_EN) != 0))
+        {
+            HostDmaStart(dma, stream);
+        }
+    }
+}
+
+/* First enabled stream on a peripheral address whose direction is in dirMask */
+static uint8_t HostDmaServe(uint32_t peripheralAddr, uint32_t dirMask)
+{
+    uint32_t i, stream, scfg;
+
+    for (i = 0; i < DMA_COUNT; i++)
+    {
+        for (stream = 0; stream < DMA_STREAMS; stream++)
+        {
+            scfg = *HostDmaStreamReg(&dmas[i], stream, offsetof(DMA_Stream_T, SCFG));
+            if (((scfg & DMA_SCFG_EN) != 0) && ((dirMask & (1UL << ((scfg >> 6) & 3U))) != 0) &&
+                (*HostDmaStreamReg(&dmas[i], stream, offsetof(DMA_Stream_T, PADDR)) == peripheralAddr))
+            {
+                HostSimLock();
+                HostDmaStep(&dmas[i], stream);
+                HostSimUnlock();
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief       DMA request from a peripheral: the enabled stream whose
+ *              PADDR matches moves one item.
+ *
+ * @param       peripheralAddr:  Peripheral data register address
+ *
+ * @retval      1 when a stream served the request, 0 otherwise
+ */
+uint8_t HostDmaRequest(uint32_t peripheralAddr)
+{
+    return HostDmaServe(peripheralAddr, (1UL << DMA_DIR_P2M) | (1UL << DMA_DIR_M2P));
+}
+
+/*!
+ * @brief       DMA request of one direction, for peripherals whose receive
+ *              and transmit streams share a data register (SPI).
+ *
+ * @param       peripheralAddr:  Peripheral data register address
+ *
+ * @param       output:          1: memory-to-peripheral stream,
+ *                               0: peripheral-to-memory stream
+ *
+ * @retval      1 when a stream served the request, 0 otherwise
+ */
+uint8_t HostDmaRequestDir(uint32_t peripheralAddr, uint8_t output)
+{
+    return HostDmaServe(peripheralAddr, output ? (1UL << DMA_DIR_M2P) : (1UL << DMA_DIR_P2M));
+}
+
+/*!
+ * @brief       Register the DMA1 and DMA2 models.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostDmaModelAdd(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < DMA_COUNT; i++)
+    {
+        dmas[i].model.size = DMA_STREAM_OFFSET(DMA_STREAMS);
+        dmas[i].model.write = HostDmaWrite;
+        HostSimAddModel(&dmas[i].model);
+    }
+}
@@ -0,0 +1,617 @@
+/*!
+ * @file        HostEth.c
+ *
+ * @brief       Ethernet MAC DMA model for the host build.
+ *
+ *              Only the DMA register block is modelled; MAC, MMC and PTP
+ *              registers are plain RAM. Transmission runs on a transmit
+ *              poll demand (or when STTX is set): every complete frame the
+ *              descriptors hand over (OWN set from first to last segment)
+ *              is gathered, its descriptors are given back by clearing OWN
+ *              and the frame goes to the sink. Reception is driven by
+ *              HostEthInject(), which scatters a frame plus FCS over the
+ *              descriptors the DMA owns, or reports a missed frame and RBU
+ *              when there are not enough. Both chained (TCH/RCH) and ring
+ *              descriptor lists are walked; the enhanced descriptor size
+ *              follows DMABMOD.EDFEN.
+ *
+ *              The checksum engines are modelled with the software checksum
+ *              from User/Net.h: transmit insertion per the first descriptor's
+ *              CIC field, and receive checking of IPv4 header and UDP/TCP/ICMP
+ *              payload when MAC CFG.IPC is set, reported in the extended
+ *              status word (or RDES0 without enhanced descriptors).
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "HostSim.h"
+#include "Net.h"
+
+#define ETH_DMA_REG(field)      (offsetof(ETH_T, field) - offsetof(ETH_T, DMABMOD))
+
+#define ETH_DMABMOD_SWR         (1UL << 0)
+#define ETH_DMABMOD_DSL_POS     2U
+#define ETH_DMABMOD_DSL_MSK     (0x1FUL << ETH_DMABMOD_DSL_POS)
+#define ETH_DMABMOD_EDFEN       (1UL << 7)
+#define ETH_DMABMOD_RESET       0x00020101UL
+
+#define ETH_MAC_CFG_IPC         (1UL << 10)
+
+#define ETH_DMAOPMOD_STRX       (1UL << 1)
+#define ETH_DMAOPMOD_STTX       (1UL << 13)
+#define ETH_DMAOPMOD_FTXF       (1UL << 20)
+
+#define ETH_DMASTS_TX           (1UL << 0)
+#define ETH_DMASTS_TBU          (1UL << 2)
+#define ETH_DMASTS_RX           (1UL << 6)
+#define ETH_DMASTS_RBU          (1UL << 7)
+#define ETH_DMASTS_AIS          (1UL << 15)
+#define ETH_DMASTS_NIS          (1UL << 16)
+#define ETH_DMASTS_NORMAL       ((1UL << 0) | (1UL << 2) | (1UL << 6) | (1UL << 14))
+#define ETH_DMASTS_ABNORMAL     ((1UL << 1) | (1UL << 3) | (1UL << 4) | (1UL << 5) | (1UL << 7) | \
+                                 (1UL << 8) | (1UL << 9) | (1UL << 10) | (1UL << 13))
+#define ETH_DMASTS_CLEARABLE    0x0001E7FFUL
+
+/* Descriptor word 0 / word 1 bits */
+#define ETH_DESC_OWN            (1UL << 31)
+#define ETH_TDES0_INTC          (1UL << 30)
+#define ETH_TDES0_LS            (1UL << 29)
+#define ETH_TDES0_FS            (1UL << 28)
+#define ETH_TDES0_TER           (1UL << 21)
+#define ETH_TDES0_CIC_POS       22U
+#define ETH_TDES0_CIC_MSK       (3UL << ETH_TDES0_CIC_POS)
+#define ETH_TDES0_TCH           (1UL << 20)
+#define ETH_TDES0_STATUS        0x0003FFFFUL
+#define ETH_RDES0_FL_POS        16U
+#define ETH_RDES0_FS            (1UL << 9)
+#define ETH_RDES0_LS            (1UL << 8)
+#define ETH_RDES0_IPHCE         (1UL << 7)
+#define ETH_RDES0_FT            (1UL << 5)
+#define ETH_RDES0_ESA           (1UL << 0)
+#define ETH_RDES1_DIC           (1UL << 31)
+#define ETH_RDES1_RER           (1UL << 15)
+#define ETH_RDES1_RCH           (1UL << 14)
+#define ETH_RDES4_IPV4P         (1UL << 6)
+#define ETH_RDES4_IPCB          (1UL << 5)
+#define ETH_RDES4_IPPE          (1UL << 4)
+#define ETH_RDES4_IPHE          (1UL << 3)
+#define ETH_DES_BS1_MSK         0x1FFFUL
+#define ETH_DES_BS2_POS         16U
+
+#define ETH_CIC_IPV4HEADER      1U
+#define ETH_CIC_FULL            3U
+
+#define ETH_HDR_LEN             14U
+#define IP_PROTO_ICMP           1U
+#define IP_PROTO_TCP            6U
+#define IP_PROTO_UDP            17U
+
+#define ETH_FCS_LEN             4U
+#define ETH_FRAME_MAX           16384U
+
+/**
+ * @brief DMA descriptor, as seen by the model
+ */
+typedef struct
+{
+    volatile uint32_t status;
+    volatile uint32_t control;
+    volatile uint32_t buffer1;
+    volatile uint32_t buffer2;
+    volatile uint32_t extStatus;    /*!< Enhanced descriptors only */
+} HostEthDesc_T;
+
+static HostModel_T ethModel;
+static uint32_t txCurrent;      /* Descriptor the transmit DMA fetches next */
+static uint32_t rxCurrent;      /* Descriptor the receive DMA fetches next */
+static uint8_t frameBuf[ETH_FRAME_MAX];
+static HostEthSink_T sink;
+
+static volatile uint32_t* HostEthReg(uint32_t offset)
+{
+    return HostSimReg(ethModel.base + offset);
+}
+
+static HostEthDesc_T* HostEthDesc(uint32_t addr)
+{
+    return (HostEthDesc_T*)(uintptr_t)addr;
+}
+
+/* Next descriptor: chained, end of ring, or the next one in the list */
+static uint32_t HostEthNext(uint32_t addr, uint8_t chained, uint8_t endOfRing, uint32_t listOffset)
+{
+    uint32_t bmod = *HostEthReg(ETH_DMA_REG(DMABMOD));
+    uint32_t stride;
+
+    if (chained)
+    {
+        return HostEthDesc(addr)->buffer2;
+    }
+    if (endOfRing)
+    {
+        return *HostEthReg(listOffset);
+    }
+
+    stride = ((bmod & ETH_DMABMOD_EDFEN) != 0) ? 32U : 16U;
+    stride += ((bmod & ETH_DMABMOD_DSL_MSK) >> ETH_DMABMOD_DSL_POS) * 4U;
+
+    return addr + stride;
+}
+
+static uint32_t HostEthTxNext(uint32_t addr)
+{
+    uint32_t status = HostEthDesc(addr)->status;
+
+    return HostEthNext(addr, (status & ETH_TDES0_TCH) != 0, (status & ETH_TDES0_TER) != 0,
+                       ETH_DMA_REG(DMATXDLADDR));
+}
+
+static uint32_t HostEthRxNext(uint32_t addr)
+{
+    uint32_t control = HostEthDesc(addr)->control;
+
+    return HostEthNext(addr, (control & ETH_RDES1_RCH) != 0, (control & ETH_RDES1_RER) != 0,
+                       ETH_DMA_REG(DMARXDLADDR));
+}
+
+/* Update the summary bits and raise the interrupt for enabled flags */
+static void HostEthUpdate(void)
+{
+    volatile uint32_t* sts = HostEthReg(ETH_DMA_REG(DMASTS));
+    uint32_t inten = *HostEthReg(ETH_DMA_REG(DMAINTEN));
+    uint32_t raise = 0;
+
+    if ((*sts & inten & ETH_DMASTS_NORMAL) != 0)
+    {
+        *sts |= ETH_DMASTS_NIS;
+        raise |= inten & ETH_DMASTS_NIS;
+    }
+    if ((*sts & inten & ETH_DMASTS_ABNORMAL) != 0)
+    {
+        *sts |= ETH_DMASTS_AIS;
+        raise |= inten & ETH_DMASTS_AIS;
+    }
+
+    if (raise != 0)
+    {
+        HostSimSetPending(ETH_IRQn);
+    }
+}
+
+/* IPv4 header length of a frame, 0 if it is not a well-formed IPv4 frame */
+static uint32_t HostEthIpv4(const uint8_t* frame, uint32_t len)
+{
+    const uint8_t* ip = &frame[ETH_HDR_LEN];
+    uint32_t ihl, ipLen;
+
+    if ((len < ETH_HDR_LEN + 20U) || (NetRead16(&frame[12]) != 0x0800U) || ((ip[0] >> 4) != 4U))
+    {
+        return 0;
+    }
+
+    ihl = (ip[0] & 0x0FU) * 4U;
+    ipLen = NetRead16(&ip[2]);
+    if ((ihl < 20U) || (ipLen < ihl) || (ipLen > len - ETH_HDR_LEN))
+    {
+        return 0;
+    }
+
+    return ihl;
+}
+
+/* Offset of the checksum field in a transport header, 0 if not offloaded */
+static uint32_t HostEthChecksumField(uint8_t proto)
+{
+    switch (proto)
+    {
+        case IP_PROTO_UDP:
+            return 6U;
+        case IP_PROTO_TCP:
+            return 16U;
+        case IP_PROTO_ICMP:
+            return 2U;
+        default:
+            return 0;
+    }
+}
+
+/* Transport checksum sum over the IPv4 payload, with the pseudo-header except for ICMP */
+static uint32_t HostEthPayloadSum(const uint8_t* ip, uint32_t ihl, uint8_t pseudo)
+{
+    uint32_t payloadLen = NetRead16(&ip[2]) - ihl;
+    uint32_t sum = NetChecksumAdd(0, &ip[ihl], payloadLen);
+
+    if (pseudo && (ip[9] != IP_PROTO_ICMP))
+    {
+        sum += NetChecksumAdd(0, &ip[12], 8) + NET_HTONS(ip[9]) + NET_HTONS(payloadLen);
+    }
+
+    return sum;
+}
+
+/* Transmit checksum insertion, CIC from the first descriptor */
+static void HostEthInsertChecksums(uint8_t* frame, uint32_t len, uint32_t cic)
+{
+    uint8_t* ip = &frame[ETH_HDR_LEN];
+    uint32_t ihl = HostEthIpv4(frame, len);
+    uint32_t field;
+    uint16_t csum;
+
+    if ((cic == 0) || (ihl == 0))
+    {
+        return;
+    }
+
+    ip[10] = 0;
+    ip[11] = 0;
+    csum = NetChecksum(ip, ihl);
+    memcpy(&ip[10], &csum, 2);
+
+    field = HostEthChecksumField(ip[9]);
+    if ((cic == ETH_CIC_IPV4HEADER) || (field == 0) || ((NetRead16(&ip[6]) & 0x3FFFU) != 0) ||
+        (NetRead16(&ip[2]) < ihl + field + 2U))
+    {
+        return;
+    }
+
+    /* Full insertion computes the pseudo-header itself, segment mode expects it in the field */
+    if (cic == ETH_CIC_FULL)
+    {
+        ip[ihl + field] = 0;
+        ip[ihl + field + 1U] = 0;
+    }
+    csum = NetChecksumFinish(HostEthPayloadSum(ip, ihl, cic == ETH_CIC_FULL));
+    if ((ip[9] == IP_PROTO_UDP) && (csum == 0))
+    {
+        csum = 0xFFFF;
+    }
+    memcpy(&ip[ihl + field], &csum, 2);
+}
+
+/* Receive checksum check, as an RDES4 extended status word */
+static uint32_t HostEthCheckChecksums(const uint8_t* frame, uint32_t len)
+{
+    const uint8_t* ip = &frame[ETH_HDR_LEN];
+    uint32_t ihl, field;
+    uint32_t ext = 0;
+
+    if ((*HostSimReg(ETH_BASE + offsetof(ETH_T, CFG)) & ETH_MAC_CFG_IPC) == 0)
+    {
+        return 0;
+    }
+    if ((len < ETH_HDR_LEN + 20U) || (NetRead16(&frame[12]) != 0x0800U) || ((ip[0] >> 4) != 4U))
+    {
+        return 0;
+    }
+
+    ext = ETH_RDES4_IPV4P;
+    ihl = HostEthIpv4(frame, len);
+    if ((ihl == 0) || (NetChecksum(ip, ihl) != 0))
+    {
+        return ext | ETH_RDES4_IPHE;
+    }
+
+    field = HostEthChecksumField(ip[9]);
+    if ((field == 0) || ((NetRead16(&ip[6]) & 0x3FFFU) != 0))
+    {
+        return ext | ETH_RDES4_IPCB;
+    }
+    ext |= (ip[9] == IP_PROTO_UDP) ? 1U : (ip[9] == IP_PROTO_TCP) ? 2U : 3U;
+
+    if ((NetRead16(&ip[2]) < ihl + field + 2U) ||
+        (((ip[9] != IP_PROTO_UDP) || (NetRead16(&ip[ihl + field]) != 0)) &&
+         (NetChecksumFinish(HostEthPayloadSum(ip, ihl, 1)) != 0)))
+    {
+        ext |= ETH_RDES4_IPPE;
+    }
+
+    return ext;
+}
+
+/* Send every complete frame handed to DMA; suspend on the first one that is not */
+static void HostEthTransmit(void)
+{
+    HostEthDesc_T* desc;
+    uint32_t addr, len, size, segs, cic;
+    uint32_t status = 0;
+
+    if (((*HostEthReg(ETH_DMA_REG(DMAOPMOD)) & ETH_DMAOPMOD_STTX) == 0) || (txCurrent == 0))
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        /* The whole frame must be owned by DMA before it is sent */
+        addr = txCurrent;
+        for (segs = 0; segs < 256U; segs++)
+        {
+            status = HostEthDesc(addr)->status;
+            if (((status & ETH_DESC_OWN) == 0) || ((status & ETH_TDES0_LS) != 0))
+            {
+                break;
+            }
+            addr = HostEthTxNext(addr);
+        }
+        if (((status & ETH_DESC_OWN) == 0) || ((status & ETH_TDES0_LS) == 0))
+        {
+            *HostEthReg(ETH_DMA_REG(DMASTS)) |= ETH_DMASTS_TBU;
+            break;
+        }
+
+        len = 0;
+        addr = txCurrent;
+        cic = (HostEthDesc(addr)->status & ETH_TDES0_CIC_MSK) >> ETH_TDES0_CIC_POS;
+        do
+        {
+            desc = HostEthDesc(addr);
+            status = desc->status;
+
+            size = desc->control & ETH_DES_BS1_MSK;
+            if (len + size <= ETH_FRAME_MAX)
+            {
+                memcpy(&frameBuf[len], (const void*)(uintptr_t)desc->buffer1, size);
+                len += size;
+            }
+            if ((status & ETH_TDES0_TCH) == 0)
+            {
+                size = (desc->control >> ETH_DES_BS2_POS) & ETH_DES_BS1_MSK;
+                if (len + size <= ETH_FRAME_MAX)
+                {
+                    memcpy(&frameBuf[len], (const void*)(uintptr_t)desc->buffer2, size);
+                    len += size;
+                }
+            }
+
+            addr = HostEthTxNext(addr);
+            desc->status = status & ~(ETH_DESC_OWN | ETH_TDES0_STATUS);
+        } while ((status & ETH_TDES0_LS) == 0);
+
+        txCurrent = addr;
+        *HostEthReg(ETH_DMA_REG(DMAHTXD)) = txCurrent;
+        if ((status & ETH_TDES0_INTC) != 0)
+        {
+            *HostEthReg(ETH_DMA_REG(DMASTS)) |= ETH_DMASTS_TX;
+        }
+
+        HostEthInsertChecksums(frameBuf, len, cic);
+        if (sink != NULL)
+        {
+            sink(frameBuf, len);
+        }
+    }
+
+    HostEthUpdate();
+}
+
+static void HostEthReset(HostModel_T* model, uint32_t offset)
+{
+    (void)offset;
+
+    memset((void*)HostSimReg(model->base), 0, model->size);
+    /* The reset completes at once: SWR reads back clear */
+    *HostEthReg(ETH_DMA_REG(DMABMOD)) = ETH_DMABMOD_RESET & ~ETH_DMABMOD_SWR;
+    txCurrent = 0;
+    rxCurrent = 0;
+}
+
+static void HostEthWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* reg = HostSimReg(model->base + offset);
+
+    switch (offset)
+    {
+        case ETH_DMA_REG(DMABMOD):
+            if ((*reg & ETH_DMABMOD_SWR) != 0)
+            {
+                HostEthReset(model, 0);
+            }
+            break;
+
+        case ETH_DMA_REG(DMATXPD):
+            HostEthTransmit();
+            break;
+
+        case ETH_DMA_REG(DMARXDLADDR):
+            rxCurrent = *reg;
+            *HostEthReg(ETH_DMA_REG(DMAHRXD)) = rxCurrent;
+            break;
+
+        case ETH_DMA_REG(DMATXDLADDR):
+            txCurrent = *reg;
+            *HostEthReg(ETH_DMA_REG(DMAHTXD)) = txCurrent;
+            break;
+
+        case ETH_DMA_REG(DMASTS):
+            /* Write 1 to clear, the process state fields are read-only */
+            *reg = oldValue & ~(*reg & ETH_DMASTS_CLEARABLE);
+            break;
+
+        case ETH_DMA_REG(DMAOPMOD):
+            /* The transmit FIFO flush completes at once */
+            *reg &= ~ETH_DMAOPMOD_FTXF;
+            if (((oldValue & ETH_DMAOPMOD_STTX) == 0) && ((*reg & ETH_DMAOPMOD_STTX) != 0))
+            {
+                HostEthTransmit();
+            }
+            break;
+
+        case ETH_DMA_REG(DMAINTEN):
+            HostEthUpdate();
+            break;
+
+        default:
+            break;
+    }
+}
+
+static HostModel_T ethModel =
+{
+    .name = "ETH",
+    .base = ETH_DMA_BASE,
+    .size = ETH_DMA_REG(DMAHRXBADDR) + 4U,
+    .reset = HostEthReset,
+    .write = HostEthWrite,
+};
+
+/* Ethernet FCS: CRC-32, reflected, transmitted least significant byte first */
+static uint32_t HostEthFcs(const uint8_t* data, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    uint32_t i, bit;
+
+    for (i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+
+    return ~crc;
+}
+
+/* Copy up to size bytes of frame + FCS from position pos into a receive buffer */
+static uint32_t HostEthScatter(uint32_t dst, uint32_t size, const uint8_t* data, uint32_t len,
+                               const uint8_t* fcs, uint32_t pos)
+{
+    uint32_t n = 0;
+
+    while ((n < size) && (pos + n < len + ETH_FCS_LEN))
+    {
+        HostSimBusWrite(dst + n, (pos + n < len) ? data[pos + n] : fcs[pos + n - len], 1);
+        n++;
+    }
+
+    return n;
+}
+
+/*!
+ * @brief       Set the function that receives transmitted frames.
+ *
+ * @param       newSink:  Called with each frame (without FCS); may call
+ *                        HostEthInject() to loop frames back. NULL drops them.
+ *
+ * @retval      None
+ */
+void HostEthSetSink(HostEthSink_T newSink)
+{
+    sink = newSink;
+}
+
+/*!
+ * @brief       Receive a frame: write it and its FCS into the descriptors
+ *              the receive DMA owns, clear their OWN bits and raise the
+ *              receive interrupt.
+ *
+ * @param       data:  Frame from the destination address up to the payload end
+ *
+ * @param       len:   Frame length without FCS
+ *
+ * @retval      1 when received, 0 when the receive DMA is stopped or has no
+ *              room (counted as a missed frame, RBU set)
+ */
+uint8_t HostEthInject(const uint8_t* data, uint32_t len)
+{
+    HostEthDesc_T* desc;
+    uint8_t fcs[ETH_FCS_LEN];
+    uint32_t total = len + ETH_FCS_LEN;
+    uint32_t room = 0;
+    uint32_t segs = 0;
+    uint32_t addr, pos, control, status, crc, ext;
+
+    if (((*HostEthReg(ETH_DMA_REG(DMAOPMOD)) & ETH_DMAOPMOD_STRX) == 0) || (rxCurrent == 0))
+    {
+        return 0;
+    }
+
+    HostSimLock();
+
+    /* Check for room first: the model never leaves a frame half written */
+    for (addr = rxCurrent; room < total; addr = HostEthRxNext(addr))
+    {
+        desc = HostEthDesc(addr);
+        if (((desc->status & ETH_DESC_OWN) == 0) || (++segs > 256U))
+        {
+            *HostEthReg(ETH_DMA_REG(DMASTS)) |= ETH_DMASTS_RBU;
+            (*HostEthReg(ETH_DMA_REG(DMAMFABOCNT)))++;
+            HostEthUpdate();
+            HostSimUnlock();
+            return 0;
+        }
+        room += desc->control & ETH_DES_BS1_MSK;
+        if ((desc->control & ETH_RDES1_RCH) == 0)
+        {
+            room += (desc->control >> ETH_DES_BS2_POS) & ETH_DES_BS1_MSK;
+        }
+    }
+
+    ext = HostEthCheckChecksums(data, len);
+    crc = HostEthFcs(data, len);
+    fcs[0] = (uint8_t)crc;
+    fcs[1] = (uint8_t)(crc >> 8);
+    fcs[2] = (uint8_t)(crc >> 16);
+    fcs[3] = (uint8_t)(crc >> 24);
+
+    pos = 0;
+    addr = rxCurrent;
+    do
+    {
+        desc = HostEthDesc(addr);
+        control = desc->control;
+
+        status = (pos == 0) ? ETH_RDES0_FS : 0;
+        pos += HostEthScatter(desc->buffer1, control & ETH_DES_BS1_MSK, data, len, fcs, pos);
+        if ((control & ETH_RDES1_RCH) == 0)
+        {
+            pos += HostEthScatter(desc->buffer2, (control >> ETH_DES_BS2_POS) & ETH_DES_BS1_MSK,
+                                  data, len, fcs, pos);
+        }
+        if (pos == total)
+        {
+            status |= ETH_RDES0_LS | (total << ETH_RDES0_FL_POS);
+            if ((len >= ETH_HDR_LEN) && (NetRead16(&data[12]) >= 0x0600U))
+            {
+                status |= ETH_RDES0_FT;
+            }
+            if ((*HostEthReg(ETH_DMA_REG(DMABMOD)) & ETH_DMABMOD_EDFEN) != 0)
+            {
+                desc->extStatus = ext;
+                status |= (ext != 0) ? ETH_RDES0_ESA : 0;
+            }
+            else
+            {
+                status |= ((ext & ETH_RDES4_IPHE) != 0) ? ETH_RDES0_IPHCE : 0;
+                status |= ((ext & ETH_RDES4_IPPE) != 0) ? ETH_RDES0_ESA : 0;
+            }
+        }
+
+        addr = HostEthRxNext(addr);
+        desc->status = status;
+    } while (pos < total);
+
+    rxCurrent = addr;
+    *HostEthReg(ETH_DMA_REG(DMAHRXD)) = rxCurrent;
+    if ((control & ETH_RDES1_DIC) == 0)
+    {
+        *HostEthReg(ETH_DMA_REG(DMASTS)) |= ETH_DMASTS_RX;
+    }
+    HostEthUpdate();
+
+    HostSimUnlock();
+
+    return 1;
+}
+
+/*!
+ * @brief       Register the Ethernet DMA model.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostEthModelAdd(void)
+{
+    HostSimAddModel(&ethModel);
+}
@@ -0,0 +1,100 @@
+/*!
+ * @file        HostGpio.c
+ *
+ * @brief       GPIO bit set/reset model for the host build. A write to
+ *              BSCL/BSCH sets and clears ODR bits (set wins when both are
+ *              given) and reads back as zero. A watcher registered for a
+ *              port sees every change of its outputs, which is how device
+ *              models follow a chip select. The other GPIO registers stay
+ *              plain RAM.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+/**
+ * @brief GPIO port state
+ */
+typedef struct
+{
+    HostModel_T     model;      /*!< Covers the BSC word only */
+    uint32_t        port;       /*!< Port base address */
+    HostGpioWatch_T watch;
+} HostGpio_T;
+
+static HostGpio_T gpios[] =
+{
+    { .model = { .name = "GPIOA" }, .port = GPIOA_BASE },
+    { .model = { .name = "GPIOB" }, .port = GPIOB_BASE },
+    { .model = { .name = "GPIOC" }, .port = GPIOC_BASE },
+    { .model = { .name = "GPIOD" }, .port = GPIOD_BASE },
+    { .model = { .name = "GPIOE" }, .port = GPIOE_BASE },
+    { .model = { .name = "GPIOF" }, .port = GPIOF_BASE },
+    { .model = { .name = "GPIOG" }, .port = GPIOG_BASE },
+    { .model = { .name = "GPIOH" }, .port = GPIOH_BASE },
+    { .model = { .name = "GPIOI" }, .port = GPIOI_BASE },
+};
+
+#define GPIO_COUNT (sizeof(gpios) / sizeof(gpios[0]))
+
+static void HostGpioWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    HostGpio_T* gpio = (HostGpio_T*)model;
+    volatile uint32_t* bsc = HostSimReg(model->base + offset);
+    volatile uint32_t* odr = HostSimReg(gpio->port + offsetof(GPIO_T, ODATA));
+    uint32_t value = *bsc;
+    uint32_t old = *odr;
+
+    (void)oldValue;
+
+    *bsc = 0;
+    *odr = (old & ~(value >> 16)) | (value & 0xFFFFU);
+
+    if ((gpio->watch != NULL) && (*odr != old))
+    {
+        gpio->watch((GPIO_T*)(uintptr_t)gpio->port, (uint16_t)*odr, (uint16_t)(*odr ^ old));
+    }
+}
+
+/*!
+ * @brief       Follow the outputs of a port.
+ *
+ * @param       port:   GPIOA..GPIOI
+ *
+ * @param       watch:  Called after each change through BSCL/BSCH, NULL
+ *                      to stop
+ *
+ * @retval      None
+ */
+void HostGpioSetWatch(GPIO_T* port, HostGpioWatch_T watch)
+{
+    uint32_t i;
+
+    for (i = 0; i < GPIO_COUNT; i++)
+    {
+        if (gpios[i].port == (uint32_t)(uintptr_t)port)
+        {
+            gpios[i].watch = watch;
+        }
+    }
+}
+
+/*!
+ * @brief       Register the GPIO models.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostGpioModelAdd(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < GPIO_COUNT; i++)
+    {
+        gpios[i].model.base = gpios[i].port + offsetof(GPIO_T, BSCL);
+        gpios[i].model.size = 4;
+        gpios[i].model.write = HostGpioWrite;
+        HostSimAddModel(&gpios[i].model);
+    }
+}
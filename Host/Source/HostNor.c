@@ -0,0 +1,352 @@
+/*!
+ * @file        HostNor.c
+ *
+ * @brief       Serial NOR flash model for the host build: a 25-series part
+ *              (3-byte addresses, 256-byte pages, 4/32/64 KiB erase) behind
+ *              an SPI model, selected by a GPIO pin driven low. It answers
+ *              READ ID, READ SFDP (JESD216 header and a 16-DWORD basic
+ *              parameter table describing the part), READ and FAST READ,
+ *              and takes WRITE ENABLE/DISABLE, PAGE PROGRAM (wrapping in
+ *              the page, bits only cleared) and the erase commands when
+ *              the write enable latch is set. Programs and erases happen
+ *              at chip select release and then keep WIP set for a number
+ *              of status register reads, during which every other command
+ *              is ignored.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "HostSim.h"
+
+#define NOR_CMD_PP          0x02U
+#define NOR_CMD_READ        0x03U
+#define NOR_CMD_WRDI        0x04U
+#define NOR_CMD_RDSR        0x05U
+#define NOR_CMD_WREN        0x06U
+#define NOR_CMD_FAST_READ   0x0BU
+#define NOR_CMD_SE          0x20U
+#define NOR_CMD_BE32        0x52U
+#define NOR_CMD_SFDP        0x5AU
+#define NOR_CMD_CE          0xC7U
+#define NOR_CMD_BE64        0xD8U
+#define NOR_CMD_RDID        0x9FU
+
+#define NOR_STATUS_WIP      0x01U
+#define NOR_STATUS_WEL      0x02U
+
+#define NOR_PAGE_SIZE       256U
+#define NOR_MANUFACTURER    0xEFU
+#define NOR_MEMORY_TYPE     0x40U
+
+/* Status reads that see WIP set after each operation */
+#define NOR_POLLS_PROGRAM   3U
+#define NOR_POLLS_ERASE     12U
+#define NOR_POLLS_CHIP      64U
+
+/* SFDP image: header, one parameter header, basic table at 0x80 */
+#define NOR_SFDP_SIZE       0x0C0U
+#define NOR_SFDP_BFPT       0x080U
+
+/**
+ * @brief NOR flash state
+ */
+typedef struct
+{
+    SPI_T*      spi;
+    GPIO_T*     csPort;
+    uint16_t    csPin;
+    uint8_t*    memory;
+    uint32_t    size;
+    uint8_t     sfdp[NOR_SFDP_SIZE];
+    uint8_t     selected;
+    uint8_t     opcode;
+    uint32_t    count;          /*!< Frames since select */
+    uint32_t    address;
+    uint8_t     status;
+    uint32_t    busy;           /*!< Status reads left with WIP set */
+    uint8_t     page[NOR_PAGE_SIZE];
+    uint32_t    pageBytes;      /*!< Page program bytes received */
+} HostNor_T;
+
+static HostNor_T nor;
+
+static void HostNorPut32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+/* JESD216B tables for a part of nor.size bytes */
+static void HostNorBuildSfdp(void)
+{
+    static const uint32_t bfpt[16] =
+    {
+        0xFFF120E5U,    /* 4 KiB erase 0x20, 1-1-2, 1-2-2, 1-4-4, 1-1-4, 3-byte addresses */
+        0,              /* Density, below */
+        0x6B08EB44U,    /* 1-1-4 0x6B 8 dummy; 1-4-4 0xEB 2 mode + 4 dummy */
+        0xBB403B08U,    /* 1-1-2 0x3B 8 dummy; 1-2-2 0xBB 2 mode */
+        0xFFFFFFEEU,    /* No 2-2-2 or 4-4-4 */
+        0xFF00FFFFU,
+        0xFF00FFFFU,
+        0x520F200CU,    /* 4 KiB 0x20, 32 KiB 0x52 */
+        0xFF00D810U,    /* 64 KiB 0xD8 */
+        0x00000000U,
+        0x00000082U,    /* 256-byte pages */
+        0xFFFFFFFFU,
+        0xFFFFFFFFU,
+        0xFFFFFFFFU,
+        0xFFFFFFFFU,
+        0xFFFFFFFFU,
+    };
+    uint32_t i;
+
+    memset(nor.sfdp, 0xFF, sizeof(nor.sfdp));
+
+    /* "SFDP", revision 1.6, one parameter header */
+    HostNorPut32(&nor.sfdp[0], 0x50444653U);
+    HostNorPut32(&nor.sfdp[4], 0xFF000106U);
+
+    /* JEDEC basic flash parameters, 1.6, 16 DWORDs at NOR_SFDP_BFPT */
+    HostNorPut32(&nor.sfdp[8], 0x10010600U);
+    HostNorPut32(&nor.sfdp[12], 0xFF000000U | NOR_SFDP_BFPT);
+
+    for (i = 0; i < 16U; i++)
+    {
+        HostNorPut32(&nor.sfdp[NOR_SFDP_BFPT + 4U * i], (i == 1U) ? (nor.size * 8U - 1U) : bfpt[i]);
+    }
+}
+
+/* Program and erase commands take effect at chip select release */
+static void HostNorRelease(void)
+{
+    uint32_t i, block;
+
+    if ((nor.status & NOR_STATUS_WIP) != 0)
+    {
+        return;
+    }
+
+    switch (nor.opcode)
+    {
+        case NOR_CMD_WREN:
+            nor.status |= NOR_STATUS_WEL;
+            return;
+
+        case NOR_CMD_WRDI:
+            nor.status &= ~NOR_STATUS_WEL;
+            return;
+
+        case NOR_CMD_PP:
+            if (((nor.status & NOR_STATUS_WEL) == 0) || (nor.count < 4U))
+            {
+                break;
+            }
+            for (i = 0; i < NOR_PAGE_SIZE; i++)
+            {
+                nor.memory[((nor.address % nor.size) & ~(NOR_PAGE_SIZE - 1U)) + i] &= nor.page[i];
+            }
+            nor.busy = NOR_POLLS_PROGRAM;
+            break;
+
+        case NOR_CMD_SE:
+        case NOR_CMD_BE32:
+        case NOR_CMD_BE64:
+            if (((nor.status & NOR_STATUS_WEL) == 0) || (nor.count != 4U))
+            {
+                break;
+            }
+            block = (nor.opcode == NOR_CMD_SE) ? 0x1000U : ((nor.opcode == NOR_CMD_BE32) ? 0x8000U : 0x10000U);
+            memset(&nor.memory[(nor.address % nor.size) & ~(block - 1U)], 0xFF, block);
+            nor.busy = NOR_POLLS_ERASE;
+            break;
+
+        case NOR_CMD_CE:
+            if (((nor.status & NOR_STATUS_WEL) == 0) || (nor.count != 1U))
+            {
+                break;
+            }
+            memset(nor.memory, 0xFF, nor.size);
+            nor.busy = NOR_POLLS_CHIP;
+            break;
+
+        default:
+            return;
+    }
+
+    if (nor.busy != 0)
+    {
+        nor.status |= NOR_STATUS_WIP;
+    }
+    nor.status &= ~NOR_STATUS_WEL;
+}
+
+static void HostNorSelect(GPIO_T* port, uint16_t odr, uint16_t changed)
+{
+    (void)port;
+
+    if ((changed & nor.csPin) == 0)
+    {
+        return;
+    }
+
+    if ((odr & nor.csPin) == 0)
+    {
+        nor.selected = 1;
+        nor.count = 0;
+        nor.address = 0;
+        nor.pageBytes = 0;
+        memset(nor.page, 0xFF, sizeof(nor.page));
+    }
+    else if (nor.selected)
+    {
+        nor.selected = 0;
+        if (nor.count != 0)
+        {
+            HostNorRelease();
+        }
+    }
+}
+
+static uint16_t HostNorExchange(SPI_T* spi, uint16_t mosi)
+{
+    uint32_t index = nor.count++;
+    uint8_t miso = 0xFF;
+
+    (void)spi;
+
+    if (!nor.selected)
+    {
+        return 0xFF;
+    }
+
+    if (index == 0)
+    {
+        nor.opcode = (uint8_t)mosi;
+        return 0xFF;
+    }
+
+    /* Only the status register answers while busy */
+    if (nor.opcode == NOR_CMD_RDSR)
+    {
+        miso = nor.status;
+        if ((nor.busy != 0) && (--nor.busy == 0))
+        {
+            nor.status &= ~NOR_STATUS_WIP;
+        }
+        return miso;
+    }
+    if ((nor.status & NOR_STATUS_WIP) != 0)
+    {
+        return 0xFF;
+    }
+
+    if (nor.opcode == NOR_CMD_RDID)
+    {
+        switch (index)
+        {
+            case 1:
+                return NOR_MANUFACTURER;
+            case 2:
+                return NOR_MEMORY_TYPE;
+            case 3:
+                return (uint8_t)(31U - (uint32_t)__builtin_clz(nor.size));
+            default:
+                return 0xFF;
+        }
+    }
+
+    if (index <= 3U)
+    {
+        nor.address = (nor.address << 8) | (uint8_t)mosi;
+        return 0xFF;
+    }
+
+    switch (nor.opcode)
+    {
+        case NOR_CMD_READ:
+            miso = nor.memory[nor.address++ % nor.size];
+            break;
+
+        case NOR_CMD_FAST_READ:
+            if (index > 4U)
+            {
+                miso = nor.memory[nor.address++ % nor.size];
+            }
+            break;
+
+        case NOR_CMD_SFDP:
+            if (index > 4U)
+            {
+                miso = (nor.address < NOR_SFDP_SIZE) ? nor.sfdp[nor.address] : 0xFF;
+                nor.address++;
+            }
+            break;
+
+        case NOR_CMD_PP:
+            /* Wraps in the page, later bytes replace earlier ones */
+            nor.page[(nor.address + nor.pageBytes) % NOR_PAGE_SIZE] = (uint8_t)mosi;
+            nor.pageBytes++;
+            break;
+
+        default:
+            break;
+    }
+
+    return miso;
+}
+
+/*!
+ * @brief       Put an erased NOR flash on an SPI bus.
+ *
+ * @param       spi:     SPI1, SPI2 or SPI3; the flash becomes its device
+ *
+ * @param       csPort:  Chip select port
+ *
+ * @param       csPin:   Chip select pin (GPIO_PIN_x), active low
+ *
+ * @param       size:    Power of two, 64 KiB to 16 MiB
+ *
+ * @retval      The flash array, for tests to inspect or preload
+ */
+uint8_t* HostNorAttach(SPI_T* spi, GPIO_T* csPort, uint16_t csPin, uint32_t size)
+{
+    free(nor.memory);
+    memset(&nor, 0, sizeof(nor));
+
+    nor.spi = spi;
+    nor.csPort = csPort;
+    nor.csPin = csPin;
+    nor.size = size;
+    nor.memory = malloc(size);
+    memset(nor.memory, 0xFF, size);
+    HostNorBuildSfdp();
+
+    HostSpiSetDevice(spi, HostNorExchange);
+    HostGpioSetWatch(csPort, HostNorSelect);
+
+    return nor.memory;
+}
+
+/*!
+ * @brief       Replace the basic parameter table of the attached flash.
+ *
+ * @param       bfpt:   Table DWORDs, bfpt[0] is the 1st DWORD
+ *
+ * @param       count:  DWORDs, 1 to 16; the parameter header says revision
+ *                      1.0 and this length
+ *
+ * @retval      None
+ */
+void HostNorSetSfdp(const uint32_t* bfpt, uint32_t count)
+{
+    uint32_t i;
+
+    memset(&nor.sfdp[NOR_SFDP_BFPT], 0xFF, NOR_SFDP_SIZE - NOR_SFDP_BFPT);
+    HostNorPut32(&nor.sfdp[8], (count << 24) | 0x00010000U);
+    for (i = 0; i < count; i++)
+    {
+        HostNorPut32(&nor.sfdp[NOR_SFDP_BFPT + 4U * i], bfpt[i]);
+    }
+}
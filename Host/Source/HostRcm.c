@@ -0,0 +1,81 @@
+/*!
+ * @file        HostRcm.c
+ *
+ * @brief       Reset and clock model for the host build: oscillators and
+ *              PLLs are ready as soon as they are enabled and the system
+ *              clock switch completes immediately.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+/* Every ready flag sits one bit above its enable bit */
+#define RCM_CTRL_READY_SRC  ((1UL << 0) | (1UL << 16) | (1UL << 24) | (1UL << 26))
+#define RCM_LSE_LSI_EN      (1UL << 0)
+
+static void HostRcmFollow(HostModel_T* model, uint32_t offset, uint32_t enableMask)
+{
+    volatile uint32_t* reg = HostSimReg(model->base + offset);
+    uint32_t value = *reg;
+
+    *reg = (value & ~(enableMask << 1)) | ((value & enableMask) << 1);
+}
+
+static void HostRcmReset(HostModel_T* model, uint32_t offset)
+{
+    (void)offset;
+
+    /* HSI on and ready, HSITRM = 16 */
+    *HostSimReg(model->base + offsetof(RCM_T, CTRL)) = 0x00000083U;
+    *HostSimReg(model->base + offsetof(RCM_T, PLL1CFG)) = 0x24003010U;
+    *HostSimReg(model->base + offsetof(RCM_T, PLL2CFG)) = 0x20003000U;
+    *HostSimReg(model->base + offsetof(RCM_T, CSTS)) = 0x0E000000U;
+}
+
+static void HostRcmWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* reg = HostSimReg(model->base + offset);
+
+    (void)oldValue;
+
+    switch (offset)
+    {
+        case offsetof(RCM_T, CTRL):
+            HostRcmFollow(model, offset, RCM_CTRL_READY_SRC);
+            break;
+
+        case offsetof(RCM_T, CFG):
+            /* SCLKSELSTS follows SCLKSEL */
+            *reg = (*reg & ~0x0CU) | ((*reg & 0x03U) << 2);
+            break;
+
+        case offsetof(RCM_T, BDCTRL):
+        case offsetof(RCM_T, CSTS):
+            HostRcmFollow(model, offset, RCM_LSE_LSI_EN);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static HostModel_T rcmModel =
+{
+    .name = "RCM",
+    .base = RCM_BASE,
+    .size = sizeof(RCM_T),
+    .reset = HostRcmReset,
+    .write = HostRcmWrite,
+};
+
+/*!
+ * @brief       Register the RCM model.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostRcmModelAdd(void)
+{
+    HostSimAddModel(&rcmModel);
+}
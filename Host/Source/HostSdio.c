@@ -0,0 +1,817 @@
+/*!
+ * @file        HostSdio.c
+ *
+ * @brief       SDIO controller and SD memory card model for the host build.
+ *              A command written with CPSMEN is answered at once by the
+ *              card, which follows the SD state machine (idle, ready,
+ *              ident, stby, tran, data, rcv, prg): commands in the wrong
+ *              state, with another card's address or above 400 kHz during
+ *              identification get no response, ACMD41 reports busy a few
+ *              times, R3 comes with COMRESP as on the real controller, and
+ *              out-of-range or misaligned addresses are flagged in R1. The
+ *              data path moves one word per FIFO access, either by the CPU
+ *              or by the DMA stream on FIFODATA, which the model pulls
+ *              (paced); a bus width or clock the card was not switched to
+ *              ends the block with a data CRC error. Written blocks keep
+ *              the card programming for a few CMD13 polls. Timeouts, the
+ *              FIFO depth and DCNT are not modelled.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HostSim.h"
+
+#define SDIO_PWRCTRL_ON         0x3U
+#define SDIO_CLKCTRL_CLKEN      (1UL << 8)
+#define SDIO_CLKCTRL_BYPASSEN   (1UL << 10)
+#define SDIO_CLKCTRL_WBSEL      (3UL << 11)
+#define SDIO_CMD_CPSMEN         (1UL << 10)
+#define SDIO_DCTRL_DTEN         (1UL << 0)
+#define SDIO_DCTRL_DTDRCFG      (1UL << 1)
+#define SDIO_DCTRL_DMAEN        (1UL << 3)
+#define SDIO_STS_COMRESP        (1UL << 0)
+#define SDIO_STS_DBDR           (1UL << 1)
+#define SDIO_STS_CMDRESTO       (1UL << 2)
+#define SDIO_STS_CMDRES         (1UL << 6)
+#define SDIO_STS_CMDSENT        (1UL << 7)
+#define SDIO_STS_DATAEND        (1UL << 8)
+#define SDIO_STS_DBCP           (1UL << 10)
+#define SDIO_STS_RXDA           (1UL << 21)
+#define SDIO_STS_STATIC         0x00C007FFUL
+
+#define SD_STATE_IDLE           0U
+#define SD_STATE_READY          1U
+#define SD_STATE_IDENT          2U
+#define SD_STATE_STBY           3U
+#define SD_STATE_TRAN           4U
+#define SD_STATE_DATA           5U
+#define SD_STATE_RCV            6U
+#define SD_STATE_PRG            7U
+
+#define SD_R1_OUT_OF_RANGE      (1UL << 31)
+#define SD_R1_ADDRESS_ERROR     (1UL << 30)
+#define SD_R1_BLOCK_LEN_ERROR   (1UL << 29)
+#define SD_R1_ILLEGAL_COMMAND   (1UL << 22)
+#define SD_R1_READY_FOR_DATA    (1UL << 8)
+#define SD_R1_APP_CMD           (1UL << 5)
+
+#define SD_OCR_BUSY             (1UL << 31)
+#define SD_OCR_CCS              (1UL << 30)
+#define SD_OCR_VOLTAGES         0x00FF8000UL
+
+#define SD_SDIOCLK              48000000U
+#define SD_RCA                  0xB368U
+#define SD_BLOCK                512U
+#define SD_POWER_UP_POLLS       3U      /* ACMD41 answers busy this often */
+#define SD_PROGRAM_POLLS        2U      /* CMD13 answers prg this often */
+
+/* Responses */
+#define SD_NONE                 0U
+#define SD_SHORT                1U
+#define SD_R2                   2U
+#define SD_R3                   3U
+
+/**
+ * @brief Controller and card state
+ */
+typedef struct
+{
+    HostModel_T model;
+    uint8_t*    memory;         /*!< Card contents, NULL without a card */
+    uint32_t    blocks;
+    uint8_t     highCapacity;
+    uint8_t     state;
+    uint8_t     appCmd;         /*!< Last command was CMD55 */
+    uint8_t     ifCond;         /*!< CMD8 seen since CMD0 */
+    uint8_t     wide;           /*!< 4-bit bus (ACMD6) */
+    uint8_t     highSpeed;      /*!< CMD6 function 1 */
+    uint8_t     multiple;       /*!< CMD18/CMD25 */
+    uint8_t     pumping;
+    uint8_t     dpsm;           /*!< Data path running */
+    uint32_t    powerUp;        /*!< ACMD41 calls */
+    uint32_t    programs;       /*!< CMD13 polls left in prg */
+    uint32_t    errors;         /*!< R1 error bits for the next status */
+    uint32_t    preErase;       /*!< Last ACMD23 count */
+    uint32_t    csd[4];
+    uint8_t     scr[8];
+    uint8_t     small[64];      /*!< SCR or switch status being sent */
+    uint32_t    smallLength;
+    uint32_t    smallIndex;
+    uint32_t    address;        /*!< Next byte of a block read or write */
+    uint32_t    moved;          /*!< Bytes through the data path */
+    uint8_t     block[SD_BLOCK];
+    uint32_t    blockBytes;
+} HostSd_T;
+
+static HostSd_T sd = { .model = { .name = "SDIO", .base = SDIO_BASE } };
+
+static const uint32_t sdCid[4] = { 0x03534453U, 0x55303847U, 0x80123456U, 0x7801A3D1U };
+
+/* SD 3.0, 1 and 4-bit bus, CMD23 supported */
+static const uint8_t sdScr[8] = { 0x02, 0x35, 0x80, 0x03, 0, 0, 0, 0 };
+
+static volatile uint32_t* HostSdioReg(uint32_t offset)
+{
+    return HostSimReg(SDIO_BASE + offset);
+}
+
+/* SDIO interrupt line: any unmasked status flag */
+static void HostSdioUpdate(void)
+{
+    volatile uint32_t* sts = HostSdioReg(offsetof(SDIO_T, STS));
+
+    *sts &= ~SDIO_STS_RXDA;
+    if (sd.dpsm && ((*HostSdioReg(offsetof(SDIO_T, DCTRL)) & SDIO_DCTRL_DTDRCFG) != 0) &&
+        ((sd.state == SD_STATE_DATA) || (sd.smallLength != 0)))
+    {
+        *sts |= SDIO_STS_RXDA;
+    }
+
+    if ((*sts & *HostSdioReg(offsetof(SDIO_T, MASK))) != 0)
+    {
+        HostSimSetPending(SDIO_IRQn);
+    }
+}
+
+/* SDIO_CK in Hz, 0 when stopped */
+static uint32_t HostSdioClock(void)
+{
+    uint32_t clkctrl = *HostSdioReg(offsetof(SDIO_T, CLKCTRL));
+
+    if (((clkctrl & SDIO_CLKCTRL_CLKEN) == 0) ||
+        ((*HostSdioReg(offsetof(SDIO_T, PWRCTRL)) & 3U) != SDIO_PWRCTRL_ON))
+    {
+        return 0;
+    }
+
+    return ((clkctrl & SDIO_CLKCTRL_BYPASSEN) != 0) ? SD_SDIOCLK : SD_SDIOCLK / ((clkctrl & 0xFFU) + 2U);
+}
+
+/* Data would be garbled: bus width or clock the card is not set for */
+static uint8_t HostSdioGarbled(void)
+{
+    uint32_t wbsel = (*HostSdioReg(offsetof(SDIO_T, CLKCTRL)) & SDIO_CLKCTRL_WBSEL) >> 11;
+
+    return (wbsel != (sd.wide ? 1U : 0)) || (HostSdioClock() > (sd.highSpeed ? 50000000U : 25000000U));
+}
+
+static void HostSdBuildCsd(void)
+{
+    uint32_t size, mult = 7U;
+
+    if (sd.highCapacity)
+    {
+        /* Version 2.0: (C_SIZE + 1) * 512 KiB */
+        size = sd.blocks / 1024U - 1U;
+        sd.csd[0] = 0x400E0032U;
+        sd.csd[1] = 0x5B590000U | (size >> 16);
+        sd.csd[2] = (size << 16) | 0x7F80U;
+        sd.csd[3] = 0x0A404001U;
+    }
+    else
+    {
+        /* Version 1.0, 512-byte READ_BL_LEN: (C_SIZE + 1) << (C_SIZE_MULT + 2) */
+        while ((mult > 0) && ((sd.blocks >> (mult + 2U)) < 1U))
+        {
+            mult--;
+        }
+        size = (sd.blocks >> (mult + 2U)) - 1U;
+        sd.csd[0] = 0x002E0032U;
+        sd.csd[1] = 0x5F590000U | (size >> 2);
+        sd.csd[2] = (size << 30) | 0x3FFC0000U | (mult << 15);
+        sd.csd[3] = 0x16804001U;
+    }
+}
+
+/* Switch status of CMD6 for function group 1 (access mode) */
+static void HostSdSwitch(uint32_t argument)
+{
+    uint8_t* status = sd.small;
+
+    memset(status, 0, 64);
+    status[1] = 0x64;                           /* 100 mA */
+    status[3] = status[5] = status[7] = status[9] = status[11] = 0x01;
+    status[12] = 0x80;
+    status[13] = 0x03;                          /* Default and high speed */
+    status[16] = ((argument & 0xFU) == 0xFU) ? (sd.highSpeed ? 1U : 0) : (argument & 0xFU);
+    status[17] = 0x01;
+    if (((argument & 0xFU) > 1U) && ((argument & 0xFU) != 0xFU))
+    {
+        status[16] = 0x0F;                      /* Not supported */
+    }
+    else if (((argument & 0x80000000U) != 0) && ((argument & 0xFU) == 1U))
+    {
+        sd.highSpeed = 1;
+    }
+
+    sd.smallLength = 64;
+    sd.smallIndex = 0;
+}
+
+/* Card status as R1 reports it, error bits cleared once reported */
+static uint32_t HostSdStatus(uint8_t app)
+{
+    uint32_t status = sd.errors | ((uint32_t)sd.state << 9);
+
+    sd.errors = 0;
+    if (sd.state != SD_STATE_PRG)
+    {
+        status |= SD_R1_READY_FOR_DATA;
+    }
+    if (app)
+    {
+        status |= SD_R1_APP_CMD;
+    }
+
+    return status;
+}
+
+/* Block address check of a read or write command; sets the start address */
+static uint8_t HostSdAddress(uint32_t argument, uint32_t* response)
+{
+    uint32_t address = sd.highCapacity ? argument * SD_BLOCK : argument;
+
+    if (!sd.highCapacity && ((argument % SD_BLOCK) != 0))
+    {
+        sd.errors |= SD_R1_ADDRESS_ERROR;
+    }
+    else if ((sd.highCapacity ? argument : argument / SD_BLOCK) >= sd.blocks)
+    {
+        sd.errors |= SD_R1_OUT_OF_RANGE;
+    }
+    if (sd.errors != 0)
+    {
+        response[0] = HostSdStatus(0);
+        return 0;
+    }
+
+    sd.address = address;
+    sd.blockBytes = 0;
+    response[0] = HostSdStatus(0);
+
+    return 1;
+}
+
+/*!
+ * @brief       Card side of a command.
+ *
+ * @param       index:     Command index
+ *
+ * @param       argument:  Argument
+ *
+ * @param       response:  Receives the response words
+ *
+ * @retval      SD_NONE (no response), SD_SHORT, SD_R2 or SD_R3
+ */
+static uint8_t HostSdCommand(uint32_t index, uint32_t argument, uint32_t* response)
+{
+    uint8_t app = sd.appCmd;
+    uint8_t addressed = ((argument >> 16) == SD_RCA);
+    uint32_t clock = HostSdioClock();
+
+    sd.appCmd = 0;
+    if ((sd.memory == NULL) || (clock == 0) || ((sd.state <= SD_STATE_IDENT) && (clock > 400000U)))
+    {
+        return SD_NONE;
+    }
+
+    if (app)
+    {
+        switch (index)
+        {
+            case 6:
+                if (sd.state != SD_STATE_TRAN)
+                {
+                    break;
+                }
+                response[0] = HostSdStatus(1);
+                sd.wide = ((argument & 3U) == 2U);
+                return SD_SHORT;
+
+            case 23:
+                if (sd.state != SD_STATE_TRAN)
+                {
+                    break;
+                }
+                response[0] = HostSdStatus(1);
+                sd.preErase = argument & 0x7FFFFFU;
+                return SD_SHORT;
+
+            case 41:
+                if ((sd.state != SD_STATE_IDLE) || ((argument & SD_OCR_VOLTAGES) == 0))
+                {
+                    break;
+                }
+                /* High capacity cards stay busy for hosts that do not set HCS */
+                response[0] = SD_OCR_VOLTAGES;
+                if ((++sd.powerUp >= SD_POWER_UP_POLLS) &&
+                    (!sd.highCapacity || (sd.ifCond && ((argument & SD_OCR_CCS) != 0))))
+                {
+                    response[0] |= SD_OCR_BUSY | (sd.highCapacity ? SD_OCR_CCS : 0);
+                    sd.state = SD_STATE_READY;
+                }
+                return SD_R3;
+
+            case 51:
+                if (sd.state != SD_STATE_TRAN)
+                {
+                    break;
+                }
+                response[0] = HostSdStatus(1);
+                memcpy(sd.small, sd.scr, sizeof(sd.scr));
+                sd.smallLength = sizeof(sd.scr);
+                sd.smallIndex = 0;
+                return SD_SHORT;
+
+            default:
+                /* Taken as the standard command */
+                break;
+        }
+        if ((index == 6) || (index == 23) || (index == 41) || (index == 51))
+        {
+            sd.errors |= SD_R1_ILLEGAL_COMMAND;
+            return SD_NONE;
+        }
+    }
+
+    switch (index)
+    {
+        case 0:
+            sd.state = SD_STATE_IDLE;
+            sd.ifCond = 0;
+            sd.wide = 0;
+            sd.highSpeed = 0;
+            sd.powerUp = 0;
+            sd.errors = 0;
+            sd.smallLength = 0;
+            return SD_NONE;
+
+        case 2:
+            if (sd.state != SD_STATE_READY)
+            {
+                break;
+            }
+            memcpy(response, sdCid, sizeof(sdCid));
+            sd.state = SD_STATE_IDENT;
+            return SD_R2;
+
+        case 3:
+            if ((sd.state != SD_STATE_IDENT) && (sd.state != SD_STATE_STBY))
+            {
+                break;
+            }
+            response[0] = (SD_RCA << 16) | ((uint32_t)sd.state << 9) | SD_R1_READY_FOR_DATA;
+            sd.state = SD_STATE_STBY;
+            return SD_SHORT;
+
+        case 6:
+            if (sd.state != SD_STATE_TRAN)
+            {
+                break;
+            }
+            response[0] = HostSdStatus(0);
+            HostSdSwitch(argument);
+            return SD_SHORT;
+
+        case 7:
+            if (addressed && (sd.state == SD_STATE_STBY))
+            {
+                response[0] = HostSdStatus(0);
+                sd.state = SD_STATE_TRAN;
+                return SD_SHORT;
+            }
+            if (!addressed && (sd.state == SD_STATE_TRAN))
+            {
+                sd.state = SD_STATE_STBY;
+                return SD_NONE;
+            }
+            break;
+
+        case 8:
+            if (sd.state != SD_STATE_IDLE)
+            {
+                break;
+            }
+            sd.ifCond = 1;
+            response[0] = argument & 0xFFFU;
+            return SD_SHORT;
+
+        case 9:
+            if (!addressed || (sd.state != SD_STATE_STBY))
+            {
+                break;
+            }
+            memcpy(response, sd.csd, sizeof(sd.csd));
+            return SD_R2;
+
+        case 12:
+            if ((sd.state != SD_STATE_DATA) && (sd.state != SD_STATE_RCV))
+            {
+                break;
+            }
+            response[0] = HostSdStatus(0);
+            sd.state = (sd.state == SD_STATE_RCV) ? SD_STATE_PRG : SD_STATE_TRAN;
+            sd.programs = SD_PROGRAM_POLLS;
+            return SD_SHORT;
+
+        case 13:
+            if (!addressed || (sd.state < SD_STATE_STBY))
+            {
+                break;
+            }
+            response[0] = HostSdStatus(app);
+            if ((sd.state == SD_STATE_PRG) && (--sd.programs == 0))
+            {
+                sd.state = SD_STATE_TRAN;
+            }
+            return SD_SHORT;
+
+        case 16:
+            if (sd.state != SD_STATE_TRAN)
+            {
+                break;
+            }
+            if (argument != SD_BLOCK)
+            {
+                sd.errors |= SD_R1_BLOCK_LEN_ERROR;
+            }
+            response[0] = HostSdStatus(0);
+            return SD_SHORT;
+
+        case 17:
+        case 18:
+            if (sd.state != SD_STATE_TRAN)
+            {
+                break;
+            }
+            if (HostSdAddress(argument, response))
+            {
+                sd.multiple = (index == 18);
+                sd.state = SD_STATE_DATA;
+            }
+            return SD_SHORT;
+
+        case 24:
+        case 25:
+            if (sd.state != SD_STATE_TRAN)
+            {
+                break;
+            }
+            if (HostSdAddress(argument, response))
+            {
+                sd.multiple = (index == 25);
+                sd.state = SD_STATE_RCV;
+            }
+            return SD_SHORT;
+
+        case 55:
+            if ((sd.state >= SD_STATE_STBY) && !addressed)
+            {
+                break;
+            }
+            sd.appCmd = 1;
+            response[0] = HostSdStatus(1);
+            return SD_SHORT;
+
+        default:
+            break;
+    }
+
+    sd.errors |= SD_R1_ILLEGAL_COMMAND;
+
+    return SD_NONE;
+}
+
+/* End the data path transfer with the given status flags */
+static void HostSdioDataEnd(uint32_t flags)
+{
+    sd.dpsm = 0;
+    *HostSdioReg(offsetof(SDIO_T, DCTRL)) &= ~SDIO_DCTRL_DTEN;
+    *HostSdioReg(offsetof(SDIO_T, STS)) |= flags;
+}
+
+/* Account for one word through the data path */
+static void HostSdioWord(void)
+{
+    uint32_t length = *HostSdioReg(offsetof(SDIO_T, DATALEN));
+
+    sd.moved += 4U;
+    if (sd.moved >= length)
+    {
+        HostSdioDataEnd(SDIO_STS_DATAEND | SDIO_STS_DBCP);
+    }
+}
+
+/* The card sends the next word of a read */
+static void HostSdioReceive(void)
+{
+    uint32_t word = 0, i;
+
+    if (sd.smallLength != 0)
+    {
+        for (i = 0; i < 4U; i++)
+        {
+            word |= (uint32_t)sd.small[sd.smallIndex++] << (8U * i);
+        }
+        if (sd.smallIndex >= sd.smallLength)
+        {
+            sd.smallLength = 0;
+        }
+    }
+    else if (sd.state == SD_STATE_DATA)
+    {
+        for (i = 0; i < 4U; i++)
+        {
+            word |= (uint32_t)sd.memory[sd.address++] << (8U * i);
+        }
+        if (((sd.address % SD_BLOCK) == 0) && !sd.multiple)
+        {
+            sd.state = SD_STATE_TRAN;
+        }
+        else if (sd.address >= sd.blocks * SD_BLOCK)
+        {
+            /* Reads ahead past the last block: stays in data until CMD12,
+               which reports it */
+            sd.errors |= SD_R1_OUT_OF_RANGE;
+            sd.address = 0;
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    *HostSdioReg(offsetof(SDIO_T, FIFODATA)) = word;
+    if (HostSdioGarbled() && (((sd.moved + 4U) % SD_BLOCK) == 0))
+    {
+        HostSdioDataEnd(SDIO_STS_DBDR);
+        return;
+    }
+    HostSdioWord();
+}
+
+/* The card takes a word of a write */
+static void HostSdioTransmit(void)
+{
+    uint32_t word = *HostSdioReg(offsetof(SDIO_T, FIFODATA));
+    uint32_t i;
+
+    if (sd.state != SD_STATE_RCV)
+    {
+        return;
+    }
+
+    for (i = 0; i < 4U; i++)
+    {
+        sd.block[sd.blockBytes++] = (uint8_t)(word >> (8U * i));
+    }
+    if (sd.blockBytes == SD_BLOCK)
+    {
+        sd.blockBytes = 0;
+        if (HostSdioGarbled())
+        {
+            HostSdioDataEnd(SDIO_STS_DBDR);
+            return;
+        }
+        if (sd.address >= sd.blocks * SD_BLOCK)
+        {
+            sd.errors |= SD_R1_OUT_OF_RANGE;
+        }
+        else
+        {
+            memcpy(&sd.memory[sd.address], sd.block, SD_BLOCK);
+            sd.address += SD_BLOCK;
+        }
+        if (!sd.multiple)
+        {
+            sd.state = SD_STATE_PRG;
+            sd.programs = SD_PROGRAM_POLLS;
+        }
+    }
+    HostSdioWord();
+}
+
+/* DMA requests while the data path and the card can move data */
+static void HostSdioPump(void)
+{
+    uint32_t dctrl;
+
+    if (sd.pumping)
+    {
+        return;
+    }
+
+    sd.pumping = 1;
+    for (;;)
+    {
+        dctrl = *HostSdioReg(offsetof(SDIO_T, DCTRL));
+        if (!sd.dpsm || ((dctrl & SDIO_DCTRL_DMAEN) == 0))
+        {
+            break;
+        }
+        if ((dctrl & SDIO_DCTRL_DTDRCFG) != 0)
+        {
+            if ((sd.smallLength == 0) && (sd.state != SD_STATE_DATA))
+            {
+                break;
+            }
+        }
+        else if (sd.state != SD_STATE_RCV)
+        {
+            break;
+        }
+        if (!HostDmaRequest(SDIO_BASE + offsetof(SDIO_T, FIFODATA)))
+        {
+            break;
+        }
+    }
+    sd.pumping = 0;
+}
+
+static void HostSdioReset(HostModel_T* model, uint32_t offset)
+{
+    (void)model;
+    (void)offset;
+
+    sd.dpsm = 0;
+    sd.pumping = 0;
+}
+
+static void HostSdioRead(HostModel_T* model, uint32_t offset)
+{
+    (void)model;
+
+    if ((offset == offsetof(SDIO_T, FIFODATA)) && sd.dpsm &&
+        ((*HostSdioReg(offsetof(SDIO_T, DCTRL)) & SDIO_DCTRL_DTDRCFG) != 0))
+    {
+        HostSdioReceive();
+        HostSdioUpdate();
+    }
+}
+
+static void HostSdioWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    volatile uint32_t* reg = HostSdioReg(offset);
+    uint32_t response[4] = { 0 };
+    uint32_t cmd;
+    uint8_t kind;
+
+    (void)model;
+
+    switch (offset)
+    {
+        case offsetof(SDIO_T, CMD):
+            cmd = *reg;
+            if ((cmd & SDIO_CMD_CPSMEN) == 0)
+            {
+                return;
+            }
+            kind = HostSdCommand(cmd & 0x3FU, *HostSdioReg(offsetof(SDIO_T, ARG)), response);
+            if (((cmd >> 6) & 1U) == 0)
+            {
+                *HostSdioReg(offsetof(SDIO_T, STS)) |= SDIO_STS_CMDSENT;
+            }
+            else if (kind == SD_NONE)
+            {
+                *HostSdioReg(offsetof(SDIO_T, STS)) |= SDIO_STS_CMDRESTO;
+            }
+            else
+            {
+                *HostSdioReg(offsetof(SDIO_T, RES1)) = response[0];
+                *HostSdioReg(offsetof(SDIO_T, RES2)) = response[1];
+                *HostSdioReg(offsetof(SDIO_T, RES3)) = response[2];
+                *HostSdioReg(offsetof(SDIO_T, RES4)) = response[3];
+                *HostSdioReg(offsetof(SDIO_T, CMDRES)) = (kind == SD_SHORT) ? (cmd & 0x3FU) : 0x3FU;
+                *HostSdioReg(offsetof(SDIO_T, STS)) |= (kind == SD_R3) ? SDIO_STS_COMRESP : SDIO_STS_CMDRES;
+            }
+            HostSdioPump();
+            break;
+
+        case offsetof(SDIO_T, DCTRL):
+            if (((oldValue & SDIO_DCTRL_DTEN) == 0) && ((*reg & SDIO_DCTRL_DTEN) != 0))
+            {
+                sd.dpsm = 1;
+                sd.moved = 0;
+                HostSdioPump();
+            }
+            else if ((*reg & SDIO_DCTRL_DTEN) == 0)
+            {
+                sd.dpsm = 0;
+            }
+            break;
+
+        case offsetof(SDIO_T, FIFODATA):
+            if (sd.dpsm && ((*HostSdioReg(offsetof(SDIO_T, DCTRL)) & SDIO_DCTRL_DTDRCFG) == 0))
+            {
+                HostSdioTransmit();
+            }
+            break;
+
+        case offsetof(SDIO_T, ICF):
+            *HostSdioReg(offsetof(SDIO_T, STS)) &= ~(*reg & SDIO_STS_STATIC);
+            *reg = 0;
+            break;
+
+        case offsetof(SDIO_T, STS):
+        case offsetof(SDIO_T, CMDRES):
+        case offsetof(SDIO_T, RES1):
+        case offsetof(SDIO_T, RES2):
+        case offsetof(SDIO_T, RES3):
+        case offsetof(SDIO_T, RES4):
+            /* Read-only */
+            *reg = oldValue;
+            break;
+
+        default:
+            break;
+    }
+
+    HostSdioUpdate();
+}
+
+/*!
+ * @brief       Insert an SD card, filled with zeros.
+ *
+ * @param       blocks:        Capacity in 512-byte blocks: a multiple of
+ *                             1024 for SDHC, a power of two up to 2^21
+ *                             otherwise
+ *
+ * @param       highCapacity:  1: SDHC, block addressed; 0: SDSC
+ *
+ * @retval      The card contents, for tests to inspect or preload
+ */
+uint8_t* HostSdAttach(uint32_t blocks, uint8_t highCapacity)
+{
+    free(sd.memory);
+    sd.memory = calloc(blocks, SD_BLOCK);
+    sd.blocks = blocks;
+    sd.highCapacity = highCapacity;
+    sd.state = SD_STATE_IDLE;
+    sd.appCmd = 0;
+    sd.ifCond = 0;
+    sd.wide = 0;
+    sd.highSpeed = 0;
+    sd.powerUp = 0;
+    sd.errors = 0;
+    sd.preErase = 0;
+    sd.smallLength = 0;
+    memcpy(sd.scr, sdScr, sizeof(sdScr));
+    HostSdBuildCsd();
+
+    return sd.memory;
+}
+
+/*!
+ * @brief       Replace the CSD and SCR of the inserted card.
+ *
+ * @param       csd:  CSD, bits 127:96 first; NULL keeps the model's
+ *
+ * @param       scr:  SCR bytes as sent, bits 63:56 first; NULL keeps
+ *                    the model's
+ *
+ * @retval      None
+ *
+ * @note        Only what the card reports changes; its contents stay
+ *              the blocks given to HostSdAttach().
+ */
+void HostSdSetRegisters(const uint32_t* csd, const uint8_t* scr)
+{
+    if (csd != NULL)
+    {
+        memcpy(sd.csd, csd, sizeof(sd.csd));
+    }
+    if (scr != NULL)
+    {
+        memcpy(sd.scr, scr, sizeof(sd.scr));
+    }
+}
+
+/*!
+ * @brief       Block count of the last ACMD23 (pre-erase hint).
+ *
+ * @param       None
+ *
+ * @retval      Blocks
+ */
+uint32_t HostSdPreErase(void)
+{
+    return sd.preErase;
+}
+
+/*!
+ * @brief       Register the SDIO model, without a card.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSdioModelAdd(void)
+{
+    sd.model.size = sizeof(SDIO_T);
+    sd.model.reset = HostSdioReset;
+    sd.model.read = HostSdioRead;
+    sd.model.write = HostSdioWrite;
+    sd.model.paced = 1;
+    HostSimAddModel(&sd.model);
+}
@@ -0,0 +1,748 @@
+/*!
+ * @file        HostSim.c
+ *
+ * @brief       Register space mapping, access traps and interrupt delivery
+ *              for the host build. See HostSim.h.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include "HostSim.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "The register simulator needs x86-64 Linux (page faults + single-step)"
+#endif
+
+#define HOST_PAGE_SIZE  0x1000U
+#define HOST_PAGE_MASK  (~(uintptr_t)(HOST_PAGE_SIZE - 1U))
+#define HOST_EFLAGS_TF  0x100
+#define HOST_PF_WRITE   0x2
+
+/**
+ * @brief Device address range backed by host memory
+ */
+typedef struct
+{
+    uint32_t  base;     /*!< Device address */
+    uint32_t  size;     /*!< Size in bytes */
+    uint8_t*  alias;    /*!< Always-writable mapping of the same memory */
+} HostRegion_T;
+
+static HostRegion_T regions[] =
+{
+    { FMC_BASE,          0x00100000U, NULL },   /* Main flash */
+    { CCMDATARAM_BASE,   0x00010000U, NULL },   /* CCM data RAM */
+    { 0x1FFF0000U,       0x00010000U, NULL },   /* System memory, OTP, unique ID */
+    { SRAM1_BASE,        0x00030000U, NULL },   /* SRAM1/2/3 */
+    { PERIPH_BASE,       0x00080000U, NULL },   /* APB1, APB2, AHB1 */
+    { AHB2PERIPH_BASE,   0x000B0000U, NULL },   /* AHB2 */
+    { SMC_R_BASE,        0x00001000U, NULL },   /* SMC/DMC registers */
+    { 0xE0000000U,       0x00100000U, NULL },   /* Cortex-M4 private peripherals */
+};
+
+#define REGION_COUNT (sizeof(regions) / sizeof(regions[0]))
+
+/* Weak IRQ handler table in device order (HostVectors.c) */
+extern void (* const HostSimVectors[])(void);
+extern const uint32_t HostSimVectorCount;
+
+static HostModel_T* models;
+static uint8_t initialized;
+
+/* Access being single-stepped */
+static struct
+{
+    uint8_t   active;
+    uint8_t   write;
+    uint32_t  addr;
+    uint32_t  oldValue;
+    uintptr_t page;
+} step;
+
+/* Nonzero while model hooks run; interrupts are delivered afterwards */
+static volatile uint32_t inHook;
+
+/* Interrupt state */
+static volatile uint32_t primask;
+static volatile uint32_t ipsr;
+static volatile uint32_t irqEnabled[8];
+static volatile uint32_t irqPending[8];
+
+static uint64_t (*cycleSource)(void);
+static uint32_t sramTop;
+
+static int HostSimDeliverable(void);
+
+static HostRegion_T* HostSimRegion(uint32_t addr)
+{
+    uint32_t i;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        if ((addr >= regions[i].base) && (addr - regions[i].base < regions[i].size))
+        {
+            return &regions[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief       Register word as seen by models, never traps.
+ *
+ * @param       addr:  Device address (or a 32-bit host address outside the
+ *                     simulated regions)
+ *
+ * @retval      Pointer to the word
+ */
+volatile uint32_t* HostSimReg(uint32_t addr)
+{
+    HostRegion_T* region = HostSimRegion(addr);
+
+    if (region != NULL)
+    {
+        return (volatile uint32_t*)(region->alias + (addr - region->base));
+    }
+
+    return (volatile uint32_t*)(uintptr_t)addr;
+}
+
+/*!
+ * @brief       Latest registered model covering an address.
+ *
+ * @param       addr:  Device address
+ *
+ * @retval      Model or NULL
+ */
+HostModel_T* HostSimFindModel(uint32_t addr)
+{
+    HostModel_T* model;
+
+    for (model = models; model != NULL; model = model->next)
+    {
+        if ((addr >= model->base) && (addr - model->base < model->size))
+        {
+            return model;
+        }
+    }
+
+    return NULL;
+}
+
+static void HostSimRunRead(uint32_t addr)
+{
+    HostModel_T* model = HostSimFindModel(addr);
+
+    if ((model != NULL) && (model->read != NULL))
+    {
+        inHook++;
+        model->read(model, (addr & ~3U) - model->base);
+        inHook--;
+    }
+}
+
+static void HostSimRunWrite(uint32_t addr, uint32_t oldValue)
+{
+    HostModel_T* model = HostSimFindModel(addr);
+
+    if ((model != NULL) && (model->write != NULL))
+    {
+        inHook++;
+        model->write(model, (addr & ~3U) - model->base, oldValue);
+        inHook--;
+    }
+}
+
+/*!
+ * @brief       Read through a model (as a bus master such as DMA would).
+ *
+ * @param       addr:  Device address
+ *
+ * @param       size:  Access size in bytes (1, 2 or 4)
+ *
+ * @retval      Value read
+ */
+uint32_t HostSimBusRead(uint32_t addr, uint32_t size)
+{
+    volatile uint8_t* ptr;
+    uint32_t value;
+
+    HostSimRunRead(addr);
+    ptr = (volatile uint8_t*)HostSimReg(addr);
+
+    switch (size)
+    {
+        case 1:
+            value = *ptr;
+            break;
+        case 2:
+            value = *(volatile uint16_t*)ptr;
+            break;
+        default:
+            value = *(volatile uint32_t*)ptr;
+            break;
+    }
+
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+
+    return value;
+}
+
+/*!
+ * @brief       Write through a model (as a bus master such as DMA would).
+ *
+ * @param       addr:   Device address
+ *
+ * @param       value:  Value to write
+ *
+ * @param       size:   Access size in bytes (1, 2 or 4)
+ *
+ * @retval      None
+ */
+void HostSimBusWrite(uint32_t addr, uint32_t value, uint32_t size)
+{
+    volatile uint8_t* ptr = (volatile uint8_t*)HostSimReg(addr);
+    uint32_t oldValue = *HostSimReg(addr & ~3U);
+
+    switch (size)
+    {
+        case 1:
+            *ptr = (uint8_t)value;
+            break;
+        case 2:
+            *(volatile uint16_t*)ptr = (uint16_t)value;
+            break;
+        default:
+            *(volatile uint32_t*)ptr = value;
+            break;
+    }
+
+    HostSimRunWrite(addr, oldValue);
+
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+}
+
+/*!
+ * @brief       Allocate simulated SRAM (32-bit addressable, DMA capable).
+ *
+ * @param       size:  Size in bytes
+ *
+ * @retval      Device-address pointer, 8-byte aligned. Freed by HostSimReset().
+ */
+void* HostSimSram(uint32_t size)
+{
+    uint32_t addr = (sramTop + 7U) & ~7U;
+
+    if (addr + size > SRAM1_BASE + 0x00030000U)
+    {
+        fprintf(stderr, "HostSim: simulated SRAM exhausted\n");
+        abort();
+    }
+    sramTop = addr + size;
+
+    return (void*)(uintptr_t)addr;
+}
+
+/*!
+ * @brief       Hold back interrupt delivery, e.g. while a model moves a
+ *              block of data. Nests.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSimLock(void)
+{
+    inHook++;
+}
+
+/*!
+ * @brief       Release HostSimLock() and run what became pending.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSimUnlock(void)
+{
+    inHook--;
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+}
+
+/* Apply access protection: model pages trap, everything else is plain RAM */
+static void HostSimProtect(void)
+{
+    HostModel_T* model;
+    uint32_t i;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        mprotect((void*)(uintptr_t)regions[i].base, regions[i].size, PROT_READ | PROT_WRITE);
+    }
+
+    for (model = models; model != NULL; model = model->next)
+    {
+        uintptr_t first = (uintptr_t)model->base & HOST_PAGE_MASK;
+        uintptr_t last = ((uintptr_t)model->base + model->size - 1U) & HOST_PAGE_MASK;
+
+        mprotect((void*)first, last - first + HOST_PAGE_SIZE, PROT_NONE);
+    }
+}
+
+/*!
+ * @brief       Register a model. A later model shadows earlier ones on
+ *              overlapping addresses, so built-in models can be replaced.
+ *
+ * @param       model:  Model, must stay valid while registered
+ *
+ * @retval      None
+ */
+void HostSimAddModel(HostModel_T* model)
+{
+    model->next = models;
+    models = model;
+
+    if (model->reset != NULL)
+    {
+        model->reset(model, 0);
+    }
+
+    HostSimProtect();
+}
+
+/*!
+ * @brief       Unregister a model.
+ *
+ * @param       model:  Model
+ *
+ * @retval      None
+ */
+void HostSimRemoveModel(HostModel_T* model)
+{
+    HostModel_T** link;
+
+    for (link = &models; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == model)
+        {
+            *link = model->next;
+            break;
+        }
+    }
+
+    HostSimProtect();
+}
+
+static int HostSimNextIrq(void)
+{
+    const volatile uint8_t* priority = (const volatile uint8_t*)HostSimReg((uint32_t)(uintptr_t)NVIC->IP);
+    uint32_t i, active;
+
+    for (i = 0; i < 8; i++)
+    {
+        active = irqPending[i] & irqEnabled[i];
+        if (active != 0)
+        {
+            int best = -1;
+            uint32_t irq;
+
+            /* Lowest priority value wins, then lowest IRQ number */
+            for (irq = i * 32U; irq < HostSimVectorCount; irq++)
+            {
+                if (((irqPending[irq >> 5] & irqEnabled[irq >> 5]) & (1UL << (irq & 31U))) == 0)
+                {
+                    continue;
+                }
+                if ((best < 0) || (priority[irq] < priority[best]))
+                {
+                    best = (int)irq;
+                }
+            }
+            return best;
+        }
+    }
+
+    return -1;
+}
+
+static int HostSimDeliverable(void)
+{
+    return (primask == 0) && (ipsr == 0) && (inHook == 0) && (HostSimNextIrq() >= 0);
+}
+
+/*!
+ * @brief       Run pending, enabled interrupt handlers. Handlers do not
+ *              preempt each other; the next one runs when the current
+ *              returns.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSimDeliver(void)
+{
+    int irq;
+
+    while ((primask == 0) && (ipsr == 0) && (inHook == 0) && ((irq = HostSimNextIrq()) >= 0))
+    {
+        irqPending[irq >> 5] &= ~(1UL << (irq & 31));
+        ipsr = (uint32_t)irq + 16U;
+        HostSimVectors[irq]();
+        ipsr = 0;
+    }
+}
+
+void HostSimSetPending(IRQn_Type irq)
+{
+    if (irq < 0)
+    {
+        return;
+    }
+
+    irqPending[irq >> 5] |= 1UL << (irq & 31);
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+}
+
+void HostSimClearPending(IRQn_Type irq)
+{
+    if (irq >= 0)
+    {
+        irqPending[irq >> 5] &= ~(1UL << (irq & 31));
+    }
+}
+
+uint8_t HostSimIsEnabled(IRQn_Type irq)
+{
+    return (irq >= 0) && ((irqEnabled[irq >> 5] & (1UL << (irq & 31))) != 0);
+}
+
+uint32_t HostSimGetPrimask(void)
+{
+    return primask;
+}
+
+void HostSimSetPrimask(uint32_t value)
+{
+    primask = value & 1U;
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+}
+
+uint32_t HostSimGetIpsr(void)
+{
+    return ipsr;
+}
+
+void HostSimWaitForInterrupt(void)
+{
+    if (HostSimDeliverable())
+    {
+        HostSimDeliver();
+    }
+    else
+    {
+        sched_yield();
+    }
+}
+
+static uint64_t HostSimMonotonicCycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * HOST_SIM_CORE_CLOCK) +
+           ((uint64_t)ts.tv_nsec * (HOST_SIM_CORE_CLOCK / 1000000U) / 1000U);
+}
+
+/*!
+ * @brief       Current core cycle count (drives DWT->CYCCNT).
+ *
+ * @param       None
+ *
+ * @retval      Cycles since an arbitrary origin
+ */
+uint64_t HostSimCycles(void)
+{
+    return cycleSource();
+}
+
+/*!
+ * @brief       Replace the cycle source, e.g. with a mock for deterministic
+ *              timing. NULL restores host monotonic time scaled to
+ *              HOST_SIM_CORE_CLOCK.
+ *
+ * @param       source:  Cycle source
+ *
+ * @retval      None
+ */
+void HostSimSetCycleSource(uint64_t (*source)(void))
+{
+    cycleSource = (source != NULL) ? source : HostSimMonotonicCycles;
+}
+
+static void HostSimOnSegv(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    uintptr_t fault = (uintptr_t)info->si_addr;
+
+    (void)sig;
+
+    /* Inside the simulated regions only model pages are protected */
+    if (step.active || (fault > UINT32_MAX) || (HostSimRegion((uint32_t)fault) == NULL))
+    {
+        /* Not a register access: crash with the default action */
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    step.active = 1;
+    step.addr = (uint32_t)fault;
+    step.page = fault & HOST_PAGE_MASK;
+    step.write = ((uc->uc_mcontext.gregs[REG_ERR] & HOST_PF_WRITE) != 0);
+    step.oldValue = *HostSimReg(step.addr & ~3U);
+
+    if (!step.write)
+    {
+        HostSimRunRead(step.addr);
+    }
+
+    /* Let the instruction through, then trap right after it */
+    mprotect((void*)step.page, HOST_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TF;
+}
+
+static void HostSimOnTrap(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+
+    (void)sig;
+    (void)info;
+
+    if (!step.active)
+    {
+        signal(SIGTRAP, SIG_DFL);
+        raise(SIGTRAP);
+        return;
+    }
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~HOST_EFLAGS_TF;
+    mprotect((void*)step.page, HOST_PAGE_SIZE, PROT_NONE);
+    step.active = 0;
+
+    if (step.write)
+    {
+        HostSimRunWrite(step.addr, step.oldValue);
+    }
+
+    /* Interrupts raised by the access run once this handler returns */
+    if (HostSimDeliverable())
+    {
+        raise(SIGUSR1);
+    }
+}
+
+static void HostSimOnIrq(int sig)
+{
+    (void)sig;
+
+    HostSimDeliver();
+}
+
+/*!
+ * @brief       Clear all simulated memory and registers and reload the
+ *              reset values of every model.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSimReset(void)
+{
+    HostModel_T* model;
+    uint32_t i;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        memset(regions[i].alias, 0, regions[i].size);
+    }
+
+    /* Erased flash */
+    memset(HostSimRegion(FMC_BASE)->alias, 0xFF, HostSimRegion(FMC_BASE)->size);
+
+    for (i = 0; i < 8; i++)
+    {
+        irqEnabled[i] = 0;
+        irqPending[i] = 0;
+    }
+    primask = 0;
+    ipsr = 0;
+    sramTop = SRAM1_BASE;
+
+    for (model = models; model != NULL; model = model->next)
+    {
+        if (model->reset != NULL)
+        {
+            model->reset(model, 0);
+        }
+    }
+}
+
+/*!
+ * @brief       Map the device address space, install the access traps and
+ *              register the built-in models. Safe to call more than once.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSimInit(void)
+{
+    struct sigaction sa;
+    uint32_t i;
+
+    if (initialized)
+    {
+        HostSimReset();
+        return;
+    }
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        int fd = memfd_create("apm32-sim", 0);
+        void* mapped;
+
+        if ((fd < 0) || (ftruncate(fd, regions[i].size) != 0))
+        {
+            perror("HostSim: memfd");
+            abort();
+        }
+
+        mapped = mmap((void*)(uintptr_t)regions[i].base, regions[i].size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+        if (mapped != (void*)(uintptr_t)regions[i].base)
+        {
+            fprintf(stderr, "HostSim: cannot map 0x%08x (link the host program with -no-pie)\n",
+                    (unsigned)regions[i].base);
+            abort();
+        }
+
+        regions[i].alias = mmap(NULL, regions[i].size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (regions[i].alias == MAP_FAILED)
+        {
+            perror("HostSim: alias");
+            abort();
+        }
+        close(fd);
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sa.sa_sigaction = HostSimOnSegv;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGSEGV, &sa, NULL);
+
+    /* Keep the IRQ signal blocked while the trap handler runs */
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = HostSimOnTrap;
+    sigaddset(&sa.sa_mask, SIGUSR1);
+    sigaction(SIGTRAP, &sa, NULL);
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = HostSimOnIrq;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGUSR1, &sa, NULL);
+
+    cycleSource = HostSimMonotonicCycles;
+    initialized = 1;
+
+    HostSimReset();
+
+    HostCoreModelsAdd();
+    HostRcmModelAdd();
+    HostCrcModelAdd();
+    HostDmaModelAdd();
+    HostUsartModelAdd();
+    HostEthModelAdd();
+    HostCanModelAdd();
+    HostSpiModelAdd();
+    HostGpioModelAdd();
+    HostSdioModelAdd();
+}
+
+/* NVIC set/clear register semantics, used by the core model (HostCore.c) */
+void HostSimNvicWrite(uint32_t offset, uint32_t value)
+{
+    uint32_t index = (offset & 0x7FU) >> 2;
+
+    if (index >= 8)
+    {
+        return;
+    }
+
+    switch (offset & ~0x7FU)
+    {
+        case 0x000:     /* ISER */
+            irqEnabled[index] |= value;
+            break;
+        case 0x080:     /* ICER */
+            irqEnabled[index] &= ~value;
+            break;
+        case 0x100:     /* ISPR */
+            irqPending[index] |= value;
+            break;
+        case 0x180:     /* ICPR */
+            irqPending[index] &= ~value;
+            break;
+        default:
+            return;
+    }
+}
+
+uint32_t HostSimNvicRead(uint32_t offset)
+{
+    uint32_t index = (offset & 0x7FU) >> 2;
+
+    if (index >= 8)
+    {
+        return 0;
+    }
+
+    switch (offset & ~0x7FU)
+    {
+        case 0x000:
+        case 0x080:
+            return irqEnabled[index];
+        case 0x100:
+        case 0x180:
+            return irqPending[index];
+        default:
+            return 0;
+    }
+}
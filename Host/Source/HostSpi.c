@@ -0,0 +1,185 @@
+/*!
+ * @file        HostSpi.c
+ *
+ * @brief       SPI1/SPI2/SPI3 master model for the host build. A frame
+ *              written to DATA with SPIEN set is exchanged at once with the
+ *              device of the bus, a callback that returns the MISO frame
+ *              (default: loopback). The received frame replaces DATA and
+ *              sets RXBNE; one still unread is lost to OVR. The model is
+ *              paced: with TXDEN set it requests transmit frames until the
+ *              transmit stream runs dry, and with RXDEN set each received
+ *              frame goes to the receive stream. Slave mode, CRC and I2S
+ *              are not modelled.
+ */
+
+#include <stddef.h>
+#include "HostSim.h"
+
+#define SPI_CTRL1_SPIEN     (1UL << 6)
+#define SPI_CTRL1_DFLSEL    (1UL << 11)
+#define SPI_CTRL2_RXDEN     (1UL << 0)
+#define SPI_CTRL2_TXDEN     (1UL << 1)
+#define SPI_STS_RXBNE       (1UL << 0)
+#define SPI_STS_TXBE        (1UL << 1)
+#define SPI_STS_OVR         (1UL << 6)
+
+/**
+ * @brief SPI instance state
+ */
+typedef struct
+{
+    HostModel_T     model;
+    HostSpiDevice_T device;
+    uint8_t         pumping;    /*!< Pulling the transmit stream */
+} HostSpi_T;
+
+static HostSpi_T spis[] =
+{
+    { .model = { .name = "SPI1", .base = SPI1_BASE } },
+    { .model = { .name = "SPI2", .base = SPI2_BASE } },
+    { .model = { .name = "SPI3", .base = SPI3_BASE } },
+};
+
+#define SPI_COUNT (sizeof(spis) / sizeof(spis[0]))
+
+static uint16_t HostSpiLoopback(SPI_T* spi, uint16_t mosi)
+{
+    (void)spi;
+
+    return mosi;
+}
+
+static volatile uint32_t* HostSpiReg(HostSpi_T* spi, uint32_t offset)
+{
+    return HostSimReg(spi->model.base + offset);
+}
+
+/* One frame each way */
+static void HostSpiExchange(HostSpi_T* spi)
+{
+    volatile uint32_t* data = HostSpiReg(spi, offsetof(SPI_T, DATA));
+    volatile uint32_t* sts = HostSpiReg(spi, offsetof(SPI_T, STS));
+    uint32_t mask = ((*HostSpiReg(spi, offsetof(SPI_T, CTRL1)) & SPI_CTRL1_DFLSEL) != 0) ? 0xFFFFU : 0xFFU;
+    uint16_t miso = spi->device((SPI_T*)(uintptr_t)spi->model.base, (uint16_t)(*data & mask));
+
+    if ((*sts & SPI_STS_RXBNE) != 0)
+    {
+        *sts |= SPI_STS_OVR;
+    }
+    *data = miso & mask;
+    *sts |= SPI_STS_RXBNE | SPI_STS_TXBE;
+
+    if ((*HostSpiReg(spi, offsetof(SPI_T, CTRL2)) & SPI_CTRL2_RXDEN) != 0)
+    {
+        HostDmaRequestDir(spi->model.base + offsetof(SPI_T, DATA), 0);
+    }
+}
+
+/* Transmit requests while TXDEN is set and the stream has frames */
+static void HostSpiPump(HostSpi_T* spi)
+{
+    if (spi->pumping)
+    {
+        return;
+    }
+
+    spi->pumping = 1;
+    while (((*HostSpiReg(spi, offsetof(SPI_T, CTRL1)) & SPI_CTRL1_SPIEN) != 0) &&
+           ((*HostSpiReg(spi, offsetof(SPI_T, CTRL2)) & SPI_CTRL2_TXDEN) != 0) &&
+           HostDmaRequestDir(spi->model.base + offsetof(SPI_T, DATA), 1))
+    {
+    }
+    spi->pumping = 0;
+}
+
+static void HostSpiReset(HostModel_T* model, uint32_t offset)
+{
+    HostSpi_T* spi = (HostSpi_T*)model;
+
+    (void)offset;
+
+    spi->pumping = 0;
+    *HostSpiReg(spi, offsetof(SPI_T, STS)) = SPI_STS_TXBE;
+}
+
+static void HostSpiRead(HostModel_T* model, uint32_t offset)
+{
+    if (offset == offsetof(SPI_T, DATA))
+    {
+        *HostSpiReg((HostSpi_T*)model, offsetof(SPI_T, STS)) &= ~(SPI_STS_RXBNE | SPI_STS_OVR);
+    }
+}
+
+static void HostSpiWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    HostSpi_T* spi = (HostSpi_T*)model;
+
+    switch (offset)
+    {
+        case offsetof(SPI_T, DATA):
+            if ((*HostSpiReg(spi, offsetof(SPI_T, CTRL1)) & SPI_CTRL1_SPIEN) != 0)
+            {
+                HostSpiExchange(spi);
+            }
+            break;
+
+        case offsetof(SPI_T, STS):
+            /* Read-only */
+            *HostSpiReg(spi, offset) = oldValue;
+            break;
+
+        case offsetof(SPI_T, CTRL1):
+        case offsetof(SPI_T, CTRL2):
+            HostSpiPump(spi);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief       Attach a device to a bus.
+ *
+ * @param       spi:     SPI1, SPI2 or SPI3
+ *
+ * @param       device:  Returns the MISO frame for each MOSI frame, NULL
+ *                       restores the loopback
+ *
+ * @retval      None
+ */
+void HostSpiSetDevice(SPI_T* spi, HostSpiDevice_T device)
+{
+    uint32_t i;
+
+    for (i = 0; i < SPI_COUNT; i++)
+    {
+        if (spis[i].model.base == (uint32_t)(uintptr_t)spi)
+        {
+            spis[i].device = (device != NULL) ? device : HostSpiLoopback;
+        }
+    }
+}
+
+/*!
+ * @brief       Register the SPI models.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostSpiModelAdd(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < SPI_COUNT; i++)
+    {
+        spis[i].model.size = sizeof(SPI_T);
+        spis[i].model.reset = HostSpiReset;
+        spis[i].model.read = HostSpiRead;
+        spis[i].model.write = HostSpiWrite;
+        spis[i].model.paced = 1;
+        spis[i].device = HostSpiLoopback;
+        HostSimAddModel(&spis[i].model);
+    }
+}
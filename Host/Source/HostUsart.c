@@ -0,0 +1,223 @@
+/*!
+ * @file        HostUsart.c
+ *
+ * @brief       USART/UART model for the host build. Transmission is
+ *              instantaneous: written bytes go straight to a sink and the
+ *              transmitter always reports empty/complete. Received bytes are
+ *              injected by test code, either into DATA (RXBNE) or, with
+ *              DMARXEN set, through a DMA request.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include "HostSim.h"
+
+#define USART_STS_RXBNE     (1UL << 5)
+#define USART_STS_TXC       (1UL << 6)
+#define USART_STS_TXBE      (1UL << 7)
+#define USART_STS_CLEARABLE ((1UL << 5) | (1UL << 6) | (1UL << 8) | (1UL << 9))
+#define USART_CTRL3_DMARXEN (1UL << 6)
+#define USART_RX_SIZE       256U
+
+/**
+ * @brief USART instance state
+ */
+typedef struct
+{
+    HostModel_T model;
+    IRQn_Type   irq;
+    uint8_t     rx[USART_RX_SIZE];
+    uint32_t    rxHead;
+    uint32_t    rxTail;
+} HostUsart_T;
+
+static HostUsart_T usarts[] =
+{
+    { .model = { .name = "USART1", .base = USART1_BASE }, .irq = USART1_IRQn },
+    { .model = { .name = "USART2", .base = USART2_BASE }, .irq = USART2_IRQn },
+    { .model = { .name = "USART3", .base = USART3_BASE }, .irq = USART3_IRQn },
+    { .model = { .name = "UART4",  .base = UART4_BASE },  .irq = UART4_IRQn },
+    { .model = { .name = "UART5",  .base = UART5_BASE },  .irq = UART5_IRQn },
+    { .model = { .name = "USART6", .base = USART6_BASE }, .irq = USART6_IRQn },
+};
+
+#define USART_COUNT (sizeof(usarts) / sizeof(usarts[0]))
+
+static void HostUsartStdout(USART_T* usart, uint8_t data)
+{
+    (void)usart;
+
+    putchar(data);
+    if (data == '\n')
+    {
+        fflush(stdout);
+    }
+}
+
+static HostUsartSink_T sink = HostUsartStdout;
+
+static volatile uint32_t* HostUsartReg(HostUsart_T* usart, uint32_t offset)
+{
+    return HostSimReg(usart->model.base + offset);
+}
+
+/* Level-sensitive interrupt: pending while an enabled flag is set */
+static void HostUsartUpdate(HostUsart_T* usart)
+{
+    volatile uint32_t* sts = HostUsartReg(usart, offsetof(USART_T, STS));
+    uint32_t ctrl1 = *HostUsartReg(usart, offsetof(USART_T, CTRL1));
+
+    *sts |= USART_STS_TXBE;
+    if (usart->rxHead != usart->rxTail)
+    {
+        *sts |= USART_STS_RXBNE;
+    }
+
+    /* RXBNEIEN, TXCIEN and TXBEIEN line up with their flags */
+    if ((*sts & ctrl1 & (USART_STS_RXBNE | USART_STS_TXC | USART_STS_TXBE)) != 0)
+    {
+        HostSimSetPending(usart->irq);
+    }
+    else
+    {
+        HostSimClearPending(usart->irq);
+    }
+}
+
+static void HostUsartReset(HostModel_T* model, uint32_t offset)
+{
+    HostUsart_T* usart = (HostUsart_T*)model;
+
+    (void)offset;
+
+    usart->rxHead = 0;
+    usart->rxTail = 0;
+    *HostUsartReg(usart, offsetof(USART_T, STS)) = USART_STS_TXBE | USART_STS_TXC;
+}
+
+static void HostUsartRead(HostModel_T* model, uint32_t offset)
+{
+    HostUsart_T* usart = (HostUsart_T*)model;
+    volatile uint32_t* sts = HostUsartReg(usart, offsetof(USART_T, STS));
+
+    if (offset != offsetof(USART_T, DATA))
+    {
+        return;
+    }
+
+    if (usart->rxHead != usart->rxTail)
+    {
+        *HostUsartReg(usart, offset) = usart->rx[usart->rxTail % USART_RX_SIZE];
+        usart->rxTail++;
+    }
+    *sts &= ~USART_STS_RXBNE;
+    HostUsartUpdate(usart);
+}
+
+static void HostUsartWrite(HostModel_T* model, uint32_t offset, uint32_t oldValue)
+{
+    HostUsart_T* usart = (HostUsart_T*)model;
+    volatile uint32_t* reg = HostUsartReg(usart, offset);
+
+    switch (offset)
+    {
+        case offsetof(USART_T, DATA):
+            sink((USART_T*)(uintptr_t)usart->model.base, (uint8_t)*reg);
+            *HostUsartReg(usart, offsetof(USART_T, STS)) |= USART_STS_TXBE | USART_STS_TXC;
+            break;
+
+        case offsetof(USART_T, STS):
+            /* rc_w0 flags can only be cleared, the rest is read-only */
+            *reg = oldValue & (*reg | ~USART_STS_CLEARABLE);
+            break;
+
+        default:
+            break;
+    }
+
+    HostUsartUpdate(usart);
+}
+
+/*!
+ * @brief       Redirect transmitted bytes (default: stdout).
+ *
+ * @param       newSink:  Sink, NULL restores stdout
+ *
+ * @retval      None
+ */
+void HostUsartSetSink(HostUsartSink_T newSink)
+{
+    sink = (newSink != NULL) ? newSink : HostUsartStdout;
+}
+
+/*!
+ * @brief       Receive bytes on a USART.
+ *
+ * @param       usart:  USART instance
+ *
+ * @param       data:   Received bytes
+ *
+ * @param       len:    Number of bytes
+ *
+ * @retval      None
+ *
+ * @note        Bytes beyond the model's receive queue are dropped (overrun).
+ */
+void HostUsartInject(USART_T* usart, const uint8_t* data, uint32_t len)
+{
+    HostUsart_T* model = NULL;
+    uint32_t i;
+
+    for (i = 0; i < USART_COUNT; i++)
+    {
+        if (usarts[i].model.base == (uint32_t)(uintptr_t)usart)
+        {
+            model = &usarts[i];
+        }
+    }
+    if (model == NULL)
+    {
+        return;
+    }
+
+    HostSimLock();
+    for (i = 0; i < len; i++)
+    {
+        if ((*HostUsartReg(model, offsetof(USART_T, CTRL3)) & USART_CTRL3_DMARXEN) != 0)
+        {
+            *HostUsartReg(model, offsetof(USART_T, DATA)) = data[i];
+            if (HostDmaRequest(model->model.base + offsetof(USART_T, DATA)))
+            {
+                continue;
+            }
+        }
+        if (model->rxHead - model->rxTail < USART_RX_SIZE)
+        {
+            model->rx[model->rxHead % USART_RX_SIZE] = data[i];
+            model->rxHead++;
+        }
+    }
+    HostUsartUpdate(model);
+    HostSimUnlock();
+}
+
+/*!
+ * @brief       Register the USART and UART models.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void HostUsartModelAdd(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < USART_COUNT; i++)
+    {
+        usarts[i].model.size = sizeof(USART_T);
+        usarts[i].model.reset = HostUsartReset;
+        usarts[i].model.read = HostUsartRead;
+        usarts[i].model.write = HostUsartWrite;
+        HostSimAddModel(&usarts[i].model);
+    }
+}
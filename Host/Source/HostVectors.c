@@ -0,0 +1,193 @@
+/*!
+ * @file        HostVectors.c
+ *
+ * @brief       Interrupt handler table for the host build, in the order of
+ *              the device vector table (startup_apm32f407xx.S). Handlers the
+ *              application does not define fall back to HostSimDefaultHandler.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+void HostSimDefaultHandler(void)
+{
+    fprintf(stderr, "HostSim: unhandled interrupt\n");
+    abort();
+}
+
+void WWDT_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void PVD_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TAMP_STAMP_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void RTC_WKUP_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void FLASH_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void RCM_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT0_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR0_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR5_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR6_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void ADC_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN1_TX_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN1_RX0_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN1_RX1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN1_SCE_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT9_5_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR1_BRK_TMR9_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR1_UP_TMR10_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR1_TRG_COM_TMR11_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR1_CC_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C1_EV_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C1_ER_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C2_EV_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C2_ER_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SPI1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SPI2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void USART1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void USART2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void USART3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EINT15_10_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void RTC_Alarm_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_FS_WKUP_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR8_BRK_TMR12_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR8_UP_TMR13_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR8_TRG_COM_TMR14_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR8_CC_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA1_STR7_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void EMMC_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SDIO_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR5_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SPI3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void UART4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void UART5_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR6_DAC_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void TMR7_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR0_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR2_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void ETH_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void ETH_WKUP_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN2_TX_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN2_RX0_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN2_RX1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void CAN2_SCE_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_FS_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR5_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR6_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DMA2_STR7_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void USART6_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C3_EV_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void I2C3_ER_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_HS1_EP1_OUT_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_HS1_EP1_IN_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_HS1_WKUP_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void OTG_HS1_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void DCI_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void HASH_RNG_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void FPU_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SM3_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void SM4_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+void BN_IRQHandler(void) __attribute__((weak, alias("HostSimDefaultHandler")));
+
+void (* const HostSimVectors[])(void) =
+{
+    WWDT_IRQHandler,                    /*  0 */
+    PVD_IRQHandler,                     /*  1 */
+    TAMP_STAMP_IRQHandler,              /*  2 */
+    RTC_WKUP_IRQHandler,                /*  3 */
+    FLASH_IRQHandler,                   /*  4 */
+    RCM_IRQHandler,                     /*  5 */
+    EINT0_IRQHandler,                   /*  6 */
+    EINT1_IRQHandler,                   /*  7 */
+    EINT2_IRQHandler,                   /*  8 */
+    EINT3_IRQHandler,                   /*  9 */
+    EINT4_IRQHandler,                   /* 10 */
+    DMA1_STR0_IRQHandler,               /* 11 */
+    DMA1_STR1_IRQHandler,               /* 12 */
+    DMA1_STR2_IRQHandler,               /* 13 */
+    DMA1_STR3_IRQHandler,               /* 14 */
+    DMA1_STR4_IRQHandler,               /* 15 */
+    DMA1_STR5_IRQHandler,               /* 16 */
+    DMA1_STR6_IRQHandler,               /* 17 */
+    ADC_IRQHandler,                     /* 18 */
+    CAN1_TX_IRQHandler,                 /* 19 */
+    CAN1_RX0_IRQHandler,                /* 20 */
+    CAN1_RX1_IRQHandler,                /* 21 */
+    CAN1_SCE_IRQHandler,                /* 22 */
+    EINT9_5_IRQHandler,                 /* 23 */
+    TMR1_BRK_TMR9_IRQHandler,           /* 24 */
+    TMR1_UP_TMR10_IRQHandler,           /* 25 */
+    TMR1_TRG_COM_TMR11_IRQHandler,      /* 26 */
+    TMR1_CC_IRQHandler,                 /* 27 */
+    TMR2_IRQHandler,                    /* 28 */
+    TMR3_IRQHandler,                    /* 29 */
+    TMR4_IRQHandler,                    /* 30 */
+    I2C1_EV_IRQHandler,                 /* 31 */
+    I2C1_ER_IRQHandler,                 /* 32 */
+    I2C2_EV_IRQHandler,                 /* 33 */
+    I2C2_ER_IRQHandler,                 /* 34 */
+    SPI1_IRQHandler,                    /* 35 */
+    SPI2_IRQHandler,                    /* 36 */
+    USART1_IRQHandler,                  /* 37 */
+    USART2_IRQHandler,                  /* 38 */
+    USART3_IRQHandler,                  /* 39 */
+    EINT15_10_IRQHandler,               /* 40 */
+    RTC_Alarm_IRQHandler,               /* 41 */
+    OTG_FS_WKUP_IRQHandler,             /* 42 */
+    TMR8_BRK_TMR12_IRQHandler,          /* 43 */
+    TMR8_UP_TMR13_IRQHandler,           /* 44 */
+    TMR8_TRG_COM_TMR14_IRQHandler,      /* 45 */
+    TMR8_CC_IRQHandler,                 /* 46 */
+    DMA1_STR7_IRQHandler,               /* 47 */
+    EMMC_IRQHandler,                    /* 48 */
+    SDIO_IRQHandler,                    /* 49 */
+    TMR5_IRQHandler,                    /* 50 */
+    SPI3_IRQHandler,                    /* 51 */
+    UART4_IRQHandler,                   /* 52 */
+    UART5_IRQHandler,                   /* 53 */
+    TMR6_DAC_IRQHandler,                /* 54 */
+    TMR7_IRQHandler,                    /* 55 */
+    DMA2_STR0_IRQHandler,               /* 56 */
+    DMA2_STR1_IRQHandler,               /* 57 */
+    DMA2_STR2_IRQHandler,               /* 58 */
+    DMA2_STR3_IRQHandler,               /* 59 */
+    DMA2_STR4_IRQHandler,               /* 60 */
+    ETH_IRQHandler,                     /* 61 */
+    ETH_WKUP_IRQHandler,                /* 62 */
+    CAN2_TX_IRQHandler,                 /* 63 */
+    CAN2_RX0_IRQHandler,                /* 64 */
+    CAN2_RX1_IRQHandler,                /* 65 */
+    CAN2_SCE_IRQHandler,                /* 66 */
+    OTG_FS_IRQHandler,                  /* 67 */
+    DMA2_STR5_IRQHandler,               /* 68 */
+    DMA2_STR6_IRQHandler,               /* 69 */
+    DMA2_STR7_IRQHandler,               /* 70 */
+    USART6_IRQHandler,                  /* 71 */
+    I2C3_EV_IRQHandler,                 /* 72 */
+    I2C3_ER_IRQHandler,                 /* 73 */
+    OTG_HS1_EP1_OUT_IRQHandler,         /* 74 */
+    OTG_HS1_EP1_IN_IRQHandler,          /* 75 */
+    OTG_HS1_WKUP_IRQHandler,            /* 76 */
+    OTG_HS1_IRQHandler,                 /* 77 */
+    DCI_IRQHandler,                     /* 78 */
+    HostSimDefaultHandler,              /* 79 */
+    HASH_RNG_IRQHandler,                /* 80 */
+    FPU_IRQHandler,                     /* 81 */
+    SM3_IRQHandler,                     /* 82 */
+    SM4_IRQHandler,                     /* 83 */
+    BN_IRQHandler,                      /* 84 */
+};
+
+const uint32_t HostSimVectorCount = sizeof(HostSimVectors) / sizeof(HostSimVectors[0]);
@@ -0,0 +1,63 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+
+/*
+ * Host test cases, one CTest test each (Host/CMakeLists.txt). Every case runs in
+ * a fresh process on a freshly initialized simulator and returns SUCCESS
+ * or ERROR.
+ */
+
+/**
+ * @brief Test case
+ */
+typedef struct
+{
+    const char* name;           /*!< CTest name, matches HOST_TEST_CASES in Host/CMakeLists.txt */
+    uint8_t     (*run)(void);
+} HostTestCase_T;
+
+/* Fails the running case, reporting where */
+#define HOST_CHECK(cond)                                        \
+    do                                                          \
+    {                                                           \
+        if (!(cond))                                            \
+        {                                                       \
+            HostTestFail(__FILE__, __LINE__, #cond);            \
+            return ERROR;                                       \
+        }                                                       \
+    } while (0)
+
+void HostTestFail(const char* file, int line, const char* condition);
+uint8_t HostTestHexEqual(const uint8_t* data, const char* hex);
+
+/* Cases */
+uint8_t HostTestSim(void);
+uint8_t HostTestDebug(void);
+uint8_t HostTestEth(void);
+uint8_t HostTestUdp(void);
+uint8_t HostTestCan(void);
+uint8_t HostTestAes(void);
+uint8_t HostTestAesAead(void);
+uint8_t HostTestDigest(void);
+uint8_t HostTestSha256(void);
+uint8_t HostTestCrc(void);
+uint8_t HostTestDma(void);
+uint8_t HostTestAdcTriple(void);
+uint8_t HostTestDsp(void);
+uint8_t HostTestAdcOversample(void);
+uint8_t HostTestSpiBus(void);
+uint8_t HostTestSpiNor(void);
+uint8_t HostTestSdCard(void);
+uint8_t HostTestBlockCache(void);
+uint8_t HostTestKvStore(void);
+uint8_t HostTestLog(void);
+uint8_t HostTestProfile(void);
+uint8_t HostTestPingPong(void);
+
+/* PROFILE_CYCLES() of the host_tests_profile build */
+uint32_t HostTestProfileCycles(void);
+
+#endif // HOST_TEST_H
@@ -0,0 +1,186 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "AdcOversample.h"
+
+/* Frames of the noise run: 16 conversions each at 14 bits */
+#define ADC_OVERSAMPLE_TEST_FRAMES  1024U
+
+/**
+ * @brief Timing expected for a width, channels and rate at 84 MHz PCLK2
+ */
+typedef struct
+{
+    uint8_t  bits;
+    uint8_t  channels;
+    uint32_t request;
+    uint32_t rate;          /*!< 0: out of reach */
+    uint8_t  prescaler;
+    uint8_t  sampleTime;
+} HostTestAdcOversampleTiming_T;
+
+static const HostTestAdcOversampleTiming_T adcOversampleTimings[] =
+{
+    /* 160 ksps needed: 21 MHz / (112 + 12) / 16 is the slowest above */
+    { 14, 1, 10000U, 10584U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_112CYCLES },
+    /* 16 bits on 4 channels, 1024 scans per result */
+    { 16, 4, 1000U, 1367U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_3CYCLES },
+    { 16, 4, 2000U, 0, 0, 0 },
+    /* Plain 12 bits: the longest sampling time */
+    { 12, 1, 10000U, 21341U, ADC_PRESCALER_DIV8, ADC_SAMPLETIME_480CYCLES },
+};
+
+static const uint8_t adcOversampleChannels[4] = { ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3 };
+
+static uint16_t adcOversampleRaw[ADC_OVERSAMPLE_BUFFER(1U, 14U, ADC_OVERSAMPLE_TEST_FRAMES)];
+static uint16_t adcOversampleBuffers[2][ADC_OVERSAMPLE_BUFFER(1U, 14U, ADC_OVERSAMPLE_TEST_FRAMES)];
+
+/* Results of the last callback */
+static uint32_t adcOversampleCalls;
+static uint16_t adcOversampleResults[ADC_OVERSAMPLE_TEST_FRAMES];
+
+static void HostTestAdcOversampleDone(AdcOversample_T* os, uint16_t* results, uint32_t frames)
+{
+    adcOversampleCalls++;
+    memcpy(adcOversampleResults, results, frames * os->channels * sizeof(results[0]));
+}
+
+/* Conversions into the regular data register, one DMA request each */
+static uint8_t HostTestAdcOversampleConvert(const uint16_t* conversions, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ADC1->REGDATA = conversions[i];
+        HOST_CHECK(HostDmaRequest((uint32_t)&ADC1->REGDATA) == 1);
+    }
+
+    return SUCCESS;
+}
+
+/* Prescaler and sampling time against known answers */
+static uint8_t HostTestAdcOversampleTiming(void)
+{
+    const HostTestAdcOversampleTiming_T* vector;
+    AdcOversample_T os;
+    uint32_t i;
+    uint8_t result;
+
+    for (i = 0; i < sizeof(adcOversampleTimings) / sizeof(adcOversampleTimings[0]); i++)
+    {
+        vector = &adcOversampleTimings[i];
+        result = AdcOversampleInit(&os, ADC1, adcOversampleChannels, vector->channels, vector->bits,
+                                   vector->request, adcOversampleBuffers[0], adcOversampleBuffers[1], 1,
+                                   HostTestAdcOversampleDone, NULL);
+        if (vector->rate == 0)
+        {
+            HOST_CHECK(result == ERROR);
+            continue;
+        }
+        HOST_CHECK(result == SUCCESS);
+        HOST_CHECK(os.rate == vector->rate);
+        HOST_CHECK(os.prescaler == vector->prescaler);
+        HOST_CHECK(os.sampleTime == vector->sampleTime);
+    }
+
+    /* Widths outside 12..16, and blocks beyond one DMA transfer */
+    HOST_CHECK(AdcOversampleInit(&os, ADC1, adcOversampleChannels, 1, 11, 1, adcOversampleBuffers[0],
+                                 adcOversampleBuffers[1], 1, HostTestAdcOversampleDone, NULL) == ERROR);
+    HOST_CHECK(AdcOversampleInit(&os, ADC1, adcOversampleChannels, 1, 17, 1, adcOversampleBuffers[0],
+                                 adcOversampleBuffers[1], 1, HostTestAdcOversampleDone, NULL) == ERROR);
+    HOST_CHECK(AdcOversampleInit(&os, ADC1, adcOversampleChannels, 4, 16, 1, adcOversampleBuffers[0],
+                                 adcOversampleBuffers[1], 64, HostTestAdcOversampleDone, NULL) == ERROR);
+
+    return SUCCESS;
+}
+
+/* A DC level with 1.6 LSB of noise accumulated to 14 bits gains two effective bits */
+static uint8_t HostTestAdcOversampleEnob(void)
+{
+    static AdcOversample_T os;
+    uint32_t seed = 1;
+    uint32_t i, sum, raw, accumulated;
+
+    /* 2000 plus two uniform 0..3 draws: variance 2.5 LSB^2 */
+    for (i = 0; i < sizeof(adcOversampleRaw) / sizeof(adcOversampleRaw[0]); i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        adcOversampleRaw[i] = (uint16_t)(2000U + ((seed >> 20) & 3U) + ((seed >> 28) & 3U));
+    }
+
+    /* 12 - log2(sqrt(30)) = 9.55 bits raw */
+    raw = AdcOversampleEnob(adcOversampleRaw, ADC_OVERSAMPLE_TEST_FRAMES, 16, 12);
+    HOST_CHECK(raw > 9U * 256U + 100U);
+    HOST_CHECK(raw < 9U * 256U + 180U);
+
+    adcOversampleCalls = 0;
+    HOST_CHECK(AdcOversampleInit(&os, ADC1, adcOversampleChannels, 1, 14, 1, adcOversampleBuffers[0],
+                                 adcOversampleBuffers[1], ADC_OVERSAMPLE_TEST_FRAMES,
+                                 HostTestAdcOversampleDone, NULL) == SUCCESS);
+    HOST_CHECK(AdcOversampleStart(&os) == SUCCESS);
+    HOST_CHECK(HostTestAdcOversampleConvert(adcOversampleRaw,
+                                            sizeof(adcOversampleRaw) / sizeof(adcOversampleRaw[0])) == SUCCESS);
+    AdcOversampleStop(&os);
+    HOST_CHECK(adcOversampleCalls == 1);
+
+    /* Each result is the sum of its 16 conversions shifted right by 2 */
+    for (i = 0, sum = 0; i < 16U; i++)
+    {
+        sum += adcOversampleRaw[i];
+    }
+    HOST_CHECK(adcOversampleResults[0] == (sum >> 2));
+
+    accumulated = AdcOversampleEnob(adcOversampleResults, ADC_OVERSAMPLE_TEST_FRAMES, 1, 14);
+    HOST_CHECK(accumulated > raw + 2U * 256U - 40U);
+    HOST_CHECK(accumulated < raw + 2U * 256U + 40U);
+
+    return SUCCESS;
+}
+
+/* Channels of a scan are summed apart */
+static uint8_t HostTestAdcOversampleChannels(void)
+{
+    static AdcOversample_T os;
+    uint16_t conversions[64];
+    uint32_t i;
+
+    for (i = 0; i < 64U; i++)
+    {
+        conversions[i] = (uint16_t)((i & 1U) ? 4095U : 1U);
+    }
+
+    adcOversampleCalls = 0;
+    HOST_CHECK(AdcOversampleInit(&os, ADC1, adcOversampleChannels, 2, 14, 1, adcOversampleBuffers[0],
+                                 adcOversampleBuffers[1], 2, HostTestAdcOversampleDone, NULL) == SUCCESS);
+    HOST_CHECK(AdcOversampleStart(&os) == SUCCESS);
+    HOST_CHECK(ADC1->CTRL1_B.SCANEN == BIT_SET);
+    HOST_CHECK(HostTestAdcOversampleConvert(conversions, 64) == SUCCESS);
+    AdcOversampleStop(&os);
+
+    HOST_CHECK(adcOversampleCalls == 1);
+    HOST_CHECK(adcOversampleResults[0] == 4U);
+    HOST_CHECK(adcOversampleResults[1] == 16380U);
+    HOST_CHECK(adcOversampleResults[2] == 4U);
+    HOST_CHECK(adcOversampleResults[3] == 16380U);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       ADC oversampling on the simulated ADC1 and DMA2: timing
+ *              choices, accumulation of a block per channel, and two
+ *              effective bits gained by 16x oversampling of synthetic noise.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestAdcOversample(void)
+{
+    HOST_CHECK(HostTestAdcOversampleTiming() == SUCCESS);
+    HOST_CHECK(HostTestAdcOversampleEnob() == SUCCESS);
+    HOST_CHECK(HostTestAdcOversampleChannels() == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,209 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "apm32f4xx_rcm.h"
+#include "AdcTriple.h"
+
+#define ADC_TRIPLE_TEST_SAMPLES 8U
+
+/**
+ * @brief Timing expected for a clock, resolution and requested rate
+ */
+typedef struct
+{
+    uint32_t pclk2;
+    uint8_t  resolution;
+    uint32_t request;
+    uint32_t rate;          /*!< 0: no timing */
+    uint8_t  prescaler;
+    uint8_t  sampleTime;
+    uint8_t  delay;
+} HostTestAdcTripleTiming_T;
+
+static const HostTestAdcTripleTiming_T adcTripleTimings[] =
+{
+    /* 36 MHz ADC clock, 3 + 12 cycles, 5-cycle delay: the datasheet maximum */
+    { 72000000U, ADC_RESOLUTION_12BIT, 8000000U, 7200000U, ADC_PRESCALER_DIV2, ADC_SAMPLETIME_3CYCLES, ADC_TWO_SAMPLING_5CYCLES },
+    /* 84 MHz PCLK2 must be divided by 4 */
+    { 84000000U, ADC_RESOLUTION_12BIT, 8000000U, 4200000U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_3CYCLES, ADC_TWO_SAMPLING_5CYCLES },
+    { 84000000U, ADC_RESOLUTION_12BIT, 2500000U, 2333333U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_15CYCLES, ADC_TWO_SAMPLING_9CYCLES },
+    { 84000000U, ADC_RESOLUTION_8BIT, 8000000U, 1750000U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_28CYCLES, ADC_TWO_SAMPLING_12CYCLES },
+    { 84000000U, ADC_RESOLUTION_6BIT, 8000000U, 3000000U, ADC_PRESCALER_DIV4, ADC_SAMPLETIME_15CYCLES, ADC_TWO_SAMPLING_7CYCLES },
+    { 84000000U, ADC_RESOLUTION_10BIT, 8000000U, 0, 0, 0, 0 },
+    { 84000000U, ADC_RESOLUTION_12BIT, 1000000U, 0, 0, 0, 0 },
+};
+
+static uint16_t adcTripleBlocks[2][ADC_TRIPLE_TEST_SAMPLES];
+
+/* Last block passed to the callback */
+static uint32_t adcTripleCalls;
+static uint16_t* adcTripleBlock;
+static uint16_t adcTripleSamples[ADC_TRIPLE_TEST_SAMPLES];
+
+static void HostTestAdcTripleDone(AdcTriple_T* at, uint16_t* samples, uint32_t count)
+{
+    (void)at;
+
+    adcTripleCalls++;
+    adcTripleBlock = samples;
+    memcpy(adcTripleSamples, samples, count * sizeof(samples[0]));
+}
+
+/* Scale the main PLL so PCLK2 (SYSCLK / 2) becomes hz; whole MHz only */
+static uint8_t HostTestAdcTriplePclk2(uint32_t hz)
+{
+    uint32_t pclk1, pclk2;
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    RCM->PLL1CFG_B.PLL1A = RCM->PLL1CFG_B.PLL1A / (pclk2 / 1000000U) * (hz / 1000000U);
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    HOST_CHECK(pclk2 == hz);
+
+    return SUCCESS;
+}
+
+/* Prescaler, sampling time and delay against known answers */
+static uint8_t HostTestAdcTripleTiming(void)
+{
+    const HostTestAdcTripleTiming_T* vector;
+    AdcTriple_T at;
+    uint32_t i;
+    uint8_t result;
+
+    for (i = 0; i < sizeof(adcTripleTimings) / sizeof(adcTripleTimings[0]); i++)
+    {
+        vector = &adcTripleTimings[i];
+        HOST_CHECK(HostTestAdcTriplePclk2(vector->pclk2) == SUCCESS);
+
+        result = AdcTripleInit(&at, ADC_CHANNEL_0, (ADC_RESOLUTION_T)vector->resolution, vector->request,
+                               adcTripleBlocks[0], adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES,
+                               HostTestAdcTripleDone, NULL);
+        if (vector->rate == 0)
+        {
+            HOST_CHECK(result == ERROR);
+            continue;
+        }
+        HOST_CHECK(result == SUCCESS);
+        HOST_CHECK(at.rate == vector->rate);
+        HOST_CHECK(at.prescaler == vector->prescaler);
+        HOST_CHECK(at.sampleTime == vector->sampleTime);
+        HOST_CHECK(at.delay == vector->delay);
+    }
+
+    /* Channels all three ADCs share, even block sizes, aligned buffers */
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_4, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, HostTestAdcTripleDone, NULL) == ERROR);
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_13, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, HostTestAdcTripleDone, NULL) == SUCCESS);
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_0, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], 7, HostTestAdcTripleDone, NULL) == ERROR);
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_0, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, &adcTripleBlocks[0][1],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, HostTestAdcTripleDone, NULL) == ERROR);
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_0, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, NULL, NULL) == ERROR);
+
+    return SUCCESS;
+}
+
+/* Register setup of a 12-bit run, two samples per word in conversion order */
+static uint8_t HostTestAdcTripleRun(void)
+{
+    static AdcTriple_T at;
+    uint32_t i;
+
+    adcTripleCalls = 0;
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_0, ADC_RESOLUTION_12BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, HostTestAdcTripleDone, NULL) == SUCCESS);
+    HOST_CHECK(at.rate > 0);
+    HOST_CHECK(AdcTripleStart(&at) == SUCCESS);
+
+    HOST_CHECK(ADC->CCTRL_B.ADCMSEL == ADC_MODE_TRIPLE_INTERL);
+    HOST_CHECK(ADC->CCTRL_B.DMAMODE == ADC_ACCESS_MODE_2);
+    HOST_CHECK(ADC->CCTRL_B.DMADISSEL == 1U);
+    HOST_CHECK(ADC->CCTRL_B.ADCPRE == at.prescaler);
+    HOST_CHECK(ADC->CCTRL_B.SMPDEL2 == at.delay);
+    HOST_CHECK(ADC3->CTRL2_B.CONTCEN == 1U);
+    HOST_CHECK(ADC3->CTRL2_B.ADCEN == 1U);
+    HOST_CHECK((ADC2->REGSEQ3 & 0x1FU) == ADC_CHANNEL_0);
+    HOST_CHECK((ADC2->SMPTIM2 & 7U) == at.sampleTime);
+    HOST_CHECK(at.pp.stream != NULL);
+    HOST_CHECK(at.pp.transfer.size == 4U);
+    HOST_CHECK(at.pp.transfer.count == ADC_TRIPLE_TEST_SAMPLES / 2U);
+    HOST_CHECK(at.pp.transfer.peripheral == (uint32_t)&ADC->CDATA);
+
+    for (i = 0; i < ADC_TRIPLE_TEST_SAMPLES; i += 2U)
+    {
+        ADC->CDATA = ((0x100U + i + 1U) << 16) | (0x100U + i);
+        HOST_CHECK(HostDmaRequest((uint32_t)&ADC->CDATA) == 1);
+    }
+    HOST_CHECK(adcTripleCalls == 1);
+    HOST_CHECK(adcTripleBlock == adcTripleBlocks[0]);
+    for (i = 0; i < ADC_TRIPLE_TEST_SAMPLES; i++)
+    {
+        HOST_CHECK(adcTripleSamples[i] == 0x100U + i);
+    }
+
+    AdcTripleStop(&at);
+    HOST_CHECK(ADC->CCTRL_B.ADCMSEL == ADC_MODE_INDEPENDENT);
+    HOST_CHECK(ADC1->CTRL2_B.ADCEN == 0);
+    HOST_CHECK(at.pp.stream == NULL);
+
+    return SUCCESS;
+}
+
+/* 8-bit samples arrive two per halfword and are widened in place */
+static uint8_t HostTestAdcTripleWiden(void)
+{
+    static AdcTriple_T at;
+    uint32_t i;
+
+    adcTripleCalls = 0;
+    HOST_CHECK(AdcTripleInit(&at, ADC_CHANNEL_0, ADC_RESOLUTION_8BIT, 0xFFFFFFFFU, adcTripleBlocks[0],
+                             adcTripleBlocks[1], ADC_TRIPLE_TEST_SAMPLES, HostTestAdcTripleDone, NULL) == SUCCESS);
+    HOST_CHECK(AdcTripleStart(&at) == SUCCESS);
+    HOST_CHECK(ADC->CCTRL_B.DMAMODE == ADC_ACCESS_MODE_3);
+    HOST_CHECK(at.pp.transfer.size == 2U);
+
+    /* Both blocks, so widening runs on each buffer */
+    for (i = 0; i < 2U * ADC_TRIPLE_TEST_SAMPLES; i += 2U)
+    {
+        ADC->CDATA = ((0xF0U + i + 1U) << 8) | (0xF0U + i);
+        HOST_CHECK(HostDmaRequest((uint32_t)&ADC->CDATA) == 1);
+        if (i == ADC_TRIPLE_TEST_SAMPLES - 2U)
+        {
+            HOST_CHECK(adcTripleCalls == 1);
+            HOST_CHECK(adcTripleBlock == adcTripleBlocks[0]);
+            HOST_CHECK(adcTripleSamples[0] == 0xF0U);
+            HOST_CHECK(adcTripleSamples[ADC_TRIPLE_TEST_SAMPLES - 1U] == 0xF7U);
+        }
+    }
+    HOST_CHECK(adcTripleCalls == 2);
+    HOST_CHECK(adcTripleBlock == adcTripleBlocks[1]);
+    for (i = 0; i < ADC_TRIPLE_TEST_SAMPLES; i++)
+    {
+        HOST_CHECK(adcTripleSamples[i] == 0xF8U + i);
+    }
+
+    AdcTripleStop(&at);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Triple interleaved ADC on the simulated ADCs and DMA2: timing
+ *              choices, the register setup of a run, sample order and the
+ *              widening of byte samples.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestAdcTriple(void)
+{
+    HOST_CHECK(HostTestAdcTripleTiming() == SUCCESS);
+    HOST_CHECK(HostTestAdcTriplePclk2(84000000U) == SUCCESS);
+    HOST_CHECK(HostTestAdcTripleRun() == SUCCESS);
+    HOST_CHECK(HostTestAdcTripleWiden() == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,176 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Aes.h"
+
+/* FIPS-197 appendix C: key 00 01 .. 1f (truncated), plaintext 00 11 .. ff */
+static const uint8_t aesKatPlain[16] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF
+};
+
+static const uint8_t aesKatCipher[3][16] =
+{
+    { 0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A },
+    { 0xDD, 0xA9, 0x7C, 0xA4, 0x86, 0x4C, 0xDF, 0xE0, 0x6E, 0xAF, 0x70, 0xA0, 0xEC, 0x0D, 0x71, 0x91 },
+    { 0x8E, 0xA2, 0xB7, 0xCA, 0x51, 0x67, 0x45, 0xBF, 0xEA, 0xFC, 0x49, 0x90, 0x4B, 0x49, 0x60, 0x89 },
+};
+
+/* SP 800-38A F.1.1, F.2.1 and F.5.1: AES-128 ECB, CBC and CTR */
+static const uint8_t aesKatKey[16] =
+{
+    0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C
+};
+
+static const uint8_t aesKatText[64] =
+{
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+};
+
+static const uint8_t aesKatEcb[64] =
+{
+    0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60, 0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97,
+    0xF5, 0xD3, 0xD5, 0x85, 0x03, 0xB9, 0x69, 0x9D, 0xE7, 0x85, 0x89, 0x5A, 0x96, 0xFD, 0xBA, 0xAF,
+    0x43, 0xB1, 0xCD, 0x7F, 0x59, 0x8E, 0xCE, 0x23, 0x88, 0x1B, 0x00, 0xE3, 0xED, 0x03, 0x06, 0x88,
+    0x7B, 0x0C, 0x78, 0x5E, 0x27, 0xE8, 0xAD, 0x3F, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5D, 0xD4
+};
+
+static const uint8_t aesKatCbcIv[16] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+};
+
+static const uint8_t aesKatCbc[64] =
+{
+    0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9, 0x8E, 0x9B, 0x12, 0xE9, 0x19, 0x7D,
+    0x50, 0x86, 0xCB, 0x9B, 0x50, 0x72, 0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76, 0x78, 0xB2,
+    0x73, 0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B, 0x71, 0x16, 0xE6, 0x9E, 0x22, 0x22, 0x95, 0x16,
+    0x3F, 0xF1, 0xCA, 0xA1, 0x68, 0x1F, 0xAC, 0x09, 0x12, 0x0E, 0xCA, 0x30, 0x75, 0x86, 0xE1, 0xA7
+};
+
+static const uint8_t aesKatCtrIv[16] =
+{
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+static const uint8_t aesKatCtr[64] =
+{
+    0x87, 0x4D, 0x61, 0x91, 0xB6, 0x20, 0xE3, 0x26, 0x1B, 0xEF, 0x68, 0x64, 0x99, 0x0D, 0xB6, 0xCE,
+    0x98, 0x06, 0xF6, 0x6B, 0x79, 0x70, 0xFD, 0xFF, 0x86, 0x17, 0x18, 0x7B, 0xB9, 0xFF, 0xFD, 0xFF,
+    0x5A, 0xE4, 0xDF, 0x3E, 0xDB, 0xD5, 0xD3, 0x5E, 0x5B, 0x4F, 0x09, 0x02, 0x0D, 0xB0, 0x3E, 0xAB,
+    0x1E, 0x03, 0x1D, 0xDA, 0x2F, 0xBE, 0x03, 0xD1, 0x79, 0x21, 0x70, 0xA0, 0xF3, 0x00, 0x9C, 0xEE
+};
+
+static uint32_t aesDone[2];
+
+static void HostTestAesDone(AesContext_T* ctx, void* arg)
+{
+    (void)ctx;
+
+    aesDone[(uintptr_t)arg]++;
+}
+
+/*!
+ * @brief       AES against FIPS-197 and SP 800-38A: all key sizes in both
+ *              directions, CBC chaining across calls, CTR split off block
+ *              boundaries and in place, and two AesUpdateAsync() streams
+ *              sharing AesPoll() with the results of AesUpdate().
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestAes(void)
+{
+    static uint8_t bulk[1000], expect[2][1000], out[1000];
+    AesContext_T ctx, other;
+    uint8_t key[32];
+    uint8_t buf[64];
+    uint32_t i, polls;
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)i;
+    }
+
+    for (i = 0; i < 3U; i++)
+    {
+        HOST_CHECK(AesInit(&ctx, AES_MODE_ECB, AES_ENCRYPT, key, (uint16_t)(128U + 64U * i), NULL) == SUCCESS);
+        AesUpdate(&ctx, aesKatPlain, AES_BLOCK_SIZE, buf);
+        HOST_CHECK(memcmp(buf, aesKatCipher[i], AES_BLOCK_SIZE) == 0);
+
+        HOST_CHECK(AesInit(&ctx, AES_MODE_ECB, AES_DECRYPT, key, (uint16_t)(128U + 64U * i), NULL) == SUCCESS);
+        AesUpdate(&ctx, buf, AES_BLOCK_SIZE, buf);
+        HOST_CHECK(memcmp(buf, aesKatPlain, AES_BLOCK_SIZE) == 0);
+    }
+    HOST_CHECK(AesInit(&ctx, AES_MODE_ECB, AES_ENCRYPT, key, 160, NULL) == ERROR);
+
+    AesInit(&ctx, AES_MODE_ECB, AES_ENCRYPT, aesKatKey, 128, NULL);
+    AesUpdate(&ctx, aesKatText, sizeof(buf), buf);
+    HOST_CHECK(memcmp(buf, aesKatEcb, sizeof(buf)) == 0);
+    HOST_CHECK(AesUpdate(&ctx, aesKatText, 15, buf) == ERROR);
+
+    AesInit(&ctx, AES_MODE_CBC, AES_ENCRYPT, aesKatKey, 128, aesKatCbcIv);
+    AesUpdate(&ctx, aesKatText, 16, buf);
+    AesUpdate(&ctx, aesKatText + 16, 48, buf + 16);
+    HOST_CHECK(memcmp(buf, aesKatCbc, sizeof(buf)) == 0);
+
+    AesInit(&ctx, AES_MODE_CBC, AES_DECRYPT, aesKatKey, 128, aesKatCbcIv);
+    AesUpdate(&ctx, buf, 32, buf);
+    AesUpdate(&ctx, buf + 32, 32, buf + 32);
+    HOST_CHECK(memcmp(buf, aesKatText, sizeof(buf)) == 0);
+
+    /* CTR: pieces of 5, 27 and 32 bytes, in place */
+    memcpy(buf, aesKatText, sizeof(buf));
+    AesInit(&ctx, AES_MODE_CTR, AES_ENCRYPT, aesKatKey, 128, aesKatCtrIv);
+    AesUpdate(&ctx, buf, 5, buf);
+    AesUpdate(&ctx, buf + 5, 27, buf + 5);
+    AesUpdate(&ctx, buf + 32, 32, buf + 32);
+    HOST_CHECK(memcmp(buf, aesKatCtr, sizeof(buf)) == 0);
+
+    /* A new IV restarts the keystream */
+    AesSetIv(&ctx, aesKatCtrIv);
+    AesUpdate(&ctx, buf, 17, buf);
+    HOST_CHECK(memcmp(buf, aesKatText, 17) == 0);
+
+    /* Queued streams: a CBC and an odd-length CTR job, round robin */
+    for (i = 0; i < sizeof(bulk); i++)
+    {
+        bulk[i] = (uint8_t)(i * 31U + 7U);
+    }
+    AesInit(&ctx, AES_MODE_CBC, AES_ENCRYPT, key, 256, aesKatCbcIv);
+    AesUpdate(&ctx, bulk, 992, expect[0]);
+    AesInit(&ctx, AES_MODE_CTR, AES_ENCRYPT, key, 192, aesKatCtrIv);
+    AesUpdate(&ctx, bulk, sizeof(bulk), expect[1]);
+
+    AesInit(&ctx, AES_MODE_CBC, AES_ENCRYPT, key, 256, aesKatCbcIv);
+    AesInit(&other, AES_MODE_CTR, AES_ENCRYPT, key, 192, aesKatCtrIv);
+    memcpy(out, bulk, sizeof(out));
+    HOST_CHECK(AesUpdateAsync(&ctx, bulk, 999, bulk, NULL, NULL) == ERROR);
+    HOST_CHECK(AesUpdateAsync(&ctx, bulk, 992, bulk, HostTestAesDone, (void*)0) == SUCCESS);
+    HOST_CHECK(AesUpdateAsync(&other, out, sizeof(out), out, HostTestAesDone, (void*)1) == SUCCESS);
+
+    /* A context with a queued job refuses more work */
+    HOST_CHECK(AesUpdateAsync(&ctx, buf, 16, buf, NULL, NULL) == ERROR);
+    HOST_CHECK(AesUpdate(&ctx, buf, 16, buf) == ERROR);
+    HOST_CHECK(AesFinal(&ctx) == ERROR);
+
+    polls = 0;
+    while (AesPoll() != 0)
+    {
+        polls++;
+    }
+    polls++;
+    HOST_CHECK((aesDone[0] == 1U) && (aesDone[1] == 1U));
+    HOST_CHECK(polls == (992U + AES_POLL_BLOCKS * 16U - 1U) / (AES_POLL_BLOCKS * 16U) +
+                        (sizeof(out) + AES_POLL_BLOCKS * 16U - 1U) / (AES_POLL_BLOCKS * 16U));
+    HOST_CHECK(memcmp(bulk, expect[0], 992) == 0);
+    HOST_CHECK(memcmp(out, expect[1], sizeof(out)) == 0);
+
+    AesFinal(&ctx);
+    AesFinal(&other);
+
+    return SUCCESS;
+}
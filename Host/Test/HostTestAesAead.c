@@ -0,0 +1,252 @@
+#include <string.h>
+#include "HostTest.h"
+#include "AesAead.h"
+
+/*
+ * GCM test cases 1-4, 6 and 13-15 (McGrew/Viega, reused in the NIST GCM
+ * validation) and SP 800-38C examples 1-3.
+ */
+static const uint8_t gcmKatZero[64];
+
+static const uint8_t gcmKatKey[32] =
+{
+    0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A, 0x8F, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A, 0x8F, 0x94, 0x67, 0x30, 0x83, 0x08
+};
+
+static const uint8_t gcmKatIv[12] =
+{
+    0xCA, 0xFE, 0xBA, 0xBE, 0xFA, 0xCE, 0xDB, 0xAD, 0xDE, 0xCA, 0xF8, 0x88
+};
+
+static const uint8_t gcmKatIvLong[60] =
+{
+    0x93, 0x13, 0x22, 0x5D, 0xF8, 0x84, 0x06, 0xE5, 0x55, 0x90, 0x9C, 0x5A, 0xFF, 0x52, 0x69, 0xAA,
+    0x6A, 0x7A, 0x95, 0x38, 0x53, 0x4F, 0x7D, 0xA1, 0xE4, 0xC3, 0x03, 0xD2, 0xA3, 0x18, 0xA7, 0x28,
+    0xC3, 0xC0, 0xC9, 0x51, 0x56, 0x80, 0x95, 0x39, 0xFC, 0xF0, 0xE2, 0x42, 0x9A, 0x6B, 0x52, 0x54,
+    0x16, 0xAE, 0xDB, 0xF5, 0xA0, 0xDE, 0x6A, 0x57, 0xA6, 0x37, 0xB3, 0x9B
+};
+
+static const uint8_t gcmKatAad[20] =
+{
+    0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF,
+    0xAB, 0xAD, 0xDA, 0xD2
+};
+
+static const uint8_t gcmKatPlain[64] =
+{
+    0xD9, 0x31, 0x32, 0x25, 0xF8, 0x84, 0x06, 0xE5, 0xA5, 0x59, 0x09, 0xC5, 0xAF, 0xF5, 0x26, 0x9A,
+    0x86, 0xA7, 0xA9, 0x53, 0x15, 0x34, 0xF7, 0xDA, 0x2E, 0x4C, 0x30, 0x3D, 0x8A, 0x31, 0x8A, 0x72,
+    0x1C, 0x3C, 0x0C, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2F, 0xCF, 0x0E, 0x24, 0x49, 0xA6, 0xB5, 0x25,
+    0xB1, 0x6A, 0xED, 0xF5, 0xAA, 0x0D, 0xE6, 0x57, 0xBA, 0x63, 0x7B, 0x39, 0x1A, 0xAF, 0xD2, 0x55
+};
+
+static const uint8_t gcmKatCipher2[16] =
+{
+    0x03, 0x88, 0xDA, 0xCE, 0x60, 0xB6, 0xA3, 0x92, 0xF3, 0x28, 0xC2, 0xB9, 0x71, 0xB2, 0xFE, 0x78
+};
+
+/* Test cases 3 and 4; 4 is the first 60 bytes */
+static const uint8_t gcmKatCipher3[64] =
+{
+    0x42, 0x83, 0x1E, 0xC2, 0x21, 0x77, 0x74, 0x24, 0x4B, 0x72, 0x21, 0xB7, 0x84, 0xD0, 0xD4, 0x9C,
+    0xE3, 0xAA, 0x21, 0x2F, 0x2C, 0x02, 0xA4, 0xE0, 0x35, 0xC1, 0x7E, 0x23, 0x29, 0xAC, 0xA1, 0x2E,
+    0x21, 0xD5, 0x14, 0xB2, 0x54, 0x66, 0x93, 0x1C, 0x7D, 0x8F, 0x6A, 0x5A, 0xAC, 0x84, 0xAA, 0x05,
+    0x1B, 0xA3, 0x0B, 0x39, 0x6A, 0x0A, 0xAC, 0x97, 0x3D, 0x58, 0xE0, 0x91, 0x47, 0x3F, 0x59, 0x85
+};
+
+static const uint8_t gcmKatCipher14[16] =
+{
+    0xCE, 0xA7, 0x40, 0x3D, 0x4D, 0x60, 0x6B, 0x6E, 0x07, 0x4E, 0xC5, 0xD3, 0xBA, 0xF3, 0x9D, 0x18
+};
+
+static const uint8_t gcmKatCipher15[64] =
+{
+    0x52, 0x2D, 0xC1, 0xF0, 0x99, 0x56, 0x7D, 0x07, 0xF4, 0x7F, 0x37, 0xA3, 0x2A, 0x84, 0x42, 0x7D,
+    0x64, 0x3A, 0x8C, 0xDC, 0xBF, 0xE5, 0xC0, 0xC9, 0x75, 0x98, 0xA2, 0xBD, 0x25, 0x55, 0xD1, 0xAA,
+    0x8C, 0xB0, 0x8E, 0x48, 0x59, 0x0D, 0xBB, 0x3D, 0xA7, 0xB0, 0x8B, 0x10, 0x56, 0x82, 0x88, 0x38,
+    0xC5, 0xF6, 0x1E, 0x63, 0x93, 0xBA, 0x7A, 0x0A, 0xBC, 0xC9, 0xF6, 0x62, 0x89, 0x80, 0x15, 0xAD
+};
+
+/* The test case 6 ciphertext is not checked: its tag covers it */
+static const uint8_t gcmKatTag[8][16] =
+{
+    { 0x58, 0xE2, 0xFC, 0xCE, 0xFA, 0x7E, 0x30, 0x61, 0x36, 0x7F, 0x1D, 0x57, 0xA4, 0xE7, 0x45, 0x5A },
+    { 0xAB, 0x6E, 0x47, 0xD4, 0x2C, 0xEC, 0x13, 0xBD, 0xF5, 0x3A, 0x67, 0xB2, 0x12, 0x57, 0xBD, 0xDF },
+    { 0x4D, 0x5C, 0x2A, 0xF3, 0x27, 0xCD, 0x64, 0xA6, 0x2C, 0xF3, 0x5A, 0xBD, 0x2B, 0xA6, 0xFA, 0xB4 },
+    { 0x5B, 0xC9, 0x4F, 0xBC, 0x32, 0x21, 0xA5, 0xDB, 0x94, 0xFA, 0xE9, 0x5A, 0xE7, 0x12, 0x1A, 0x47 },
+    { 0x61, 0x9C, 0xC5, 0xAE, 0xFF, 0xFE, 0x0B, 0xFA, 0x46, 0x2A, 0xF4, 0x3C, 0x16, 0x99, 0xD0, 0x50 },
+    { 0x53, 0x0F, 0x8A, 0xFB, 0xC7, 0x45, 0x36, 0xB9, 0xA9, 0x63, 0xB4, 0xF1, 0xC4, 0xCB, 0x73, 0x8B },
+    { 0xD0, 0xD1, 0xC8, 0xA7, 0x99, 0x99, 0x6B, 0xF0, 0x26, 0x5B, 0x98, 0xB5, 0xD4, 0x8A, 0xB9, 0x19 },
+    { 0xB0, 0x94, 0xDA, 0xC5, 0xD9, 0x34, 0x71, 0xBD, 0xEC, 0x1A, 0x50, 0x22, 0x70, 0xE3, 0xCC, 0x6C },
+};
+
+/* SP 800-38C examples 1-3: key 40..4F, nonce 10.., AAD 00.., payload 20.. */
+static const uint8_t ccmKatCipher1[4] = { 0x71, 0x62, 0x01, 0x5B };
+static const uint8_t ccmKatTag1[4] = { 0x4D, 0xAC, 0x25, 0x5D };
+
+static const uint8_t ccmKatCipher2[16] =
+{
+    0xD2, 0xA1, 0xF0, 0xE0, 0x51, 0xEA, 0x5F, 0x62, 0x08, 0x1A, 0x77, 0x92, 0x07, 0x3D, 0x59, 0x3D
+};
+static const uint8_t ccmKatTag2[6] = { 0x1F, 0xC6, 0x4F, 0xBF, 0xAC, 0xCD };
+
+static const uint8_t ccmKatCipher3[24] =
+{
+    0xE3, 0xB2, 0x01, 0xA9, 0xF5, 0xB7, 0x1A, 0x7A, 0x9B, 0x1C, 0xEA, 0xEC, 0xCD, 0x97, 0xE7, 0x0B,
+    0x61, 0x76, 0xAA, 0xD9, 0xA4, 0x42, 0x8A, 0xA5
+};
+static const uint8_t ccmKatTag3[8] = { 0x48, 0x43, 0x92, 0xFB, 0xC1, 0xB0, 0x99, 0x51 };
+
+/**
+ * @brief One GCM vector
+ */
+typedef struct
+{
+    const uint8_t*  key;
+    uint16_t        keysize;
+    const uint8_t*  iv;
+    uint32_t        ivLen;
+    uint32_t        aadLen;         /* Bytes of gcmKatAad, or none */
+    const uint8_t*  plain;
+    const uint8_t*  cipher;         /* NULL: tag only */
+    uint32_t        length;
+    const uint8_t*  tag;
+} HostTestGcm_T;
+
+static const HostTestGcm_T gcmKat[] =
+{
+    { gcmKatZero, 128, gcmKatZero,   12, 0,  gcmKatPlain, NULL,           0,  gcmKatTag[0] },
+    { gcmKatZero, 128, gcmKatZero,   12, 0,  gcmKatZero,  gcmKatCipher2,  16, gcmKatTag[1] },
+    { gcmKatKey,  128, gcmKatIv,     12, 0,  gcmKatPlain, gcmKatCipher3,  64, gcmKatTag[2] },
+    { gcmKatKey,  128, gcmKatIv,     12, 20, gcmKatPlain, gcmKatCipher3,  60, gcmKatTag[3] },
+    { gcmKatKey,  128, gcmKatIvLong, 60, 20, gcmKatPlain, NULL,           60, gcmKatTag[4] },
+    { gcmKatZero, 256, gcmKatZero,   12, 0,  gcmKatPlain, NULL,           0,  gcmKatTag[5] },
+    { gcmKatZero, 256, gcmKatZero,   12, 0,  gcmKatZero,  gcmKatCipher14, 16, gcmKatTag[6] },
+    { gcmKatKey,  256, gcmKatIv,     12, 0,  gcmKatPlain, gcmKatCipher15, 64, gcmKatTag[7] },
+};
+
+/**
+ * @brief One CCM vector, SP 800-38C numbering
+ */
+typedef struct
+{
+    uint32_t        nonceLen;
+    uint32_t        aadLen;
+    uint32_t        length;
+    const uint8_t*  cipher;
+    const uint8_t*  tag;
+    uint32_t        tagLen;
+} HostTestCcm_T;
+
+static const HostTestCcm_T ccmKat[] =
+{
+    { 7,  8,  4,  ccmKatCipher1, ccmKatTag1, 4 },
+    { 8,  16, 16, ccmKatCipher2, ccmKatTag2, 6 },
+    { 12, 20, 24, ccmKatCipher3, ccmKatTag3, 8 },
+};
+
+/*!
+ * @brief       GCM and CCM against published vectors: empty, whole and
+ *              partial final blocks, 128- and 256-bit keys, a hashed
+ *              (non-96-bit) GCM IV, truncated tags, in-place decryption,
+ *              rejection of a modified tag or ciphertext with the output
+ *              cleared, and a round trip over every length up to 4 blocks.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestAesAead(void)
+{
+    const HostTestGcm_T* gcm;
+    const HostTestCcm_T* ccm;
+    AesAead_T aead;
+    uint8_t buf[64], text[64];
+    uint8_t tag[16];
+    uint8_t key[16], nonce[13], aad[20];
+    uint32_t i, len;
+
+    for (i = 0; i < sizeof(gcmKat) / sizeof(gcmKat[0]); i++)
+    {
+        gcm = &gcmKat[i];
+        HOST_CHECK(AesAeadInit(&aead, gcm->key, gcm->keysize) == SUCCESS);
+        HOST_CHECK(AesGcmEncrypt(&aead, gcm->iv, gcm->ivLen, gcmKatAad, gcm->aadLen,
+                                 gcm->plain, gcm->length, buf, tag, 16) == SUCCESS);
+        HOST_CHECK((gcm->cipher == NULL) || (memcmp(buf, gcm->cipher, gcm->length) == 0));
+        HOST_CHECK(memcmp(tag, gcm->tag, 16) == 0);
+
+        /* In place, with the tag cut to 12 bytes */
+        HOST_CHECK(AesGcmDecrypt(&aead, gcm->iv, gcm->ivLen, gcmKatAad, gcm->aadLen,
+                                 buf, gcm->length, buf, gcm->tag, 12) == SUCCESS);
+        HOST_CHECK(memcmp(buf, gcm->plain, gcm->length) == 0);
+    }
+
+    /* Test case 4 with a changed tag, then a changed ciphertext byte */
+    gcm = &gcmKat[3];
+    AesAeadInit(&aead, gcm->key, gcm->keysize);
+    memcpy(tag, gcm->tag, 16);
+    tag[15] ^= 1U;
+    HOST_CHECK(AesGcmDecrypt(&aead, gcm->iv, 12, gcmKatAad, 20, gcm->cipher, 60, buf, tag, 16) == ERROR);
+    memcpy(text, gcm->cipher, 60);
+    text[59] ^= 0x80U;
+    HOST_CHECK(AesGcmDecrypt(&aead, gcm->iv, 12, gcmKatAad, 20, text, 60, buf, gcm->tag, 16) == ERROR);
+    for (i = 0; i < 60U; i++)
+    {
+        HOST_CHECK(buf[i] == 0);
+    }
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)(0x40U + i);
+    }
+    for (i = 0; i < sizeof(nonce); i++)
+    {
+        nonce[i] = (uint8_t)(0x10U + i);
+    }
+    for (i = 0; i < sizeof(aad); i++)
+    {
+        aad[i] = (uint8_t)i;
+    }
+    for (i = 0; i < sizeof(text); i++)
+    {
+        text[i] = (uint8_t)(0x20U + i);
+    }
+
+    AesAeadInit(&aead, key, 128);
+    for (i = 0; i < sizeof(ccmKat) / sizeof(ccmKat[0]); i++)
+    {
+        ccm = &ccmKat[i];
+        HOST_CHECK(AesCcmEncrypt(&aead, nonce, ccm->nonceLen, aad, ccm->aadLen,
+                                 text, ccm->length, buf, tag, ccm->tagLen) == SUCCESS);
+        HOST_CHECK(memcmp(buf, ccm->cipher, ccm->length) == 0);
+        HOST_CHECK(memcmp(tag, ccm->tag, ccm->tagLen) == 0);
+        HOST_CHECK(AesCcmDecrypt(&aead, nonce, ccm->nonceLen, aad, ccm->aadLen,
+                                 buf, ccm->length, buf, tag, ccm->tagLen) == SUCCESS);
+        HOST_CHECK(memcmp(buf, text, ccm->length) == 0);
+
+        tag[0] ^= 1U;
+        HOST_CHECK(AesCcmDecrypt(&aead, nonce, ccm->nonceLen, aad, ccm->aadLen,
+                                 ccm->cipher, ccm->length, buf, tag, ccm->tagLen) == ERROR);
+    }
+
+    /* Parameters outside the modes */
+    HOST_CHECK(AesCcmEncrypt(&aead, nonce, 6, aad, 0, text, 16, buf, tag, 8) == ERROR);
+    HOST_CHECK(AesCcmEncrypt(&aead, nonce, 13, aad, 0, text, 16, buf, tag, 5) == ERROR);
+    HOST_CHECK(AesGcmEncrypt(&aead, nonce, 12, aad, 0, text, 16, buf, tag, 3) == ERROR);
+
+    /* Every partial block length both ways */
+    for (len = 0; len <= sizeof(text); len++)
+    {
+        HOST_CHECK(AesGcmEncrypt(&aead, nonce, 12, aad, len % 21U, text, len, buf, tag, 16) == SUCCESS);
+        HOST_CHECK(AesGcmDecrypt(&aead, nonce, 12, aad, len % 21U, buf, len, buf, tag, 16) == SUCCESS);
+        HOST_CHECK(memcmp(buf, text, len) == 0);
+        HOST_CHECK(AesCcmEncrypt(&aead, nonce, 13, aad, len % 21U, text, len, buf, tag, 16) == SUCCESS);
+        HOST_CHECK(AesCcmDecrypt(&aead, nonce, 13, aad, len % 21U, buf, len, buf, tag, 16) == SUCCESS);
+        HOST_CHECK(memcmp(buf, text, len) == 0);
+    }
+
+    AesFinal(&aead.aes);
+
+    return SUCCESS;
+}
@@ -0,0 +1,201 @@
+#include <string.h>
+#include "HostTest.h"
+#include "BlockCache.h"
+
+#define BLOCK_TEST_SIZE     64U     /* Bytes per block */
+#define BLOCK_TEST_BLOCKS   64U
+#define BLOCK_TEST_LINES    8U
+
+static uint32_t blockTestDisk[BLOCK_TEST_BLOCKS * BLOCK_TEST_SIZE / 4U];
+static uint32_t blockTestStorage[(BLOCKCACHE_BATCH + BLOCK_TEST_LINES) * BLOCK_TEST_SIZE / 4U];
+static uint32_t blockTestBuffer[BLOCKCACHE_BATCH * BLOCK_TEST_SIZE / 4U];
+static BlockCache_T blockTestCache;
+static BlockDev_T blockTestRam;
+
+/* A fresh RAM disk with a pattern per block, and an empty cache on it */
+static uint8_t HostTestBlockCacheSetup(uint8_t policy)
+{
+    uint8_t* disk = (uint8_t*)blockTestDisk;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(blockTestDisk); i++)
+    {
+        disk[i] = (uint8_t)(i * 7U + i / BLOCK_TEST_SIZE);
+    }
+    BlockDevRamInit(&blockTestRam, disk, BLOCK_TEST_SIZE, BLOCK_TEST_BLOCKS);
+
+    HOST_CHECK(BlockCacheInit(&blockTestCache, &blockTestRam, blockTestStorage, sizeof(blockTestStorage),
+                              policy) == SUCCESS);
+    HOST_CHECK(blockTestCache.lines == BLOCK_TEST_LINES);
+
+    return SUCCESS;
+}
+
+/* One block through the cache: read and compare, or write a fill */
+static uint8_t HostTestBlockCacheRead(uint32_t block)
+{
+    const uint8_t* disk = (const uint8_t*)blockTestDisk + block * BLOCK_TEST_SIZE;
+
+    HOST_CHECK(BlockDevRead(&blockTestCache.device, block, blockTestBuffer, 1) == SUCCESS);
+    HOST_CHECK(memcmp(blockTestBuffer, disk, BLOCK_TEST_SIZE) == 0);
+
+    return SUCCESS;
+}
+
+static uint8_t HostTestBlockCacheWrite(uint32_t block)
+{
+    memset(blockTestBuffer, (int)(0x80U + block), BLOCK_TEST_SIZE);
+
+    return BlockDevWrite(&blockTestCache.device, block, blockTestBuffer, 1);
+}
+
+static uint8_t HostTestBlockCacheWritten(uint32_t block)
+{
+    return ((const uint8_t*)blockTestDisk)[block * BLOCK_TEST_SIZE] == (uint8_t)(0x80U + block);
+}
+
+/* A miss, then a hit */
+static uint8_t HostTestBlockCacheHit(void)
+{
+    HOST_CHECK(HostTestBlockCacheSetup(BLOCKCACHE_LRU) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheRead(3) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheRead(3) == SUCCESS);
+    HOST_CHECK(blockTestRam.reads == 1U);
+    HOST_CHECK(blockTestCache.stats.readHits == 1U);
+    HOST_CHECK(BlockCacheHitRate(&blockTestCache) == 500U);
+
+    return SUCCESS;
+}
+
+/* The second of consecutive reads fetches half the lines at once */
+static uint8_t HostTestBlockCacheReadAhead(void)
+{
+    uint32_t i;
+
+    HOST_CHECK(HostTestBlockCacheSetup(BLOCKCACHE_LRU) == SUCCESS);
+    for (i = 16; i < 16U + BLOCK_TEST_LINES / 2U + 1U; i++)
+    {
+        HOST_CHECK(HostTestBlockCacheRead(i) == SUCCESS);
+    }
+    HOST_CHECK(blockTestRam.reads == 2U);
+    HOST_CHECK(blockTestCache.stats.readAheads == BLOCK_TEST_LINES / 2U - 1U);
+    HOST_CHECK(blockTestCache.stats.readAheadHits == BLOCK_TEST_LINES / 2U - 1U);
+
+    return SUCCESS;
+}
+
+/* Writes stay in the cache until the flush, 40-42 as one write */
+static uint8_t HostTestBlockCacheCoalesce(void)
+{
+    HOST_CHECK(HostTestBlockCacheSetup(BLOCKCACHE_LRU) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(40) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(42) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(44) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(41) == SUCCESS);
+    HOST_CHECK(blockTestRam.writes == 0);
+    HOST_CHECK(!HostTestBlockCacheWritten(40));
+
+    HOST_CHECK(BlockDevSync(&blockTestCache.device) == SUCCESS);
+    HOST_CHECK(blockTestRam.writes == 2U);
+    HOST_CHECK(blockTestCache.stats.writeBackBlocks == 4U);
+    HOST_CHECK(HostTestBlockCacheWritten(40) && HostTestBlockCacheWritten(41) && HostTestBlockCacheWritten(42));
+    HOST_CHECK(!HostTestBlockCacheWritten(43));
+    HOST_CHECK(HostTestBlockCacheWritten(44));
+    HOST_CHECK(blockTestCache.dirty == 0);
+
+    return SUCCESS;
+}
+
+/* Replacing a dirty line writes it back with its neighbour */
+static uint8_t HostTestBlockCacheReplace(void)
+{
+    uint32_t i;
+
+    HOST_CHECK(HostTestBlockCacheSetup(BLOCKCACHE_LRU) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(51) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(50) == SUCCESS);
+    for (i = 0; i < BLOCK_TEST_LINES; i++)
+    {
+        HOST_CHECK(HostTestBlockCacheRead(24U + 2U * i) == SUCCESS);
+    }
+    HOST_CHECK(blockTestRam.writes == 1U);
+    HOST_CHECK(blockTestCache.dirty == 0);
+    HOST_CHECK(HostTestBlockCacheWritten(50) && HostTestBlockCacheWritten(51));
+
+    return SUCCESS;
+}
+
+/* Long reads bypass the lines but see dirty data; requests past the end fail */
+static uint8_t HostTestBlockCacheBypass(void)
+{
+    const uint8_t* buffer = (const uint8_t*)blockTestBuffer;
+    uint32_t first = BLOCK_TEST_BLOCKS - BLOCKCACHE_BATCH;
+
+    HOST_CHECK(HostTestBlockCacheSetup(BLOCKCACHE_LRU) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWrite(first + 1U) == SUCCESS);
+    HOST_CHECK(BlockDevRead(&blockTestCache.device, first, blockTestBuffer, BLOCKCACHE_BATCH) == SUCCESS);
+    HOST_CHECK(buffer[BLOCK_TEST_SIZE] == (uint8_t)(0x80U + first + 1U));
+    HOST_CHECK(memcmp(buffer, (const uint8_t*)blockTestDisk + first * BLOCK_TEST_SIZE, BLOCK_TEST_SIZE) == 0);
+    HOST_CHECK(blockTestCache.stats.bypassBlocks == BLOCKCACHE_BATCH);
+    HOST_CHECK(BlockCacheFlush(&blockTestCache) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheWritten(first + 1U));
+
+    HOST_CHECK(BlockDevRead(&blockTestCache.device, BLOCK_TEST_BLOCKS, blockTestBuffer, 1) == ERROR);
+    HOST_CHECK(BlockCacheRead(&blockTestCache, BLOCK_TEST_BLOCKS - 1U, blockTestBuffer, 2) == ERROR);
+
+    return SUCCESS;
+}
+
+/*
+ * Hot block 5 read, dropped by a scan, read again, then a longer scan:
+ * 2Q has promoted it to the main queue and keeps it, LRU loses it.
+ * hit is 1 when the last read of block 5 hit.
+ */
+static uint8_t HostTestBlockCacheScan(uint8_t policy, uint8_t* hit)
+{
+    uint32_t i, hits;
+
+    HOST_CHECK(HostTestBlockCacheSetup(policy) == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheRead(5) == SUCCESS);
+    for (i = 0; i < BLOCK_TEST_LINES; i++)
+    {
+        HOST_CHECK(HostTestBlockCacheRead(10U + 2U * i) == SUCCESS);
+    }
+    HOST_CHECK(HostTestBlockCacheRead(5) == SUCCESS);
+    for (i = 0; i < 2U * BLOCK_TEST_LINES; i++)
+    {
+        HOST_CHECK(HostTestBlockCacheRead(27U + 2U * i) == SUCCESS);
+    }
+    hits = blockTestCache.stats.readHits;
+    HOST_CHECK(HostTestBlockCacheRead(5) == SUCCESS);
+    *hit = (blockTestCache.stats.readHits != hits);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Block cache on a RAM disk: hits, read-ahead, coalesced
+ *              write-back on a flush and on replacement, long reads that
+ *              bypass the lines, and the scan resistance of 2Q over LRU.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestBlockCache(void)
+{
+    uint8_t hit;
+
+    HOST_CHECK(HostTestBlockCacheHit() == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheReadAhead() == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheCoalesce() == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheReplace() == SUCCESS);
+    HOST_CHECK(HostTestBlockCacheBypass() == SUCCESS);
+
+    HOST_CHECK(HostTestBlockCacheScan(BLOCKCACHE_LRU, &hit) == SUCCESS);
+    HOST_CHECK(!hit);
+    HOST_CHECK(HostTestBlockCacheScan(BLOCKCACHE_2Q, &hit) == SUCCESS);
+    HOST_CHECK(hit);
+
+    return SUCCESS;
+}
@@ -0,0 +1,200 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "CanBus.h"
+
+#define CAN_TEST_MID_STD(id)    ((uint32_t)(id) << 21)
+#define CAN_TEST_MID_EXT(id)    (((uint32_t)(id) << 3) | 0x04U)
+#define CAN_TEST_MID_RTR        0x02U
+
+#define CAN_TEST_MAX            16U
+
+static CanBusFrame_T canReceived[CAN_TEST_MAX];
+static uint32_t canReceivedCount;
+static uint32_t canMaskedCount;
+
+static HostCanFrame_T canSent[CAN_TEST_MAX];
+static uint32_t canSentCount;
+
+static void HostTestCanRx(const CanBusFrame_T* frame)
+{
+    if (canReceivedCount < CAN_TEST_MAX)
+    {
+        canReceived[canReceivedCount] = *frame;
+    }
+    canReceivedCount++;
+}
+
+static void HostTestCanRxMasked(const CanBusFrame_T* frame)
+{
+    canMaskedCount++;
+    HostTestCanRx(frame);
+}
+
+static void HostTestCanSink(const HostCanFrame_T* frame)
+{
+    if (canSentCount < CAN_TEST_MAX)
+    {
+        canSent[canSentCount] = *frame;
+    }
+    canSentCount++;
+}
+
+/* Frame from another node, data bytes numbered from seq */
+static uint8_t HostTestCanInject(uint32_t mid, uint8_t seq)
+{
+    HostCanFrame_T frame;
+
+    frame.mid = mid;
+    frame.dlc = 8;
+    frame.dataLow = 0x03020100U + seq * 0x01010101U;
+    frame.dataHigh = 0x07060504U + seq * 0x01010101U;
+
+    return HostCanInject(&frame);
+}
+
+/* Poll and check the one frame it dispatched */
+static uint8_t HostTestCanDispatched(uint32_t id, uint8_t fifo, uint8_t filter, uint8_t seq)
+{
+    const CanBusFrame_T* frame = &canReceived[0];
+    uint32_t i;
+
+    canReceivedCount = 0;
+    if ((CanBusPoll() != 1U) || (canReceivedCount != 1U))
+    {
+        return 0;
+    }
+    for (i = 0; i < 8U; i++)
+    {
+        if (frame->data[i] != (uint8_t)(seq + i))
+        {
+            return 0;
+        }
+    }
+    return (frame->id == id) && (frame->dlc == 8U) && (frame->fifo == fifo) && (frame->filter == filter);
+}
+
+static uint8_t HostTestCanSend(uint32_t id, uint8_t data)
+{
+    CanBusFrame_T frame = { .id = id, .dlc = 1, .data = { data } };
+
+    return CanBusSend(&frame);
+}
+
+/*!
+ * @brief       CAN layer on the CAN1 model: filter bank packing and match
+ *              index dispatch, a refused filter list, preemption of the
+ *              lowest-priority mailbox and its re-queueing, and frames with
+ *              the same identifier leaving in the order they were queued.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestCan(void)
+{
+    /* FIFO 0: standard list banks 0-1 (indices 0-7), extended list bank 2
+       (8-9), standard mask bank 3 (10-11). FIFO 1: standard list bank 4
+       (0-3), extended mask bank 5 (4) */
+    static const CanBusFilter_T filters[] =
+    {
+        { 0x123, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x124, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x125, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x126, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x127, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x1ABCDE | CANBUS_ID_EXT, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+        { 0x400, 0x700, HostTestCanRxMasked, 0 },
+        { 0x10000000 | CANBUS_ID_EXT, 0x1F000000, HostTestCanRx, 1 },
+        { 0x200 | CANBUS_ID_RTR, CANBUS_MASK_EXACT, NULL, 1 },
+        { 0x405, CANBUS_MASK_EXACT, HostTestCanRx, 0 },
+    };
+    static CanBusFilter_T tooMany[CANBUS_FILTER_BANKS + 1U];
+    static const uint32_t order[][2] =
+    {
+        { 0x050, 0 }, { 0x100, 0 }, { 0x200, 0 }, { 0x200, 1 },
+        { 0x200, 2 }, { 0x200, 3 }, { 0x300, 0 }, { 0x300, 9 },
+    };
+    CanBusStats_T stats;
+    CanBusFrame_T frame;
+    uint32_t i;
+
+    HostCanSetSink(HostTestCanSink);
+    HOST_CHECK(CanBusInit(500000, CAN_MODE_NORMAL) == SUCCESS);
+
+    /* Nothing is accepted before the filters are set */
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x123), 0) == 0);
+    HOST_CHECK(CanBusSetFilters(filters, sizeof(filters) / sizeof(filters[0])) == SUCCESS);
+
+    /* Exact identifiers, numbered in bank order; unused slots pad bank 1 */
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x123), 1) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x123, 0, 0, 1));
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x126), 2) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x126, 0, 3, 2));
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x127), 3) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x127, 0, 4, 3));
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_EXT(0x1ABCDE), 4) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x1ABCDE | CANBUS_ID_EXT, 0, 8, 4));
+
+    /* Masks, and an exact entry winning over the mask it also matches */
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x4A5), 5) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x4A5, 0, 10, 5) && (canMaskedCount == 1U));
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x405), 6) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x405, 0, 5, 6) && (canMaskedCount == 1U));
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_EXT(0x10ABCDEF), 7) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x10ABCDEF | CANBUS_ID_EXT, 1, 4, 7));
+
+    /* RTR and IDE are compared, other identifiers do not pass */
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x128), 0) == 0);
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x200), 0) == 0);
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x4A5) | CAN_TEST_MID_RTR, 0) == 0);
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_EXT(0x123), 0) == 0);
+
+    /* An entry without a handler is left to CanBusReceive() */
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x200) | CAN_TEST_MID_RTR, 0) == 1U);
+    HOST_CHECK(CanBusReceive(1, &frame) == 1U);
+    HOST_CHECK((frame.id == (0x200 | CANBUS_ID_RTR)) && (frame.fifo == 1U) && (frame.filter == 0));
+    HOST_CHECK(CanBusReceive(1, &frame) == 0);
+
+    /* A list needing one bank too many changes nothing */
+    for (i = 0; i < sizeof(tooMany) / sizeof(tooMany[0]); i++)
+    {
+        tooMany[i] = (CanBusFilter_T){ (i << 24) | CANBUS_ID_EXT, 0x1F000000, HostTestCanRx, 0 };
+    }
+    HOST_CHECK(CanBusSetFilters(tooMany, sizeof(tooMany) / sizeof(tooMany[0])) == ERROR);
+    HOST_CHECK(HostTestCanInject(CAN_TEST_MID_STD(0x124), 8) == 1U);
+    HOST_CHECK(HostTestCanDispatched(0x124, 0, 1, 8));
+
+    /* Three mailboxes loaded; 0x050 preempts the 0x300 mailbox, which is
+       re-queued ahead of the later 0x300 frame. The 0x200 frames wait for
+       each other rather than race in the mailboxes */
+    HOST_CHECK(HostTestCanSend(0x300, 0) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x200, 0) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x100, 0) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x050, 0) == SUCCESS);
+    CanBusStats(&stats);
+    HOST_CHECK(stats.txPreempted == 1U);
+    HOST_CHECK(HostTestCanSend(0x200, 1) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x200, 2) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x300, 9) == SUCCESS);
+    HOST_CHECK(HostTestCanSend(0x200, 3) == SUCCESS);
+    HOST_CHECK(CanBusTxPending() == 8U);
+
+    while (HostCanStep())
+    {
+    }
+    HOST_CHECK(canSentCount == sizeof(order) / sizeof(order[0]));
+    for (i = 0; i < canSentCount; i++)
+    {
+        HOST_CHECK(canSent[i].mid == CAN_TEST_MID_STD(order[i][0]));
+        HOST_CHECK((canSent[i].dlc == 1U) && (canSent[i].dataLow == order[i][1]));
+    }
+
+    CanBusStats(&stats);
+    HOST_CHECK((stats.txFrames == canSentCount) && (stats.txPreempted == 1U) && (stats.txErrors == 0));
+    HOST_CHECK(CanBusTxPending() == 0);
+
+    HostCanSetSink(NULL);
+
+    return SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Crc.h"
+
+static const uint8_t crcKatText[] = "123456789";
+
+/* CRC-32/MPEG-2 of bytes 0..255 in CRC unit word order */
+#define CRC_KAT_WORDS_256   0xB7EC66F4U
+
+/* Bit-at-a-time Rocksoft model, independent of the tables */
+static uint32_t HostTestCrcBitwise(const CrcModel_T* model, const uint8_t* data, uint32_t length)
+{
+    uint32_t top = 1UL << (model->width - 1U);
+    uint32_t mask = (top << 1) - 1U;
+    uint32_t crc = model->init & mask;
+    uint32_t result = 0;
+    uint32_t i, bit;
+    uint8_t byte;
+
+    for (i = 0; i < length; i++)
+    {
+        /* Word order: each whole little-endian word goes MSB first */
+        if (((model->flags & CRC_WORD_ORDER) != 0) && ((i & ~3UL) + 4U <= length))
+        {
+            byte = data[(i & ~3UL) + 3U - (i & 3U)];
+        }
+        else
+        {
+            byte = data[i];
+        }
+        for (bit = 0; bit < 8U; bit++)
+        {
+            if ((model->flags & CRC_REFLECT) != 0)
+            {
+                crc ^= ((uint32_t)(byte >> bit) & 1U) << (model->width - 1U);
+            }
+            else
+            {
+                crc ^= ((uint32_t)(byte >> (7U - bit)) & 1U) << (model->width - 1U);
+            }
+            crc = ((crc & top) != 0) ? (((crc << 1) ^ model->poly) & mask) : ((crc << 1) & mask);
+        }
+    }
+
+    if ((model->flags & CRC_REFLECT) != 0)
+    {
+        for (bit = 0; bit < model->width; bit++)
+        {
+            result |= ((crc >> bit) & 1U) << (model->width - 1U - bit);
+        }
+        crc = result;
+    }
+
+    return (crc ^ model->xorOut) & mask;
+}
+
+/*!
+ * @brief       Software CRC engines and the CRC unit: check values of the
+ *              presets at every slice count, every preset against a
+ *              bit-at-a-time model over all lengths and alignments up to
+ *              70 bytes and in split updates, and the unit on its DMA and
+ *              CPU paths, including the 1-3 byte tail and CrcHwStart().
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestCrc(void)
+{
+    static const struct
+    {
+        const CrcModel_T*   model;
+        uint32_t            check;
+    } kat[] =
+    {
+        { &crcCrc32,        0xCBF43926U },
+        { &crcCrc32c,       0xE3069283U },
+        { &crcMpeg2,        0x0376E6E7U },
+        { &crcMpeg2Words,   0 },
+        { &crcCcittFalse,   0x29B1U },
+        { &crcModbus,       0x4B37U },
+    };
+    static const uint8_t slices[] = { 1, 4, 8 };
+    /* Word aligned for the DMA path */
+    static uint32_t buffer[1024 / 4];
+    uint8_t* bytes = (uint8_t*)buffer;
+    CrcModel_T model;
+    uint32_t crc, expect;
+    uint32_t i, j, offset, len, split;
+
+    for (i = 0; i < sizeof(buffer); i++)
+    {
+        bytes[i] = (uint8_t)(i * 89U + (i >> 8));
+    }
+
+    for (i = 0; i < sizeof(kat) / sizeof(kat[0]); i++)
+    {
+        for (j = 0; j < sizeof(slices); j++)
+        {
+            model = *kat[i].model;
+            if (slices[j] > model.slices)
+            {
+                continue;
+            }
+            model.slices = slices[j];
+            if (kat[i].check != 0)
+            {
+                HOST_CHECK(CrcCompute(&model, crcKatText, 9) == kat[i].check);
+                HOST_CHECK(HostTestCrcBitwise(&model, crcKatText, 9) == kat[i].check);
+            }
+
+            for (offset = 0; offset < 8U; offset++)
+            {
+                for (len = 0; len <= 70U; len++)
+                {
+                    expect = HostTestCrcBitwise(&model, &bytes[offset], len);
+                    HOST_CHECK(CrcCompute(&model, &bytes[offset], len) == expect);
+                }
+            }
+
+            /* Split updates hand over between the byte loop and the slices */
+            if ((model.flags & CRC_WORD_ORDER) == 0)
+            {
+                expect = HostTestCrcBitwise(&model, bytes, 70);
+                for (split = 0; split <= 70U; split++)
+                {
+                    crc = CrcUpdate(&model, CrcStart(&model), bytes, split);
+                    crc = CrcUpdate(&model, crc, &bytes[split], 70U - split);
+                    HOST_CHECK(CrcFinish(&model, crc) == expect);
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < 256U; i++)
+    {
+        bytes[i] = (uint8_t)i;
+    }
+    HOST_CHECK(CrcCompute(&crcMpeg2Words, bytes, 256) == CRC_KAT_WORDS_256);
+
+    /* DMA path, CPU path and the 1-3 byte tail, matching the software word order */
+    HOST_CHECK(CrcHwCompute(bytes, 256) == CRC_KAT_WORDS_256);
+    for (offset = 0; offset < 4U; offset++)
+    {
+        for (len = 0; len <= 4U * CRC_DMA_MIN + 5U; len++)
+        {
+            HOST_CHECK(CrcHwCompute(&bytes[offset], len) == CrcCompute(&crcMpeg2Words, &bytes[offset], len));
+        }
+    }
+    HOST_CHECK(CrcHwCompute(bytes, sizeof(buffer) - 1U) == CrcCompute(&crcMpeg2Words, bytes, sizeof(buffer) - 1U));
+
+    HOST_CHECK(CrcHwStart(bytes, 255) == SUCCESS);
+    while (CrcHwPoll(&crc) != SUCCESS)
+    {
+    }
+    HOST_CHECK(crc == CrcCompute(&crcMpeg2Words, bytes, 255));
+
+    return SUCCESS;
+}
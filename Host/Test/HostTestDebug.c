@@ -0,0 +1,196 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "Debug.h"
+#include "Dma.h"
+
+static uint8_t debugOut[4096];
+static uint32_t debugOutCount;
+
+static void HostTestDebugSink(USART_T* usart, uint8_t data)
+{
+    if ((usart == USART1) && (debugOutCount < sizeof(debugOut)))
+    {
+        debugOut[debugOutCount++] = data;
+    }
+}
+
+/* Byte i of a test pattern, distinct per pattern */
+static void HostTestDebugFill(char* buf, uint32_t len, uint8_t pattern)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (char)(pattern * 37U + i * 7U + (i >> 8));
+    }
+}
+
+#if DEBUG_TX_POLICY == DEBUG_TX_POLICY_BLOCK
+/* Writes from a masked context drop what does not fit, thread writes wait */
+static uint8_t HostTestDebugPolicy(const char* d, uint32_t dLen)
+{
+    DebugTxStats_T stats;
+
+    /* Instant USART, but the completion waits for the interrupt */
+    __disable_irq();
+    DebugWrite(d, dLen);
+    DebugTxStats(&stats);
+    HOST_CHECK((stats.overflows == 1U) && (stats.droppedBytes == dLen - DEBUG_TX_BUF_SIZE));
+    HOST_CHECK(stats.highWater == DEBUG_TX_BUF_SIZE);
+    __enable_irq();
+    HOST_CHECK(debugOutCount == DEBUG_TX_BUF_SIZE);
+    HOST_CHECK(memcmp(debugOut, d, DEBUG_TX_BUF_SIZE) == 0);
+
+    /* Longer than the ring from thread level: all of it, nothing lost */
+    debugOutCount = 0;
+    DebugWrite(d, dLen);
+    DebugTxStats(&stats);
+    HOST_CHECK((stats.overflows == 1U) && (stats.droppedBytes == dLen - DEBUG_TX_BUF_SIZE));
+    HOST_CHECK((debugOutCount == dLen) && (memcmp(debugOut, d, dLen) == 0));
+
+    return SUCCESS;
+}
+#else
+/* Issue USART1 transmit requests until the stream goes idle or count runs out */
+static uint32_t HostTestDebugPump(uint32_t count)
+{
+    uint32_t served = 0;
+
+    while ((served < count) && HostDmaRequest((uint32_t)(uintptr_t)&USART1->DATA))
+    {
+        served++;
+    }
+    return served;
+}
+
+/* Fill the ring behind a running chunk, then overflow it */
+static uint8_t HostTestDebugPolicy(const char* d, uint32_t dLen)
+{
+    static char a[200], b[824], c[40];
+    DebugTxStats_T stats;
+    uint32_t expect;
+
+    HostTestDebugFill(a, sizeof(a), 1);
+    HostTestDebugFill(b, sizeof(b), 2);
+    HostTestDebugFill(c, sizeof(c), 3);
+
+    /* From here on the USART requests every byte */
+    HostSimFindModel(USART1_BASE)->paced = 1;
+
+    /* Masked, so the ring fills behind the first chunk */
+    __disable_irq();
+    DebugWrite(a, sizeof(a));
+    HOST_CHECK(HostTestDebugPump(10) == 10U);
+    HOST_CHECK(debugOutCount == 10U);
+
+    /* Fills the ring exactly, wrapping past its end */
+    DebugWrite(b, sizeof(b));
+    DebugTxStats(&stats);
+    HOST_CHECK(stats.highWater == DEBUG_TX_BUF_SIZE);
+    HOST_CHECK((stats.overflows == 0) && (stats.droppedBytes == 0));
+
+#if DEBUG_TX_POLICY == DEBUG_TX_POLICY_OVERWRITE
+    /* Full: the running chunk is cut after its 10 bytes and the oldest
+       40 queued bytes give way */
+    DebugWrite(c, sizeof(c));
+    DebugTxStats(&stats);
+    HOST_CHECK((stats.overflows == 1U) && (stats.droppedBytes == sizeof(c)));
+
+    /* The restarted transfer is at most one chunk */
+    HOST_CHECK(HostTestDebugPump(1000) == DEBUG_TX_CHUNK_MAX);
+    __enable_irq();
+    HostTestDebugPump(2000);
+
+    expect = 10U + (sizeof(a) - 50U) + sizeof(b) + sizeof(c);
+    HOST_CHECK(debugOutCount == expect);
+    HOST_CHECK(memcmp(debugOut, a, 10) == 0);
+    HOST_CHECK(memcmp(&debugOut[10], &a[50], sizeof(a) - 50U) == 0);
+    HOST_CHECK(memcmp(&debugOut[10 + sizeof(a) - 50U], b, sizeof(b)) == 0);
+    HOST_CHECK(memcmp(&debugOut[10 + sizeof(a) - 50U + sizeof(b)], c, sizeof(c)) == 0);
+
+    /* Longer than the ring: only its newest ring-full survives */
+    __disable_irq();
+    DebugWrite(d, dLen);
+    __enable_irq();
+    HostTestDebugPump(2000);
+    DebugTxStats(&stats);
+    HOST_CHECK(stats.overflows == 2U);
+    HOST_CHECK(stats.droppedBytes == sizeof(c) + dLen - DEBUG_TX_BUF_SIZE);
+    HOST_CHECK(debugOutCount == expect + DEBUG_TX_BUF_SIZE);
+    HOST_CHECK(memcmp(&debugOut[expect], &d[dLen - DEBUG_TX_BUF_SIZE], DEBUG_TX_BUF_SIZE) == 0);
+#else
+    /* Full: new bytes are lost, masked or not, and the queue is untouched */
+    DebugWrite(c, sizeof(c));
+    __enable_irq();
+    DebugWrite(c, sizeof(c));
+    DebugTxStats(&stats);
+    HOST_CHECK((stats.overflows == 2U) && (stats.droppedBytes == 2U * sizeof(c)));
+
+    HostTestDebugPump(2000);
+    expect = sizeof(a) + sizeof(b);
+    HOST_CHECK(debugOutCount == expect);
+    HOST_CHECK(memcmp(debugOut, a, sizeof(a)) == 0);
+    HOST_CHECK(memcmp(&debugOut[sizeof(a)], b, sizeof(b)) == 0);
+
+    /* Longer than the ring: the oldest ring-full is kept */
+    DebugWrite(d, dLen);
+    HostTestDebugPump(2000);
+    DebugTxStats(&stats);
+    HOST_CHECK(stats.overflows == 3U);
+    HOST_CHECK(stats.droppedBytes == 2U * sizeof(c) + dLen - DEBUG_TX_BUF_SIZE);
+    HOST_CHECK(debugOutCount == expect + DEBUG_TX_BUF_SIZE);
+    HOST_CHECK(memcmp(&debugOut[expect], d, DEBUG_TX_BUF_SIZE) == 0);
+#endif
+
+    return SUCCESS;
+}
+#endif
+
+/*!
+ * @brief       Debug transmit: blocking writes when the USART1 TX stream
+ *              is taken, then the ring with chunking, chaining from the
+ *              DMA callback, wrap-around and high water, under the
+ *              DEBUG_TX_POLICY it was built with: drop (debug_tx),
+ *              overwrite aborting a transfer part way (debug_tx_overwrite)
+ *              or block outside interrupts (debug_tx_block).
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestDebug(void)
+{
+    static char d[1500];
+    DebugTxStats_T stats;
+    DmaStream_T* stream;
+
+    HostUsartSetSink(HostTestDebugSink);
+
+    /* No stream left: every byte is out before DebugWrite() returns */
+    stream = DmaClaim(DMA_REQ_USART1_TX, DMA_PRIORITY_LOW, 15);
+    HOST_CHECK(stream != NULL);
+    DebugInit();
+    __disable_irq();
+    DebugWrite("sync\r\n", 6);
+    __enable_irq();
+    HOST_CHECK((debugOutCount == 6U) && (memcmp(debugOut, "sync\r\n", 6) == 0));
+    DebugTxStats(&stats);
+    HOST_CHECK(stats.highWater == 0);
+    DmaRelease(stream);
+
+    /* Instant USART: the interrupt chains chunks until the ring is empty */
+    debugOutCount = 0;
+    DebugInit();
+    DebugWrite("hello\r\n", 7);
+    HOST_CHECK((debugOutCount == 7U) && (memcmp(debugOut, "hello\r\n", 7) == 0));
+    debugOutCount = 0;
+
+    HostTestDebugFill(d, sizeof(d), 4);
+    HOST_CHECK(HostTestDebugPolicy(d, sizeof(d)) == SUCCESS);
+
+    DebugFlush();
+    HostUsartSetSink(NULL);
+
+    return SUCCESS;
+}
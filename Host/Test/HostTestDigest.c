@@ -0,0 +1,163 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Digest.h"
+
+/**
+ * @brief Digest of the first length bytes of the test pattern
+ */
+typedef struct
+{
+    uint32_t    length;
+    const char* digest;     /* Hex, from an independent implementation */
+} HostTestDigestRef_T;
+
+/* Lengths around the padding limit (55/56) and the block end (63-65) */
+static const HostTestDigestRef_T digestRefSha1[] =
+{
+    { 0,    "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+    { 55,   "ddf57317ef34bfee3b6df83d359098930eb278bc" },
+    { 56,   "a0d492bb0fc889d0eca3bc137066ab6f4f74f369" },
+    { 63,   "c55856749bef509bdfe6bfebfc7bf4e793e82132" },
+    { 64,   "bede92be29c3874e1b54ddc77988d606fc857a8e" },
+    { 65,   "b05a80522b053d6dc7e0a517d0e70212c7dad11f" },
+    { 119,  "504e27376a6e0f0dba8295b85cb25dc4dfa17d23" },
+    { 128,  "a09133e6730ffe899efb70204cb5646cd5dc24ee" },
+    { 1000, "4231a8a50a10fa9758db8ec71fdef855b751048a" },
+};
+
+static const HostTestDigestRef_T digestRefMd5[] =
+{
+    { 0,    "d41d8cd98f00b204e9800998ecf8427e" },
+    { 55,   "52c0e574e1198de5fe3f8f11440dcb1b" },
+    { 56,   "46c9907fc908ee68b1e7b8e71286a518" },
+    { 63,   "a62f6d59e837867693f042f5b8f5a236" },
+    { 64,   "7160b8fb5e9e4023d549c3971fbaeead" },
+    { 65,   "70bd662e7aefbda85a0f7244167b7897" },
+    { 119,  "e84905d4214f4d1ca56c2cdcc152b143" },
+    { 128,  "10b2da1a82f16d99a81a7203fe9f02cb" },
+    { 1000, "10046f077f2082ac19676b8079f1cb1a" },
+};
+
+#define DIGEST_REF_COUNT    (sizeof(digestRefSha1) / sizeof(digestRefSha1[0]))
+
+/* Test pattern, 3 bytes of slack for misaligned copies */
+static uint8_t digestPattern[1000 + 3];
+
+/* Hash length bytes at data in pieces cycling through 1..span bytes */
+static void HostTestDigestPieces(DigestContext_T* ctx, const uint8_t* data, uint32_t length, uint32_t span)
+{
+    uint32_t piece = 1;
+    uint32_t n;
+
+    while (length != 0)
+    {
+        n = (piece < length) ? piece : length;
+        DigestUpdate(ctx, data, n);
+        data += n;
+        length -= n;
+        piece = (piece % span) + 1U;
+    }
+}
+
+/* Every way of feeding the pattern gives the reference digests */
+static uint8_t HostTestDigestAlgo(DigestAlgo_T algo, const HostTestDigestRef_T* ref)
+{
+    static uint8_t shifted[sizeof(digestPattern)];
+    DigestContext_T ctx;
+    uint8_t digest[DIGEST_MAX_SIZE];
+    uint32_t i, split, offset, len;
+
+    for (i = 0; i < DIGEST_REF_COUNT; i++)
+    {
+        len = ref[i].length;
+
+        HOST_CHECK(DigestCompute(algo, digestPattern, len, digest) == DigestSize(algo));
+        HOST_CHECK(HostTestHexEqual(digest, ref[i].digest));
+
+        /* Two pieces, split at every position */
+        for (split = 0; (len <= 128U) && (split <= len); split++)
+        {
+            DigestInit(&ctx, algo);
+            DigestUpdate(&ctx, digestPattern, split);
+            DigestUpdate(&ctx, &digestPattern[split], len - split);
+            DigestFinal(&ctx, digest);
+            HOST_CHECK(HostTestHexEqual(digest, ref[i].digest));
+        }
+
+        /* Uneven pieces from a misaligned copy */
+        for (offset = 1; offset <= 3U; offset++)
+        {
+            memcpy(&shifted[offset], digestPattern, len);
+            DigestInit(&ctx, algo);
+            HostTestDigestPieces(&ctx, &shifted[offset], len, 17U * offset + 50U);
+            HOST_CHECK(DigestFinal(&ctx, digest) == DigestSize(algo));
+            HOST_CHECK(HostTestHexEqual(digest, ref[i].digest));
+        }
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       SHA-1 and MD5 against FIPS 180 and RFC 1321 digests, and
+ *              against reference digests of a test pattern fed in two
+ *              pieces split at every position, in uneven misaligned
+ *              pieces, and in one piece. Two million-byte sessions run
+ *              interleaved.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestDigest(void)
+{
+    static const char md5Suite[] = "1234567890";
+    static uint8_t chunk[1000];
+    DigestContext_T sha1, md5;
+    uint8_t digest[DIGEST_MAX_SIZE];
+    uint32_t i;
+
+    for (i = 0; i < sizeof(digestPattern); i++)
+    {
+        digestPattern[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    HOST_CHECK(DigestSize(DIGEST_SHA1) == 20U);
+    HOST_CHECK(DigestSize(DIGEST_MD5) == 16U);
+
+    DigestCompute(DIGEST_SHA1, "abc", 3, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "a9993e364706816aba3e25717850c26c9cd0d89d"));
+    DigestCompute(DIGEST_SHA1, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "84983e441c3bd26ebaae4aa1f95129e5e54670f1"));
+    DigestCompute(DIGEST_MD5, "abc", 3, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "900150983cd24fb0d6963f7d28e17f72"));
+
+    /* RFC 1321: eight times "1234567890" as 3 + 7 byte pieces */
+    DigestInit(&md5, DIGEST_MD5);
+    for (i = 0; i < 8U; i++)
+    {
+        DigestUpdate(&md5, md5Suite, 3);
+        DigestUpdate(&md5, md5Suite + 3, 7);
+    }
+    DigestFinal(&md5, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "57edf4a22be3c955ac49da2e2107b67a"));
+
+    HOST_CHECK(HostTestDigestAlgo(DIGEST_SHA1, digestRefSha1) == SUCCESS);
+    HOST_CHECK(HostTestDigestAlgo(DIGEST_MD5, digestRefMd5) == SUCCESS);
+
+    /* One million "a", both sessions open at once, different piece sizes */
+    memset(chunk, 'a', sizeof(chunk));
+    DigestInit(&sha1, DIGEST_SHA1);
+    DigestInit(&md5, DIGEST_MD5);
+    for (i = 0; i < 1000U; i++)
+    {
+        DigestUpdate(&sha1, chunk, sizeof(chunk));
+        HostTestDigestPieces(&md5, chunk, sizeof(chunk), 97);
+    }
+    DigestFinal(&sha1, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "34aa973cd4c4daa4f61eeb2bdbad27316534016f"));
+    DigestFinal(&md5, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "7707d6ae4e027c70eea2a935c2296f21"));
+
+    return SUCCESS;
+}
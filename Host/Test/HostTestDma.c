@@ -0,0 +1,256 @@
+#include <stddef.h>
+#include "HostTest.h"
+#include "Dma.h"
+
+/* Size codes of SCFG PERSIZECFG/MEMSIZECFG, burst codes of PBCFG/MBCFG */
+#define DMA_TEST_BYTE       0U
+#define DMA_TEST_HALFWORD   1U
+#define DMA_TEST_WORD       2U
+#define DMA_TEST_SINGLE     0U
+#define DMA_TEST_INC4       1U
+
+/* FCTRL FTHSEL */
+#define DMA_TEST_HALF       1U
+#define DMA_TEST_FULL       3U
+
+static uint8_t dmaTestBuffer[512] __attribute__((aligned(16)));
+
+static volatile uint32_t dmaTestEvents;
+static volatile uint8_t dmaTestOrder[4];
+
+static void HostTestDmaDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    if ((event == DMA_EVENT_DONE) && (dmaTestEvents < sizeof(dmaTestOrder)))
+    {
+        dmaTestOrder[dmaTestEvents] = (uint8_t)(uintptr_t)transfer->arg;
+    }
+    dmaTestEvents++;
+}
+
+/* Submit on a freshly claimed stream and keep the stream registers it got */
+static uint8_t HostTestDmaProgram(DmaRequest_T request, DmaTransfer_T* transfer, DMA_Stream_T* regs)
+{
+    DmaStream_T* stream = DmaClaim(request, DMA_PRIORITY_LOW, 15);
+
+    HOST_CHECK(stream != NULL);
+    HOST_CHECK(DmaSubmit(stream, transfer) == SUCCESS);
+    regs->SCFG = stream->regs->SCFG;
+    regs->FCTRL = stream->regs->FCTRL;
+    DmaRelease(stream);
+
+    return SUCCESS;
+}
+
+/* FIFO, access width and bursts, as programmed for submitted transfers */
+static uint8_t HostTestDmaFifo(void)
+{
+    DmaTransfer_T transfer = { 0 };
+    DMA_Stream_T regs;
+
+    /* Word-aligned 64 bytes out: word accesses in INC4 bursts, full threshold */
+    transfer.peripheral = (uint32_t)&DAC->DH12R1;
+    transfer.memory = (uint32_t)dmaTestBuffer;
+    transfer.count = 64;
+    transfer.size = 1;
+    transfer.dir = DMA_DIR_MEMORYTOPERIPHERAL;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_DAC1, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.PERSIZECFG == DMA_TEST_BYTE);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_WORD);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.SCFG_B.PBCFG == DMA_TEST_SINGLE);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_SET);
+    HOST_CHECK(regs.FCTRL_B.FTHSEL == DMA_TEST_FULL);
+
+    /* Odd address: bytes, no burst, but still through the FIFO */
+    transfer.memory = (uint32_t)dmaTestBuffer + 1U;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_DAC1, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_BYTE);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_SINGLE);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_SET);
+    HOST_CHECK(regs.FCTRL_B.FTHSEL == DMA_TEST_HALF);
+
+    /* Receive that cannot pack stays in direct mode */
+    transfer.peripheral = (uint32_t)&ADC1->REGDATA;
+    transfer.dir = DMA_DIR_PERIPHERALTOMEMORY;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_ADC1, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_BYTE);
+    HOST_CHECK(regs.SCFG_B.DMEIEN == BIT_SET);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_RESET);
+
+    /* Circular receive never packs, even when aligned */
+    transfer.memory = (uint32_t)dmaTestBuffer;
+    transfer.flags = DMA_XFER_CIRCULAR;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_ADC1, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.CIRCMEN == BIT_SET);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_BYTE);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_RESET);
+
+    /* A receive that can pack uses the FIFO */
+    transfer.flags = 0;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_ADC1, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_WORD);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_SET);
+
+    /* SDIO: INC4 on both ports, full threshold */
+    transfer.peripheral = (uint32_t)&SDIO->FIFODATA;
+    transfer.flags = DMA_XFER_PERIPH_BURST;
+    transfer.size = 4;
+    transfer.count = 128;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_SDIO, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.PERSIZECFG == DMA_TEST_WORD);
+    HOST_CHECK(regs.SCFG_B.MEMSIZECFG == DMA_TEST_WORD);
+    HOST_CHECK(regs.SCFG_B.PBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.FCTRL_B.DMDEN == BIT_SET);
+    HOST_CHECK(regs.FCTRL_B.FTHSEL == DMA_TEST_FULL);
+
+    /* An 8-byte aligned buffer: no memory burst, but the threshold still
+       holds the peripheral bursts */
+    transfer.memory = (uint32_t)dmaTestBuffer + 8U;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_SDIO, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.PBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_SINGLE);
+    HOST_CHECK(regs.FCTRL_B.FTHSEL == DMA_TEST_FULL);
+
+    /* Memory to memory: the source bursts on the peripheral port too */
+    transfer = (DmaTransfer_T){ 0 };
+    transfer.peripheral = (uint32_t)dmaTestBuffer;
+    transfer.memory = (uint32_t)dmaTestBuffer + 256U;
+    transfer.count = 16;
+    transfer.size = 4;
+    HOST_CHECK(HostTestDmaProgram(DMA_REQ_MEM2MEM, &transfer, &regs) == SUCCESS);
+    HOST_CHECK(regs.SCFG_B.DIRCFG == DMA_DIR_MEMORYTOMEMORY);
+    HOST_CHECK(regs.SCFG_B.PERIM == BIT_SET);
+    HOST_CHECK(regs.SCFG_B.PBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.SCFG_B.MBCFG == DMA_TEST_INC4);
+    HOST_CHECK(regs.FCTRL_B.FTHSEL == DMA_TEST_FULL);
+
+    return SUCCESS;
+}
+
+/* Routing table: single-route requests run out, memory to memory is on DMA2 */
+static uint8_t HostTestDmaRouting(void)
+{
+    DmaStream_T* claimed[8];
+    DmaStream_T* stream;
+    uint32_t count, i;
+
+    /* USART2 TX has one route: DMA1 stream 6, channel 4 */
+    stream = DmaClaim(DMA_REQ_USART2_TX, DMA_PRIORITY_LOW, 15);
+    HOST_CHECK(stream != NULL);
+    HOST_CHECK(stream->index == DMA_STREAM_INDEX(1, 6));
+    HOST_CHECK(stream->channel == 4U);
+    HOST_CHECK(DmaClaim(DMA_REQ_USART2_TX, DMA_PRIORITY_LOW, 15) == NULL);
+    DmaRelease(stream);
+
+    /* USART1 TX is only routed to DMA2 stream 7, and is free again after release */
+    stream = DmaClaim(DMA_REQ_USART1_TX, DMA_PRIORITY_LOW, 15);
+    HOST_CHECK(stream != NULL);
+    HOST_CHECK(DmaClaim(DMA_REQ_USART1_TX, DMA_PRIORITY_LOW, 15) == NULL);
+    DmaRelease(stream);
+    stream = DmaClaim(DMA_REQ_USART1_TX, DMA_PRIORITY_LOW, 15);
+    HOST_CHECK(stream != NULL);
+    DmaRelease(stream);
+
+    /* All eight DMA2 streams can copy memory */
+    for (count = 0; count < 8U; count++)
+    {
+        claimed[count] = DmaClaim(DMA_REQ_MEM2MEM, DMA_PRIORITY_LOW, 15);
+        HOST_CHECK(claimed[count] != NULL);
+        HOST_CHECK(claimed[count]->dma == DMA2);
+    }
+    HOST_CHECK(DmaClaim(DMA_REQ_MEM2MEM, DMA_PRIORITY_LOW, 15) == NULL);
+    for (i = 0; i < count; i++)
+    {
+        DmaRelease(claimed[i]);
+    }
+
+    return SUCCESS;
+}
+
+/* Queued transfers run in order and complete; DmaStop() drops the queue */
+static uint8_t HostTestDmaQueue(void)
+{
+    static uint32_t source[64];
+    static uint32_t target[3][64];
+    static DmaTransfer_T transfers[3];
+    uint8_t* bytes = (uint8_t*)target;
+    DmaStream_T* stream;
+    uint32_t i;
+
+    stream = DmaClaim(DMA_REQ_MEM2MEM, DMA_PRIORITY_LOW, 15);
+    HOST_CHECK(stream != NULL);
+
+    /* Three copies: aligned words, unaligned bytes, halfwords */
+    for (i = 0; i < 64U; i++)
+    {
+        source[i] = 0x01020304U * (i + 1U);
+    }
+    transfers[0] = (DmaTransfer_T){ (uint32_t)source, (uint32_t)target[0], 0, 64, 4, 0, 0, HostTestDmaDone, (void*)1, NULL };
+    transfers[1] = (DmaTransfer_T){ (uint32_t)source + 1U, (uint32_t)target[1] + 3U, 0, 37, 1, 0, 0, HostTestDmaDone, (void*)2, NULL };
+    transfers[2] = (DmaTransfer_T){ (uint32_t)source, (uint32_t)target[2], 0, 50, 2, 0, 0, HostTestDmaDone, (void*)3, NULL };
+
+    /* Submitted with interrupts masked, so the last two wait in the queue */
+    dmaTestEvents = 0;
+    __disable_irq();
+    for (i = 0; i < 3U; i++)
+    {
+        HOST_CHECK(DmaSubmit(stream, &transfers[i]) == SUCCESS);
+    }
+    HOST_CHECK(DmaBusy(stream) != 0);
+    HOST_CHECK(stream->head == &transfers[1]);
+    __enable_irq();
+
+    HOST_CHECK(dmaTestEvents == 3U);
+    HOST_CHECK((dmaTestOrder[0] == 1U) && (dmaTestOrder[1] == 2U) && (dmaTestOrder[2] == 3U));
+    HOST_CHECK(DmaBusy(stream) == 0);
+    for (i = 0; i < 64U; i++)
+    {
+        HOST_CHECK(target[0][i] == source[i]);
+    }
+    for (i = 0; i < 37U; i++)
+    {
+        HOST_CHECK(bytes[256U + 3U + i] == ((const uint8_t*)source)[1U + i]);
+    }
+    HOST_CHECK((bytes[256U + 2U] == 0) && (bytes[256U + 3U + 37U] == 0));
+    for (i = 0; i < 50U; i++)
+    {
+        HOST_CHECK(((const uint16_t*)target[2])[i] == ((const uint16_t*)source)[i]);
+    }
+
+    /* Stop aborts the running transfer and drops the queued one */
+    dmaTestEvents = 0;
+    __disable_irq();
+    transfers[0].count = 1;
+    HOST_CHECK(DmaSubmit(stream, &transfers[0]) == SUCCESS);
+    HOST_CHECK(DmaSubmit(stream, &transfers[1]) == SUCCESS);
+    DmaStop(stream);
+    __enable_irq();
+    HOST_CHECK(dmaTestEvents == 2U);
+    HOST_CHECK(DmaBusy(stream) == 0);
+
+    HOST_CHECK(DmaSubmit(stream, &(DmaTransfer_T){ .count = 0, .size = 4 }) == ERROR);
+    HOST_CHECK(DmaSubmit(stream, &(DmaTransfer_T){ .count = 1, .size = 3 }) == ERROR);
+    HOST_CHECK(DmaSubmit(stream, &(DmaTransfer_T){ .count = 1, .size = 4, .flags = DMA_XFER_DOUBLE }) == ERROR);
+    DmaRelease(stream);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       DMA manager on the simulated controllers: the FIFO and burst
+ *              choice, the routing table, and queueing.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestDma(void)
+{
+    HOST_CHECK(HostTestDmaFifo() == SUCCESS);
+    HOST_CHECK(HostTestDmaRouting() == SUCCESS);
+    HOST_CHECK(HostTestDmaQueue() == SUCCESS);
+
+    return SUCCESS;
+}
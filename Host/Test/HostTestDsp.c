@@ -0,0 +1,298 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Crc.h"
+#include "Dsp.h"
+
+/* CRC-32 of the 256-point Q15 FFT of HostTestDspFill() samples, forward */
+#define DSP_FFT_Q15_KAT     0x7A9D3E1CU
+
+#define DSP_TEST_TAPS       15U
+#define DSP_TEST_BLOCK      24U
+
+/* Lowpass, fc = fs / 10, Q14 (postShift 1): {b0, 0, b1, b2, a1, a2} twice */
+static const int16_t dspTestBiquad[12] __attribute__((aligned(4))) =
+{
+    1106, 0, 2212, 1106, 18727, -6763,
+    1106, 0, 2212, 1106, 18727, -6763,
+};
+
+static int16_t dspTestInput[64];
+static int16_t dspTestCoeffs[DSP_TEST_TAPS];
+static int16_t dspTestState[DSP_FIR_STATE(DSP_TEST_TAPS, DSP_TEST_BLOCK)] __attribute__((aligned(4)));
+
+/* Deterministic full-scale samples */
+static void HostTestDspFill(int16_t* samples, uint32_t count, uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        samples[i] = (int16_t)(seed >> 16);
+    }
+}
+
+static int32_t HostTestDspSat16(int64_t value)
+{
+    return (value > 32767) ? 32767 : ((value < -32768) ? -32768 : (int32_t)value);
+}
+
+/* Scalar FIR model: y[n] = sum h[k] x[n - k], x[n < 0] = 0 */
+static int16_t HostTestDspFirModel(const int16_t* x, uint32_t n, const int16_t* h, uint32_t taps)
+{
+    int64_t acc = 0;
+    uint32_t k;
+
+    for (k = 0; (k < taps) && (k <= n); k++)
+    {
+        acc += (int32_t)h[k] * x[n - k];
+    }
+
+    return (int16_t)HostTestDspSat16(acc >> 15);
+}
+
+/* Cos and sin of 2*pi*m/length from the float twiddle table */
+static void HostTestDspTwiddle(uint32_t m, uint32_t length, float* c, float* s)
+{
+    uint32_t stride = DSP_FFT_MAX / length;
+
+    /* The table stops at 3/4 turn: the last quarter mirrors the first */
+    if (4U * m >= 3U * length)
+    {
+        *c = dspTwiddleF32[2U * (length - m) * stride];
+        *s = -dspTwiddleF32[2U * (length - m) * stride + 1U];
+    }
+    else
+    {
+        *c = dspTwiddleF32[2U * m * stride];
+        *s = dspTwiddleF32[2U * m * stride + 1U];
+    }
+}
+
+static float HostTestDspAbs(float value)
+{
+    return (value < 0) ? -value : value;
+}
+
+/* FIR in blocks of 20, 20 and 24: state carried across calls, bit-exact */
+static uint8_t HostTestDspFir(void)
+{
+    int16_t output[64];
+    DspFirQ15_T fir;
+    uint32_t n;
+
+    HOST_CHECK(DspFirQ15Init(&fir, dspTestCoeffs, DSP_TEST_TAPS, dspTestState, DSP_TEST_BLOCK) == SUCCESS);
+    DspFirQ15(&fir, dspTestInput, output, 20);
+    DspFirQ15(&fir, dspTestInput + 20, output + 20, 20);
+    DspFirQ15(&fir, dspTestInput + 40, output + 40, 24);
+    for (n = 0; n < 64U; n++)
+    {
+        HOST_CHECK(output[n] == HostTestDspFirModel(dspTestInput, n, dspTestCoeffs, DSP_TEST_TAPS));
+    }
+
+    return SUCCESS;
+}
+
+/* Decimation by 4 keeps FIR outputs 3, 7, 11, ... */
+static uint8_t HostTestDspDecimate(void)
+{
+    int16_t output[16];
+    DspFirQ15_T fir;
+    uint32_t i, k;
+
+    HOST_CHECK(DspDecimateQ15Init(&fir, dspTestCoeffs, DSP_TEST_TAPS, 4, dspTestState, DSP_TEST_BLOCK) == SUCCESS);
+    k = DspDecimateQ15(&fir, dspTestInput, output, 24);
+    k += DspDecimateQ15(&fir, dspTestInput + 24, output + k, 24);
+    k += DspDecimateQ15(&fir, dspTestInput + 48, output + k, 16);
+    HOST_CHECK(k == 16U);
+    for (i = 0; i < 16U; i++)
+    {
+        HOST_CHECK(output[i] == HostTestDspFirModel(dspTestInput, 4U * i + 3U, dspTestCoeffs, DSP_TEST_TAPS));
+    }
+
+    return SUCCESS;
+}
+
+/* Biquad cascade in two calls, against direct form I per stage */
+static uint8_t HostTestDspBiquad(void)
+{
+    int16_t output[64];
+    int16_t expect[64];
+    DspBiquadQ15_T biquad;
+    uint32_t k, n;
+    int64_t sum;
+
+    HOST_CHECK(DspBiquadQ15Init(&biquad, dspTestBiquad, 2, 1, dspTestState) == SUCCESS);
+    DspBiquadQ15(&biquad, dspTestInput, output, 40);
+    DspBiquadQ15(&biquad, dspTestInput + 40, output + 40, 24);
+
+    memcpy(expect, dspTestInput, sizeof(expect));
+    for (k = 0; k < 2U; k++)
+    {
+        const int16_t* b = dspTestBiquad + 6U * k;
+        int32_t x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+        for (n = 0; n < 64U; n++)
+        {
+            int32_t x0 = expect[n];
+
+            sum = (int64_t)b[0] * x0 + (int64_t)b[2] * x1 + (int64_t)b[3] * x2 +
+                  (int64_t)b[4] * y1 + (int64_t)b[5] * y2;
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = HostTestDspSat16(sum >> 14);
+            expect[n] = (int16_t)y1;
+        }
+    }
+    HOST_CHECK(memcmp(output, expect, sizeof(expect)) == 0);
+
+    return SUCCESS;
+}
+
+/* RMS is the largest root whose square fits the mean; peak saturates -32768 */
+static uint8_t HostTestDspLevel(void)
+{
+    int16_t input[64];
+    uint32_t mean, root, n, peakIndex;
+    int64_t sum = 0;
+
+    memcpy(input, dspTestInput, sizeof(input));
+
+    /* Odd count: the paired loop has a tail */
+    root = (uint32_t)DspRmsQ15(input, 63);
+    for (n = 0; n < 63U; n++)
+    {
+        sum += (int32_t)input[n] * input[n];
+    }
+    mean = (uint32_t)(sum / 63);
+    HOST_CHECK(root * root <= mean);
+    HOST_CHECK((root + 1U) * (root + 1U) > mean);
+
+    input[17] = -32768;
+    HOST_CHECK(DspPeakQ15(input, 64, &peakIndex) == 32767);
+    HOST_CHECK(peakIndex == 17U);
+    HOST_CHECK(DspPeakQ15(input, 17, NULL) == DspPeakQ15(input, 17, &peakIndex));
+
+    return SUCCESS;
+}
+
+/* Q15 FFT: bit-exact against the recorded result, and a tone */
+static uint8_t HostTestDspFftQ15(void)
+{
+    static int16_t fftQ15[2 * 256] __attribute__((aligned(4)));
+    DspFft_T fft;
+    uint32_t k, n;
+    float c, s;
+
+    HostTestDspFill(fftQ15, 2 * 256, 3);
+    HOST_CHECK(DspFftInit(&fft, 256, 0) == SUCCESS);
+    DspFftQ15(&fft, fftQ15);
+    HOST_CHECK(CrcCompute(&crcCrc32, fftQ15, sizeof(fftQ15)) == DSP_FFT_Q15_KAT);
+
+    /* A cosine of amplitude 0.5 in bin 5 of 64: 0.25 in bins 5 and 59 */
+    HOST_CHECK(DspFftInit(&fft, 64, 0) == SUCCESS);
+    for (n = 0; n < 64U; n++)
+    {
+        HostTestDspTwiddle((5U * n) % 64U, 64, &c, &s);
+        fftQ15[2U * n] = (int16_t)(c * 16384.0f);
+        fftQ15[2U * n + 1U] = 0;
+    }
+    DspFftQ15(&fft, fftQ15);
+    for (k = 0; k < 64U; k++)
+    {
+        int32_t re = fftQ15[2U * k] - (((k == 5U) || (k == 59U)) ? 8192 : 0);
+        int32_t im = fftQ15[2U * k + 1U];
+
+        HOST_CHECK((re >= -8) && (re <= 8));
+        HOST_CHECK((im >= -8) && (im <= 8));
+    }
+
+    return SUCCESS;
+}
+
+/* Float FFT against a direct DFT, then the inverse back to the input */
+static uint8_t HostTestDspFftF32(void)
+{
+    static float fftF32[2 * 64];
+    static float dft[2 * 64];
+    DspFft_T fft;
+    uint32_t k, n;
+    float c, s, error;
+
+    for (n = 0; n < 2U * 64U; n++)
+    {
+        fftF32[n] = (float)dspTestInput[n % 64U] / 32768.0f;
+    }
+    for (k = 0; k < 64U; k++)
+    {
+        float re = 0, im = 0;
+
+        for (n = 0; n < 64U; n++)
+        {
+            HostTestDspTwiddle((k * n) % 64U, 64, &c, &s);
+            re += fftF32[2U * n] * c + fftF32[2U * n + 1U] * s;
+            im += fftF32[2U * n + 1U] * c - fftF32[2U * n] * s;
+        }
+        dft[2U * k] = re;
+        dft[2U * k + 1U] = im;
+    }
+
+    HOST_CHECK(DspFftInit(&fft, 64, 0) == SUCCESS);
+    DspFftF32(&fft, fftF32);
+    error = 0;
+    for (n = 0; n < 2U * 64U; n++)
+    {
+        float e = HostTestDspAbs(fftF32[n] - dft[n]);
+
+        error = (e > error) ? e : error;
+    }
+    HOST_CHECK(error < 1.0e-3f);
+
+    HOST_CHECK(DspFftInit(&fft, 64, 1) == SUCCESS);
+    DspFftF32(&fft, fftF32);
+    error = 0;
+    for (n = 0; n < 2U * 64U; n++)
+    {
+        float e = HostTestDspAbs(fftF32[n] - (float)dspTestInput[n % 64U] / 32768.0f);
+
+        error = (e > error) ? e : error;
+    }
+    HOST_CHECK(error < 1.0e-5f);
+
+    /* Radix-4 only: 128 points cannot be done */
+    HOST_CHECK(DspFftInit(&fft, 128, 0) == ERROR);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       DSP kernels on the C versions of the DSP instructions: FIR,
+ *              decimator, biquad, RMS and peak against scalar models, the
+ *              Q15 FFT against its recorded checksum and a tone, the float
+ *              FFT against a direct DFT and its inverse.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestDsp(void)
+{
+    uint32_t i;
+
+    HostTestDspFill(dspTestInput, 64, 1);
+    HostTestDspFill(dspTestCoeffs, DSP_TEST_TAPS, 2);
+    for (i = 0; i < DSP_TEST_TAPS; i++)
+    {
+        dspTestCoeffs[i] >>= 2;
+    }
+
+    HOST_CHECK(HostTestDspFir() == SUCCESS);
+    HOST_CHECK(HostTestDspDecimate() == SUCCESS);
+    HOST_CHECK(HostTestDspBiquad() == SUCCESS);
+    HOST_CHECK(HostTestDspLevel() == SUCCESS);
+    HOST_CHECK(HostTestDspFftQ15() == SUCCESS);
+    HOST_CHECK(HostTestDspFftF32() == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,197 @@
+#include <string.h>
+#include "apm32f4xx_eth.h"
+#include "HostSim.h"
+#include "HostTest.h"
+#include "EthBuf.h"
+
+#define ETH_TEST_FRAME_LEN  100U
+#define ETH_TEST_SENT_MAX   16U
+
+static uint32_t ethBatches[8];
+static uint32_t ethBatchCount;
+
+static uint8_t ethSent[ETH_TEST_SENT_MAX][ETH_TEST_FRAME_LEN];
+static uint32_t ethSentLen[ETH_TEST_SENT_MAX];
+static uint32_t ethSentCount;
+
+static uint32_t ethReleased;
+
+static void HostTestEthRx(uint32_t frames)
+{
+    if (ethBatchCount < 8U)
+    {
+        ethBatches[ethBatchCount] = frames;
+    }
+    ethBatchCount++;
+}
+
+static void HostTestEthSink(const uint8_t* frame, uint32_t len)
+{
+    if (ethSentCount < ETH_TEST_SENT_MAX)
+    {
+        memcpy(ethSent[ethSentCount], frame, (len < ETH_TEST_FRAME_LEN) ? len : ETH_TEST_FRAME_LEN);
+        ethSentLen[ethSentCount] = len;
+    }
+    ethSentCount++;
+}
+
+static void HostTestEthRelease(EthBuf_T* buf)
+{
+    (void)buf;
+
+    ethReleased++;
+}
+
+/* Broadcast frame of a local experimental EtherType, numbered by seq */
+static void HostTestEthFrame(uint8_t* frame, uint32_t len, uint8_t seq)
+{
+    uint32_t i;
+
+    memset(frame, 0xFF, 6);
+    memcpy(&frame[6], "\x02\x00\x00\x00\x00\x01", 6);
+    frame[12] = 0x88;
+    frame[13] = 0xB5;
+    for (i = 14; i < len; i++)
+    {
+        frame[i] = (uint8_t)(seq + i);
+    }
+}
+
+/* The received frame is one segment holding the injected bytes */
+static uint8_t HostTestEthSame(const EthBuf_T* buf, const uint8_t* frame, uint32_t len)
+{
+    return (buf != NULL) && (buf->next == NULL) && (buf->totLen == len) && (buf->len == len) &&
+           (memcmp(buf->payload, frame, len) == 0);
+}
+
+/*!
+ * @brief       Ethernet buffers on the ETH DMA model: receive, batching
+ *              of the receive interrupt, pool starvation and recovery,
+ *              gathered transmit and transmit descriptor exhaustion.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestEth(void)
+{
+    static uint8_t frame[ETH_TEST_FRAME_LEN];
+    static uint8_t payload[ETH_TEST_FRAME_LEN - 14U];
+    EthBuf_T* held[ETHBUF_POOL_SIZE];
+    EthBufStats_T stats;
+    EthBuf_T ref;
+    EthBuf_T* buf;
+    uint32_t i;
+
+    HostEthSetSink(HostTestEthSink);
+    EthBufInit();
+    EthBufSetRxCallback(HostTestEthRx);
+    ETH_Start();
+
+    /* One frame, handed over from the interrupt */
+    HostTestEthFrame(frame, sizeof(frame), 0);
+    HOST_CHECK(HostEthInject(frame, sizeof(frame)) == 1U);
+    HOST_CHECK((ethBatchCount == 1U) && (ethBatches[0] == 1U));
+    buf = EthBufReceive();
+    HOST_CHECK(HostTestEthSame(buf, frame, sizeof(frame)));
+    HOST_CHECK(EthBufReceive() == NULL);
+    EthBufFree(buf);
+
+    /* Six frames behind a masked interrupt: a full batch, re-pended, then the rest */
+    __disable_irq();
+    for (i = 1; i <= 6U; i++)
+    {
+        HostTestEthFrame(frame, sizeof(frame), (uint8_t)i);
+        HOST_CHECK(HostEthInject(frame, sizeof(frame)) == 1U);
+    }
+    HOST_CHECK(ethBatchCount == 1U);
+    __enable_irq();
+    HOST_CHECK(ethBatchCount == 3U);
+    HOST_CHECK((ethBatches[1] == ETHBUF_RX_BATCH) && (ethBatches[2] == 6U - ETHBUF_RX_BATCH));
+    for (i = 1; i <= 6U; i++)
+    {
+        buf = EthBufReceive();
+        HostTestEthFrame(frame, sizeof(frame), (uint8_t)i);
+        HOST_CHECK(HostTestEthSame(buf, frame, sizeof(frame)));
+        EthBufFree(buf);
+    }
+    EthBufStats(&stats);
+    HOST_CHECK((stats.rxFrames == 7U) && (stats.rxBatches == 3U) && (stats.rxStarved == 0));
+
+    /* Hold every received frame: the pool runs dry, then the ring */
+    for (i = 0; i < ETHBUF_POOL_SIZE; i++)
+    {
+        HostTestEthFrame(frame, sizeof(frame), (uint8_t)(0x40U + i));
+        HOST_CHECK(HostEthInject(frame, sizeof(frame)) == 1U);
+        held[i] = EthBufReceive();
+        HOST_CHECK(held[i] != NULL);
+    }
+    HostTestEthFrame(frame, sizeof(frame), 0x80);
+    HOST_CHECK(HostEthInject(frame, sizeof(frame)) == 0);
+    EthBufStats(&stats);
+    HOST_CHECK((stats.rxStarved != 0) && (stats.poolLow == 0));
+    HOST_CHECK(ETH_ReadBufferUnavailableMissedFrameCounter() == 1U);
+
+    /* A freed buffer re-arms the ring and resumes reception */
+    EthBufFree(held[0]);
+    HOST_CHECK(HostEthInject(frame, sizeof(frame)) == 1U);
+    held[0] = EthBufReceive();
+    HOST_CHECK(HostTestEthSame(held[0], frame, sizeof(frame)));
+    for (i = 0; i < ETHBUF_POOL_SIZE; i++)
+    {
+        EthBufFree(held[i]);
+    }
+
+    /* Gathered transmit: pool header plus caller memory, released on completion */
+    HostTestEthFrame(frame, sizeof(frame), 0x20);
+    memcpy(payload, &frame[14], sizeof(payload));
+    buf = EthBufAlloc(14);
+    HOST_CHECK(buf != NULL);
+    memcpy(buf->payload, frame, 14);
+    EthBufInitRef(&ref, payload, sizeof(payload), HostTestEthRelease);
+    EthBufChain(buf, &ref);
+    HOST_CHECK(buf->totLen == sizeof(frame));
+    HOST_CHECK(EthBufTransmit(buf) == ETH_SUCCESS);
+    HOST_CHECK((ethSentCount == 1U) && (ethSentLen[0] == sizeof(frame)));
+    HOST_CHECK(memcmp(ethSent[0], frame, sizeof(frame)) == 0);
+    HOST_CHECK(ethReleased == 1U);
+
+    /* Transmit DMA stopped: the descriptors fill up, then drain on restart */
+    ETH_DisableDMATransmission();
+    for (i = 0; i < ETHBUF_TX_DESC; i++)
+    {
+        buf = EthBufAlloc(ETH_TEST_FRAME_LEN);
+        HOST_CHECK(buf != NULL);
+        HostTestEthFrame(buf->payload, ETH_TEST_FRAME_LEN, (uint8_t)(0x60U + i));
+        HOST_CHECK(EthBufTransmit(buf) == ETH_SUCCESS);
+    }
+    EthBufInitRef(&ref, frame, sizeof(frame), HostTestEthRelease);
+    HOST_CHECK(EthBufTransmit(&ref) == ETH_ERROR);
+    HOST_CHECK((ethSentCount == 1U) && (ethReleased == 1U));
+    ETH_EnableDMATransmission();
+    HOST_CHECK(ethSentCount == 1U + ETHBUF_TX_DESC);
+    for (i = 0; i < ETHBUF_TX_DESC; i++)
+    {
+        HostTestEthFrame(frame, sizeof(frame), (uint8_t)(0x60U + i));
+        HOST_CHECK(memcmp(ethSent[1U + i], frame, sizeof(frame)) == 0);
+    }
+
+    EthBufStats(&stats);
+    HOST_CHECK((stats.txFrames == 1U + ETHBUF_TX_DESC) && (stats.txBusy == 1U) && (stats.txErrors == 0));
+
+    /* Every buffer is back: the pool can hand out all of its free ones */
+    for (i = 0; i < ETHBUF_POOL_SIZE - ETHBUF_RX_DESC; i++)
+    {
+        held[i] = EthBufAlloc(1);
+        HOST_CHECK(held[i] != NULL);
+    }
+    HOST_CHECK(EthBufAlloc(1) == NULL);
+    for (i = 0; i < ETHBUF_POOL_SIZE - ETHBUF_RX_DESC; i++)
+    {
+        EthBufFree(held[i]);
+    }
+
+    HostEthSetSink(NULL);
+
+    return SUCCESS;
+}
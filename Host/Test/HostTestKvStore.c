@@ -0,0 +1,230 @@
+#include <string.h>
+#include "HostTest.h"
+#include "KvStore.h"
+
+#define KV_TEST_SECTOR      1024U
+#define KV_TEST_SECTORS     4U
+#define KV_TEST_KEYS        8U
+
+/* Nearly full: 24 keys of up to 280 bytes on three 2 KB sectors */
+#define KV_FULL_SECTOR      2048U
+#define KV_FULL_SECTORS     3U
+#define KV_FULL_KEYS        24U
+#define KV_FULL_SPAN        281U
+
+#define KV_TEST_VALUE_MAX   (KV_FULL_SPAN - 1U)
+
+static uint32_t kvTestFlash[KV_FULL_SECTORS * KV_FULL_SECTOR / 4U];
+static KvFlashSim_T kvTestSim;
+static KvStore_T kvTest;
+static int32_t kvTestVersion[KV_FULL_KEYS];     /* -1: deleted */
+static uint32_t kvTestKeys;
+static uint32_t kvTestSpan;                     /* Value lengths 0 .. span - 1 */
+
+static const char* HostTestKvStoreKey(uint32_t key)
+{
+    static char name[4] = "k??";
+
+    name[1] = (char)('a' + key / 10U);
+    name[2] = (char)('0' + key % 10U);
+
+    return name;
+}
+
+/* Value of a key at a version; returns its length */
+static uint32_t HostTestKvStoreValue(uint32_t key, int32_t version, uint8_t* value)
+{
+    uint32_t length = (key * 11U + (uint32_t)version * 7U) % kvTestSpan;
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        value[i] = (uint8_t)(key * 31U + (uint32_t)version * 17U + i);
+    }
+
+    return length;
+}
+
+/* Does the store hold a key at a version? */
+static uint8_t HostTestKvStoreHas(uint32_t key, int32_t version)
+{
+    uint8_t expect[KV_TEST_VALUE_MAX], value[KV_TEST_VALUE_MAX];
+    uint32_t length = 0xFFFFFFFFU;
+    uint8_t status = KvStoreGet(&kvTest, HostTestKvStoreKey(key), value, sizeof(value), &length);
+
+    if (version < 0)
+    {
+        return (status == ERROR) && (length == 0xFFFFFFFFU);
+    }
+
+    return (status == SUCCESS) && (length == HostTestKvStoreValue(key, version, expect)) &&
+           (memcmp(value, expect, length) == 0);
+}
+
+/* Every key at its expected version */
+static uint8_t HostTestKvStoreCheck(void)
+{
+    uint32_t key;
+
+    for (key = 0; key < kvTestKeys; key++)
+    {
+        HOST_CHECK(HostTestKvStoreHas(key, kvTestVersion[key]));
+    }
+
+    return SUCCESS;
+}
+
+/* Store a key at a version, or delete it (-1) */
+static uint8_t HostTestKvStoreUpdate(uint32_t key, int32_t version)
+{
+    uint8_t value[KV_TEST_VALUE_MAX];
+
+    if (version < 0)
+    {
+        return KvStoreDelete(&kvTest, HostTestKvStoreKey(key));
+    }
+
+    return KvStoreSet(&kvTest, HostTestKvStoreKey(key), value, HostTestKvStoreValue(key, version, value));
+}
+
+/* Blank flash of the given shape, mounted */
+static uint8_t HostTestKvStoreFormat(uint32_t sectorSize, uint32_t sectors, uint32_t keys, uint32_t span)
+{
+    uint32_t key;
+
+    kvTestKeys = keys;
+    kvTestSpan = span;
+    for (key = 0; key < keys; key++)
+    {
+        kvTestVersion[key] = -1;
+    }
+    KvFlashSimInit(&kvTestSim, (uint8_t*)kvTestFlash, sectorSize, sectors);
+    HOST_CHECK(KvStoreInit(&kvTest, &kvTestSim.flash) == SUCCESS);
+    HOST_CHECK(kvTestSim.flash.erases == 0);
+
+    return SUCCESS;
+}
+
+/* Set, delete, remount; the same value again programs nothing */
+static uint8_t HostTestKvStoreBasic(void)
+{
+    uint32_t key, programs;
+
+    for (key = 0; key < KV_TEST_KEYS; key++)
+    {
+        kvTestVersion[key] = (int32_t)key;
+        HOST_CHECK(HostTestKvStoreUpdate(key, kvTestVersion[key]) == SUCCESS);
+    }
+    kvTestVersion[3] = -1;
+    HOST_CHECK(HostTestKvStoreUpdate(3, -1) == SUCCESS);
+    HOST_CHECK(HostTestKvStoreUpdate(3, -1) == SUCCESS);
+    HOST_CHECK(HostTestKvStoreCheck() == SUCCESS);
+    HOST_CHECK(KvStoreInit(&kvTest, &kvTestSim.flash) == SUCCESS);
+    HOST_CHECK(HostTestKvStoreCheck() == SUCCESS);
+    HOST_CHECK(kvTest.keys == KV_TEST_KEYS - 1U);
+
+    programs = kvTestSim.flash.programs;
+    HOST_CHECK(HostTestKvStoreUpdate(5, kvTestVersion[5]) == SUCCESS);
+    HOST_CHECK(kvTestSim.flash.programs == programs);
+
+    return SUCCESS;
+}
+
+/* Churn: compaction in the background and when the head fills; even wear */
+static uint8_t HostTestKvStoreChurn(void)
+{
+    uint32_t i, key, least, most;
+    int32_t next;
+
+    for (i = 0; i < 1000U; i++)
+    {
+        key = (i * 5U) % KV_TEST_KEYS;
+        next = ((i % 7U) == 3U) ? -1 : (int32_t)i;
+        HOST_CHECK(HostTestKvStoreUpdate(key, next) == SUCCESS);
+        kvTestVersion[key] = next;
+        if ((i % 3U) == 0)
+        {
+            (void)KvStorePoll(&kvTest);
+        }
+    }
+    HOST_CHECK(HostTestKvStoreCheck() == SUCCESS);
+    HOST_CHECK(kvTest.compactions != 0);
+    HOST_CHECK(KvStoreInit(&kvTest, &kvTestSim.flash) == SUCCESS);
+    HOST_CHECK(HostTestKvStoreCheck() == SUCCESS);
+
+    /* Every sector in turn */
+    least = kvTest.erases[0];
+    most = kvTest.erases[0];
+    for (i = 1; i < KV_TEST_SECTORS; i++)
+    {
+        least = (kvTest.erases[i] < least) ? kvTest.erases[i] : least;
+        most = (kvTest.erases[i] > most) ? kvTest.erases[i] : most;
+    }
+    HOST_CHECK(least != 0);
+    HOST_CHECK(most - least <= 1U);
+
+    return SUCCESS;
+}
+
+/*
+ * Power cuts during writes and compaction, every third time during
+ * recovery too: after each, the store mounts and every key holds its value
+ * from before or after the interrupted call.
+ */
+static uint8_t HostTestKvStorePowerCuts(uint32_t count, uint32_t seed, uint32_t span)
+{
+    uint32_t i, key;
+    int32_t next;
+
+    for (i = 0; i < count; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        key = (seed >> 8) % kvTestKeys;
+        next = (((seed >> 16) % 6U) == 0) ? -1 : (int32_t)(1000U + i);
+
+        KvFlashSimCut(&kvTestSim, 1U + (seed >> 20) % span, seed | 1U);
+        (void)HostTestKvStoreUpdate(key, next);
+        while (!kvTestSim.off && KvStorePoll(&kvTest))
+        {
+        }
+        KvFlashSimRestore(&kvTestSim);
+
+        if ((i % 3U) == 0)
+        {
+            KvFlashSimCut(&kvTestSim, 1U + i % 7U, seed);
+            (void)KvStoreInit(&kvTest, &kvTestSim.flash);
+            KvFlashSimRestore(&kvTestSim);
+        }
+
+        HOST_CHECK(KvStoreInit(&kvTest, &kvTestSim.flash) == SUCCESS);
+        if (HostTestKvStoreHas(key, next))
+        {
+            kvTestVersion[key] = next;
+        }
+        HOST_CHECK(HostTestKvStoreCheck() == SUCCESS);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Key-value store on the RAM flash: remounting, compaction,
+ *              wear levelling, and power cuts at chosen programs and
+ *              erases, also on a nearly full store.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestKvStore(void)
+{
+    HOST_CHECK(HostTestKvStoreFormat(KV_TEST_SECTOR, KV_TEST_SECTORS, KV_TEST_KEYS, 48U) == SUCCESS);
+    HOST_CHECK(HostTestKvStoreBasic() == SUCCESS);
+    HOST_CHECK(HostTestKvStoreChurn() == SUCCESS);
+    HOST_CHECK(HostTestKvStorePowerCuts(400, 1, 96) == SUCCESS);
+
+    HOST_CHECK(HostTestKvStoreFormat(KV_FULL_SECTOR, KV_FULL_SECTORS, KV_FULL_KEYS, KV_FULL_SPAN) == SUCCESS);
+    HOST_CHECK(HostTestKvStorePowerCuts(2000, 1, 400) == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,111 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "Debug.h"
+#include "Log.h"
+#include "LogDecode.h"
+
+static uint8_t logOut[1024];
+static uint32_t logOutCount;
+
+static void HostTestLogSink(USART_T* usart, uint8_t data)
+{
+    if ((usart == USART1) && (logOutCount < sizeof(logOut)))
+    {
+        logOut[logOutCount++] = data;
+    }
+}
+
+static void HostTestLogText(const char* text, uint32_t len)
+{
+    DebugWrite(text, (int)len);
+}
+
+/* Little-endian word at p */
+static uint32_t HostTestLogWord(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!
+ * @brief       Binary log frames: the frame layout LogWrite() emits, and
+ *              Tools/logdecode recovering every frame from a capture that
+ *              mixes them with plain text, with bytes that look like a
+ *              frame start, and with a frame cut short. The decoder reads
+ *              the format strings from this executable's .logstr.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestLog(void)
+{
+    static const char expect[] =
+        "boot\r\n"
+        "[INF] x=-5 y=7\n"
+        "\xA5\x31not a frame\r\n"
+        "[ERR] all 1 2 3 4 5 6 7 8\n"
+        "\xA5"
+        "[WRN] f=1.50 s=flash\n"
+        "\xA5\x10\x01\x02tail\r\n"
+        "[DBG] level 4, no args\n"
+        "\xA5\x30";
+    const uint8_t* frame;
+    char* text;
+    size_t textLen;
+    FILE* out;
+    uint32_t mark;
+
+    HostUsartSetSink(HostTestLogSink);
+    DebugInit();
+
+    HostTestLogText("boot\r\n", 6);
+
+    /* SYNC, (level << 4) | nargs, id, arguments */
+    mark = logOutCount;
+    LOG_INF("x=%d y=%u", -5, 7);
+    frame = &logOut[mark];
+    HOST_CHECK(logOutCount - mark == 2U + 4U * 3U);
+    HOST_CHECK((frame[0] == LOG_FRAME_SYNC) && (frame[1] == ((LOG_LEVEL_INF << 4) | 2U)));
+    HOST_CHECK(strcmp((const char*)(uintptr_t)HostTestLogWord(&frame[2]), "x=%d y=%u") == 0);
+    HOST_CHECK((HostTestLogWord(&frame[6]) == (uint32_t)-5) && (HostTestLogWord(&frame[10]) == 7U));
+
+    /* A plausible header whose id is not a format string */
+    HostTestLogText("\xA5\x31not a frame\r\n", 15);
+
+    mark = logOutCount;
+    LOG_ERR("all %u %u %u %u %u %u %u %u", 1, 2, 3, 4, 5, 6, 7, 8);
+    HOST_CHECK(logOutCount - mark == 2U + 4U * 9U);
+    HOST_CHECK(logOut[mark + 1U] == ((LOG_LEVEL_ERR << 4) | 8U));
+
+    /* A lone sync byte right before a frame */
+    HostTestLogText("\xA5", 1);
+    LOG_WRN("f=%.2f s=%s\n", LOG_FLOAT(1.5f), "flash");
+
+    /* A frame cut after four bytes, then text */
+    HostTestLogText("\xA5\x10\x01\x02tail\r\n", 10);
+    LOG_AT(LOG_LEVEL_DBG, "level 4, no args");
+    HOST_CHECK((logOut[logOutCount - 6U] == LOG_FRAME_SYNC) && (logOut[logOutCount - 5U] == (LOG_LEVEL_DBG << 4)));
+
+    /* The capture ends inside a frame */
+    HostTestLogText("\xA5\x30", 2);
+
+    HOST_CHECK(LogDecodeLoadElf("/proc/self/exe") == 0);
+    out = open_memstream(&text, &textLen);
+    HOST_CHECK(out != NULL);
+    LogDecodeFeed(out, logOut, logOutCount);
+    LogDecodeFlush(out);
+    fclose(out);
+    LogDecodeFree();
+
+    HOST_CHECK(textLen == sizeof(expect) - 1U);
+    HOST_CHECK(memcmp(text, expect, textLen) == 0);
+    free(text);
+
+    HostUsartSetSink(NULL);
+
+    return SUCCESS;
+}
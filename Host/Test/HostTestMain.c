@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+
+static const HostTestCase_T hostTests[] =
+{
+    { "sim",                HostTestSim },
+    { "debug_tx",           HostTestDebug },
+    { "eth_buf",            HostTestEth },
+    { "udp_csum",           HostTestUdp },
+    { "can_bus",            HostTestCan },
+    { "aes",                HostTestAes },
+    { "aes_aead",           HostTestAesAead },
+    { "digest",             HostTestDigest },
+    { "sha256",             HostTestSha256 },
+    { "crc",                HostTestCrc },
+    { "dma",                HostTestDma },
+    { "adc_triple",         HostTestAdcTriple },
+    { "dsp",                HostTestDsp },
+    { "adc_oversample",     HostTestAdcOversample },
+    { "spi_bus",            HostTestSpiBus },
+    { "spi_nor",            HostTestSpiNor },
+    { "sd_card",            HostTestSdCard },
+    { "block_cache",        HostTestBlockCache },
+    { "kv_store",           HostTestKvStore },
+    { "log",                HostTestLog },
+    { "profile",            HostTestProfile },
+    { "pingpong",           HostTestPingPong },
+};
+
+#define HOST_TEST_COUNT (sizeof(hostTests) / sizeof(hostTests[0]))
+
+/*!
+ * @brief       Report a failed check of the running case.
+ *
+ * @param       file:       Source file of the check
+ *
+ * @param       line:       Line of the check
+ *
+ * @param       condition:  Condition that did not hold
+ *
+ * @retval      None
+ */
+void HostTestFail(const char* file, int line, const char* condition)
+{
+    fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+}
+
+/*!
+ * @brief       Compare bytes with a hex string.
+ *
+ * @param       data:  Bytes, as many as the string has digit pairs
+ *
+ * @param       hex:   Lower- or upper-case hex digits
+ *
+ * @retval      1 when they are equal
+ */
+uint8_t HostTestHexEqual(const uint8_t* data, const char* hex)
+{
+    unsigned int value;
+
+    for (; (hex[0] != 0) && (hex[1] != 0); hex += 2, data++)
+    {
+        if ((sscanf(hex, "%2x", &value) != 1) || (*data != value))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*!
+ * @brief       Runs the case named on the command line, or lists the cases.
+ *
+ * @param       argc:   Argument count
+ *
+ * @param       argv:   argv[1]: case name
+ *
+ * @retval      0 when the case passed
+ */
+int main(int argc, char* argv[])
+{
+    uint32_t i;
+
+    if (argc != 2)
+    {
+        for (i = 0; i < HOST_TEST_COUNT; i++)
+        {
+            printf("%s\n", hostTests[i].name);
+        }
+        return (argc == 1) ? 0 : 2;
+    }
+
+    for (i = 0; i < HOST_TEST_COUNT; i++)
+    {
+        if (strcmp(argv[1], hostTests[i].name) == 0)
+        {
+            HostSimInit();
+            SystemInit();
+
+            if (hostTests[i].run() != SUCCESS)
+            {
+                fprintf(stderr, "%s: FAILED\n", hostTests[i].name);
+                return 1;
+            }
+            printf("%s: passed\n", hostTests[i].name);
+            return 0;
+        }
+    }
+
+    fprintf(stderr, "unknown test case: %s\n", argv[1]);
+    return 2;
+}
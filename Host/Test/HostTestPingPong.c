@@ -0,0 +1,249 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "PingPong.h"
+
+#define PINGPONG_TEST_SAMPLES   8U
+#define PINGPONG_TEST_CALLS     16U
+
+static uint16_t pingPongBuffer[3][PINGPONG_TEST_SAMPLES];
+
+/* What the callback saw and does */
+static struct
+{
+    uint32_t    calls;
+    void*       buffer[PINGPONG_TEST_CALLS];        /*!< Buffer of each call */
+    uint16_t    first[PINGPONG_TEST_CALLS];         /*!< Its first sample */
+    uint8_t     inIsr[PINGPONG_TEST_CALLS];         /*!< Called from the DMA interrupt */
+    uint8_t     started[PINGPONG_TEST_CALLS];       /*!< Stream claimed at the call */
+    void*       swapTo;                             /*!< PingPongSwap() argument, once */
+    uint8_t     swapResult[2];                      /*!< PingPongSwap() twice in a row */
+    uint32_t    lag;                                /*!< Samples the DMA moves during the call, once */
+    uint16_t    next;                               /*!< Next sample value */
+} pingPongTest;
+
+/* ADC conversions: each one raises a DMA request */
+static void HostTestPingPongConvert(uint32_t count)
+{
+    while (count-- != 0)
+    {
+        ADC1->REGDATA = ++pingPongTest.next;
+        (void)HostDmaRequest((uint32_t)&ADC1->REGDATA);
+    }
+}
+
+static void HostTestPingPongLog(PingPong_T* pp, void* buffer)
+{
+    uint32_t call = pingPongTest.calls++;
+
+    if (call < PINGPONG_TEST_CALLS)
+    {
+        pingPongTest.buffer[call] = buffer;
+        pingPongTest.first[call] = *(uint16_t*)buffer;
+        pingPongTest.inIsr[call] = (__get_IPSR() != 0);
+        pingPongTest.started[call] = (pp->stream != NULL);
+    }
+}
+
+static void HostTestPingPongInput(PingPong_T* pp, void* buffer)
+{
+    uint32_t lag = pingPongTest.lag;
+
+    HostTestPingPongLog(pp, buffer);
+
+    /* A slow callback: the DMA keeps converting meanwhile */
+    pingPongTest.lag = 0;
+    HostTestPingPongConvert(lag);
+
+    if (pingPongTest.swapTo != NULL)
+    {
+        pingPongTest.swapResult[0] = PingPongSwap(pp, pingPongTest.swapTo);
+        pingPongTest.swapResult[1] = PingPongSwap(pp, pingPongTest.swapTo);
+        pingPongTest.swapTo = NULL;
+    }
+}
+
+static void HostTestPingPongOutput(PingPong_T* pp, void* buffer)
+{
+    uint16_t* samples = buffer;
+    uint32_t i;
+
+    for (i = 0; i < pp->samples; i++)
+    {
+        samples[i] = ++pingPongTest.next;
+    }
+    HostTestPingPongLog(pp, buffer);
+}
+
+/* ADC input: buffer switching, swaps, overruns and stopping */
+static uint8_t HostTestPingPongAdc(void)
+{
+    uint16_t* buf0 = pingPongBuffer[0];
+    uint16_t* buf1 = pingPongBuffer[1];
+    uint16_t* buf2 = pingPongBuffer[2];
+    PingPong_T pp;
+    DmaStream_T* stream;
+    uint32_t i;
+
+    memset(&pingPongTest, 0, sizeof(pingPongTest));
+
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, 0, 2, HostTestPingPongInput, NULL) == ERROR);
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, 0x10000U, 2, HostTestPingPongInput, NULL) == ERROR);
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, PINGPONG_TEST_SAMPLES, 3, HostTestPingPongInput, NULL) == ERROR);
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, PINGPONG_TEST_SAMPLES, 2, NULL, NULL) == ERROR);
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, PINGPONG_TEST_SAMPLES, 2, HostTestPingPongInput, NULL) == SUCCESS);
+
+    HOST_CHECK(PingPongStartAdc(&pp, ADC1) == SUCCESS);
+    HOST_CHECK(PingPongStartAdc(&pp, ADC1) == ERROR);
+    HOST_CHECK(pp.stream != NULL);
+    HOST_CHECK(pp.stream->regs->SCFG_B.EN == BIT_SET);
+    HOST_CHECK(pp.stream->regs->SCFG_B.DBM == BIT_SET);
+    HOST_CHECK(pp.stream->regs->SCFG_B.CTARG == 0);
+    HOST_CHECK(pp.stream->regs->M0ADDR == (uint32_t)buf0);
+    HOST_CHECK(pp.stream->regs->M1ADDR == (uint32_t)buf1);
+    HOST_CHECK(pp.stream->regs->NDATA == PINGPONG_TEST_SAMPLES);
+    HOST_CHECK(ADC1->CTRL2_B.DMAEN == BIT_SET);
+    HOST_CHECK(ADC1->CTRL2_B.DMADISSEL == BIT_SET);
+
+    /* One callback per buffer, from the interrupt, alternating buffers */
+    HostTestPingPongConvert(PINGPONG_TEST_SAMPLES - 1U);
+    HOST_CHECK(pingPongTest.calls == 0);
+    HostTestPingPongConvert(1);
+    HOST_CHECK(pingPongTest.calls == 1);
+    HOST_CHECK(pingPongTest.buffer[0] == buf0);
+    HOST_CHECK(pingPongTest.inIsr[0]);
+    for (i = 0; i < PINGPONG_TEST_SAMPLES; i++)
+    {
+        HOST_CHECK(buf0[i] == i + 1U);
+    }
+
+    /* Swap the buffer being handed over: the DMA fills buf2 instead of buf1 */
+    pingPongTest.swapTo = buf2;
+    HostTestPingPongConvert(PINGPONG_TEST_SAMPLES);
+    HOST_CHECK(pingPongTest.calls == 2);
+    HOST_CHECK(pingPongTest.buffer[1] == buf1);
+    HOST_CHECK(pingPongTest.first[1] == 9);
+    HOST_CHECK(pingPongTest.swapResult[0] == SUCCESS);
+    HOST_CHECK(pingPongTest.swapResult[1] == ERROR);
+    HOST_CHECK(pp.stream->regs->M1ADDR == (uint32_t)buf2);
+
+    HostTestPingPongConvert(2U * PINGPONG_TEST_SAMPLES);
+    HOST_CHECK(pingPongTest.calls == 4);
+    HOST_CHECK(pingPongTest.buffer[2] == buf0);
+    HOST_CHECK(pingPongTest.first[2] == 17);
+    HOST_CHECK(pingPongTest.buffer[3] == buf2);
+    HOST_CHECK(pingPongTest.first[3] == 25);
+    /* The swapped-out buffer now belongs to the application, untouched */
+    HOST_CHECK(buf1[0] == 9);
+    HOST_CHECK(buf1[PINGPONG_TEST_SAMPLES - 1U] == 16);
+    HOST_CHECK(pp.buffers == 4);
+    HOST_CHECK(pp.overruns == 0);
+
+    /* Slow callback: the DMA finishes the other buffer and is back in the
+       one being handed over, which can then no longer be swapped */
+    pingPongTest.lag = PINGPONG_TEST_SAMPLES;
+    pingPongTest.swapTo = buf1;
+    HostTestPingPongConvert(PINGPONG_TEST_SAMPLES);
+    HOST_CHECK(pingPongTest.calls == 6);
+    HOST_CHECK(pingPongTest.buffer[4] == buf0);
+    HOST_CHECK(pingPongTest.swapResult[0] == ERROR);
+    HOST_CHECK(pp.stream->regs->M0ADDR == (uint32_t)buf0);
+    HOST_CHECK(pingPongTest.buffer[5] == buf2);
+    HOST_CHECK(pingPongTest.first[5] == 41);
+    HOST_CHECK(pp.overruns == 1);
+
+    /* Two switches during one callback: the unreported buffer is counted */
+    pingPongTest.lag = 2U * PINGPONG_TEST_SAMPLES;
+    HostTestPingPongConvert(PINGPONG_TEST_SAMPLES);
+    HOST_CHECK(pingPongTest.calls == 8);
+    HOST_CHECK(pingPongTest.buffer[6] == buf0);
+    HOST_CHECK(pingPongTest.buffer[7] == buf0);
+    HOST_CHECK(pingPongTest.first[7] == 65);
+    HOST_CHECK(pp.overruns == 2);
+    HOST_CHECK(pp.buffers == 8);
+    HOST_CHECK(pp.running);
+
+    /* Stop: ADC requests off, stream disabled and free, no more callbacks */
+    stream = pp.stream;
+    PingPongStop(&pp);
+    HOST_CHECK(pp.stream == NULL);
+    HOST_CHECK(!pp.running);
+    HOST_CHECK(stream->regs->SCFG_B.EN == BIT_RESET);
+    HOST_CHECK(ADC1->CTRL2_B.DMAEN == BIT_RESET);
+    HOST_CHECK(HostDmaRequest((uint32_t)&ADC1->REGDATA) == 0);
+    HOST_CHECK(pingPongTest.calls == 8);
+    stream = DmaClaim(DMA_REQ_ADC1, DMA_PRIORITY_HIGH, PINGPONG_IRQ_PRIORITY);
+    HOST_CHECK(stream != NULL);
+    DmaRelease(stream);
+
+    /* Restartable */
+    HOST_CHECK(PingPongStartAdc(&pp, ADC1) == SUCCESS);
+    PingPongStop(&pp);
+
+    return SUCCESS;
+}
+
+/* DAC output: both buffers are filled before the stream starts */
+static uint8_t HostTestPingPongDac(void)
+{
+    uint16_t* buf0 = pingPongBuffer[0];
+    uint16_t* buf1 = pingPongBuffer[1];
+    PingPong_T pp;
+    uint32_t i;
+
+    memset(&pingPongTest, 0, sizeof(pingPongTest));
+    memset(pingPongBuffer, 0, sizeof(pingPongBuffer));
+    DAC->DH12R1 = 0;
+
+    HOST_CHECK(PingPongInit(&pp, buf0, buf1, PINGPONG_TEST_SAMPLES, 2, HostTestPingPongOutput, NULL) == SUCCESS);
+    HOST_CHECK(PingPongStartDac(&pp, DAC_CHANNEL_1) == SUCCESS);
+    HOST_CHECK(DAC->CTRL_B.DMAENCH1 == BIT_SET);
+    HOST_CHECK(pp.stream->regs->SCFG_B.DIRCFG == 1);
+    HOST_CHECK(pp.stream->regs->PADDR == (uint32_t)&DAC->DH12R1);
+
+    /* Priming, in order, before the stream was claimed */
+    HOST_CHECK(pingPongTest.calls >= 2);
+    HOST_CHECK(pingPongTest.buffer[0] == buf0);
+    HOST_CHECK(pingPongTest.buffer[1] == buf1);
+    HOST_CHECK(!pingPongTest.started[0] && !pingPongTest.started[1]);
+    HOST_CHECK(!pingPongTest.inIsr[0] && !pingPongTest.inIsr[1]);
+
+    /* The simulated DAC takes buf0 at once, the callback refills it */
+    HOST_CHECK(pingPongTest.calls == 3);
+    HOST_CHECK(pingPongTest.buffer[2] == buf0);
+    HOST_CHECK(pingPongTest.inIsr[2]);
+    HOST_CHECK(DAC->DH12R1 == PINGPONG_TEST_SAMPLES);
+
+    /* Then buf1 one sample per trigger, then the refilled buf0 */
+    for (i = 0; i < 2U * PINGPONG_TEST_SAMPLES; i++)
+    {
+        HOST_CHECK(HostDmaRequest((uint32_t)&DAC->DH12R1) == 1);
+        HOST_CHECK(DAC->DH12R1 == PINGPONG_TEST_SAMPLES + 1U + i);
+    }
+    HOST_CHECK(pingPongTest.calls == 5);
+    HOST_CHECK(pingPongTest.buffer[3] == buf1);
+    HOST_CHECK(pingPongTest.buffer[4] == buf0);
+    HOST_CHECK(pp.overruns == 0);
+
+    PingPongStop(&pp);
+    HOST_CHECK(DAC->CTRL_B.DMAENCH1 == BIT_RESET);
+    HOST_CHECK(HostDmaRequest((uint32_t)&DAC->DH12R1) == 0);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Double-buffered streaming on the simulated DMA: ADC input
+ *              with swaps, a slow callback and stop, and DAC output priming.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestPingPong(void)
+{
+    HOST_CHECK(HostTestPingPongAdc() == SUCCESS);
+    HOST_CHECK(HostTestPingPongDac() == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,211 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Profile.h"
+
+/* Scripted cycle counter: each PROFILE_CYCLES() read takes the next value */
+#define PROFILE_SCRIPT_MAX  32
+
+static uint32_t profileScript[PROFILE_SCRIPT_MAX];
+static uint32_t profileScriptLen;
+static uint32_t profileScriptPos;
+
+/*!
+ * @brief       PROFILE_CYCLES() of the host_tests_profile build.
+ *
+ * @param       None
+ *
+ * @retval      Next scripted value, the last one again once the script ran out
+ */
+uint32_t HostTestProfileCycles(void)
+{
+    if (profileScriptPos < profileScriptLen)
+    {
+        return profileScript[profileScriptPos++];
+    }
+    return (profileScriptLen != 0) ? profileScript[profileScriptLen - 1] : 0;
+}
+
+static void HostTestProfileScript(const uint32_t* values, uint32_t count)
+{
+    memcpy(profileScript, values, count * sizeof(values[0]));
+    profileScriptLen = count;
+    profileScriptPos = 0;
+}
+
+/* Empty zones, measured as begin/end read pairs */
+static void HostTestProfileEmpty(ProfileZone_T* zone, uint32_t count)
+{
+    ProfileScope_T scope;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        ProfileBegin(&scope, zone);
+        ProfileEnd(&scope);
+    }
+}
+
+/* Two nested zones after each other; reads: outer, a, a, b, b, outer */
+static ProfileZone_T* HostTestProfileNested(ProfileZone_T** a, ProfileZone_T** b)
+{
+    static ProfileZone_T outer = PROFILE_ZONE_INIT("outer");
+    static ProfileZone_T inner1 = PROFILE_ZONE_INIT("inner1");
+    static ProfileZone_T inner2 = PROFILE_ZONE_INIT("inner2");
+    ProfileScope_T scope;
+
+    ProfileBegin(&scope, &outer);
+    HostTestProfileEmpty(&inner1, 1);
+    HostTestProfileEmpty(&inner2, 1);
+    ProfileEnd(&scope);
+
+    *a = &inner1;
+    *b = &inner2;
+    return &outer;
+}
+
+/* Zone through the macro: the cleanup attribute ends it with the scope */
+static void HostTestProfileMacro(void)
+{
+    PROFILE_ZONE("macro");
+}
+
+static ProfileZone_T* HostTestProfileFind(const char* name)
+{
+    ProfileZone_T* zone;
+
+    for (zone = ProfileFirstZone(); zone != NULL; zone = zone->next)
+    {
+        if (strcmp(zone->name, name) == 0)
+        {
+            return zone;
+        }
+    }
+    return NULL;
+}
+
+uint8_t HostTestProfile(void)
+{
+    /* Calibration: eight empty zones of 9, 7, 12, 7, 8, 30, 10 and 11 cycles */
+    static const uint32_t calibrate[] =
+    {
+        100, 109, 200, 207, 300, 312, 400, 407,
+        500, 508, 600, 630, 700, 710, 800, 811,
+    };
+    static const uint32_t samples[] =
+    {
+        1000, 1107,                 /* 100 */
+        2000, 2057,                 /* 50 */
+        3000, 4007,                 /* 1000 */
+        4000, 4005,                 /* below the overhead: 0 */
+        0xFFFFFFF0U, 0x00000017U,   /* across the counter wrap: 32 */
+    };
+    /* outer 300, inner1 40, inner2 100: self 160 */
+    static const uint32_t nested[] =
+    {
+        5000, 5010, 5057, 5100, 5207, 5307,
+    };
+    static const uint32_t macro[] = { 6000, 6020 };
+    static ProfileZone_T timed = PROFILE_ZONE_INIT("timed");
+    static ProfileZone_T hist = PROFILE_ZONE_INIT("hist");
+    ProfileZone_T anon = PROFILE_ZONE_INIT(NULL);
+    ProfileZone_T* outer;
+    ProfileZone_T* inner1;
+    ProfileZone_T* inner2;
+    uint32_t n;
+
+    /* Overhead is the shortest empty zone, and is subtracted from each sample */
+    HostTestProfileScript(calibrate, sizeof(calibrate) / sizeof(calibrate[0]));
+    ProfileInit();
+    /* Fails here when PROFILE_CYCLES() is not the script: run host_tests_profile */
+    HOST_CHECK(profileScriptPos == sizeof(calibrate) / sizeof(calibrate[0]));
+    HOST_CHECK(ProfileFirstZone() == NULL);
+
+    HostTestProfileScript((const uint32_t[]){ 100, 107, 200, 208 }, 4);
+    HostTestProfileEmpty(&anon, 2);
+    HOST_CHECK(anon.count == 2);
+    HOST_CHECK(anon.min == 0);
+    HOST_CHECK(anon.max == 1);
+    HOST_CHECK(ProfileFirstZone() == NULL);
+
+    /* min, max and mean */
+    HostTestProfileScript(samples, 6);
+    HostTestProfileEmpty(&timed, 3);
+    HOST_CHECK(ProfileFirstZone() == &timed);
+    HOST_CHECK(timed.count == 3);
+    HOST_CHECK(timed.min == 50);
+    HOST_CHECK(timed.max == 1000);
+    HOST_CHECK(timed.total / timed.count == 383);
+    HOST_CHECK(timed.self == timed.total);
+
+    HostTestProfileScript(&samples[6], 4);
+    HostTestProfileEmpty(&timed, 2);
+    HOST_CHECK(timed.count == 5);
+    HOST_CHECK(timed.min == 0);
+    HOST_CHECK(timed.max == 1000);
+    HOST_CHECK(timed.total == 1182);
+
+    /* Self time excludes nested zones, inclusive time does not */
+    HostTestProfileScript(nested, sizeof(nested) / sizeof(nested[0]));
+    outer = HostTestProfileNested(&inner1, &inner2);
+    HOST_CHECK(outer->count == 1);
+    HOST_CHECK(outer->total == 300);
+    HOST_CHECK(outer->self == 160);
+    HOST_CHECK(inner1->total == 40);
+    HOST_CHECK(inner1->self == 40);
+    HOST_CHECK(inner2->total == 100);
+    HOST_CHECK(inner2->self == 100);
+    HOST_CHECK(timed.next == outer);
+    HOST_CHECK(outer->next == inner1);
+    HOST_CHECK(inner1->next == inner2);
+
+    /* Nested zones longer than the parent (overhead rounding): self clamps at 0 */
+    HostTestProfileScript((const uint32_t[]){ 7000, 7000, 7027, 7000, 7027, 7030 }, 6);
+    outer = HostTestProfileNested(&inner1, &inner2);
+    HOST_CHECK(outer->count == 2);
+    HOST_CHECK(outer->total == 323);
+    HOST_CHECK(outer->self == 160);
+
+    HostTestProfileScript(macro, sizeof(macro) / sizeof(macro[0]));
+    HostTestProfileMacro();
+    HOST_CHECK(HostTestProfileFind("macro") != NULL);
+    HOST_CHECK(HostTestProfileFind("macro")->total == 13);
+    HOST_CHECK(HostTestProfileFind("macro")->self == 13);
+
+    /* Histogram bin edges: 0, 1, 2^n - 1 and 2^n */
+    HOST_CHECK(ProfileHistBin(0) == 0);
+    HOST_CHECK(ProfileHistBin(1) == 1);
+    for (n = 1; n < PROFILE_HIST_BINS - 2; n++)
+    {
+        HOST_CHECK(ProfileHistBin((1UL << n) - 1U) == n);
+        HOST_CHECK(ProfileHistBin(1UL << n) == n + 1U);
+    }
+    /* The last bin is open */
+    HOST_CHECK(ProfileHistBin((1UL << (PROFILE_HIST_BINS - 2)) - 1U) == PROFILE_HIST_BINS - 2);
+    HOST_CHECK(ProfileHistBin(1UL << (PROFILE_HIST_BINS - 2)) == PROFILE_HIST_BINS - 1);
+    HOST_CHECK(ProfileHistBin(1UL << (PROFILE_HIST_BINS - 1)) == PROFILE_HIST_BINS - 1);
+    HOST_CHECK(ProfileHistBin(UINT32_MAX) == PROFILE_HIST_BINS - 1);
+
+    ProfileRecord(&hist, 0, 0);
+    ProfileRecord(&hist, 1, 1);
+    ProfileRecord(&hist, 3, 3);
+    ProfileRecord(&hist, 4, 4);
+    ProfileRecord(&hist, 7, 7);
+    ProfileRecord(&hist, UINT32_MAX, 0);
+    HOST_CHECK(hist.hist[0] == 1);
+    HOST_CHECK(hist.hist[1] == 1);
+    HOST_CHECK(hist.hist[2] == 1);
+    HOST_CHECK(hist.hist[3] == 2);
+    HOST_CHECK(hist.hist[PROFILE_HIST_BINS - 1] == 1);
+    HOST_CHECK(hist.max == UINT32_MAX);
+
+    /* Reset clears registered zones but keeps them listed */
+    ProfileReset();
+    HOST_CHECK(timed.count == 0);
+    HOST_CHECK(timed.min == UINT32_MAX);
+    HOST_CHECK(timed.total == 0);
+    HOST_CHECK(outer->self == 0);
+    HOST_CHECK(outer->hist[ProfileHistBin(300)] == 0);
+    HOST_CHECK(ProfileFirstZone() == &timed);
+
+    return SUCCESS;
+}
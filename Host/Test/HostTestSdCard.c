@@ -0,0 +1,132 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "SdCard.h"
+
+#define SD_TEST_BLOCKS      65536U
+#define SD_TEST_BLOCK       100U
+
+/* CSDs read from a 2 GB standard capacity and an 8 GB SDHC card */
+static const uint32_t sdTestCsdV1[4] = { 0x005E0032U, 0x5F5A83AEU, 0xFEFBCFFFU, 0x928040DFU };
+static const uint32_t sdTestCsdV2[4] = { 0x400E0032U, 0x5B590000U, 0x3B377F80U, 0x0A404000U };
+
+/* SD 1.0: no CMD6, so no high speed; 1 and 4-bit bus */
+static const uint8_t sdTestScrV1[8] = { 0x00, 0x25, 0x00, 0x00, 0, 0, 0, 0 };
+
+static uint32_t sdTestPattern[9 * SDCARD_BLOCK_SIZE / 4U];
+static uint32_t sdTestReadBack[9 * SDCARD_BLOCK_SIZE / 4U];
+static uint32_t sdTestCalls;
+
+static void HostTestSdCardDone(SdCard_T* card, uint8_t status)
+{
+    (void)card;
+
+    if (status == SUCCESS)
+    {
+        sdTestCalls++;
+    }
+}
+
+/* Capacity from recorded CSDs; the data clock with and without high speed */
+static uint8_t HostTestSdCardRegisters(void)
+{
+    static SdCard_T card;
+
+    /* 3772 << 10 blocks of 512 (1 KiB READ_BL_LEN), default speed */
+    (void)HostSdAttach(SD_TEST_BLOCKS, 0);
+    HostSdSetRegisters(sdTestCsdV1, sdTestScrV1);
+    HOST_CHECK(SdCardInit(&card) == SUCCESS);
+    HOST_CHECK(card.type == SDCARD_TYPE_SDSC_V2);
+    HOST_CHECK(card.blocks == 3862528U);
+    HOST_CHECK((SDIO->CLKCTRL_B.WBSEL == 1U) && !card.highSpeed);
+    HOST_CHECK((card.clock == 24000000U) && (SDIO->CLKCTRL_B.BYPASSEN == 0) && (SDIO->CLKCTRL_B.CLKDIV == 0));
+
+    /* 15160 * 1024 blocks; high speed bypasses the divider */
+    (void)HostSdAttach(SD_TEST_BLOCKS, 1);
+    HostSdSetRegisters(sdTestCsdV2, NULL);
+    HOST_CHECK(SdCardInit(&card) == SUCCESS);
+    HOST_CHECK(card.type == SDCARD_TYPE_SDHC);
+    HOST_CHECK(card.blocks == 15523840U);
+    HOST_CHECK(card.highSpeed);
+    HOST_CHECK(card.clock == 48000000U);
+
+    return SUCCESS;
+}
+
+/* Eight blocks with CMD25 and one with CMD24, read back with CMD18 and CMD17 */
+static uint8_t HostTestSdCardBlocks(SdCard_T* card)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(sdTestPattern) / 4U; i++)
+    {
+        sdTestPattern[i] = 0x9E3779B9U * (i + SD_TEST_BLOCK + 1U);
+        sdTestReadBack[i] = 0;
+    }
+    sdTestCalls = 0;
+
+    /* Out of range and misaligned requests are refused */
+    HOST_CHECK(SdCardRead(card, card->blocks - 1U, sdTestReadBack, 2, NULL, NULL) == ERROR);
+    HOST_CHECK(SdCardRead(card, SD_TEST_BLOCK, (uint8_t*)sdTestReadBack + 2, 1, NULL, NULL) == ERROR);
+
+    HOST_CHECK(SdCardWrite(card, SD_TEST_BLOCK, sdTestPattern, 8, HostTestSdCardDone, NULL) == SUCCESS);
+    HOST_CHECK(SdCardWrite(card, SD_TEST_BLOCK, sdTestPattern, 8, NULL, NULL) == ERROR);
+    HOST_CHECK(SdCardWait(card) == SUCCESS);
+    HOST_CHECK(HostSdPreErase() == 8U);
+    HOST_CHECK(SdCardWrite(card, SD_TEST_BLOCK + 8U, &sdTestPattern[8U * SDCARD_BLOCK_SIZE / 4U], 1,
+                           HostTestSdCardDone, NULL) == SUCCESS);
+    HOST_CHECK(SdCardWait(card) == SUCCESS);
+
+    HOST_CHECK(SdCardRead(card, SD_TEST_BLOCK, sdTestReadBack, 9, HostTestSdCardDone, NULL) == SUCCESS);
+    HOST_CHECK(SdCardWait(card) == SUCCESS);
+    HOST_CHECK(memcmp(sdTestPattern, sdTestReadBack, sizeof(sdTestPattern)) == 0);
+    memset(sdTestReadBack, 0, SDCARD_BLOCK_SIZE);
+    HOST_CHECK(SdCardRead(card, SD_TEST_BLOCK + 8U, sdTestReadBack, 1, HostTestSdCardDone, NULL) == SUCCESS);
+    HOST_CHECK(SdCardWait(card) == SUCCESS);
+    HOST_CHECK(memcmp(&sdTestPattern[8U * SDCARD_BLOCK_SIZE / 4U], sdTestReadBack, SDCARD_BLOCK_SIZE) == 0);
+
+    HOST_CHECK(sdTestCalls == 4U);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       SD card on the SDIO model: capacity and clock from recorded
+ *              card registers, identification of an SDHC card with the
+ *              switch to the 4-bit bus at high speed, then nine blocks
+ *              written and read back, which must land on the card with
+ *              ACMD23 announcing the multi-block write.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestSdCard(void)
+{
+    static SdCard_T card;
+    uint8_t* media;
+    uint32_t word, i;
+
+    HOST_CHECK(HostTestSdCardRegisters() == SUCCESS);
+
+    media = HostSdAttach(SD_TEST_BLOCKS, 1);
+    HOST_CHECK(SdCardInit(&card) == SUCCESS);
+    HOST_CHECK((card.type == SDCARD_TYPE_SDHC) && (card.blocks == SD_TEST_BLOCKS));
+    HOST_CHECK(card.highSpeed && (card.clock == 48000000U));
+
+    HOST_CHECK(HostTestSdCardBlocks(&card) == SUCCESS);
+
+    /* The pattern, word by word, in the blocks written and nowhere else */
+    for (i = 0; i < 9U * SDCARD_BLOCK_SIZE / 4U; i++)
+    {
+        memcpy(&word, &media[SD_TEST_BLOCK * SDCARD_BLOCK_SIZE + 4U * i], 4);
+        HOST_CHECK(word == 0x9E3779B9U * (i + SD_TEST_BLOCK + 1U));
+    }
+    for (i = 0; i < SDCARD_BLOCK_SIZE; i++)
+    {
+        HOST_CHECK(media[(SD_TEST_BLOCK - 1U) * SDCARD_BLOCK_SIZE + i] == 0);
+        HOST_CHECK(media[(SD_TEST_BLOCK + 9U) * SDCARD_BLOCK_SIZE + i] == 0);
+    }
+
+    return SUCCESS;
+}
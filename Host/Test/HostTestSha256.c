@@ -0,0 +1,139 @@
+#include <string.h>
+#include "HostTest.h"
+#include "Digest.h"
+#include "Sha256.h"
+
+/**
+ * @brief SHA-256 of the first length bytes of the test pattern
+ */
+typedef struct
+{
+    uint32_t    length;
+    const char* digest;     /* Hex, from an independent implementation */
+} HostTestSha256Ref_T;
+
+static const HostTestSha256Ref_T sha256Ref[] =
+{
+    { 0,    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { 55,   "e7313d333c272e639f790978283f9eb392e843d0f29b7016828bb1daa4aac70b" },
+    { 56,   "4324d65f3c103567f5589c710bc08f8523f929a9272e3af36fc968e52abc6c27" },
+    { 63,   "81c80242132f230c3bd41b3e63bbcff16107339549214a99614ff26664625055" },
+    { 64,   "39e3d7b6b5d075d37d053ad89b24b41bef4f3c29760c84447cab3f3be1882241" },
+    { 65,   "aacca6ff74fdbb296d165a45cecfa04e5127bc008770fbbdd48006f2d2fae95e" },
+    { 119,  "9ce7368e4daf32341631b492e80359dc9f594b48453cd0dd5bf0b19279cc177e" },
+    { 128,  "d2742f1f4ac6bb7ca2b239ee18402ba8b3f9f8e652d2a72973c2b9ba11c08cf6" },
+    { 1000, "1e9bc38cbf860b9ec31918b065f9b52476c549a782e0e7990bed8ce3868d2371" },
+};
+
+/**
+ * @brief RFC 4231 test case; the key is keyLen bytes of keyByte, or
+ *        0x01, 0x02, .. when keyByte is 0
+ */
+typedef struct
+{
+    uint8_t     keyByte;
+    uint8_t     keyLen;
+    const char* data;
+    uint8_t     dataByte;   /* Data is dataLen bytes of this when data is NULL */
+    uint8_t     dataLen;
+    const char* mac;
+} HostTestHmacRef_T;
+
+static const HostTestHmacRef_T hmacRef[] =
+{
+    { 0x0B, 20,  "Hi There", 0, 0,
+      "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+    { 0xAA, 20,  NULL, 0xDD, 50,
+      "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" },
+    { 0x00, 25,  NULL, 0xCD, 50,
+      "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" },
+    { 0xAA, 131, "Test Using Larger Than Block-Size Key - Hash Key First", 0, 0,
+      "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+    { 0xAA, 131, "This is a test using a larger than block-size key and a larger than block-size data. "
+                 "The key needs to be hashed before being used by the HMAC algorithm.", 0, 0,
+      "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" },
+    /* A key of exactly one block is used as it is */
+    { 'k',  64,  "x", 0, 0,
+      "f91c4c403625fb06910ef93999265bbd2d62baeaec6ff36455498cc124fe3e66" },
+};
+
+/*!
+ * @brief       SHA-256 and HMAC-SHA256 against FIPS 180-4 and RFC 4231,
+ *              and against reference digests of a test pattern through
+ *              Sha256Compute() and through DigestUpdate() in two pieces
+ *              split at every position.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestSha256(void)
+{
+    static uint8_t pattern[1000], chunk[1000];
+    const HostTestHmacRef_T* ref;
+    DigestContext_T ctx;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    uint8_t key[131], data[200];
+    uint32_t i, split, len, dataLen;
+
+    for (i = 0; i < sizeof(pattern); i++)
+    {
+        pattern[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    HOST_CHECK(DigestSize(DIGEST_SHA256) == SHA256_DIGEST_SIZE);
+
+    Sha256Compute((uint8_t*)"abc", 3, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    Sha256Compute((uint8_t*)"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+
+    for (i = 0; i < sizeof(sha256Ref) / sizeof(sha256Ref[0]); i++)
+    {
+        len = sha256Ref[i].length;
+        HOST_CHECK(Sha256Compute(pattern, len, digest) == SUCCESS);
+        HOST_CHECK(HostTestHexEqual(digest, sha256Ref[i].digest));
+
+        for (split = 0; (len <= 128U) && (split <= len); split++)
+        {
+            DigestInit(&ctx, DIGEST_SHA256);
+            DigestUpdate(&ctx, pattern, split);
+            DigestUpdate(&ctx, &pattern[split], len - split);
+            HOST_CHECK(DigestFinal(&ctx, digest) == SHA256_DIGEST_SIZE);
+            HOST_CHECK(HostTestHexEqual(digest, sha256Ref[i].digest));
+        }
+    }
+
+    for (i = 0; i < sizeof(hmacRef) / sizeof(hmacRef[0]); i++)
+    {
+        ref = &hmacRef[i];
+        for (len = 0; len < ref->keyLen; len++)
+        {
+            key[len] = (ref->keyByte != 0) ? ref->keyByte : (uint8_t)(len + 1U);
+        }
+        if (ref->data != NULL)
+        {
+            dataLen = strlen(ref->data);
+            memcpy(data, ref->data, dataLen);
+        }
+        else
+        {
+            dataLen = ref->dataLen;
+            memset(data, ref->dataByte, dataLen);
+        }
+        HOST_CHECK(HmacSha256Compute(key, ref->keyLen, data, dataLen, digest) == SUCCESS);
+        HOST_CHECK(HostTestHexEqual(digest, ref->mac));
+    }
+
+    /* One million "a" */
+    memset(chunk, 'a', sizeof(chunk));
+    DigestInit(&ctx, DIGEST_SHA256);
+    for (i = 0; i < 1000U; i++)
+    {
+        DigestUpdate(&ctx, chunk, sizeof(chunk));
+    }
+    DigestFinal(&ctx, digest);
+    HOST_CHECK(HostTestHexEqual(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+
+    return SUCCESS;
+}
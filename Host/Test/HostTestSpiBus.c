@@ -0,0 +1,276 @@
+#include <stdint.h>
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "Critical.h"
+#include "SpiBus.h"
+
+/**
+ * @brief Rate expected for a rate limit on a bus
+ */
+typedef struct
+{
+    SPI_T*   spi;
+    uint32_t maxBaud;
+    uint32_t baud;          /*!< 0: no prescaler slow enough */
+    uint8_t  brsel;
+} HostTestSpiBusPrescaler_T;
+
+static const HostTestSpiBusPrescaler_T spiBusPrescalers[] =
+{
+    /* SPI1 on the 84 MHz PCLK2: 42 MHz at most */
+    { SPI1, 50000000U, 42000000U, 0 },
+    { SPI1, 42000000U, 42000000U, 0 },
+    { SPI1, 41999999U, 21000000U, 1 },
+    /* SPI2 on the 42 MHz PCLK1 */
+    { SPI2, 10000000U, 5250000U,  2 },
+    { SPI2, 164062U,   164062U,   7 },
+    { SPI2, 164061U,   0,         0 },
+};
+
+static uint8_t spiOrder[4];
+static uint8_t spiOrderCount;
+
+static uint8_t spiSeen[32];
+static uint32_t spiSeenCount;
+static uint32_t spiSelects;
+static uint8_t spiSelected;
+
+static void HostTestSpiBusDone(SpiTransfer_T* transfer)
+{
+    if (spiOrderCount < sizeof(spiOrder))
+    {
+        spiOrder[spiOrderCount] = (uint8_t)(uintptr_t)transfer->arg;
+    }
+    spiOrderCount++;
+}
+
+/* Inverts every frame, recording what the master sent while selected */
+static uint16_t HostTestSpiDevice(SPI_T* spi, uint16_t mosi)
+{
+    (void)spi;
+
+    if (spiSelected && (spiSeenCount < sizeof(spiSeen)))
+    {
+        spiSeen[spiSeenCount++] = (uint8_t)mosi;
+    }
+    return (uint16_t)(~mosi & 0xFFU);
+}
+
+static void HostTestSpiSelect(GPIO_T* port, uint16_t odr, uint16_t changed)
+{
+    (void)port;
+
+    if ((changed & GPIO_PIN_4) != 0)
+    {
+        spiSelected = ((odr & GPIO_PIN_4) == 0);
+        spiSelects += spiSelected;
+    }
+}
+
+/* The fastest prescaler within each limit, on both bus clocks */
+static uint8_t HostTestSpiBusPrescaler(void)
+{
+    static SpiBus_T bus;
+    const HostTestSpiBusPrescaler_T* vector;
+    SpiDevice_T device;
+    uint32_t i;
+    uint8_t result;
+
+    for (i = 0; i < sizeof(spiBusPrescalers) / sizeof(spiBusPrescalers[0]); i++)
+    {
+        vector = &spiBusPrescalers[i];
+        HOST_CHECK(SpiBusInit(&bus, vector->spi) == SUCCESS);
+        HOST_CHECK(bus.pclk == ((vector->spi == SPI1) ? 84000000U : 42000000U));
+
+        result = SpiDeviceInit(&device, &bus, GPIOA, GPIO_PIN_4, 0, vector->maxBaud, 0);
+        SpiBusDeinit(&bus);
+        if (vector->baud == 0)
+        {
+            HOST_CHECK(result == ERROR);
+            continue;
+        }
+        HOST_CHECK(result == SUCCESS);
+        HOST_CHECK(device.baud == vector->baud);
+
+        /* The prescaler lands in CTRL1 on the first transfer */
+        HOST_CHECK(SpiBusInit(&bus, vector->spi) == SUCCESS);
+        HOST_CHECK(SpiDeviceInit(&device, &bus, GPIOA, GPIO_PIN_4, 0, vector->maxBaud, 0) == SUCCESS);
+        HOST_CHECK(SpiExchange(&device, NULL, NULL, 1) == SUCCESS);
+        HOST_CHECK(vector->spi->CTRL1_B.BRSEL == vector->brsel);
+        SpiBusDeinit(&bus);
+    }
+
+    return SUCCESS;
+}
+
+/* MOSI looped back to MISO: data both ways, per-device CTRL1, dummy frames */
+static uint8_t HostTestSpiBusLoopback(void)
+{
+    static SpiBus_T bus;
+    static SpiDevice_T byteDevice, wordDevice;
+    static uint8_t tx[64], rx[64];
+    static uint16_t tx16[16], rx16[16];
+    uint32_t i;
+
+    HOST_CHECK(SpiBusInit(&bus, SPI1) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&byteDevice, &bus, GPIOA, GPIO_PIN_4, 0, 10000000U, 0) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&wordDevice, &bus, GPIOB, GPIO_PIN_0, 3, 1000000U,
+                             SPI_DEVICE_16BIT | SPI_DEVICE_LSB) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&byteDevice, &bus, GPIOA, GPIO_PIN_4, 4, 10000000U, 0) == ERROR);
+    HOST_CHECK(SpiDeviceInit(&byteDevice, &bus, GPIOA, GPIO_PIN_4, 0, 10000000U, 0) == SUCCESS);
+
+    for (i = 0; i < sizeof(tx); i++)
+    {
+        tx[i] = (uint8_t)(i * 37U + 5U);
+    }
+    for (i = 0; i < 16U; i++)
+    {
+        tx16[i] = (uint16_t)(i * 4099U + 1U);
+    }
+
+    /* 10 MHz: 84 MHz / 16; mode 0, 8 bits, MSB first */
+    HOST_CHECK(SpiExchange(&byteDevice, tx, rx, sizeof(tx)) == SUCCESS);
+    HOST_CHECK(memcmp(tx, rx, sizeof(tx)) == 0);
+    HOST_CHECK(SPI1->CTRL1_B.BRSEL == 3U);
+    HOST_CHECK((SPI1->CTRL1_B.CPOL == 0) && (SPI1->CTRL1_B.CPHA == 0));
+    HOST_CHECK((SPI1->CTRL1_B.DFLSEL == 0) && (SPI1->CTRL1_B.LSBSEL == 0));
+
+    /* 1 MHz: 84 MHz / 128; mode 3, 16 bits, LSB first */
+    HOST_CHECK(SpiExchange(&wordDevice, tx16, rx16, 16) == SUCCESS);
+    HOST_CHECK(memcmp(tx16, rx16, sizeof(tx16)) == 0);
+    HOST_CHECK(SPI1->CTRL1_B.BRSEL == 6U);
+    HOST_CHECK((SPI1->CTRL1_B.CPOL == 1U) && (SPI1->CTRL1_B.CPHA == 1U));
+    HOST_CHECK((SPI1->CTRL1_B.DFLSEL == 1U) && (SPI1->CTRL1_B.LSBSEL == 1U));
+    HOST_CHECK(SPI1->CTRL1_B.SPIEN == 1U);
+
+    /* Receive only: dummy frames come back; transmit only */
+    HOST_CHECK(SpiExchange(&byteDevice, NULL, rx, 16) == SUCCESS);
+    for (i = 0; i < 16U; i++)
+    {
+        HOST_CHECK(rx[i] == (uint8_t)SPIBUS_DUMMY);
+    }
+    HOST_CHECK(SpiExchange(&byteDevice, tx, NULL, 16) == SUCCESS);
+    HOST_CHECK(SPI1->CTRL1_B.BRSEL == 3U);
+
+    SpiBusDeinit(&bus);
+
+    return SUCCESS;
+}
+
+/* Queued while completions are held off: the held device goes first */
+static uint8_t HostTestSpiBusQueue(void)
+{
+    static SpiBus_T bus;
+    static SpiDevice_T byteDevice, wordDevice;
+    static SpiTransfer_T transfers[3];
+    static uint8_t tx[8], rx[8];
+    static uint16_t tx16[8], rx16[8];
+    uint32_t i, submitted = 0;
+    uint8_t queued;
+
+    HOST_CHECK(SpiBusInit(&bus, SPI1) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&byteDevice, &bus, GPIOA, GPIO_PIN_4, 0, 10000000U, 0) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&wordDevice, &bus, GPIOB, GPIO_PIN_0, 3, 1000000U, SPI_DEVICE_16BIT) == SUCCESS);
+
+    memset(transfers, 0, sizeof(transfers));
+    for (i = 0; i < 3U; i++)
+    {
+        transfers[i].tx = tx;
+        transfers[i].rx = rx;
+        transfers[i].length = 8;
+        transfers[i].done = HostTestSpiBusDone;
+        transfers[i].arg = (void*)(uintptr_t)(i + 1U);
+    }
+    transfers[0].device = &byteDevice;
+    transfers[0].flags = SPI_XFER_HOLD_CS;
+    transfers[1].device = &wordDevice;
+    transfers[1].tx = tx16;
+    transfers[1].rx = rx16;
+    transfers[2].device = &byteDevice;
+
+    spiOrderCount = 0;
+    {
+        CRITICAL_ENTER();
+        for (i = 0; i < 3U; i++)
+        {
+            submitted += SpiSubmit(&transfers[i]);
+        }
+        queued = (transfers[1].status == SPI_STATUS_QUEUED) && (transfers[2].status == SPI_STATUS_QUEUED);
+        CRITICAL_EXIT();
+    }
+    HOST_CHECK(submitted == 3U);
+    HOST_CHECK(queued);
+    while (SpiBusBusy(&bus))
+    {
+    }
+
+    HOST_CHECK(spiOrderCount == 3U);
+    HOST_CHECK(spiOrder[0] == 1U);
+    HOST_CHECK(spiOrder[1] == 3U);
+    HOST_CHECK(spiOrder[2] == 2U);
+    for (i = 0; i < 3U; i++)
+    {
+        HOST_CHECK(transfers[i].status == SPI_STATUS_DONE);
+    }
+    HOST_CHECK(bus.holder == NULL);
+    HOST_CHECK(bus.errors == 0);
+    HOST_CHECK(bus.transfers == 3U);
+
+    SpiBusDeinit(&bus);
+
+    return SUCCESS;
+}
+
+/* A device behind a chip select sees every frame of an exchange in one select */
+static uint8_t HostTestSpiBusDevice(void)
+{
+    static SpiBus_T bus;
+    static SpiDevice_T device;
+    static uint8_t tx[32], rx[32];
+    uint32_t i;
+
+    HostSpiSetDevice(SPI1, HostTestSpiDevice);
+    HostGpioSetWatch(GPIOA, HostTestSpiSelect);
+    HOST_CHECK(SpiBusInit(&bus, SPI1) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&device, &bus, GPIOA, GPIO_PIN_4, 0, 10000000U, 0) == SUCCESS);
+    HOST_CHECK(!spiSelected && (spiSelects == 0));
+
+    for (i = 0; i < sizeof(tx); i++)
+    {
+        tx[i] = (uint8_t)(i * 53U + 11U);
+    }
+    HOST_CHECK(SpiExchange(&device, tx, rx, sizeof(tx)) == SUCCESS);
+    HOST_CHECK(!spiSelected && (spiSelects == 1U));
+    HOST_CHECK((spiSeenCount == sizeof(tx)) && (memcmp(spiSeen, tx, sizeof(tx)) == 0));
+    for (i = 0; i < sizeof(rx); i++)
+    {
+        HOST_CHECK((rx[i] ^ tx[i]) == 0xFFU);
+    }
+
+    SpiBusDeinit(&bus);
+    HostGpioSetWatch(GPIOA, NULL);
+    HostSpiSetDevice(SPI1, NULL);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       SPI bus on the simulated SPI and DMA: prescaler choices,
+ *              data both ways on the SPI1 loopback with per-device CTRL1
+ *              and dummy frames, the order of queued transfers around a
+ *              held chip select, then a device model behind a chip select.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestSpiBus(void)
+{
+    HOST_CHECK(HostTestSpiBusPrescaler() == SUCCESS);
+    HOST_CHECK(HostTestSpiBusLoopback() == SUCCESS);
+    HOST_CHECK(HostTestSpiBusQueue() == SUCCESS);
+    HOST_CHECK(HostTestSpiBusDevice() == SUCCESS);
+
+    return SUCCESS;
+}
@@ -0,0 +1,155 @@
+#include <string.h>
+#include "HostSim.h"
+#include "HostTest.h"
+#include "SpiNor.h"
+
+#define NOR_TEST_SIZE       0x100000U
+#define NOR_TEST_ADDRESS    0x12345U
+
+/* Basic flash parameters of a 128 Mbit part, JESD216 revision 1.0 */
+static const uint32_t norTestSfdp[9] =
+{
+    0xFFF920E5U, 0x07FFFFFFU, 0x6B08EB44U, 0xBB423B08U, 0xFFFFFFFEU,
+    0x0000FFFFU, 0xEB40FFFFU, 0x520F200CU, 0x0000D810U,
+};
+
+static SpiBus_T norTestBus;
+static SpiDevice_T norTestDevice;
+static uint32_t norTestCalls;
+
+static void HostTestSpiNorDone(SpiNor_T* nor, uint8_t status)
+{
+    (void)nor;
+
+    if (status == SUCCESS)
+    {
+        norTestCalls++;
+    }
+}
+
+/* Recorded SFDP tables in place of the model's: geometry and read commands */
+static uint8_t HostTestSpiNorSfdp(void)
+{
+    static SpiNor_T nor;
+    uint32_t dw[9];
+
+    (void)HostNorAttach(SPI1, GPIOA, GPIO_PIN_4, NOR_TEST_SIZE);
+
+    /* 16 MiB, 4 KiB erase, 1-4-4 0xEB and 1-1-4 0x6B, 256-byte pages */
+    HostNorSetSfdp(norTestSfdp, 9);
+    HOST_CHECK(SpiNorInit(&nor, &norTestDevice) == SUCCESS);
+    HOST_CHECK(nor.sfdp);
+    HOST_CHECK((nor.size == 0x1000000U) && (nor.addressBytes == 3U) && (nor.pageSize == 256U));
+    HOST_CHECK((nor.eraseSize == 4096U) && (nor.eraseOpcode == 0x20U));
+    HOST_CHECK((nor.read144.opcode == 0xEBU) && (nor.read144.modeClocks == 2U) && (nor.read144.dummyClocks == 4U));
+    HOST_CHECK((nor.read114.opcode == 0x6BU) && (nor.read114.modeClocks == 0) && (nor.read114.dummyClocks == 8U));
+
+    /* 2^30 bits: 128 MiB needs 4-byte addresses */
+    memcpy(dw, norTestSfdp, sizeof(dw));
+    dw[1] = 0x8000001EU;
+    HostNorSetSfdp(dw, 9);
+    HOST_CHECK(SpiNorInit(&nor, &norTestDevice) == SUCCESS);
+    HOST_CHECK(nor.sfdp);
+    HOST_CHECK((nor.size == 0x8000000U) && (nor.addressBytes == 4U));
+
+    /* No erase type at all: the table is unusable, the ID gives 1 MiB */
+    dw[0] &= ~3U;
+    dw[7] = 0;
+    dw[8] = 0;
+    HostNorSetSfdp(dw, 9);
+    HOST_CHECK(SpiNorInit(&nor, &norTestDevice) == SUCCESS);
+    HOST_CHECK(!nor.sfdp);
+    HOST_CHECK((nor.size == NOR_TEST_SIZE) && (nor.addressBytes == 3U) && (nor.eraseSize == 4096U));
+
+    return SUCCESS;
+}
+
+/* Erase a block, program 300 bytes across a page boundary, read it back */
+static uint8_t HostTestSpiNorBlock(SpiNor_T* nor, uint8_t* flash)
+{
+    static uint8_t pattern[300];
+    static uint8_t readBack[1024];
+    uint32_t base, offset, i;
+
+    /* Programmed data just outside the block under test */
+    base = NOR_TEST_ADDRESS & ~(nor->eraseSize - 1U);
+    offset = nor->pageSize - 100U;
+    flash[base - 1U] = 0x5A;
+    flash[base + nor->eraseSize] = 0xA5;
+    memset(&flash[base], 0x00, nor->eraseSize);
+    for (i = 0; i < sizeof(pattern); i++)
+    {
+        pattern[i] = (uint8_t)(i * 29U + 3U);
+    }
+    norTestCalls = 0;
+    nor->polls = 0;
+
+    /* One operation at a time */
+    HOST_CHECK(SpiNorErase(nor, base, nor->eraseSize, HostTestSpiNorDone, NULL) == SUCCESS);
+    HOST_CHECK(SpiNorErase(nor, base, nor->eraseSize, NULL, NULL) == ERROR);
+    HOST_CHECK(SpiNorWait(nor) == SUCCESS);
+    HOST_CHECK(SpiNorRead(nor, base, readBack, sizeof(readBack), HostTestSpiNorDone, NULL) == SUCCESS);
+    HOST_CHECK(SpiNorWait(nor) == SUCCESS);
+    for (i = 0; i < sizeof(readBack); i++)
+    {
+        HOST_CHECK(readBack[i] == 0xFFU);
+    }
+
+    HOST_CHECK(SpiNorProgram(nor, base + offset, pattern, sizeof(pattern), HostTestSpiNorDone, NULL) == SUCCESS);
+    HOST_CHECK(SpiNorWait(nor) == SUCCESS);
+    HOST_CHECK(memcmp(&flash[base + offset], pattern, sizeof(pattern)) == 0);
+    HOST_CHECK(SpiNorRead(nor, base, readBack, sizeof(readBack), HostTestSpiNorDone, NULL) == SUCCESS);
+    HOST_CHECK(SpiNorWait(nor) == SUCCESS);
+    for (i = 0; i < sizeof(readBack); i++)
+    {
+        HOST_CHECK(readBack[i] == (((i >= offset) && (i < offset + sizeof(pattern))) ? pattern[i - offset] : 0xFFU));
+    }
+
+    /* Left erased; the flash was seen busy on the way */
+    HOST_CHECK(SpiNorErase(nor, base, nor->eraseSize, HostTestSpiNorDone, NULL) == SUCCESS);
+    HOST_CHECK(SpiNorWait(nor) == SUCCESS);
+    HOST_CHECK(norTestCalls == 5U);
+    HOST_CHECK(nor->polls != 0);
+
+    for (i = 0; i < nor->eraseSize; i++)
+    {
+        HOST_CHECK(flash[base + i] == 0xFFU);
+    }
+    HOST_CHECK((flash[base - 1U] == 0x5AU) && (flash[base + nor->eraseSize] == 0xA5U));
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       SPI NOR flash on the flash model behind SPI1 and PA4:
+ *              recorded SFDP tables, identification and the model's
+ *              geometry, then erase, program across a page boundary and
+ *              read back in one erase block, which must leave its
+ *              neighbours alone.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestSpiNor(void)
+{
+    static SpiNor_T nor;
+    uint8_t* flash;
+
+    HOST_CHECK(SpiBusInit(&norTestBus, SPI1) == SUCCESS);
+    HOST_CHECK(SpiDeviceInit(&norTestDevice, &norTestBus, GPIOA, GPIO_PIN_4, 0, 50000000U, 0) == SUCCESS);
+
+    HOST_CHECK(HostTestSpiNorSfdp() == SUCCESS);
+
+    flash = HostNorAttach(SPI1, GPIOA, GPIO_PIN_4, NOR_TEST_SIZE);
+    HOST_CHECK(SpiNorInit(&nor, &norTestDevice) == SUCCESS);
+    HOST_CHECK(nor.jedecId == 0xEF4014U);
+    HOST_CHECK(nor.sfdp && (nor.size == NOR_TEST_SIZE) && (nor.addressBytes == 3U));
+    HOST_CHECK((nor.pageSize == 256U) && (nor.eraseSize == 4096U) && (nor.eraseOpcode == 0x20U));
+
+    HOST_CHECK(HostTestSpiNorBlock(&nor, flash) == SUCCESS);
+
+    SpiBusDeinit(&norTestBus);
+
+    return SUCCESS;
+}
@@ -0,0 +1,263 @@
+#include <string.h>
+#include "apm32f4xx_eth.h"
+#include "HostSim.h"
+#include "HostTest.h"
+#include "Net.h"
+#include "Udp.h"
+
+#define UDP_TEST_LOCAL_IP   NET_IP4(192, 168, 1, 10)
+#define UDP_TEST_PEER_IP    NET_IP4(192, 168, 1, 20)
+#define UDP_TEST_FRAME_MAX  1514U
+
+static const uint8_t udpTestLocalMac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 };
+static const uint8_t udpTestPeerMac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x20 };
+
+static uint8_t udpSent[UDP_TEST_FRAME_MAX];
+static uint32_t udpSentLen;
+static uint32_t udpSentCount;
+
+static uint8_t udpReceived[UDP_TEST_FRAME_MAX];
+static uint32_t udpReceivedLen;
+static uint32_t udpReceivedCount;
+
+static void HostTestUdpSink(const uint8_t* frame, uint32_t len)
+{
+    udpSentLen = (len < sizeof(udpSent)) ? len : sizeof(udpSent);
+    memcpy(udpSent, frame, udpSentLen);
+    udpSentCount++;
+}
+
+static void HostTestUdpRecv(uint32_t srcIp, uint16_t srcPort, uint16_t dstPort, EthBuf_T* payload)
+{
+    EthBuf_T* buf;
+
+    (void)srcIp;
+    (void)srcPort;
+    (void)dstPort;
+
+    udpReceivedLen = 0;
+    for (buf = payload; (buf != NULL) && (udpReceivedLen + buf->len <= sizeof(udpReceived)); buf = buf->next)
+    {
+        memcpy(&udpReceived[udpReceivedLen], buf->payload, buf->len);
+        udpReceivedLen += buf->len;
+    }
+    udpReceivedCount++;
+}
+
+static void HostTestUdpRelease(EthBuf_T* buf)
+{
+    (void)buf;
+}
+
+/* RFC 1071 sum of big-endian words, independent of Net.c */
+static uint32_t HostTestUdpSum(uint32_t sum, const uint8_t* data, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i + 1U < len; i += 2U)
+    {
+        sum += ((uint32_t)data[i] << 8) | data[i + 1U];
+    }
+    if ((len & 1U) != 0)
+    {
+        sum += (uint32_t)data[len - 1U] << 8;
+    }
+    return sum;
+}
+
+static uint16_t HostTestUdpFold(uint32_t sum)
+{
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+    return (uint16_t)sum;
+}
+
+/* Sum of the UDP pseudo header, header and data of an IPv4 frame */
+static uint16_t HostTestUdpPayloadSum(const uint8_t* frame)
+{
+    const uint8_t* ip = &frame[14];
+    uint32_t ihl = (ip[0] & 0x0FU) * 4U;
+    uint32_t udpLen = NetRead16(&ip[ihl + 4U]);
+    uint32_t sum;
+
+    sum = HostTestUdpSum(0, &ip[12], 8);
+    sum += 17U + udpLen;
+    sum = HostTestUdpSum(sum, &ip[ihl], udpLen);
+
+    return HostTestUdpFold(sum);
+}
+
+/* Both checksums of a sent frame verify, and neither was left zero */
+static uint8_t HostTestUdpValid(const uint8_t* frame)
+{
+    const uint8_t* ip = &frame[14];
+    uint32_t ihl = (ip[0] & 0x0FU) * 4U;
+
+    return (NetRead16(&frame[12]) == 0x0800U) && (ip[9] == 17U) &&
+           (HostTestUdpFold(HostTestUdpSum(0, ip, ihl)) == 0xFFFFU) &&
+           (NetRead16(&ip[10]) != 0) && (NetRead16(&ip[ihl + 6U]) != 0) &&
+           (HostTestUdpPayloadSum(frame) == 0xFFFFU);
+}
+
+/* Datagram from the peer to port 4000, both checksums filled in */
+static uint32_t HostTestUdpBuild(uint8_t* frame, const uint8_t* data, uint32_t len)
+{
+    uint8_t* ip = &frame[14];
+    uint8_t* udp = &ip[20];
+    uint32_t localIp = UDP_TEST_LOCAL_IP;
+    uint32_t peerIp = UDP_TEST_PEER_IP;
+
+    memcpy(&frame[0], udpTestLocalMac, 6);
+    memcpy(&frame[6], udpTestPeerMac, 6);
+    NetWrite16(&frame[12], 0x0800U);
+
+    memset(ip, 0, 20);
+    ip[0] = 0x45;
+    NetWrite16(&ip[2], (uint16_t)(20U + 8U + len));
+    NetWrite16(&ip[4], 0x1234);
+    ip[8] = 64;
+    ip[9] = 17;
+    memcpy(&ip[12], &peerIp, 4);
+    memcpy(&ip[16], &localIp, 4);
+    NetWrite16(&ip[10], (uint16_t)~HostTestUdpFold(HostTestUdpSum(0, ip, 20)));
+
+    NetWrite16(&udp[0], 5000);
+    NetWrite16(&udp[2], 4000);
+    NetWrite16(&udp[4], (uint16_t)(8U + len));
+    NetWrite16(&udp[6], 0);
+    memcpy(&udp[8], data, len);
+    NetWrite16(&udp[6], (uint16_t)~HostTestUdpPayloadSum(frame));
+    if (NetRead16(&udp[6]) == 0)
+    {
+        NetWrite16(&udp[6], 0xFFFF);
+    }
+
+    return 14U + 20U + 8U + len;
+}
+
+/* Inject a frame and run the receive path */
+static void HostTestUdpInject(const uint8_t* frame, uint32_t len)
+{
+    HostEthInject(frame, len);
+    UdpPoll();
+}
+
+/*!
+ * @brief       IPv4 and UDP checksums of the UDP fast path, built with
+ *              the MAC engines (UDP_SW_CHECKSUM 0, case udp_csum) or in
+ *              software (UDP_SW_CHECKSUM 1, case udp_csum_sw). Sent frames
+ *              are verified by an independent checksum; received ones are
+ *              accepted or dropped on the MAC verdict or in software.
+ *
+ * @param       None
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t HostTestUdp(void)
+{
+    static uint8_t data[301];
+    static uint8_t frame[UDP_TEST_FRAME_MAX];
+    static uint8_t tail[120];
+    UdpConfig_T config = { .ip = UDP_TEST_LOCAL_IP, .netmask = NET_IP4(255, 255, 255, 0) };
+    UdpStats_T stats;
+    EthBuf_T ref;
+    EthBuf_T* buf;
+    uint8_t mac[6];
+    uint32_t expectSw;
+    uint32_t len, i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 13U + 0xF1U);
+    }
+    for (i = 0; i < sizeof(tail); i++)
+    {
+        tail[i] = (uint8_t)(0xFFU - i);
+    }
+
+    HostEthSetSink(HostTestUdpSink);
+    EthBufInit();
+    /* Receive checksum checking in the MAC */
+    ETH->CFG_B.IPC = 1;
+    ETH_Start();
+    memcpy(config.mac, udpTestLocalMac, 6);
+    UdpInit(&config);
+    HOST_CHECK(UdpBind(4000, HostTestUdpRecv) == UDP_OK);
+
+    /* The first send asks for the peer's address; its reply fills the cache */
+    HOST_CHECK(UdpSend(UDP_TEST_PEER_IP, 5000, 4000, data, 1) == UDP_ERR_ARP);
+    HOST_CHECK((udpSentCount == 1U) && (NetRead16(&udpSent[12]) == 0x0806U));
+    memcpy(frame, udpSent, 42);
+    memcpy(&frame[0], udpTestLocalMac, 6);
+    memcpy(&frame[6], udpTestPeerMac, 6);
+    NetWrite16(&frame[20], 2);
+    memcpy(&frame[22], udpTestPeerMac, 6);
+    memcpy(&frame[28], &udpSent[38], 4);
+    memcpy(&frame[32], udpTestLocalMac, 6);
+    memcpy(&frame[38], &udpSent[28], 4);
+    HostTestUdpInject(frame, 42);
+    HOST_CHECK(UdpArpLookup(UDP_TEST_PEER_IP, mac) && (memcmp(mac, udpTestPeerMac, 6) == 0));
+
+    /* Odd and even lengths, copied into the pool */
+    for (len = 1; len <= sizeof(data); len += 75U)
+    {
+        HOST_CHECK(UdpSend(UDP_TEST_PEER_IP, 5000, 4000, data, (uint16_t)len) == UDP_OK);
+        HOST_CHECK(udpSentLen == UDP_HEADER_LEN + len);
+        HOST_CHECK(HostTestUdpValid(udpSent));
+        HOST_CHECK(memcmp(&udpSent[UDP_HEADER_LEN], data, len) == 0);
+    }
+
+    /* Payload chain split at an odd offset */
+    buf = EthBufAlloc(73);
+    HOST_CHECK(buf != NULL);
+    memcpy(buf->payload, data, 73);
+    EthBufInitRef(&ref, tail, sizeof(tail), HostTestUdpRelease);
+    EthBufChain(buf, &ref);
+    HOST_CHECK(UdpSendTo(UDP_TEST_PEER_IP, 5000, 4000, buf) == UDP_OK);
+    HOST_CHECK(udpSentLen == UDP_HEADER_LEN + 73U + sizeof(tail));
+    HOST_CHECK(HostTestUdpValid(udpSent));
+    HOST_CHECK(memcmp(&udpSent[UDP_HEADER_LEN + 73U], tail, sizeof(tail)) == 0);
+
+    /* Receive, checked by the MAC (software with UDP_SW_CHECKSUM) */
+    expectSw = UDP_SW_CHECKSUM ? 1U : 0U;
+    len = HostTestUdpBuild(frame, data, 101);
+    HostTestUdpInject(frame, len);
+    HOST_CHECK((udpReceivedCount == 1U) && (udpReceivedLen == 101U));
+    HOST_CHECK(memcmp(udpReceived, data, 101) == 0);
+    UdpStats(&stats);
+    HOST_CHECK((stats.rxSwChecksum == expectSw) && (stats.rxChecksumErr == 0));
+
+    /* Bad UDP checksum, then bad header checksum: dropped either way */
+    frame[14 + 20 + 8 + 5] ^= 0x40U;
+    HostTestUdpInject(frame, len);
+    frame[14 + 20 + 8 + 5] ^= 0x40U;
+    frame[14 + 8] ^= 0x01U;
+    HostTestUdpInject(frame, len);
+    frame[14 + 8] ^= 0x01U;
+    expectSw += UDP_SW_CHECKSUM ? 2U : 0U;
+    UdpStats(&stats);
+    HOST_CHECK((udpReceivedCount == 1U) && (stats.rxChecksumErr == 2U));
+    HOST_CHECK(stats.rxSwChecksum == expectSw);
+
+    /* UDP checksum 0 means none was sent */
+    NetWrite16(&frame[14 + 20 + 6], 0);
+    HostTestUdpInject(frame, len);
+    HOST_CHECK(udpReceivedCount == 2U);
+    expectSw += UDP_SW_CHECKSUM ? 1U : 0U;
+
+    /* Without the MAC engine every datagram is checked in software */
+    ETH->CFG_B.IPC = 0;
+    len = HostTestUdpBuild(frame, data, 100);
+    HostTestUdpInject(frame, len);
+    frame[len - 1U] ^= 0x80U;
+    HostTestUdpInject(frame, len);
+    UdpStats(&stats);
+    HOST_CHECK((udpReceivedCount == 3U) && (udpReceivedLen == 100U));
+    HOST_CHECK((stats.rxSwChecksum == expectSw + 2U) && (stats.rxChecksumErr == 3U));
+
+    HostEthSetSink(NULL);
+
+    return SUCCESS;
+}
@@ -0,0 +1,330 @@
+/*!
+ * @file        crcgen.c
+ *
+ * @brief       Host generator for the slicing-by-N CRC tables (User/Crc.h).
+ *
+ *              Usage: crcgen [-o output.c] spec...
+ *
+ *              spec    name:width:poly:init:xorout:flags:slices
+ *
+ *              name    Preset, emitted as const CrcModel_T crc<Name>
+ *              width   8..32
+ *              poly    Normal (MSB-first) form, e.g. 0x04C11DB7
+ *              flags   r: reflected input and output, w: word order (each
+ *                      32-bit little-endian word MSB first, as the CRC
+ *                      unit sees it), - for neither
+ *              slices  1, 4 or 8 table rows
+ *
+ *              Presets with the same width, polynomial and reflection
+ *              share one table, sized for the largest slice count. The
+ *              tables are computed here instead of at startup so they live
+ *              in flash and cost no boot time.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PRESETS     32
+#define NAME_MAX        32
+
+#define FLAG_REFLECT    0x01U
+#define FLAG_WORD_ORDER 0x02U
+
+/**
+ * @brief One preset from the command line
+ */
+typedef struct
+{
+    char        name[NAME_MAX];
+    uint32_t    width;
+    uint32_t    poly;
+    uint32_t    init;
+    uint32_t    xorOut;
+    uint32_t    flags;
+    uint32_t    slices;
+    int         table;      /*!< Index of the preset owning the table */
+    uint32_t    rows;       /*!< Owner only: rows emitted */
+} Preset_T;
+
+static Preset_T presets[MAX_PRESETS];
+static int presetCount;
+
+static uint32_t Reflect(uint32_t value, uint32_t bits)
+{
+    uint32_t result = 0;
+    uint32_t i;
+
+    for (i = 0; i < bits; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1U);
+    }
+
+    return result;
+}
+
+/*
+ * Row 0 is the register after one byte; row k advances it by k more zero
+ * bytes. Reflected tables keep the register in the low bits, MSB-first
+ * tables keep it in the top bits of the word.
+ */
+static void BuildTable(const Preset_T* preset, uint32_t rows, uint32_t table[8][256])
+{
+    uint32_t value, bit, row;
+    uint32_t i;
+
+    for (i = 0; i < 256; i++)
+    {
+        if ((preset->flags & FLAG_REFLECT) != 0)
+        {
+            uint32_t poly = Reflect(preset->poly, preset->width);
+
+            value = i;
+            for (bit = 0; bit < 8; bit++)
+            {
+                value = (value & 1U) ? ((value >> 1) ^ poly) : (value >> 1);
+            }
+        }
+        else
+        {
+            uint32_t poly = preset->poly << (32U - preset->width);
+
+            value = i << 24;
+            for (bit = 0; bit < 8; bit++)
+            {
+                value = (value & 0x80000000U) ? ((value << 1) ^ poly) : (value << 1);
+            }
+        }
+        table[0][i] = value;
+    }
+
+    for (row = 1; row < rows; row++)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            value = table[row - 1][i];
+            if ((preset->flags & FLAG_REFLECT) != 0)
+            {
+                table[row][i] = (value >> 8) ^ table[0][value & 0xFFU];
+            }
+            else
+            {
+                table[row][i] = (value << 8) ^ table[0][value >> 24];
+            }
+        }
+    }
+}
+
+static int ParsePreset(const char* spec, Preset_T* preset)
+{
+    char flags[8];
+    char* end;
+    const char* field = spec;
+    const char* colon = strchr(field, ':');
+    size_t length;
+
+    if ((colon == NULL) || (colon == field) || ((size_t)(colon - field) >= NAME_MAX))
+    {
+        return -1;
+    }
+    length = (size_t)(colon - field);
+    memcpy(preset->name, field, length);
+    preset->name[length] = '\0';
+
+    field = colon + 1;
+    preset->width = (uint32_t)strtoul(field, &end, 0);
+    if ((*end != ':') || (preset->width < 8) || (preset->width > 32))
+    {
+        return -1;
+    }
+    preset->poly = (uint32_t)strtoul(end + 1, &end, 0);
+    if (*end != ':')
+    {
+        return -1;
+    }
+    preset->init = (uint32_t)strtoul(end + 1, &end, 0);
+    if (*end != ':')
+    {
+        return -1;
+    }
+    preset->xorOut = (uint32_t)strtoul(end + 1, &end, 0);
+    if (*end != ':')
+    {
+        return -1;
+    }
+
+    field = end + 1;
+    colon = strchr(field, ':');
+    if ((colon == NULL) || ((size_t)(colon - field) >= sizeof(flags)))
+    {
+        return -1;
+    }
+    memcpy(flags, field, (size_t)(colon - field));
+    flags[colon - field] = '\0';
+    preset->flags = 0;
+    preset->flags |= (strchr(flags, 'r') != NULL) ? FLAG_REFLECT : 0U;
+    preset->flags |= (strchr(flags, 'w') != NULL) ? FLAG_WORD_ORDER : 0U;
+    if ((preset->flags == (FLAG_REFLECT | FLAG_WORD_ORDER)))
+    {
+        /* The CRC unit is MSB first */
+        return -1;
+    }
+
+    preset->slices = (uint32_t)strtoul(colon + 1, &end, 0);
+    if ((*end != '\0') || ((preset->slices != 1) && (preset->slices != 4) && (preset->slices != 8)))
+    {
+        return -1;
+    }
+
+    if (preset->width < 32)
+    {
+        uint32_t mask = (1UL << preset->width) - 1U;
+
+        if (((preset->poly | preset->init | preset->xorOut) & ~mask) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void EmitTable(FILE* out, const Preset_T* preset)
+{
+    static uint32_t table[8][256];
+    uint32_t row, i;
+
+    BuildTable(preset, preset->rows, table);
+
+    fprintf(out, "\n/* Width %lu, polynomial 0x%08lX, %s */\n",
+            (unsigned long)preset->width, (unsigned long)preset->poly,
+            ((preset->flags & FLAG_REFLECT) != 0) ? "reflected" : "MSB first, top-aligned");
+    fprintf(out, "static const uint32_t crcTable%s[%lu][256] =\n{\n", preset->name, (unsigned long)preset->rows);
+    for (row = 0; row < preset->rows; row++)
+    {
+        fprintf(out, "    {\n");
+        for (i = 0; i < 256; i++)
+        {
+            fprintf(out, "%s0x%08lXU%s", ((i & 7U) == 0) ? "        " : " ",
+                    (unsigned long)table[row][i], (i == 255) ? "\n" : (((i & 7U) == 7) ? ",\n" : ","));
+        }
+        fprintf(out, "    }%s\n", (row + 1 < preset->rows) ? "," : "");
+    }
+    fprintf(out, "};\n");
+}
+
+static void EmitPreset(FILE* out, const Preset_T* preset)
+{
+    const char* flags = "0";
+
+    if ((preset->flags & FLAG_REFLECT) != 0)
+    {
+        flags = "CRC_REFLECT";
+    }
+    else if ((preset->flags & FLAG_WORD_ORDER) != 0)
+    {
+        flags = "CRC_WORD_ORDER";
+    }
+
+    fprintf(out, "\nconst CrcModel_T crc%s =\n{\n", preset->name);
+    fprintf(out, "    .table = crcTable%s,\n", presets[preset->table].name);
+    fprintf(out, "    .poly = 0x%08lXU,\n", (unsigned long)preset->poly);
+    fprintf(out, "    .init = 0x%08lXU,\n", (unsigned long)preset->init);
+    fprintf(out, "    .xorOut = 0x%08lXU,\n", (unsigned long)preset->xorOut);
+    fprintf(out, "    .width = %lu,\n", (unsigned long)preset->width);
+    fprintf(out, "    .flags = %s,\n", flags);
+    fprintf(out, "    .slices = %lu,\n", (unsigned long)preset->slices);
+    fprintf(out, "};\n");
+}
+
+int main(int argc, char** argv)
+{
+    FILE* out = stdout;
+    const char* outName = NULL;
+    int argi = 1;
+    int i, j;
+
+    if ((argc > 2) && (strcmp(argv[1], "-o") == 0))
+    {
+        outName = argv[2];
+        argi = 3;
+    }
+
+    if (argi >= argc)
+    {
+        fprintf(stderr, "usage: %s [-o output.c] name:width:poly:init:xorout:flags:slices...\n", argv[0]);
+        return 2;
+    }
+
+    for (; argi < argc; argi++)
+    {
+        Preset_T* preset = &presets[presetCount];
+
+        if (presetCount == MAX_PRESETS)
+        {
+            fprintf(stderr, "crcgen: more than %d presets\n", MAX_PRESETS);
+            return 2;
+        }
+        if (ParsePreset(argv[argi], preset) != 0)
+        {
+            fprintf(stderr, "crcgen: bad spec '%s'\n", argv[argi]);
+            return 2;
+        }
+
+        /* Share the table of an earlier preset with the same polynomial */
+        preset->table = presetCount;
+        preset->rows = preset->slices;
+        for (j = 0; j < presetCount; j++)
+        {
+            if ((presets[j].table == j) && (presets[j].width == preset->width) &&
+                (presets[j].poly == preset->poly) &&
+                ((presets[j].flags & FLAG_REFLECT) == (preset->flags & FLAG_REFLECT)))
+            {
+                preset->table = j;
+                if (presets[j].rows < preset->slices)
+                {
+                    presets[j].rows = preset->slices;
+                }
+                break;
+            }
+        }
+        presetCount++;
+    }
+
+    if (outName != NULL)
+    {
+        out = fopen(outName, "w");
+        if (out == NULL)
+        {
+            perror(outName);
+            return 1;
+        }
+    }
+
+    fprintf(out, "/*!\n * @file        CrcTables.c\n *\n");
+    fprintf(out, " * @brief       CRC presets and their slicing tables. Generated by\n");
+    fprintf(out, " *              Tools/crcgen, do not edit; regenerate with the\n");
+    fprintf(out, " *              crc_tables target of the host build.\n */\n\n");
+    fprintf(out, "#include \"Crc.h\"\n");
+
+    for (i = 0; i < presetCount; i++)
+    {
+        if (presets[i].table == i)
+        {
+            EmitTable(out, &presets[i]);
+        }
+    }
+    for (i = 0; i < presetCount; i++)
+    {
+        EmitPreset(out, &presets[i]);
+    }
+
+    if ((out != stdout) && (fclose(out) != 0))
+    {
+        perror(outName);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,523 @@
+/*!
+ * @file        LogDecode.c
+ *
+ * @brief       Decoder for the deferred binary log stream (User/Log.h).
+ *
+ *              Reads the .logstr section and the loadable sections of the
+ *              firmware ELF, then turns binary log frames back into text.
+ *              Bytes that are not part of a valid frame (e.g. plain PRINT
+ *              output) are passed through unchanged, and a byte that only
+ *              looks like the start of a frame is released as text as soon
+ *              as the frame proves invalid.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LogDecode.h"
+
+#define FRAME_MAX       (2 + 4 * (1 + LOG_DECODE_MAX_ARGS))
+
+#define SHT_PROGBITS    1U
+#define SHF_ALLOC       2U
+
+#define ELFCLASS32      1U
+#define ELFCLASS64      2U
+
+/* ELF structures, declared locally so the tool also builds without <elf.h> */
+typedef struct
+{
+    uint8_t  ident[16];
+    uint16_t type;
+    uint16_t machine;
+    uint32_t version;
+    uint32_t entry;
+    uint32_t phoff;
+    uint32_t shoff;
+    uint32_t flags;
+    uint16_t ehsize;
+    uint16_t phentsize;
+    uint16_t phnum;
+    uint16_t shentsize;
+    uint16_t shnum;
+    uint16_t shstrndx;
+} Elf32Ehdr_T;
+
+typedef struct
+{
+    uint32_t name;
+    uint32_t type;
+    uint32_t flags;
+    uint32_t addr;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t link;
+    uint32_t info;
+    uint32_t addralign;
+    uint32_t entsize;
+} Elf32Shdr_T;
+
+typedef struct
+{
+    uint8_t  ident[16];
+    uint16_t type;
+    uint16_t machine;
+    uint32_t version;
+    uint64_t entry;
+    uint64_t phoff;
+    uint64_t shoff;
+    uint32_t flags;
+    uint16_t ehsize;
+    uint16_t phentsize;
+    uint16_t phnum;
+    uint16_t shentsize;
+    uint16_t shnum;
+    uint16_t shstrndx;
+} Elf64Ehdr_T;
+
+typedef struct
+{
+    uint32_t name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t addr;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint32_t info;
+    uint64_t addralign;
+    uint64_t entsize;
+} Elf64Shdr_T;
+
+/* Section header fields the decoder uses, from either class */
+typedef struct
+{
+    uint32_t name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t addr;
+    uint64_t offset;
+    uint64_t size;
+} Section_T;
+
+typedef struct
+{
+    uint32_t       addr;
+    uint32_t       size;
+    const uint8_t* data;
+} Region_T;
+
+static uint8_t* elfData;
+static size_t elfSize;
+static Region_T logStr;
+static Region_T regions[64];
+static unsigned regionCount;
+
+/* Capture bytes not decoded yet */
+static uint8_t pending[FRAME_MAX];
+static size_t pendingLen;
+
+static const char* levelName[] = { "???", "ERR", "WRN", "INF", "DBG" };
+
+static uint8_t* ReadFile(const char* path, size_t* size)
+{
+    FILE* f = fopen(path, "rb");
+    uint8_t* buf;
+    long len;
+
+    if (f == NULL)
+    {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1);
+    if ((buf != NULL) && (fread(buf, 1, (size_t)len, f) != (size_t)len))
+    {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    *size = (size_t)len;
+
+    return buf;
+}
+
+/* Section header i of the image, either class */
+static void ReadSection(unsigned elfClass, uint64_t shoff, unsigned i, Section_T* sec)
+{
+    if (elfClass == ELFCLASS32)
+    {
+        const Elf32Shdr_T* sh = (const Elf32Shdr_T*)(elfData + shoff) + i;
+
+        sec->name = sh->name;
+        sec->type = sh->type;
+        sec->flags = sh->flags;
+        sec->addr = sh->addr;
+        sec->offset = sh->offset;
+        sec->size = sh->size;
+    }
+    else
+    {
+        const Elf64Shdr_T* sh = (const Elf64Shdr_T*)(elfData + shoff) + i;
+
+        sec->name = sh->name;
+        sec->type = sh->type;
+        sec->flags = sh->flags;
+        sec->addr = sh->addr;
+        sec->offset = sh->offset;
+        sec->size = sh->size;
+    }
+}
+
+/*!
+ * @brief       Load the format strings and the loadable sections of a
+ *              firmware image.
+ *
+ * @param       path:  Little-endian ELF32 (target) or ELF64 (host build)
+ *
+ * @retval      0, or -1 after a message on stderr
+ *
+ * @note        Frames carry 32-bit addresses: ELF64 sections above 4 GiB
+ *              are skipped.
+ */
+int LogDecodeLoadElf(const char* path)
+{
+    Section_T sec;
+    const char* shstr;
+    uint64_t shoff;
+    size_t shsize;
+    unsigned elfClass, shnum, shstrndx, i;
+
+    elfData = ReadFile(path, &elfSize);
+    if ((elfData == NULL) || (elfSize < sizeof(Elf64Ehdr_T)))
+    {
+        fprintf(stderr, "logdecode: cannot read %s\n", path);
+        return -1;
+    }
+
+    elfClass = elfData[4];
+    if ((memcmp(elfData, "\177ELF", 4) != 0) || (elfData[5] != 1) ||
+        ((elfClass != ELFCLASS32) && (elfClass != ELFCLASS64)))
+    {
+        fprintf(stderr, "logdecode: %s is not a little-endian ELF file\n", path);
+        return -1;
+    }
+    if (elfClass == ELFCLASS32)
+    {
+        const Elf32Ehdr_T* eh = (const Elf32Ehdr_T*)elfData;
+
+        shoff = eh->shoff;
+        shnum = eh->shnum;
+        shstrndx = eh->shstrndx;
+        shsize = sizeof(Elf32Shdr_T);
+    }
+    else
+    {
+        const Elf64Ehdr_T* eh = (const Elf64Ehdr_T*)elfData;
+
+        shoff = eh->shoff;
+        shnum = eh->shnum;
+        shstrndx = eh->shstrndx;
+        shsize = sizeof(Elf64Shdr_T);
+    }
+    if ((shoff + (uint64_t)shnum * shsize > elfSize) || (shstrndx >= shnum))
+    {
+        fprintf(stderr, "logdecode: %s has a truncated section table\n", path);
+        return -1;
+    }
+
+    ReadSection(elfClass, shoff, shstrndx, &sec);
+    shstr = (const char*)elfData + sec.offset;
+
+    for (i = 0; i < shnum; i++)
+    {
+        ReadSection(elfClass, shoff, i, &sec);
+        if ((sec.type != SHT_PROGBITS) || (sec.offset + sec.size > elfSize) ||
+            (sec.addr + sec.size > 0x100000000ULL))
+        {
+            continue;
+        }
+
+        if (strcmp(shstr + sec.name, ".logstr") == 0)
+        {
+            logStr.addr = (uint32_t)sec.addr;
+            logStr.size = (uint32_t)sec.size;
+            logStr.data = elfData + sec.offset;
+        }
+        else if (((sec.flags & SHF_ALLOC) != 0) && (regionCount < sizeof(regions) / sizeof(regions[0])))
+        {
+            regions[regionCount].addr = (uint32_t)sec.addr;
+            regions[regionCount].size = (uint32_t)sec.size;
+            regions[regionCount].data = elfData + sec.offset;
+            regionCount++;
+        }
+    }
+
+    if (logStr.data == NULL)
+    {
+        fprintf(stderr, "logdecode: no .logstr section in %s\n", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+static const char* LookupFormat(uint32_t id)
+{
+    if ((id < logStr.addr) || (id - logStr.addr >= logStr.size))
+    {
+        return NULL;
+    }
+    /* Must be a NUL-terminated string inside the section */
+    if (memchr(logStr.data + (id - logStr.addr), 0, logStr.size - (id - logStr.addr)) == NULL)
+    {
+        return NULL;
+    }
+
+    return (const char*)logStr.data + (id - logStr.addr);
+}
+
+static const char* LookupString(uint32_t addr)
+{
+    unsigned i;
+
+    for (i = 0; i < regionCount; i++)
+    {
+        if ((addr >= regions[i].addr) && (addr - regions[i].addr < regions[i].size) &&
+            (memchr(regions[i].data + (addr - regions[i].addr), 0, regions[i].size - (addr - regions[i].addr)) != NULL))
+        {
+            return (const char*)regions[i].data + (addr - regions[i].addr);
+        }
+    }
+
+    return "<?>";
+}
+
+/*!
+ * @brief       printf-style formatting driven by raw 32-bit argument words.
+ */
+static void Format(FILE* out, const char* fmt, const uint32_t* args, unsigned nargs)
+{
+    unsigned argi = 0;
+    char spec[32];
+    size_t n;
+
+    while (*fmt != '\0')
+    {
+        if ((*fmt != '%') || (fmt[1] == '%'))
+        {
+            fputc(*fmt, out);
+            fmt += (*fmt == '%') ? 2 : 1;
+            continue;
+        }
+
+        /* Copy flags, width and precision, drop length modifiers */
+        n = 0;
+        spec[n++] = *fmt++;
+        while ((*fmt != '\0') && (strchr("-+ #0123456789.*", *fmt) != NULL) && (n < sizeof(spec) - 2))
+        {
+            if (*fmt == '*')
+            {
+                n += (size_t)snprintf(&spec[n], sizeof(spec) - n - 2, "%d",
+                                      (argi < nargs) ? (int32_t)args[argi++] : 0);
+                fmt++;
+                continue;
+            }
+            spec[n++] = *fmt++;
+        }
+        while ((*fmt != '\0') && (strchr("hlLqjzt", *fmt) != NULL))
+        {
+            fmt++;
+        }
+        if (*fmt == '\0')
+        {
+            break;
+        }
+
+        spec[n++] = *fmt;
+        spec[n] = '\0';
+
+        {
+            uint32_t word = (argi < nargs) ? args[argi++] : 0;
+
+            switch (*fmt)
+            {
+                case 'd':
+                case 'i':
+                    fprintf(out, spec, (int)(int32_t)word);
+                    break;
+                case 'u':
+                case 'x':
+                case 'X':
+                case 'o':
+                case 'c':
+                    fprintf(out, spec, (unsigned)word);
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A':
+                {
+                    float value;
+
+                    memcpy(&value, &word, sizeof(value));
+                    fprintf(out, spec, (double)value);
+                    break;
+                }
+                case 's':
+                    fprintf(out, spec, LookupString(word));
+                    break;
+                case 'p':
+                    fprintf(out, "0x%08x", (unsigned)word);
+                    break;
+                default:
+                    fputs(spec, out);
+                    break;
+            }
+        }
+        fmt++;
+    }
+}
+
+static void PrintFrame(FILE* out, const uint8_t* frame)
+{
+    unsigned level = frame[1] >> 4;
+    unsigned nargs = frame[1] & 0x0FU;
+    uint32_t words[1 + LOG_DECODE_MAX_ARGS];
+    const char* fmt;
+    size_t len;
+
+    memcpy(words, &frame[2], 4 * (1 + nargs));
+    fmt = LookupFormat(words[0]);
+
+    fprintf(out, "[%s] ", levelName[level]);
+    Format(out, fmt, &words[1], nargs);
+
+    /* One record per line regardless of the format's own line ending */
+    len = strlen(fmt);
+    if ((len == 0) || (fmt[len - 1] != '\n'))
+    {
+        fputc('\n', out);
+    }
+}
+
+/*!
+ * @brief       Check whether buf holds the start of a valid frame.
+ *
+ * @retval      Frame length when complete and valid, 0 when more bytes are
+ *              needed, -1 when buf[0] does not start a frame.
+ */
+static int FrameLength(const uint8_t* buf, size_t have)
+{
+    unsigned level, nargs;
+    uint32_t id;
+    size_t len;
+
+    if (buf[0] != LOG_DECODE_SYNC)
+    {
+        return -1;
+    }
+    if (have < 2)
+    {
+        return 0;
+    }
+
+    level = buf[1] >> 4;
+    nargs = buf[1] & 0x0FU;
+    if ((level < 1) || (level > 4) || (nargs > LOG_DECODE_MAX_ARGS))
+    {
+        return -1;
+    }
+
+    len = 2 + 4 * (1 + (size_t)nargs);
+    if (have < 6)
+    {
+        return 0;
+    }
+
+    memcpy(&id, &buf[2], sizeof(id));
+    if (LookupFormat(id) == NULL)
+    {
+        return -1;
+    }
+
+    return (have < len) ? 0 : (int)len;
+}
+
+/*!
+ * @brief       Decode capture bytes.
+ *
+ * @param       out:   Text output
+ *
+ * @param       data:  Capture bytes, frames mixed with plain text
+ *
+ * @param       len:   Number of bytes
+ *
+ * @retval      None
+ */
+void LogDecodeFeed(FILE* out, const uint8_t* data, size_t len)
+{
+    int frameLen;
+
+    while (len-- != 0)
+    {
+        pending[pendingLen++] = *data++;
+
+        /* Resynchronize byte by byte until the buffer starts a frame */
+        while (pendingLen > 0)
+        {
+            frameLen = FrameLength(pending, pendingLen);
+            if (frameLen == 0)
+            {
+                break;
+            }
+            if (frameLen > 0)
+            {
+                PrintFrame(out, pending);
+                pendingLen -= (size_t)frameLen;
+                memmove(pending, &pending[frameLen], pendingLen);
+                continue;
+            }
+            fputc(pending[0], out);
+            pendingLen--;
+            memmove(pending, &pending[1], pendingLen);
+        }
+    }
+}
+
+/*!
+ * @brief       End of the capture: a partial frame is text after all.
+ *
+ * @param       out:  Text output
+ *
+ * @retval      None
+ */
+void LogDecodeFlush(FILE* out)
+{
+    fwrite(pending, 1, pendingLen, out);
+    pendingLen = 0;
+}
+
+/*!
+ * @brief       Release the ELF image and reset the decoder.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void LogDecodeFree(void)
+{
+    free(elfData);
+    elfData = NULL;
+    elfSize = 0;
+    memset(&logStr, 0, sizeof(logStr));
+    regionCount = 0;
+    pendingLen = 0;
+}
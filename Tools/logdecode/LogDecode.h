@@ -0,0 +1,32 @@
+/*!
+ * @file        LogDecode.h
+ *
+ * @brief       Decoder for the deferred binary log stream (User/Log.h),
+ *              shared by the logdecode tool and the host tests.
+ */
+
+#ifndef LOG_DECODE_H
+#define LOG_DECODE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define LOG_DECODE_SYNC     0xA5U
+#define LOG_DECODE_MAX_ARGS 8
+
+/* Read .logstr and the loadable sections of a little-endian ELF32 or
+   ELF64 file; 0 on success */
+int LogDecodeLoadElf(const char* path);
+
+/* Turn capture bytes into text on out; bytes outside valid frames pass
+   through unchanged, a partial frame waits for the next call */
+void LogDecodeFeed(FILE* out, const uint8_t* data, size_t len);
+
+/* Pass a trailing partial frame through as text */
+void LogDecodeFlush(FILE* out);
+
+/* Release the ELF image and the decoder state */
+void LogDecodeFree(void);
+
+#endif // LOG_DECODE_H
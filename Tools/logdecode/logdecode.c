@@ -0,0 +1,63 @@
+/*!
+ * @file        logdecode.c
+ *
+ * @brief       Host decoder for the deferred binary log stream (User/Log.h).
+ *
+ *              Usage: logdecode <firmware.elf> [capture.bin]
+ *
+ *              Reads the .logstr section and the loadable sections of the
+ *              firmware ELF, then turns binary log frames read from the
+ *              capture file (or stdin) back into text (LogDecode.c). Bytes
+ *              that are not part of a valid frame (e.g. plain PRINT
+ *              output) are passed through unchanged.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "LogDecode.h"
+
+int main(int argc, char** argv)
+{
+    FILE* in = stdin;
+    uint8_t byte;
+    int c;
+
+    if ((argc < 2) || (argc > 3))
+    {
+        fprintf(stderr, "usage: %s <firmware.elf> [capture.bin]\n", argv[0]);
+        return 2;
+    }
+    if (LogDecodeLoadElf(argv[1]) != 0)
+    {
+        return 1;
+    }
+    if ((argc == 3) && (strcmp(argv[2], "-") != 0))
+    {
+        in = fopen(argv[2], "rb");
+        if (in == NULL)
+        {
+            fprintf(stderr, "logdecode: cannot open %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    /* Byte by byte, so a live stream is decoded as it arrives */
+    while ((c = fgetc(in)) != EOF)
+    {
+        byte = (uint8_t)c;
+        LogDecodeFeed(stdout, &byte, 1);
+        fflush(stdout);
+    }
+
+    /* Trailing partial frame is passed through as text */
+    LogDecodeFlush(stdout);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    LogDecodeFree();
+
+    return 0;
+}
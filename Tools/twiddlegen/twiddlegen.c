@@ -0,0 +1,128 @@
+/*!
+ * @file        twiddlegen.c
+ *
+ * @brief       Host generator for the FFT twiddle factors (User/Dsp.h).
+ *
+ *              Usage: twiddlegen [-o output.c] length
+ *
+ *              length  Largest FFT, a power of 4 (DSP_FFT_MAX)
+ *
+ *              Emits cos and sin of 2*pi*k/length for k < 3*length/4, the
+ *              factors a radix-4 FFT of that length uses; shorter FFTs take
+ *              every (length/n)-th entry. Q15 values are rounded here, once,
+ *              so every build of the Q15 FFT multiplies by the same
+ *              factors and its results are bit-exact across targets.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PER_LINE    8
+
+static long Q15(double value)
+{
+    long q = lround(value * 32768.0);
+
+    return (q > 32767) ? 32767 : q;
+}
+
+/* Nine digits read back as the same float; always a valid literal */
+static const char* F32(char* buf, double value)
+{
+    sprintf(buf, "%.9g", (float)value);
+    if (strpbrk(buf, ".e") == NULL)
+    {
+        strcat(buf, ".0");
+    }
+    strcat(buf, "f");
+
+    return buf;
+}
+
+int main(int argc, char** argv)
+{
+    FILE* out = stdout;
+    const char* outName = NULL;
+    const double pi = 3.14159265358979323846;
+    unsigned long length, count, k, n;
+    char re[32], im[32];
+    int argi = 1;
+
+    if ((argc > 2) && (strcmp(argv[1], "-o") == 0))
+    {
+        outName = argv[2];
+        argi = 3;
+    }
+
+    if (argi + 1 != argc)
+    {
+        fprintf(stderr, "usage: %s [-o output.c] length\n", argv[0]);
+        return 2;
+    }
+
+    length = strtoul(argv[argi], NULL, 0);
+    n = 16;
+    while (n < length)
+    {
+        n *= 4;
+    }
+    if (n != length)
+    {
+        fprintf(stderr, "twiddlegen: length must be a power of 4 from 16\n");
+        return 2;
+    }
+    count = 3 * length / 4;
+
+    if (outName != NULL)
+    {
+        out = fopen(outName, "w");
+        if (out == NULL)
+        {
+            perror(outName);
+            return 1;
+        }
+    }
+
+    fprintf(out, "/*!\n"
+                 " * @file        DspTables.c\n"
+                 " *\n"
+                 " * @brief       FFT twiddle factors. Generated by Tools/twiddlegen, do not\n"
+                 " *              edit; regenerate with the dsp_tables target of the host\n"
+                 " *              build.\n"
+                 " */\n\n"
+                 "#include \"Dsp.h\"\n\n"
+                 "#if DSP_FFT_MAX != %luU\n"
+                 "#error \"DspTables.c was generated for DSP_FFT_MAX %lu\"\n"
+                 "#endif\n", length, length);
+
+    fprintf(out, "\n/* cos, sin of 2*pi*k/%lu for k < %lu, Q15 */\n", length, count);
+    fprintf(out, "const int16_t dspTwiddleQ15[%lu] =\n{\n", 2 * count);
+    for (k = 0; k < count; k++)
+    {
+        double angle = 2.0 * pi * (double)k / (double)length;
+
+        fprintf(out, "%s%ld, %ld,%s", (k % PER_LINE) ? " " : "    ", Q15(cos(angle)), Q15(sin(angle)),
+                ((k % PER_LINE) == PER_LINE - 1) ? "\n" : "");
+    }
+    fprintf(out, "%s};\n", (count % PER_LINE) ? "\n" : "");
+
+    fprintf(out, "\n/* Same, single precision */\n");
+    fprintf(out, "const float dspTwiddleF32[%lu] =\n{\n", 2 * count);
+    for (k = 0; k < count; k++)
+    {
+        double angle = 2.0 * pi * (double)k / (double)length;
+
+        fprintf(out, "%s%s, %s,%s", (k % (PER_LINE / 2)) ? " " : "    ", F32(re, cos(angle)), F32(im, sin(angle)),
+                ((k % (PER_LINE / 2)) == PER_LINE / 2 - 1) ? "\n" : "");
+    }
+    fprintf(out, "%s};\n", (count % (PER_LINE / 2)) ? "\n" : "");
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -0,0 +1,380 @@
+#include <stddef.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_adc.h"
+#include "apm32f4xx_rcm.h"
+#include "AdcOversample.h"
+
+/* ADC_SAMPLETIME_T in ADC clock cycles */
+static const uint16_t adcOversampleCycles[8] = { 3, 15, 28, 56, 84, 112, 144, 480 };
+
+/* Clock cycles of a 12-bit conversion after sampling */
+#define ADC_OVERSAMPLE_CONVERSION   12U
+
+/*!
+ * @brief       Choose the slowest timing that still reaches a rate.
+ *
+ * @param       os:      Receives prescaler, sampleTime and rate; bits and
+ *                       channels set
+ *
+ * @param       pclk2:   APB2 clock in Hz
+ *
+ * @param       rate:    Requested results per second per channel, a lower bound
+ *
+ * @retval      SUCCESS, or ERROR when even the fastest timing is too slow
+ *
+ * @note        The ADC converts continuously, so a result per channel
+ *              takes 4^(bits - 12) scans of every channel. Slower timings
+ *              sample longer, which the source impedance welcomes; ties in
+ *              rate go to the longer sampling time.
+ */
+static uint8_t AdcOversampleTiming(AdcOversample_T* os, uint32_t pclk2, uint32_t rate)
+{
+    uint32_t perResult = (uint32_t)os->channels << (2U * (os->bits - 12U));
+    uint32_t prescaler, sampleTime, clock, candidate;
+    uint32_t best = 0;
+
+    for (prescaler = ADC_PRESCALER_DIV2; prescaler <= ADC_PRESCALER_DIV8; prescaler++)
+    {
+        clock = pclk2 / (2U * (prescaler + 1U));
+        if (clock > ADC_OVERSAMPLE_CLOCK_MAX)
+        {
+            continue;
+        }
+
+        for (sampleTime = 0; sampleTime < 8U; sampleTime++)
+        {
+            candidate = clock / ((adcOversampleCycles[sampleTime] + ADC_OVERSAMPLE_CONVERSION) * perResult);
+            if ((candidate >= rate) && ((best == 0) || (candidate <= best)))
+            {
+                best = candidate;
+                os->prescaler = (uint8_t)prescaler;
+                os->sampleTime = (uint8_t)sampleTime;
+            }
+        }
+    }
+
+    os->rate = best;
+
+    return best ? SUCCESS : ERROR;
+}
+
+/*!
+ * @brief       Sum each channel over 4^extra scans, in place.
+ *
+ * @param       samples:     frames * channels * 4^extra conversions in scan
+ *                           order; receives frames * channels results
+ *
+ * @param       frames:      Result frames
+ *
+ * @param       channels:    Channels per scan
+ *
+ * @param       extra:       Bits above 12
+ *
+ * @retval      None
+ *
+ * @note        A frame's results land before its conversions, which
+ *              have all been read by then.
+ */
+static void AdcOversampleAccumulate(uint16_t* samples, uint32_t frames, uint32_t channels, uint32_t extra)
+{
+    const uint16_t* raw = samples;
+    uint32_t sums[ADC_OVERSAMPLE_MAX_CHANNELS];
+    uint32_t scans = 1UL << (2U * extra);
+    uint32_t frame, scan, c;
+
+    for (frame = 0; frame < frames; frame++)
+    {
+        if (channels == 1U)
+        {
+            uint32_t sum = 0;
+
+            for (scan = 0; scan < scans; scan++)
+            {
+                sum += raw[scan];
+            }
+            raw += scans;
+            sums[0] = sum;
+        }
+        else
+        {
+            for (c = 0; c < channels; c++)
+            {
+                sums[c] = 0;
+            }
+            for (scan = 0; scan < scans; scan++)
+            {
+                for (c = 0; c < channels; c++)
+                {
+                    sums[c] += *raw++;
+                }
+            }
+        }
+
+        for (c = 0; c < channels; c++)
+        {
+            *samples++ = (uint16_t)(sums[c] >> extra);
+        }
+    }
+}
+
+/*!
+ * @brief       Stream callback: turn a block of conversions into results.
+ *
+ * @param       pp:      Stream of the AdcOversample_T
+ *
+ * @param       buffer:  Block the DMA has just filled
+ *
+ * @retval      None
+ */
+static void AdcOversampleDone(PingPong_T* pp, void* buffer)
+{
+    AdcOversample_T* os = pp->arg;
+
+#if !ADC_OVERSAMPLE_HARDWARE
+    if (os->bits > 12U)
+    {
+        AdcOversampleAccumulate(buffer, os->frames, os->channels, os->bits - 12U);
+    }
+#endif
+    os->callback(os, buffer, os->frames);
+}
+
+/*!
+ * @brief       Set up oversampled conversion of a channel sequence.
+ *
+ * @param       os:          Oversampling state
+ *
+ * @param       adc:         ADC1, ADC2 or ADC3
+ *
+ * @param       channel:     Channels in scan order
+ *
+ * @param       channels:    1..ADC_OVERSAMPLE_MAX_CHANNELS
+ *
+ * @param       bits:        Result width, 12..16
+ *
+ * @param       rate:        Lowest acceptable results per second per channel
+ *
+ * @param       buffer0:     First block buffer,
+ *                           ADC_OVERSAMPLE_BUFFER(channels, bits, frames) halfwords
+ *
+ * @param       buffer1:     Second block buffer
+ *
+ * @param       frames:      Result frames per block
+ *
+ * @param       callback:    Called with each block of results
+ *
+ * @param       arg:         For the callback, in os->arg
+ *
+ * @retval      SUCCESS, or ERROR on bad arguments or a rate out of reach;
+ *              os->rate holds the rate chosen
+ *
+ * @note        The rate comes from the PCLK2 in effect now.
+ */
+uint8_t AdcOversampleInit(AdcOversample_T* os, ADC_T* adc, const uint8_t* channel, uint8_t channels,
+                          uint8_t bits, uint32_t rate, uint16_t* buffer0, uint16_t* buffer1, uint32_t frames,
+                          AdcOversampleCallback_T callback, void* arg)
+{
+    uint32_t pclk1, pclk2, i;
+
+    if ((channels == 0) || (channels > ADC_OVERSAMPLE_MAX_CHANNELS) || (bits < 12U) || (bits > 16U) ||
+        (frames == 0) || (callback == NULL) ||
+        (ADC_OVERSAMPLE_BUFFER((uint32_t)channels, (uint32_t)bits, frames) > 0xFFFFU))
+    {
+        return ERROR;
+    }
+    for (i = 0; i < channels; i++)
+    {
+        if (channel[i] > ADC_CHANNEL_18)
+        {
+            return ERROR;
+        }
+        os->channel[i] = channel[i];
+    }
+
+    os->adc = adc;
+    os->channels = channels;
+    os->bits = bits;
+    os->frames = frames;
+    os->callback = callback;
+    os->arg = arg;
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    if (AdcOversampleTiming(os, pclk2, rate) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    return PingPongInit(&os->pp, buffer0, buffer1, ADC_OVERSAMPLE_BUFFER((uint32_t)channels, (uint32_t)bits, frames),
+                        2, AdcOversampleDone, os);
+}
+
+/*!
+ * @brief       Configure the ADC for continuous scanning and start it.
+ *
+ * @param       os:      Oversampling state from AdcOversampleInit()
+ *
+ * @retval      SUCCESS, or ERROR when the ADC's DMA streams are taken
+ */
+uint8_t AdcOversampleStart(AdcOversample_T* os)
+{
+    ADC_CommonConfig_T commonConfig;
+    ADC_Config_T adcConfig;
+    uint32_t i;
+
+    if (os->adc == ADC1)
+    {
+        RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_ADC1);
+    }
+    else if (os->adc == ADC2)
+    {
+        RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_ADC2);
+    }
+    else
+    {
+        RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_ADC3);
+    }
+
+    ADC_CommonConfigStructInit(&commonConfig);
+    commonConfig.prescaler = (ADC_PRESCALER_T)os->prescaler;
+    ADC_CommonConfig(&commonConfig);
+
+    ADC_ConfigStructInit(&adcConfig);
+    adcConfig.scanConvMode = (os->channels > 1U) ? ENABLE : DISABLE;
+    adcConfig.continuousConvMode = ENABLE;
+    adcConfig.nbrOfChannel = os->channels;
+    ADC_Config(os->adc, &adcConfig);
+    for (i = 0; i < os->channels; i++)
+    {
+        ADC_ConfigRegularChannel(os->adc, os->channel[i], (uint8_t)(i + 1U), os->sampleTime);
+    }
+
+#if ADC_OVERSAMPLE_HARDWARE
+    if (os->bits > 12U)
+    {
+        /* 4^e conversions per result, each channel in turn */
+        ADC_ConfigOverSamplingRatio(os->adc, (ADC_OVERSAMPLING_RATIO_T)(2U * (os->bits - 12U) - 1U));
+        ADC_ConfigOverSamplingShift(os->adc, (ADC_OVERSAMPLING_SHIFT_T)(os->bits - 12U));
+        ADC_ConfigOverSamplingTrigger(os->adc, ADC_OVERSAMPLING_TRIGGER_ALL);
+        ADC_EnableOverSampling(os->adc);
+    }
+#endif
+
+    if (PingPongStartAdc(&os->pp, os->adc) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    ADC_Enable(os->adc);
+    ADC_SoftwareStartConv(os->adc);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stop conversions and release the DMA stream.
+ *
+ * @param       os:      Oversampling state
+ *
+ * @retval      None
+ */
+void AdcOversampleStop(AdcOversample_T* os)
+{
+    ADC_Disable(os->adc);
+#if ADC_OVERSAMPLE_HARDWARE
+    ADC_DisableOverSampling(os->adc);
+#endif
+    PingPongStop(&os->pp);
+}
+
+/*!
+ * @brief       log2 in Q8.
+ *
+ * @param       value:   1 or more
+ *
+ * @retval      log2(value) * 256, rounded down
+ *
+ * @note        Integer part from the leading one; each fraction bit from
+ *              squaring the mantissa, normalized to [1, 2) in Q30.
+ */
+static uint32_t AdcOversampleLog2(uint64_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit;
+
+    while (value >= (2ULL << 30))
+    {
+        value >>= 1;
+        result += 256U;
+    }
+    while (value < (1ULL << 30))
+    {
+        value <<= 1;
+        result -= 256U;
+    }
+    result += 30U * 256U;
+
+    for (bit = 128U; bit != 0; bit >>= 1)
+    {
+        value = (value * value) >> 30;
+        if (value >= (2ULL << 30))
+        {
+            value >>= 1;
+            result += bit;
+        }
+    }
+
+    return result;
+}
+
+/*!
+ * @brief       Effective number of bits from results of a DC input.
+ *
+ * @param       results: Results
+ *
+ * @param       count:   Results to use, 2..65535
+ *
+ * @param       stride:  Distance between them (the channel count for one
+ *                       channel of interleaved frames)
+ *
+ * @param       bits:    Result width
+ *
+ * @retval      ENOB in Q8: bits - log2(sigma * sqrt(12)), at most bits
+ *
+ * @note        sigma is the standard deviation in LSBs; an ideal converter
+ *              leaves 1/sqrt(12) LSB of quantization noise. Offset and
+ *              gain errors do not count, only noise.
+ */
+uint32_t AdcOversampleEnob(const uint16_t* results, uint32_t count, uint32_t stride, uint8_t bits)
+{
+    uint64_t sum = 0;
+    uint64_t squares = 0;
+    uint32_t mean, variance, i;
+    int32_t deviation;
+
+    if ((count < 2U) || (count > 0xFFFFU))
+    {
+        return 0;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        sum += results[i * stride];
+    }
+    mean = (uint32_t)(((sum << 4) + count / 2U) / count);
+
+    /* Deviations in Q4, squares in Q8: no overflow for 16-bit results */
+    for (i = 0; i < count; i++)
+    {
+        deviation = (int32_t)((uint32_t)results[i * stride] << 4) - (int32_t)mean;
+        squares += (uint64_t)((int64_t)deviation * deviation);
+    }
+    variance = (uint32_t)(squares / count);
+
+    /* 12 sigma^2 of at most one LSB^2: no worse than ideal */
+    if (12ULL * variance <= 256U)
+    {
+        return (uint32_t)bits * 256U;
+    }
+
+    return (uint32_t)bits * 256U - (AdcOversampleLog2(12ULL * variance) - 8U * 256U) / 2U;
+}
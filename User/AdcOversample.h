@@ -0,0 +1,91 @@
+#ifndef ADC_OVERSAMPLE_H
+#define ADC_OVERSAMPLE_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_adc.h"
+#include "PingPong.h"
+
+/*
+ * 13 to 16-bit ADC results by oversampling, asked for as bits and rate.
+ *
+ * Every extra bit takes four times the conversions: a result of 12 + e
+ * bits is the sum of 4^e conversions shifted right by e, which gains e
+ * effective bits when the input carries at least about one LSB of noise.
+ * AdcOversampleInit() derives ratio and shift from the bits, then picks the
+ * ADC prescaler and the longest sampling time that still deliver the
+ * requested rate per channel, and reports the rate it gets in rate (the
+ * slowest one at or above the request).
+ *
+ * The ADC scans its channels continuously into DMA double buffers
+ * (PingPong.h). The APM32F425/427 oversample in hardware, so the DMA moves
+ * finished results. The APM32F407 has no oversampler: the DMA moves every
+ * conversion and each block is summed per channel when it completes, once
+ * per block instead of a polling loop per result. Either way the callback
+ * gets frames of results, one per channel in scan order.
+ *
+ * AdcOversampleEnob() estimates the effective bits from results of a DC
+ * input such as Vrefint (channel 17): the noise standard deviation
+ * against the quantization noise of an ideal converter of that width.
+ * The pins of the channels are configured as analog by the caller; the
+ * ADC prescaler is common to all three ADCs.
+ */
+
+/* Channels per scan */
+#ifndef ADC_OVERSAMPLE_MAX_CHANNELS
+#define ADC_OVERSAMPLE_MAX_CHANNELS 8
+#endif
+
+/* ADC clock limit; PCLK2 is divided down to this or below */
+#ifndef ADC_OVERSAMPLE_CLOCK_MAX
+#define ADC_OVERSAMPLE_CLOCK_MAX 36000000U
+#endif
+
+#if defined(APM32F425xx) || defined(APM32F427xx)
+#define ADC_OVERSAMPLE_HARDWARE 1
+#else
+#define ADC_OVERSAMPLE_HARDWARE 0
+#endif
+
+/* Halfwords per DMA buffer for frames frames of channels results of bits bits */
+#if ADC_OVERSAMPLE_HARDWARE
+#define ADC_OVERSAMPLE_BUFFER(channels, bits, frames)  ((frames) * (channels))
+#else
+#define ADC_OVERSAMPLE_BUFFER(channels, bits, frames)  ((frames) * (channels) << (2U * ((bits) - 12U)))
+#endif
+
+typedef struct AdcOversample AdcOversample_T;
+
+/* frames results per channel, interleaved in scan order; from the DMA interrupt */
+typedef void (*AdcOversampleCallback_T)(AdcOversample_T* os, uint16_t* results, uint32_t frames);
+
+/**
+ * @brief Oversampling state; rate is the achieved rate per channel, treat
+ *        the rest as opaque
+ */
+struct AdcOversample
+{
+    PingPong_T              pp;         /*!< Overruns in pp.overruns */
+    AdcOversampleCallback_T callback;
+    void*                   arg;        /*!< For the callback */
+    ADC_T*                  adc;
+    uint8_t                 channel[ADC_OVERSAMPLE_MAX_CHANNELS];
+    uint8_t                 channels;
+    uint8_t                 bits;       /*!< Result width, 12..16 */
+    uint8_t                 prescaler;  /*!< ADC_PRESCALER_T */
+    uint8_t                 sampleTime; /*!< ADC_SAMPLETIME_T */
+    uint32_t                frames;     /*!< Result frames per block */
+    uint32_t                rate;       /*!< Results per second per channel */
+};
+
+/* buffer0/1: ADC_OVERSAMPLE_BUFFER(channels, bits, frames) halfwords each */
+uint8_t AdcOversampleInit(AdcOversample_T* os, ADC_T* adc, const uint8_t* channel, uint8_t channels,
+                          uint8_t bits, uint32_t rate, uint16_t* buffer0, uint16_t* buffer1, uint32_t frames,
+                          AdcOversampleCallback_T callback, void* arg);
+uint8_t AdcOversampleStart(AdcOversample_T* os);
+void AdcOversampleStop(AdcOversample_T* os);
+
+/* Effective bits in Q8 of count results (every stride-th) of a DC input */
+uint32_t AdcOversampleEnob(const uint16_t* results, uint32_t count, uint32_t stride, uint8_t bits);
+
+#endif // ADC_OVERSAMPLE_H
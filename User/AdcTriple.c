@@ -0,0 +1,256 @@
+#include <stddef.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_adc.h"
+#include "apm32f4xx_gpio.h"
+#include "apm32f4xx_rcm.h"
+#include "AdcTriple.h"
+
+/* ADC_SAMPLETIME_T in ADC clock cycles */
+static const uint16_t adcSampleCycles[8] = { 3, 15, 28, 56, 84, 112, 144, 480 };
+
+/* Delay between two sampling phases: ADC_TWO_SAMPLING_5CYCLES + (delay - 5) */
+#define ADC_TRIPLE_DELAY_MIN    5U
+#define ADC_TRIPLE_DELAY_MAX    20U
+
+/*!
+ * @brief       Choose the evenly spaced timing closest to a sample rate.
+ *
+ * @param       at:          Receives prescaler, sampleTime, delay and rate
+ *
+ * @param       pclk2:       APB2 clock in Hz
+ *
+ * @param       resolution:  ADC_RESOLUTION_T
+ *
+ * @param       rate:        Requested samples per second, an upper bound
+ *
+ * @retval      SUCCESS, or ERROR when no timing is at or below rate
+ *
+ * @note        Each ADC converts every three delays: sampling time plus
+ *              one cycle per bit must be three times a delay of 5..20.
+ *              Ties in rate go to the longer sampling time.
+ */
+static uint8_t AdcTripleTiming(AdcTriple_T* at, uint32_t pclk2, uint8_t resolution, uint32_t rate)
+{
+    uint32_t prescaler, sampleTime, clock, cycles, candidate;
+    uint32_t bits = 12U - 2U * resolution;
+    uint32_t best = 0;
+
+    for (prescaler = ADC_PRESCALER_DIV2; prescaler <= ADC_PRESCALER_DIV8; prescaler++)
+    {
+        clock = pclk2 / (2U * (prescaler + 1U));
+        if (clock > ADC_TRIPLE_CLOCK_MAX)
+        {
+            continue;
+        }
+
+        for (sampleTime = 0; sampleTime < 8U; sampleTime++)
+        {
+            cycles = adcSampleCycles[sampleTime] + bits;
+            if (((cycles % 3U) != 0) || (cycles / 3U < ADC_TRIPLE_DELAY_MIN) || (cycles / 3U > ADC_TRIPLE_DELAY_MAX))
+            {
+                continue;
+            }
+
+            candidate = (uint32_t)(((uint64_t)clock * 3U) / cycles);
+            if ((candidate <= rate) && (candidate >= best))
+            {
+                best = candidate;
+                at->prescaler = (uint8_t)prescaler;
+                at->sampleTime = (uint8_t)sampleTime;
+                at->delay = (uint8_t)(cycles / 3U - ADC_TRIPLE_DELAY_MIN);
+            }
+        }
+    }
+
+    at->rate = best;
+
+    return best ? SUCCESS : ERROR;
+}
+
+/*!
+ * @brief       Widen byte samples to halfwords in place.
+ *
+ * @param       samples: Buffer holding count bytes, room for count halfwords
+ *
+ * @param       count:   Samples
+ *
+ * @retval      None
+ *
+ * @note        Runs from the end: halfword i never overlaps a byte not yet read.
+ */
+static void AdcTripleWiden(uint16_t* samples, uint32_t count)
+{
+    const uint8_t* bytes = (const uint8_t*)samples;
+
+    while (count > 0)
+    {
+        count--;
+        samples[count] = bytes[count];
+    }
+}
+
+/*!
+ * @brief       Stream callback: pass a finished block on as samples.
+ *
+ * @param       pp:      Stream of the AdcTriple_T
+ *
+ * @param       buffer:  Block the DMA has just filled
+ *
+ * @retval      None
+ */
+static void AdcTripleDone(PingPong_T* pp, void* buffer)
+{
+    AdcTriple_T* at = pp->arg;
+
+    if (at->resolution != ADC_RESOLUTION_12BIT)
+    {
+        AdcTripleWiden(buffer, at->samples);
+    }
+    at->callback(at, buffer, at->samples);
+}
+
+/*!
+ * @brief       Set up interleaved sampling of one channel.
+ *
+ * @param       at:          Sampling state
+ *
+ * @param       channel:     ADC channel 0-3 or 10-13
+ *
+ * @param       resolution:  ADC_RESOLUTION_12BIT, _8BIT or _6BIT
+ *
+ * @param       rate:        Highest acceptable sample rate in Hz
+ *
+ * @param       buffer0:     First block buffer, samples halfwords
+ *
+ * @param       buffer1:     Second block buffer
+ *
+ * @param       samples:     Samples per block, even, up to 131070
+ *
+ * @param       callback:    Called with each block
+ *
+ * @param       arg:         For the callback, in at->arg
+ *
+ * @retval      SUCCESS, or ERROR on bad arguments or no timing at or
+ *              below rate; at->rate holds the rate chosen
+ *
+ * @note        The rate comes from the PCLK2 in effect now.
+ */
+uint8_t AdcTripleInit(AdcTriple_T* at, uint8_t channel, ADC_RESOLUTION_T resolution, uint32_t rate,
+                      uint16_t* buffer0, uint16_t* buffer1, uint32_t samples,
+                      AdcTripleCallback_T callback, void* arg)
+{
+    uint32_t pclk1, pclk2;
+
+    if (((channel > ADC_CHANNEL_3) && ((channel < ADC_CHANNEL_10) || (channel > ADC_CHANNEL_13))) ||
+        (resolution > ADC_RESOLUTION_6BIT) || (callback == NULL) ||
+        (samples == 0) || ((samples & 1U) != 0) || (samples / 2U > 0xFFFFU) ||
+        ((((uint32_t)buffer0 | (uint32_t)buffer1) & 3U) != 0))
+    {
+        return ERROR;
+    }
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    if (AdcTripleTiming(at, pclk2, resolution, rate) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    at->callback = callback;
+    at->arg = arg;
+    at->samples = samples;
+    at->channel = channel;
+    at->resolution = (uint8_t)resolution;
+
+    /* Two samples per DMA item: a word of 12-bit samples, a halfword of bytes */
+    return PingPongInit(&at->pp, buffer0, buffer1, samples / 2U,
+                        (resolution == ADC_RESOLUTION_12BIT) ? 4U : 2U, AdcTripleDone, at);
+}
+
+/*!
+ * @brief       Configure the ADCs and start sampling.
+ *
+ * @param       at:      Sampling state from AdcTripleInit()
+ *
+ * @retval      SUCCESS, or ERROR when the ADC1 DMA streams are taken
+ *
+ * @note        ADC1 is started by software; ADC2 and ADC3 follow it.
+ */
+uint8_t AdcTripleStart(AdcTriple_T* at)
+{
+    ADC_T* const adcs[3] = { ADC1, ADC2, ADC3 };
+    ADC_CommonConfig_T commonConfig;
+    ADC_Config_T adcConfig;
+    GPIO_Config_T gpioConfig;
+    uint32_t i;
+
+    RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_ADC1 | RCM_APB2_PERIPH_ADC2 | RCM_APB2_PERIPH_ADC3);
+
+    /* Channels 0-3 are PA0-PA3, 10-13 PC0-PC3 */
+    GPIO_ConfigStructInit(&gpioConfig);
+    gpioConfig.mode = GPIO_MODE_AN;
+    gpioConfig.pupd = GPIO_PUPD_NOPULL;
+    gpioConfig.pin = (uint16_t)(GPIO_PIN_0 << (at->channel & 3U));
+    if (at->channel < ADC_CHANNEL_10)
+    {
+        RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_GPIOA);
+        GPIO_Config(GPIOA, &gpioConfig);
+    }
+    else
+    {
+        RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_GPIOC);
+        GPIO_Config(GPIOC, &gpioConfig);
+    }
+
+    commonConfig.prescaler = (ADC_PRESCALER_T)at->prescaler;
+    commonConfig.mode = ADC_MODE_TRIPLE_INTERL;
+    commonConfig.accessMode = (at->resolution == ADC_RESOLUTION_12BIT) ? ADC_ACCESS_MODE_2 : ADC_ACCESS_MODE_3;
+    commonConfig.twoSampling = (ADC_TWO_SAMPLING_T)at->delay;
+    ADC_CommonConfig(&commonConfig);
+
+    ADC_ConfigStructInit(&adcConfig);
+    adcConfig.resolution = (ADC_RESOLUTION_T)at->resolution;
+    adcConfig.continuousConvMode = ENABLE;
+    for (i = 0; i < 3U; i++)
+    {
+        ADC_Config(adcs[i], &adcConfig);
+        ADC_ConfigRegularChannel(adcs[i], at->channel, 1, at->sampleTime);
+    }
+
+    /* Requests continue past the end of each block */
+    ADC_EnableMultiModeDMARequest();
+    if (PingPongStart(&at->pp, DMA_REQ_ADC1, (uint32_t)&ADC->CDATA, 0) != SUCCESS)
+    {
+        ADC_DisableMultiModeDMARequest();
+        return ERROR;
+    }
+
+    for (i = 0; i < 3U; i++)
+    {
+        ADC_Enable(adcs[i]);
+    }
+    ADC_SoftwareStartConv(ADC1);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stop sampling and return the ADCs to independent mode.
+ *
+ * @param       at:      Sampling state
+ *
+ * @retval      None
+ */
+void AdcTripleStop(AdcTriple_T* at)
+{
+    ADC_CommonConfig_T commonConfig;
+
+    ADC_Disable(ADC1);
+    ADC_Disable(ADC2);
+    ADC_Disable(ADC3);
+    ADC_DisableMultiModeDMARequest();
+    PingPongStop(&at->pp);
+
+    ADC_CommonConfigStructInit(&commonConfig);
+    commonConfig.prescaler = (ADC_PRESCALER_T)at->prescaler;
+    ADC_CommonConfig(&commonConfig);
+}
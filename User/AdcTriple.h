@@ -0,0 +1,68 @@
+#ifndef ADC_TRIPLE_H
+#define ADC_TRIPLE_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_adc.h"
+#include "PingPong.h"
+
+/*
+ * One analog input sampled by ADC1, ADC2 and ADC3 in triple interleaved
+ * mode, at up to three times the rate of a single ADC.
+ *
+ * The three ADCs convert the same channel continuously, each started one
+ * sampling delay after the previous one, so their conversions are evenly
+ * spaced when a conversion takes exactly three delays. AdcTripleInit()
+ * picks the ADC prescaler, sampling time and delay giving the highest such
+ * rate not above the requested one and reports it in rate. The rates are
+ * discrete: 12-bit samples take 3 or 15 sampling cycles (delay 5 or 9),
+ * 8-bit 28 cycles (delay 12), 6-bit 15 cycles (delay 7); no 10-bit timing
+ * spaces evenly. With the 36 MHz ADC clock limit the maximum is 7.2 Msps
+ * (PCLK2 of 72 MHz, 12 bits); the 84 MHz PCLK2 of the 168 MHz clock tree
+ * gives 4.2 Msps.
+ *
+ * The common data register is read by DMA2 in double-buffer mode through
+ * PingPong.h: DMA mode 2 moves two 12-bit samples per word, mode 3 two
+ * 8/6-bit samples per halfword, both already in conversion order. The
+ * callback gets each finished block as 16-bit samples (byte samples are
+ * widened in place) from the DMA interrupt. The channel must be one all
+ * three ADCs share: 0-3 (PA0-PA3) or 10-13 (PC0-PC3); its pin is set to
+ * analog.
+ */
+
+/* ADC clock limit; PCLK2 is divided down to this or below */
+#ifndef ADC_TRIPLE_CLOCK_MAX
+#define ADC_TRIPLE_CLOCK_MAX 36000000U
+#endif
+
+typedef struct AdcTriple AdcTriple_T;
+
+/* Finished block of count samples, oldest first; from the DMA interrupt */
+typedef void (*AdcTripleCallback_T)(AdcTriple_T* at, uint16_t* samples, uint32_t count);
+
+/**
+ * @brief Interleaved sampling state; rate is the achieved sample rate,
+ *        treat the rest as opaque
+ */
+struct AdcTriple
+{
+    PingPong_T          pp;             /*!< Overruns in pp.overruns */
+    AdcTripleCallback_T callback;
+    void*               arg;            /*!< For the callback */
+    uint32_t            samples;        /*!< Samples per block */
+    uint32_t            rate;           /*!< Samples per second */
+    uint8_t             channel;
+    uint8_t             resolution;     /*!< ADC_RESOLUTION_T */
+    uint8_t             prescaler;      /*!< ADC_PRESCALER_T */
+    uint8_t             sampleTime;     /*!< ADC_SAMPLETIME_T */
+    uint8_t             delay;          /*!< ADC_TWO_SAMPLING_T */
+};
+
+/* buffer0/1: samples 16-bit words each, word-aligned, samples even */
+uint8_t AdcTripleInit(AdcTriple_T* at, uint8_t channel, ADC_RESOLUTION_T resolution, uint32_t rate,
+                      uint16_t* buffer0, uint16_t* buffer1, uint32_t samples,
+                      AdcTripleCallback_T callback, void* arg);
+uint8_t AdcTripleStart(AdcTriple_T* at);
+void AdcTripleStop(AdcTriple_T* at);
+
+#endif // ADC_TRIPLE_H
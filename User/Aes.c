@@ -0,0 +1,662 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "Aes.h"
+#include "Section.h"
+
+#if AES_TABLES_IN_CCM
+#define AES_TABLE static CCM_DATA
+#else
+#define AES_TABLE static const
+#endif
+
+/* Cortex-M4 folds these into the operand of the following EOR */
+#define AES_ROL8(x)     (((x) << 8) | ((x) >> 24))
+#define AES_ROL16(x)    (((x) << 16) | ((x) >> 16))
+#define AES_ROL24(x)    (((x) << 24) | ((x) >> 8))
+
+/*
+ * S-boxes and round tables. aesTe[x] is the MixColumns column of S[x] as a
+ * little-endian word (2S, S, S, 3S), aesTd[x] the InvMixColumns column of
+ * InvS[x] (14, 9, 13, 11); the other three columns are byte rotations.
+ */
+AES_TABLE uint8_t aesSbox[256] =
+{
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+AES_TABLE uint8_t aesInvSbox[256] =
+{
+    0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+    0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+    0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+    0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+    0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+    0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+    0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+    0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+    0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+    0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+    0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+    0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+    0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+    0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+    0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D,
+};
+
+AES_TABLE uint32_t aesTe[256] =
+{
+    0xA56363C6U, 0x847C7CF8U, 0x997777EEU, 0x8D7B7BF6U, 0x0DF2F2FFU, 0xBD6B6BD6U, 0xB16F6FDEU, 0x54C5C591U,
+    0x50303060U, 0x03010102U, 0xA96767CEU, 0x7D2B2B56U, 0x19FEFEE7U, 0x62D7D7B5U, 0xE6ABAB4DU, 0x9A7676ECU,
+    0x45CACA8FU, 0x9D82821FU, 0x40C9C989U, 0x877D7DFAU, 0x15FAFAEFU, 0xEB5959B2U, 0xC947478EU, 0x0BF0F0FBU,
+    0xECADAD41U, 0x67D4D4B3U, 0xFDA2A25FU, 0xEAAFAF45U, 0xBF9C9C23U, 0xF7A4A453U, 0x967272E4U, 0x5BC0C09BU,
+    0xC2B7B775U, 0x1CFDFDE1U, 0xAE93933DU, 0x6A26264CU, 0x5A36366CU, 0x413F3F7EU, 0x02F7F7F5U, 0x4FCCCC83U,
+    0x5C343468U, 0xF4A5A551U, 0x34E5E5D1U, 0x08F1F1F9U, 0x937171E2U, 0x73D8D8ABU, 0x53313162U, 0x3F15152AU,
+    0x0C040408U, 0x52C7C795U, 0x65232346U, 0x5EC3C39DU, 0x28181830U, 0xA1969637U, 0x0F05050AU, 0xB59A9A2FU,
+    0x0907070EU, 0x36121224U, 0x9B80801BU, 0x3DE2E2DFU, 0x26EBEBCDU, 0x6927274EU, 0xCDB2B27FU, 0x9F7575EAU,
+    0x1B090912U, 0x9E83831DU, 0x742C2C58U, 0x2E1A1A34U, 0x2D1B1B36U, 0xB26E6EDCU, 0xEE5A5AB4U, 0xFBA0A05BU,
+    0xF65252A4U, 0x4D3B3B76U, 0x61D6D6B7U, 0xCEB3B37DU, 0x7B292952U, 0x3EE3E3DDU, 0x712F2F5EU, 0x97848413U,
+    0xF55353A6U, 0x68D1D1B9U, 0x00000000U, 0x2CEDEDC1U, 0x60202040U, 0x1FFCFCE3U, 0xC8B1B179U, 0xED5B5BB6U,
+    0xBE6A6AD4U, 0x46CBCB8DU, 0xD9BEBE67U, 0x4B393972U, 0xDE4A4A94U, 0xD44C4C98U, 0xE85858B0U, 0x4ACFCF85U,
+    0x6BD0D0BBU, 0x2AEFEFC5U, 0xE5AAAA4FU, 0x16FBFBEDU, 0xC5434386U, 0xD74D4D9AU, 0x55333366U, 0x94858511U,
+    0xCF45458AU, 0x10F9F9E9U, 0x06020204U, 0x817F7FFEU, 0xF05050A0U, 0x443C3C78U, 0xBA9F9F25U, 0xE3A8A84BU,
+    0xF35151A2U, 0xFEA3A35DU, 0xC0404080U, 0x8A8F8F05U, 0xAD92923FU, 0xBC9D9D21U, 0x48383870U, 0x04F5F5F1U,
+    0xDFBCBC63U, 0xC1B6B677U, 0x75DADAAFU, 0x63212142U, 0x30101020U, 0x1AFFFFE5U, 0x0EF3F3FDU, 0x6DD2D2BFU,
+    0x4CCDCD81U, 0x140C0C18U, 0x35131326U, 0x2FECECC3U, 0xE15F5FBEU, 0xA2979735U, 0xCC444488U, 0x3917172EU,
+    0x57C4C493U, 0xF2A7A755U, 0x827E7EFCU, 0x473D3D7AU, 0xAC6464C8U, 0xE75D5DBAU, 0x2B191932U, 0x957373E6U,
+    0xA06060C0U, 0x98818119U, 0xD14F4F9EU, 0x7FDCDCA3U, 0x66222244U, 0x7E2A2A54U, 0xAB90903BU, 0x8388880BU,
+    0xCA46468CU, 0x29EEEEC7U, 0xD3B8B86BU, 0x3C141428U, 0x79DEDEA7U, 0xE25E5EBCU, 0x1D0B0B16U, 0x76DBDBADU,
+    0x3BE0E0DBU, 0x56323264U, 0x4E3A3A74U, 0x1E0A0A14U, 0xDB494992U, 0x0A06060CU, 0x6C242448U, 0xE45C5CB8U,
+    0x5DC2C29FU, 0x6ED3D3BDU, 0xEFACAC43U, 0xA66262C4U, 0xA8919139U, 0xA4959531U, 0x37E4E4D3U, 0x8B7979F2U,
+    0x32E7E7D5U, 0x43C8C88BU, 0x5937376EU, 0xB76D6DDAU, 0x8C8D8D01U, 0x64D5D5B1U, 0xD24E4E9CU, 0xE0A9A949U,
+    0xB46C6CD8U, 0xFA5656ACU, 0x07F4F4F3U, 0x25EAEACFU, 0xAF6565CAU, 0x8E7A7AF4U, 0xE9AEAE47U, 0x18080810U,
+    0xD5BABA6FU, 0x887878F0U, 0x6F25254AU, 0x722E2E5CU, 0x241C1C38U, 0xF1A6A657U, 0xC7B4B473U, 0x51C6C697U,
+    0x23E8E8CBU, 0x7CDDDDA1U, 0x9C7474E8U, 0x211F1F3EU, 0xDD4B4B96U, 0xDCBDBD61U, 0x868B8B0DU, 0x858A8A0FU,
+    0x907070E0U, 0x423E3E7CU, 0xC4B5B571U, 0xAA6666CCU, 0xD8484890U, 0x05030306U, 0x01F6F6F7U, 0x120E0E1CU,
+    0xA36161C2U, 0x5F35356AU, 0xF95757AEU, 0xD0B9B969U, 0x91868617U, 0x58C1C199U, 0x271D1D3AU, 0xB99E9E27U,
+    0x38E1E1D9U, 0x13F8F8EBU, 0xB398982BU, 0x33111122U, 0xBB6969D2U, 0x70D9D9A9U, 0x898E8E07U, 0xA7949433U,
+    0xB69B9B2DU, 0x221E1E3CU, 0x92878715U, 0x20E9E9C9U, 0x49CECE87U, 0xFF5555AAU, 0x78282850U, 0x7ADFDFA5U,
+    0x8F8C8C03U, 0xF8A1A159U, 0x80898909U, 0x170D0D1AU, 0xDABFBF65U, 0x31E6E6D7U, 0xC6424284U, 0xB86868D0U,
+    0xC3414182U, 0xB0999929U, 0x772D2D5AU, 0x110F0F1EU, 0xCBB0B07BU, 0xFC5454A8U, 0xD6BBBB6DU, 0x3A16162CU,
+};
+
+AES_TABLE uint32_t aesTd[256] =
+{
+    0x50A7F451U, 0x5365417EU, 0xC3A4171AU, 0x965E273AU, 0xCB6BAB3BU, 0xF1459D1FU, 0xAB58FAACU, 0x9303E34BU,
+    0x55FA3020U, 0xF66D76ADU, 0x9176CC88U, 0x254C02F5U, 0xFCD7E54FU, 0xD7CB2AC5U, 0x80443526U, 0x8FA362B5U,
+    0x495AB1DEU, 0x671BBA25U, 0x980EEA45U, 0xE1C0FE5DU, 0x02752FC3U, 0x12F04C81U, 0xA397468DU, 0xC6F9D36BU,
+    0xE75F8F03U, 0x959C9215U, 0xEB7A6DBFU, 0xDA595295U, 0x2D83BED4U, 0xD3217458U, 0x2969E049U, 0x44C8C98EU,
+    0x6A89C275U, 0x78798EF4U, 0x6B3E5899U, 0xDD71B927U, 0xB64FE1BEU, 0x17AD88F0U, 0x66AC20C9U, 0xB43ACE7DU,
+    0x184ADF63U, 0x82311AE5U, 0x60335197U, 0x457F5362U, 0xE07764B1U, 0x84AE6BBBU, 0x1CA081FEU, 0x942B08F9U,
+    0x58684870U, 0x19FD458FU, 0x876CDE94U, 0xB7F87B52U, 0x23D373ABU, 0xE2024B72U, 0x578F1FE3U, 0x2AAB5566U,
+    0x0728EBB2U, 0x03C2B52FU, 0x9A7BC586U, 0xA50837D3U, 0xF2872830U, 0xB2A5BF23U, 0xBA6A0302U, 0x5C8216EDU,
+    0x2B1CCF8AU, 0x92B479A7U, 0xF0F207F3U, 0xA1E2694EU, 0xCDF4DA65U, 0xD5BE0506U, 0x1F6234D1U, 0x8AFEA6C4U,
+    0x9D532E34U, 0xA055F3A2U, 0x32E18A05U, 0x75EBF6A4U, 0x39EC830BU, 0xAAEF6040U, 0x069F715EU, 0x51106EBDU,
+    0xF98A213EU, 0x3D06DD96U, 0xAE053EDDU, 0x46BDE64DU, 0xB58D5491U, 0x055DC471U, 0x6FD40604U, 0xFF155060U,
+    0x24FB9819U, 0x97E9BDD6U, 0xCC434089U, 0x779ED967U, 0xBD42E8B0U, 0x888B8907U, 0x385B19E7U, 0xDBEEC879U,
+    0x470A7CA1U, 0xE90F427CU, 0xC91E84F8U, 0x00000000U, 0x83868009U, 0x48ED2B32U, 0xAC70111EU, 0x4E725A6CU,
+    0xFBFF0EFDU, 0x5638850FU, 0x1ED5AE3DU, 0x27392D36U, 0x64D90F0AU, 0x21A65C68U, 0xD1545B9BU, 0x3A2E3624U,
+    0xB1670A0CU, 0x0FE75793U, 0xD296EEB4U, 0x9E919B1BU, 0x4FC5C080U, 0xA220DC61U, 0x694B775AU, 0x161A121CU,
+    0x0ABA93E2U, 0xE52AA0C0U, 0x43E0223CU, 0x1D171B12U, 0x0B0D090EU, 0xADC78BF2U, 0xB9A8B62DU, 0xC8A91E14U,
+    0x8519F157U, 0x4C0775AFU, 0xBBDD99EEU, 0xFD607FA3U, 0x9F2601F7U, 0xBCF5725CU, 0xC53B6644U, 0x347EFB5BU,
+    0x7629438BU, 0xDCC623CBU, 0x68FCEDB6U, 0x63F1E4B8U, 0xCADC31D7U, 0x10856342U, 0x40229713U, 0x2011C684U,
+    0x7D244A85U, 0xF83DBBD2U, 0x1132F9AEU, 0x6DA129C7U, 0x4B2F9E1DU, 0xF330B2DCU, 0xEC52860DU, 0xD0E3C177U,
+    0x6C16B32BU, 0x99B970A9U, 0xFA489411U, 0x2264E947U, 0xC48CFCA8U, 0x1A3FF0A0U, 0xD82C7D56U, 0xEF903322U,
+    0xC74E4987U, 0xC1D138D9U, 0xFEA2CA8CU, 0x360BD498U, 0xCF81F5A6U, 0x28DE7AA5U, 0x268EB7DAU, 0xA4BFAD3FU,
+    0xE49D3A2CU, 0x0D927850U, 0x9BCC5F6AU, 0x62467E54U, 0xC2138DF6U, 0xE8B8D890U, 0x5EF7392EU, 0xF5AFC382U,
+    0xBE805D9FU, 0x7C93D069U, 0xA92DD56FU, 0xB31225CFU, 0x3B99ACC8U, 0xA77D1810U, 0x6E639CE8U, 0x7BBB3BDBU,
+    0x097826CDU, 0xF418596EU, 0x01B79AECU, 0xA89A4F83U, 0x656E95E6U, 0x7EE6FFAAU, 0x08CFBC21U, 0xE6E815EFU,
+    0xD99BE7BAU, 0xCE366F4AU, 0xD4099FEAU, 0xD67CB029U, 0xAFB2A431U, 0x31233F2AU, 0x3094A5C6U, 0xC066A235U,
+    0x37BC4E74U, 0xA6CA82FCU, 0xB0D090E0U, 0x15D8A733U, 0x4A9804F1U, 0xF7DAEC41U, 0x0E50CD7FU, 0x2FF69117U,
+    0x8DD64D76U, 0x4DB0EF43U, 0x544DAACCU, 0xDF0496E4U, 0xE3B5D19EU, 0x1B886A4CU, 0xB81F2CC1U, 0x7F516546U,
+    0x04EA5E9DU, 0x5D358C01U, 0x737487FAU, 0x2E410BFBU, 0x5A1D67B3U, 0x52D2DB92U, 0x335610E9U, 0x1347D66DU,
+    0x8C61D79AU, 0x7A0CA137U, 0x8E14F859U, 0x893C13EBU, 0xEE27A9CEU, 0x35C961B7U, 0xEDE51CE1U, 0x3CB1477AU,
+    0x59DFD29CU, 0x3F73F255U, 0x79CE1418U, 0xBF37C773U, 0xEACDF753U, 0x5BAAFD5FU, 0x146F3DDFU, 0x86DB4478U,
+    0x81F3AFCAU, 0x3EC468B9U, 0x2C342438U, 0x5F40A3C2U, 0x72C31D16U, 0x0C25E2BCU, 0x8B493C28U, 0x41950DFFU,
+    0x7101A839U, 0xDEB30C08U, 0x9CE4B4D8U, 0x90C15664U, 0x6184CB7BU, 0x70B632D5U, 0x745C6C48U, 0x4257B8D0U,
+};
+
+static AesContext_T* asyncHead;
+static AesContext_T* asyncTail;
+static uint32_t asyncJobs;
+
+static inline uint32_t AesLoad(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return word;
+}
+
+static inline void AesStore(uint8_t* p, uint32_t word)
+{
+    memcpy(p, &word, sizeof(word));
+}
+
+static inline uint32_t AesSubWord(uint32_t w)
+{
+    return (uint32_t)aesSbox[w & 0xFFU] | ((uint32_t)aesSbox[(w >> 8) & 0xFFU] << 8) |
+           ((uint32_t)aesSbox[(w >> 16) & 0xFFU] << 16) | ((uint32_t)aesSbox[w >> 24] << 24);
+}
+
+/* InvMixColumns of one round key word: aesTd[S[x]] is InvMixColumns of x */
+static inline uint32_t AesInvMixWord(uint32_t w)
+{
+    uint32_t t0 = aesTd[aesSbox[w & 0xFFU]];
+    uint32_t t1 = aesTd[aesSbox[(w >> 8) & 0xFFU]];
+    uint32_t t2 = aesTd[aesSbox[(w >> 16) & 0xFFU]];
+    uint32_t t3 = aesTd[aesSbox[w >> 24]];
+
+    return t0 ^ AES_ROL8(t1) ^ AES_ROL16(t2) ^ AES_ROL24(t3);
+}
+
+/*!
+ * @brief       Encrypt one block held as four little-endian column words.
+ *
+ * @param       rk:      Encryption round keys
+ *
+ * @param       rounds:  10, 12 or 14
+ *
+ * @param       s:       Block, replaced by the result
+ *
+ * @retval      None
+ */
+static void AesEncryptWords(const uint32_t* rk, uint32_t rounds, uint32_t s[4])
+{
+    uint32_t s0 = s[0] ^ rk[0];
+    uint32_t s1 = s[1] ^ rk[1];
+    uint32_t s2 = s[2] ^ rk[2];
+    uint32_t s3 = s[3] ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+    uint32_t r;
+
+    for (r = 1; r < rounds; r++)
+    {
+        rk += 4;
+        t0 = aesTe[s0 & 0xFFU] ^ AES_ROL8(aesTe[(s1 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTe[(s2 >> 16) & 0xFFU]) ^ AES_ROL24(aesTe[s3 >> 24]) ^ rk[0];
+        t1 = aesTe[s1 & 0xFFU] ^ AES_ROL8(aesTe[(s2 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTe[(s3 >> 16) & 0xFFU]) ^ AES_ROL24(aesTe[s0 >> 24]) ^ rk[1];
+        t2 = aesTe[s2 & 0xFFU] ^ AES_ROL8(aesTe[(s3 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTe[(s0 >> 16) & 0xFFU]) ^ AES_ROL24(aesTe[s1 >> 24]) ^ rk[2];
+        t3 = aesTe[s3 & 0xFFU] ^ AES_ROL8(aesTe[(s0 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTe[(s1 >> 16) & 0xFFU]) ^ AES_ROL24(aesTe[s2 >> 24]) ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Last round: no MixColumns */
+    rk += 4;
+    s[0] = ((uint32_t)aesSbox[s0 & 0xFFU] | ((uint32_t)aesSbox[(s1 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesSbox[(s2 >> 16) & 0xFFU] << 16) | ((uint32_t)aesSbox[s3 >> 24] << 24)) ^ rk[0];
+    s[1] = ((uint32_t)aesSbox[s1 & 0xFFU] | ((uint32_t)aesSbox[(s2 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesSbox[(s3 >> 16) & 0xFFU] << 16) | ((uint32_t)aesSbox[s0 >> 24] << 24)) ^ rk[1];
+    s[2] = ((uint32_t)aesSbox[s2 & 0xFFU] | ((uint32_t)aesSbox[(s3 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesSbox[(s0 >> 16) & 0xFFU] << 16) | ((uint32_t)aesSbox[s1 >> 24] << 24)) ^ rk[2];
+    s[3] = ((uint32_t)aesSbox[s3 & 0xFFU] | ((uint32_t)aesSbox[(s0 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesSbox[(s1 >> 16) & 0xFFU] << 16) | ((uint32_t)aesSbox[s2 >> 24] << 24)) ^ rk[3];
+}
+
+/*!
+ * @brief       Decrypt one block (equivalent inverse cipher).
+ *
+ * @param       rk:      Decryption round keys from AesInit()
+ *
+ * @param       rounds:  10, 12 or 14
+ *
+ * @param       s:       Block, replaced by the result
+ *
+ * @retval      None
+ */
+static void AesDecryptWords(const uint32_t* rk, uint32_t rounds, uint32_t s[4])
+{
+    uint32_t s0 = s[0] ^ rk[0];
+    uint32_t s1 = s[1] ^ rk[1];
+    uint32_t s2 = s[2] ^ rk[2];
+    uint32_t s3 = s[3] ^ rk[3];
+    uint32_t t0, t1, t2, t3;
+    uint32_t r;
+
+    for (r = 1; r < rounds; r++)
+    {
+        rk += 4;
+        t0 = aesTd[s0 & 0xFFU] ^ AES_ROL8(aesTd[(s3 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTd[(s2 >> 16) & 0xFFU]) ^ AES_ROL24(aesTd[s1 >> 24]) ^ rk[0];
+        t1 = aesTd[s1 & 0xFFU] ^ AES_ROL8(aesTd[(s0 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTd[(s3 >> 16) & 0xFFU]) ^ AES_ROL24(aesTd[s2 >> 24]) ^ rk[1];
+        t2 = aesTd[s2 & 0xFFU] ^ AES_ROL8(aesTd[(s1 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTd[(s0 >> 16) & 0xFFU]) ^ AES_ROL24(aesTd[s3 >> 24]) ^ rk[2];
+        t3 = aesTd[s3 & 0xFFU] ^ AES_ROL8(aesTd[(s2 >> 8) & 0xFFU]) ^
+             AES_ROL16(aesTd[(s1 >> 16) & 0xFFU]) ^ AES_ROL24(aesTd[s0 >> 24]) ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    rk += 4;
+    s[0] = ((uint32_t)aesInvSbox[s0 & 0xFFU] | ((uint32_t)aesInvSbox[(s3 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesInvSbox[(s2 >> 16) & 0xFFU] << 16) | ((uint32_t)aesInvSbox[s1 >> 24] << 24)) ^ rk[0];
+    s[1] = ((uint32_t)aesInvSbox[s1 & 0xFFU] | ((uint32_t)aesInvSbox[(s0 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesInvSbox[(s3 >> 16) & 0xFFU] << 16) | ((uint32_t)aesInvSbox[s2 >> 24] << 24)) ^ rk[1];
+    s[2] = ((uint32_t)aesInvSbox[s2 & 0xFFU] | ((uint32_t)aesInvSbox[(s1 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesInvSbox[(s0 >> 16) & 0xFFU] << 16) | ((uint32_t)aesInvSbox[s3 >> 24] << 24)) ^ rk[2];
+    s[3] = ((uint32_t)aesInvSbox[s3 & 0xFFU] | ((uint32_t)aesInvSbox[(s2 >> 8) & 0xFFU] << 8) |
+            ((uint32_t)aesInvSbox[(s1 >> 16) & 0xFFU] << 16) | ((uint32_t)aesInvSbox[s0 >> 24] << 24)) ^ rk[3];
+}
+
+/* Increment the big-endian 32-bit counter in the last word of the block */
+static inline void AesIncrement32(uint8_t block[16])
+{
+    uint32_t counter = __builtin_bswap32(AesLoad(block + 12)) + 1U;
+
+    AesStore(block + 12, __builtin_bswap32(counter));
+}
+
+/*!
+ * @brief       Set up a stream: expand the key and load the IV.
+ *
+ * @param       ctx:      Context to initialize
+ *
+ * @param       mode:     AES_MODE_ECB, AES_MODE_CBC or AES_MODE_CTR
+ *
+ * @param       dir:      AES_ENCRYPT or AES_DECRYPT (same keystream in CTR mode)
+ *
+ * @param       key:      Key bytes
+ *
+ * @param       keysize:  Key length in bits: 128, 192 or 256
+ *
+ * @param       iv:       CBC IV or initial CTR counter block (NULL for ECB)
+ *
+ * @retval      SUCCESS or ERROR (bad key size, missing IV)
+ */
+uint8_t AesInit(AesContext_T* ctx, AesMode_T mode, AesDir_T dir,
+                const uint8_t* key, uint16_t keysize, const uint8_t iv[16])
+{
+    uint32_t* rk = ctx->roundKey;
+    uint32_t words, total, i, j, t;
+    uint32_t rcon = 1;
+
+    switch (keysize)
+    {
+        case 128:
+            words = 4;
+            break;
+        case 192:
+            words = 6;
+            break;
+        case 256:
+            words = 8;
+            break;
+        default:
+            return ERROR;
+    }
+    if ((mode != AES_MODE_ECB) && (iv == NULL))
+    {
+        return ERROR;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->rounds = (uint8_t)(words + 6U);
+    ctx->mode = (uint8_t)mode;
+    ctx->decrypt = (uint8_t)((dir == AES_DECRYPT) && (mode != AES_MODE_CTR));
+    ctx->used = AES_BLOCK_SIZE;
+    if (iv != NULL)
+    {
+        memcpy(ctx->iv, iv, AES_BLOCK_SIZE);
+    }
+
+    /* FIPS-197 key expansion; RotWord is a right rotation of the LE word */
+    total = 4U * (ctx->rounds + 1U);
+    for (i = 0; i < words; i++)
+    {
+        rk[i] = AesLoad(key + 4U * i);
+    }
+    for (i = words; i < total; i++)
+    {
+        t = rk[i - 1U];
+        if ((i % words) == 0U)
+        {
+            t = AesSubWord((t >> 8) | (t << 24)) ^ rcon;
+            rcon = (rcon << 1) ^ (((rcon >> 7) & 1U) * 0x11BU);
+        }
+        else if ((words > 6U) && ((i % words) == 4U))
+        {
+            t = AesSubWord(t);
+        }
+        rk[i] = rk[i - words] ^ t;
+    }
+
+    if (ctx->decrypt)
+    {
+        /* Reverse the round order, InvMixColumns on the inner rounds */
+        for (i = 0, j = total - 4U; i < j; i += 4U, j -= 4U)
+        {
+            for (t = 0; t < 4U; t++)
+            {
+                uint32_t swap = rk[i + t];
+
+                rk[i + t] = rk[j + t];
+                rk[j + t] = swap;
+            }
+        }
+        for (i = 4; i < total - 4U; i++)
+        {
+            rk[i] = AesInvMixWord(rk[i]);
+        }
+    }
+
+    return SUCCESS;
+}
+
+/* Process a validated span; ECB/CBC lengths are whole blocks */
+static void AesProcess(AesContext_T* ctx, const uint8_t* input, uint32_t length, uint8_t* output)
+{
+    const uint32_t* rk = ctx->roundKey;
+    uint32_t rounds = ctx->rounds;
+    uint32_t s[4], c[4], chain[4];
+    uint32_t i;
+
+    switch (ctx->mode)
+    {
+        case AES_MODE_ECB:
+            for (; length != 0U; length -= AES_BLOCK_SIZE)
+            {
+                memcpy(s, input, AES_BLOCK_SIZE);
+                if (ctx->decrypt)
+                {
+                    AesDecryptWords(rk, rounds, s);
+                }
+                else
+                {
+                    AesEncryptWords(rk, rounds, s);
+                }
+                memcpy(output, s, AES_BLOCK_SIZE);
+                input += AES_BLOCK_SIZE;
+                output += AES_BLOCK_SIZE;
+            }
+            break;
+
+        case AES_MODE_CBC:
+            memcpy(chain, ctx->iv, AES_BLOCK_SIZE);
+            for (; length != 0U; length -= AES_BLOCK_SIZE)
+            {
+                memcpy(c, input, AES_BLOCK_SIZE);
+                if (ctx->decrypt)
+                {
+                    /* Ciphertext kept in c[]: the output may overwrite the input */
+                    memcpy(s, c, AES_BLOCK_SIZE);
+                    AesDecryptWords(rk, rounds, s);
+                    for (i = 0; i < 4U; i++)
+                    {
+                        s[i] ^= chain[i];
+                        chain[i] = c[i];
+                    }
+                }
+                else
+                {
+                    for (i = 0; i < 4U; i++)
+                    {
+                        s[i] = c[i] ^ chain[i];
+                    }
+                    AesEncryptWords(rk, rounds, s);
+                    memcpy(chain, s, AES_BLOCK_SIZE);
+                }
+                memcpy(output, s, AES_BLOCK_SIZE);
+                input += AES_BLOCK_SIZE;
+                output += AES_BLOCK_SIZE;
+            }
+            memcpy(ctx->iv, chain, AES_BLOCK_SIZE);
+            break;
+
+        default:
+            /* CTR: finish the keystream block left by the previous call */
+            while ((length != 0U) && (ctx->used < AES_BLOCK_SIZE))
+            {
+                *output++ = *input++ ^ ctx->stream[ctx->used++];
+                length--;
+            }
+            while (length >= AES_BLOCK_SIZE)
+            {
+                memcpy(s, ctx->iv, AES_BLOCK_SIZE);
+                AesEncryptWords(rk, rounds, s);
+                AesIncrement32(ctx->iv);
+                for (i = 0; i < 4U; i++)
+                {
+                    AesStore(output + 4U * i, AesLoad(input + 4U * i) ^ s[i]);
+                }
+                input += AES_BLOCK_SIZE;
+                output += AES_BLOCK_SIZE;
+                length -= AES_BLOCK_SIZE;
+            }
+            if (length != 0U)
+            {
+                memcpy(s, ctx->iv, AES_BLOCK_SIZE);
+                AesEncryptWords(rk, rounds, s);
+                AesIncrement32(ctx->iv);
+                memcpy(ctx->stream, s, AES_BLOCK_SIZE);
+                for (ctx->used = 0; ctx->used < length; ctx->used++)
+                {
+                    output[ctx->used] = input[ctx->used] ^ ctx->stream[ctx->used];
+                }
+            }
+            break;
+    }
+}
+
+/*!
+ * @brief       Encrypt or decrypt the next part of the stream.
+ *
+ * @param       ctx:     Context from AesInit()
+ *
+ * @param       input:   Data, any alignment
+ *
+ * @param       length:  Bytes; a multiple of 16 in ECB and CBC mode
+ *
+ * @param       output:  Result, may be the same buffer as input
+ *
+ * @retval      SUCCESS or ERROR (partial block, job queued on ctx)
+ */
+uint8_t AesUpdate(AesContext_T* ctx, const uint8_t* input, uint32_t length, uint8_t* output)
+{
+    if (ctx->busy || ((ctx->mode != AES_MODE_CTR) && ((length % AES_BLOCK_SIZE) != 0U)))
+    {
+        return ERROR;
+    }
+
+    AesProcess(ctx, input, length, output);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Start a new message with the same key.
+ *
+ * @param       ctx:  Context from AesInit(), no job queued
+ *
+ * @param       iv:   CBC IV or CTR counter block
+ *
+ * @retval      None
+ */
+void AesSetIv(AesContext_T* ctx, const uint8_t iv[16])
+{
+    memcpy(ctx->iv, iv, AES_BLOCK_SIZE);
+    ctx->used = AES_BLOCK_SIZE;
+}
+
+/*!
+ * @brief       End a stream and wipe the key material.
+ *
+ * @param       ctx:  Context from AesInit()
+ *
+ * @retval      SUCCESS, or ERROR while a job is still queued
+ */
+uint8_t AesFinal(AesContext_T* ctx)
+{
+    volatile uint8_t* p = (volatile uint8_t*)ctx;
+    uint32_t i;
+
+    if (ctx->busy)
+    {
+        return ERROR;
+    }
+
+    /* Volatile stores: a memset of a dead object may be optimized away */
+    for (i = 0; i < sizeof(*ctx); i++)
+    {
+        p[i] = 0;
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Queue the next part of the stream for AesPoll().
+ *
+ * @param       ctx:     Context from AesInit()
+ *
+ * @param       input:   Data, any alignment; must stay valid until done
+ *
+ * @param       length:  Bytes; a multiple of 16 in ECB and CBC mode
+ *
+ * @param       output:  Result, may be the same buffer as input
+ *
+ * @param       done:    Called from AesPoll() when finished (may be NULL)
+ *
+ * @param       arg:     Passed to done
+ *
+ * @retval      SUCCESS or ERROR (partial block, job already queued on ctx)
+ *
+ * @note        Main loop only, like AesPoll(). The callback may queue the
+ *              next part on the same context.
+ */
+uint8_t AesUpdateAsync(AesContext_T* ctx, const uint8_t* input, uint32_t length, uint8_t* output,
+                       AesCallback_T done, void* arg)
+{
+    if (ctx->busy || ((ctx->mode != AES_MODE_CTR) && ((length % AES_BLOCK_SIZE) != 0U)))
+    {
+        return ERROR;
+    }
+
+    ctx->input = input;
+    ctx->output = output;
+    ctx->length = length;
+    ctx->done = done;
+    ctx->arg = arg;
+    ctx->next = NULL;
+    ctx->busy = 1;
+
+    if (asyncTail != NULL)
+    {
+        asyncTail->next = ctx;
+    }
+    else
+    {
+        asyncHead = ctx;
+    }
+    asyncTail = ctx;
+    asyncJobs++;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Work on the queued jobs, round robin.
+ *
+ * @param       None
+ *
+ * @retval      Jobs still queued
+ *
+ * @note        Processes at most AES_POLL_BLOCKS blocks of the first job,
+ *              then moves it behind the others, so several streams share
+ *              the CPU and the main loop stays responsive.
+ */
+uint32_t AesPoll(void)
+{
+    AesContext_T* ctx = asyncHead;
+    uint32_t chunk;
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    chunk = (ctx->length < AES_POLL_BLOCKS * AES_BLOCK_SIZE) ? ctx->length : AES_POLL_BLOCKS * AES_BLOCK_SIZE;
+    AesProcess(ctx, ctx->input, chunk, ctx->output);
+    ctx->input += chunk;
+    ctx->output += chunk;
+    ctx->length -= chunk;
+
+    asyncHead = ctx->next;
+    if (asyncHead == NULL)
+    {
+        asyncTail = NULL;
+    }
+    ctx->next = NULL;
+
+    if (ctx->length != 0U)
+    {
+        /* Not finished: to the back of the queue */
+        if (asyncTail != NULL)
+        {
+            asyncTail->next = ctx;
+        }
+        else
+        {
+            asyncHead = ctx;
+        }
+        asyncTail = ctx;
+    }
+    else
+    {
+        asyncJobs--;
+        ctx->busy = 0;
+        if (ctx->done != NULL)
+        {
+            ctx->done(ctx, ctx->arg);
+        }
+    }
+
+    return asyncJobs;
+}
+
+/*!
+ * @brief       Encrypt one block with the context's key.
+ *
+ * @param       ctx:  Context initialized for encryption, or for CTR mode
+ *
+ * @param       in:   Plaintext block
+ *
+ * @param       out:  Ciphertext block, may be in
+ *
+ * @retval      None
+ *
+ * @note        Leaves the IV and keystream state alone; building block for
+ *              other modes.
+ */
+void AesEncryptBlock(const AesContext_T* ctx, const uint8_t in[16], uint8_t out[16])
+{
+    uint32_t s[4];
+
+    memcpy(s, in, AES_BLOCK_SIZE);
+    AesEncryptWords(ctx->roundKey, ctx->rounds, s);
+    memcpy(out, s, AES_BLOCK_SIZE);
+}
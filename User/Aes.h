@@ -0,0 +1,93 @@
+#ifndef AES_H
+#define AES_H
+
+#include <stdint.h>
+
+/*
+ * Streaming AES-128/192/256 in ECB, CBC and CTR mode.
+ *
+ * AesInit() expands the key once into the context; AesUpdate() can then be
+ * called any number of times and continues the CBC chain or CTR keystream
+ * where the previous call stopped, so a firmware image or a stream of
+ * network payloads is processed piece by piece without reloading the key.
+ * Input and output may be the same buffer and need no alignment.
+ *
+ * The APM32F407 has no CRYP accelerator, so the cipher runs on the CPU
+ * with 32-bit T-tables (the rotations of one table are free on Cortex-M4,
+ * which keeps them at 1 KiB per direction). AesUpdateAsync() queues a job
+ * that AesPoll() works through AES_POLL_BLOCKS blocks at a time from the
+ * main loop, and calls the completion callback when it is done.
+ *
+ * ECB and CBC process whole 16-byte blocks (no padding); CTR takes any
+ * length. The CTR counter is the last 32 bits of the block, big-endian,
+ * as in the CRYP peripheral and GCM.
+ */
+
+/* Place the 2.5 KiB of cipher tables in CCM RAM instead of flash */
+#ifndef AES_TABLES_IN_CCM
+#define AES_TABLES_IN_CCM 0
+#endif
+
+/* Blocks processed per AesPoll() call */
+#ifndef AES_POLL_BLOCKS
+#define AES_POLL_BLOCKS 16
+#endif
+
+#define AES_BLOCK_SIZE  16U
+
+typedef enum
+{
+    AES_MODE_ECB,
+    AES_MODE_CBC,
+    AES_MODE_CTR
+} AesMode_T;
+
+typedef enum
+{
+    AES_ENCRYPT,
+    AES_DECRYPT
+} AesDir_T;
+
+typedef struct AesContext AesContext_T;
+
+/* Called from AesPoll() when an AesUpdateAsync() job has finished */
+typedef void (*AesCallback_T)(AesContext_T* ctx, void* arg);
+
+/**
+ * @brief AES stream state; treat as opaque
+ */
+struct AesContext
+{
+    uint32_t        roundKey[60];           /*!< Expanded key, decryption order for ECB/CBC decrypt */
+    uint8_t         rounds;                 /*!< 10, 12 or 14 */
+    uint8_t         mode;                   /*!< AesMode_T */
+    uint8_t         decrypt;                /*!< AES_DECRYPT */
+    uint8_t         used;                   /*!< CTR: keystream bytes consumed from stream[] */
+    uint8_t         busy;                   /*!< Job queued with AesUpdateAsync() */
+    uint8_t         iv[AES_BLOCK_SIZE];     /*!< CBC chaining value or CTR counter block */
+    uint8_t         stream[AES_BLOCK_SIZE]; /*!< CTR: keystream of the previous counter */
+
+    /* Queued job */
+    const uint8_t*  input;
+    uint8_t*        output;
+    uint32_t        length;
+    AesCallback_T   done;
+    void*           arg;
+    AesContext_T*   next;
+};
+
+uint8_t AesInit(AesContext_T* ctx, AesMode_T mode, AesDir_T dir,
+                const uint8_t* key, uint16_t keysize, const uint8_t iv[16]);
+uint8_t AesUpdate(AesContext_T* ctx, const uint8_t* input, uint32_t length, uint8_t* output);
+void AesSetIv(AesContext_T* ctx, const uint8_t iv[16]);
+uint8_t AesFinal(AesContext_T* ctx);
+
+/* Deferred processing from the main loop */
+uint8_t AesUpdateAsync(AesContext_T* ctx, const uint8_t* input, uint32_t length, uint8_t* output,
+                       AesCallback_T done, void* arg);
+uint32_t AesPoll(void);
+
+/* One block with an encrypting or CTR context, ignoring the mode */
+void AesEncryptBlock(const AesContext_T* ctx, const uint8_t in[16], uint8_t out[16]);
+
+#endif // AES_H
@@ -0,0 +1,606 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "AesAead.h"
+
+/*
+ * GHASH reduction for the four bits shifted out of the low end, already
+ * placed in the top half of the most significant word (R = 0xE1 << 120).
+ */
+static const uint32_t gcmReduce[16] =
+{
+    0x00000000U, 0x1C200000U, 0x38400000U, 0x24600000U,
+    0x70800000U, 0x6CA00000U, 0x48C00000U, 0x54E00000U,
+    0xE1000000U, 0xFD200000U, 0xD9400000U, 0xC5600000U,
+    0x91800000U, 0x8DA00000U, 0xA9C00000U, 0xB5E00000U
+};
+
+static inline uint32_t AeadLoadBe(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return __builtin_bswap32(word);
+}
+
+static inline void AeadStoreBe(uint8_t* p, uint32_t word)
+{
+    word = __builtin_bswap32(word);
+    memcpy(p, &word, sizeof(word));
+}
+
+/*!
+ * @brief       Multiply the GHASH state by H (Shoup's 4-bit tables).
+ *
+ * @param       m:  H times each 4-bit value
+ *
+ * @param       y:  State as big-endian words, replaced by y * H
+ *
+ * @retval      None
+ *
+ * @note        32 table lookups per block. The 4-bit shift across the
+ *              four words uses ORR with a shifted operand, one
+ *              instruction per word on Cortex-M4; no multiplier is needed.
+ */
+static void GcmMultiply(const uint32_t m[16][4], uint32_t y[4])
+{
+    uint32_t z0 = 0, z1 = 0, z2 = 0, z3 = 0;
+    uint32_t word, rem;
+    const uint32_t* t;
+    int32_t w;
+    uint32_t n;
+
+    /* Horner's rule from the least significant nibble */
+    for (w = 3; w >= 0; w--)
+    {
+        word = y[w];
+        for (n = 0; n < 8U; n++)
+        {
+            rem = z3 & 0xFU;
+            z3 = (z3 >> 4) | (z2 << 28);
+            z2 = (z2 >> 4) | (z1 << 28);
+            z1 = (z1 >> 4) | (z0 << 28);
+            z0 = (z0 >> 4) ^ gcmReduce[rem];
+
+            t = m[word & 0xFU];
+            z0 ^= t[0];
+            z1 ^= t[1];
+            z2 ^= t[2];
+            z3 ^= t[3];
+            word >>= 4;
+        }
+    }
+
+    y[0] = z0;
+    y[1] = z1;
+    y[2] = z2;
+    y[3] = z3;
+}
+
+/* Absorb one whole block */
+static inline void GcmHashBlock(const AesAead_T* aead, uint32_t y[4], const uint8_t* block)
+{
+    y[0] ^= AeadLoadBe(block);
+    y[1] ^= AeadLoadBe(block + 4);
+    y[2] ^= AeadLoadBe(block + 8);
+    y[3] ^= AeadLoadBe(block + 12);
+    GcmMultiply(aead->ghash, y);
+}
+
+/* Absorb data zero-padded to a whole number of blocks */
+static void GcmHash(const AesAead_T* aead, uint32_t y[4], const uint8_t* data, uint32_t length)
+{
+    uint8_t last[AES_BLOCK_SIZE];
+
+    for (; length >= AES_BLOCK_SIZE; length -= AES_BLOCK_SIZE)
+    {
+        GcmHashBlock(aead, y, data);
+        data += AES_BLOCK_SIZE;
+    }
+    if (length != 0U)
+    {
+        memset(last, 0, sizeof(last));
+        memcpy(last, data, length);
+        GcmHashBlock(aead, y, last);
+    }
+}
+
+/*!
+ * @brief       Load a key for GCM and CCM.
+ *
+ * @param       aead:     Key state to initialize
+ *
+ * @param       key:      Key bytes
+ *
+ * @param       keysize:  Key length in bits: 128, 192 or 256
+ *
+ * @retval      SUCCESS or ERROR (bad key size)
+ */
+uint8_t AesAeadInit(AesAead_T* aead, const uint8_t* key, uint16_t keysize)
+{
+    static const uint8_t zero[AES_BLOCK_SIZE];
+    uint8_t h[AES_BLOCK_SIZE];
+    uint32_t (*m)[4] = aead->ghash;
+    uint32_t i, j, k;
+
+    if (AesInit(&aead->aes, AES_MODE_CTR, AES_ENCRYPT, key, keysize, zero) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* m[8] = H; m[4], m[2], m[1] = H * x, x^2, x^3 (a right shift in GCM bit order) */
+    AesEncryptBlock(&aead->aes, zero, h);
+    for (k = 0; k < 4U; k++)
+    {
+        m[0][k] = 0;
+        m[8][k] = AeadLoadBe(h + 4U * k);
+    }
+    for (i = 4; i != 0U; i >>= 1)
+    {
+        uint32_t carry = m[2U * i][3] & 1U;
+
+        m[i][3] = (m[2U * i][3] >> 1) | (m[2U * i][2] << 31);
+        m[i][2] = (m[2U * i][2] >> 1) | (m[2U * i][1] << 31);
+        m[i][1] = (m[2U * i][1] >> 1) | (m[2U * i][0] << 31);
+        m[i][0] = (m[2U * i][0] >> 1) ^ (carry * 0xE1000000U);
+    }
+    for (i = 2; i < 16U; i <<= 1)
+    {
+        for (j = 1; j < i; j++)
+        {
+            for (k = 0; k < 4U; k++)
+            {
+                m[i + j][k] = m[i][k] ^ m[j][k];
+            }
+        }
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Run GCM over one message.
+ *
+ * @param       aead:     Key state
+ *
+ * @param       iv:       IV
+ *
+ * @param       ivLen:    IV bytes, non-zero
+ *
+ * @param       aad:      Additional authenticated data
+ *
+ * @param       aadLen:   AAD bytes
+ *
+ * @param       input:    Plaintext or ciphertext
+ *
+ * @param       length:   Bytes
+ *
+ * @param       output:   Result, may be input
+ *
+ * @param       tag:      Computed tag, 16 bytes
+ *
+ * @param       decrypt:  Non-zero when input is ciphertext
+ *
+ * @retval      None
+ */
+static void GcmCrypt(AesAead_T* aead, const uint8_t* iv, uint32_t ivLen,
+                     const uint8_t* aad, uint32_t aadLen,
+                     const uint8_t* input, uint32_t length, uint8_t* output,
+                     uint8_t tag[16], uint8_t decrypt)
+{
+    uint8_t j0[AES_BLOCK_SIZE];
+    uint8_t block[AES_BLOCK_SIZE];
+    uint32_t y[4] = { 0, 0, 0, 0 };
+    uint32_t textLen = length;
+    uint32_t tail;
+    uint32_t i;
+
+    /* Pre-counter block J0 */
+    if (ivLen == 12U)
+    {
+        memcpy(j0, iv, 12);
+        AeadStoreBe(j0 + 12, 1);
+    }
+    else
+    {
+        GcmHash(aead, y, iv, ivLen);
+        memset(block, 0, 8);
+        AeadStoreBe(block + 8, ivLen >> 29);
+        AeadStoreBe(block + 12, ivLen << 3);
+        GcmHashBlock(aead, y, block);
+        for (i = 0; i < 4U; i++)
+        {
+            AeadStoreBe(j0 + 4U * i, y[i]);
+            y[i] = 0;
+        }
+    }
+
+    /* Counter mode from inc32(J0) */
+    memcpy(block, j0, AES_BLOCK_SIZE);
+    AeadStoreBe(block + 12, AeadLoadBe(j0 + 12) + 1U);
+    AesSetIv(&aead->aes, block);
+
+    GcmHash(aead, y, aad, aadLen);
+
+    /* One pass: each block is hashed right after (encrypt) or before
+     * (decrypt, so in-place works) its keystream is applied */
+    tail = length % AES_BLOCK_SIZE;
+    for (length -= tail; length != 0U; length -= AES_BLOCK_SIZE)
+    {
+        if (decrypt)
+        {
+            GcmHashBlock(aead, y, input);
+        }
+        AesUpdate(&aead->aes, input, AES_BLOCK_SIZE, output);
+        if (!decrypt)
+        {
+            GcmHashBlock(aead, y, output);
+        }
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+    if (tail != 0U)
+    {
+        memset(block, 0, sizeof(block));
+        memcpy(block, input, tail);
+        AesUpdate(&aead->aes, block, tail, output);
+        if (!decrypt)
+        {
+            memcpy(block, output, tail);
+        }
+        GcmHashBlock(aead, y, block);
+    }
+
+    /* Lengths in bits, then the tag E(K, J0) ^ S */
+    AeadStoreBe(block, aadLen >> 29);
+    AeadStoreBe(block + 4, aadLen << 3);
+    AeadStoreBe(block + 8, textLen >> 29);
+    AeadStoreBe(block + 12, textLen << 3);
+    GcmHashBlock(aead, y, block);
+    AesEncryptBlock(&aead->aes, j0, tag);
+    for (i = 0; i < 4U; i++)
+    {
+        AeadStoreBe(tag + 4U * i, AeadLoadBe(tag + 4U * i) ^ y[i]);
+    }
+}
+
+/* Constant-time tag comparison */
+static uint8_t AeadTagMatch(const uint8_t* a, const uint8_t* b, uint32_t length)
+{
+    uint8_t diff = 0;
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        diff |= (uint8_t)(a[i] ^ b[i]);
+    }
+
+    return diff == 0U;
+}
+
+/*!
+ * @brief       Encrypt and authenticate with AES-GCM.
+ *
+ * @param       aead:     Key state from AesAeadInit()
+ *
+ * @param       iv:       IV, unique per message under one key
+ *
+ * @param       ivLen:    IV bytes; 12 avoids hashing the IV
+ *
+ * @param       aad:      Data authenticated but not encrypted (may be NULL if aadLen is 0)
+ *
+ * @param       aadLen:   AAD bytes
+ *
+ * @param       input:    Plaintext, any alignment
+ *
+ * @param       length:   Plaintext bytes
+ *
+ * @param       output:   Ciphertext, may be input
+ *
+ * @param       tag:      Receives the tag
+ *
+ * @param       tagLen:   Tag bytes, 4..16
+ *
+ * @retval      SUCCESS or ERROR (bad IV or tag length)
+ */
+uint8_t AesGcmEncrypt(AesAead_T* aead, const uint8_t* iv, uint32_t ivLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      uint8_t* tag, uint32_t tagLen)
+{
+    uint8_t full[AES_BLOCK_SIZE];
+
+    if ((ivLen == 0U) || (tagLen < 4U) || (tagLen > AES_BLOCK_SIZE))
+    {
+        return ERROR;
+    }
+
+    GcmCrypt(aead, iv, ivLen, aad, aadLen, input, length, output, full, 0);
+    memcpy(tag, full, tagLen);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Decrypt and verify with AES-GCM.
+ *
+ * @param       aead:     Key state from AesAeadInit()
+ *
+ * @param       iv:       IV used for encryption
+ *
+ * @param       ivLen:    IV bytes
+ *
+ * @param       aad:      Additional authenticated data
+ *
+ * @param       aadLen:   AAD bytes
+ *
+ * @param       input:    Ciphertext, any alignment
+ *
+ * @param       length:   Ciphertext bytes
+ *
+ * @param       output:   Plaintext, may be input
+ *
+ * @param       tag:      Received tag
+ *
+ * @param       tagLen:   Tag bytes, 4..16
+ *
+ * @retval      SUCCESS, or ERROR (bad lengths, or authentication failed
+ *              and output has been cleared)
+ */
+uint8_t AesGcmDecrypt(AesAead_T* aead, const uint8_t* iv, uint32_t ivLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      const uint8_t* tag, uint32_t tagLen)
+{
+    uint8_t full[AES_BLOCK_SIZE];
+
+    if ((ivLen == 0U) || (tagLen < 4U) || (tagLen > AES_BLOCK_SIZE))
+    {
+        return ERROR;
+    }
+
+    GcmCrypt(aead, iv, ivLen, aad, aadLen, input, length, output, full, 1);
+    if (!AeadTagMatch(full, tag, tagLen))
+    {
+        memset(output, 0, length);
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/* CBC-MAC over bytes, continuing a partly filled block */
+static void CcmMacBytes(AesAead_T* aead, uint8_t mac[16], uint32_t* fill, const uint8_t* data, uint32_t length)
+{
+    while (length-- != 0U)
+    {
+        mac[(*fill)++] ^= *data++;
+        if (*fill == AES_BLOCK_SIZE)
+        {
+            AesEncryptBlock(&aead->aes, mac, mac);
+            *fill = 0;
+        }
+    }
+}
+
+/* CBC-MAC of one whole block */
+static inline void CcmMacBlock(AesAead_T* aead, uint8_t mac[16], const uint8_t* block)
+{
+    uint32_t i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i += 4U)
+    {
+        AeadStoreBe(mac + i, AeadLoadBe(mac + i) ^ AeadLoadBe(block + i));
+    }
+    AesEncryptBlock(&aead->aes, mac, mac);
+}
+
+/*!
+ * @brief       Run CCM over one message.
+ *
+ * @param       aead:      Key state
+ *
+ * @param       nonce:     Nonce
+ *
+ * @param       nonceLen:  Nonce bytes, 7..13
+ *
+ * @param       aad:       Additional authenticated data
+ *
+ * @param       aadLen:    AAD bytes
+ *
+ * @param       input:     Plaintext or ciphertext
+ *
+ * @param       length:    Bytes
+ *
+ * @param       output:    Result, may be input
+ *
+ * @param       tag:       Computed tag, 16 bytes (first tagLen valid)
+ *
+ * @param       tagLen:    Tag bytes, 4..16 and even
+ *
+ * @param       decrypt:   Non-zero when input is ciphertext
+ *
+ * @retval      SUCCESS or ERROR (bad lengths)
+ */
+static uint8_t CcmCrypt(AesAead_T* aead, const uint8_t* nonce, uint32_t nonceLen,
+                        const uint8_t* aad, uint32_t aadLen,
+                        const uint8_t* input, uint32_t length, uint8_t* output,
+                        uint8_t tag[16], uint32_t tagLen, uint8_t decrypt)
+{
+    uint8_t mac[AES_BLOCK_SIZE];
+    uint8_t ctr[AES_BLOCK_SIZE];
+    uint8_t block[AES_BLOCK_SIZE];
+    uint32_t q = 15U - nonceLen;
+    uint32_t fill = 0;
+    uint32_t tail;
+    uint32_t i;
+
+    if ((nonceLen < 7U) || (nonceLen > 13U) || (tagLen < 4U) || (tagLen > AES_BLOCK_SIZE) ||
+        ((tagLen & 1U) != 0U) || ((q < 4U) && ((length >> (8U * q)) != 0U)))
+    {
+        return ERROR;
+    }
+
+    /* B0: flags, nonce, message length in q bytes */
+    mac[0] = (uint8_t)(((aadLen != 0U) ? 0x40U : 0U) | (((tagLen - 2U) / 2U) << 3) | (q - 1U));
+    memcpy(mac + 1, nonce, nonceLen);
+    memset(mac + 1 + nonceLen, 0, q);
+    for (i = 0; (i < q) && (i < 4U); i++)
+    {
+        mac[15U - i] = (uint8_t)(length >> (8U * i));
+    }
+    AesEncryptBlock(&aead->aes, mac, mac);
+
+    /* AAD with its length prefix, zero-padded */
+    if (aadLen != 0U)
+    {
+        if (aadLen < 0xFF00U)
+        {
+            block[0] = (uint8_t)(aadLen >> 8);
+            block[1] = (uint8_t)aadLen;
+            CcmMacBytes(aead, mac, &fill, block, 2);
+        }
+        else
+        {
+            block[0] = 0xFF;
+            block[1] = 0xFE;
+            AeadStoreBe(block + 2, aadLen);
+            CcmMacBytes(aead, mac, &fill, block, 6);
+        }
+        CcmMacBytes(aead, mac, &fill, aad, aadLen);
+        if (fill != 0U)
+        {
+            AesEncryptBlock(&aead->aes, mac, mac);
+        }
+    }
+
+    /* Counter blocks: flags, nonce, index; A0 masks the tag, A1.. the text */
+    ctr[0] = (uint8_t)(q - 1U);
+    memcpy(ctr + 1, nonce, nonceLen);
+    memset(ctr + 1 + nonceLen, 0, q);
+    AesEncryptBlock(&aead->aes, ctr, tag);
+    ctr[15] = 1;
+    AesSetIv(&aead->aes, ctr);
+
+    /* One pass: CBC-MAC of the plaintext next to its counter-mode block */
+    tail = length % AES_BLOCK_SIZE;
+    for (length -= tail; length != 0U; length -= AES_BLOCK_SIZE)
+    {
+        if (!decrypt)
+        {
+            CcmMacBlock(aead, mac, input);
+        }
+        AesUpdate(&aead->aes, input, AES_BLOCK_SIZE, output);
+        if (decrypt)
+        {
+            CcmMacBlock(aead, mac, output);
+        }
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+    if (tail != 0U)
+    {
+        memset(block, 0, sizeof(block));
+        memcpy(block, input, tail);
+        AesUpdate(&aead->aes, block, tail, output);
+        if (decrypt)
+        {
+            memcpy(block, output, tail);
+        }
+        CcmMacBlock(aead, mac, block);
+    }
+
+    for (i = 0; i < AES_BLOCK_SIZE; i++)
+    {
+        tag[i] ^= mac[i];
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Encrypt and authenticate with AES-CCM.
+ *
+ * @param       aead:      Key state from AesAeadInit()
+ *
+ * @param       nonce:     Nonce, unique per message under one key
+ *
+ * @param       nonceLen:  Nonce bytes, 7..13; 15 - nonceLen bytes encode the length
+ *
+ * @param       aad:       Data authenticated but not encrypted
+ *
+ * @param       aadLen:    AAD bytes
+ *
+ * @param       input:     Plaintext, any alignment
+ *
+ * @param       length:    Plaintext bytes
+ *
+ * @param       output:    Ciphertext, may be input
+ *
+ * @param       tag:       Receives the tag
+ *
+ * @param       tagLen:    Tag bytes: 4, 6, 8, 10, 12, 14 or 16
+ *
+ * @retval      SUCCESS or ERROR (bad nonce, tag or message length)
+ */
+uint8_t AesCcmEncrypt(AesAead_T* aead, const uint8_t* nonce, uint32_t nonceLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      uint8_t* tag, uint32_t tagLen)
+{
+    uint8_t full[AES_BLOCK_SIZE];
+
+    if (CcmCrypt(aead, nonce, nonceLen, aad, aadLen, input, length, output, full, tagLen, 0) != SUCCESS)
+    {
+        return ERROR;
+    }
+    memcpy(tag, full, tagLen);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Decrypt and verify with AES-CCM.
+ *
+ * @param       aead:      Key state from AesAeadInit()
+ *
+ * @param       nonce:     Nonce used for encryption
+ *
+ * @param       nonceLen:  Nonce bytes, 7..13
+ *
+ * @param       aad:       Additional authenticated data
+ *
+ * @param       aadLen:    AAD bytes
+ *
+ * @param       input:     Ciphertext, any alignment
+ *
+ * @param       length:    Ciphertext bytes
+ *
+ * @param       output:    Plaintext, may be input
+ *
+ * @param       tag:       Received tag
+ *
+ * @param       tagLen:    Tag bytes
+ *
+ * @retval      SUCCESS, or ERROR (bad lengths, or authentication failed
+ *              and output has been cleared)
+ */
+uint8_t AesCcmDecrypt(AesAead_T* aead, const uint8_t* nonce, uint32_t nonceLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      const uint8_t* tag, uint32_t tagLen)
+{
+    uint8_t full[AES_BLOCK_SIZE];
+
+    if (CcmCrypt(aead, nonce, nonceLen, aad, aadLen, input, length, output, full, tagLen, 1) != SUCCESS)
+    {
+        return ERROR;
+    }
+    if (!AeadTagMatch(full, tag, tagLen))
+    {
+        memset(output, 0, length);
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
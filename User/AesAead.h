@@ -0,0 +1,54 @@
+#ifndef AES_AEAD_H
+#define AES_AEAD_H
+
+#include <stdint.h>
+#include "Aes.h"
+
+/*
+ * AES-GCM (SP 800-38D) and AES-CCM (SP 800-38C) authenticated encryption
+ * on the CTR mode of Aes.h.
+ *
+ * AesAeadInit() expands the key and, for GCM, the 4-bit GHASH table of
+ * multiples of H (256 bytes in the context), so a connection or an update
+ * session pays for it once. Each message then runs the counter mode and
+ * the authentication over every block in a single pass: GHASH (GCM) or
+ * CBC-MAC (CCM) of a block directly follows its encryption, while the
+ * block is still in registers.
+ *
+ * Decryption checks the tag in constant time and, on a mismatch, clears
+ * the output and returns ERROR, so unauthenticated plaintext is never
+ * handed out. Input and output may be the same buffer.
+ */
+
+/**
+ * @brief Key state for GCM and CCM; treat as opaque
+ */
+typedef struct
+{
+    AesContext_T    aes;            /*!< Key schedule, CTR mode */
+    uint32_t        ghash[16][4];   /*!< GCM: H times each 4-bit value, big-endian words */
+} AesAead_T;
+
+uint8_t AesAeadInit(AesAead_T* aead, const uint8_t* key, uint16_t keysize);
+
+/* GCM: any IV length (12 bytes is the fast path), tag 4..16 bytes */
+uint8_t AesGcmEncrypt(AesAead_T* aead, const uint8_t* iv, uint32_t ivLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      uint8_t* tag, uint32_t tagLen);
+uint8_t AesGcmDecrypt(AesAead_T* aead, const uint8_t* iv, uint32_t ivLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      const uint8_t* tag, uint32_t tagLen);
+
+/* CCM: nonce 7..13 bytes, tag 4..16 bytes and even */
+uint8_t AesCcmEncrypt(AesAead_T* aead, const uint8_t* nonce, uint32_t nonceLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      uint8_t* tag, uint32_t tagLen);
+uint8_t AesCcmDecrypt(AesAead_T* aead, const uint8_t* nonce, uint32_t nonceLen,
+                      const uint8_t* aad, uint32_t aadLen,
+                      const uint8_t* input, uint32_t length, uint8_t* output,
+                      const uint8_t* tag, uint32_t tagLen);
+
+#endif // AES_AEAD_H
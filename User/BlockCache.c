@@ -0,0 +1,662 @@
+#include <stddef.h>
+#include <string.h>
+#include "BlockCache.h"
+
+#define BLOCKCACHE_NONE     0xFFFFU
+
+/* Queues */
+#define BLOCKCACHE_FREE     0U
+#define BLOCKCACHE_IN       1U      /* 2Q: admitted once, FIFO */
+#define BLOCKCACHE_MAIN     2U      /* LRU */
+
+/* Line flags */
+#define BLOCKCACHE_DIRTY    0x01U
+#define BLOCKCACHE_AHEAD    0x02U   /* Read ahead, not asked for yet */
+
+static BlockCacheQueue_T* BlockCacheQueue(BlockCache_T* cache, uint8_t queue)
+{
+    switch (queue)
+    {
+        case BLOCKCACHE_FREE:
+            return &cache->free;
+
+        case BLOCKCACHE_IN:
+            return &cache->in;
+
+        default:
+            return &cache->main;
+    }
+}
+
+/* Make a line the newest of a queue */
+static void BlockCachePush(BlockCache_T* cache, uint16_t index, uint8_t queue)
+{
+    BlockCacheQueue_T* q = BlockCacheQueue(cache, queue);
+    BlockCacheLine_T* line = &cache->line[index];
+
+    line->queue = queue;
+    line->prev = BLOCKCACHE_NONE;
+    line->next = q->head;
+    if (q->head != BLOCKCACHE_NONE)
+    {
+        cache->line[q->head].prev = index;
+    }
+    else
+    {
+        q->tail = index;
+    }
+    q->head = index;
+    q->count++;
+}
+
+static void BlockCacheUnlink(BlockCache_T* cache, uint16_t index)
+{
+    BlockCacheLine_T* line = &cache->line[index];
+    BlockCacheQueue_T* q = BlockCacheQueue(cache, line->queue);
+
+    if (line->prev != BLOCKCACHE_NONE)
+    {
+        cache->line[line->prev].next = line->next;
+    }
+    else
+    {
+        q->head = line->next;
+    }
+    if (line->next != BLOCKCACHE_NONE)
+    {
+        cache->line[line->next].prev = line->prev;
+    }
+    else
+    {
+        q->tail = line->prev;
+    }
+    q->count--;
+}
+
+static uint16_t* BlockCacheBucket(BlockCache_T* cache, uint32_t block)
+{
+    return &cache->hash[block & (BLOCKCACHE_HASH - 1U)];
+}
+
+static uint16_t BlockCacheLookup(BlockCache_T* cache, uint32_t block)
+{
+    uint16_t index = *BlockCacheBucket(cache, block);
+
+    while ((index != BLOCKCACHE_NONE) && (cache->line[index].block != block))
+    {
+        index = cache->line[index].hashNext;
+    }
+
+    return index;
+}
+
+static uint8_t* BlockCacheData(BlockCache_T* cache, uint16_t index)
+{
+    return cache->data + (uint32_t)index * cache->device.blockSize;
+}
+
+/* 2Q ghost list: block numbers recently dropped from the in-queue */
+static void BlockCacheGhostAdd(BlockCache_T* cache, uint32_t block)
+{
+    if (cache->ghostCount == cache->ghostMax)
+    {
+        cache->ghost[cache->ghostHead] = block;
+        cache->ghostHead = (cache->ghostHead + 1U) % cache->ghostMax;
+    }
+    else
+    {
+        cache->ghost[(cache->ghostHead + cache->ghostCount) % cache->ghostMax] = block;
+        cache->ghostCount++;
+    }
+}
+
+/* Remove block from the ghost list; 1 when it was there */
+static uint8_t BlockCacheGhostTake(BlockCache_T* cache, uint32_t block)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < cache->ghostCount; i++)
+    {
+        if (cache->ghost[(cache->ghostHead + i) % cache->ghostMax] == block)
+        {
+            /* Close the gap from the oldest end */
+            for (j = i; j > 0; j--)
+            {
+                cache->ghost[(cache->ghostHead + j) % cache->ghostMax] =
+                    cache->ghost[(cache->ghostHead + j - 1U) % cache->ghostMax];
+            }
+            cache->ghostHead = (cache->ghostHead + 1U) % cache->ghostMax;
+            cache->ghostCount--;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief       Write a dirty line back with its dirty neighbours.
+ *
+ * @param       cache:  Cache
+ *
+ * @param       index:  Dirty line
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        The run starts up to BLOCKCACHE_BATCH - 1 blocks before
+ *              the line and holds at most BLOCKCACHE_BATCH blocks; more
+ *              than one go out through the stage in a single write.
+ */
+static uint8_t BlockCacheWriteBack(BlockCache_T* cache, uint16_t index)
+{
+    uint32_t size = cache->device.blockSize;
+    uint32_t block = cache->line[index].block;
+    uint32_t first = block;
+    uint16_t run[BLOCKCACHE_BATCH];
+    uint16_t other;
+    uint32_t n, i;
+    uint8_t status;
+
+    while ((first > 0) && ((block - first) < (BLOCKCACHE_BATCH - 1U)))
+    {
+        other = BlockCacheLookup(cache, first - 1U);
+        if ((other == BLOCKCACHE_NONE) || ((cache->line[other].flags & BLOCKCACHE_DIRTY) == 0))
+        {
+            break;
+        }
+        first--;
+    }
+
+    for (n = 0; (n < BLOCKCACHE_BATCH) && ((first + n) < cache->device.blocks); n++)
+    {
+        other = BlockCacheLookup(cache, first + n);
+        if ((other == BLOCKCACHE_NONE) || ((cache->line[other].flags & BLOCKCACHE_DIRTY) == 0))
+        {
+            break;
+        }
+        run[n] = other;
+    }
+
+    if (n == 1U)
+    {
+        status = BlockDevWrite(cache->lower, first, BlockCacheData(cache, run[0]), 1);
+    }
+    else
+    {
+        for (i = 0; i < n; i++)
+        {
+            memcpy(cache->stage + i * size, BlockCacheData(cache, run[i]), size);
+        }
+        status = BlockDevWrite(cache->lower, first, cache->stage, n);
+    }
+    if (status != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        cache->line[run[i]].flags &= (uint8_t)~BLOCKCACHE_DIRTY;
+    }
+    cache->dirty -= n;
+    cache->stats.writeBacks++;
+    cache->stats.writeBackBlocks += n;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Take a line for a new block.
+ *
+ * @param       cache:  Cache
+ *
+ * @retval      Line, detached from every queue and the hash;
+ *              BLOCKCACHE_NONE when writing back the victim failed
+ *
+ * @note        Free lines first. Then LRU replaces the oldest main line;
+ *              2Q the oldest in-queue line while that queue is over its
+ *              share, remembering the block in the ghost list.
+ */
+static uint16_t BlockCacheAllocate(BlockCache_T* cache)
+{
+    uint16_t index;
+    uint16_t* link;
+    uint8_t fromIn;
+
+    if (cache->free.count != 0)
+    {
+        index = cache->free.head;
+        BlockCacheUnlink(cache, index);
+        return index;
+    }
+
+    fromIn = (cache->main.count == 0) || (cache->in.count > cache->inMax);
+    index = fromIn ? cache->in.tail : cache->main.tail;
+
+    if (((cache->line[index].flags & BLOCKCACHE_DIRTY) != 0) && (BlockCacheWriteBack(cache, index) != SUCCESS))
+    {
+        return BLOCKCACHE_NONE;
+    }
+
+    BlockCacheUnlink(cache, index);
+    link = BlockCacheBucket(cache, cache->line[index].block);
+    while (*link != index)
+    {
+        link = &cache->line[*link].hashNext;
+    }
+    *link = cache->line[index].hashNext;
+
+    if (fromIn && (cache->policy == BLOCKCACHE_2Q))
+    {
+        BlockCacheGhostAdd(cache, cache->line[index].block);
+    }
+    cache->line[index].flags = 0;
+    cache->stats.evictions++;
+
+    return index;
+}
+
+/* Enter an allocated line for block */
+static void BlockCacheInsert(BlockCache_T* cache, uint16_t index, uint32_t block, uint8_t flags)
+{
+    uint16_t* bucket = BlockCacheBucket(cache, block);
+    uint8_t queue = BLOCKCACHE_MAIN;
+
+    cache->line[index].block = block;
+    cache->line[index].flags = flags;
+    cache->line[index].hashNext = *bucket;
+    *bucket = index;
+
+    if (cache->policy == BLOCKCACHE_2Q)
+    {
+        if (BlockCacheGhostTake(cache, block))
+        {
+            cache->stats.ghostHits++;
+        }
+        else
+        {
+            queue = BLOCKCACHE_IN;
+        }
+    }
+    BlockCachePush(cache, index, queue);
+}
+
+/* A hit: main lines become the newest, 2Q in-queue lines keep their place */
+static void BlockCacheTouch(BlockCache_T* cache, uint16_t index)
+{
+    if (cache->line[index].queue == BLOCKCACHE_MAIN)
+    {
+        BlockCacheUnlink(cache, index);
+        BlockCachePush(cache, index, BLOCKCACHE_MAIN);
+    }
+}
+
+/*!
+ * @brief       Read a missing block and the missing blocks after it.
+ *
+ * @param       cache:  Cache
+ *
+ * @param       block:  Missing block
+ *
+ * @param       want:   Blocks the request needs from here
+ *
+ * @param       max:    Blocks to read at most, read-ahead included
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Stops at the first cached block. Lines are taken before the
+ *              read, as replacing them may write back through the stage.
+ */
+static uint8_t BlockCacheFill(BlockCache_T* cache, uint32_t block, uint32_t want, uint32_t max)
+{
+    uint32_t size = cache->device.blockSize;
+    uint16_t index[BLOCKCACHE_BATCH];
+    uint32_t n, i;
+    uint8_t status;
+
+    if (max > BLOCKCACHE_BATCH)
+    {
+        max = BLOCKCACHE_BATCH;
+    }
+    if (max > cache->lines / 2U)
+    {
+        max = cache->lines / 2U;
+    }
+    if (max > cache->device.blocks - block)
+    {
+        max = cache->device.blocks - block;
+    }
+
+    status = SUCCESS;
+    for (n = 0; (n < max) && ((n == 0) || (BlockCacheLookup(cache, block + n) == BLOCKCACHE_NONE)); n++)
+    {
+        index[n] = BlockCacheAllocate(cache);
+        if (index[n] == BLOCKCACHE_NONE)
+        {
+            status = ERROR;
+            break;
+        }
+    }
+
+    if ((status == SUCCESS) && (n == 1U))
+    {
+        status = BlockDevRead(cache->lower, block, BlockCacheData(cache, index[0]), 1);
+    }
+    else if (status == SUCCESS)
+    {
+        status = BlockDevRead(cache->lower, block, cache->stage, n);
+        for (i = 0; (status == SUCCESS) && (i < n); i++)
+        {
+            memcpy(BlockCacheData(cache, index[i]), cache->stage + i * size, size);
+        }
+    }
+
+    if (status != SUCCESS)
+    {
+        for (i = 0; i < n; i++)
+        {
+            BlockCachePush(cache, index[i], BLOCKCACHE_FREE);
+        }
+        return ERROR;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        BlockCacheInsert(cache, index[i], block + i, (i < want) ? 0 : BLOCKCACHE_AHEAD);
+    }
+    if (n > want)
+    {
+        cache->stats.readAheads += n - want;
+    }
+
+    return SUCCESS;
+}
+
+static uint8_t BlockCacheDevRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    return BlockCacheRead(dev->ctx, block, buffer, count);
+}
+
+static uint8_t BlockCacheDevWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    return BlockCacheWrite(dev->ctx, block, buffer, count);
+}
+
+static uint8_t BlockCacheDevSync(BlockDev_T* dev)
+{
+    return BlockCacheFlush(dev->ctx);
+}
+
+/*!
+ * @brief       Set up a cache in front of a device.
+ *
+ * @param       cache:    Cache
+ *
+ * @param       lower:    Cached device
+ *
+ * @param       storage:  Stage and line data, word aligned
+ *
+ * @param       size:     Bytes of storage; lines beyond BLOCKCACHE_LINES
+ *                        are left unused
+ *
+ * @param       policy:   BLOCKCACHE_LRU or BLOCKCACHE_2Q
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t BlockCacheInit(BlockCache_T* cache, BlockDev_T* lower, void* storage, uint32_t size,
+                       uint8_t policy)
+{
+    uint32_t lines = size / lower->blockSize;
+    uint16_t i;
+
+    if (lines < BLOCKCACHE_BATCH + 2U)
+    {
+        return ERROR;
+    }
+    lines -= BLOCKCACHE_BATCH;
+    if (lines > BLOCKCACHE_LINES)
+    {
+        lines = BLOCKCACHE_LINES;
+    }
+
+    memset(cache, 0, sizeof(*cache));
+    cache->device.blockSize = lower->blockSize;
+    cache->device.blocks = lower->blocks;
+    cache->device.read = BlockCacheDevRead;
+    cache->device.write = BlockCacheDevWrite;
+    cache->device.sync = BlockCacheDevSync;
+    cache->device.ctx = cache;
+    cache->lower = lower;
+    cache->policy = policy;
+    cache->lines = lines;
+    cache->inMax = (lines >= 4U) ? lines / 4U : 1U;
+    cache->ghostMax = lines / 2U;
+    cache->stage = storage;
+    cache->data = (uint8_t*)storage + BLOCKCACHE_BATCH * lower->blockSize;
+
+    memset(cache->hash, 0xFF, sizeof(cache->hash));
+    cache->free.head = cache->free.tail = BLOCKCACHE_NONE;
+    cache->in.head = cache->in.tail = BLOCKCACHE_NONE;
+    cache->main.head = cache->main.tail = BLOCKCACHE_NONE;
+    for (i = 0; i < lines; i++)
+    {
+        BlockCachePush(cache, i, BLOCKCACHE_FREE);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Read blocks through the cache.
+ *
+ * @param       cache:   Cache
+ *
+ * @param       block:   First block
+ *
+ * @param       buffer:  count * blockSize bytes
+ *
+ * @param       count:   Blocks
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t BlockCacheRead(BlockCache_T* cache, uint32_t block, void* buffer, uint32_t count)
+{
+    uint32_t size = cache->device.blockSize;
+    uint8_t* out = buffer;
+    uint16_t index;
+    uint32_t i, max;
+
+    if ((count == 0) || (block >= cache->device.blocks) || (count > cache->device.blocks - block))
+    {
+        return ERROR;
+    }
+
+    cache->stream = (block == cache->nextBlock) ? cache->stream + 1U : 1U;
+    cache->nextBlock = block + count;
+    cache->stats.readBlocks += count;
+
+    if ((count >= BLOCKCACHE_BATCH) && (((uintptr_t)buffer & 3U) == 0))
+    {
+        if (BlockDevRead(cache->lower, block, buffer, count) != SUCCESS)
+        {
+            return ERROR;
+        }
+        cache->stats.bypassBlocks += count;
+
+        /* The device is behind on dirty lines */
+        for (i = 0; (cache->dirty != 0) && (i < count); i++)
+        {
+            index = BlockCacheLookup(cache, block + i);
+            if ((index != BLOCKCACHE_NONE) && ((cache->line[index].flags & BLOCKCACHE_DIRTY) != 0))
+            {
+                memcpy(out + i * size, BlockCacheData(cache, index), size);
+            }
+        }
+        return SUCCESS;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        index = BlockCacheLookup(cache, block + i);
+        if (index == BLOCKCACHE_NONE)
+        {
+            max = (cache->stream >= BLOCKCACHE_SEQUENTIAL) ? BLOCKCACHE_BATCH : count - i;
+            if (BlockCacheFill(cache, block + i, count - i, max) != SUCCESS)
+            {
+                return ERROR;
+            }
+            index = BlockCacheLookup(cache, block + i);
+        }
+        else
+        {
+            cache->stats.readHits++;
+            if ((cache->line[index].flags & BLOCKCACHE_AHEAD) != 0)
+            {
+                cache->line[index].flags &= (uint8_t)~BLOCKCACHE_AHEAD;
+                cache->stats.readAheadHits++;
+            }
+            BlockCacheTouch(cache, index);
+        }
+        memcpy(out + i * size, BlockCacheData(cache, index), size);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Write blocks into the cache.
+ *
+ * @param       cache:   Cache
+ *
+ * @param       block:   First block
+ *
+ * @param       buffer:  count * blockSize bytes
+ *
+ * @param       count:   Blocks
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Whole blocks need no read: missing ones just take a line.
+ */
+uint8_t BlockCacheWrite(BlockCache_T* cache, uint32_t block, const void* buffer, uint32_t count)
+{
+    uint32_t size = cache->device.blockSize;
+    const uint8_t* in = buffer;
+    BlockCacheLine_T* line;
+    uint16_t index;
+    uint32_t i;
+
+    if ((count == 0) || (block >= cache->device.blocks) || (count > cache->device.blocks - block))
+    {
+        return ERROR;
+    }
+
+    cache->stats.writeBlocks += count;
+
+    if ((count >= BLOCKCACHE_BATCH) && (((uintptr_t)buffer & 3U) == 0))
+    {
+        if (BlockDevWrite(cache->lower, block, buffer, count) != SUCCESS)
+        {
+            return ERROR;
+        }
+        cache->stats.bypassBlocks += count;
+
+        /* Cached copies take the new data and are clean again */
+        for (i = 0; i < count; i++)
+        {
+            index = BlockCacheLookup(cache, block + i);
+            if (index != BLOCKCACHE_NONE)
+            {
+                line = &cache->line[index];
+                memcpy(BlockCacheData(cache, index), in + i * size, size);
+                if ((line->flags & BLOCKCACHE_DIRTY) != 0)
+                {
+                    line->flags &= (uint8_t)~BLOCKCACHE_DIRTY;
+                    cache->dirty--;
+                }
+            }
+        }
+        return SUCCESS;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        index = BlockCacheLookup(cache, block + i);
+        if (index == BLOCKCACHE_NONE)
+        {
+            index = BlockCacheAllocate(cache);
+            if (index == BLOCKCACHE_NONE)
+            {
+                return ERROR;
+            }
+            BlockCacheInsert(cache, index, block + i, 0);
+        }
+        else
+        {
+            cache->stats.writeHits++;
+            BlockCacheTouch(cache, index);
+        }
+
+        line = &cache->line[index];
+        memcpy(BlockCacheData(cache, index), in + i * size, size);
+        line->flags &= (uint8_t)~BLOCKCACHE_AHEAD;
+        if ((line->flags & BLOCKCACHE_DIRTY) == 0)
+        {
+            line->flags |= BLOCKCACHE_DIRTY;
+            cache->dirty++;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Write every dirty line to the device and sync it.
+ *
+ * @param       cache:  Cache
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Lines go out lowest block first, runs of neighbours in one
+ *              write each. Lines stay cached, clean.
+ */
+uint8_t BlockCacheFlush(BlockCache_T* cache)
+{
+    uint16_t first, i;
+
+    while (cache->dirty != 0)
+    {
+        first = BLOCKCACHE_NONE;
+        for (i = 0; i < cache->lines; i++)
+        {
+            if (((cache->line[i].flags & BLOCKCACHE_DIRTY) != 0) &&
+                ((first == BLOCKCACHE_NONE) || (cache->line[i].block < cache->line[first].block)))
+            {
+                first = i;
+            }
+        }
+        if (BlockCacheWriteBack(cache, first) != SUCCESS)
+        {
+            return ERROR;
+        }
+    }
+
+    return BlockDevSync(cache->lower);
+}
+
+/*!
+ * @brief       Read hit rate.
+ *
+ * @param       cache:  Cache
+ *
+ * @retval      Blocks found in the cache per 1000 blocks read
+ */
+uint32_t BlockCacheHitRate(const BlockCache_T* cache)
+{
+    if (cache->stats.readBlocks == 0)
+    {
+        return 0;
+    }
+
+    return (uint32_t)((uint64_t)cache->stats.readHits * 1000U / cache->stats.readBlocks);
+}
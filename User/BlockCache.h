@@ -0,0 +1,141 @@
+#ifndef BLOCK_CACHE_H
+#define BLOCK_CACHE_H
+
+#include <stdint.h>
+#include "BlockDev.h"
+
+/*
+ * Write-back block cache between a block device (SD card, SPI NOR, RAM)
+ * and a filesystem, which uses &cache->device like any other BlockDev_T.
+ *
+ * Lines are found through a hash of the block number and replaced by one
+ * of two policies. BLOCKCACHE_LRU keeps one recency list. BLOCKCACHE_2Q
+ * (Johnson and Shasha) admits blocks to a short FIFO first and only
+ * promotes them to the main LRU list when they are asked for again soon
+ * after leaving it, which a ghost list of recently dropped block numbers
+ * records; one sequential scan then cannot push the filesystem metadata
+ * out of the cache.
+ *
+ * Writes only mark lines dirty. A dirty line goes to the device when it is
+ * replaced or on BlockCacheFlush() (the device's sync operation), together
+ * with the dirty neighbours before and after it as one multi-block write
+ * of up to BLOCKCACHE_BATCH blocks. Misses fetch every consecutive missing
+ * block of the request in one read; once BLOCKCACHE_SEQUENTIAL requests in
+ * a row continue each other, a miss also reads ahead to BLOCKCACHE_BATCH
+ * blocks. Word-aligned requests of BLOCKCACHE_BATCH blocks or more go
+ * straight to the device, keeping cached copies in step.
+ *
+ * BlockCacheInit() takes the line storage from the caller, so it can sit
+ * in SRAM or in SDRAM mapped by the DMC (not in CCM when the device uses
+ * DMA). The first BLOCKCACHE_BATCH blocks of it stage multi-block
+ * transfers, the rest are lines. The cache is not reentrant: use it from
+ * one context.
+ */
+
+/* Most lines per cache */
+#ifndef BLOCKCACHE_LINES
+#define BLOCKCACHE_LINES 64U
+#endif
+
+/* Hash buckets, a power of two */
+#ifndef BLOCKCACHE_HASH
+#define BLOCKCACHE_HASH 128U
+#endif
+
+/* Blocks per coalesced write, read-ahead or staged read */
+#ifndef BLOCKCACHE_BATCH
+#define BLOCKCACHE_BATCH 8U
+#endif
+
+/* Consecutive requests that turn read-ahead on */
+#ifndef BLOCKCACHE_SEQUENTIAL
+#define BLOCKCACHE_SEQUENTIAL 2U
+#endif
+
+/* Replacement policies */
+#define BLOCKCACHE_LRU      0U
+#define BLOCKCACHE_2Q       1U
+
+/**
+ * @brief Cache line
+ */
+typedef struct
+{
+    uint32_t    block;
+    uint16_t    prev;           /*!< Towards the newest line of its queue */
+    uint16_t    next;
+    uint16_t    hashNext;
+    uint8_t     queue;          /*!< Free, 2Q in-queue or main */
+    uint8_t     flags;          /*!< Dirty, read ahead */
+} BlockCacheLine_T;
+
+/**
+ * @brief Line queue, newest first
+ */
+typedef struct
+{
+    uint16_t    head;
+    uint16_t    tail;
+    uint16_t    count;
+} BlockCacheQueue_T;
+
+/**
+ * @brief Counters since BlockCacheInit()
+ */
+typedef struct
+{
+    uint32_t    readBlocks;         /*!< Blocks asked for */
+    uint32_t    readHits;           /*!< Of those, found in the cache */
+    uint32_t    writeBlocks;
+    uint32_t    writeHits;          /*!< Overwrote a cached block */
+    uint32_t    readAheads;         /*!< Blocks fetched ahead of a request */
+    uint32_t    readAheadHits;      /*!< Of those, asked for later */
+    uint32_t    ghostHits;          /*!< 2Q misses promoted to the main queue */
+    uint32_t    bypassBlocks;       /*!< Moved straight to or from the device */
+    uint32_t    evictions;
+    uint32_t    writeBacks;         /*!< Device writes of dirty lines */
+    uint32_t    writeBackBlocks;    /*!< Blocks in them */
+} BlockCacheStats_T;
+
+/**
+ * @brief Cache state
+ */
+typedef struct
+{
+    BlockDev_T          device;     /*!< The cached device, for the filesystem */
+    BlockDev_T*         lower;
+    uint8_t             policy;
+    uint32_t            lines;
+    uint32_t            inMax;      /*!< 2Q in-queue length */
+    uint32_t            ghostMax;
+    uint8_t*            data;       /*!< lines * blockSize bytes */
+    uint8_t*            stage;      /*!< BLOCKCACHE_BATCH blocks */
+    BlockCacheLine_T    line[BLOCKCACHE_LINES];
+    uint16_t            hash[BLOCKCACHE_HASH];
+    BlockCacheQueue_T   free;
+    BlockCacheQueue_T   in;
+    BlockCacheQueue_T   main;
+    uint32_t            ghost[BLOCKCACHE_LINES / 2U];
+    uint32_t            ghostHead;
+    uint32_t            ghostCount;
+    uint32_t            dirty;      /*!< Dirty lines */
+    uint32_t            nextBlock;  /*!< Just after the last read */
+    uint32_t            stream;     /*!< Reads in a row continuing each other */
+    BlockCacheStats_T   stats;
+} BlockCache_T;
+
+/* ERROR when storage holds fewer than BLOCKCACHE_BATCH + 2 blocks */
+uint8_t BlockCacheInit(BlockCache_T* cache, BlockDev_T* lower, void* storage, uint32_t size,
+                       uint8_t policy);
+
+/* The cached device's operations, also reachable through cache->device */
+uint8_t BlockCacheRead(BlockCache_T* cache, uint32_t block, void* buffer, uint32_t count);
+uint8_t BlockCacheWrite(BlockCache_T* cache, uint32_t block, const void* buffer, uint32_t count);
+
+/* Barrier: every dirty line written, in block order, then the device synced */
+uint8_t BlockCacheFlush(BlockCache_T* cache);
+
+/* Hits per 1000 blocks read */
+uint32_t BlockCacheHitRate(const BlockCache_T* cache);
+
+#endif // BLOCK_CACHE_H
@@ -0,0 +1,201 @@
+#include <string.h>
+#include "BlockDev.h"
+
+/*!
+ * @brief       Read blocks.
+ *
+ * @param       dev:     Device
+ *
+ * @param       block:   First block
+ *
+ * @param       buffer:  count * blockSize bytes, word aligned
+ *
+ * @param       count:   Blocks
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t BlockDevRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    if ((count == 0) || (block >= dev->blocks) || (count > dev->blocks - block))
+    {
+        return ERROR;
+    }
+
+    dev->reads++;
+
+    return dev->read(dev, block, buffer, count);
+}
+
+/*!
+ * @brief       Write blocks.
+ *
+ * @param       dev:     Device
+ *
+ * @param       block:   First block
+ *
+ * @param       buffer:  count * blockSize bytes, word aligned
+ *
+ * @param       count:   Blocks
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t BlockDevWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    if ((count == 0) || (block >= dev->blocks) || (count > dev->blocks - block))
+    {
+        return ERROR;
+    }
+
+    dev->writes++;
+
+    return dev->write(dev, block, buffer, count);
+}
+
+/*!
+ * @brief       Wait until earlier writes are on the medium.
+ *
+ * @param       dev:  Device
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t BlockDevSync(BlockDev_T* dev)
+{
+    return (dev->sync != NULL) ? dev->sync(dev) : SUCCESS;
+}
+
+/* SD card ****************************************************************/
+
+static uint8_t BlockDevSdCardRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    SdCard_T* card = dev->ctx;
+
+    if (SdCardRead(card, block, buffer, count, NULL, NULL) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    return SdCardWait(card);
+}
+
+static uint8_t BlockDevSdCardWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    SdCard_T* card = dev->ctx;
+
+    if (SdCardWrite(card, block, buffer, count, NULL, NULL) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Includes the programming time */
+    return SdCardWait(card);
+}
+
+/*!
+ * @brief       SD card as a block device of 512-byte blocks.
+ *
+ * @param       dev:   Device to fill in
+ *
+ * @param       card:  Card, after SdCardInit()
+ *
+ * @retval      None
+ */
+void BlockDevSdCardInit(BlockDev_T* dev, SdCard_T* card)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->blockSize = SDCARD_BLOCK_SIZE;
+    dev->blocks = card->blocks;
+    dev->read = BlockDevSdCardRead;
+    dev->write = BlockDevSdCardWrite;
+    dev->ctx = card;
+}
+
+/* SPI NOR flash **********************************************************/
+
+static uint8_t BlockDevSpiNorRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    SpiNor_T* nor = dev->ctx;
+
+    if (SpiNorRead(nor, block * dev->blockSize, buffer, count * dev->blockSize, NULL, NULL) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    return SpiNorWait(nor);
+}
+
+static uint8_t BlockDevSpiNorWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    SpiNor_T* nor = dev->ctx;
+    uint32_t address = block * dev->blockSize;
+    uint32_t length = count * dev->blockSize;
+
+    if ((SpiNorErase(nor, address, length, NULL, NULL) != SUCCESS) || (SpiNorWait(nor) != SUCCESS) ||
+        (SpiNorProgram(nor, address, buffer, length, NULL, NULL) != SUCCESS))
+    {
+        return ERROR;
+    }
+
+    return SpiNorWait(nor);
+}
+
+/*!
+ * @brief       SPI NOR flash as a block device of erase blocks.
+ *
+ * @param       dev:  Device to fill in
+ *
+ * @param       nor:  Flash, after SpiNorInit()
+ *
+ * @retval      None
+ *
+ * @note        A write erases its blocks first, so every block written
+ *              costs an erase cycle; a write-back cache in front keeps
+ *              that down.
+ */
+void BlockDevSpiNorInit(BlockDev_T* dev, SpiNor_T* nor)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->blockSize = nor->eraseSize;
+    dev->blocks = nor->size / nor->eraseSize;
+    dev->read = BlockDevSpiNorRead;
+    dev->write = BlockDevSpiNorWrite;
+    dev->ctx = nor;
+}
+
+/* RAM disk ***************************************************************/
+
+static uint8_t BlockDevRamRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count)
+{
+    memcpy(buffer, (uint8_t*)dev->ctx + block * dev->blockSize, count * dev->blockSize);
+
+    return SUCCESS;
+}
+
+static uint8_t BlockDevRamWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count)
+{
+    memcpy((uint8_t*)dev->ctx + block * dev->blockSize, buffer, count * dev->blockSize);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       RAM as a block device.
+ *
+ * @param       dev:        Device to fill in
+ *
+ * @param       memory:     blocks * blockSize bytes
+ *
+ * @param       blockSize:  Bytes per block
+ *
+ * @param       blocks:     Block count
+ *
+ * @retval      None
+ */
+void BlockDevRamInit(BlockDev_T* dev, uint8_t* memory, uint32_t blockSize, uint32_t blocks)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->blockSize = blockSize;
+    dev->blocks = blocks;
+    dev->read = BlockDevRamRead;
+    dev->write = BlockDevRamWrite;
+    dev->ctx = memory;
+}
@@ -0,0 +1,48 @@
+#ifndef BLOCK_DEV_H
+#define BLOCK_DEV_H
+
+#include <stdint.h>
+#include "SdCard.h"
+#include "SpiNor.h"
+
+/*
+ * Block device: the interface between storage drivers and a filesystem or
+ * the block cache (BlockCache.h). Blocks are numbered from 0 and have one
+ * size; read and write move runs of consecutive blocks and block until
+ * done, so a driver that issues multi-block commands gets whole runs.
+ * sync, when present, returns once earlier writes are on the medium.
+ *
+ * BlockDevSdCardInit() and BlockDevSpiNorInit() wrap the asynchronous
+ * drivers, waiting for each operation. The SPI NOR device uses the erase
+ * block as its block: each write erases the blocks, then programs them.
+ * BlockDevRamInit() is a RAM disk, for tests and as a bench target.
+ */
+
+typedef struct BlockDev BlockDev_T;
+
+/**
+ * @brief Block device operations and geometry
+ */
+struct BlockDev
+{
+    uint32_t    blockSize;                  /*!< Bytes, a multiple of 4 */
+    uint32_t    blocks;
+    uint8_t     (*read)(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count);
+    uint8_t     (*write)(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count);
+    uint8_t     (*sync)(BlockDev_T* dev);   /*!< May be NULL */
+    void*       ctx;                        /*!< Driver instance */
+    uint32_t    reads;                      /*!< Read commands */
+    uint32_t    writes;                     /*!< Write commands */
+};
+
+/* SUCCESS or ERROR; ERROR also for a range beyond the device */
+uint8_t BlockDevRead(BlockDev_T* dev, uint32_t block, void* buffer, uint32_t count);
+uint8_t BlockDevWrite(BlockDev_T* dev, uint32_t block, const void* buffer, uint32_t count);
+uint8_t BlockDevSync(BlockDev_T* dev);
+
+/* Devices; the driver instance must be initialized */
+void BlockDevSdCardInit(BlockDev_T* dev, SdCard_T* card);
+void BlockDevSpiNorInit(BlockDev_T* dev, SpiNor_T* nor);
+void BlockDevRamInit(BlockDev_T* dev, uint8_t* memory, uint32_t blockSize, uint32_t blocks);
+
+#endif // BLOCK_DEV_H
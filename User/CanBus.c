@@ -0,0 +1,893 @@
+#include <stdlib.h>
+#include <string.h>
+#include "apm32f4xx_conf.h"
+#include "CanBus.h"
+#include "Critical.h"
+#include "Section.h"
+
+#if CANBUS_ENABLE
+
+#if (CANBUS_RX_QUEUE & (CANBUS_RX_QUEUE - 1)) != 0
+#error "CANBUS_RX_QUEUE must be a power of two"
+#endif
+#if (CANBUS_FILTER_BANKS < 1) || (CANBUS_FILTER_BANKS > 28)
+#error "CANBUS_FILTER_BANKS must be 1..28"
+#endif
+
+_Static_assert(sizeof(CanBusFrame_T) == 16, "CanBusFrame_T must stay 16 bytes");
+
+/* Mailbox identifier register (TXMID/RXMID) */
+#define CANBUS_MID_TXREQ        0x00000001U
+#define CANBUS_MID_RTR          0x00000002U
+#define CANBUS_MID_IDE          0x00000004U
+#define CANBUS_MID_STD_POS      21U
+#define CANBUS_MID_EXT_POS      3U
+
+/* TXSTS, per mailbox n */
+#define CANBUS_TXSTS_RQCP(n)    (0x00000001U << ((n) * 8U))
+#define CANBUS_TXSTS_TXOK(n)    (0x00000002U << ((n) * 8U))
+#define CANBUS_TXSTS_ABRQ(n)    (0x00000080U << ((n) * 8U))
+
+/* RXF0/RXF1 */
+#define CANBUS_RXF_FMNUM        0x00000003U
+#define CANBUS_RXF_FOVR         0x00000010U
+#define CANBUS_RXF_RFOM         0x00000020U
+
+/* MSTS / ERRSTS */
+#define CANBUS_MSTS_ERRI        0x00000004U
+#define CANBUS_ERRSTS_ERRP      0x00000002U
+#define CANBUS_ERRSTS_BOF       0x00000004U
+
+#define CANBUS_MAILBOXES        3U
+
+/* Filter match indices per bank and FIFO: at most four 16-bit list entries per bank */
+#define CANBUS_MATCH_INDICES    (CANBUS_FILTER_BANKS * 4U)
+
+/* Receive queues: written by the FIFO interrupts, read by CanBusReceive()/CanBusPoll() */
+typedef struct
+{
+    CanBusFrame_T       frames[CANBUS_RX_QUEUE];
+    volatile uint32_t   head;       /* Free-running, producer only */
+    volatile uint32_t   tail;       /* Free-running, consumer only */
+} CanBusRxQueue_T;
+
+/* CPU-only data: the queues can live in CCM */
+static CCM_BSS CanBusRxQueue_T rxQueue[2];
+
+/* Transmit frame with its arbitration key and queueing order */
+typedef struct
+{
+    CanBusFrame_T   frame;
+    uint32_t        key;
+    uint32_t        seq;
+} CanBusTxEntry_T;
+
+typedef enum
+{
+    CANBUS_MAILBOX_EMPTY,
+    CANBUS_MAILBOX_PENDING,
+    CANBUS_MAILBOX_ABORTING,
+} CanBusMailboxState_T;
+
+/* Binary min-heap on (key, seq); only touched with the TX interrupt masked */
+static CanBusTxEntry_T txHeap[CANBUS_TX_QUEUE];
+static uint32_t txCount;
+static uint32_t txSeq;
+
+/* What each mailbox holds, to re-queue it when it is aborted */
+static CanBusTxEntry_T txMailbox[CANBUS_MAILBOXES];
+static CanBusMailboxState_T txState[CANBUS_MAILBOXES];
+static uint8_t txAborting;      /* An abort is in flight; its frame has a queue slot reserved */
+
+static CanBusHandler_T handlers[2][CANBUS_MATCH_INDICES];
+static CanBusStats_T canStats;
+static uint32_t errorState;     /* ERRSTS error passive / bus-off seen last */
+
+/*!
+ * @brief       Bus arbitration key of an identifier: a lower key wins.
+ *
+ * @param       id:  Identifier with CANBUS_ID_* flags
+ *
+ * @retval      Key
+ *
+ * @note        Bits in the order they are sent: base ID, RTR (SRR for
+ *              extended frames), IDE, extended ID bits, extended RTR. A
+ *              standard frame beats an extended one with the same base ID.
+ */
+static uint32_t CanBusArbKey(uint32_t id)
+{
+    uint32_t rtr = ((id & CANBUS_ID_RTR) != 0) ? 1U : 0U;
+    uint32_t ext;
+
+    if ((id & CANBUS_ID_EXT) == 0)
+    {
+        return ((id & 0x7FFU) << 21) | (rtr << 20);
+    }
+
+    ext = id & CANBUS_ID_MASK;
+
+    return ((ext >> 18) << 21) | (3U << 19) | ((ext & 0x3FFFFU) << 1) | rtr;
+}
+
+static uint8_t CanBusTxBefore(const CanBusTxEntry_T* a, const CanBusTxEntry_T* b)
+{
+    return (a->key < b->key) || ((a->key == b->key) && ((int32_t)(a->seq - b->seq) < 0));
+}
+
+static void CanBusHeapPush(const CanBusTxEntry_T* entry)
+{
+    uint32_t i = txCount++;
+    uint32_t parent;
+
+    while (i != 0)
+    {
+        parent = (i - 1U) / 2U;
+        if (!CanBusTxBefore(entry, &txHeap[parent]))
+        {
+            break;
+        }
+        txHeap[i] = txHeap[parent];
+        i = parent;
+    }
+    txHeap[i] = *entry;
+
+    if (txCount > canStats.txQueueHigh)
+    {
+        canStats.txQueueHigh = txCount;
+    }
+}
+
+static void CanBusHeapPop(void)
+{
+    const CanBusTxEntry_T* last = &txHeap[--txCount];
+    uint32_t i = 0;
+    uint32_t child;
+
+    while ((child = 2U * i + 1U) < txCount)
+    {
+        if ((child + 1U < txCount) && CanBusTxBefore(&txHeap[child + 1U], &txHeap[child]))
+        {
+            child++;
+        }
+        if (!CanBusTxBefore(&txHeap[child], last))
+        {
+            break;
+        }
+        txHeap[i] = txHeap[child];
+        i = child;
+    }
+    txHeap[i] = *last;
+}
+
+/*!
+ * @brief       Copy a frame into a mailbox and request transmission.
+ *
+ * @param       mailbox:  Empty mailbox
+ *
+ * @param       entry:    Frame
+ *
+ * @retval      None
+ */
+static void CanBusTxLoad(uint32_t mailbox, const CanBusTxEntry_T* entry)
+{
+    const CanBusFrame_T* frame = &entry->frame;
+    uint32_t mid, low, high;
+
+    if ((frame->id & CANBUS_ID_EXT) != 0)
+    {
+        mid = ((frame->id & CANBUS_ID_MASK) << CANBUS_MID_EXT_POS) | CANBUS_MID_IDE;
+    }
+    else
+    {
+        mid = (frame->id & 0x7FFU) << CANBUS_MID_STD_POS;
+    }
+    if ((frame->id & CANBUS_ID_RTR) != 0)
+    {
+        mid |= CANBUS_MID_RTR;
+    }
+    memcpy(&low, &frame->data[0], 4);
+    memcpy(&high, &frame->data[4], 4);
+
+    CAN1->sTxMailBox[mailbox].TXMID = mid;
+    CAN1->sTxMailBox[mailbox].TXDLEN = frame->dlc;
+    CAN1->sTxMailBox[mailbox].TXMDL = low;
+    CAN1->sTxMailBox[mailbox].TXMDH = high;
+    CAN1->sTxMailBox[mailbox].TXMID = mid | CANBUS_MID_TXREQ;
+
+    txMailbox[mailbox] = *entry;
+    txState[mailbox] = CANBUS_MAILBOX_PENDING;
+}
+
+/*!
+ * @brief       Fill empty mailboxes from the queue, then abort the
+ *              lowest-priority mailbox if the queue head outranks it.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Called from the TX interrupt or with interrupts masked. The
+ *              queue head is held back while a frame with the same key is in
+ *              a mailbox: the hardware breaks identifier ties by mailbox
+ *              number, which could reorder them.
+ */
+static void CanBusTxKick(void)
+{
+    uint32_t i, mailbox, worst;
+
+    while (txCount != 0)
+    {
+        mailbox = CANBUS_MAILBOXES;
+        for (i = 0; i < CANBUS_MAILBOXES; i++)
+        {
+            if (txState[i] == CANBUS_MAILBOX_EMPTY)
+            {
+                mailbox = i;
+            }
+            else if (txMailbox[i].key == txHeap[0].key)
+            {
+                return;
+            }
+        }
+        if (mailbox == CANBUS_MAILBOXES)
+        {
+            break;
+        }
+
+        CanBusTxLoad(mailbox, &txHeap[0]);
+        CanBusHeapPop();
+    }
+
+    if (txCount == 0)
+    {
+        return;
+    }
+
+    /* All mailboxes busy: one abort at a time, re-evaluated when it completes */
+    if (txAborting || (txCount == CANBUS_TX_QUEUE))
+    {
+        return;
+    }
+    worst = 0;
+    for (i = 1; i < CANBUS_MAILBOXES; i++)
+    {
+        if (CanBusTxBefore(&txMailbox[worst], &txMailbox[i]))
+        {
+            worst = i;
+        }
+    }
+    if (txHeap[0].key < txMailbox[worst].key)
+    {
+        /* Direct write: the other TXSTS flags are write-1-to-clear */
+        txState[worst] = CANBUS_MAILBOX_ABORTING;
+        txAborting = 1;
+        CAN1->TXSTS = CANBUS_TXSTS_ABRQ(worst);
+    }
+}
+
+/*!
+ * @brief       Find the bit timing for a bit rate from the APB1 clock.
+ *
+ * @param       config:   Timing fields are filled in
+ *
+ * @param       bitrate:  Bits per second
+ *
+ * @retval      SUCCESS, or ERROR when no prescaler divides the clock
+ *
+ * @note        Picks the sample point closest to 87.5% (CiA 301), then the
+ *              most time quanta per bit.
+ */
+static uint8_t CanBusTiming(CAN_Config_T* config, uint32_t bitrate)
+{
+    uint32_t pclk1, pclk2;
+    uint32_t prescaler, quanta, tseg1, tseg2;
+    uint32_t error, bestError = UINT32_MAX;
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+
+    for (prescaler = 1; prescaler <= 1024U; prescaler++)
+    {
+        if ((pclk1 % (prescaler * bitrate)) != 0)
+        {
+            continue;
+        }
+        quanta = pclk1 / (prescaler * bitrate);
+        if ((quanta < 8U) || (quanta > 25U))
+        {
+            continue;
+        }
+
+        /* Phase segment 2 as close to 1/8 of the bit as the field limits allow */
+        tseg2 = (quanta + 4U) / 8U;
+        if (tseg2 < 2U)
+        {
+            tseg2 = 2U;
+        }
+        if (quanta - 1U - tseg2 > 16U)
+        {
+            tseg2 = quanta - 17U;
+        }
+        tseg1 = quanta - 1U - tseg2;
+        if (tseg2 > 8U)
+        {
+            continue;
+        }
+
+        /* Distance from 87.5% in 1/1000 of a bit */
+        error = (uint32_t)abs((int32_t)(((1U + tseg1) * 1000U) / quanta) - 875);
+        if (error < bestError)
+        {
+            bestError = error;
+            config->prescaler = (uint16_t)prescaler;
+            config->timeSegment1 = (CAN_TIME_SEGMENT1_T)(tseg1 - 1U);
+            config->timeSegment2 = (CAN_TIME_SEGMENT2_T)(tseg2 - 1U);
+            config->syncJumpWidth = (CAN_SJW_T)(((tseg2 < 4U) ? tseg2 : 4U) - 1U);
+        }
+    }
+
+    return (bestError != UINT32_MAX) ? SUCCESS : ERROR;
+}
+
+/*!
+ * @brief       Reset CAN1, set the bit rate and enable the interrupts.
+ *
+ * @param       bitrate:  Bits per second, e.g. 1000000
+ *
+ * @param       mode:     CAN_MODE_NORMAL, or a loopback/silent test mode
+ *
+ * @retval      SUCCESS, or ERROR when the bit rate cannot be reached or
+ *              CAN1 does not leave initialization (no bus attached)
+ *
+ * @note        Automatic bus-off recovery and retransmission are on and the
+ *              mailboxes are served by identifier priority. No frame is
+ *              accepted before CanBusSetFilters().
+ */
+uint8_t CanBusInit(uint32_t bitrate, CAN_MODE_T mode)
+{
+    CAN_Config_T config;
+    uint32_t i;
+
+    NVIC_DisableIRQ(CAN1_TX_IRQn);
+    NVIC_DisableIRQ(CAN1_RX0_IRQn);
+    NVIC_DisableIRQ(CAN1_RX1_IRQn);
+    NVIC_DisableIRQ(CAN1_SCE_IRQn);
+
+    RCM_EnableAPB1PeriphClock(RCM_APB1_PERIPH_CAN1);
+    CAN_Reset(CAN1);
+
+    CAN_ConfigStructInit(&config);
+    config.autoBusOffManage = ENABLE;
+    config.mode = mode;
+    if (CanBusTiming(&config, bitrate) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    memset(rxQueue, 0, sizeof(rxQueue));
+    memset(handlers, 0, sizeof(handlers));
+    txCount = 0;
+    txAborting = 0;
+    for (i = 0; i < CANBUS_MAILBOXES; i++)
+    {
+        txState[i] = CANBUS_MAILBOX_EMPTY;
+    }
+    canStats = (CanBusStats_T){ 0 };
+    errorState = 0;
+
+    if (CAN_Config(CAN1, &config) != SUCCESS)
+    {
+        return ERROR;
+    }
+    CAN_SlaveStartBank(CAN1, CANBUS_FILTER_BANKS);
+
+    CAN_EnableInterrupt(CAN1, CAN_INT_TXME | CAN_INT_F0MP | CAN_INT_F0OVR | CAN_INT_F1MP | CAN_INT_F1OVR |
+                        CAN_INT_ERRP | CAN_INT_BOF | CAN_INT_ERR);
+    NVIC_EnableIRQRequest(CAN1_TX_IRQn, CANBUS_IRQ_PRIORITY, 0);
+    NVIC_EnableIRQRequest(CAN1_RX0_IRQn, CANBUS_IRQ_PRIORITY, 0);
+    NVIC_EnableIRQRequest(CAN1_RX1_IRQn, CANBUS_IRQ_PRIORITY, 0);
+    NVIC_EnableIRQRequest(CAN1_SCE_IRQn, CANBUS_IRQ_PRIORITY, 0);
+
+    return SUCCESS;
+}
+
+/* 16-bit filter image: STID[10:0] RTR IDE EXID[17:15] */
+static uint32_t CanBusFilter16(uint32_t id)
+{
+    return ((id & 0x7FFU) << 5) | (((id & CANBUS_ID_RTR) != 0) ? 0x10U : 0U);
+}
+
+/* 32-bit filter image, the RXMID layout */
+static uint32_t CanBusFilter32(uint32_t id)
+{
+    return ((id & CANBUS_ID_MASK) << CANBUS_MID_EXT_POS) | CANBUS_MID_IDE |
+           (((id & CANBUS_ID_RTR) != 0) ? CANBUS_MID_RTR : 0U);
+}
+
+/* Filter bank kinds, in allocation order */
+#define CANBUS_KIND_STD_LIST    0U      /* 16-bit list, 4 IDs */
+#define CANBUS_KIND_EXT_LIST    1U      /* 32-bit list, 2 IDs */
+#define CANBUS_KIND_STD_MASK    2U      /* 16-bit mask, 2 filters */
+#define CANBUS_KIND_EXT_MASK    3U      /* 32-bit mask, 1 filter */
+#define CANBUS_KINDS            4U
+
+static const uint8_t kindPerBank[CANBUS_KINDS] = { 4, 2, 2, 1 };
+
+static uint32_t CanBusFilterKind(const CanBusFilter_T* filter)
+{
+    uint32_t width = ((filter->id & CANBUS_ID_EXT) != 0) ? CANBUS_ID_MASK : 0x7FFU;
+    uint32_t kind = ((filter->id & CANBUS_ID_EXT) != 0) ? CANBUS_KIND_EXT_LIST : CANBUS_KIND_STD_LIST;
+
+    return ((filter->mask & width) == width) ? kind : kind + 2U;
+}
+
+/*!
+ * @brief       Program one filter bank.
+ *
+ * @param       bank:  Bank number
+ *
+ * @param       fifo:  0 or 1
+ *
+ * @param       kind:  CANBUS_KIND_*
+ *
+ * @param       slot:  Entries in filter match index order, one per filter
+ *
+ * @retval      None
+ */
+static void CanBusFilterBank(uint8_t bank, uint32_t fifo, uint32_t kind, const CanBusFilter_T* const* slot)
+{
+    CAN_FilterConfig_T config;
+    uint32_t fr1, fr2;
+
+    /* Match indices run FR1[15:0], FR1[31:16], FR2[15:0], FR2[31:16] at 16-bit scale */
+    switch (kind)
+    {
+        case CANBUS_KIND_STD_LIST:
+            fr1 = CanBusFilter16(slot[0]->id) | (CanBusFilter16(slot[1]->id) << 16);
+            fr2 = CanBusFilter16(slot[2]->id) | (CanBusFilter16(slot[3]->id) << 16);
+            break;
+        case CANBUS_KIND_EXT_LIST:
+            fr1 = CanBusFilter32(slot[0]->id);
+            fr2 = CanBusFilter32(slot[1]->id);
+            break;
+        case CANBUS_KIND_STD_MASK:
+            /* RTR and IDE are always compared */
+            fr1 = CanBusFilter16(slot[0]->id) | ((CanBusFilter16(slot[0]->mask) | 0x18U) << 16);
+            fr2 = CanBusFilter16(slot[1]->id) | ((CanBusFilter16(slot[1]->mask) | 0x18U) << 16);
+            break;
+        default:
+            fr1 = CanBusFilter32(slot[0]->id);
+            fr2 = CanBusFilter32(slot[0]->mask) | CANBUS_MID_RTR;
+            break;
+    }
+
+    config.filterNumber = bank;
+    config.filterActivation = ENABLE;
+    config.filterFIFO = (fifo == 0) ? CAN_FILTER_FIFO_0 : CAN_FILTER_FIFO_1;
+    config.filterMode = (kind <= CANBUS_KIND_EXT_LIST) ? CAN_FILTER_MODE_IDLIST : CAN_FILTER_MODE_IDMASK;
+
+    /* CAN_ConfigFilter() places the halves differently per scale */
+    if ((kind == CANBUS_KIND_STD_LIST) || (kind == CANBUS_KIND_STD_MASK))
+    {
+        config.filterScale = CAN_FILTER_SCALE_16BIT;
+        config.filterIdLow = (uint16_t)fr1;
+        config.filterMaskIdLow = (uint16_t)(fr1 >> 16);
+        config.filterIdHigh = (uint16_t)fr2;
+        config.filterMaskIdHigh = (uint16_t)(fr2 >> 16);
+    }
+    else
+    {
+        config.filterScale = CAN_FILTER_SCALE_32BIT;
+        config.filterIdHigh = (uint16_t)(fr1 >> 16);
+        config.filterIdLow = (uint16_t)fr1;
+        config.filterMaskIdHigh = (uint16_t)(fr2 >> 16);
+        config.filterMaskIdLow = (uint16_t)fr2;
+    }
+
+    CAN_ConfigFilter(&config);
+}
+
+/*!
+ * @brief       Program the acceptance filters and the handler table.
+ *
+ * @param       filters:  Entries
+ *
+ * @param       count:    Number of entries
+ *
+ * @retval      SUCCESS, or ERROR when they need more than
+ *              CANBUS_FILTER_BANKS banks (nothing is changed then)
+ *
+ * @note        Banks are packed per FIFO and kind: exact standard IDs as
+ *              16-bit lists (4 per bank), exact extended IDs as 32-bit
+ *              lists (2), standard masks as 16-bit masks (2) and extended
+ *              masks as 32-bit masks (1). Unused slots repeat the bank's
+ *              first entry. The hardware numbers the filters of each FIFO
+ *              in bank order, which is the order they are written here, so
+ *              the handler table is filled alongside.
+ */
+uint8_t CanBusSetFilters(const CanBusFilter_T* filters, uint32_t count)
+{
+    static CanBusHandler_T table[2][CANBUS_MATCH_INDICES];
+    const CanBusFilter_T* slot[4];
+    CAN_FilterConfig_T config;
+    uint32_t used[2][CANBUS_KINDS] = { { 0 } };
+    uint32_t matchIndex[2] = { 0, 0 };
+    uint32_t banks = 0;
+    uint32_t fifo, kind, i, n;
+    uint8_t bank = 0;
+
+    /* Count first so a list that does not fit leaves the filters alone */
+    for (i = 0; i < count; i++)
+    {
+        used[filters[i].fifo & 1U][CanBusFilterKind(&filters[i])]++;
+    }
+    for (fifo = 0; fifo < 2U; fifo++)
+    {
+        for (kind = 0; kind < CANBUS_KINDS; kind++)
+        {
+            banks += (used[fifo][kind] + kindPerBank[kind] - 1U) / kindPerBank[kind];
+        }
+    }
+    if (banks > CANBUS_FILTER_BANKS)
+    {
+        return ERROR;
+    }
+
+    memset(table, 0, sizeof(table));
+    for (fifo = 0; fifo < 2U; fifo++)
+    {
+        for (kind = 0; kind < CANBUS_KINDS; kind++)
+        {
+            n = 0;
+            for (i = 0; i < count; i++)
+            {
+                if (((filters[i].fifo & 1U) != fifo) || (CanBusFilterKind(&filters[i]) != kind))
+                {
+                    continue;
+                }
+                slot[n++] = &filters[i];
+                used[fifo][kind]--;
+                if ((n == kindPerBank[kind]) || (used[fifo][kind] == 0))
+                {
+                    while (n < kindPerBank[kind])
+                    {
+                        slot[n++] = slot[0];
+                    }
+                    CanBusFilterBank(bank++, fifo, kind, slot);
+                    for (n = 0; n < kindPerBank[kind]; n++)
+                    {
+                        table[fifo][matchIndex[fifo]++] = slot[n]->handler;
+                    }
+                    n = 0;
+                }
+            }
+        }
+    }
+
+    /* Switch off the banks left over from a longer list */
+    memset(&config, 0, sizeof(config));
+    config.filterActivation = DISABLE;
+    config.filterScale = CAN_FILTER_SCALE_32BIT;
+    for (; bank < CANBUS_FILTER_BANKS; bank++)
+    {
+        config.filterNumber = bank;
+        CAN_ConfigFilter(&config);
+    }
+
+    CRITICAL_ENTER();
+    memcpy(handlers, table, sizeof(handlers));
+    CRITICAL_EXIT();
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Queue a frame for transmission.
+ *
+ * @param       frame:  Frame (id, dlc, data), copied
+ *
+ * @retval      SUCCESS, or ERROR when the transmit queue is full
+ *
+ * @note        May be called from any context. Frames go out in bus
+ *              priority order, frames with the same identifier in the order
+ *              they were queued.
+ */
+uint8_t CanBusSend(const CanBusFrame_T* frame)
+{
+    CanBusTxEntry_T entry;
+    uint8_t status = SUCCESS;
+
+    entry.frame = *frame;
+    entry.frame.dlc = (frame->dlc > 8U) ? 8U : frame->dlc;
+    entry.key = CanBusArbKey(frame->id);
+
+    CRITICAL_ENTER();
+    if (txCount + txAborting == CANBUS_TX_QUEUE)
+    {
+        canStats.txQueueFull++;
+        status = ERROR;
+    }
+    else
+    {
+        entry.seq = txSeq++;
+        CanBusHeapPush(&entry);
+        CanBusTxKick();
+    }
+    CRITICAL_EXIT();
+
+    return status;
+}
+
+/*!
+ * @brief       Frames not sent yet, queued or in a mailbox.
+ *
+ * @param       None
+ *
+ * @retval      Number of frames
+ */
+uint32_t CanBusTxPending(void)
+{
+    uint32_t pending, i;
+
+    CRITICAL_ENTER();
+    pending = txCount;
+    for (i = 0; i < CANBUS_MAILBOXES; i++)
+    {
+        pending += (txState[i] != CANBUS_MAILBOX_EMPTY) ? 1U : 0U;
+    }
+    CRITICAL_EXIT();
+
+    return pending;
+}
+
+/*!
+ * @brief       Take the oldest frame from a receive queue.
+ *
+ * @param       fifo:   0 or 1
+ *
+ * @param       frame:  Filled with the frame
+ *
+ * @retval      1 when a frame was read, 0 when the queue is empty
+ *
+ * @note        Single consumer: use either this or CanBusPoll() for a FIFO.
+ */
+uint8_t CanBusReceive(uint8_t fifo, CanBusFrame_T* frame)
+{
+    CanBusRxQueue_T* queue = &rxQueue[fifo & 1U];
+    uint32_t tail = queue->tail;
+
+    if (tail == queue->head)
+    {
+        return 0;
+    }
+
+    *frame = queue->frames[tail & (CANBUS_RX_QUEUE - 1U)];
+    queue->tail = tail + 1U;
+
+    return 1;
+}
+
+/*!
+ * @brief       Hand every queued frame to its handler, FIFO 0 first.
+ *
+ * @param       None
+ *
+ * @retval      Number of frames taken from the queues
+ *
+ * @note        Frames without a handler are dropped. Also re-arms the
+ *              error passive / bus-off counters after recovery.
+ */
+uint32_t CanBusPoll(void)
+{
+    CanBusFrame_T frame;
+    CanBusHandler_T handler;
+    uint32_t frames = 0;
+    uint8_t fifo;
+
+    for (fifo = 0; fifo < 2U; fifo++)
+    {
+        while (CanBusReceive(fifo, &frame))
+        {
+            handler = (frame.filter < CANBUS_MATCH_INDICES) ? handlers[fifo][frame.filter] : NULL;
+            if (handler != NULL)
+            {
+                handler(&frame);
+            }
+            frames++;
+        }
+    }
+
+    /* Leaving error passive or bus-off raises no interrupt: forget the
+     * cleared states so the next entry is counted again */
+    CRITICAL_ENTER();
+    errorState &= CAN1->ERRSTS;
+    CRITICAL_EXIT();
+
+    return frames;
+}
+
+/*!
+ * @brief       Read the CAN counters.
+ *
+ * @param       stats:  Filled with a snapshot
+ *
+ * @retval      None
+ */
+void CanBusStats(CanBusStats_T* stats)
+{
+    CRITICAL_ENTER();
+    *stats = canStats;
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       CAN1 TX interrupt: retire completed and aborted mailboxes,
+ *              then refill them from the queue.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void CanBusTxIRQHandler(void)
+{
+    uint32_t sts = CAN1->TXSTS;
+    uint32_t i;
+
+    for (i = 0; i < CANBUS_MAILBOXES; i++)
+    {
+        if ((sts & CANBUS_TXSTS_RQCP(i)) == 0)
+        {
+            continue;
+        }
+
+        /* Clears RQCP with TXOK and the error flags of this mailbox only */
+        CAN1->TXSTS = CANBUS_TXSTS_RQCP(i);
+
+        if ((sts & CANBUS_TXSTS_TXOK(i)) != 0)
+        {
+            canStats.txFrames++;
+        }
+        else if (txState[i] == CANBUS_MAILBOX_ABORTING)
+        {
+            /* Keeps its sequence number, so it goes out before later frames with its ID */
+            CanBusHeapPush(&txMailbox[i]);
+            canStats.txPreempted++;
+        }
+        else
+        {
+            canStats.txErrors++;
+        }
+        if (txState[i] == CANBUS_MAILBOX_ABORTING)
+        {
+            txAborting = 0;
+        }
+        txState[i] = CANBUS_MAILBOX_EMPTY;
+    }
+
+    CanBusTxKick();
+}
+
+/*!
+ * @brief       Move every message of a hardware FIFO into its queue.
+ *
+ * @param       fifo:  0 or 1
+ *
+ * @retval      None
+ *
+ * @note        Reads each mailbox as four words. A full queue drops the
+ *              message but still releases it, so the hardware FIFO keeps
+ *              accepting frames.
+ */
+static void CanBusRxDrain(uint32_t fifo)
+{
+    volatile uint32_t* rxf = (fifo == 0) ? &CAN1->RXF0 : &CAN1->RXF1;
+    CanBusRxQueue_T* queue = &rxQueue[fifo];
+    CanBusFrame_T* frame;
+    uint32_t head, mid, dlen, low, high, waiting;
+    uint32_t status;
+
+    while (((status = *rxf) & CANBUS_RXF_FMNUM) != 0)
+    {
+        head = queue->head;
+        waiting = head - queue->tail;
+        if (waiting == CANBUS_RX_QUEUE)
+        {
+            canStats.rxQueueOverrun++;
+        }
+        else
+        {
+            mid = CAN1->sRxMailBox[fifo].RXMID;
+            dlen = CAN1->sRxMailBox[fifo].RXDLEN;
+            low = CAN1->sRxMailBox[fifo].RXMDL;
+            high = CAN1->sRxMailBox[fifo].RXMDH;
+
+            frame = &queue->frames[head & (CANBUS_RX_QUEUE - 1U)];
+            if ((mid & CANBUS_MID_IDE) != 0)
+            {
+                frame->id = (mid >> CANBUS_MID_EXT_POS) | CANBUS_ID_EXT;
+            }
+            else
+            {
+                frame->id = mid >> CANBUS_MID_STD_POS;
+            }
+            if ((mid & CANBUS_MID_RTR) != 0)
+            {
+                frame->id |= CANBUS_ID_RTR;
+            }
+            frame->dlc = (uint8_t)(dlen & 0x0FU);
+            frame->filter = (uint8_t)(dlen >> 8);
+            frame->fifo = (uint8_t)fifo;
+            memcpy(&frame->data[0], &low, 4);
+            memcpy(&frame->data[4], &high, 4);
+
+            queue->head = head + 1U;
+            canStats.rxFrames++;
+            if (waiting + 1U > canStats.rxQueueHigh)
+            {
+                canStats.rxQueueHigh = waiting + 1U;
+            }
+        }
+
+        /* Direct write: FULL and FOVR are write-1-to-clear */
+        *rxf = CANBUS_RXF_RFOM;
+    }
+
+    if ((status & CANBUS_RXF_FOVR) != 0)
+    {
+        *rxf = CANBUS_RXF_FOVR;
+        canStats.rxFifoOverrun++;
+    }
+}
+
+/*!
+ * @brief       CAN1 FIFO 0 interrupt.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void CanBusRx0IRQHandler(void)
+{
+    CanBusRxDrain(0);
+}
+
+/*!
+ * @brief       CAN1 FIFO 1 interrupt.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void CanBusRx1IRQHandler(void)
+{
+    CanBusRxDrain(1);
+}
+
+/*!
+ * @brief       CAN1 status change interrupt: count error passive and
+ *              bus-off entries.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Bus-off recovers on its own (automatic bus-off management);
+ *              the mailboxes keep their frames meanwhile.
+ */
+void CanBusSceIRQHandler(void)
+{
+    uint32_t errors = CAN1->ERRSTS & (CANBUS_ERRSTS_ERRP | CANBUS_ERRSTS_BOF);
+
+    CAN1->MSTS = CANBUS_MSTS_ERRI;
+
+    if ((errors & ~errorState & CANBUS_ERRSTS_ERRP) != 0)
+    {
+        canStats.errorPassive++;
+    }
+    if ((errors & ~errorState & CANBUS_ERRSTS_BOF) != 0)
+    {
+        canStats.busOff++;
+    }
+    errorState = errors;
+}
+
+#endif // CANBUS_ENABLE
@@ -0,0 +1,130 @@
+#ifndef CAN_BUS_H
+#define CAN_BUS_H
+
+#include <stdint.h>
+#include "apm32f4xx_can.h"
+
+/*
+ * Interrupt-driven CAN1 on top of the StdPeriph CAN driver.
+ *
+ * The FIFO 0/1 interrupts drain every pending hardware message into a
+ * lock-free single-producer/single-consumer queue per FIFO, so at most one
+ * interrupt is taken per burst and the three-deep hardware FIFOs never have
+ * to wait for the application. Transmit frames wait in a priority queue
+ * ordered like bus arbitration and are loaded into all three mailboxes; a
+ * queued frame that outranks the lowest-priority mailbox has that mailbox
+ * aborted and re-queued, so low-priority frames cannot hold up urgent ones
+ * (priority inversion). Frames with the same identifier leave in order.
+ *
+ * CanBusSetFilters() packs a list of identifiers and masks into filter
+ * banks (exact standard IDs four per bank, exact extended IDs and standard
+ * masks two, extended masks one). The filter match index the hardware
+ * stores with each message selects the handler, so dispatch is one table
+ * lookup however many IDs are filtered.
+ *
+ * Enable with CANBUS_ENABLE (the CAN1 interrupt handlers in apm32f4xx_int.c
+ * are only built then). Configure the CAN1 pins, then call CanBusInit(),
+ * CanBusSetFilters(), and CanBusPoll() from the main loop.
+ */
+
+#ifndef CANBUS_ENABLE
+#define CANBUS_ENABLE 0
+#endif
+
+/* Frames per receive queue (one per FIFO), a power of two */
+#ifndef CANBUS_RX_QUEUE
+#define CANBUS_RX_QUEUE 64
+#endif
+
+/* Frames waiting for a transmit mailbox */
+#ifndef CANBUS_TX_QUEUE
+#define CANBUS_TX_QUEUE 32
+#endif
+
+/* Filter banks owned by CAN1 (CAN2 starts at this bank) */
+#ifndef CANBUS_FILTER_BANKS
+#define CANBUS_FILTER_BANKS 14
+#endif
+
+/* Preemption priority of the CAN1 interrupts */
+#ifndef CANBUS_IRQ_PRIORITY
+#define CANBUS_IRQ_PRIORITY 1
+#endif
+
+/* Identifier flags in CanBusFrame_T.id and CanBusFilter_T.id */
+#define CANBUS_ID_EXT       0x80000000U     /*!< 29-bit identifier */
+#define CANBUS_ID_RTR       0x40000000U     /*!< Remote frame */
+#define CANBUS_ID_MASK      0x1FFFFFFFU
+
+/* CanBusFilter_T.mask matching a single identifier */
+#define CANBUS_MASK_EXACT   CANBUS_ID_MASK
+
+/**
+ * @brief CAN frame, 16 bytes
+ */
+typedef struct
+{
+    uint32_t id;            /*!< 11- or 29-bit identifier with CANBUS_ID_* flags */
+    uint8_t  dlc;           /*!< Data length code, 0..8 */
+    uint8_t  filter;        /*!< Receive: filter match index */
+    uint8_t  fifo;          /*!< Receive: FIFO the frame arrived in */
+    uint8_t  reserved;
+    uint8_t  data[8];       /*!< Payload */
+} CanBusFrame_T;
+
+/* Called from CanBusPoll() for each received frame */
+typedef void (*CanBusHandler_T)(const CanBusFrame_T* frame);
+
+/**
+ * @brief Acceptance filter entry
+ *
+ * RTR and standard/extended are always compared: a data frame filter does
+ * not accept remote frames. A frame matching several entries goes to the
+ * one the hardware prefers (exact before masked, then list order).
+ */
+typedef struct
+{
+    uint32_t        id;         /*!< Identifier with CANBUS_ID_EXT / CANBUS_ID_RTR */
+    uint32_t        mask;       /*!< Identifier bits compared, CANBUS_MASK_EXACT for one ID */
+    CanBusHandler_T handler;    /*!< Handler for matching frames (NULL: CanBusReceive() only) */
+    uint8_t         fifo;       /*!< Receive FIFO 0 or 1; FIFO 0 is dispatched first */
+} CanBusFilter_T;
+
+/**
+ * @brief CAN counters
+ */
+typedef struct
+{
+    uint32_t rxFrames;          /*!< Frames queued */
+    uint32_t rxQueueOverrun;    /*!< Frames dropped, receive queue full */
+    uint32_t rxFifoOverrun;     /*!< Frames lost in a full hardware FIFO */
+    uint32_t rxQueueHigh;       /*!< Most frames waiting in one receive queue */
+    uint32_t txFrames;          /*!< Frames sent */
+    uint32_t txErrors;          /*!< Mailboxes completed without TXOK other than preemption */
+    uint32_t txPreempted;       /*!< Mailboxes aborted for a higher-priority frame */
+    uint32_t txQueueFull;       /*!< CanBusSend() calls refused */
+    uint32_t txQueueHigh;       /*!< Most frames waiting for a mailbox */
+    uint32_t errorPassive;      /*!< Entries into error passive */
+    uint32_t busOff;            /*!< Entries into bus-off */
+} CanBusStats_T;
+
+uint8_t CanBusInit(uint32_t bitrate, CAN_MODE_T mode);
+uint8_t CanBusSetFilters(const CanBusFilter_T* filters, uint32_t count);
+
+/* Transmit */
+uint8_t CanBusSend(const CanBusFrame_T* frame);
+uint32_t CanBusTxPending(void);
+
+/* Receive */
+uint8_t CanBusReceive(uint8_t fifo, CanBusFrame_T* frame);
+uint32_t CanBusPoll(void);
+
+void CanBusStats(CanBusStats_T* stats);
+
+/* CAN1 interrupt handlers */
+void CanBusTxIRQHandler(void);
+void CanBusRx0IRQHandler(void);
+void CanBusRx1IRQHandler(void);
+void CanBusSceIRQHandler(void);
+
+#endif // CAN_BUS_H
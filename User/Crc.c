@@ -0,0 +1,396 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_crc.h"
+#include "apm32f4xx_rcm.h"
+#include "Crc.h"
+#include "Dma.h"
+
+/* Most words one DMA pass moves (NDATA is 16 bits) */
+#define CRC_DMA_CHUNK   0xFFFFU
+
+/* CRC unit transfer in progress */
+static struct
+{
+    const uint8_t*      data;       /*!< Whole buffer, for the tail and the software fallback */
+    uint32_t            length;
+    const uint8_t*      next;       /*!< Next word for the DMA */
+    uint32_t            words;      /*!< Words still to go after the running pass */
+    DmaStream_T*        stream;     /*!< Claimed for this buffer, NULL: CPU writes */
+    DmaTransfer_T       transfer;
+    uint8_t             busy;
+    volatile uint8_t    dma;        /*!< DMA passes running */
+    volatile uint8_t    failed;     /*!< DMA error: result computed in software */
+} crcHw;
+
+static inline uint32_t CrcLoadLe(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return word;
+}
+
+static inline uint32_t CrcLoadBe(const uint8_t* p)
+{
+    return __builtin_bswap32(CrcLoadLe(p));
+}
+
+/*!
+ * @brief       Reflected CRC, register in the low bits.
+ *
+ * @param       t:       Table rows, at least slices of them
+ *
+ * @param       slices:  Bytes per step: 8, 4 or 1
+ *
+ * @param       crc:     Register
+ *
+ * @param       p:       Data, any alignment
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      Register after the data
+ */
+static uint32_t CrcReflected(const uint32_t (*t)[256], uint8_t slices, uint32_t crc,
+                             const uint8_t* p, uint32_t length)
+{
+    uint32_t high;
+
+    if (slices >= 8)
+    {
+        for (; length >= 8U; length -= 8U, p += 8)
+        {
+            crc ^= CrcLoadLe(p);
+            high = CrcLoadLe(p + 4);
+            crc = t[7][crc & 0xFFU] ^ t[6][(crc >> 8) & 0xFFU] ^
+                  t[5][(crc >> 16) & 0xFFU] ^ t[4][crc >> 24] ^
+                  t[3][high & 0xFFU] ^ t[2][(high >> 8) & 0xFFU] ^
+                  t[1][(high >> 16) & 0xFFU] ^ t[0][high >> 24];
+        }
+    }
+    if (slices >= 4)
+    {
+        for (; length >= 4U; length -= 4U, p += 4)
+        {
+            crc ^= CrcLoadLe(p);
+            crc = t[3][crc & 0xFFU] ^ t[2][(crc >> 8) & 0xFFU] ^
+                  t[1][(crc >> 16) & 0xFFU] ^ t[0][crc >> 24];
+        }
+    }
+    while (length-- != 0)
+    {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFFU];
+    }
+
+    return crc;
+}
+
+/*!
+ * @brief       MSB-first CRC, register in the top bits.
+ *
+ * @param       t:       Table rows, at least slices of them
+ *
+ * @param       slices:  Bytes per step: 8, 4 or 1
+ *
+ * @param       words:   Nonzero for CRC unit word order: each little-endian
+ *                       word MSB first, trailing bytes in memory order
+ *
+ * @param       crc:     Register
+ *
+ * @param       p:       Data, any alignment
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      Register after the data
+ */
+static uint32_t CrcNormal(const uint32_t (*t)[256], uint8_t slices, uint8_t words, uint32_t crc,
+                          const uint8_t* p, uint32_t length)
+{
+    uint32_t high, word;
+
+    if (slices >= 8)
+    {
+        for (; length >= 8U; length -= 8U, p += 8)
+        {
+            crc ^= words ? CrcLoadLe(p) : CrcLoadBe(p);
+            high = words ? CrcLoadLe(p + 4) : CrcLoadBe(p + 4);
+            crc = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xFFU] ^
+                  t[5][(crc >> 8) & 0xFFU] ^ t[4][crc & 0xFFU] ^
+                  t[3][high >> 24] ^ t[2][(high >> 16) & 0xFFU] ^
+                  t[1][(high >> 8) & 0xFFU] ^ t[0][high & 0xFFU];
+        }
+    }
+    if (slices >= 4)
+    {
+        for (; length >= 4U; length -= 4U, p += 4)
+        {
+            crc ^= words ? CrcLoadLe(p) : CrcLoadBe(p);
+            crc = t[3][crc >> 24] ^ t[2][(crc >> 16) & 0xFFU] ^
+                  t[1][(crc >> 8) & 0xFFU] ^ t[0][crc & 0xFFU];
+        }
+    }
+    else if (words)
+    {
+        for (; length >= 4U; length -= 4U, p += 4)
+        {
+            word = CrcLoadLe(p);
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ (word >> 24)];
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ ((word >> 16) & 0xFFU)];
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ ((word >> 8) & 0xFFU)];
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ (word & 0xFFU)];
+        }
+    }
+    while (length-- != 0)
+    {
+        crc = (crc << 8) ^ t[0][(crc >> 24) ^ *p++];
+    }
+
+    return crc;
+}
+
+/*!
+ * @brief       Start a CRC.
+ *
+ * @param       model:   CRC parameters
+ *
+ * @retval      Register for CrcUpdate()
+ */
+uint32_t CrcStart(const CrcModel_T* model)
+{
+    if ((model->flags & CRC_REFLECT) != 0)
+    {
+        return model->init;
+    }
+
+    return model->init << (32U - model->width);
+}
+
+/*!
+ * @brief       Add data to a CRC.
+ *
+ * @param       model:   CRC parameters
+ *
+ * @param       crc:     Register from CrcStart() or the previous update
+ *
+ * @param       data:    Data, any alignment
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      Register after the data
+ *
+ * @note        With CRC_WORD_ORDER the words start at data, so a stream cut
+ *              into updates must be cut at multiples of 4 bytes.
+ */
+uint32_t CrcUpdate(const CrcModel_T* model, uint32_t crc, const void* data, uint32_t length)
+{
+    if ((model->flags & CRC_REFLECT) != 0)
+    {
+        return CrcReflected(model->table, model->slices, crc, data, length);
+    }
+
+    return CrcNormal(model->table, model->slices, (model->flags & CRC_WORD_ORDER) != 0,
+                     crc, data, length);
+}
+
+/*!
+ * @brief       Final CRC value.
+ *
+ * @param       model:   CRC parameters
+ *
+ * @param       crc:     Register after the last update
+ *
+ * @retval      CRC, width bits
+ */
+uint32_t CrcFinish(const CrcModel_T* model, uint32_t crc)
+{
+    if ((model->flags & CRC_REFLECT) == 0)
+    {
+        crc >>= 32U - model->width;
+    }
+
+    return crc ^ model->xorOut;
+}
+
+/*!
+ * @brief       CRC of a buffer.
+ *
+ * @param       model:   CRC parameters
+ *
+ * @param       data:    Data, any alignment
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      CRC, width bits
+ */
+uint32_t CrcCompute(const CrcModel_T* model, const void* data, uint32_t length)
+{
+    return CrcFinish(model, CrcUpdate(model, CrcStart(model), data, length));
+}
+
+/* CRC unit ***************************************************************/
+
+/* Hand the next pass of up to 65535 words to the DMA */
+static void CrcHwKick(void)
+{
+    uint32_t chunk = (crcHw.words > CRC_DMA_CHUNK) ? CRC_DMA_CHUNK : crcHw.words;
+
+    crcHw.transfer.peripheral = (uint32_t)crcHw.next;
+    crcHw.transfer.count = (uint16_t)chunk;
+    crcHw.next += chunk * 4U;
+    crcHw.words -= chunk;
+
+    DmaSubmit(crcHw.stream, &crcHw.transfer);
+}
+
+/* DMA callback: chain the passes of a long buffer */
+static void CrcHwDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    (void)transfer;
+
+    if (event != DMA_EVENT_DONE)
+    {
+        crcHw.failed = 1;
+    }
+    else if (crcHw.words != 0)
+    {
+        CrcHwKick();
+        return;
+    }
+    crcHw.dma = 0;
+}
+
+/*!
+ * @brief       Start the CRC unit on a buffer.
+ *
+ * @param       data:    Data, any alignment; must stay unchanged until
+ *                       CrcHwPoll() returns SUCCESS
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      SUCCESS, or ERROR while a previous buffer is in progress
+ *
+ * @note        Word-aligned buffers of CRC_DMA_MIN words or more outside
+ *              CCM RAM are fed by a DMA2 stream claimed from the DMA
+ *              manager, in passes of up to 65535 words. The rest, and all
+ *              buffers while no memory-to-memory stream is free, are
+ *              written by the CPU here. The unit belongs to this module
+ *              until the result has been collected.
+ */
+uint8_t CrcHwStart(const void* data, uint32_t length)
+{
+    const uint8_t* p = data;
+    uint32_t words = length / 4U;
+
+    if (crcHw.busy)
+    {
+        return ERROR;
+    }
+
+    RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_CRC);
+    CRC_ResetDATA();
+
+    crcHw.data = p;
+    crcHw.length = length;
+    crcHw.failed = 0;
+    crcHw.busy = 1;
+    crcHw.stream = NULL;
+
+    if ((words >= CRC_DMA_MIN) && (((uint32_t)p & 3U) == 0) &&
+        (((uint32_t)p & 0xFFFF0000U) != CCMDATARAM_BASE))
+    {
+        crcHw.stream = DmaClaim(DMA_REQ_MEM2MEM, DMA_PRIORITY_LOW, CRC_DMA_IRQ_PRIORITY);
+    }
+
+    if (crcHw.stream == NULL)
+    {
+        for (; words != 0; words--, p += 4)
+        {
+            CRC->DATA = CrcLoadLe(p);
+        }
+        return SUCCESS;
+    }
+
+    /* The CRC unit raises no DMA requests: memory to memory, the data
+       register as the fixed destination */
+    crcHw.transfer.memory = (uint32_t)&CRC->DATA;
+    crcHw.transfer.size = 4;
+    crcHw.transfer.flags = DMA_XFER_MEM_FIXED;
+    crcHw.transfer.done = CrcHwDone;
+    crcHw.next = p;
+    crcHw.words = words;
+    crcHw.dma = 1;
+    CrcHwKick();
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Collect the result of CrcHwStart().
+ *
+ * @param       crc:     Receives the CRC-32/MPEG-2 of the buffer
+ *
+ * @retval      SUCCESS once *crc is valid, ERROR while the DMA is running
+ *              (or nothing was started)
+ *
+ * @note        The trailing 1-3 bytes are added in software, in memory
+ *              order. After a DMA error the whole buffer is computed in
+ *              software instead.
+ */
+uint8_t CrcHwPoll(uint32_t* crc)
+{
+    uint32_t value;
+
+    if (!crcHw.busy || crcHw.dma)
+    {
+        return ERROR;
+    }
+
+    if (crcHw.stream != NULL)
+    {
+        DmaRelease(crcHw.stream);
+        crcHw.stream = NULL;
+    }
+
+    if (crcHw.failed)
+    {
+        value = CrcUpdate(&crcMpeg2Words, CrcStart(&crcMpeg2Words), crcHw.data, crcHw.length);
+    }
+    else
+    {
+        value = CrcUpdate(&crcMpeg2Words, CRC->DATA, crcHw.data + (crcHw.length & ~3U), crcHw.length & 3U);
+    }
+
+    crcHw.busy = 0;
+    *crc = CrcFinish(&crcMpeg2Words, value);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       CRC-32/MPEG-2 of a buffer on the CRC unit, waiting for it.
+ *
+ * @param       data:    Data, any alignment
+ *
+ * @param       length:  Bytes
+ *
+ * @retval      Same value as CrcCompute(&crcMpeg2Words, data, length)
+ *
+ * @note        Falls back to software while the unit is busy with a
+ *              CrcHwStart() buffer. Needs interrupts enabled when the
+ *              buffer goes to the DMA.
+ */
+uint32_t CrcHwCompute(const void* data, uint32_t length)
+{
+    uint32_t crc;
+
+    if (CrcHwStart(data, length) != SUCCESS)
+    {
+        return CrcCompute(&crcMpeg2Words, data, length);
+    }
+
+    while (CrcHwPoll(&crc) != SUCCESS)
+    {
+    }
+
+    return crc;
+}
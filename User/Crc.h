@@ -0,0 +1,73 @@
+#ifndef CRC_H
+#define CRC_H
+
+#include <stdint.h>
+
+/*
+ * CRCs of any width from 8 to 32 bits and any polynomial, in software,
+ * plus the CRC unit fed by DMA for CRC-32/MPEG-2.
+ *
+ * A CrcModel_T describes one CRC and points at its lookup tables. The
+ * tables are generated on the host by Tools/crcgen (target crc_tables) into
+ * CrcTables.c, which also defines the presets below; unused presets and
+ * their tables are dropped by the linker. The engine consumes 8, 4 or 1
+ * bytes per step (slicing-by-8/4 or the classic byte table), as chosen by
+ * the model, and finishes any length byte by byte.
+ *
+ * CRC_CalculateBlockCRC() and the CRC unit only take whole 32-bit words,
+ * each fed MSB first; crcMpeg2Words reproduces that byte order in software
+ * and CrcHwCompute() extends it to any length: whole words go through the
+ * unit, the last 1-3 bytes are finished in software in memory order. The
+ * unit has no DMA request of its own, so a DMA2 stream claimed from the
+ * DMA manager (Dma.h) runs a memory-to-memory transfer into its data
+ * register while the CPU is free.
+ */
+
+/* NVIC priority of the DMA stream feeding the CRC unit */
+#ifndef CRC_DMA_IRQ_PRIORITY
+#define CRC_DMA_IRQ_PRIORITY 15
+#endif
+
+/* Fewer words than this are written by the CPU, below the DMA setup cost */
+#ifndef CRC_DMA_MIN
+#define CRC_DMA_MIN         16U
+#endif
+
+/* Model flags */
+#define CRC_REFLECT         0x01U   /*!< Bytes LSB first, result reflected */
+#define CRC_WORD_ORDER      0x02U   /*!< Each little-endian word MSB first, as the CRC unit */
+
+/**
+ * @brief CRC parameters (Rocksoft model, input and output reflected alike)
+ */
+typedef struct
+{
+    const uint32_t  (*table)[256];  /*!< slices rows, generated by Tools/crcgen */
+    uint32_t        poly;           /*!< Normal form */
+    uint32_t        init;
+    uint32_t        xorOut;
+    uint8_t         width;          /*!< 8..32 bits */
+    uint8_t         flags;          /*!< CRC_REFLECT, CRC_WORD_ORDER */
+    uint8_t         slices;         /*!< Bytes per step: 8, 4 or 1 */
+} CrcModel_T;
+
+/* Presets (CrcTables.c); check value of "123456789" in brackets */
+extern const CrcModel_T crcCrc32;       /*!< Ethernet, zlib, PNG [CBF43926] */
+extern const CrcModel_T crcCrc32c;      /*!< Castagnoli, iSCSI, ext4 [E3069283] */
+extern const CrcModel_T crcMpeg2;       /*!< CRC-32/MPEG-2 of a byte stream [0376E6E7] */
+extern const CrcModel_T crcMpeg2Words;  /*!< CRC-32/MPEG-2 in CRC unit word order */
+extern const CrcModel_T crcCcittFalse;  /*!< CRC-16/CCITT-FALSE [29B1] */
+extern const CrcModel_T crcModbus;      /*!< CRC-16/MODBUS [4B37] */
+
+/* Incremental: crc = CrcStart(); crc = CrcUpdate(..., crc, ...); CrcFinish(crc) */
+uint32_t CrcStart(const CrcModel_T* model);
+uint32_t CrcUpdate(const CrcModel_T* model, uint32_t crc, const void* data, uint32_t length);
+uint32_t CrcFinish(const CrcModel_T* model, uint32_t crc);
+uint32_t CrcCompute(const CrcModel_T* model, const void* data, uint32_t length);
+
+/* CRC unit, same result as CrcCompute(&crcMpeg2Words, ...) */
+uint8_t CrcHwStart(const void* data, uint32_t length);
+uint8_t CrcHwPoll(uint32_t* crc);
+uint32_t CrcHwCompute(const void* data, uint32_t length);
+
+#endif // CRC_H
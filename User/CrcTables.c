@@ -0,0 +1,1188 @@
+/*!
+ * @file        CrcTables.c
+ *
+ * @brief       CRC presets and their slicing tables. Generated by
+ *              Tools/crcgen, do not edit; regenerate with the
+ *              crc_tables target of the host build.
+ */
+
+#include "Crc.h"
+
+/* Width 32, polynomial 0x04C11DB7, reflected */
+static const uint32_t crcTableCrc32[8][256] =
+{
+    {
+        0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
+        0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U, 0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
+        0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+        0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
+        0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U, 0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
+        0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+        0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
+        0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U, 0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
+        0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+        0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
+        0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU, 0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
+        0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+        0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
+        0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U, 0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
+        0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+        0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
+        0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU, 0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
+        0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+        0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
+        0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU, 0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
+        0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+        0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
+        0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U, 0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
+        0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+        0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
+        0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U, 0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
+        0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+        0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
+        0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U, 0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
+        0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+        0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
+        0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U, 0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+    },
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U, 0x646CC504U, 0x7D77F445U, 0x565AA786U, 0x4F4196C7U,
+        0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU, 0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU,
+        0x4AC21251U, 0x53D92310U, 0x78F470D3U, 0x61EF4192U, 0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU, 0xE6775D5DU, 0xFF6C6C1CU, 0xD4413FDFU, 0xCD5A0E9EU,
+        0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U, 0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U,
+        0x5D5DAEAAU, 0x44469FEBU, 0x6F6BCC28U, 0x7670FD69U, 0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U, 0xBB2AF3F7U, 0xA231C2B6U, 0x891C9175U, 0x9007A034U,
+        0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U, 0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU,
+        0xF0794F05U, 0xE9627E44U, 0xC24F2D87U, 0xDB541CC6U, 0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU, 0x5CCC0009U, 0x45D73148U, 0x6EFA628BU, 0x77E153CAU,
+        0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U, 0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U,
+        0x7262D75CU, 0x6B79E61DU, 0x4054B5DEU, 0x594F849FU, 0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U, 0x0191AEA3U, 0x188A9FE2U, 0x33A7CC21U, 0x2ABCFD60U,
+        0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU, 0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U,
+        0x2F3F79F6U, 0x362448B7U, 0x1D091B74U, 0x04122A35U, 0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU, 0x838A36FAU, 0x9A9107BBU, 0xB1BC5478U, 0xA8A76539U,
+        0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U, 0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU,
+        0xF35A1243U, 0xEA412302U, 0xC16C70C1U, 0xD8774180U, 0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U, 0x152D4F1EU, 0x0C367E5FU, 0x271B2D9CU, 0x3E001CDDU,
+        0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U, 0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U,
+        0xAE07BCE9U, 0xB71C8DA8U, 0x9C31DE6BU, 0x852AEF2AU, 0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U, 0x02B2F3E5U, 0x1BA9C2A4U, 0x30849167U, 0x299FA026U,
+        0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU, 0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU,
+        0x2C1C24B0U, 0x350715F1U, 0x1E2A4632U, 0x07317773U, 0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU, 0xAF96124AU, 0xB68D230BU, 0x9DA070C8U, 0x84BB4189U,
+        0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U, 0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U,
+        0x8138C51FU, 0x9823F45EU, 0xB30EA79DU, 0xAA1596DCU, 0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U, 0x2D8D8A13U, 0x3496BB52U, 0x1FBBE891U, 0x06A0D9D0U,
+        0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU, 0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU,
+        0x96A779E4U, 0x8FBC48A5U, 0xA4911B66U, 0xBD8A2A27U, 0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU, 0x70D024B9U, 0x69CB15F8U, 0x42E6463BU, 0x5BFD777AU,
+        0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U, 0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U
+    },
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U, 0x0709A8DCU, 0x06CBC2EBU, 0x048D7CB2U, 0x054F1685U,
+        0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U, 0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU,
+        0x1C26A370U, 0x1DE4C947U, 0x1FA2771EU, 0x1E601D29U, 0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U, 0x153C5A14U, 0x14FE3023U, 0x16B88E7AU, 0x177AE44DU,
+        0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U, 0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U,
+        0x365E1758U, 0x379C7D6FU, 0x35DAC336U, 0x3418A901U, 0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U, 0x23624D4CU, 0x22A0277BU, 0x20E69922U, 0x2124F315U,
+        0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U, 0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU,
+        0x709A8DC0U, 0x7158E7F7U, 0x731E59AEU, 0x72DC3399U, 0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U, 0x798074A4U, 0x78421E93U, 0x7A04A0CAU, 0x7BC6CAFDU,
+        0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U, 0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U,
+        0x62AF7F08U, 0x636D153FU, 0x612BAB66U, 0x60E9C151U, 0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U, 0x4FDE63FCU, 0x4E1C09CBU, 0x4C5AB792U, 0x4D98DDA5U,
+        0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U, 0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU,
+        0x54F16850U, 0x55330267U, 0x5775BC3EU, 0x56B7D609U, 0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U, 0x5DEB9134U, 0x5C29FB03U, 0x5E6F455AU, 0x5FAD2F6DU,
+        0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U, 0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U,
+        0xEF264A38U, 0xEEE4200FU, 0xECA29E56U, 0xED60F461U, 0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U, 0xFA1A102CU, 0xFBD87A1BU, 0xF99EC442U, 0xF85CAE75U,
+        0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U, 0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU,
+        0xD9785D60U, 0xD8BA3757U, 0xDAFC890EU, 0xDB3EE339U, 0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U, 0xD062A404U, 0xD1A0CE33U, 0xD3E6706AU, 0xD2241A5DU,
+        0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U, 0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U,
+        0xCB4DAFA8U, 0xCA8FC59FU, 0xC8C97BC6U, 0xC90B11F1U, 0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U, 0x96A63E9CU, 0x976454ABU, 0x9522EAF2U, 0x94E080C5U,
+        0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U, 0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU,
+        0x8D893530U, 0x8C4B5F07U, 0x8E0DE15EU, 0x8FCF8B69U, 0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U, 0x8493CC54U, 0x8551A663U, 0x8717183AU, 0x86D5720DU,
+        0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U, 0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U,
+        0xA7F18118U, 0xA633EB2FU, 0xA4755576U, 0xA5B73F41U, 0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U, 0xB2CDDB0CU, 0xB30FB13BU, 0xB1490F62U, 0xB08B6555U,
+        0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U, 0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU
+    },
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU, 0x8F629757U, 0x37DEF032U, 0x256B5FDCU, 0x9DD738B9U,
+        0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U, 0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U,
+        0x5019579FU, 0xE8A530FAU, 0xFA109F14U, 0x42ACF871U, 0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU, 0x1ACFE827U, 0xA2738F42U, 0xB0C620ACU, 0x087A47C9U,
+        0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U, 0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U,
+        0x658687D1U, 0xDD3AE0B4U, 0xCF8F4F5AU, 0x7733283FU, 0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU, 0x7F496FF6U, 0xC7F50893U, 0xD540A77DU, 0x6DFCC018U,
+        0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U, 0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U,
+        0x9B14583DU, 0x23A83F58U, 0x311D90B6U, 0x89A1F7D3U, 0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU, 0xD1C2E785U, 0x697E80E0U, 0x7BCB2F0EU, 0xC377486BU,
+        0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU, 0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU,
+        0x0EB9274DU, 0xB6054028U, 0xA4B0EFC6U, 0x1C0C88A3U, 0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU, 0xB4446054U, 0x0CF80731U, 0x1E4DA8DFU, 0xA6F1CFBAU,
+        0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U, 0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U,
+        0x6B3FA09CU, 0xD383C7F9U, 0xC1366817U, 0x798A0F72U, 0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU, 0x21E91F24U, 0x99557841U, 0x8BE0D7AFU, 0x335CB0CAU,
+        0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U, 0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U,
+        0x28ED9ED4U, 0x9051F9B1U, 0x82E4565FU, 0x3A58313AU, 0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU, 0x322276F3U, 0x8A9E1196U, 0x982BBE78U, 0x2097D91DU,
+        0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U, 0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U,
+        0x4D6B1905U, 0xF5D77E60U, 0xE762D18EU, 0x5FDEB6EBU, 0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U, 0x07BDA6BDU, 0xBF01C1D8U, 0xADB46E36U, 0x15080953U,
+        0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U, 0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U,
+        0xD8C66675U, 0x607A0110U, 0x72CFAEFEU, 0xCA73C99BU, 0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U, 0xF92F7951U, 0x41931E34U, 0x5326B1DAU, 0xEB9AD6BFU,
+        0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U, 0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U,
+        0x2654B999U, 0x9EE8DEFCU, 0x8C5D7112U, 0x34E11677U, 0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U, 0x6C820621U, 0xD43E6144U, 0xC68BCEAAU, 0x7E37A9CFU,
+        0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U, 0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U,
+        0x13CB69D7U, 0xAB770EB2U, 0xB9C2A15CU, 0x017EC639U, 0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U, 0x090481F0U, 0xB1B8E695U, 0xA30D497BU, 0x1BB12E1EU,
+        0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U, 0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U
+    },
+    {
+        0x00000000U, 0x3D6029B0U, 0x7AC05360U, 0x47A07AD0U, 0xF580A6C0U, 0xC8E08F70U, 0x8F40F5A0U, 0xB220DC10U,
+        0x30704BC1U, 0x0D106271U, 0x4AB018A1U, 0x77D03111U, 0xC5F0ED01U, 0xF890C4B1U, 0xBF30BE61U, 0x825097D1U,
+        0x60E09782U, 0x5D80BE32U, 0x1A20C4E2U, 0x2740ED52U, 0x95603142U, 0xA80018F2U, 0xEFA06222U, 0xD2C04B92U,
+        0x5090DC43U, 0x6DF0F5F3U, 0x2A508F23U, 0x1730A693U, 0xA5107A83U, 0x98705333U, 0xDFD029E3U, 0xE2B00053U,
+        0xC1C12F04U, 0xFCA106B4U, 0xBB017C64U, 0x866155D4U, 0x344189C4U, 0x0921A074U, 0x4E81DAA4U, 0x73E1F314U,
+        0xF1B164C5U, 0xCCD14D75U, 0x8B7137A5U, 0xB6111E15U, 0x0431C205U, 0x3951EBB5U, 0x7EF19165U, 0x4391B8D5U,
+        0xA121B886U, 0x9C419136U, 0xDBE1EBE6U, 0xE681C256U, 0x54A11E46U, 0x69C137F6U, 0x2E614D26U, 0x13016496U,
+        0x9151F347U, 0xAC31DAF7U, 0xEB91A027U, 0xD6F18997U, 0x64D15587U, 0x59B17C37U, 0x1E1106E7U, 0x23712F57U,
+        0x58F35849U, 0x659371F9U, 0x22330B29U, 0x1F532299U, 0xAD73FE89U, 0x9013D739U, 0xD7B3ADE9U, 0xEAD38459U,
+        0x68831388U, 0x55E33A38U, 0x124340E8U, 0x2F236958U, 0x9D03B548U, 0xA0639CF8U, 0xE7C3E628U, 0xDAA3CF98U,
+        0x3813CFCBU, 0x0573E67BU, 0x42D39CABU, 0x7FB3B51BU, 0xCD93690BU, 0xF0F340BBU, 0xB7533A6BU, 0x8A3313DBU,
+        0x0863840AU, 0x3503ADBAU, 0x72A3D76AU, 0x4FC3FEDAU, 0xFDE322CAU, 0xC0830B7AU, 0x872371AAU, 0xBA43581AU,
+        0x9932774DU, 0xA4525EFDU, 0xE3F2242DU, 0xDE920D9DU, 0x6CB2D18DU, 0x51D2F83DU, 0x167282EDU, 0x2B12AB5DU,
+        0xA9423C8CU, 0x9422153CU, 0xD3826FECU, 0xEEE2465CU, 0x5CC29A4CU, 0x61A2B3FCU, 0x2602C92CU, 0x1B62E09CU,
+        0xF9D2E0CFU, 0xC4B2C97FU, 0x8312B3AFU, 0xBE729A1FU, 0x0C52460FU, 0x31326FBFU, 0x7692156FU, 0x4BF23CDFU,
+        0xC9A2AB0EU, 0xF4C282BEU, 0xB362F86EU, 0x8E02D1DEU, 0x3C220DCEU, 0x0142247EU, 0x46E25EAEU, 0x7B82771EU,
+        0xB1E6B092U, 0x8C869922U, 0xCB26E3F2U, 0xF646CA42U, 0x44661652U, 0x79063FE2U, 0x3EA64532U, 0x03C66C82U,
+        0x8196FB53U, 0xBCF6D2E3U, 0xFB56A833U, 0xC6368183U, 0x74165D93U, 0x49767423U, 0x0ED60EF3U, 0x33B62743U,
+        0xD1062710U, 0xEC660EA0U, 0xABC67470U, 0x96A65DC0U, 0x248681D0U, 0x19E6A860U, 0x5E46D2B0U, 0x6326FB00U,
+        0xE1766CD1U, 0xDC164561U, 0x9BB63FB1U, 0xA6D61601U, 0x14F6CA11U, 0x2996E3A1U, 0x6E369971U, 0x5356B0C1U,
+        0x70279F96U, 0x4D47B626U, 0x0AE7CCF6U, 0x3787E546U, 0x85A73956U, 0xB8C710E6U, 0xFF676A36U, 0xC2074386U,
+        0x4057D457U, 0x7D37FDE7U, 0x3A978737U, 0x07F7AE87U, 0xB5D77297U, 0x88B75B27U, 0xCF1721F7U, 0xF2770847U,
+        0x10C70814U, 0x2DA721A4U, 0x6A075B74U, 0x576772C4U, 0xE547AED4U, 0xD8278764U, 0x9F87FDB4U, 0xA2E7D404U,
+        0x20B743D5U, 0x1DD76A65U, 0x5A7710B5U, 0x67173905U, 0xD537E515U, 0xE857CCA5U, 0xAFF7B675U, 0x92979FC5U,
+        0xE915E8DBU, 0xD475C16BU, 0x93D5BBBBU, 0xAEB5920BU, 0x1C954E1BU, 0x21F567ABU, 0x66551D7BU, 0x5B3534CBU,
+        0xD965A31AU, 0xE4058AAAU, 0xA3A5F07AU, 0x9EC5D9CAU, 0x2CE505DAU, 0x11852C6AU, 0x562556BAU, 0x6B457F0AU,
+        0x89F57F59U, 0xB49556E9U, 0xF3352C39U, 0xCE550589U, 0x7C75D999U, 0x4115F029U, 0x06B58AF9U, 0x3BD5A349U,
+        0xB9853498U, 0x84E51D28U, 0xC34567F8U, 0xFE254E48U, 0x4C059258U, 0x7165BBE8U, 0x36C5C138U, 0x0BA5E888U,
+        0x28D4C7DFU, 0x15B4EE6FU, 0x521494BFU, 0x6F74BD0FU, 0xDD54611FU, 0xE03448AFU, 0xA794327FU, 0x9AF41BCFU,
+        0x18A48C1EU, 0x25C4A5AEU, 0x6264DF7EU, 0x5F04F6CEU, 0xED242ADEU, 0xD044036EU, 0x97E479BEU, 0xAA84500EU,
+        0x4834505DU, 0x755479EDU, 0x32F4033DU, 0x0F942A8DU, 0xBDB4F69DU, 0x80D4DF2DU, 0xC774A5FDU, 0xFA148C4DU,
+        0x78441B9CU, 0x4524322CU, 0x028448FCU, 0x3FE4614CU, 0x8DC4BD5CU, 0xB0A494ECU, 0xF704EE3CU, 0xCA64C78CU
+    },
+    {
+        0x00000000U, 0xCB5CD3A5U, 0x4DC8A10BU, 0x869472AEU, 0x9B914216U, 0x50CD91B3U, 0xD659E31DU, 0x1D0530B8U,
+        0xEC53826DU, 0x270F51C8U, 0xA19B2366U, 0x6AC7F0C3U, 0x77C2C07BU, 0xBC9E13DEU, 0x3A0A6170U, 0xF156B2D5U,
+        0x03D6029BU, 0xC88AD13EU, 0x4E1EA390U, 0x85427035U, 0x9847408DU, 0x531B9328U, 0xD58FE186U, 0x1ED33223U,
+        0xEF8580F6U, 0x24D95353U, 0xA24D21FDU, 0x6911F258U, 0x7414C2E0U, 0xBF481145U, 0x39DC63EBU, 0xF280B04EU,
+        0x07AC0536U, 0xCCF0D693U, 0x4A64A43DU, 0x81387798U, 0x9C3D4720U, 0x57619485U, 0xD1F5E62BU, 0x1AA9358EU,
+        0xEBFF875BU, 0x20A354FEU, 0xA6372650U, 0x6D6BF5F5U, 0x706EC54DU, 0xBB3216E8U, 0x3DA66446U, 0xF6FAB7E3U,
+        0x047A07ADU, 0xCF26D408U, 0x49B2A6A6U, 0x82EE7503U, 0x9FEB45BBU, 0x54B7961EU, 0xD223E4B0U, 0x197F3715U,
+        0xE82985C0U, 0x23755665U, 0xA5E124CBU, 0x6EBDF76EU, 0x73B8C7D6U, 0xB8E41473U, 0x3E7066DDU, 0xF52CB578U,
+        0x0F580A6CU, 0xC404D9C9U, 0x4290AB67U, 0x89CC78C2U, 0x94C9487AU, 0x5F959BDFU, 0xD901E971U, 0x125D3AD4U,
+        0xE30B8801U, 0x28575BA4U, 0xAEC3290AU, 0x659FFAAFU, 0x789ACA17U, 0xB3C619B2U, 0x35526B1CU, 0xFE0EB8B9U,
+        0x0C8E08F7U, 0xC7D2DB52U, 0x4146A9FCU, 0x8A1A7A59U, 0x971F4AE1U, 0x5C439944U, 0xDAD7EBEAU, 0x118B384FU,
+        0xE0DD8A9AU, 0x2B81593FU, 0xAD152B91U, 0x6649F834U, 0x7B4CC88CU, 0xB0101B29U, 0x36846987U, 0xFDD8BA22U,
+        0x08F40F5AU, 0xC3A8DCFFU, 0x453CAE51U, 0x8E607DF4U, 0x93654D4CU, 0x58399EE9U, 0xDEADEC47U, 0x15F13FE2U,
+        0xE4A78D37U, 0x2FFB5E92U, 0xA96F2C3CU, 0x6233FF99U, 0x7F36CF21U, 0xB46A1C84U, 0x32FE6E2AU, 0xF9A2BD8FU,
+        0x0B220DC1U, 0xC07EDE64U, 0x46EAACCAU, 0x8DB67F6FU, 0x90B34FD7U, 0x5BEF9C72U, 0xDD7BEEDCU, 0x16273D79U,
+        0xE7718FACU, 0x2C2D5C09U, 0xAAB92EA7U, 0x61E5FD02U, 0x7CE0CDBAU, 0xB7BC1E1FU, 0x31286CB1U, 0xFA74BF14U,
+        0x1EB014D8U, 0xD5ECC77DU, 0x5378B5D3U, 0x98246676U, 0x852156CEU, 0x4E7D856BU, 0xC8E9F7C5U, 0x03B52460U,
+        0xF2E396B5U, 0x39BF4510U, 0xBF2B37BEU, 0x7477E41BU, 0x6972D4A3U, 0xA22E0706U, 0x24BA75A8U, 0xEFE6A60DU,
+        0x1D661643U, 0xD63AC5E6U, 0x50AEB748U, 0x9BF264EDU, 0x86F75455U, 0x4DAB87F0U, 0xCB3FF55EU, 0x006326FBU,
+        0xF135942EU, 0x3A69478BU, 0xBCFD3525U, 0x77A1E680U, 0x6AA4D638U, 0xA1F8059DU, 0x276C7733U, 0xEC30A496U,
+        0x191C11EEU, 0xD240C24BU, 0x54D4B0E5U, 0x9F886340U, 0x828D53F8U, 0x49D1805DU, 0xCF45F2F3U, 0x04192156U,
+        0xF54F9383U, 0x3E134026U, 0xB8873288U, 0x73DBE12DU, 0x6EDED195U, 0xA5820230U, 0x2316709EU, 0xE84AA33BU,
+        0x1ACA1375U, 0xD196C0D0U, 0x5702B27EU, 0x9C5E61DBU, 0x815B5163U, 0x4A0782C6U, 0xCC93F068U, 0x07CF23CDU,
+        0xF6999118U, 0x3DC542BDU, 0xBB513013U, 0x700DE3B6U, 0x6D08D30EU, 0xA65400ABU, 0x20C07205U, 0xEB9CA1A0U,
+        0x11E81EB4U, 0xDAB4CD11U, 0x5C20BFBFU, 0x977C6C1AU, 0x8A795CA2U, 0x41258F07U, 0xC7B1FDA9U, 0x0CED2E0CU,
+        0xFDBB9CD9U, 0x36E74F7CU, 0xB0733DD2U, 0x7B2FEE77U, 0x662ADECFU, 0xAD760D6AU, 0x2BE27FC4U, 0xE0BEAC61U,
+        0x123E1C2FU, 0xD962CF8AU, 0x5FF6BD24U, 0x94AA6E81U, 0x89AF5E39U, 0x42F38D9CU, 0xC467FF32U, 0x0F3B2C97U,
+        0xFE6D9E42U, 0x35314DE7U, 0xB3A53F49U, 0x78F9ECECU, 0x65FCDC54U, 0xAEA00FF1U, 0x28347D5FU, 0xE368AEFAU,
+        0x16441B82U, 0xDD18C827U, 0x5B8CBA89U, 0x90D0692CU, 0x8DD55994U, 0x46898A31U, 0xC01DF89FU, 0x0B412B3AU,
+        0xFA1799EFU, 0x314B4A4AU, 0xB7DF38E4U, 0x7C83EB41U, 0x6186DBF9U, 0xAADA085CU, 0x2C4E7AF2U, 0xE712A957U,
+        0x15921919U, 0xDECECABCU, 0x585AB812U, 0x93066BB7U, 0x8E035B0FU, 0x455F88AAU, 0xC3CBFA04U, 0x089729A1U,
+        0xF9C19B74U, 0x329D48D1U, 0xB4093A7FU, 0x7F55E9DAU, 0x6250D962U, 0xA90C0AC7U, 0x2F987869U, 0xE4C4ABCCU
+    },
+    {
+        0x00000000U, 0xA6770BB4U, 0x979F1129U, 0x31E81A9DU, 0xF44F2413U, 0x52382FA7U, 0x63D0353AU, 0xC5A73E8EU,
+        0x33EF4E67U, 0x959845D3U, 0xA4705F4EU, 0x020754FAU, 0xC7A06A74U, 0x61D761C0U, 0x503F7B5DU, 0xF64870E9U,
+        0x67DE9CCEU, 0xC1A9977AU, 0xF0418DE7U, 0x56368653U, 0x9391B8DDU, 0x35E6B369U, 0x040EA9F4U, 0xA279A240U,
+        0x5431D2A9U, 0xF246D91DU, 0xC3AEC380U, 0x65D9C834U, 0xA07EF6BAU, 0x0609FD0EU, 0x37E1E793U, 0x9196EC27U,
+        0xCFBD399CU, 0x69CA3228U, 0x582228B5U, 0xFE552301U, 0x3BF21D8FU, 0x9D85163BU, 0xAC6D0CA6U, 0x0A1A0712U,
+        0xFC5277FBU, 0x5A257C4FU, 0x6BCD66D2U, 0xCDBA6D66U, 0x081D53E8U, 0xAE6A585CU, 0x9F8242C1U, 0x39F54975U,
+        0xA863A552U, 0x0E14AEE6U, 0x3FFCB47BU, 0x998BBFCFU, 0x5C2C8141U, 0xFA5B8AF5U, 0xCBB39068U, 0x6DC49BDCU,
+        0x9B8CEB35U, 0x3DFBE081U, 0x0C13FA1CU, 0xAA64F1A8U, 0x6FC3CF26U, 0xC9B4C492U, 0xF85CDE0FU, 0x5E2BD5BBU,
+        0x440B7579U, 0xE27C7ECDU, 0xD3946450U, 0x75E36FE4U, 0xB044516AU, 0x16335ADEU, 0x27DB4043U, 0x81AC4BF7U,
+        0x77E43B1EU, 0xD19330AAU, 0xE07B2A37U, 0x460C2183U, 0x83AB1F0DU, 0x25DC14B9U, 0x14340E24U, 0xB2430590U,
+        0x23D5E9B7U, 0x85A2E203U, 0xB44AF89EU, 0x123DF32AU, 0xD79ACDA4U, 0x71EDC610U, 0x4005DC8DU, 0xE672D739U,
+        0x103AA7D0U, 0xB64DAC64U, 0x87A5B6F9U, 0x21D2BD4DU, 0xE47583C3U, 0x42028877U, 0x73EA92EAU, 0xD59D995EU,
+        0x8BB64CE5U, 0x2DC14751U, 0x1C295DCCU, 0xBA5E5678U, 0x7FF968F6U, 0xD98E6342U, 0xE86679DFU, 0x4E11726BU,
+        0xB8590282U, 0x1E2E0936U, 0x2FC613ABU, 0x89B1181FU, 0x4C162691U, 0xEA612D25U, 0xDB8937B8U, 0x7DFE3C0CU,
+        0xEC68D02BU, 0x4A1FDB9FU, 0x7BF7C102U, 0xDD80CAB6U, 0x1827F438U, 0xBE50FF8CU, 0x8FB8E511U, 0x29CFEEA5U,
+        0xDF879E4CU, 0x79F095F8U, 0x48188F65U, 0xEE6F84D1U, 0x2BC8BA5FU, 0x8DBFB1EBU, 0xBC57AB76U, 0x1A20A0C2U,
+        0x8816EAF2U, 0x2E61E146U, 0x1F89FBDBU, 0xB9FEF06FU, 0x7C59CEE1U, 0xDA2EC555U, 0xEBC6DFC8U, 0x4DB1D47CU,
+        0xBBF9A495U, 0x1D8EAF21U, 0x2C66B5BCU, 0x8A11BE08U, 0x4FB68086U, 0xE9C18B32U, 0xD82991AFU, 0x7E5E9A1BU,
+        0xEFC8763CU, 0x49BF7D88U, 0x78576715U, 0xDE206CA1U, 0x1B87522FU, 0xBDF0599BU, 0x8C184306U, 0x2A6F48B2U,
+        0xDC27385BU, 0x7A5033EFU, 0x4BB82972U, 0xEDCF22C6U, 0x28681C48U, 0x8E1F17FCU, 0xBFF70D61U, 0x198006D5U,
+        0x47ABD36EU, 0xE1DCD8DAU, 0xD034C247U, 0x7643C9F3U, 0xB3E4F77DU, 0x1593FCC9U, 0x247BE654U, 0x820CEDE0U,
+        0x74449D09U, 0xD23396BDU, 0xE3DB8C20U, 0x45AC8794U, 0x800BB91AU, 0x267CB2AEU, 0x1794A833U, 0xB1E3A387U,
+        0x20754FA0U, 0x86024414U, 0xB7EA5E89U, 0x119D553DU, 0xD43A6BB3U, 0x724D6007U, 0x43A57A9AU, 0xE5D2712EU,
+        0x139A01C7U, 0xB5ED0A73U, 0x840510EEU, 0x22721B5AU, 0xE7D525D4U, 0x41A22E60U, 0x704A34FDU, 0xD63D3F49U,
+        0xCC1D9F8BU, 0x6A6A943FU, 0x5B828EA2U, 0xFDF58516U, 0x3852BB98U, 0x9E25B02CU, 0xAFCDAAB1U, 0x09BAA105U,
+        0xFFF2D1ECU, 0x5985DA58U, 0x686DC0C5U, 0xCE1ACB71U, 0x0BBDF5FFU, 0xADCAFE4BU, 0x9C22E4D6U, 0x3A55EF62U,
+        0xABC30345U, 0x0DB408F1U, 0x3C5C126CU, 0x9A2B19D8U, 0x5F8C2756U, 0xF9FB2CE2U, 0xC813367FU, 0x6E643DCBU,
+        0x982C4D22U, 0x3E5B4696U, 0x0FB35C0BU, 0xA9C457BFU, 0x6C636931U, 0xCA146285U, 0xFBFC7818U, 0x5D8B73ACU,
+        0x03A0A617U, 0xA5D7ADA3U, 0x943FB73EU, 0x3248BC8AU, 0xF7EF8204U, 0x519889B0U, 0x6070932DU, 0xC6079899U,
+        0x304FE870U, 0x9638E3C4U, 0xA7D0F959U, 0x01A7F2EDU, 0xC400CC63U, 0x6277C7D7U, 0x539FDD4AU, 0xF5E8D6FEU,
+        0x647E3AD9U, 0xC209316DU, 0xF3E12BF0U, 0x55962044U, 0x90311ECAU, 0x3646157EU, 0x07AE0FE3U, 0xA1D90457U,
+        0x579174BEU, 0xF1E67F0AU, 0xC00E6597U, 0x66796E23U, 0xA3DE50ADU, 0x05A95B19U, 0x34414184U, 0x92364A30U
+    },
+    {
+        0x00000000U, 0xCCAA009EU, 0x4225077DU, 0x8E8F07E3U, 0x844A0EFAU, 0x48E00E64U, 0xC66F0987U, 0x0AC50919U,
+        0xD3E51BB5U, 0x1F4F1B2BU, 0x91C01CC8U, 0x5D6A1C56U, 0x57AF154FU, 0x9B0515D1U, 0x158A1232U, 0xD92012ACU,
+        0x7CBB312BU, 0xB01131B5U, 0x3E9E3656U, 0xF23436C8U, 0xF8F13FD1U, 0x345B3F4FU, 0xBAD438ACU, 0x767E3832U,
+        0xAF5E2A9EU, 0x63F42A00U, 0xED7B2DE3U, 0x21D12D7DU, 0x2B142464U, 0xE7BE24FAU, 0x69312319U, 0xA59B2387U,
+        0xF9766256U, 0x35DC62C8U, 0xBB53652BU, 0x77F965B5U, 0x7D3C6CACU, 0xB1966C32U, 0x3F196BD1U, 0xF3B36B4FU,
+        0x2A9379E3U, 0xE639797DU, 0x68B67E9EU, 0xA41C7E00U, 0xAED97719U, 0x62737787U, 0xECFC7064U, 0x205670FAU,
+        0x85CD537DU, 0x496753E3U, 0xC7E85400U, 0x0B42549EU, 0x01875D87U, 0xCD2D5D19U, 0x43A25AFAU, 0x8F085A64U,
+        0x562848C8U, 0x9A824856U, 0x140D4FB5U, 0xD8A74F2BU, 0xD2624632U, 0x1EC846ACU, 0x9047414FU, 0x5CED41D1U,
+        0x299DC2EDU, 0xE537C273U, 0x6BB8C590U, 0xA712C50EU, 0xADD7CC17U, 0x617DCC89U, 0xEFF2CB6AU, 0x2358CBF4U,
+        0xFA78D958U, 0x36D2D9C6U, 0xB85DDE25U, 0x74F7DEBBU, 0x7E32D7A2U, 0xB298D73CU, 0x3C17D0DFU, 0xF0BDD041U,
+        0x5526F3C6U, 0x998CF358U, 0x1703F4BBU, 0xDBA9F425U, 0xD16CFD3CU, 0x1DC6FDA2U, 0x9349FA41U, 0x5FE3FADFU,
+        0x86C3E873U, 0x4A69E8EDU, 0xC4E6EF0EU, 0x084CEF90U, 0x0289E689U, 0xCE23E617U, 0x40ACE1F4U, 0x8C06E16AU,
+        0xD0EBA0BBU, 0x1C41A025U, 0x92CEA7C6U, 0x5E64A758U, 0x54A1AE41U, 0x980BAEDFU, 0x1684A93CU, 0xDA2EA9A2U,
+        0x030EBB0EU, 0xCFA4BB90U, 0x412BBC73U, 0x8D81BCEDU, 0x8744B5F4U, 0x4BEEB56AU, 0xC561B289U, 0x09CBB217U,
+        0xAC509190U, 0x60FA910EU, 0xEE7596EDU, 0x22DF9673U, 0x281A9F6AU, 0xE4B09FF4U, 0x6A3F9817U, 0xA6959889U,
+        0x7FB58A25U, 0xB31F8ABBU, 0x3D908D58U, 0xF13A8DC6U, 0xFBFF84DFU, 0x37558441U, 0xB9DA83A2U, 0x7570833CU,
+        0x533B85DAU, 0x9F918544U, 0x111E82A7U, 0xDDB48239U, 0xD7718B20U, 0x1BDB8BBEU, 0x95548C5DU, 0x59FE8CC3U,
+        0x80DE9E6FU, 0x4C749EF1U, 0xC2FB9912U, 0x0E51998CU, 0x04949095U, 0xC83E900BU, 0x46B197E8U, 0x8A1B9776U,
+        0x2F80B4F1U, 0xE32AB46FU, 0x6DA5B38CU, 0xA10FB312U, 0xABCABA0BU, 0x6760BA95U, 0xE9EFBD76U, 0x2545BDE8U,
+        0xFC65AF44U, 0x30CFAFDAU, 0xBE40A839U, 0x72EAA8A7U, 0x782FA1BEU, 0xB485A120U, 0x3A0AA6C3U, 0xF6A0A65DU,
+        0xAA4DE78CU, 0x66E7E712U, 0xE868E0F1U, 0x24C2E06FU, 0x2E07E976U, 0xE2ADE9E8U, 0x6C22EE0BU, 0xA088EE95U,
+        0x79A8FC39U, 0xB502FCA7U, 0x3B8DFB44U, 0xF727FBDAU, 0xFDE2F2C3U, 0x3148F25DU, 0xBFC7F5BEU, 0x736DF520U,
+        0xD6F6D6A7U, 0x1A5CD639U, 0x94D3D1DAU, 0x5879D144U, 0x52BCD85DU, 0x9E16D8C3U, 0x1099DF20U, 0xDC33DFBEU,
+        0x0513CD12U, 0xC9B9CD8CU, 0x4736CA6FU, 0x8B9CCAF1U, 0x8159C3E8U, 0x4DF3C376U, 0xC37CC495U, 0x0FD6C40BU,
+        0x7AA64737U, 0xB60C47A9U, 0x3883404AU, 0xF42940D4U, 0xFEEC49CDU, 0x32464953U, 0xBCC94EB0U, 0x70634E2EU,
+        0xA9435C82U, 0x65E95C1CU, 0xEB665BFFU, 0x27CC5B61U, 0x2D095278U, 0xE1A352E6U, 0x6F2C5505U, 0xA386559BU,
+        0x061D761CU, 0xCAB77682U, 0x44387161U, 0x889271FFU, 0x825778E6U, 0x4EFD7878U, 0xC0727F9BU, 0x0CD87F05U,
+        0xD5F86DA9U, 0x19526D37U, 0x97DD6AD4U, 0x5B776A4AU, 0x51B26353U, 0x9D1863CDU, 0x1397642EU, 0xDF3D64B0U,
+        0x83D02561U, 0x4F7A25FFU, 0xC1F5221CU, 0x0D5F2282U, 0x079A2B9BU, 0xCB302B05U, 0x45BF2CE6U, 0x89152C78U,
+        0x50353ED4U, 0x9C9F3E4AU, 0x121039A9U, 0xDEBA3937U, 0xD47F302EU, 0x18D530B0U, 0x965A3753U, 0x5AF037CDU,
+        0xFF6B144AU, 0x33C114D4U, 0xBD4E1337U, 0x71E413A9U, 0x7B211AB0U, 0xB78B1A2EU, 0x39041DCDU, 0xF5AE1D53U,
+        0x2C8E0FFFU, 0xE0240F61U, 0x6EAB0882U, 0xA201081CU, 0xA8C40105U, 0x646E019BU, 0xEAE10678U, 0x264B06E6U
+    }
+};
+
+/* Width 32, polynomial 0x1EDC6F41, reflected */
+static const uint32_t crcTableCrc32c[8][256] =
+{
+    {
+        0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU,
+        0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U,
+        0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+        0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU, 0xBC267848U, 0x4E4DFB4BU,
+        0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+        0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+        0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U, 0xE4292D5AU,
+        0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU, 0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U,
+        0x417B1DBCU, 0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+        0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+        0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U,
+        0xDBFC821CU, 0x2997011FU, 0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+        0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U,
+        0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U,
+        0x7198540DU, 0x83F3D70EU, 0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+        0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U,
+        0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U,
+        0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+        0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU, 0xB4091BFFU, 0x466298FCU,
+        0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+        0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+        0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U, 0xFC588982U,
+        0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU, 0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U,
+        0x38CC2A06U, 0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+        0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+        0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U,
+        0xD3D3E1ABU, 0x21B862A8U, 0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+        0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU,
+        0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U,
+        0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+        0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU,
+        0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U
+    },
+    {
+        0x00000000U, 0x13A29877U, 0x274530EEU, 0x34E7A899U, 0x4E8A61DCU, 0x5D28F9ABU, 0x69CF5132U, 0x7A6DC945U,
+        0x9D14C3B8U, 0x8EB65BCFU, 0xBA51F356U, 0xA9F36B21U, 0xD39EA264U, 0xC03C3A13U, 0xF4DB928AU, 0xE7790AFDU,
+        0x3FC5F181U, 0x2C6769F6U, 0x1880C16FU, 0x0B225918U, 0x714F905DU, 0x62ED082AU, 0x560AA0B3U, 0x45A838C4U,
+        0xA2D13239U, 0xB173AA4EU, 0x859402D7U, 0x96369AA0U, 0xEC5B53E5U, 0xFFF9CB92U, 0xCB1E630BU, 0xD8BCFB7CU,
+        0x7F8BE302U, 0x6C297B75U, 0x58CED3ECU, 0x4B6C4B9BU, 0x310182DEU, 0x22A31AA9U, 0x1644B230U, 0x05E62A47U,
+        0xE29F20BAU, 0xF13DB8CDU, 0xC5DA1054U, 0xD6788823U, 0xAC154166U, 0xBFB7D911U, 0x8B507188U, 0x98F2E9FFU,
+        0x404E1283U, 0x53EC8AF4U, 0x670B226DU, 0x74A9BA1AU, 0x0EC4735FU, 0x1D66EB28U, 0x298143B1U, 0x3A23DBC6U,
+        0xDD5AD13BU, 0xCEF8494CU, 0xFA1FE1D5U, 0xE9BD79A2U, 0x93D0B0E7U, 0x80722890U, 0xB4958009U, 0xA737187EU,
+        0xFF17C604U, 0xECB55E73U, 0xD852F6EAU, 0xCBF06E9DU, 0xB19DA7D8U, 0xA23F3FAFU, 0x96D89736U, 0x857A0F41U,
+        0x620305BCU, 0x71A19DCBU, 0x45463552U, 0x56E4AD25U, 0x2C896460U, 0x3F2BFC17U, 0x0BCC548EU, 0x186ECCF9U,
+        0xC0D23785U, 0xD370AFF2U, 0xE797076BU, 0xF4359F1CU, 0x8E585659U, 0x9DFACE2EU, 0xA91D66B7U, 0xBABFFEC0U,
+        0x5DC6F43DU, 0x4E646C4AU, 0x7A83C4D3U, 0x69215CA4U, 0x134C95E1U, 0x00EE0D96U, 0x3409A50FU, 0x27AB3D78U,
+        0x809C2506U, 0x933EBD71U, 0xA7D915E8U, 0xB47B8D9FU, 0xCE1644DAU, 0xDDB4DCADU, 0xE9537434U, 0xFAF1EC43U,
+        0x1D88E6BEU, 0x0E2A7EC9U, 0x3ACDD650U, 0x296F4E27U, 0x53028762U, 0x40A01F15U, 0x7447B78CU, 0x67E52FFBU,
+        0xBF59D487U, 0xACFB4CF0U, 0x981CE469U, 0x8BBE7C1EU, 0xF1D3B55BU, 0xE2712D2CU, 0xD69685B5U, 0xC5341DC2U,
+        0x224D173FU, 0x31EF8F48U, 0x050827D1U, 0x16AABFA6U, 0x6CC776E3U, 0x7F65EE94U, 0x4B82460DU, 0x5820DE7AU,
+        0xFBC3FAF9U, 0xE861628EU, 0xDC86CA17U, 0xCF245260U, 0xB5499B25U, 0xA6EB0352U, 0x920CABCBU, 0x81AE33BCU,
+        0x66D73941U, 0x7575A136U, 0x419209AFU, 0x523091D8U, 0x285D589DU, 0x3BFFC0EAU, 0x0F186873U, 0x1CBAF004U,
+        0xC4060B78U, 0xD7A4930FU, 0xE3433B96U, 0xF0E1A3E1U, 0x8A8C6AA4U, 0x992EF2D3U, 0xADC95A4AU, 0xBE6BC23DU,
+        0x5912C8C0U, 0x4AB050B7U, 0x7E57F82EU, 0x6DF56059U, 0x1798A91CU, 0x043A316BU, 0x30DD99F2U, 0x237F0185U,
+        0x844819FBU, 0x97EA818CU, 0xA30D2915U, 0xB0AFB162U, 0xCAC27827U, 0xD960E050U, 0xED8748C9U, 0xFE25D0BEU,
+        0x195CDA43U, 0x0AFE4234U, 0x3E19EAADU, 0x2DBB72DAU, 0x57D6BB9FU, 0x447423E8U, 0x70938B71U, 0x63311306U,
+        0xBB8DE87AU, 0xA82F700DU, 0x9CC8D894U, 0x8F6A40E3U, 0xF50789A6U, 0xE6A511D1U, 0xD242B948U, 0xC1E0213FU,
+        0x26992BC2U, 0x353BB3B5U, 0x01DC1B2CU, 0x127E835BU, 0x68134A1EU, 0x7BB1D269U, 0x4F567AF0U, 0x5CF4E287U,
+        0x04D43CFDU, 0x1776A48AU, 0x23910C13U, 0x30339464U, 0x4A5E5D21U, 0x59FCC556U, 0x6D1B6DCFU, 0x7EB9F5B8U,
+        0x99C0FF45U, 0x8A626732U, 0xBE85CFABU, 0xAD2757DCU, 0xD74A9E99U, 0xC4E806EEU, 0xF00FAE77U, 0xE3AD3600U,
+        0x3B11CD7CU, 0x28B3550BU, 0x1C54FD92U, 0x0FF665E5U, 0x759BACA0U, 0x663934D7U, 0x52DE9C4EU, 0x417C0439U,
+        0xA6050EC4U, 0xB5A796B3U, 0x81403E2AU, 0x92E2A65DU, 0xE88F6F18U, 0xFB2DF76FU, 0xCFCA5FF6U, 0xDC68C781U,
+        0x7B5FDFFFU, 0x68FD4788U, 0x5C1AEF11U, 0x4FB87766U, 0x35D5BE23U, 0x26772654U, 0x12908ECDU, 0x013216BAU,
+        0xE64B1C47U, 0xF5E98430U, 0xC10E2CA9U, 0xD2ACB4DEU, 0xA8C17D9BU, 0xBB63E5ECU, 0x8F844D75U, 0x9C26D502U,
+        0x449A2E7EU, 0x5738B609U, 0x63DF1E90U, 0x707D86E7U, 0x0A104FA2U, 0x19B2D7D5U, 0x2D557F4CU, 0x3EF7E73BU,
+        0xD98EEDC6U, 0xCA2C75B1U, 0xFECBDD28U, 0xED69455FU, 0x97048C1AU, 0x84A6146DU, 0xB041BCF4U, 0xA3E32483U
+    },
+    {
+        0x00000000U, 0xA541927EU, 0x4F6F520DU, 0xEA2EC073U, 0x9EDEA41AU, 0x3B9F3664U, 0xD1B1F617U, 0x74F06469U,
+        0x38513EC5U, 0x9D10ACBBU, 0x773E6CC8U, 0xD27FFEB6U, 0xA68F9ADFU, 0x03CE08A1U, 0xE9E0C8D2U, 0x4CA15AACU,
+        0x70A27D8AU, 0xD5E3EFF4U, 0x3FCD2F87U, 0x9A8CBDF9U, 0xEE7CD990U, 0x4B3D4BEEU, 0xA1138B9DU, 0x045219E3U,
+        0x48F3434FU, 0xEDB2D131U, 0x079C1142U, 0xA2DD833CU, 0xD62DE755U, 0x736C752BU, 0x9942B558U, 0x3C032726U,
+        0xE144FB14U, 0x4405696AU, 0xAE2BA919U, 0x0B6A3B67U, 0x7F9A5F0EU, 0xDADBCD70U, 0x30F50D03U, 0x95B49F7DU,
+        0xD915C5D1U, 0x7C5457AFU, 0x967A97DCU, 0x333B05A2U, 0x47CB61CBU, 0xE28AF3B5U, 0x08A433C6U, 0xADE5A1B8U,
+        0x91E6869EU, 0x34A714E0U, 0xDE89D493U, 0x7BC846EDU, 0x0F382284U, 0xAA79B0FAU, 0x40577089U, 0xE516E2F7U,
+        0xA9B7B85BU, 0x0CF62A25U, 0xE6D8EA56U, 0x43997828U, 0x37691C41U, 0x92288E3FU, 0x78064E4CU, 0xDD47DC32U,
+        0xC76580D9U, 0x622412A7U, 0x880AD2D4U, 0x2D4B40AAU, 0x59BB24C3U, 0xFCFAB6BDU, 0x16D476CEU, 0xB395E4B0U,
+        0xFF34BE1CU, 0x5A752C62U, 0xB05BEC11U, 0x151A7E6FU, 0x61EA1A06U, 0xC4AB8878U, 0x2E85480BU, 0x8BC4DA75U,
+        0xB7C7FD53U, 0x12866F2DU, 0xF8A8AF5EU, 0x5DE93D20U, 0x29195949U, 0x8C58CB37U, 0x66760B44U, 0xC337993AU,
+        0x8F96C396U, 0x2AD751E8U, 0xC0F9919BU, 0x65B803E5U, 0x1148678CU, 0xB409F5F2U, 0x5E273581U, 0xFB66A7FFU,
+        0x26217BCDU, 0x8360E9B3U, 0x694E29C0U, 0xCC0FBBBEU, 0xB8FFDFD7U, 0x1DBE4DA9U, 0xF7908DDAU, 0x52D11FA4U,
+        0x1E704508U, 0xBB31D776U, 0x511F1705U, 0xF45E857BU, 0x80AEE112U, 0x25EF736CU, 0xCFC1B31FU, 0x6A802161U,
+        0x56830647U, 0xF3C29439U, 0x19EC544AU, 0xBCADC634U, 0xC85DA25DU, 0x6D1C3023U, 0x8732F050U, 0x2273622EU,
+        0x6ED23882U, 0xCB93AAFCU, 0x21BD6A8FU, 0x84FCF8F1U, 0xF00C9C98U, 0x554D0EE6U, 0xBF63CE95U, 0x1A225CEBU,
+        0x8B277743U, 0x2E66E53DU, 0xC448254EU, 0x6109B730U, 0x15F9D359U, 0xB0B84127U, 0x5A968154U, 0xFFD7132AU,
+        0xB3764986U, 0x1637DBF8U, 0xFC191B8BU, 0x595889F5U, 0x2DA8ED9CU, 0x88E97FE2U, 0x62C7BF91U, 0xC7862DEFU,
+        0xFB850AC9U, 0x5EC498B7U, 0xB4EA58C4U, 0x11ABCABAU, 0x655BAED3U, 0xC01A3CADU, 0x2A34FCDEU, 0x8F756EA0U,
+        0xC3D4340CU, 0x6695A672U, 0x8CBB6601U, 0x29FAF47FU, 0x5D0A9016U, 0xF84B0268U, 0x1265C21BU, 0xB7245065U,
+        0x6A638C57U, 0xCF221E29U, 0x250CDE5AU, 0x804D4C24U, 0xF4BD284DU, 0x51FCBA33U, 0xBBD27A40U, 0x1E93E83EU,
+        0x5232B292U, 0xF77320ECU, 0x1D5DE09FU, 0xB81C72E1U, 0xCCEC1688U, 0x69AD84F6U, 0x83834485U, 0x26C2D6FBU,
+        0x1AC1F1DDU, 0xBF8063A3U, 0x55AEA3D0U, 0xF0EF31AEU, 0x841F55C7U, 0x215EC7B9U, 0xCB7007CAU, 0x6E3195B4U,
+        0x2290CF18U, 0x87D15D66U, 0x6DFF9D15U, 0xC8BE0F6BU, 0xBC4E6B02U, 0x190FF97CU, 0xF321390FU, 0x5660AB71U,
+        0x4C42F79AU, 0xE90365E4U, 0x032DA597U, 0xA66C37E9U, 0xD29C5380U, 0x77DDC1FEU, 0x9DF3018DU, 0x38B293F3U,
+        0x7413C95FU, 0xD1525B21U, 0x3B7C9B52U, 0x9E3D092CU, 0xEACD6D45U, 0x4F8CFF3BU, 0xA5A23F48U, 0x00E3AD36U,
+        0x3CE08A10U, 0x99A1186EU, 0x738FD81DU, 0xD6CE4A63U, 0xA23E2E0AU, 0x077FBC74U, 0xED517C07U, 0x4810EE79U,
+        0x04B1B4D5U, 0xA1F026ABU, 0x4BDEE6D8U, 0xEE9F74A6U, 0x9A6F10CFU, 0x3F2E82B1U, 0xD50042C2U, 0x7041D0BCU,
+        0xAD060C8EU, 0x08479EF0U, 0xE2695E83U, 0x4728CCFDU, 0x33D8A894U, 0x96993AEAU, 0x7CB7FA99U, 0xD9F668E7U,
+        0x9557324BU, 0x3016A035U, 0xDA386046U, 0x7F79F238U, 0x0B899651U, 0xAEC8042FU, 0x44E6C45CU, 0xE1A75622U,
+        0xDDA47104U, 0x78E5E37AU, 0x92CB2309U, 0x378AB177U, 0x437AD51EU, 0xE63B4760U, 0x0C158713U, 0xA954156DU,
+        0xE5F54FC1U, 0x40B4DDBFU, 0xAA9A1DCCU, 0x0FDB8FB2U, 0x7B2BEBDBU, 0xDE6A79A5U, 0x3444B9D6U, 0x91052BA8U
+    },
+    {
+        0x00000000U, 0xDD45AAB8U, 0xBF672381U, 0x62228939U, 0x7B2231F3U, 0xA6679B4BU, 0xC4451272U, 0x1900B8CAU,
+        0xF64463E6U, 0x2B01C95EU, 0x49234067U, 0x9466EADFU, 0x8D665215U, 0x5023F8ADU, 0x32017194U, 0xEF44DB2CU,
+        0xE964B13DU, 0x34211B85U, 0x560392BCU, 0x8B463804U, 0x924680CEU, 0x4F032A76U, 0x2D21A34FU, 0xF06409F7U,
+        0x1F20D2DBU, 0xC2657863U, 0xA047F15AU, 0x7D025BE2U, 0x6402E328U, 0xB9474990U, 0xDB65C0A9U, 0x06206A11U,
+        0xD725148BU, 0x0A60BE33U, 0x6842370AU, 0xB5079DB2U, 0xAC072578U, 0x71428FC0U, 0x136006F9U, 0xCE25AC41U,
+        0x2161776DU, 0xFC24DDD5U, 0x9E0654ECU, 0x4343FE54U, 0x5A43469EU, 0x8706EC26U, 0xE524651FU, 0x3861CFA7U,
+        0x3E41A5B6U, 0xE3040F0EU, 0x81268637U, 0x5C632C8FU, 0x45639445U, 0x98263EFDU, 0xFA04B7C4U, 0x27411D7CU,
+        0xC805C650U, 0x15406CE8U, 0x7762E5D1U, 0xAA274F69U, 0xB327F7A3U, 0x6E625D1BU, 0x0C40D422U, 0xD1057E9AU,
+        0xABA65FE7U, 0x76E3F55FU, 0x14C17C66U, 0xC984D6DEU, 0xD0846E14U, 0x0DC1C4ACU, 0x6FE34D95U, 0xB2A6E72DU,
+        0x5DE23C01U, 0x80A796B9U, 0xE2851F80U, 0x3FC0B538U, 0x26C00DF2U, 0xFB85A74AU, 0x99A72E73U, 0x44E284CBU,
+        0x42C2EEDAU, 0x9F874462U, 0xFDA5CD5BU, 0x20E067E3U, 0x39E0DF29U, 0xE4A57591U, 0x8687FCA8U, 0x5BC25610U,
+        0xB4868D3CU, 0x69C32784U, 0x0BE1AEBDU, 0xD6A40405U, 0xCFA4BCCFU, 0x12E11677U, 0x70C39F4EU, 0xAD8635F6U,
+        0x7C834B6CU, 0xA1C6E1D4U, 0xC3E468EDU, 0x1EA1C255U, 0x07A17A9FU, 0xDAE4D027U, 0xB8C6591EU, 0x6583F3A6U,
+        0x8AC7288AU, 0x57828232U, 0x35A00B0BU, 0xE8E5A1B3U, 0xF1E51979U, 0x2CA0B3C1U, 0x4E823AF8U, 0x93C79040U,
+        0x95E7FA51U, 0x48A250E9U, 0x2A80D9D0U, 0xF7C57368U, 0xEEC5CBA2U, 0x3380611AU, 0x51A2E823U, 0x8CE7429BU,
+        0x63A399B7U, 0xBEE6330FU, 0xDCC4BA36U, 0x0181108EU, 0x1881A844U, 0xC5C402FCU, 0xA7E68BC5U, 0x7AA3217DU,
+        0x52A0C93FU, 0x8FE56387U, 0xEDC7EABEU, 0x30824006U, 0x2982F8CCU, 0xF4C75274U, 0x96E5DB4DU, 0x4BA071F5U,
+        0xA4E4AAD9U, 0x79A10061U, 0x1B838958U, 0xC6C623E0U, 0xDFC69B2AU, 0x02833192U, 0x60A1B8ABU, 0xBDE41213U,
+        0xBBC47802U, 0x6681D2BAU, 0x04A35B83U, 0xD9E6F13BU, 0xC0E649F1U, 0x1DA3E349U, 0x7F816A70U, 0xA2C4C0C8U,
+        0x4D801BE4U, 0x90C5B15CU, 0xF2E73865U, 0x2FA292DDU, 0x36A22A17U, 0xEBE780AFU, 0x89C50996U, 0x5480A32EU,
+        0x8585DDB4U, 0x58C0770CU, 0x3AE2FE35U, 0xE7A7548DU, 0xFEA7EC47U, 0x23E246FFU, 0x41C0CFC6U, 0x9C85657EU,
+        0x73C1BE52U, 0xAE8414EAU, 0xCCA69DD3U, 0x11E3376BU, 0x08E38FA1U, 0xD5A62519U, 0xB784AC20U, 0x6AC10698U,
+        0x6CE16C89U, 0xB1A4C631U, 0xD3864F08U, 0x0EC3E5B0U, 0x17C35D7AU, 0xCA86F7C2U, 0xA8A47EFBU, 0x75E1D443U,
+        0x9AA50F6FU, 0x47E0A5D7U, 0x25C22CEEU, 0xF8878656U, 0xE1873E9CU, 0x3CC29424U, 0x5EE01D1DU, 0x83A5B7A5U,
+        0xF90696D8U, 0x24433C60U, 0x4661B559U, 0x9B241FE1U, 0x8224A72BU, 0x5F610D93U, 0x3D4384AAU, 0xE0062E12U,
+        0x0F42F53EU, 0xD2075F86U, 0xB025D6BFU, 0x6D607C07U, 0x7460C4CDU, 0xA9256E75U, 0xCB07E74CU, 0x16424DF4U,
+        0x106227E5U, 0xCD278D5DU, 0xAF050464U, 0x7240AEDCU, 0x6B401616U, 0xB605BCAEU, 0xD4273597U, 0x09629F2FU,
+        0xE6264403U, 0x3B63EEBBU, 0x59416782U, 0x8404CD3AU, 0x9D0475F0U, 0x4041DF48U, 0x22635671U, 0xFF26FCC9U,
+        0x2E238253U, 0xF36628EBU, 0x9144A1D2U, 0x4C010B6AU, 0x5501B3A0U, 0x88441918U, 0xEA669021U, 0x37233A99U,
+        0xD867E1B5U, 0x05224B0DU, 0x6700C234U, 0xBA45688CU, 0xA345D046U, 0x7E007AFEU, 0x1C22F3C7U, 0xC167597FU,
+        0xC747336EU, 0x1A0299D6U, 0x782010EFU, 0xA565BA57U, 0xBC65029DU, 0x6120A825U, 0x0302211CU, 0xDE478BA4U,
+        0x31035088U, 0xEC46FA30U, 0x8E647309U, 0x5321D9B1U, 0x4A21617BU, 0x9764CBC3U, 0xF54642FAU, 0x2803E842U
+    },
+    {
+        0x00000000U, 0x38116FACU, 0x7022DF58U, 0x4833B0F4U, 0xE045BEB0U, 0xD854D11CU, 0x906761E8U, 0xA8760E44U,
+        0xC5670B91U, 0xFD76643DU, 0xB545D4C9U, 0x8D54BB65U, 0x2522B521U, 0x1D33DA8DU, 0x55006A79U, 0x6D1105D5U,
+        0x8F2261D3U, 0xB7330E7FU, 0xFF00BE8BU, 0xC711D127U, 0x6F67DF63U, 0x5776B0CFU, 0x1F45003BU, 0x27546F97U,
+        0x4A456A42U, 0x725405EEU, 0x3A67B51AU, 0x0276DAB6U, 0xAA00D4F2U, 0x9211BB5EU, 0xDA220BAAU, 0xE2336406U,
+        0x1BA8B557U, 0x23B9DAFBU, 0x6B8A6A0FU, 0x539B05A3U, 0xFBED0BE7U, 0xC3FC644BU, 0x8BCFD4BFU, 0xB3DEBB13U,
+        0xDECFBEC6U, 0xE6DED16AU, 0xAEED619EU, 0x96FC0E32U, 0x3E8A0076U, 0x069B6FDAU, 0x4EA8DF2EU, 0x76B9B082U,
+        0x948AD484U, 0xAC9BBB28U, 0xE4A80BDCU, 0xDCB96470U, 0x74CF6A34U, 0x4CDE0598U, 0x04EDB56CU, 0x3CFCDAC0U,
+        0x51EDDF15U, 0x69FCB0B9U, 0x21CF004DU, 0x19DE6FE1U, 0xB1A861A5U, 0x89B90E09U, 0xC18ABEFDU, 0xF99BD151U,
+        0x37516AAEU, 0x0F400502U, 0x4773B5F6U, 0x7F62DA5AU, 0xD714D41EU, 0xEF05BBB2U, 0xA7360B46U, 0x9F2764EAU,
+        0xF236613FU, 0xCA270E93U, 0x8214BE67U, 0xBA05D1CBU, 0x1273DF8FU, 0x2A62B023U, 0x625100D7U, 0x5A406F7BU,
+        0xB8730B7DU, 0x806264D1U, 0xC851D425U, 0xF040BB89U, 0x5836B5CDU, 0x6027DA61U, 0x28146A95U, 0x10050539U,
+        0x7D1400ECU, 0x45056F40U, 0x0D36DFB4U, 0x3527B018U, 0x9D51BE5CU, 0xA540D1F0U, 0xED736104U, 0xD5620EA8U,
+        0x2CF9DFF9U, 0x14E8B055U, 0x5CDB00A1U, 0x64CA6F0DU, 0xCCBC6149U, 0xF4AD0EE5U, 0xBC9EBE11U, 0x848FD1BDU,
+        0xE99ED468U, 0xD18FBBC4U, 0x99BC0B30U, 0xA1AD649CU, 0x09DB6AD8U, 0x31CA0574U, 0x79F9B580U, 0x41E8DA2CU,
+        0xA3DBBE2AU, 0x9BCAD186U, 0xD3F96172U, 0xEBE80EDEU, 0x439E009AU, 0x7B8F6F36U, 0x33BCDFC2U, 0x0BADB06EU,
+        0x66BCB5BBU, 0x5EADDA17U, 0x169E6AE3U, 0x2E8F054FU, 0x86F90B0BU, 0xBEE864A7U, 0xF6DBD453U, 0xCECABBFFU,
+        0x6EA2D55CU, 0x56B3BAF0U, 0x1E800A04U, 0x269165A8U, 0x8EE76BECU, 0xB6F60440U, 0xFEC5B4B4U, 0xC6D4DB18U,
+        0xABC5DECDU, 0x93D4B161U, 0xDBE70195U, 0xE3F66E39U, 0x4B80607DU, 0x73910FD1U, 0x3BA2BF25U, 0x03B3D089U,
+        0xE180B48FU, 0xD991DB23U, 0x91A26BD7U, 0xA9B3047BU, 0x01C50A3FU, 0x39D46593U, 0x71E7D567U, 0x49F6BACBU,
+        0x24E7BF1EU, 0x1CF6D0B2U, 0x54C56046U, 0x6CD40FEAU, 0xC4A201AEU, 0xFCB36E02U, 0xB480DEF6U, 0x8C91B15AU,
+        0x750A600BU, 0x4D1B0FA7U, 0x0528BF53U, 0x3D39D0FFU, 0x954FDEBBU, 0xAD5EB117U, 0xE56D01E3U, 0xDD7C6E4FU,
+        0xB06D6B9AU, 0x887C0436U, 0xC04FB4C2U, 0xF85EDB6EU, 0x5028D52AU, 0x6839BA86U, 0x200A0A72U, 0x181B65DEU,
+        0xFA2801D8U, 0xC2396E74U, 0x8A0ADE80U, 0xB21BB12CU, 0x1A6DBF68U, 0x227CD0C4U, 0x6A4F6030U, 0x525E0F9CU,
+        0x3F4F0A49U, 0x075E65E5U, 0x4F6DD511U, 0x777CBABDU, 0xDF0AB4F9U, 0xE71BDB55U, 0xAF286BA1U, 0x9739040DU,
+        0x59F3BFF2U, 0x61E2D05EU, 0x29D160AAU, 0x11C00F06U, 0xB9B60142U, 0x81A76EEEU, 0xC994DE1AU, 0xF185B1B6U,
+        0x9C94B463U, 0xA485DBCFU, 0xECB66B3BU, 0xD4A70497U, 0x7CD10AD3U, 0x44C0657FU, 0x0CF3D58BU, 0x34E2BA27U,
+        0xD6D1DE21U, 0xEEC0B18DU, 0xA6F30179U, 0x9EE26ED5U, 0x36946091U, 0x0E850F3DU, 0x46B6BFC9U, 0x7EA7D065U,
+        0x13B6D5B0U, 0x2BA7BA1CU, 0x63940AE8U, 0x5B856544U, 0xF3F36B00U, 0xCBE204ACU, 0x83D1B458U, 0xBBC0DBF4U,
+        0x425B0AA5U, 0x7A4A6509U, 0x3279D5FDU, 0x0A68BA51U, 0xA21EB415U, 0x9A0FDBB9U, 0xD23C6B4DU, 0xEA2D04E1U,
+        0x873C0134U, 0xBF2D6E98U, 0xF71EDE6CU, 0xCF0FB1C0U, 0x6779BF84U, 0x5F68D028U, 0x175B60DCU, 0x2F4A0F70U,
+        0xCD796B76U, 0xF56804DAU, 0xBD5BB42EU, 0x854ADB82U, 0x2D3CD5C6U, 0x152DBA6AU, 0x5D1E0A9EU, 0x650F6532U,
+        0x081E60E7U, 0x300F0F4BU, 0x783CBFBFU, 0x402DD013U, 0xE85BDE57U, 0xD04AB1FBU, 0x9879010FU, 0xA0686EA3U
+    },
+    {
+        0x00000000U, 0xEF306B19U, 0xDB8CA0C3U, 0x34BCCBDAU, 0xB2F53777U, 0x5DC55C6EU, 0x697997B4U, 0x8649FCADU,
+        0x6006181FU, 0x8F367306U, 0xBB8AB8DCU, 0x54BAD3C5U, 0xD2F32F68U, 0x3DC34471U, 0x097F8FABU, 0xE64FE4B2U,
+        0xC00C303EU, 0x2F3C5B27U, 0x1B8090FDU, 0xF4B0FBE4U, 0x72F90749U, 0x9DC96C50U, 0xA975A78AU, 0x4645CC93U,
+        0xA00A2821U, 0x4F3A4338U, 0x7B8688E2U, 0x94B6E3FBU, 0x12FF1F56U, 0xFDCF744FU, 0xC973BF95U, 0x2643D48CU,
+        0x85F4168DU, 0x6AC47D94U, 0x5E78B64EU, 0xB148DD57U, 0x370121FAU, 0xD8314AE3U, 0xEC8D8139U, 0x03BDEA20U,
+        0xE5F20E92U, 0x0AC2658BU, 0x3E7EAE51U, 0xD14EC548U, 0x570739E5U, 0xB83752FCU, 0x8C8B9926U, 0x63BBF23FU,
+        0x45F826B3U, 0xAAC84DAAU, 0x9E748670U, 0x7144ED69U, 0xF70D11C4U, 0x183D7ADDU, 0x2C81B107U, 0xC3B1DA1EU,
+        0x25FE3EACU, 0xCACE55B5U, 0xFE729E6FU, 0x1142F576U, 0x970B09DBU, 0x783B62C2U, 0x4C87A918U, 0xA3B7C201U,
+        0x0E045BEBU, 0xE13430F2U, 0xD588FB28U, 0x3AB89031U, 0xBCF16C9CU, 0x53C10785U, 0x677DCC5FU, 0x884DA746U,
+        0x6E0243F4U, 0x813228EDU, 0xB58EE337U, 0x5ABE882EU, 0xDCF77483U, 0x33C71F9AU, 0x077BD440U, 0xE84BBF59U,
+        0xCE086BD5U, 0x213800CCU, 0x1584CB16U, 0xFAB4A00FU, 0x7CFD5CA2U, 0x93CD37BBU, 0xA771FC61U, 0x48419778U,
+        0xAE0E73CAU, 0x413E18D3U, 0x7582D309U, 0x9AB2B810U, 0x1CFB44BDU, 0xF3CB2FA4U, 0xC777E47EU, 0x28478F67U,
+        0x8BF04D66U, 0x64C0267FU, 0x507CEDA5U, 0xBF4C86BCU, 0x39057A11U, 0xD6351108U, 0xE289DAD2U, 0x0DB9B1CBU,
+        0xEBF65579U, 0x04C63E60U, 0x307AF5BAU, 0xDF4A9EA3U, 0x5903620EU, 0xB6330917U, 0x828FC2CDU, 0x6DBFA9D4U,
+        0x4BFC7D58U, 0xA4CC1641U, 0x9070DD9BU, 0x7F40B682U, 0xF9094A2FU, 0x16392136U, 0x2285EAECU, 0xCDB581F5U,
+        0x2BFA6547U, 0xC4CA0E5EU, 0xF076C584U, 0x1F46AE9DU, 0x990F5230U, 0x763F3929U, 0x4283F2F3U, 0xADB399EAU,
+        0x1C08B7D6U, 0xF338DCCFU, 0xC7841715U, 0x28B47C0CU, 0xAEFD80A1U, 0x41CDEBB8U, 0x75712062U, 0x9A414B7BU,
+        0x7C0EAFC9U, 0x933EC4D0U, 0xA7820F0AU, 0x48B26413U, 0xCEFB98BEU, 0x21CBF3A7U, 0x1577387DU, 0xFA475364U,
+        0xDC0487E8U, 0x3334ECF1U, 0x0788272BU, 0xE8B84C32U, 0x6EF1B09FU, 0x81C1DB86U, 0xB57D105CU, 0x5A4D7B45U,
+        0xBC029FF7U, 0x5332F4EEU, 0x678E3F34U, 0x88BE542DU, 0x0EF7A880U, 0xE1C7C399U, 0xD57B0843U, 0x3A4B635AU,
+        0x99FCA15BU, 0x76CCCA42U, 0x42700198U, 0xAD406A81U, 0x2B09962CU, 0xC439FD35U, 0xF08536EFU, 0x1FB55DF6U,
+        0xF9FAB944U, 0x16CAD25DU, 0x22761987U, 0xCD46729EU, 0x4B0F8E33U, 0xA43FE52AU, 0x90832EF0U, 0x7FB345E9U,
+        0x59F09165U, 0xB6C0FA7CU, 0x827C31A6U, 0x6D4C5ABFU, 0xEB05A612U, 0x0435CD0BU, 0x308906D1U, 0xDFB96DC8U,
+        0x39F6897AU, 0xD6C6E263U, 0xE27A29B9U, 0x0D4A42A0U, 0x8B03BE0DU, 0x6433D514U, 0x508F1ECEU, 0xBFBF75D7U,
+        0x120CEC3DU, 0xFD3C8724U, 0xC9804CFEU, 0x26B027E7U, 0xA0F9DB4AU, 0x4FC9B053U, 0x7B757B89U, 0x94451090U,
+        0x720AF422U, 0x9D3A9F3BU, 0xA98654E1U, 0x46B63FF8U, 0xC0FFC355U, 0x2FCFA84CU, 0x1B736396U, 0xF443088FU,
+        0xD200DC03U, 0x3D30B71AU, 0x098C7CC0U, 0xE6BC17D9U, 0x60F5EB74U, 0x8FC5806DU, 0xBB794BB7U, 0x544920AEU,
+        0xB206C41CU, 0x5D36AF05U, 0x698A64DFU, 0x86BA0FC6U, 0x00F3F36BU, 0xEFC39872U, 0xDB7F53A8U, 0x344F38B1U,
+        0x97F8FAB0U, 0x78C891A9U, 0x4C745A73U, 0xA344316AU, 0x250DCDC7U, 0xCA3DA6DEU, 0xFE816D04U, 0x11B1061DU,
+        0xF7FEE2AFU, 0x18CE89B6U, 0x2C72426CU, 0xC3422975U, 0x450BD5D8U, 0xAA3BBEC1U, 0x9E87751BU, 0x71B71E02U,
+        0x57F4CA8EU, 0xB8C4A197U, 0x8C786A4DU, 0x63480154U, 0xE501FDF9U, 0x0A3196E0U, 0x3E8D5D3AU, 0xD1BD3623U,
+        0x37F2D291U, 0xD8C2B988U, 0xEC7E7252U, 0x034E194BU, 0x8507E5E6U, 0x6A378EFFU, 0x5E8B4525U, 0xB1BB2E3CU
+    },
+    {
+        0x00000000U, 0x68032CC8U, 0xD0065990U, 0xB8057558U, 0xA5E0C5D1U, 0xCDE3E919U, 0x75E69C41U, 0x1DE5B089U,
+        0x4E2DFD53U, 0x262ED19BU, 0x9E2BA4C3U, 0xF628880BU, 0xEBCD3882U, 0x83CE144AU, 0x3BCB6112U, 0x53C84DDAU,
+        0x9C5BFAA6U, 0xF458D66EU, 0x4C5DA336U, 0x245E8FFEU, 0x39BB3F77U, 0x51B813BFU, 0xE9BD66E7U, 0x81BE4A2FU,
+        0xD27607F5U, 0xBA752B3DU, 0x02705E65U, 0x6A7372ADU, 0x7796C224U, 0x1F95EEECU, 0xA7909BB4U, 0xCF93B77CU,
+        0x3D5B83BDU, 0x5558AF75U, 0xED5DDA2DU, 0x855EF6E5U, 0x98BB466CU, 0xF0B86AA4U, 0x48BD1FFCU, 0x20BE3334U,
+        0x73767EEEU, 0x1B755226U, 0xA370277EU, 0xCB730BB6U, 0xD696BB3FU, 0xBE9597F7U, 0x0690E2AFU, 0x6E93CE67U,
+        0xA100791BU, 0xC90355D3U, 0x7106208BU, 0x19050C43U, 0x04E0BCCAU, 0x6CE39002U, 0xD4E6E55AU, 0xBCE5C992U,
+        0xEF2D8448U, 0x872EA880U, 0x3F2BDDD8U, 0x5728F110U, 0x4ACD4199U, 0x22CE6D51U, 0x9ACB1809U, 0xF2C834C1U,
+        0x7AB7077AU, 0x12B42BB2U, 0xAAB15EEAU, 0xC2B27222U, 0xDF57C2ABU, 0xB754EE63U, 0x0F519B3BU, 0x6752B7F3U,
+        0x349AFA29U, 0x5C99D6E1U, 0xE49CA3B9U, 0x8C9F8F71U, 0x917A3FF8U, 0xF9791330U, 0x417C6668U, 0x297F4AA0U,
+        0xE6ECFDDCU, 0x8EEFD114U, 0x36EAA44CU, 0x5EE98884U, 0x430C380DU, 0x2B0F14C5U, 0x930A619DU, 0xFB094D55U,
+        0xA8C1008FU, 0xC0C22C47U, 0x78C7591FU, 0x10C475D7U, 0x0D21C55EU, 0x6522E996U, 0xDD279CCEU, 0xB524B006U,
+        0x47EC84C7U, 0x2FEFA80FU, 0x97EADD57U, 0xFFE9F19FU, 0xE20C4116U, 0x8A0F6DDEU, 0x320A1886U, 0x5A09344EU,
+        0x09C17994U, 0x61C2555CU, 0xD9C72004U, 0xB1C40CCCU, 0xAC21BC45U, 0xC422908DU, 0x7C27E5D5U, 0x1424C91DU,
+        0xDBB77E61U, 0xB3B452A9U, 0x0BB127F1U, 0x63B20B39U, 0x7E57BBB0U, 0x16549778U, 0xAE51E220U, 0xC652CEE8U,
+        0x959A8332U, 0xFD99AFFAU, 0x459CDAA2U, 0x2D9FF66AU, 0x307A46E3U, 0x58796A2BU, 0xE07C1F73U, 0x887F33BBU,
+        0xF56E0EF4U, 0x9D6D223CU, 0x25685764U, 0x4D6B7BACU, 0x508ECB25U, 0x388DE7EDU, 0x808892B5U, 0xE88BBE7DU,
+        0xBB43F3A7U, 0xD340DF6FU, 0x6B45AA37U, 0x034686FFU, 0x1EA33676U, 0x76A01ABEU, 0xCEA56FE6U, 0xA6A6432EU,
+        0x6935F452U, 0x0136D89AU, 0xB933ADC2U, 0xD130810AU, 0xCCD53183U, 0xA4D61D4BU, 0x1CD36813U, 0x74D044DBU,
+        0x27180901U, 0x4F1B25C9U, 0xF71E5091U, 0x9F1D7C59U, 0x82F8CCD0U, 0xEAFBE018U, 0x52FE9540U, 0x3AFDB988U,
+        0xC8358D49U, 0xA036A181U, 0x1833D4D9U, 0x7030F811U, 0x6DD54898U, 0x05D66450U, 0xBDD31108U, 0xD5D03DC0U,
+        0x8618701AU, 0xEE1B5CD2U, 0x561E298AU, 0x3E1D0542U, 0x23F8B5CBU, 0x4BFB9903U, 0xF3FEEC5BU, 0x9BFDC093U,
+        0x546E77EFU, 0x3C6D5B27U, 0x84682E7FU, 0xEC6B02B7U, 0xF18EB23EU, 0x998D9EF6U, 0x2188EBAEU, 0x498BC766U,
+        0x1A438ABCU, 0x7240A674U, 0xCA45D32CU, 0xA246FFE4U, 0xBFA34F6DU, 0xD7A063A5U, 0x6FA516FDU, 0x07A63A35U,
+        0x8FD9098EU, 0xE7DA2546U, 0x5FDF501EU, 0x37DC7CD6U, 0x2A39CC5FU, 0x423AE097U, 0xFA3F95CFU, 0x923CB907U,
+        0xC1F4F4DDU, 0xA9F7D815U, 0x11F2AD4DU, 0x79F18185U, 0x6414310CU, 0x0C171DC4U, 0xB412689CU, 0xDC114454U,
+        0x1382F328U, 0x7B81DFE0U, 0xC384AAB8U, 0xAB878670U, 0xB66236F9U, 0xDE611A31U, 0x66646F69U, 0x0E6743A1U,
+        0x5DAF0E7BU, 0x35AC22B3U, 0x8DA957EBU, 0xE5AA7B23U, 0xF84FCBAAU, 0x904CE762U, 0x2849923AU, 0x404ABEF2U,
+        0xB2828A33U, 0xDA81A6FBU, 0x6284D3A3U, 0x0A87FF6BU, 0x17624FE2U, 0x7F61632AU, 0xC7641672U, 0xAF673ABAU,
+        0xFCAF7760U, 0x94AC5BA8U, 0x2CA92EF0U, 0x44AA0238U, 0x594FB2B1U, 0x314C9E79U, 0x8949EB21U, 0xE14AC7E9U,
+        0x2ED97095U, 0x46DA5C5DU, 0xFEDF2905U, 0x96DC05CDU, 0x8B39B544U, 0xE33A998CU, 0x5B3FECD4U, 0x333CC01CU,
+        0x60F48DC6U, 0x08F7A10EU, 0xB0F2D456U, 0xD8F1F89EU, 0xC5144817U, 0xAD1764DFU, 0x15121187U, 0x7D113D4FU
+    },
+    {
+        0x00000000U, 0x493C7D27U, 0x9278FA4EU, 0xDB448769U, 0x211D826DU, 0x6821FF4AU, 0xB3657823U, 0xFA590504U,
+        0x423B04DAU, 0x0B0779FDU, 0xD043FE94U, 0x997F83B3U, 0x632686B7U, 0x2A1AFB90U, 0xF15E7CF9U, 0xB86201DEU,
+        0x847609B4U, 0xCD4A7493U, 0x160EF3FAU, 0x5F328EDDU, 0xA56B8BD9U, 0xEC57F6FEU, 0x37137197U, 0x7E2F0CB0U,
+        0xC64D0D6EU, 0x8F717049U, 0x5435F720U, 0x1D098A07U, 0xE7508F03U, 0xAE6CF224U, 0x7528754DU, 0x3C14086AU,
+        0x0D006599U, 0x443C18BEU, 0x9F789FD7U, 0xD644E2F0U, 0x2C1DE7F4U, 0x65219AD3U, 0xBE651DBAU, 0xF759609DU,
+        0x4F3B6143U, 0x06071C64U, 0xDD439B0DU, 0x947FE62AU, 0x6E26E32EU, 0x271A9E09U, 0xFC5E1960U, 0xB5626447U,
+        0x89766C2DU, 0xC04A110AU, 0x1B0E9663U, 0x5232EB44U, 0xA86BEE40U, 0xE1579367U, 0x3A13140EU, 0x732F6929U,
+        0xCB4D68F7U, 0x827115D0U, 0x593592B9U, 0x1009EF9EU, 0xEA50EA9AU, 0xA36C97BDU, 0x782810D4U, 0x31146DF3U,
+        0x1A00CB32U, 0x533CB615U, 0x8878317CU, 0xC1444C5BU, 0x3B1D495FU, 0x72213478U, 0xA965B311U, 0xE059CE36U,
+        0x583BCFE8U, 0x1107B2CFU, 0xCA4335A6U, 0x837F4881U, 0x79264D85U, 0x301A30A2U, 0xEB5EB7CBU, 0xA262CAECU,
+        0x9E76C286U, 0xD74ABFA1U, 0x0C0E38C8U, 0x453245EFU, 0xBF6B40EBU, 0xF6573DCCU, 0x2D13BAA5U, 0x642FC782U,
+        0xDC4DC65CU, 0x9571BB7BU, 0x4E353C12U, 0x07094135U, 0xFD504431U, 0xB46C3916U, 0x6F28BE7FU, 0x2614C358U,
+        0x1700AEABU, 0x5E3CD38CU, 0x857854E5U, 0xCC4429C2U, 0x361D2CC6U, 0x7F2151E1U, 0xA465D688U, 0xED59ABAFU,
+        0x553BAA71U, 0x1C07D756U, 0xC743503FU, 0x8E7F2D18U, 0x7426281CU, 0x3D1A553BU, 0xE65ED252U, 0xAF62AF75U,
+        0x9376A71FU, 0xDA4ADA38U, 0x010E5D51U, 0x48322076U, 0xB26B2572U, 0xFB575855U, 0x2013DF3CU, 0x692FA21BU,
+        0xD14DA3C5U, 0x9871DEE2U, 0x4335598BU, 0x0A0924ACU, 0xF05021A8U, 0xB96C5C8FU, 0x6228DBE6U, 0x2B14A6C1U,
+        0x34019664U, 0x7D3DEB43U, 0xA6796C2AU, 0xEF45110DU, 0x151C1409U, 0x5C20692EU, 0x8764EE47U, 0xCE589360U,
+        0x763A92BEU, 0x3F06EF99U, 0xE44268F0U, 0xAD7E15D7U, 0x572710D3U, 0x1E1B6DF4U, 0xC55FEA9DU, 0x8C6397BAU,
+        0xB0779FD0U, 0xF94BE2F7U, 0x220F659EU, 0x6B3318B9U, 0x916A1DBDU, 0xD856609AU, 0x0312E7F3U, 0x4A2E9AD4U,
+        0xF24C9B0AU, 0xBB70E62DU, 0x60346144U, 0x29081C63U, 0xD3511967U, 0x9A6D6440U, 0x4129E329U, 0x08159E0EU,
+        0x3901F3FDU, 0x703D8EDAU, 0xAB7909B3U, 0xE2457494U, 0x181C7190U, 0x51200CB7U, 0x8A648BDEU, 0xC358F6F9U,
+        0x7B3AF727U, 0x32068A00U, 0xE9420D69U, 0xA07E704EU, 0x5A27754AU, 0x131B086DU, 0xC85F8F04U, 0x8163F223U,
+        0xBD77FA49U, 0xF44B876EU, 0x2F0F0007U, 0x66337D20U, 0x9C6A7824U, 0xD5560503U, 0x0E12826AU, 0x472EFF4DU,
+        0xFF4CFE93U, 0xB67083B4U, 0x6D3404DDU, 0x240879FAU, 0xDE517CFEU, 0x976D01D9U, 0x4C2986B0U, 0x0515FB97U,
+        0x2E015D56U, 0x673D2071U, 0xBC79A718U, 0xF545DA3FU, 0x0F1CDF3BU, 0x4620A21CU, 0x9D642575U, 0xD4585852U,
+        0x6C3A598CU, 0x250624ABU, 0xFE42A3C2U, 0xB77EDEE5U, 0x4D27DBE1U, 0x041BA6C6U, 0xDF5F21AFU, 0x96635C88U,
+        0xAA7754E2U, 0xE34B29C5U, 0x380FAEACU, 0x7133D38BU, 0x8B6AD68FU, 0xC256ABA8U, 0x19122CC1U, 0x502E51E6U,
+        0xE84C5038U, 0xA1702D1FU, 0x7A34AA76U, 0x3308D751U, 0xC951D255U, 0x806DAF72U, 0x5B29281BU, 0x1215553CU,
+        0x230138CFU, 0x6A3D45E8U, 0xB179C281U, 0xF845BFA6U, 0x021CBAA2U, 0x4B20C785U, 0x906440ECU, 0xD9583DCBU,
+        0x613A3C15U, 0x28064132U, 0xF342C65BU, 0xBA7EBB7CU, 0x4027BE78U, 0x091BC35FU, 0xD25F4436U, 0x9B633911U,
+        0xA777317BU, 0xEE4B4C5CU, 0x350FCB35U, 0x7C33B612U, 0x866AB316U, 0xCF56CE31U, 0x14124958U, 0x5D2E347FU,
+        0xE54C35A1U, 0xAC704886U, 0x7734CFEFU, 0x3E08B2C8U, 0xC451B7CCU, 0x8D6DCAEBU, 0x56294D82U, 0x1F1530A5U
+    }
+};
+
+/* Width 32, polynomial 0x04C11DB7, MSB first, top-aligned */
+static const uint32_t crcTableMpeg2[8][256] =
+{
+    {
+        0x00000000U, 0x04C11DB7U, 0x09823B6EU, 0x0D4326D9U, 0x130476DCU, 0x17C56B6BU, 0x1A864DB2U, 0x1E475005U,
+        0x2608EDB8U, 0x22C9F00FU, 0x2F8AD6D6U, 0x2B4BCB61U, 0x350C9B64U, 0x31CD86D3U, 0x3C8EA00AU, 0x384FBDBDU,
+        0x4C11DB70U, 0x48D0C6C7U, 0x4593E01EU, 0x4152FDA9U, 0x5F15ADACU, 0x5BD4B01BU, 0x569796C2U, 0x52568B75U,
+        0x6A1936C8U, 0x6ED82B7FU, 0x639B0DA6U, 0x675A1011U, 0x791D4014U, 0x7DDC5DA3U, 0x709F7B7AU, 0x745E66CDU,
+        0x9823B6E0U, 0x9CE2AB57U, 0x91A18D8EU, 0x95609039U, 0x8B27C03CU, 0x8FE6DD8BU, 0x82A5FB52U, 0x8664E6E5U,
+        0xBE2B5B58U, 0xBAEA46EFU, 0xB7A96036U, 0xB3687D81U, 0xAD2F2D84U, 0xA9EE3033U, 0xA4AD16EAU, 0xA06C0B5DU,
+        0xD4326D90U, 0xD0F37027U, 0xDDB056FEU, 0xD9714B49U, 0xC7361B4CU, 0xC3F706FBU, 0xCEB42022U, 0xCA753D95U,
+        0xF23A8028U, 0xF6FB9D9FU, 0xFBB8BB46U, 0xFF79A6F1U, 0xE13EF6F4U, 0xE5FFEB43U, 0xE8BCCD9AU, 0xEC7DD02DU,
+        0x34867077U, 0x30476DC0U, 0x3D044B19U, 0x39C556AEU, 0x278206ABU, 0x23431B1CU, 0x2E003DC5U, 0x2AC12072U,
+        0x128E9DCFU, 0x164F8078U, 0x1B0CA6A1U, 0x1FCDBB16U, 0x018AEB13U, 0x054BF6A4U, 0x0808D07DU, 0x0CC9CDCAU,
+        0x7897AB07U, 0x7C56B6B0U, 0x71159069U, 0x75D48DDEU, 0x6B93DDDBU, 0x6F52C06CU, 0x6211E6B5U, 0x66D0FB02U,
+        0x5E9F46BFU, 0x5A5E5B08U, 0x571D7DD1U, 0x53DC6066U, 0x4D9B3063U, 0x495A2DD4U, 0x44190B0DU, 0x40D816BAU,
+        0xACA5C697U, 0xA864DB20U, 0xA527FDF9U, 0xA1E6E04EU, 0xBFA1B04BU, 0xBB60ADFCU, 0xB6238B25U, 0xB2E29692U,
+        0x8AAD2B2FU, 0x8E6C3698U, 0x832F1041U, 0x87EE0DF6U, 0x99A95DF3U, 0x9D684044U, 0x902B669DU, 0x94EA7B2AU,
+        0xE0B41DE7U, 0xE4750050U, 0xE9362689U, 0xEDF73B3EU, 0xF3B06B3BU, 0xF771768CU, 0xFA325055U, 0xFEF34DE2U,
+        0xC6BCF05FU, 0xC27DEDE8U, 0xCF3ECB31U, 0xCBFFD686U, 0xD5B88683U, 0xD1799B34U, 0xDC3ABDEDU, 0xD8FBA05AU,
+        0x690CE0EEU, 0x6DCDFD59U, 0x608EDB80U, 0x644FC637U, 0x7A089632U, 0x7EC98B85U, 0x738AAD5CU, 0x774BB0EBU,
+        0x4F040D56U, 0x4BC510E1U, 0x46863638U, 0x42472B8FU, 0x5C007B8AU, 0x58C1663DU, 0x558240E4U, 0x51435D53U,
+        0x251D3B9EU, 0x21DC2629U, 0x2C9F00F0U, 0x285E1D47U, 0x36194D42U, 0x32D850F5U, 0x3F9B762CU, 0x3B5A6B9BU,
+        0x0315D626U, 0x07D4CB91U, 0x0A97ED48U, 0x0E56F0FFU, 0x1011A0FAU, 0x14D0BD4DU, 0x19939B94U, 0x1D528623U,
+        0xF12F560EU, 0xF5EE4BB9U, 0xF8AD6D60U, 0xFC6C70D7U, 0xE22B20D2U, 0xE6EA3D65U, 0xEBA91BBCU, 0xEF68060BU,
+        0xD727BBB6U, 0xD3E6A601U, 0xDEA580D8U, 0xDA649D6FU, 0xC423CD6AU, 0xC0E2D0DDU, 0xCDA1F604U, 0xC960EBB3U,
+        0xBD3E8D7EU, 0xB9FF90C9U, 0xB4BCB610U, 0xB07DABA7U, 0xAE3AFBA2U, 0xAAFBE615U, 0xA7B8C0CCU, 0xA379DD7BU,
+        0x9B3660C6U, 0x9FF77D71U, 0x92B45BA8U, 0x9675461FU, 0x8832161AU, 0x8CF30BADU, 0x81B02D74U, 0x857130C3U,
+        0x5D8A9099U, 0x594B8D2EU, 0x5408ABF7U, 0x50C9B640U, 0x4E8EE645U, 0x4A4FFBF2U, 0x470CDD2BU, 0x43CDC09CU,
+        0x7B827D21U, 0x7F436096U, 0x7200464FU, 0x76C15BF8U, 0x68860BFDU, 0x6C47164AU, 0x61043093U, 0x65C52D24U,
+        0x119B4BE9U, 0x155A565EU, 0x18197087U, 0x1CD86D30U, 0x029F3D35U, 0x065E2082U, 0x0B1D065BU, 0x0FDC1BECU,
+        0x3793A651U, 0x3352BBE6U, 0x3E119D3FU, 0x3AD08088U, 0x2497D08DU, 0x2056CD3AU, 0x2D15EBE3U, 0x29D4F654U,
+        0xC5A92679U, 0xC1683BCEU, 0xCC2B1D17U, 0xC8EA00A0U, 0xD6AD50A5U, 0xD26C4D12U, 0xDF2F6BCBU, 0xDBEE767CU,
+        0xE3A1CBC1U, 0xE760D676U, 0xEA23F0AFU, 0xEEE2ED18U, 0xF0A5BD1DU, 0xF464A0AAU, 0xF9278673U, 0xFDE69BC4U,
+        0x89B8FD09U, 0x8D79E0BEU, 0x803AC667U, 0x84FBDBD0U, 0x9ABC8BD5U, 0x9E7D9662U, 0x933EB0BBU, 0x97FFAD0CU,
+        0xAFB010B1U, 0xAB710D06U, 0xA6322BDFU, 0xA2F33668U, 0xBCB4666DU, 0xB8757BDAU, 0xB5365D03U, 0xB1F740B4U
+    },
+    {
+        0x00000000U, 0xD219C1DCU, 0xA0F29E0FU, 0x72EB5FD3U, 0x452421A9U, 0x973DE075U, 0xE5D6BFA6U, 0x37CF7E7AU,
+        0x8A484352U, 0x5851828EU, 0x2ABADD5DU, 0xF8A31C81U, 0xCF6C62FBU, 0x1D75A327U, 0x6F9EFCF4U, 0xBD873D28U,
+        0x10519B13U, 0xC2485ACFU, 0xB0A3051CU, 0x62BAC4C0U, 0x5575BABAU, 0x876C7B66U, 0xF58724B5U, 0x279EE569U,
+        0x9A19D841U, 0x4800199DU, 0x3AEB464EU, 0xE8F28792U, 0xDF3DF9E8U, 0x0D243834U, 0x7FCF67E7U, 0xADD6A63BU,
+        0x20A33626U, 0xF2BAF7FAU, 0x8051A829U, 0x524869F5U, 0x6587178FU, 0xB79ED653U, 0xC5758980U, 0x176C485CU,
+        0xAAEB7574U, 0x78F2B4A8U, 0x0A19EB7BU, 0xD8002AA7U, 0xEFCF54DDU, 0x3DD69501U, 0x4F3DCAD2U, 0x9D240B0EU,
+        0x30F2AD35U, 0xE2EB6CE9U, 0x9000333AU, 0x4219F2E6U, 0x75D68C9CU, 0xA7CF4D40U, 0xD5241293U, 0x073DD34FU,
+        0xBABAEE67U, 0x68A32FBBU, 0x1A487068U, 0xC851B1B4U, 0xFF9ECFCEU, 0x2D870E12U, 0x5F6C51C1U, 0x8D75901DU,
+        0x41466C4CU, 0x935FAD90U, 0xE1B4F243U, 0x33AD339FU, 0x04624DE5U, 0xD67B8C39U, 0xA490D3EAU, 0x76891236U,
+        0xCB0E2F1EU, 0x1917EEC2U, 0x6BFCB111U, 0xB9E570CDU, 0x8E2A0EB7U, 0x5C33CF6BU, 0x2ED890B8U, 0xFCC15164U,
+        0x5117F75FU, 0x830E3683U, 0xF1E56950U, 0x23FCA88CU, 0x1433D6F6U, 0xC62A172AU, 0xB4C148F9U, 0x66D88925U,
+        0xDB5FB40DU, 0x094675D1U, 0x7BAD2A02U, 0xA9B4EBDEU, 0x9E7B95A4U, 0x4C625478U, 0x3E890BABU, 0xEC90CA77U,
+        0x61E55A6AU, 0xB3FC9BB6U, 0xC117C465U, 0x130E05B9U, 0x24C17BC3U, 0xF6D8BA1FU, 0x8433E5CCU, 0x562A2410U,
+        0xEBAD1938U, 0x39B4D8E4U, 0x4B5F8737U, 0x994646EBU, 0xAE893891U, 0x7C90F94DU, 0x0E7BA69EU, 0xDC626742U,
+        0x71B4C179U, 0xA3AD00A5U, 0xD1465F76U, 0x035F9EAAU, 0x3490E0D0U, 0xE689210CU, 0x94627EDFU, 0x467BBF03U,
+        0xFBFC822BU, 0x29E543F7U, 0x5B0E1C24U, 0x8917DDF8U, 0xBED8A382U, 0x6CC1625EU, 0x1E2A3D8DU, 0xCC33FC51U,
+        0x828CD898U, 0x50951944U, 0x227E4697U, 0xF067874BU, 0xC7A8F931U, 0x15B138EDU, 0x675A673EU, 0xB543A6E2U,
+        0x08C49BCAU, 0xDADD5A16U, 0xA83605C5U, 0x7A2FC419U, 0x4DE0BA63U, 0x9FF97BBFU, 0xED12246CU, 0x3F0BE5B0U,
+        0x92DD438BU, 0x40C48257U, 0x322FDD84U, 0xE0361C58U, 0xD7F96222U, 0x05E0A3FEU, 0x770BFC2DU, 0xA5123DF1U,
+        0x189500D9U, 0xCA8CC105U, 0xB8679ED6U, 0x6A7E5F0AU, 0x5DB12170U, 0x8FA8E0ACU, 0xFD43BF7FU, 0x2F5A7EA3U,
+        0xA22FEEBEU, 0x70362F62U, 0x02DD70B1U, 0xD0C4B16DU, 0xE70BCF17U, 0x35120ECBU, 0x47F95118U, 0x95E090C4U,
+        0x2867ADECU, 0xFA7E6C30U, 0x889533E3U, 0x5A8CF23FU, 0x6D438C45U, 0xBF5A4D99U, 0xCDB1124AU, 0x1FA8D396U,
+        0xB27E75ADU, 0x6067B471U, 0x128CEBA2U, 0xC0952A7EU, 0xF75A5404U, 0x254395D8U, 0x57A8CA0BU, 0x85B10BD7U,
+        0x383636FFU, 0xEA2FF723U, 0x98C4A8F0U, 0x4ADD692CU, 0x7D121756U, 0xAF0BD68AU, 0xDDE08959U, 0x0FF94885U,
+        0xC3CAB4D4U, 0x11D37508U, 0x63382ADBU, 0xB121EB07U, 0x86EE957DU, 0x54F754A1U, 0x261C0B72U, 0xF405CAAEU,
+        0x4982F786U, 0x9B9B365AU, 0xE9706989U, 0x3B69A855U, 0x0CA6D62FU, 0xDEBF17F3U, 0xAC544820U, 0x7E4D89FCU,
+        0xD39B2FC7U, 0x0182EE1BU, 0x7369B1C8U, 0xA1707014U, 0x96BF0E6EU, 0x44A6CFB2U, 0x364D9061U, 0xE45451BDU,
+        0x59D36C95U, 0x8BCAAD49U, 0xF921F29AU, 0x2B383346U, 0x1CF74D3CU, 0xCEEE8CE0U, 0xBC05D333U, 0x6E1C12EFU,
+        0xE36982F2U, 0x3170432EU, 0x439B1CFDU, 0x9182DD21U, 0xA64DA35BU, 0x74546287U, 0x06BF3D54U, 0xD4A6FC88U,
+        0x6921C1A0U, 0xBB38007CU, 0xC9D35FAFU, 0x1BCA9E73U, 0x2C05E009U, 0xFE1C21D5U, 0x8CF77E06U, 0x5EEEBFDAU,
+        0xF33819E1U, 0x2121D83DU, 0x53CA87EEU, 0x81D34632U, 0xB61C3848U, 0x6405F994U, 0x16EEA647U, 0xC4F7679BU,
+        0x79705AB3U, 0xAB699B6FU, 0xD982C4BCU, 0x0B9B0560U, 0x3C547B1AU, 0xEE4DBAC6U, 0x9CA6E515U, 0x4EBF24C9U
+    },
+    {
+        0x00000000U, 0x01D8AC87U, 0x03B1590EU, 0x0269F589U, 0x0762B21CU, 0x06BA1E9BU, 0x04D3EB12U, 0x050B4795U,
+        0x0EC56438U, 0x0F1DC8BFU, 0x0D743D36U, 0x0CAC91B1U, 0x09A7D624U, 0x087F7AA3U, 0x0A168F2AU, 0x0BCE23ADU,
+        0x1D8AC870U, 0x1C5264F7U, 0x1E3B917EU, 0x1FE33DF9U, 0x1AE87A6CU, 0x1B30D6EBU, 0x19592362U, 0x18818FE5U,
+        0x134FAC48U, 0x129700CFU, 0x10FEF546U, 0x112659C1U, 0x142D1E54U, 0x15F5B2D3U, 0x179C475AU, 0x1644EBDDU,
+        0x3B1590E0U, 0x3ACD3C67U, 0x38A4C9EEU, 0x397C6569U, 0x3C7722FCU, 0x3DAF8E7BU, 0x3FC67BF2U, 0x3E1ED775U,
+        0x35D0F4D8U, 0x3408585FU, 0x3661ADD6U, 0x37B90151U, 0x32B246C4U, 0x336AEA43U, 0x31031FCAU, 0x30DBB34DU,
+        0x269F5890U, 0x2747F417U, 0x252E019EU, 0x24F6AD19U, 0x21FDEA8CU, 0x2025460BU, 0x224CB382U, 0x23941F05U,
+        0x285A3CA8U, 0x2982902FU, 0x2BEB65A6U, 0x2A33C921U, 0x2F388EB4U, 0x2EE02233U, 0x2C89D7BAU, 0x2D517B3DU,
+        0x762B21C0U, 0x77F38D47U, 0x759A78CEU, 0x7442D449U, 0x714993DCU, 0x70913F5BU, 0x72F8CAD2U, 0x73206655U,
+        0x78EE45F8U, 0x7936E97FU, 0x7B5F1CF6U, 0x7A87B071U, 0x7F8CF7E4U, 0x7E545B63U, 0x7C3DAEEAU, 0x7DE5026DU,
+        0x6BA1E9B0U, 0x6A794537U, 0x6810B0BEU, 0x69C81C39U, 0x6CC35BACU, 0x6D1BF72BU, 0x6F7202A2U, 0x6EAAAE25U,
+        0x65648D88U, 0x64BC210FU, 0x66D5D486U, 0x670D7801U, 0x62063F94U, 0x63DE9313U, 0x61B7669AU, 0x606FCA1DU,
+        0x4D3EB120U, 0x4CE61DA7U, 0x4E8FE82EU, 0x4F5744A9U, 0x4A5C033CU, 0x4B84AFBBU, 0x49ED5A32U, 0x4835F6B5U,
+        0x43FBD518U, 0x4223799FU, 0x404A8C16U, 0x41922091U, 0x44996704U, 0x4541CB83U, 0x47283E0AU, 0x46F0928DU,
+        0x50B47950U, 0x516CD5D7U, 0x5305205EU, 0x52DD8CD9U, 0x57D6CB4CU, 0x560E67CBU, 0x54679242U, 0x55BF3EC5U,
+        0x5E711D68U, 0x5FA9B1EFU, 0x5DC04466U, 0x5C18E8E1U, 0x5913AF74U, 0x58CB03F3U, 0x5AA2F67AU, 0x5B7A5AFDU,
+        0xEC564380U, 0xED8EEF07U, 0xEFE71A8EU, 0xEE3FB609U, 0xEB34F19CU, 0xEAEC5D1BU, 0xE885A892U, 0xE95D0415U,
+        0xE29327B8U, 0xE34B8B3FU, 0xE1227EB6U, 0xE0FAD231U, 0xE5F195A4U, 0xE4293923U, 0xE640CCAAU, 0xE798602DU,
+        0xF1DC8BF0U, 0xF0042777U, 0xF26DD2FEU, 0xF3B57E79U, 0xF6BE39ECU, 0xF766956BU, 0xF50F60E2U, 0xF4D7CC65U,
+        0xFF19EFC8U, 0xFEC1434FU, 0xFCA8B6C6U, 0xFD701A41U, 0xF87B5DD4U, 0xF9A3F153U, 0xFBCA04DAU, 0xFA12A85DU,
+        0xD743D360U, 0xD69B7FE7U, 0xD4F28A6EU, 0xD52A26E9U, 0xD021617CU, 0xD1F9CDFBU, 0xD3903872U, 0xD24894F5U,
+        0xD986B758U, 0xD85E1BDFU, 0xDA37EE56U, 0xDBEF42D1U, 0xDEE40544U, 0xDF3CA9C3U, 0xDD555C4AU, 0xDC8DF0CDU,
+        0xCAC91B10U, 0xCB11B797U, 0xC978421EU, 0xC8A0EE99U, 0xCDABA90CU, 0xCC73058BU, 0xCE1AF002U, 0xCFC25C85U,
+        0xC40C7F28U, 0xC5D4D3AFU, 0xC7BD2626U, 0xC6658AA1U, 0xC36ECD34U, 0xC2B661B3U, 0xC0DF943AU, 0xC10738BDU,
+        0x9A7D6240U, 0x9BA5CEC7U, 0x99CC3B4EU, 0x981497C9U, 0x9D1FD05CU, 0x9CC77CDBU, 0x9EAE8952U, 0x9F7625D5U,
+        0x94B80678U, 0x9560AAFFU, 0x97095F76U, 0x96D1F3F1U, 0x93DAB464U, 0x920218E3U, 0x906BED6AU, 0x91B341EDU,
+        0x87F7AA30U, 0x862F06B7U, 0x8446F33EU, 0x859E5FB9U, 0x8095182CU, 0x814DB4ABU, 0x83244122U, 0x82FCEDA5U,
+        0x8932CE08U, 0x88EA628FU, 0x8A839706U, 0x8B5B3B81U, 0x8E507C14U, 0x8F88D093U, 0x8DE1251AU, 0x8C39899DU,
+        0xA168F2A0U, 0xA0B05E27U, 0xA2D9ABAEU, 0xA3010729U, 0xA60A40BCU, 0xA7D2EC3BU, 0xA5BB19B2U, 0xA463B535U,
+        0xAFAD9698U, 0xAE753A1FU, 0xAC1CCF96U, 0xADC46311U, 0xA8CF2484U, 0xA9178803U, 0xAB7E7D8AU, 0xAAA6D10DU,
+        0xBCE23AD0U, 0xBD3A9657U, 0xBF5363DEU, 0xBE8BCF59U, 0xBB8088CCU, 0xBA58244BU, 0xB831D1C2U, 0xB9E97D45U,
+        0xB2275EE8U, 0xB3FFF26FU, 0xB19607E6U, 0xB04EAB61U, 0xB545ECF4U, 0xB49D4073U, 0xB6F4B5FAU, 0xB72C197DU
+    },
+    {
+        0x00000000U, 0xDC6D9AB7U, 0xBC1A28D9U, 0x6077B26EU, 0x7CF54C05U, 0xA098D6B2U, 0xC0EF64DCU, 0x1C82FE6BU,
+        0xF9EA980AU, 0x258702BDU, 0x45F0B0D3U, 0x999D2A64U, 0x851FD40FU, 0x59724EB8U, 0x3905FCD6U, 0xE5686661U,
+        0xF7142DA3U, 0x2B79B714U, 0x4B0E057AU, 0x97639FCDU, 0x8BE161A6U, 0x578CFB11U, 0x37FB497FU, 0xEB96D3C8U,
+        0x0EFEB5A9U, 0xD2932F1EU, 0xB2E49D70U, 0x6E8907C7U, 0x720BF9ACU, 0xAE66631BU, 0xCE11D175U, 0x127C4BC2U,
+        0xEAE946F1U, 0x3684DC46U, 0x56F36E28U, 0x8A9EF49FU, 0x961C0AF4U, 0x4A719043U, 0x2A06222DU, 0xF66BB89AU,
+        0x1303DEFBU, 0xCF6E444CU, 0xAF19F622U, 0x73746C95U, 0x6FF692FEU, 0xB39B0849U, 0xD3ECBA27U, 0x0F812090U,
+        0x1DFD6B52U, 0xC190F1E5U, 0xA1E7438BU, 0x7D8AD93CU, 0x61082757U, 0xBD65BDE0U, 0xDD120F8EU, 0x017F9539U,
+        0xE417F358U, 0x387A69EFU, 0x580DDB81U, 0x84604136U, 0x98E2BF5DU, 0x448F25EAU, 0x24F89784U, 0xF8950D33U,
+        0xD1139055U, 0x0D7E0AE2U, 0x6D09B88CU, 0xB164223BU, 0xADE6DC50U, 0x718B46E7U, 0x11FCF489U, 0xCD916E3EU,
+        0x28F9085FU, 0xF49492E8U, 0x94E32086U, 0x488EBA31U, 0x540C445AU, 0x8861DEEDU, 0xE8166C83U, 0x347BF634U,
+        0x2607BDF6U, 0xFA6A2741U, 0x9A1D952FU, 0x46700F98U, 0x5AF2F1F3U, 0x869F6B44U, 0xE6E8D92AU, 0x3A85439DU,
+        0xDFED25FCU, 0x0380BF4BU, 0x63F70D25U, 0xBF9A9792U, 0xA31869F9U, 0x7F75F34EU, 0x1F024120U, 0xC36FDB97U,
+        0x3BFAD6A4U, 0xE7974C13U, 0x87E0FE7DU, 0x5B8D64CAU, 0x470F9AA1U, 0x9B620016U, 0xFB15B278U, 0x277828CFU,
+        0xC2104EAEU, 0x1E7DD419U, 0x7E0A6677U, 0xA267FCC0U, 0xBEE502ABU, 0x6288981CU, 0x02FF2A72U, 0xDE92B0C5U,
+        0xCCEEFB07U, 0x108361B0U, 0x70F4D3DEU, 0xAC994969U, 0xB01BB702U, 0x6C762DB5U, 0x0C019FDBU, 0xD06C056CU,
+        0x3504630DU, 0xE969F9BAU, 0x891E4BD4U, 0x5573D163U, 0x49F12F08U, 0x959CB5BFU, 0xF5EB07D1U, 0x29869D66U,
+        0xA6E63D1DU, 0x7A8BA7AAU, 0x1AFC15C4U, 0xC6918F73U, 0xDA137118U, 0x067EEBAFU, 0x660959C1U, 0xBA64C376U,
+        0x5F0CA517U, 0x83613FA0U, 0xE3168DCEU, 0x3F7B1779U, 0x23F9E912U, 0xFF9473A5U, 0x9FE3C1CBU, 0x438E5B7CU,
+        0x51F210BEU, 0x8D9F8A09U, 0xEDE83867U, 0x3185A2D0U, 0x2D075CBBU, 0xF16AC60CU, 0x911D7462U, 0x4D70EED5U,
+        0xA81888B4U, 0x74751203U, 0x1402A06DU, 0xC86F3ADAU, 0xD4EDC4B1U, 0x08805E06U, 0x68F7EC68U, 0xB49A76DFU,
+        0x4C0F7BECU, 0x9062E15BU, 0xF0155335U, 0x2C78C982U, 0x30FA37E9U, 0xEC97AD5EU, 0x8CE01F30U, 0x508D8587U,
+        0xB5E5E3E6U, 0x69887951U, 0x09FFCB3FU, 0xD5925188U, 0xC910AFE3U, 0x157D3554U, 0x750A873AU, 0xA9671D8DU,
+        0xBB1B564FU, 0x6776CCF8U, 0x07017E96U, 0xDB6CE421U, 0xC7EE1A4AU, 0x1B8380FDU, 0x7BF43293U, 0xA799A824U,
+        0x42F1CE45U, 0x9E9C54F2U, 0xFEEBE69CU, 0x22867C2BU, 0x3E048240U, 0xE26918F7U, 0x821EAA99U, 0x5E73302EU,
+        0x77F5AD48U, 0xAB9837FFU, 0xCBEF8591U, 0x17821F26U, 0x0B00E14DU, 0xD76D7BFAU, 0xB71AC994U, 0x6B775323U,
+        0x8E1F3542U, 0x5272AFF5U, 0x32051D9BU, 0xEE68872CU, 0xF2EA7947U, 0x2E87E3F0U, 0x4EF0519EU, 0x929DCB29U,
+        0x80E180EBU, 0x5C8C1A5CU, 0x3CFBA832U, 0xE0963285U, 0xFC14CCEEU, 0x20795659U, 0x400EE437U, 0x9C637E80U,
+        0x790B18E1U, 0xA5668256U, 0xC5113038U, 0x197CAA8FU, 0x05FE54E4U, 0xD993CE53U, 0xB9E47C3DU, 0x6589E68AU,
+        0x9D1CEBB9U, 0x4171710EU, 0x2106C360U, 0xFD6B59D7U, 0xE1E9A7BCU, 0x3D843D0BU, 0x5DF38F65U, 0x819E15D2U,
+        0x64F673B3U, 0xB89BE904U, 0xD8EC5B6AU, 0x0481C1DDU, 0x18033FB6U, 0xC46EA501U, 0xA419176FU, 0x78748DD8U,
+        0x6A08C61AU, 0xB6655CADU, 0xD612EEC3U, 0x0A7F7474U, 0x16FD8A1FU, 0xCA9010A8U, 0xAAE7A2C6U, 0x768A3871U,
+        0x93E25E10U, 0x4F8FC4A7U, 0x2FF876C9U, 0xF395EC7EU, 0xEF171215U, 0x337A88A2U, 0x530D3ACCU, 0x8F60A07BU
+    },
+    {
+        0x00000000U, 0x490D678DU, 0x921ACF1AU, 0xDB17A897U, 0x20F48383U, 0x69F9E40EU, 0xB2EE4C99U, 0xFBE32B14U,
+        0x41E90706U, 0x08E4608BU, 0xD3F3C81CU, 0x9AFEAF91U, 0x611D8485U, 0x2810E308U, 0xF3074B9FU, 0xBA0A2C12U,
+        0x83D20E0CU, 0xCADF6981U, 0x11C8C116U, 0x58C5A69BU, 0xA3268D8FU, 0xEA2BEA02U, 0x313C4295U, 0x78312518U,
+        0xC23B090AU, 0x8B366E87U, 0x5021C610U, 0x192CA19DU, 0xE2CF8A89U, 0xABC2ED04U, 0x70D54593U, 0x39D8221EU,
+        0x036501AFU, 0x4A686622U, 0x917FCEB5U, 0xD872A938U, 0x2391822CU, 0x6A9CE5A1U, 0xB18B4D36U, 0xF8862ABBU,
+        0x428C06A9U, 0x0B816124U, 0xD096C9B3U, 0x999BAE3EU, 0x6278852AU, 0x2B75E2A7U, 0xF0624A30U, 0xB96F2DBDU,
+        0x80B70FA3U, 0xC9BA682EU, 0x12ADC0B9U, 0x5BA0A734U, 0xA0438C20U, 0xE94EEBADU, 0x3259433AU, 0x7B5424B7U,
+        0xC15E08A5U, 0x88536F28U, 0x5344C7BFU, 0x1A49A032U, 0xE1AA8B26U, 0xA8A7ECABU, 0x73B0443CU, 0x3ABD23B1U,
+        0x06CA035EU, 0x4FC764D3U, 0x94D0CC44U, 0xDDDDABC9U, 0x263E80DDU, 0x6F33E750U, 0xB4244FC7U, 0xFD29284AU,
+        0x47230458U, 0x0E2E63D5U, 0xD539CB42U, 0x9C34ACCFU, 0x67D787DBU, 0x2EDAE056U, 0xF5CD48C1U, 0xBCC02F4CU,
+        0x85180D52U, 0xCC156ADFU, 0x1702C248U, 0x5E0FA5C5U, 0xA5EC8ED1U, 0xECE1E95CU, 0x37F641CBU, 0x7EFB2646U,
+        0xC4F10A54U, 0x8DFC6DD9U, 0x56EBC54EU, 0x1FE6A2C3U, 0xE40589D7U, 0xAD08EE5AU, 0x761F46CDU, 0x3F122140U,
+        0x05AF02F1U, 0x4CA2657CU, 0x97B5CDEBU, 0xDEB8AA66U, 0x255B8172U, 0x6C56E6FFU, 0xB7414E68U, 0xFE4C29E5U,
+        0x444605F7U, 0x0D4B627AU, 0xD65CCAEDU, 0x9F51AD60U, 0x64B28674U, 0x2DBFE1F9U, 0xF6A8496EU, 0xBFA52EE3U,
+        0x867D0CFDU, 0xCF706B70U, 0x1467C3E7U, 0x5D6AA46AU, 0xA6898F7EU, 0xEF84E8F3U, 0x34934064U, 0x7D9E27E9U,
+        0xC7940BFBU, 0x8E996C76U, 0x558EC4E1U, 0x1C83A36CU, 0xE7608878U, 0xAE6DEFF5U, 0x757A4762U, 0x3C7720EFU,
+        0x0D9406BCU, 0x44996131U, 0x9F8EC9A6U, 0xD683AE2BU, 0x2D60853FU, 0x646DE2B2U, 0xBF7A4A25U, 0xF6772DA8U,
+        0x4C7D01BAU, 0x05706637U, 0xDE67CEA0U, 0x976AA92DU, 0x6C898239U, 0x2584E5B4U, 0xFE934D23U, 0xB79E2AAEU,
+        0x8E4608B0U, 0xC74B6F3DU, 0x1C5CC7AAU, 0x5551A027U, 0xAEB28B33U, 0xE7BFECBEU, 0x3CA84429U, 0x75A523A4U,
+        0xCFAF0FB6U, 0x86A2683BU, 0x5DB5C0ACU, 0x14B8A721U, 0xEF5B8C35U, 0xA656EBB8U, 0x7D41432FU, 0x344C24A2U,
+        0x0EF10713U, 0x47FC609EU, 0x9CEBC809U, 0xD5E6AF84U, 0x2E058490U, 0x6708E31DU, 0xBC1F4B8AU, 0xF5122C07U,
+        0x4F180015U, 0x06156798U, 0xDD02CF0FU, 0x940FA882U, 0x6FEC8396U, 0x26E1E41BU, 0xFDF64C8CU, 0xB4FB2B01U,
+        0x8D23091FU, 0xC42E6E92U, 0x1F39C605U, 0x5634A188U, 0xADD78A9CU, 0xE4DAED11U, 0x3FCD4586U, 0x76C0220BU,
+        0xCCCA0E19U, 0x85C76994U, 0x5ED0C103U, 0x17DDA68EU, 0xEC3E8D9AU, 0xA533EA17U, 0x7E244280U, 0x3729250DU,
+        0x0B5E05E2U, 0x4253626FU, 0x9944CAF8U, 0xD049AD75U, 0x2BAA8661U, 0x62A7E1ECU, 0xB9B0497BU, 0xF0BD2EF6U,
+        0x4AB702E4U, 0x03BA6569U, 0xD8ADCDFEU, 0x91A0AA73U, 0x6A438167U, 0x234EE6EAU, 0xF8594E7DU, 0xB15429F0U,
+        0x888C0BEEU, 0xC1816C63U, 0x1A96C4F4U, 0x539BA379U, 0xA878886DU, 0xE175EFE0U, 0x3A624777U, 0x736F20FAU,
+        0xC9650CE8U, 0x80686B65U, 0x5B7FC3F2U, 0x1272A47FU, 0xE9918F6BU, 0xA09CE8E6U, 0x7B8B4071U, 0x328627FCU,
+        0x083B044DU, 0x413663C0U, 0x9A21CB57U, 0xD32CACDAU, 0x28CF87CEU, 0x61C2E043U, 0xBAD548D4U, 0xF3D82F59U,
+        0x49D2034BU, 0x00DF64C6U, 0xDBC8CC51U, 0x92C5ABDCU, 0x692680C8U, 0x202BE745U, 0xFB3C4FD2U, 0xB231285FU,
+        0x8BE90A41U, 0xC2E46DCCU, 0x19F3C55BU, 0x50FEA2D6U, 0xAB1D89C2U, 0xE210EE4FU, 0x390746D8U, 0x700A2155U,
+        0xCA000D47U, 0x830D6ACAU, 0x581AC25DU, 0x1117A5D0U, 0xEAF48EC4U, 0xA3F9E949U, 0x78EE41DEU, 0x31E32653U
+    },
+    {
+        0x00000000U, 0x1B280D78U, 0x36501AF0U, 0x2D781788U, 0x6CA035E0U, 0x77883898U, 0x5AF02F10U, 0x41D82268U,
+        0xD9406BC0U, 0xC26866B8U, 0xEF107130U, 0xF4387C48U, 0xB5E05E20U, 0xAEC85358U, 0x83B044D0U, 0x989849A8U,
+        0xB641CA37U, 0xAD69C74FU, 0x8011D0C7U, 0x9B39DDBFU, 0xDAE1FFD7U, 0xC1C9F2AFU, 0xECB1E527U, 0xF799E85FU,
+        0x6F01A1F7U, 0x7429AC8FU, 0x5951BB07U, 0x4279B67FU, 0x03A19417U, 0x1889996FU, 0x35F18EE7U, 0x2ED9839FU,
+        0x684289D9U, 0x736A84A1U, 0x5E129329U, 0x453A9E51U, 0x04E2BC39U, 0x1FCAB141U, 0x32B2A6C9U, 0x299AABB1U,
+        0xB102E219U, 0xAA2AEF61U, 0x8752F8E9U, 0x9C7AF591U, 0xDDA2D7F9U, 0xC68ADA81U, 0xEBF2CD09U, 0xF0DAC071U,
+        0xDE0343EEU, 0xC52B4E96U, 0xE853591EU, 0xF37B5466U, 0xB2A3760EU, 0xA98B7B76U, 0x84F36CFEU, 0x9FDB6186U,
+        0x0743282EU, 0x1C6B2556U, 0x311332DEU, 0x2A3B3FA6U, 0x6BE31DCEU, 0x70CB10B6U, 0x5DB3073EU, 0x469B0A46U,
+        0xD08513B2U, 0xCBAD1ECAU, 0xE6D50942U, 0xFDFD043AU, 0xBC252652U, 0xA70D2B2AU, 0x8A753CA2U, 0x915D31DAU,
+        0x09C57872U, 0x12ED750AU, 0x3F956282U, 0x24BD6FFAU, 0x65654D92U, 0x7E4D40EAU, 0x53355762U, 0x481D5A1AU,
+        0x66C4D985U, 0x7DECD4FDU, 0x5094C375U, 0x4BBCCE0DU, 0x0A64EC65U, 0x114CE11DU, 0x3C34F695U, 0x271CFBEDU,
+        0xBF84B245U, 0xA4ACBF3DU, 0x89D4A8B5U, 0x92FCA5CDU, 0xD32487A5U, 0xC80C8ADDU, 0xE5749D55U, 0xFE5C902DU,
+        0xB8C79A6BU, 0xA3EF9713U, 0x8E97809BU, 0x95BF8DE3U, 0xD467AF8BU, 0xCF4FA2F3U, 0xE237B57BU, 0xF91FB803U,
+        0x6187F1ABU, 0x7AAFFCD3U, 0x57D7EB5BU, 0x4CFFE623U, 0x0D27C44BU, 0x160FC933U, 0x3B77DEBBU, 0x205FD3C3U,
+        0x0E86505CU, 0x15AE5D24U, 0x38D64AACU, 0x23FE47D4U, 0x622665BCU, 0x790E68C4U, 0x54767F4CU, 0x4F5E7234U,
+        0xD7C63B9CU, 0xCCEE36E4U, 0xE196216CU, 0xFABE2C14U, 0xBB660E7CU, 0xA04E0304U, 0x8D36148CU, 0x961E19F4U,
+        0xA5CB3AD3U, 0xBEE337ABU, 0x939B2023U, 0x88B32D5BU, 0xC96B0F33U, 0xD243024BU, 0xFF3B15C3U, 0xE41318BBU,
+        0x7C8B5113U, 0x67A35C6BU, 0x4ADB4BE3U, 0x51F3469BU, 0x102B64F3U, 0x0B03698BU, 0x267B7E03U, 0x3D53737BU,
+        0x138AF0E4U, 0x08A2FD9CU, 0x25DAEA14U, 0x3EF2E76CU, 0x7F2AC504U, 0x6402C87CU, 0x497ADFF4U, 0x5252D28CU,
+        0xCACA9B24U, 0xD1E2965CU, 0xFC9A81D4U, 0xE7B28CACU, 0xA66AAEC4U, 0xBD42A3BCU, 0x903AB434U, 0x8B12B94CU,
+        0xCD89B30AU, 0xD6A1BE72U, 0xFBD9A9FAU, 0xE0F1A482U, 0xA12986EAU, 0xBA018B92U, 0x97799C1AU, 0x8C519162U,
+        0x14C9D8CAU, 0x0FE1D5B2U, 0x2299C23AU, 0x39B1CF42U, 0x7869ED2AU, 0x6341E052U, 0x4E39F7DAU, 0x5511FAA2U,
+        0x7BC8793DU, 0x60E07445U, 0x4D9863CDU, 0x56B06EB5U, 0x17684CDDU, 0x0C4041A5U, 0x2138562DU, 0x3A105B55U,
+        0xA28812FDU, 0xB9A01F85U, 0x94D8080DU, 0x8FF00575U, 0xCE28271DU, 0xD5002A65U, 0xF8783DEDU, 0xE3503095U,
+        0x754E2961U, 0x6E662419U, 0x431E3391U, 0x58363EE9U, 0x19EE1C81U, 0x02C611F9U, 0x2FBE0671U, 0x34960B09U,
+        0xAC0E42A1U, 0xB7264FD9U, 0x9A5E5851U, 0x81765529U, 0xC0AE7741U, 0xDB867A39U, 0xF6FE6DB1U, 0xEDD660C9U,
+        0xC30FE356U, 0xD827EE2EU, 0xF55FF9A6U, 0xEE77F4DEU, 0xAFAFD6B6U, 0xB487DBCEU, 0x99FFCC46U, 0x82D7C13EU,
+        0x1A4F8896U, 0x016785EEU, 0x2C1F9266U, 0x37379F1EU, 0x76EFBD76U, 0x6DC7B00EU, 0x40BFA786U, 0x5B97AAFEU,
+        0x1D0CA0B8U, 0x0624ADC0U, 0x2B5CBA48U, 0x3074B730U, 0x71AC9558U, 0x6A849820U, 0x47FC8FA8U, 0x5CD482D0U,
+        0xC44CCB78U, 0xDF64C600U, 0xF21CD188U, 0xE934DCF0U, 0xA8ECFE98U, 0xB3C4F3E0U, 0x9EBCE468U, 0x8594E910U,
+        0xAB4D6A8FU, 0xB06567F7U, 0x9D1D707FU, 0x86357D07U, 0xC7ED5F6FU, 0xDCC55217U, 0xF1BD459FU, 0xEA9548E7U,
+        0x720D014FU, 0x69250C37U, 0x445D1BBFU, 0x5F7516C7U, 0x1EAD34AFU, 0x058539D7U, 0x28FD2E5FU, 0x33D52327U
+    },
+    {
+        0x00000000U, 0x4F576811U, 0x9EAED022U, 0xD1F9B833U, 0x399CBDF3U, 0x76CBD5E2U, 0xA7326DD1U, 0xE86505C0U,
+        0x73397BE6U, 0x3C6E13F7U, 0xED97ABC4U, 0xA2C0C3D5U, 0x4AA5C615U, 0x05F2AE04U, 0xD40B1637U, 0x9B5C7E26U,
+        0xE672F7CCU, 0xA9259FDDU, 0x78DC27EEU, 0x378B4FFFU, 0xDFEE4A3FU, 0x90B9222EU, 0x41409A1DU, 0x0E17F20CU,
+        0x954B8C2AU, 0xDA1CE43BU, 0x0BE55C08U, 0x44B23419U, 0xACD731D9U, 0xE38059C8U, 0x3279E1FBU, 0x7D2E89EAU,
+        0xC824F22FU, 0x87739A3EU, 0x568A220DU, 0x19DD4A1CU, 0xF1B84FDCU, 0xBEEF27CDU, 0x6F169FFEU, 0x2041F7EFU,
+        0xBB1D89C9U, 0xF44AE1D8U, 0x25B359EBU, 0x6AE431FAU, 0x8281343AU, 0xCDD65C2BU, 0x1C2FE418U, 0x53788C09U,
+        0x2E5605E3U, 0x61016DF2U, 0xB0F8D5C1U, 0xFFAFBDD0U, 0x17CAB810U, 0x589DD001U, 0x89646832U, 0xC6330023U,
+        0x5D6F7E05U, 0x12381614U, 0xC3C1AE27U, 0x8C96C636U, 0x64F3C3F6U, 0x2BA4ABE7U, 0xFA5D13D4U, 0xB50A7BC5U,
+        0x9488F9E9U, 0xDBDF91F8U, 0x0A2629CBU, 0x457141DAU, 0xAD14441AU, 0xE2432C0BU, 0x33BA9438U, 0x7CEDFC29U,
+        0xE7B1820FU, 0xA8E6EA1EU, 0x791F522DU, 0x36483A3CU, 0xDE2D3FFCU, 0x917A57EDU, 0x4083EFDEU, 0x0FD487CFU,
+        0x72FA0E25U, 0x3DAD6634U, 0xEC54DE07U, 0xA303B616U, 0x4B66B3D6U, 0x0431DBC7U, 0xD5C863F4U, 0x9A9F0BE5U,
+        0x01C375C3U, 0x4E941DD2U, 0x9F6DA5E1U, 0xD03ACDF0U, 0x385FC830U, 0x7708A021U, 0xA6F11812U, 0xE9A67003U,
+        0x5CAC0BC6U, 0x13FB63D7U, 0xC202DBE4U, 0x8D55B3F5U, 0x6530B635U, 0x2A67DE24U, 0xFB9E6617U, 0xB4C90E06U,
+        0x2F957020U, 0x60C21831U, 0xB13BA002U, 0xFE6CC813U, 0x1609CDD3U, 0x595EA5C2U, 0x88A71DF1U, 0xC7F075E0U,
+        0xBADEFC0AU, 0xF589941BU, 0x24702C28U, 0x6B274439U, 0x834241F9U, 0xCC1529E8U, 0x1DEC91DBU, 0x52BBF9CAU,
+        0xC9E787ECU, 0x86B0EFFDU, 0x574957CEU, 0x181E3FDFU, 0xF07B3A1FU, 0xBF2C520EU, 0x6ED5EA3DU, 0x2182822CU,
+        0x2DD0EE65U, 0x62878674U, 0xB37E3E47U, 0xFC295656U, 0x144C5396U, 0x5B1B3B87U, 0x8AE283B4U, 0xC5B5EBA5U,
+        0x5EE99583U, 0x11BEFD92U, 0xC04745A1U, 0x8F102DB0U, 0x67752870U, 0x28224061U, 0xF9DBF852U, 0xB68C9043U,
+        0xCBA219A9U, 0x84F571B8U, 0x550CC98BU, 0x1A5BA19AU, 0xF23EA45AU, 0xBD69CC4BU, 0x6C907478U, 0x23C71C69U,
+        0xB89B624FU, 0xF7CC0A5EU, 0x2635B26DU, 0x6962DA7CU, 0x8107DFBCU, 0xCE50B7ADU, 0x1FA90F9EU, 0x50FE678FU,
+        0xE5F41C4AU, 0xAAA3745BU, 0x7B5ACC68U, 0x340DA479U, 0xDC68A1B9U, 0x933FC9A8U, 0x42C6719BU, 0x0D91198AU,
+        0x96CD67ACU, 0xD99A0FBDU, 0x0863B78EU, 0x4734DF9FU, 0xAF51DA5FU, 0xE006B24EU, 0x31FF0A7DU, 0x7EA8626CU,
+        0x0386EB86U, 0x4CD18397U, 0x9D283BA4U, 0xD27F53B5U, 0x3A1A5675U, 0x754D3E64U, 0xA4B48657U, 0xEBE3EE46U,
+        0x70BF9060U, 0x3FE8F871U, 0xEE114042U, 0xA1462853U, 0x49232D93U, 0x06744582U, 0xD78DFDB1U, 0x98DA95A0U,
+        0xB958178CU, 0xF60F7F9DU, 0x27F6C7AEU, 0x68A1AFBFU, 0x80C4AA7FU, 0xCF93C26EU, 0x1E6A7A5DU, 0x513D124CU,
+        0xCA616C6AU, 0x8536047BU, 0x54CFBC48U, 0x1B98D459U, 0xF3FDD199U, 0xBCAAB988U, 0x6D5301BBU, 0x220469AAU,
+        0x5F2AE040U, 0x107D8851U, 0xC1843062U, 0x8ED35873U, 0x66B65DB3U, 0x29E135A2U, 0xF8188D91U, 0xB74FE580U,
+        0x2C139BA6U, 0x6344F3B7U, 0xB2BD4B84U, 0xFDEA2395U, 0x158F2655U, 0x5AD84E44U, 0x8B21F677U, 0xC4769E66U,
+        0x717CE5A3U, 0x3E2B8DB2U, 0xEFD23581U, 0xA0855D90U, 0x48E05850U, 0x07B73041U, 0xD64E8872U, 0x9919E063U,
+        0x02459E45U, 0x4D12F654U, 0x9CEB4E67U, 0xD3BC2676U, 0x3BD923B6U, 0x748E4BA7U, 0xA577F394U, 0xEA209B85U,
+        0x970E126FU, 0xD8597A7EU, 0x09A0C24DU, 0x46F7AA5CU, 0xAE92AF9CU, 0xE1C5C78DU, 0x303C7FBEU, 0x7F6B17AFU,
+        0xE4376989U, 0xAB600198U, 0x7A99B9ABU, 0x35CED1BAU, 0xDDABD47AU, 0x92FCBC6BU, 0x43050458U, 0x0C526C49U
+    },
+    {
+        0x00000000U, 0x5BA1DCCAU, 0xB743B994U, 0xECE2655EU, 0x6A466E9FU, 0x31E7B255U, 0xDD05D70BU, 0x86A40BC1U,
+        0xD48CDD3EU, 0x8F2D01F4U, 0x63CF64AAU, 0x386EB860U, 0xBECAB3A1U, 0xE56B6F6BU, 0x09890A35U, 0x5228D6FFU,
+        0xADD8A7CBU, 0xF6797B01U, 0x1A9B1E5FU, 0x413AC295U, 0xC79EC954U, 0x9C3F159EU, 0x70DD70C0U, 0x2B7CAC0AU,
+        0x79547AF5U, 0x22F5A63FU, 0xCE17C361U, 0x95B61FABU, 0x1312146AU, 0x48B3C8A0U, 0xA451ADFEU, 0xFFF07134U,
+        0x5F705221U, 0x04D18EEBU, 0xE833EBB5U, 0xB392377FU, 0x35363CBEU, 0x6E97E074U, 0x8275852AU, 0xD9D459E0U,
+        0x8BFC8F1FU, 0xD05D53D5U, 0x3CBF368BU, 0x671EEA41U, 0xE1BAE180U, 0xBA1B3D4AU, 0x56F95814U, 0x0D5884DEU,
+        0xF2A8F5EAU, 0xA9092920U, 0x45EB4C7EU, 0x1E4A90B4U, 0x98EE9B75U, 0xC34F47BFU, 0x2FAD22E1U, 0x740CFE2BU,
+        0x262428D4U, 0x7D85F41EU, 0x91679140U, 0xCAC64D8AU, 0x4C62464BU, 0x17C39A81U, 0xFB21FFDFU, 0xA0802315U,
+        0xBEE0A442U, 0xE5417888U, 0x09A31DD6U, 0x5202C11CU, 0xD4A6CADDU, 0x8F071617U, 0x63E57349U, 0x3844AF83U,
+        0x6A6C797CU, 0x31CDA5B6U, 0xDD2FC0E8U, 0x868E1C22U, 0x002A17E3U, 0x5B8BCB29U, 0xB769AE77U, 0xECC872BDU,
+        0x13380389U, 0x4899DF43U, 0xA47BBA1DU, 0xFFDA66D7U, 0x797E6D16U, 0x22DFB1DCU, 0xCE3DD482U, 0x959C0848U,
+        0xC7B4DEB7U, 0x9C15027DU, 0x70F76723U, 0x2B56BBE9U, 0xADF2B028U, 0xF6536CE2U, 0x1AB109BCU, 0x4110D576U,
+        0xE190F663U, 0xBA312AA9U, 0x56D34FF7U, 0x0D72933DU, 0x8BD698FCU, 0xD0774436U, 0x3C952168U, 0x6734FDA2U,
+        0x351C2B5DU, 0x6EBDF797U, 0x825F92C9U, 0xD9FE4E03U, 0x5F5A45C2U, 0x04FB9908U, 0xE819FC56U, 0xB3B8209CU,
+        0x4C4851A8U, 0x17E98D62U, 0xFB0BE83CU, 0xA0AA34F6U, 0x260E3F37U, 0x7DAFE3FDU, 0x914D86A3U, 0xCAEC5A69U,
+        0x98C48C96U, 0xC365505CU, 0x2F873502U, 0x7426E9C8U, 0xF282E209U, 0xA9233EC3U, 0x45C15B9DU, 0x1E608757U,
+        0x79005533U, 0x22A189F9U, 0xCE43ECA7U, 0x95E2306DU, 0x13463BACU, 0x48E7E766U, 0xA4058238U, 0xFFA45EF2U,
+        0xAD8C880DU, 0xF62D54C7U, 0x1ACF3199U, 0x416EED53U, 0xC7CAE692U, 0x9C6B3A58U, 0x70895F06U, 0x2B2883CCU,
+        0xD4D8F2F8U, 0x8F792E32U, 0x639B4B6CU, 0x383A97A6U, 0xBE9E9C67U, 0xE53F40ADU, 0x09DD25F3U, 0x527CF939U,
+        0x00542FC6U, 0x5BF5F30CU, 0xB7179652U, 0xECB64A98U, 0x6A124159U, 0x31B39D93U, 0xDD51F8CDU, 0x86F02407U,
+        0x26700712U, 0x7DD1DBD8U, 0x9133BE86U, 0xCA92624CU, 0x4C36698DU, 0x1797B547U, 0xFB75D019U, 0xA0D40CD3U,
+        0xF2FCDA2CU, 0xA95D06E6U, 0x45BF63B8U, 0x1E1EBF72U, 0x98BAB4B3U, 0xC31B6879U, 0x2FF90D27U, 0x7458D1EDU,
+        0x8BA8A0D9U, 0xD0097C13U, 0x3CEB194DU, 0x674AC587U, 0xE1EECE46U, 0xBA4F128CU, 0x56AD77D2U, 0x0D0CAB18U,
+        0x5F247DE7U, 0x0485A12DU, 0xE867C473U, 0xB3C618B9U, 0x35621378U, 0x6EC3CFB2U, 0x8221AAECU, 0xD9807626U,
+        0xC7E0F171U, 0x9C412DBBU, 0x70A348E5U, 0x2B02942FU, 0xADA69FEEU, 0xF6074324U, 0x1AE5267AU, 0x4144FAB0U,
+        0x136C2C4FU, 0x48CDF085U, 0xA42F95DBU, 0xFF8E4911U, 0x792A42D0U, 0x228B9E1AU, 0xCE69FB44U, 0x95C8278EU,
+        0x6A3856BAU, 0x31998A70U, 0xDD7BEF2EU, 0x86DA33E4U, 0x007E3825U, 0x5BDFE4EFU, 0xB73D81B1U, 0xEC9C5D7BU,
+        0xBEB48B84U, 0xE515574EU, 0x09F73210U, 0x5256EEDAU, 0xD4F2E51BU, 0x8F5339D1U, 0x63B15C8FU, 0x38108045U,
+        0x9890A350U, 0xC3317F9AU, 0x2FD31AC4U, 0x7472C60EU, 0xF2D6CDCFU, 0xA9771105U, 0x4595745BU, 0x1E34A891U,
+        0x4C1C7E6EU, 0x17BDA2A4U, 0xFB5FC7FAU, 0xA0FE1B30U, 0x265A10F1U, 0x7DFBCC3BU, 0x9119A965U, 0xCAB875AFU,
+        0x3548049BU, 0x6EE9D851U, 0x820BBD0FU, 0xD9AA61C5U, 0x5F0E6A04U, 0x04AFB6CEU, 0xE84DD390U, 0xB3EC0F5AU,
+        0xE1C4D9A5U, 0xBA65056FU, 0x56876031U, 0x0D26BCFBU, 0x8B82B73AU, 0xD0236BF0U, 0x3CC10EAEU, 0x6760D264U
+    }
+};
+
+/* Width 16, polynomial 0x00001021, MSB first, top-aligned */
+static const uint32_t crcTableCcittFalse[4][256] =
+{
+    {
+        0x00000000U, 0x10210000U, 0x20420000U, 0x30630000U, 0x40840000U, 0x50A50000U, 0x60C60000U, 0x70E70000U,
+        0x81080000U, 0x91290000U, 0xA14A0000U, 0xB16B0000U, 0xC18C0000U, 0xD1AD0000U, 0xE1CE0000U, 0xF1EF0000U,
+        0x12310000U, 0x02100000U, 0x32730000U, 0x22520000U, 0x52B50000U, 0x42940000U, 0x72F70000U, 0x62D60000U,
+        0x93390000U, 0x83180000U, 0xB37B0000U, 0xA35A0000U, 0xD3BD0000U, 0xC39C0000U, 0xF3FF0000U, 0xE3DE0000U,
+        0x24620000U, 0x34430000U, 0x04200000U, 0x14010000U, 0x64E60000U, 0x74C70000U, 0x44A40000U, 0x54850000U,
+        0xA56A0000U, 0xB54B0000U, 0x85280000U, 0x95090000U, 0xE5EE0000U, 0xF5CF0000U, 0xC5AC0000U, 0xD58D0000U,
+        0x36530000U, 0x26720000U, 0x16110000U, 0x06300000U, 0x76D70000U, 0x66F60000U, 0x56950000U, 0x46B40000U,
+        0xB75B0000U, 0xA77A0000U, 0x97190000U, 0x87380000U, 0xF7DF0000U, 0xE7FE0000U, 0xD79D0000U, 0xC7BC0000U,
+        0x48C40000U, 0x58E50000U, 0x68860000U, 0x78A70000U, 0x08400000U, 0x18610000U, 0x28020000U, 0x38230000U,
+        0xC9CC0000U, 0xD9ED0000U, 0xE98E0000U, 0xF9AF0000U, 0x89480000U, 0x99690000U, 0xA90A0000U, 0xB92B0000U,
+        0x5AF50000U, 0x4AD40000U, 0x7AB70000U, 0x6A960000U, 0x1A710000U, 0x0A500000U, 0x3A330000U, 0x2A120000U,
+        0xDBFD0000U, 0xCBDC0000U, 0xFBBF0000U, 0xEB9E0000U, 0x9B790000U, 0x8B580000U, 0xBB3B0000U, 0xAB1A0000U,
+        0x6CA60000U, 0x7C870000U, 0x4CE40000U, 0x5CC50000U, 0x2C220000U, 0x3C030000U, 0x0C600000U, 0x1C410000U,
+        0xEDAE0000U, 0xFD8F0000U, 0xCDEC0000U, 0xDDCD0000U, 0xAD2A0000U, 0xBD0B0000U, 0x8D680000U, 0x9D490000U,
+        0x7E970000U, 0x6EB60000U, 0x5ED50000U, 0x4EF40000U, 0x3E130000U, 0x2E320000U, 0x1E510000U, 0x0E700000U,
+        0xFF9F0000U, 0xEFBE0000U, 0xDFDD0000U, 0xCFFC0000U, 0xBF1B0000U, 0xAF3A0000U, 0x9F590000U, 0x8F780000U,
+        0x91880000U, 0x81A90000U, 0xB1CA0000U, 0xA1EB0000U, 0xD10C0000U, 0xC12D0000U, 0xF14E0000U, 0xE16F0000U,
+        0x10800000U, 0x00A10000U, 0x30C20000U, 0x20E30000U, 0x50040000U, 0x40250000U, 0x70460000U, 0x60670000U,
+        0x83B90000U, 0x93980000U, 0xA3FB0000U, 0xB3DA0000U, 0xC33D0000U, 0xD31C0000U, 0xE37F0000U, 0xF35E0000U,
+        0x02B10000U, 0x12900000U, 0x22F30000U, 0x32D20000U, 0x42350000U, 0x52140000U, 0x62770000U, 0x72560000U,
+        0xB5EA0000U, 0xA5CB0000U, 0x95A80000U, 0x85890000U, 0xF56E0000U, 0xE54F0000U, 0xD52C0000U, 0xC50D0000U,
+        0x34E20000U, 0x24C30000U, 0x14A00000U, 0x04810000U, 0x74660000U, 0x64470000U, 0x54240000U, 0x44050000U,
+        0xA7DB0000U, 0xB7FA0000U, 0x87990000U, 0x97B80000U, 0xE75F0000U, 0xF77E0000U, 0xC71D0000U, 0xD73C0000U,
+        0x26D30000U, 0x36F20000U, 0x06910000U, 0x16B00000U, 0x66570000U, 0x76760000U, 0x46150000U, 0x56340000U,
+        0xD94C0000U, 0xC96D0000U, 0xF90E0000U, 0xE92F0000U, 0x99C80000U, 0x89E90000U, 0xB98A0000U, 0xA9AB0000U,
+        0x58440000U, 0x48650000U, 0x78060000U, 0x68270000U, 0x18C00000U, 0x08E10000U, 0x38820000U, 0x28A30000U,
+        0xCB7D0000U, 0xDB5C0000U, 0xEB3F0000U, 0xFB1E0000U, 0x8BF90000U, 0x9BD80000U, 0xABBB0000U, 0xBB9A0000U,
+        0x4A750000U, 0x5A540000U, 0x6A370000U, 0x7A160000U, 0x0AF10000U, 0x1AD00000U, 0x2AB30000U, 0x3A920000U,
+        0xFD2E0000U, 0xED0F0000U, 0xDD6C0000U, 0xCD4D0000U, 0xBDAA0000U, 0xAD8B0000U, 0x9DE80000U, 0x8DC90000U,
+        0x7C260000U, 0x6C070000U, 0x5C640000U, 0x4C450000U, 0x3CA20000U, 0x2C830000U, 0x1CE00000U, 0x0CC10000U,
+        0xEF1F0000U, 0xFF3E0000U, 0xCF5D0000U, 0xDF7C0000U, 0xAF9B0000U, 0xBFBA0000U, 0x8FD90000U, 0x9FF80000U,
+        0x6E170000U, 0x7E360000U, 0x4E550000U, 0x5E740000U, 0x2E930000U, 0x3EB20000U, 0x0ED10000U, 0x1EF00000U
+    },
+    {
+        0x00000000U, 0x33310000U, 0x66620000U, 0x55530000U, 0xCCC40000U, 0xFFF50000U, 0xAAA60000U, 0x99970000U,
+        0x89A90000U, 0xBA980000U, 0xEFCB0000U, 0xDCFA0000U, 0x456D0000U, 0x765C0000U, 0x230F0000U, 0x103E0000U,
+        0x03730000U, 0x30420000U, 0x65110000U, 0x56200000U, 0xCFB70000U, 0xFC860000U, 0xA9D50000U, 0x9AE40000U,
+        0x8ADA0000U, 0xB9EB0000U, 0xECB80000U, 0xDF890000U, 0x461E0000U, 0x752F0000U, 0x207C0000U, 0x134D0000U,
+        0x06E60000U, 0x35D70000U, 0x60840000U, 0x53B50000U, 0xCA220000U, 0xF9130000U, 0xAC400000U, 0x9F710000U,
+        0x8F4F0000U, 0xBC7E0000U, 0xE92D0000U, 0xDA1C0000U, 0x438B0000U, 0x70BA0000U, 0x25E90000U, 0x16D80000U,
+        0x05950000U, 0x36A40000U, 0x63F70000U, 0x50C60000U, 0xC9510000U, 0xFA600000U, 0xAF330000U, 0x9C020000U,
+        0x8C3C0000U, 0xBF0D0000U, 0xEA5E0000U, 0xD96F0000U, 0x40F80000U, 0x73C90000U, 0x269A0000U, 0x15AB0000U,
+        0x0DCC0000U, 0x3EFD0000U, 0x6BAE0000U, 0x589F0000U, 0xC1080000U, 0xF2390000U, 0xA76A0000U, 0x945B0000U,
+        0x84650000U, 0xB7540000U, 0xE2070000U, 0xD1360000U, 0x48A10000U, 0x7B900000U, 0x2EC30000U, 0x1DF20000U,
+        0x0EBF0000U, 0x3D8E0000U, 0x68DD0000U, 0x5BEC0000U, 0xC27B0000U, 0xF14A0000U, 0xA4190000U, 0x97280000U,
+        0x87160000U, 0xB4270000U, 0xE1740000U, 0xD2450000U, 0x4BD20000U, 0x78E30000U, 0x2DB00000U, 0x1E810000U,
+        0x0B2A0000U, 0x381B0000U, 0x6D480000U, 0x5E790000U, 0xC7EE0000U, 0xF4DF0000U, 0xA18C0000U, 0x92BD0000U,
+        0x82830000U, 0xB1B20000U, 0xE4E10000U, 0xD7D00000U, 0x4E470000U, 0x7D760000U, 0x28250000U, 0x1B140000U,
+        0x08590000U, 0x3B680000U, 0x6E3B0000U, 0x5D0A0000U, 0xC49D0000U, 0xF7AC0000U, 0xA2FF0000U, 0x91CE0000U,
+        0x81F00000U, 0xB2C10000U, 0xE7920000U, 0xD4A30000U, 0x4D340000U, 0x7E050000U, 0x2B560000U, 0x18670000U,
+        0x1B980000U, 0x28A90000U, 0x7DFA0000U, 0x4ECB0000U, 0xD75C0000U, 0xE46D0000U, 0xB13E0000U, 0x820F0000U,
+        0x92310000U, 0xA1000000U, 0xF4530000U, 0xC7620000U, 0x5EF50000U, 0x6DC40000U, 0x38970000U, 0x0BA60000U,
+        0x18EB0000U, 0x2BDA0000U, 0x7E890000U, 0x4DB80000U, 0xD42F0000U, 0xE71E0000U, 0xB24D0000U, 0x817C0000U,
+        0x91420000U, 0xA2730000U, 0xF7200000U, 0xC4110000U, 0x5D860000U, 0x6EB70000U, 0x3BE40000U, 0x08D50000U,
+        0x1D7E0000U, 0x2E4F0000U, 0x7B1C0000U, 0x482D0000U, 0xD1BA0000U, 0xE28B0000U, 0xB7D80000U, 0x84E90000U,
+        0x94D70000U, 0xA7E60000U, 0xF2B50000U, 0xC1840000U, 0x58130000U, 0x6B220000U, 0x3E710000U, 0x0D400000U,
+        0x1E0D0000U, 0x2D3C0000U, 0x786F0000U, 0x4B5E0000U, 0xD2C90000U, 0xE1F80000U, 0xB4AB0000U, 0x879A0000U,
+        0x97A40000U, 0xA4950000U, 0xF1C60000U, 0xC2F70000U, 0x5B600000U, 0x68510000U, 0x3D020000U, 0x0E330000U,
+        0x16540000U, 0x25650000U, 0x70360000U, 0x43070000U, 0xDA900000U, 0xE9A10000U, 0xBCF20000U, 0x8FC30000U,
+        0x9FFD0000U, 0xACCC0000U, 0xF99F0000U, 0xCAAE0000U, 0x53390000U, 0x60080000U, 0x355B0000U, 0x066A0000U,
+        0x15270000U, 0x26160000U, 0x73450000U, 0x40740000U, 0xD9E30000U, 0xEAD20000U, 0xBF810000U, 0x8CB00000U,
+        0x9C8E0000U, 0xAFBF0000U, 0xFAEC0000U, 0xC9DD0000U, 0x504A0000U, 0x637B0000U, 0x36280000U, 0x05190000U,
+        0x10B20000U, 0x23830000U, 0x76D00000U, 0x45E10000U, 0xDC760000U, 0xEF470000U, 0xBA140000U, 0x89250000U,
+        0x991B0000U, 0xAA2A0000U, 0xFF790000U, 0xCC480000U, 0x55DF0000U, 0x66EE0000U, 0x33BD0000U, 0x008C0000U,
+        0x13C10000U, 0x20F00000U, 0x75A30000U, 0x46920000U, 0xDF050000U, 0xEC340000U, 0xB9670000U, 0x8A560000U,
+        0x9A680000U, 0xA9590000U, 0xFC0A0000U, 0xCF3B0000U, 0x56AC0000U, 0x659D0000U, 0x30CE0000U, 0x03FF0000U
+    },
+    {
+        0x00000000U, 0x37300000U, 0x6E600000U, 0x59500000U, 0xDCC00000U, 0xEBF00000U, 0xB2A00000U, 0x85900000U,
+        0xA9A10000U, 0x9E910000U, 0xC7C10000U, 0xF0F10000U, 0x75610000U, 0x42510000U, 0x1B010000U, 0x2C310000U,
+        0x43630000U, 0x74530000U, 0x2D030000U, 0x1A330000U, 0x9FA30000U, 0xA8930000U, 0xF1C30000U, 0xC6F30000U,
+        0xEAC20000U, 0xDDF20000U, 0x84A20000U, 0xB3920000U, 0x36020000U, 0x01320000U, 0x58620000U, 0x6F520000U,
+        0x86C60000U, 0xB1F60000U, 0xE8A60000U, 0xDF960000U, 0x5A060000U, 0x6D360000U, 0x34660000U, 0x03560000U,
+        0x2F670000U, 0x18570000U, 0x41070000U, 0x76370000U, 0xF3A70000U, 0xC4970000U, 0x9DC70000U, 0xAAF70000U,
+        0xC5A50000U, 0xF2950000U, 0xABC50000U, 0x9CF50000U, 0x19650000U, 0x2E550000U, 0x77050000U, 0x40350000U,
+        0x6C040000U, 0x5B340000U, 0x02640000U, 0x35540000U, 0xB0C40000U, 0x87F40000U, 0xDEA40000U, 0xE9940000U,
+        0x1DAD0000U, 0x2A9D0000U, 0x73CD0000U, 0x44FD0000U, 0xC16D0000U, 0xF65D0000U, 0xAF0D0000U, 0x983D0000U,
+        0xB40C0000U, 0x833C0000U, 0xDA6C0000U, 0xED5C0000U, 0x68CC0000U, 0x5FFC0000U, 0x06AC0000U, 0x319C0000U,
+        0x5ECE0000U, 0x69FE0000U, 0x30AE0000U, 0x079E0000U, 0x820E0000U, 0xB53E0000U, 0xEC6E0000U, 0xDB5E0000U,
+        0xF76F0000U, 0xC05F0000U, 0x990F0000U, 0xAE3F0000U, 0x2BAF0000U, 0x1C9F0000U, 0x45CF0000U, 0x72FF0000U,
+        0x9B6B0000U, 0xAC5B0000U, 0xF50B0000U, 0xC23B0000U, 0x47AB0000U, 0x709B0000U, 0x29CB0000U, 0x1EFB0000U,
+        0x32CA0000U, 0x05FA0000U, 0x5CAA0000U, 0x6B9A0000U, 0xEE0A0000U, 0xD93A0000U, 0x806A0000U, 0xB75A0000U,
+        0xD8080000U, 0xEF380000U, 0xB6680000U, 0x81580000U, 0x04C80000U, 0x33F80000U, 0x6AA80000U, 0x5D980000U,
+        0x71A90000U, 0x46990000U, 0x1FC90000U, 0x28F90000U, 0xAD690000U, 0x9A590000U, 0xC3090000U, 0xF4390000U,
+        0x3B5A0000U, 0x0C6A0000U, 0x553A0000U, 0x620A0000U, 0xE79A0000U, 0xD0AA0000U, 0x89FA0000U, 0xBECA0000U,
+        0x92FB0000U, 0xA5CB0000U, 0xFC9B0000U, 0xCBAB0000U, 0x4E3B0000U, 0x790B0000U, 0x205B0000U, 0x176B0000U,
+        0x78390000U, 0x4F090000U, 0x16590000U, 0x21690000U, 0xA4F90000U, 0x93C90000U, 0xCA990000U, 0xFDA90000U,
+        0xD1980000U, 0xE6A80000U, 0xBFF80000U, 0x88C80000U, 0x0D580000U, 0x3A680000U, 0x63380000U, 0x54080000U,
+        0xBD9C0000U, 0x8AAC0000U, 0xD3FC0000U, 0xE4CC0000U, 0x615C0000U, 0x566C0000U, 0x0F3C0000U, 0x380C0000U,
+        0x143D0000U, 0x230D0000U, 0x7A5D0000U, 0x4D6D0000U, 0xC8FD0000U, 0xFFCD0000U, 0xA69D0000U, 0x91AD0000U,
+        0xFEFF0000U, 0xC9CF0000U, 0x909F0000U, 0xA7AF0000U, 0x223F0000U, 0x150F0000U, 0x4C5F0000U, 0x7B6F0000U,
+        0x575E0000U, 0x606E0000U, 0x393E0000U, 0x0E0E0000U, 0x8B9E0000U, 0xBCAE0000U, 0xE5FE0000U, 0xD2CE0000U,
+        0x26F70000U, 0x11C70000U, 0x48970000U, 0x7FA70000U, 0xFA370000U, 0xCD070000U, 0x94570000U, 0xA3670000U,
+        0x8F560000U, 0xB8660000U, 0xE1360000U, 0xD6060000U, 0x53960000U, 0x64A60000U, 0x3DF60000U, 0x0AC60000U,
+        0x65940000U, 0x52A40000U, 0x0BF40000U, 0x3CC40000U, 0xB9540000U, 0x8E640000U, 0xD7340000U, 0xE0040000U,
+        0xCC350000U, 0xFB050000U, 0xA2550000U, 0x95650000U, 0x10F50000U, 0x27C50000U, 0x7E950000U, 0x49A50000U,
+        0xA0310000U, 0x97010000U, 0xCE510000U, 0xF9610000U, 0x7CF10000U, 0x4BC10000U, 0x12910000U, 0x25A10000U,
+        0x09900000U, 0x3EA00000U, 0x67F00000U, 0x50C00000U, 0xD5500000U, 0xE2600000U, 0xBB300000U, 0x8C000000U,
+        0xE3520000U, 0xD4620000U, 0x8D320000U, 0xBA020000U, 0x3F920000U, 0x08A20000U, 0x51F20000U, 0x66C20000U,
+        0x4AF30000U, 0x7DC30000U, 0x24930000U, 0x13A30000U, 0x96330000U, 0xA1030000U, 0xF8530000U, 0xCF630000U
+    },
+    {
+        0x00000000U, 0x76B40000U, 0xED680000U, 0x9BDC0000U, 0xCAF10000U, 0xBC450000U, 0x27990000U, 0x512D0000U,
+        0x85C30000U, 0xF3770000U, 0x68AB0000U, 0x1E1F0000U, 0x4F320000U, 0x39860000U, 0xA25A0000U, 0xD4EE0000U,
+        0x1BA70000U, 0x6D130000U, 0xF6CF0000U, 0x807B0000U, 0xD1560000U, 0xA7E20000U, 0x3C3E0000U, 0x4A8A0000U,
+        0x9E640000U, 0xE8D00000U, 0x730C0000U, 0x05B80000U, 0x54950000U, 0x22210000U, 0xB9FD0000U, 0xCF490000U,
+        0x374E0000U, 0x41FA0000U, 0xDA260000U, 0xAC920000U, 0xFDBF0000U, 0x8B0B0000U, 0x10D70000U, 0x66630000U,
+        0xB28D0000U, 0xC4390000U, 0x5FE50000U, 0x29510000U, 0x787C0000U, 0x0EC80000U, 0x95140000U, 0xE3A00000U,
+        0x2CE90000U, 0x5A5D0000U, 0xC1810000U, 0xB7350000U, 0xE6180000U, 0x90AC0000U, 0x0B700000U, 0x7DC40000U,
+        0xA92A0000U, 0xDF9E0000U, 0x44420000U, 0x32F60000U, 0x63DB0000U, 0x156F0000U, 0x8EB30000U, 0xF8070000U,
+        0x6E9C0000U, 0x18280000U, 0x83F40000U, 0xF5400000U, 0xA46D0000U, 0xD2D90000U, 0x49050000U, 0x3FB10000U,
+        0xEB5F0000U, 0x9DEB0000U, 0x06370000U, 0x70830000U, 0x21AE0000U, 0x571A0000U, 0xCCC60000U, 0xBA720000U,
+        0x753B0000U, 0x038F0000U, 0x98530000U, 0xEEE70000U, 0xBFCA0000U, 0xC97E0000U, 0x52A20000U, 0x24160000U,
+        0xF0F80000U, 0x864C0000U, 0x1D900000U, 0x6B240000U, 0x3A090000U, 0x4CBD0000U, 0xD7610000U, 0xA1D50000U,
+        0x59D20000U, 0x2F660000U, 0xB4BA0000U, 0xC20E0000U, 0x93230000U, 0xE5970000U, 0x7E4B0000U, 0x08FF0000U,
+        0xDC110000U, 0xAAA50000U, 0x31790000U, 0x47CD0000U, 0x16E00000U, 0x60540000U, 0xFB880000U, 0x8D3C0000U,
+        0x42750000U, 0x34C10000U, 0xAF1D0000U, 0xD9A90000U, 0x88840000U, 0xFE300000U, 0x65EC0000U, 0x13580000U,
+        0xC7B60000U, 0xB1020000U, 0x2ADE0000U, 0x5C6A0000U, 0x0D470000U, 0x7BF30000U, 0xE02F0000U, 0x969B0000U,
+        0xDD380000U, 0xAB8C0000U, 0x30500000U, 0x46E40000U, 0x17C90000U, 0x617D0000U, 0xFAA10000U, 0x8C150000U,
+        0x58FB0000U, 0x2E4F0000U, 0xB5930000U, 0xC3270000U, 0x920A0000U, 0xE4BE0000U, 0x7F620000U, 0x09D60000U,
+        0xC69F0000U, 0xB02B0000U, 0x2BF70000U, 0x5D430000U, 0x0C6E0000U, 0x7ADA0000U, 0xE1060000U, 0x97B20000U,
+        0x435C0000U, 0x35E80000U, 0xAE340000U, 0xD8800000U, 0x89AD0000U, 0xFF190000U, 0x64C50000U, 0x12710000U,
+        0xEA760000U, 0x9CC20000U, 0x071E0000U, 0x71AA0000U, 0x20870000U, 0x56330000U, 0xCDEF0000U, 0xBB5B0000U,
+        0x6FB50000U, 0x19010000U, 0x82DD0000U, 0xF4690000U, 0xA5440000U, 0xD3F00000U, 0x482C0000U, 0x3E980000U,
+        0xF1D10000U, 0x87650000U, 0x1CB90000U, 0x6A0D0000U, 0x3B200000U, 0x4D940000U, 0xD6480000U, 0xA0FC0000U,
+        0x74120000U, 0x02A60000U, 0x997A0000U, 0xEFCE0000U, 0xBEE30000U, 0xC8570000U, 0x538B0000U, 0x253F0000U,
+        0xB3A40000U, 0xC5100000U, 0x5ECC0000U, 0x28780000U, 0x79550000U, 0x0FE10000U, 0x943D0000U, 0xE2890000U,
+        0x36670000U, 0x40D30000U, 0xDB0F0000U, 0xADBB0000U, 0xFC960000U, 0x8A220000U, 0x11FE0000U, 0x674A0000U,
+        0xA8030000U, 0xDEB70000U, 0x456B0000U, 0x33DF0000U, 0x62F20000U, 0x14460000U, 0x8F9A0000U, 0xF92E0000U,
+        0x2DC00000U, 0x5B740000U, 0xC0A80000U, 0xB61C0000U, 0xE7310000U, 0x91850000U, 0x0A590000U, 0x7CED0000U,
+        0x84EA0000U, 0xF25E0000U, 0x69820000U, 0x1F360000U, 0x4E1B0000U, 0x38AF0000U, 0xA3730000U, 0xD5C70000U,
+        0x01290000U, 0x779D0000U, 0xEC410000U, 0x9AF50000U, 0xCBD80000U, 0xBD6C0000U, 0x26B00000U, 0x50040000U,
+        0x9F4D0000U, 0xE9F90000U, 0x72250000U, 0x04910000U, 0x55BC0000U, 0x23080000U, 0xB8D40000U, 0xCE600000U,
+        0x1A8E0000U, 0x6C3A0000U, 0xF7E60000U, 0x81520000U, 0xD07F0000U, 0xA6CB0000U, 0x3D170000U, 0x4BA30000U
+    }
+};
+
+/* Width 16, polynomial 0x00008005, reflected */
+static const uint32_t crcTableModbus[4][256] =
+{
+    {
+        0x00000000U, 0x0000C0C1U, 0x0000C181U, 0x00000140U, 0x0000C301U, 0x000003C0U, 0x00000280U, 0x0000C241U,
+        0x0000C601U, 0x000006C0U, 0x00000780U, 0x0000C741U, 0x00000500U, 0x0000C5C1U, 0x0000C481U, 0x00000440U,
+        0x0000CC01U, 0x00000CC0U, 0x00000D80U, 0x0000CD41U, 0x00000F00U, 0x0000CFC1U, 0x0000CE81U, 0x00000E40U,
+        0x00000A00U, 0x0000CAC1U, 0x0000CB81U, 0x00000B40U, 0x0000C901U, 0x000009C0U, 0x00000880U, 0x0000C841U,
+        0x0000D801U, 0x000018C0U, 0x00001980U, 0x0000D941U, 0x00001B00U, 0x0000DBC1U, 0x0000DA81U, 0x00001A40U,
+        0x00001E00U, 0x0000DEC1U, 0x0000DF81U, 0x00001F40U, 0x0000DD01U, 0x00001DC0U, 0x00001C80U, 0x0000DC41U,
+        0x00001400U, 0x0000D4C1U, 0x0000D581U, 0x00001540U, 0x0000D701U, 0x000017C0U, 0x00001680U, 0x0000D641U,
+        0x0000D201U, 0x000012C0U, 0x00001380U, 0x0000D341U, 0x00001100U, 0x0000D1C1U, 0x0000D081U, 0x00001040U,
+        0x0000F001U, 0x000030C0U, 0x00003180U, 0x0000F141U, 0x00003300U, 0x0000F3C1U, 0x0000F281U, 0x00003240U,
+        0x00003600U, 0x0000F6C1U, 0x0000F781U, 0x00003740U, 0x0000F501U, 0x000035C0U, 0x00003480U, 0x0000F441U,
+        0x00003C00U, 0x0000FCC1U, 0x0000FD81U, 0x00003D40U, 0x0000FF01U, 0x00003FC0U, 0x00003E80U, 0x0000FE41U,
+        0x0000FA01U, 0x00003AC0U, 0x00003B80U, 0x0000FB41U, 0x00003900U, 0x0000F9C1U, 0x0000F881U, 0x00003840U,
+        0x00002800U, 0x0000E8C1U, 0x0000E981U, 0x00002940U, 0x0000EB01U, 0x00002BC0U, 0x00002A80U, 0x0000EA41U,
+        0x0000EE01U, 0x00002EC0U, 0x00002F80U, 0x0000EF41U, 0x00002D00U, 0x0000EDC1U, 0x0000EC81U, 0x00002C40U,
+        0x0000E401U, 0x000024C0U, 0x00002580U, 0x0000E541U, 0x00002700U, 0x0000E7C1U, 0x0000E681U, 0x00002640U,
+        0x00002200U, 0x0000E2C1U, 0x0000E381U, 0x00002340U, 0x0000E101U, 0x000021C0U, 0x00002080U, 0x0000E041U,
+        0x0000A001U, 0x000060C0U, 0x00006180U, 0x0000A141U, 0x00006300U, 0x0000A3C1U, 0x0000A281U, 0x00006240U,
+        0x00006600U, 0x0000A6C1U, 0x0000A781U, 0x00006740U, 0x0000A501U, 0x000065C0U, 0x00006480U, 0x0000A441U,
+        0x00006C00U, 0x0000ACC1U, 0x0000AD81U, 0x00006D40U, 0x0000AF01U, 0x00006FC0U, 0x00006E80U, 0x0000AE41U,
+        0x0000AA01U, 0x00006AC0U, 0x00006B80U, 0x0000AB41U, 0x00006900U, 0x0000A9C1U, 0x0000A881U, 0x00006840U,
+        0x00007800U, 0x0000B8C1U, 0x0000B981U, 0x00007940U, 0x0000BB01U, 0x00007BC0U, 0x00007A80U, 0x0000BA41U,
+        0x0000BE01U, 0x00007EC0U, 0x00007F80U, 0x0000BF41U, 0x00007D00U, 0x0000BDC1U, 0x0000BC81U, 0x00007C40U,
+        0x0000B401U, 0x000074C0U, 0x00007580U, 0x0000B541U, 0x00007700U, 0x0000B7C1U, 0x0000B681U, 0x00007640U,
+        0x00007200U, 0x0000B2C1U, 0x0000B381U, 0x00007340U, 0x0000B101U, 0x000071C0U, 0x00007080U, 0x0000B041U,
+        0x00005000U, 0x000090C1U, 0x00009181U, 0x00005140U, 0x00009301U, 0x000053C0U, 0x00005280U, 0x00009241U,
+        0x00009601U, 0x000056C0U, 0x00005780U, 0x00009741U, 0x00005500U, 0x000095C1U, 0x00009481U, 0x00005440U,
+        0x00009C01U, 0x00005CC0U, 0x00005D80U, 0x00009D41U, 0x00005F00U, 0x00009FC1U, 0x00009E81U, 0x00005E40U,
+        0x00005A00U, 0x00009AC1U, 0x00009B81U, 0x00005B40U, 0x00009901U, 0x000059C0U, 0x00005880U, 0x00009841U,
+        0x00008801U, 0x000048C0U, 0x00004980U, 0x00008941U, 0x00004B00U, 0x00008BC1U, 0x00008A81U, 0x00004A40U,
+        0x00004E00U, 0x00008EC1U, 0x00008F81U, 0x00004F40U, 0x00008D01U, 0x00004DC0U, 0x00004C80U, 0x00008C41U,
+        0x00004400U, 0x000084C1U, 0x00008581U, 0x00004540U, 0x00008701U, 0x000047C0U, 0x00004680U, 0x00008641U,
+        0x00008201U, 0x000042C0U, 0x00004380U, 0x00008341U, 0x00004100U, 0x000081C1U, 0x00008081U, 0x00004040U
+    },
+    {
+        0x00000000U, 0x00009001U, 0x00006001U, 0x0000F000U, 0x0000C002U, 0x00005003U, 0x0000A003U, 0x00003002U,
+        0x0000C007U, 0x00005006U, 0x0000A006U, 0x00003007U, 0x00000005U, 0x00009004U, 0x00006004U, 0x0000F005U,
+        0x0000C00DU, 0x0000500CU, 0x0000A00CU, 0x0000300DU, 0x0000000FU, 0x0000900EU, 0x0000600EU, 0x0000F00FU,
+        0x0000000AU, 0x0000900BU, 0x0000600BU, 0x0000F00AU, 0x0000C008U, 0x00005009U, 0x0000A009U, 0x00003008U,
+        0x0000C019U, 0x00005018U, 0x0000A018U, 0x00003019U, 0x0000001BU, 0x0000901AU, 0x0000601AU, 0x0000F01BU,
+        0x0000001EU, 0x0000901FU, 0x0000601FU, 0x0000F01EU, 0x0000C01CU, 0x0000501DU, 0x0000A01DU, 0x0000301CU,
+        0x00000014U, 0x00009015U, 0x00006015U, 0x0000F014U, 0x0000C016U, 0x00005017U, 0x0000A017U, 0x00003016U,
+        0x0000C013U, 0x00005012U, 0x0000A012U, 0x00003013U, 0x00000011U, 0x00009010U, 0x00006010U, 0x0000F011U,
+        0x0000C031U, 0x00005030U, 0x0000A030U, 0x00003031U, 0x00000033U, 0x00009032U, 0x00006032U, 0x0000F033U,
+        0x00000036U, 0x00009037U, 0x00006037U, 0x0000F036U, 0x0000C034U, 0x00005035U, 0x0000A035U, 0x00003034U,
+        0x0000003CU, 0x0000903DU, 0x0000603DU, 0x0000F03CU, 0x0000C03EU, 0x0000503FU, 0x0000A03FU, 0x0000303EU,
+        0x0000C03BU, 0x0000503AU, 0x0000A03AU, 0x0000303BU, 0x00000039U, 0x00009038U, 0x00006038U, 0x0000F039U,
+        0x00000028U, 0x00009029U, 0x00006029U, 0x0000F028U, 0x0000C02AU, 0x0000502BU, 0x0000A02BU, 0x0000302AU,
+        0x0000C02FU, 0x0000502EU, 0x0000A02EU, 0x0000302FU, 0x0000002DU, 0x0000902CU, 0x0000602CU, 0x0000F02DU,
+        0x0000C025U, 0x00005024U, 0x0000A024U, 0x00003025U, 0x00000027U, 0x00009026U, 0x00006026U, 0x0000F027U,
+        0x00000022U, 0x00009023U, 0x00006023U, 0x0000F022U, 0x0000C020U, 0x00005021U, 0x0000A021U, 0x00003020U,
+        0x0000C061U, 0x00005060U, 0x0000A060U, 0x00003061U, 0x00000063U, 0x00009062U, 0x00006062U, 0x0000F063U,
+        0x00000066U, 0x00009067U, 0x00006067U, 0x0000F066U, 0x0000C064U, 0x00005065U, 0x0000A065U, 0x00003064U,
+        0x0000006CU, 0x0000906DU, 0x0000606DU, 0x0000F06CU, 0x0000C06EU, 0x0000506FU, 0x0000A06FU, 0x0000306EU,
+        0x0000C06BU, 0x0000506AU, 0x0000A06AU, 0x0000306BU, 0x00000069U, 0x00009068U, 0x00006068U, 0x0000F069U,
+        0x00000078U, 0x00009079U, 0x00006079U, 0x0000F078U, 0x0000C07AU, 0x0000507BU, 0x0000A07BU, 0x0000307AU,
+        0x0000C07FU, 0x0000507EU, 0x0000A07EU, 0x0000307FU, 0x0000007DU, 0x0000907CU, 0x0000607CU, 0x0000F07DU,
+        0x0000C075U, 0x00005074U, 0x0000A074U, 0x00003075U, 0x00000077U, 0x00009076U, 0x00006076U, 0x0000F077U,
+        0x00000072U, 0x00009073U, 0x00006073U, 0x0000F072U, 0x0000C070U, 0x00005071U, 0x0000A071U, 0x00003070U,
+        0x00000050U, 0x00009051U, 0x00006051U, 0x0000F050U, 0x0000C052U, 0x00005053U, 0x0000A053U, 0x00003052U,
+        0x0000C057U, 0x00005056U, 0x0000A056U, 0x00003057U, 0x00000055U, 0x00009054U, 0x00006054U, 0x0000F055U,
+        0x0000C05DU, 0x0000505CU, 0x0000A05CU, 0x0000305DU, 0x0000005FU, 0x0000905EU, 0x0000605EU, 0x0000F05FU,
+        0x0000005AU, 0x0000905BU, 0x0000605BU, 0x0000F05AU, 0x0000C058U, 0x00005059U, 0x0000A059U, 0x00003058U,
+        0x0000C049U, 0x00005048U, 0x0000A048U, 0x00003049U, 0x0000004BU, 0x0000904AU, 0x0000604AU, 0x0000F04BU,
+        0x0000004EU, 0x0000904FU, 0x0000604FU, 0x0000F04EU, 0x0000C04CU, 0x0000504DU, 0x0000A04DU, 0x0000304CU,
+        0x00000044U, 0x00009045U, 0x00006045U, 0x0000F044U, 0x0000C046U, 0x00005047U, 0x0000A047U, 0x00003046U,
+        0x0000C043U, 0x00005042U, 0x0000A042U, 0x00003043U, 0x00000041U, 0x00009040U, 0x00006040U, 0x0000F041U
+    },
+    {
+        0x00000000U, 0x0000C051U, 0x0000C0A1U, 0x000000F0U, 0x0000C141U, 0x00000110U, 0x000001E0U, 0x0000C1B1U,
+        0x0000C281U, 0x000002D0U, 0x00000220U, 0x0000C271U, 0x000003C0U, 0x0000C391U, 0x0000C361U, 0x00000330U,
+        0x0000C501U, 0x00000550U, 0x000005A0U, 0x0000C5F1U, 0x00000440U, 0x0000C411U, 0x0000C4E1U, 0x000004B0U,
+        0x00000780U, 0x0000C7D1U, 0x0000C721U, 0x00000770U, 0x0000C6C1U, 0x00000690U, 0x00000660U, 0x0000C631U,
+        0x0000CA01U, 0x00000A50U, 0x00000AA0U, 0x0000CAF1U, 0x00000B40U, 0x0000CB11U, 0x0000CBE1U, 0x00000BB0U,
+        0x00000880U, 0x0000C8D1U, 0x0000C821U, 0x00000870U, 0x0000C9C1U, 0x00000990U, 0x00000960U, 0x0000C931U,
+        0x00000F00U, 0x0000CF51U, 0x0000CFA1U, 0x00000FF0U, 0x0000CE41U, 0x00000E10U, 0x00000EE0U, 0x0000CEB1U,
+        0x0000CD81U, 0x00000DD0U, 0x00000D20U, 0x0000CD71U, 0x00000CC0U, 0x0000CC91U, 0x0000CC61U, 0x00000C30U,
+        0x0000D401U, 0x00001450U, 0x000014A0U, 0x0000D4F1U, 0x00001540U, 0x0000D511U, 0x0000D5E1U, 0x000015B0U,
+        0x00001680U, 0x0000D6D1U, 0x0000D621U, 0x00001670U, 0x0000D7C1U, 0x00001790U, 0x00001760U, 0x0000D731U,
+        0x00001100U, 0x0000D151U, 0x0000D1A1U, 0x000011F0U, 0x0000D041U, 0x00001010U, 0x000010E0U, 0x0000D0B1U,
+        0x0000D381U, 0x000013D0U, 0x00001320U, 0x0000D371U, 0x000012C0U, 0x0000D291U, 0x0000D261U, 0x00001230U,
+        0x00001E00U, 0x0000DE51U, 0x0000DEA1U, 0x00001EF0U, 0x0000DF41U, 0x00001F10U, 0x00001FE0U, 0x0000DFB1U,
+        0x0000DC81U, 0x00001CD0U, 0x00001C20U, 0x0000DC71U, 0x00001DC0U, 0x0000DD91U, 0x0000DD61U, 0x00001D30U,
+        0x0000DB01U, 0x00001B50U, 0x00001BA0U, 0x0000DBF1U, 0x00001A40U, 0x0000DA11U, 0x0000DAE1U, 0x00001AB0U,
+        0x00001980U, 0x0000D9D1U, 0x0000D921U, 0x00001970U, 0x0000D8C1U, 0x00001890U, 0x00001860U, 0x0000D831U,
+        0x0000E801U, 0x00002850U, 0x000028A0U, 0x0000E8F1U, 0x00002940U, 0x0000E911U, 0x0000E9E1U, 0x000029B0U,
+        0x00002A80U, 0x0000EAD1U, 0x0000EA21U, 0x00002A70U, 0x0000EBC1U, 0x00002B90U, 0x00002B60U, 0x0000EB31U,
+        0x00002D00U, 0x0000ED51U, 0x0000EDA1U, 0x00002DF0U, 0x0000EC41U, 0x00002C10U, 0x00002CE0U, 0x0000ECB1U,
+        0x0000EF81U, 0x00002FD0U, 0x00002F20U, 0x0000EF71U, 0x00002EC0U, 0x0000EE91U, 0x0000EE61U, 0x00002E30U,
+        0x00002200U, 0x0000E251U, 0x0000E2A1U, 0x000022F0U, 0x0000E341U, 0x00002310U, 0x000023E0U, 0x0000E3B1U,
+        0x0000E081U, 0x000020D0U, 0x00002020U, 0x0000E071U, 0x000021C0U, 0x0000E191U, 0x0000E161U, 0x00002130U,
+        0x0000E701U, 0x00002750U, 0x000027A0U, 0x0000E7F1U, 0x00002640U, 0x0000E611U, 0x0000E6E1U, 0x000026B0U,
+        0x00002580U, 0x0000E5D1U, 0x0000E521U, 0x00002570U, 0x0000E4C1U, 0x00002490U, 0x00002460U, 0x0000E431U,
+        0x00003C00U, 0x0000FC51U, 0x0000FCA1U, 0x00003CF0U, 0x0000FD41U, 0x00003D10U, 0x00003DE0U, 0x0000FDB1U,
+        0x0000FE81U, 0x00003ED0U, 0x00003E20U, 0x0000FE71U, 0x00003FC0U, 0x0000FF91U, 0x0000FF61U, 0x00003F30U,
+        0x0000F901U, 0x00003950U, 0x000039A0U, 0x0000F9F1U, 0x00003840U, 0x0000F811U, 0x0000F8E1U, 0x000038B0U,
+        0x00003B80U, 0x0000FBD1U, 0x0000FB21U, 0x00003B70U, 0x0000FAC1U, 0x00003A90U, 0x00003A60U, 0x0000FA31U,
+        0x0000F601U, 0x00003650U, 0x000036A0U, 0x0000F6F1U, 0x00003740U, 0x0000F711U, 0x0000F7E1U, 0x000037B0U,
+        0x00003480U, 0x0000F4D1U, 0x0000F421U, 0x00003470U, 0x0000F5C1U, 0x00003590U, 0x00003560U, 0x0000F531U,
+        0x00003300U, 0x0000F351U, 0x0000F3A1U, 0x000033F0U, 0x0000F241U, 0x00003210U, 0x000032E0U, 0x0000F2B1U,
+        0x0000F181U, 0x000031D0U, 0x00003120U, 0x0000F171U, 0x000030C0U, 0x0000F091U, 0x0000F061U, 0x00003030U
+    },
+    {
+        0x00000000U, 0x0000FC01U, 0x0000B801U, 0x00004400U, 0x00003001U, 0x0000CC00U, 0x00008800U, 0x00007401U,
+        0x00006002U, 0x00009C03U, 0x0000D803U, 0x00002402U, 0x00005003U, 0x0000AC02U, 0x0000E802U, 0x00001403U,
+        0x0000C004U, 0x00003C05U, 0x00007805U, 0x00008404U, 0x0000F005U, 0x00000C04U, 0x00004804U, 0x0000B405U,
+        0x0000A006U, 0x00005C07U, 0x00001807U, 0x0000E406U, 0x00009007U, 0x00006C06U, 0x00002806U, 0x0000D407U,
+        0x0000C00BU, 0x00003C0AU, 0x0000780AU, 0x0000840BU, 0x0000F00AU, 0x00000C0BU, 0x0000480BU, 0x0000B40AU,
+        0x0000A009U, 0x00005C08U, 0x00001808U, 0x0000E409U, 0x00009008U, 0x00006C09U, 0x00002809U, 0x0000D408U,
+        0x0000000FU, 0x0000FC0EU, 0x0000B80EU, 0x0000440FU, 0x0000300EU, 0x0000CC0FU, 0x0000880FU, 0x0000740EU,
+        0x0000600DU, 0x00009C0CU, 0x0000D80CU, 0x0000240DU, 0x0000500CU, 0x0000AC0DU, 0x0000E80DU, 0x0000140CU,
+        0x0000C015U, 0x00003C14U, 0x00007814U, 0x00008415U, 0x0000F014U, 0x00000C15U, 0x00004815U, 0x0000B414U,
+        0x0000A017U, 0x00005C16U, 0x00001816U, 0x0000E417U, 0x00009016U, 0x00006C17U, 0x00002817U, 0x0000D416U,
+        0x00000011U, 0x0000FC10U, 0x0000B810U, 0x00004411U, 0x00003010U, 0x0000CC11U, 0x00008811U, 0x00007410U,
+        0x00006013U, 0x00009C12U, 0x0000D812U, 0x00002413U, 0x00005012U, 0x0000AC13U, 0x0000E813U, 0x00001412U,
+        0x0000001EU, 0x0000FC1FU, 0x0000B81FU, 0x0000441EU, 0x0000301FU, 0x0000CC1EU, 0x0000881EU, 0x0000741FU,
+        0x0000601CU, 0x00009C1DU, 0x0000D81DU, 0x0000241CU, 0x0000501DU, 0x0000AC1CU, 0x0000E81CU, 0x0000141DU,
+        0x0000C01AU, 0x00003C1BU, 0x0000781BU, 0x0000841AU, 0x0000F01BU, 0x00000C1AU, 0x0000481AU, 0x0000B41BU,
+        0x0000A018U, 0x00005C19U, 0x00001819U, 0x0000E418U, 0x00009019U, 0x00006C18U, 0x00002818U, 0x0000D419U,
+        0x0000C029U, 0x00003C28U, 0x00007828U, 0x00008429U, 0x0000F028U, 0x00000C29U, 0x00004829U, 0x0000B428U,
+        0x0000A02BU, 0x00005C2AU, 0x0000182AU, 0x0000E42BU, 0x0000902AU, 0x00006C2BU, 0x0000282BU, 0x0000D42AU,
+        0x0000002DU, 0x0000FC2CU, 0x0000B82CU, 0x0000442DU, 0x0000302CU, 0x0000CC2DU, 0x0000882DU, 0x0000742CU,
+        0x0000602FU, 0x00009C2EU, 0x0000D82EU, 0x0000242FU, 0x0000502EU, 0x0000AC2FU, 0x0000E82FU, 0x0000142EU,
+        0x00000022U, 0x0000FC23U, 0x0000B823U, 0x00004422U, 0x00003023U, 0x0000CC22U, 0x00008822U, 0x00007423U,
+        0x00006020U, 0x00009C21U, 0x0000D821U, 0x00002420U, 0x00005021U, 0x0000AC20U, 0x0000E820U, 0x00001421U,
+        0x0000C026U, 0x00003C27U, 0x00007827U, 0x00008426U, 0x0000F027U, 0x00000C26U, 0x00004826U, 0x0000B427U,
+        0x0000A024U, 0x00005C25U, 0x00001825U, 0x0000E424U, 0x00009025U, 0x00006C24U, 0x00002824U, 0x0000D425U,
+        0x0000003CU, 0x0000FC3DU, 0x0000B83DU, 0x0000443CU, 0x0000303DU, 0x0000CC3CU, 0x0000883CU, 0x0000743DU,
+        0x0000603EU, 0x00009C3FU, 0x0000D83FU, 0x0000243EU, 0x0000503FU, 0x0000AC3EU, 0x0000E83EU, 0x0000143FU,
+        0x0000C038U, 0x00003C39U, 0x00007839U, 0x00008438U, 0x0000F039U, 0x00000C38U, 0x00004838U, 0x0000B439U,
+        0x0000A03AU, 0x00005C3BU, 0x0000183BU, 0x0000E43AU, 0x0000903BU, 0x00006C3AU, 0x0000283AU, 0x0000D43BU,
+        0x0000C037U, 0x00003C36U, 0x00007836U, 0x00008437U, 0x0000F036U, 0x00000C37U, 0x00004837U, 0x0000B436U,
+        0x0000A035U, 0x00005C34U, 0x00001834U, 0x0000E435U, 0x00009034U, 0x00006C35U, 0x00002835U, 0x0000D434U,
+        0x00000033U, 0x0000FC32U, 0x0000B832U, 0x00004433U, 0x00003032U, 0x0000CC33U, 0x00008833U, 0x00007432U,
+        0x00006031U, 0x00009C30U, 0x0000D830U, 0x00002431U, 0x00005030U, 0x0000AC31U, 0x0000E831U, 0x00001430U
+    }
+};
+
+const CrcModel_T crcCrc32 =
+{
+    .table = crcTableCrc32,
+    .poly = 0x04C11DB7U,
+    .init = 0xFFFFFFFFU,
+    .xorOut = 0xFFFFFFFFU,
+    .width = 32,
+    .flags = CRC_REFLECT,
+    .slices = 8,
+};
+
+const CrcModel_T crcCrc32c =
+{
+    .table = crcTableCrc32c,
+    .poly = 0x1EDC6F41U,
+    .init = 0xFFFFFFFFU,
+    .xorOut = 0xFFFFFFFFU,
+    .width = 32,
+    .flags = CRC_REFLECT,
+    .slices = 8,
+};
+
+const CrcModel_T crcMpeg2 =
+{
+    .table = crcTableMpeg2,
+    .poly = 0x04C11DB7U,
+    .init = 0xFFFFFFFFU,
+    .xorOut = 0x00000000U,
+    .width = 32,
+    .flags = 0,
+    .slices = 8,
+};
+
+const CrcModel_T crcMpeg2Words =
+{
+    .table = crcTableMpeg2,
+    .poly = 0x04C11DB7U,
+    .init = 0xFFFFFFFFU,
+    .xorOut = 0x00000000U,
+    .width = 32,
+    .flags = CRC_WORD_ORDER,
+    .slices = 8,
+};
+
+const CrcModel_T crcCcittFalse =
+{
+    .table = crcTableCcittFalse,
+    .poly = 0x00001021U,
+    .init = 0x0000FFFFU,
+    .xorOut = 0x00000000U,
+    .width = 16,
+    .flags = 0,
+    .slices = 4,
+};
+
+const CrcModel_T crcModbus =
+{
+    .table = crcTableModbus,
+    .poly = 0x00008005U,
+    .init = 0x0000FFFFU,
+    .xorOut = 0x00000000U,
+    .width = 16,
+    .flags = CRC_REFLECT,
+    .slices = 4,
+};
@@ -0,0 +1,13 @@
+#ifndef CRITICAL_H
+#define CRITICAL_H
+
+#include "apm32f4xx.h"
+
+/* Nestable critical section: masks interrupts and restores the previous PRIMASK */
+#define CRITICAL_ENTER()    uint32_t criticalPrimask = __get_PRIMASK(); __disable_irq()
+#define CRITICAL_EXIT()     __set_PRIMASK(criticalPrimask)
+
+/* True when called from an exception handler or with interrupts masked */
+#define CRITICAL_IN_ISR()   ((__get_IPSR() != 0U) || (__get_PRIMASK() != 0U))
+
+#endif // CRITICAL_H
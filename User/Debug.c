@@ -1,10 +1,135 @@
 #include "apm32f4xx_conf.h"
 #include "Debug.h"
+#include "RingBuf.h"
+#include "Critical.h"
+#include "Dma.h"
 
 #ifdef DEBUG
 
 #if DEBUG == DEBUG_USART1
 #define DEBUG_USART USART1
+#define DEBUG_DMA_REQ       DMA_REQ_USART1_TX
+#endif
+
+static uint8_t txBuf[DEBUG_TX_BUF_SIZE];
+static RingBuf_T txRing;
+/* Length of the chunk owned by the DMA stream, 0 when idle */
+static volatile uint32_t txLen;
+static DebugTxStats_T txStats;
+/* Claimed transmit stream, NULL when every route was taken: blocking writes */
+static DmaStream_T* txStream;
+static DmaTransfer_T txTransfer;
+
+static void DebugTxDone(DmaTransfer_T* transfer, DmaEvent_T event);
+
+/*!
+ * @brief       Hand the next contiguous chunk of the ring to DMA if idle.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Called from the DMA ISR or with interrupts masked.
+ */
+static void DebugTxKick(void)
+{
+    uint8_t* ptr;
+    uint32_t len;
+
+    if ((txLen != 0) || (txStream == NULL))
+    {
+        return;
+    }
+
+    len = RingBufPeekLinear(&txRing, &ptr);
+    if (len == 0)
+    {
+        return;
+    }
+    if (len > DEBUG_TX_CHUNK_MAX)
+    {
+        len = DEBUG_TX_CHUNK_MAX;
+    }
+
+    txLen = len;
+    txTransfer.peripheral = (uint32_t)&DEBUG_USART->DATA;
+    txTransfer.memory = (uint32_t)ptr;
+    txTransfer.count = (uint16_t)len;
+    txTransfer.size = 1;
+    txTransfer.dir = DMA_DIR_MEMORYTOPERIPHERAL;
+    txTransfer.flags = 0;
+    txTransfer.done = DebugTxDone;
+    DmaSubmit(txStream, &txTransfer);
+}
+
+/*!
+ * @brief       DMA callback: release the chunk and chain the next one.
+ *
+ * @param       transfer:  txTransfer
+ *
+ * @param       event:     DMA_EVENT_DONE, DMA_EVENT_ERROR (chunk lost) or
+ *                         DMA_EVENT_ABORTED (DebugTxAbort() accounts for it)
+ *
+ * @retval      None
+ */
+static void DebugTxDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    (void)transfer;
+
+    if (event == DMA_EVENT_ABORTED)
+    {
+        return;
+    }
+    if (event == DMA_EVENT_ERROR)
+    {
+        txStats.droppedBytes += txLen;
+    }
+    RingBufConsume(&txRing, txLen);
+    txLen = 0;
+    DebugTxKick();
+}
+
+/*!
+ * @brief       Send bytes by polling the USART, without the ring.
+ *
+ * @param       data:  Bytes
+ *
+ * @param       len:   Number of bytes
+ *
+ * @retval      None
+ *
+ * @note        Used when no DMA stream could be claimed.
+ */
+static void DebugTxBlocking(const uint8_t* data, uint32_t len)
+{
+    while (len-- != 0)
+    {
+        while (USART_ReadStatusFlag(DEBUG_USART, USART_FLAG_TXBE) == RESET);
+        USART_TxData(DEBUG_USART, *data++);
+    }
+}
+
+#if DEBUG_TX_POLICY == DEBUG_TX_POLICY_OVERWRITE
+/*!
+ * @brief       Stop the running transfer and release the bytes already sent.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Called with interrupts masked.
+ */
+static void DebugTxAbort(void)
+{
+    if (txLen == 0)
+    {
+        return;
+    }
+
+    DmaStop(txStream);
+    RingBufConsume(&txRing, txLen - DmaRemaining(txStream));
+    txLen = 0;
+}
 #endif
 
 void DebugInit(void) {
@@ -45,9 +170,146 @@ void DebugInit(void) {
     usartConfig.wordLength = USART_WORD_LEN_8B;
     USART_Config(USART1, &usartConfig);
 
+    /* The DMA manager programs the stream; without one, writes block */
+    txStream = DmaClaim(DEBUG_DMA_REQ, DMA_PRIORITY_LOW, 15);
+    if (txStream != NULL)
+    {
+        USART_EnableDMA(DEBUG_USART, USART_DMA_TX);
+    }
+
     /* Enable USART */
     USART_Enable(USART1);
 #endif
+
+    RingBufInit(&txRing, txBuf, DEBUG_TX_BUF_SIZE);
+    txLen = 0;
+}
+
+/*!
+* @brief       Queue bytes for DMA transmission without waiting for the UART.
+*
+* @param       *ptr:  Buffer pointer for data to be sent.
+*
+* @param       len:  Length of data to be sent.
+*
+* @retval      Number of bytes accepted (all of them, lost bytes are
+*              accounted in DebugTxStats()).
+*
+* @note        Single producer: concurrent callers from thread and ISR
+*              context must serialize themselves.
+*/
+int DebugWrite(const char* ptr, int len)
+{
+    const uint8_t* data = (const uint8_t*)ptr;
+    uint32_t left = (uint32_t)len;
+    uint32_t done, used;
+
+    if (len <= 0)
+    {
+        return 0;
+    }
+
+    if (txStream == NULL)
+    {
+        DebugTxBlocking(data, left);
+        return len;
+    }
+
+#if DEBUG_TX_POLICY == DEBUG_TX_POLICY_OVERWRITE
+    if (left > RingBufFree(&txRing))
+    {
+        CRITICAL_ENTER();
+        uint32_t need = left - RingBufFree(&txRing);
+
+        txStats.overflows++;
+        if (left > RingBufSize(&txRing))
+        {
+            /* Only the newest ring-full of data can survive */
+            txStats.droppedBytes += left - RingBufSize(&txRing);
+            data += left - RingBufSize(&txRing);
+            left = RingBufSize(&txRing);
+            need = left - RingBufFree(&txRing);
+        }
+        DebugTxAbort();
+        if (need > RingBufUsed(&txRing))
+        {
+            need = RingBufUsed(&txRing);
+        }
+        RingBufConsume(&txRing, need);
+        txStats.droppedBytes += need;
+        CRITICAL_EXIT();
+    }
+#endif
+
+    for (;;)
+    {
+        done = RingBufWrite(&txRing, data, left);
+        data += done;
+        left -= done;
+
+        used = RingBufUsed(&txRing);
+        if (used > txStats.highWater)
+        {
+            txStats.highWater = used;
+        }
+
+        {
+            CRITICAL_ENTER();
+            DebugTxKick();
+            CRITICAL_EXIT();
+        }
+
+        if (left == 0)
+        {
+            break;
+        }
+
+#if DEBUG_TX_POLICY == DEBUG_TX_POLICY_BLOCK
+        /* Waiting needs the DMA interrupt, so never block with it masked */
+        if (!CRITICAL_IN_ISR())
+        {
+            while (RingBufFree(&txRing) == 0);
+            continue;
+        }
+#endif
+        txStats.overflows++;
+        txStats.droppedBytes += left;
+        break;
+    }
+
+    return len;
+}
+
+/*!
+* @brief       Wait until every queued byte has left the UART.
+*
+* @param       None
+*
+* @retval      None
+*/
+void DebugFlush(void)
+{
+    if (CRITICAL_IN_ISR())
+    {
+        return;
+    }
+
+    while ((RingBufUsed(&txRing) != 0) || (txLen != 0));
+    while (USART_ReadStatusFlag(DEBUG_USART, USART_FLAG_TXC) == RESET);
+}
+
+/*!
+* @brief       Read the transmit counters.
+*
+* @param       stats:  Receives a snapshot of the counters
+*
+* @retval      None
+*/
+void DebugTxStats(DebugTxStats_T* stats)
+{
+    CRITICAL_ENTER();
+    *stats = txStats;
+    CRITICAL_EXIT();
 }
 
 #if defined (__CC_ARM) || defined (__ICCARM__) || (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
@@ -67,11 +329,12 @@ void DebugInit(void) {
 */
 int fputc(int ch, FILE* f)
 {
-    /* send a byte of data to the serial port */
-    USART_TxData(DEBUG_USART, (uint8_t)ch);
+    char c = (char)ch;
 
-    /* wait for the data to be send  */
-    while (USART_ReadStatusFlag(DEBUG_USART, USART_FLAG_TXBE) == RESET);
+    UNUSED(f);
+
+    /* queue a byte of data for the serial port */
+    DebugWrite(&c, 1);
 
     return (ch);
 }
@@ -90,11 +353,10 @@ int fputc(int ch, FILE* f)
 */
 int __io_putchar(int ch)
 {
-    /* send a byte of data to the serial port */
-    USART_TxData(DEBUG_USART, ch);
+    char c = (char)ch;
 
-    /* wait for the data to be send  */
-    while (USART_ReadStatusFlag(DEBUG_USART, USART_FLAG_TXBE) == RESET);
+    /* queue a byte of data for the serial port */
+    DebugWrite(&c, 1);
 
     return ch;
 }
@@ -115,16 +377,9 @@ int __io_putchar(int ch)
 */
 int _write(int file, char* ptr, int len)
 {
-    int i;
-
     UNUSED(file);
 
-    for (i = 0; i < len; i++)
-    {
-        __io_putchar(*ptr++);
-    }
-
-    return len;
+    return DebugWrite(ptr, len);
 }
 
 int _close(int file) { (void)file; return -1; }
@@ -5,11 +5,49 @@
 #define DEBUG_USART2 2
 #define DEBUG_USART3 3
 
+/* Overflow policies for the DMA transmit ring */
+#define DEBUG_TX_POLICY_DROP        0   /* Discard new bytes that do not fit */
+#define DEBUG_TX_POLICY_OVERWRITE   1   /* Discard oldest queued bytes */
+#define DEBUG_TX_POLICY_BLOCK       2   /* Wait for room (drops when called from an ISR) */
+
+#ifndef DEBUG_TX_POLICY
+#define DEBUG_TX_POLICY DEBUG_TX_POLICY_DROP
+#endif
+
+/* Transmit ring size in bytes, must be a power of two */
+#ifndef DEBUG_TX_BUF_SIZE
+#define DEBUG_TX_BUF_SIZE 1024
+#endif
+
+/* Largest chunk handed to DMA at once, bounds the bytes pinned by a transfer */
+#ifndef DEBUG_TX_CHUNK_MAX
+#define DEBUG_TX_CHUNK_MAX 64
+#endif
+
 #ifdef DEBUG
+#include <stdint.h>
 #include <stdio.h>
 
+/**
+ * @brief Debug transmit counters
+ */
+typedef struct
+{
+    uint32_t droppedBytes;  /*!< Bytes lost to overflow or transfer errors */
+    uint32_t overflows;     /*!< Number of writes that hit a full ring */
+    uint32_t highWater;     /*!< Maximum ring occupancy seen */
+} DebugTxStats_T;
+
 void DebugInit(void);
 
+/* Single producer: the ring has one writer, so a thread and an interrupt
+   that can both write must serialize (e.g. CRITICAL_ENTER() around the
+   thread's write); unserialized, bytes of the two writes can be lost or
+   corrupted, not just interleaved */
+int DebugWrite(const char* ptr, int len);
+void DebugFlush(void);
+void DebugTxStats(DebugTxStats_T* stats);
+
 #define PRINT(...) printf(__VA_ARGS__)
 #else
 #define PRINT(...)
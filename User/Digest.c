@@ -0,0 +1,401 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "Digest.h"
+#include "Sha256.h"
+
+#define DIGEST_ROL(x, n)    (((x) << (n)) | ((x) >> (32U - (n))))
+
+/* MD5 sine constants and per-round shift amounts (RFC 1321) */
+static const uint32_t md5K[64] =
+{
+    0xD76AA478U, 0xE8C7B756U, 0x242070DBU, 0xC1BDCEEEU,
+    0xF57C0FAFU, 0x4787C62AU, 0xA8304613U, 0xFD469501U,
+    0x698098D8U, 0x8B44F7AFU, 0xFFFF5BB1U, 0x895CD7BEU,
+    0x6B901122U, 0xFD987193U, 0xA679438EU, 0x49B40821U,
+    0xF61E2562U, 0xC040B340U, 0x265E5A51U, 0xE9B6C7AAU,
+    0xD62F105DU, 0x02441453U, 0xD8A1E681U, 0xE7D3FBC8U,
+    0x21E1CDE6U, 0xC33707D6U, 0xF4D50D87U, 0x455A14EDU,
+    0xA9E3E905U, 0xFCEFA3F8U, 0x676F02D9U, 0x8D2A4C8AU,
+    0xFFFA3942U, 0x8771F681U, 0x6D9D6122U, 0xFDE5380CU,
+    0xA4BEEA44U, 0x4BDECFA9U, 0xF6BB4B60U, 0xBEBFBC70U,
+    0x289B7EC6U, 0xEAA127FAU, 0xD4EF3085U, 0x04881D05U,
+    0xD9D4D039U, 0xE6DB99E5U, 0x1FA27CF8U, 0xC4AC5665U,
+    0xF4292244U, 0x432AFF97U, 0xAB9423A7U, 0xFC93A039U,
+    0x655B59C3U, 0x8F0CCC92U, 0xFFEFF47DU, 0x85845DD1U,
+    0x6FA87E4FU, 0xFE2CE6E0U, 0xA3014314U, 0x4E0811A1U,
+    0xF7537E82U, 0xBD3AF235U, 0x2AD7D2BBU, 0xEB86D391U
+};
+
+static const uint8_t md5Shift[16] =
+{
+    7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21
+};
+
+static inline uint32_t DigestLoadBe(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return __builtin_bswap32(word);
+}
+
+static inline uint32_t DigestLoadLe(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return word;
+}
+
+/*!
+ * @brief       SHA-1 compression of whole blocks.
+ *
+ * @param       state:   Chaining value
+ *
+ * @param       data:    Blocks, any alignment
+ *
+ * @param       blocks:  Number of 64-byte blocks
+ *
+ * @retval      None
+ *
+ * @note        The message schedule is kept in a 16-word ring; each of the
+ *              four round groups is its own loop so the round function has
+ *              no branches.
+ */
+static void Sha1Blocks(uint32_t* state, const uint8_t* data, uint32_t blocks)
+{
+    uint32_t w[16];
+    uint32_t a, b, c, d, e, t;
+    uint32_t i;
+
+#define SHA1_SCHEDULE(i)    (w[(i) & 15U] = DIGEST_ROL(w[((i) + 13U) & 15U] ^ w[((i) + 8U) & 15U] ^ \
+                                                       w[((i) + 2U) & 15U] ^ w[(i) & 15U], 1U))
+#define SHA1_ROUND(f, k, x) \
+    do { \
+        t = DIGEST_ROL(a, 5U) + (f) + e + (k) + (x); \
+        e = d; \
+        d = c; \
+        c = DIGEST_ROL(b, 30U); \
+        b = a; \
+        a = t; \
+    } while (0)
+
+    for (; blocks != 0U; blocks--, data += DIGEST_BLOCK_SIZE)
+    {
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+
+        for (i = 0; i < 16U; i++)
+        {
+            w[i] = DigestLoadBe(data + 4U * i);
+            SHA1_ROUND(d ^ (b & (c ^ d)), 0x5A827999U, w[i]);
+        }
+        for (; i < 20U; i++)
+        {
+            SHA1_ROUND(d ^ (b & (c ^ d)), 0x5A827999U, SHA1_SCHEDULE(i));
+        }
+        for (; i < 40U; i++)
+        {
+            SHA1_ROUND(b ^ c ^ d, 0x6ED9EBA1U, SHA1_SCHEDULE(i));
+        }
+        for (; i < 60U; i++)
+        {
+            SHA1_ROUND((b & c) | (d & (b | c)), 0x8F1BBCDCU, SHA1_SCHEDULE(i));
+        }
+        for (; i < 80U; i++)
+        {
+            SHA1_ROUND(b ^ c ^ d, 0xCA62C1D6U, SHA1_SCHEDULE(i));
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+
+#undef SHA1_SCHEDULE
+#undef SHA1_ROUND
+}
+
+/*!
+ * @brief       MD5 compression of whole blocks.
+ *
+ * @param       state:   Chaining value
+ *
+ * @param       data:    Blocks, any alignment
+ *
+ * @param       blocks:  Number of 64-byte blocks
+ *
+ * @retval      None
+ */
+static void Md5Blocks(uint32_t* state, const uint8_t* data, uint32_t blocks)
+{
+    uint32_t m[16];
+    uint32_t a, b, c, d, f, t;
+    uint32_t i;
+
+#define MD5_ROUND(f, g) \
+    do { \
+        t = a + (f) + md5K[i] + m[g]; \
+        a = d; \
+        d = c; \
+        c = b; \
+        b += DIGEST_ROL(t, md5Shift[(((i) >> 2) & 12U) | ((i) & 3U)]); \
+    } while (0)
+
+    for (; blocks != 0U; blocks--, data += DIGEST_BLOCK_SIZE)
+    {
+        for (i = 0; i < 16U; i++)
+        {
+            m[i] = DigestLoadLe(data + 4U * i);
+        }
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+
+        for (i = 0; i < 16U; i++)
+        {
+            f = d ^ (b & (c ^ d));
+            MD5_ROUND(f, i);
+        }
+        for (; i < 32U; i++)
+        {
+            f = c ^ (d & (b ^ c));
+            MD5_ROUND(f, (5U * i + 1U) & 15U);
+        }
+        for (; i < 48U; i++)
+        {
+            f = b ^ c ^ d;
+            MD5_ROUND(f, (3U * i + 5U) & 15U);
+        }
+        for (; i < 64U; i++)
+        {
+            f = c ^ (b | ~d);
+            MD5_ROUND(f, (7U * i) & 15U);
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+    }
+
+#undef MD5_ROUND
+}
+
+static void DigestBlocks(DigestContext_T* ctx, const uint8_t* data, uint32_t blocks)
+{
+    switch (ctx->algo)
+    {
+        case DIGEST_SHA1:
+            Sha1Blocks(ctx->state, data, blocks);
+            break;
+        case DIGEST_MD5:
+            Md5Blocks(ctx->state, data, blocks);
+            break;
+        default:
+            Sha256Blocks(ctx->state, data, blocks);
+            break;
+    }
+}
+
+/*!
+ * @brief       Digest size of an algorithm.
+ *
+ * @param       algo:  Algorithm
+ *
+ * @retval      Bytes
+ */
+uint32_t DigestSize(DigestAlgo_T algo)
+{
+    switch (algo)
+    {
+        case DIGEST_SHA1:
+            return 20U;
+        case DIGEST_MD5:
+            return 16U;
+        default:
+            return SHA256_DIGEST_SIZE;
+    }
+}
+
+/*!
+ * @brief       Start a digest session.
+ *
+ * @param       ctx:   Session to initialize
+ *
+ * @param       algo:  DIGEST_SHA1, DIGEST_MD5 or DIGEST_SHA256
+ *
+ * @retval      SUCCESS or ERROR (unknown algorithm)
+ */
+uint8_t DigestInit(DigestContext_T* ctx, DigestAlgo_T algo)
+{
+    static const uint32_t sha1Iv[5] = { 0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U, 0xC3D2E1F0U };
+    static const uint32_t sha256Iv[8] =
+    {
+        0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+    };
+
+    switch (algo)
+    {
+        case DIGEST_SHA1:
+        case DIGEST_MD5:
+            /* MD5 starts from the first four SHA-1 words */
+            memcpy(ctx->state, sha1Iv, sizeof(sha1Iv));
+            break;
+        case DIGEST_SHA256:
+            memcpy(ctx->state, sha256Iv, sizeof(sha256Iv));
+            break;
+        default:
+            return ERROR;
+    }
+    ctx->lengthLow = 0;
+    ctx->lengthHigh = 0;
+    ctx->fill = 0;
+    ctx->algo = (uint8_t)algo;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Add message bytes.
+ *
+ * @param       ctx:     Session from DigestInit()
+ *
+ * @param       data:    Bytes, any alignment
+ *
+ * @param       length:  Number of bytes, any value
+ *
+ * @retval      None
+ */
+void DigestUpdate(DigestContext_T* ctx, const void* data, uint32_t length)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t take;
+
+    ctx->lengthLow += length;
+    if (ctx->lengthLow < length)
+    {
+        ctx->lengthHigh++;
+    }
+
+    /* Complete a block left by an earlier update */
+    if (ctx->fill != 0U)
+    {
+        take = DIGEST_BLOCK_SIZE - ctx->fill;
+        if (take > length)
+        {
+            take = length;
+        }
+        memcpy(ctx->block + ctx->fill, p, take);
+        ctx->fill += (uint8_t)take;
+        p += take;
+        length -= take;
+        if (ctx->fill < DIGEST_BLOCK_SIZE)
+        {
+            return;
+        }
+        DigestBlocks(ctx, ctx->block, 1);
+        ctx->fill = 0;
+    }
+
+    /* Whole blocks straight from the caller's buffer */
+    if (length >= DIGEST_BLOCK_SIZE)
+    {
+        DigestBlocks(ctx, p, length / DIGEST_BLOCK_SIZE);
+        p += length & ~(DIGEST_BLOCK_SIZE - 1U);
+        length %= DIGEST_BLOCK_SIZE;
+    }
+
+    if (length != 0U)
+    {
+        memcpy(ctx->block, p, length);
+        ctx->fill = (uint8_t)length;
+    }
+}
+
+/*!
+ * @brief       Pad, write the digest and end the session.
+ *
+ * @param       ctx:     Session from DigestInit()
+ *
+ * @param       digest:  Receives DigestSize() bytes
+ *
+ * @retval      Digest size in bytes
+ *
+ * @note        The context is cleared; call DigestInit() to reuse it.
+ */
+uint32_t DigestFinal(DigestContext_T* ctx, uint8_t* digest)
+{
+    uint32_t bitsLow = ctx->lengthLow << 3;
+    uint32_t bitsHigh = (ctx->lengthHigh << 3) | (ctx->lengthLow >> 29);
+    uint32_t size = DigestSize((DigestAlgo_T)ctx->algo);
+    uint32_t i, word;
+
+    ctx->block[ctx->fill++] = 0x80;
+    if (ctx->fill > DIGEST_BLOCK_SIZE - 8U)
+    {
+        memset(ctx->block + ctx->fill, 0, DIGEST_BLOCK_SIZE - ctx->fill);
+        DigestBlocks(ctx, ctx->block, 1);
+        ctx->fill = 0;
+    }
+    memset(ctx->block + ctx->fill, 0, DIGEST_BLOCK_SIZE - 8U - ctx->fill);
+
+    /* Bit length: big-endian for SHA, little-endian for MD5 */
+    if (ctx->algo != DIGEST_MD5)
+    {
+        bitsHigh = __builtin_bswap32(bitsHigh);
+        bitsLow = __builtin_bswap32(bitsLow);
+        memcpy(ctx->block + 56, &bitsHigh, 4);
+        memcpy(ctx->block + 60, &bitsLow, 4);
+    }
+    else
+    {
+        memcpy(ctx->block + 56, &bitsLow, 4);
+        memcpy(ctx->block + 60, &bitsHigh, 4);
+    }
+    DigestBlocks(ctx, ctx->block, 1);
+
+    for (i = 0; i < size / 4U; i++)
+    {
+        word = (ctx->algo != DIGEST_MD5) ? __builtin_bswap32(ctx->state[i]) : ctx->state[i];
+        memcpy(digest + 4U * i, &word, 4);
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+
+    return size;
+}
+
+/*!
+ * @brief       Digest of one buffer.
+ *
+ * @param       algo:    DIGEST_SHA1, DIGEST_MD5 or DIGEST_SHA256
+ *
+ * @param       data:    Bytes, any alignment
+ *
+ * @param       length:  Number of bytes
+ *
+ * @param       digest:  Receives DigestSize() bytes
+ *
+ * @retval      Digest size in bytes, 0 for an unknown algorithm
+ */
+uint32_t DigestCompute(DigestAlgo_T algo, const void* data, uint32_t length, uint8_t* digest)
+{
+    DigestContext_T ctx;
+
+    if (DigestInit(&ctx, algo) != SUCCESS)
+    {
+        return 0;
+    }
+    DigestUpdate(&ctx, data, length);
+
+    return DigestFinal(&ctx, digest);
+}
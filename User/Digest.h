@@ -0,0 +1,50 @@
+#ifndef DIGEST_H
+#define DIGEST_H
+
+#include <stdint.h>
+
+/*
+ * Incremental message digests: init, any number of updates, final.
+ *
+ * Each session keeps its whole state in its DigestContext_T, so any
+ * number of sessions can be open at once and interleaved freely, for
+ * example one hashing a flash region while another hashes packets. An
+ * update takes any length at any alignment; bytes that do not complete a
+ * 64-byte block wait in the context for the next update, and whole
+ * blocks are compressed straight from the caller's buffer.
+ *
+ * The APM32F407 has no HASH accelerator, so the compression functions run
+ * on the CPU. DigestCompute() is the one-shot form.
+ */
+
+#define DIGEST_BLOCK_SIZE   64U
+#define DIGEST_MAX_SIZE     32U
+
+typedef enum
+{
+    DIGEST_SHA1,        /*!< 20-byte digest */
+    DIGEST_MD5,         /*!< 16-byte digest */
+    DIGEST_SHA256       /*!< 32-byte digest, see Sha256.h */
+} DigestAlgo_T;
+
+/**
+ * @brief Digest session; treat as opaque
+ */
+typedef struct
+{
+    uint32_t    state[8];                   /*!< Chaining value */
+    uint32_t    lengthLow;                  /*!< Message bytes so far, low word */
+    uint32_t    lengthHigh;                 /*!< High word */
+    uint8_t     block[DIGEST_BLOCK_SIZE];   /*!< Bytes of an incomplete block */
+    uint8_t     fill;                       /*!< Bytes in block[] */
+    uint8_t     algo;                       /*!< DigestAlgo_T */
+} DigestContext_T;
+
+uint8_t DigestInit(DigestContext_T* ctx, DigestAlgo_T algo);
+void DigestUpdate(DigestContext_T* ctx, const void* data, uint32_t length);
+uint32_t DigestFinal(DigestContext_T* ctx, uint8_t* digest);
+
+uint32_t DigestSize(DigestAlgo_T algo);
+uint32_t DigestCompute(DigestAlgo_T algo, const void* data, uint32_t length, uint8_t* digest);
+
+#endif // DIGEST_H
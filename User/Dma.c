@@ -0,0 +1,598 @@
+#include <stddef.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_dma.h"
+#include "apm32f4xx_misc.h"
+#include "apm32f4xx_rcm.h"
+#include "Critical.h"
+#include "Dma.h"
+
+/* SCFG and FCTRL fields, written whole when a transfer starts */
+#define DMA_SCFG_EN         (1UL << 0)
+#define DMA_SCFG_DMEIEN     (1UL << 1)
+#define DMA_SCFG_TXEIEN     (1UL << 2)
+#define DMA_SCFG_HTXIEN     (1UL << 3)
+#define DMA_SCFG_TXCIEN     (1UL << 4)
+#define DMA_SCFG_DIR_POS    6U
+#define DMA_SCFG_CIRCMEN    (1UL << 8)
+#define DMA_SCFG_PERIM      (1UL << 9)
+#define DMA_SCFG_MEMIM      (1UL << 10)
+#define DMA_SCFG_PSIZE_POS  11U
+#define DMA_SCFG_MSIZE_POS  13U
+#define DMA_SCFG_PRIL_POS   16U
+#define DMA_SCFG_PBURST_POS 21U
+#define DMA_SCFG_MBURST_POS 23U
+#define DMA_SCFG_DBM        (1UL << 18)
+#define DMA_SCFG_CHSEL_POS  25U
+
+#define DMA_FCTRL_DMDEN     (1UL << 2)
+
+/* Stream flags in LINTSTS/HINTSTS, before the per-stream shift */
+#define DMA_STS_FE          (1UL << 0)
+#define DMA_STS_DME         (1UL << 2)
+#define DMA_STS_TE          (1UL << 3)
+#define DMA_STS_HT          (1UL << 4)
+#define DMA_STS_TC          (1UL << 5)
+#define DMA_STS_ALL         (DMA_STS_FE | DMA_STS_DME | DMA_STS_TE | DMA_STS_HT | DMA_STS_TC)
+
+/* FIFO depth in bytes */
+#define DMA_FIFO_SIZE       16U
+
+/**
+ * @brief One (stream, channel) pair a request can use
+ */
+typedef struct
+{
+    uint8_t request;    /*!< DmaRequest_T */
+    uint8_t dma;        /*!< 1 or 2 */
+    uint8_t stream;
+    uint8_t channel;
+} DmaRoute_T;
+
+/*
+ * Request mapping of the APM32F407 (reference manual, DMA1/DMA2 request
+ * mapping). Routes of one request are tried in table order. Memory to
+ * memory takes the DMA2 streams with the fewest peripheral routes first.
+ */
+static const DmaRoute_T dmaRoutes[] =
+{
+    { DMA_REQ_MEM2MEM,      2, 4, 0 },
+    { DMA_REQ_MEM2MEM,      2, 6, 0 },
+    { DMA_REQ_MEM2MEM,      2, 0, 0 },
+    { DMA_REQ_MEM2MEM,      2, 3, 0 },
+    { DMA_REQ_MEM2MEM,      2, 5, 0 },
+    { DMA_REQ_MEM2MEM,      2, 7, 0 },
+    { DMA_REQ_MEM2MEM,      2, 1, 0 },
+    { DMA_REQ_MEM2MEM,      2, 2, 0 },
+    { DMA_REQ_ADC1,         2, 0, 0 },
+    { DMA_REQ_ADC1,         2, 4, 0 },
+    { DMA_REQ_ADC2,         2, 2, 1 },
+    { DMA_REQ_ADC2,         2, 3, 1 },
+    { DMA_REQ_ADC3,         2, 0, 2 },
+    { DMA_REQ_ADC3,         2, 1, 2 },
+    { DMA_REQ_DAC1,         1, 5, 7 },
+    { DMA_REQ_DAC2,         1, 6, 7 },
+    { DMA_REQ_SPI1_RX,      2, 0, 3 },
+    { DMA_REQ_SPI1_RX,      2, 2, 3 },
+    { DMA_REQ_SPI1_TX,      2, 3, 3 },
+    { DMA_REQ_SPI1_TX,      2, 5, 3 },
+    { DMA_REQ_SPI2_RX,      1, 3, 0 },
+    { DMA_REQ_SPI2_TX,      1, 4, 0 },
+    { DMA_REQ_SPI3_RX,      1, 0, 0 },
+    { DMA_REQ_SPI3_RX,      1, 2, 0 },
+    { DMA_REQ_SPI3_TX,      1, 5, 0 },
+    { DMA_REQ_SPI3_TX,      1, 7, 0 },
+    { DMA_REQ_I2S2EXT_RX,   1, 3, 3 },
+    { DMA_REQ_I2S2EXT_TX,   1, 4, 2 },
+    { DMA_REQ_I2S3EXT_RX,   1, 0, 3 },
+    { DMA_REQ_I2S3EXT_RX,   1, 2, 2 },
+    { DMA_REQ_I2S3EXT_TX,   1, 5, 2 },
+    { DMA_REQ_USART1_RX,    2, 2, 4 },
+    { DMA_REQ_USART1_RX,    2, 5, 4 },
+    { DMA_REQ_USART1_TX,    2, 7, 4 },
+    { DMA_REQ_USART2_RX,    1, 5, 4 },
+    { DMA_REQ_USART2_TX,    1, 6, 4 },
+    { DMA_REQ_USART3_RX,    1, 1, 4 },
+    { DMA_REQ_USART3_TX,    1, 3, 4 },
+    { DMA_REQ_USART3_TX,    1, 4, 7 },
+    { DMA_REQ_UART4_RX,     1, 2, 4 },
+    { DMA_REQ_UART4_TX,     1, 4, 4 },
+    { DMA_REQ_UART5_RX,     1, 0, 4 },
+    { DMA_REQ_UART5_TX,     1, 7, 4 },
+    { DMA_REQ_USART6_RX,    2, 1, 5 },
+    { DMA_REQ_USART6_RX,    2, 2, 5 },
+    { DMA_REQ_USART6_TX,    2, 6, 5 },
+    { DMA_REQ_USART6_TX,    2, 7, 5 },
+    { DMA_REQ_I2C1_RX,      1, 0, 1 },
+    { DMA_REQ_I2C1_RX,      1, 5, 1 },
+    { DMA_REQ_I2C1_TX,      1, 6, 1 },
+    { DMA_REQ_I2C1_TX,      1, 7, 1 },
+    { DMA_REQ_I2C2_RX,      1, 2, 7 },
+    { DMA_REQ_I2C2_RX,      1, 3, 7 },
+    { DMA_REQ_I2C2_TX,      1, 7, 7 },
+    { DMA_REQ_I2C3_RX,      1, 2, 3 },
+    { DMA_REQ_I2C3_TX,      1, 4, 3 },
+    { DMA_REQ_SDIO,         2, 3, 4 },
+    { DMA_REQ_SDIO,         2, 6, 4 },
+    { DMA_REQ_DCMI,         2, 1, 1 },
+    { DMA_REQ_DCMI,         2, 7, 1 },
+    { DMA_REQ_TMR1_UP,      2, 5, 6 },
+    { DMA_REQ_TMR2_UP,      1, 1, 3 },
+    { DMA_REQ_TMR2_UP,      1, 7, 3 },
+    { DMA_REQ_TMR6_UP,      1, 1, 7 },
+    { DMA_REQ_TMR7_UP,      1, 2, 1 },
+    { DMA_REQ_TMR7_UP,      1, 4, 1 },
+    { DMA_REQ_TMR8_UP,      2, 1, 7 },
+};
+
+static DMA_Stream_T* const dmaRegs[DMA_STREAM_COUNT] =
+{
+    DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+    DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+    DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+    DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7,
+};
+
+static const IRQn_Type dmaIrq[DMA_STREAM_COUNT] =
+{
+    DMA1_STR0_IRQn, DMA1_STR1_IRQn, DMA1_STR2_IRQn, DMA1_STR3_IRQn,
+    DMA1_STR4_IRQn, DMA1_STR5_IRQn, DMA1_STR6_IRQn, DMA1_STR7_IRQn,
+    DMA2_STR0_IRQn, DMA2_STR1_IRQn, DMA2_STR2_IRQn, DMA2_STR3_IRQn,
+    DMA2_STR4_IRQn, DMA2_STR5_IRQn, DMA2_STR6_IRQn, DMA2_STR7_IRQn,
+};
+
+/* Flag position of streams 0-3 in LINTSTS (4-7 in HINTSTS) */
+static const uint8_t dmaFlagShift[4] = { 0, 6, 16, 22 };
+
+static DmaStream_T dmaStreams[DMA_STREAM_COUNT];
+
+/* Flag status and clear registers of a stream, and its shift in them */
+static inline uint32_t DmaStatus(const DmaStream_T* stream)
+{
+    return ((stream->index & 4U) != 0) ? stream->dma->HINTSTS : stream->dma->LINTSTS;
+}
+
+static inline volatile uint32_t* DmaClearReg(const DmaStream_T* stream)
+{
+    return ((stream->index & 4U) != 0) ? &stream->dma->HIFCLR : &stream->dma->LIFCLR;
+}
+
+static inline uint32_t DmaShift(const DmaStream_T* stream)
+{
+    return dmaFlagShift[stream->index & 3U];
+}
+
+/* log2 of an item size of 1, 2 or 4 bytes */
+static inline uint32_t DmaSizeCode(uint32_t size)
+{
+    return size >> 1;
+}
+
+/*!
+ * @brief       Choose direct mode or FIFO, memory access width and bursts.
+ *
+ * @param       transfer:  Transfer
+ *
+ * @param       dir:       DMA_DIR_T
+ *
+ * @param       fctrl:     Receives the FCTRL value
+ *
+ * @retval      SCFG size and burst fields
+ *
+ * @note        The memory side is widened to halfwords or words when the
+ *              address and the byte count allow it, which needs the FIFO.
+ *              A burst is used when the address is aligned to it (so it
+ *              cannot cross a 1 KiB boundary) and the byte count is a
+ *              multiple of it; the FIFO threshold is set to one burst.
+ *              Peripheral-to-memory transfers stay in direct mode unless
+ *              they can pack, and circular or double-buffered ones always
+ *              do, so data read from the peripheral is in memory when NDATA
+ *              says so. DMA_XFER_PERIPH_BURST always uses the FIFO, with
+ *              INC4 on the peripheral port.
+ */
+static uint32_t DmaFifoConfig(const DmaTransfer_T* transfer, uint32_t dir, uint32_t* fctrl)
+{
+    uint32_t psize = transfer->size;
+    uint32_t msize = psize;
+    uint32_t memory = transfer->memory;
+    uint32_t bytes = (uint32_t)transfer->count * psize;
+    uint32_t burst = 0, pburst = 0;
+    uint32_t threshold = 8U;
+    uint32_t beats, scfg;
+    uint8_t fifo;
+
+    /* Both buffers of a double-buffered transfer must allow the choice */
+    if ((transfer->flags & DMA_XFER_DOUBLE) != 0)
+    {
+        memory |= transfer->memory1;
+    }
+
+    if ((transfer->flags & DMA_XFER_MEM_FIXED) == 0)
+    {
+        for (msize = 4U; msize > psize; msize >>= 1)
+        {
+            if (((memory & (msize - 1U)) == 0) && ((bytes & (msize - 1U)) == 0))
+            {
+                break;
+            }
+        }
+    }
+
+    if ((transfer->flags & DMA_XFER_PERIPH_BURST) != 0)
+    {
+        /* Bursts need the FIFO either way */
+        fifo = 1;
+    }
+    else if (dir == DMA_DIR_PERIPHERALTOMEMORY)
+    {
+        fifo = (msize != psize) && ((transfer->flags & (DMA_XFER_CIRCULAR | DMA_XFER_DOUBLE)) == 0);
+        if (!fifo)
+        {
+            msize = psize;
+        }
+    }
+    else
+    {
+        /* Memory to memory needs the FIFO; it prefetches memory to peripheral */
+        fifo = 1;
+    }
+
+    if (fifo && ((transfer->flags & DMA_XFER_MEM_FIXED) == 0))
+    {
+        for (beats = 16U; beats >= 4U; beats >>= 1)
+        {
+            uint32_t span = beats * msize;
+
+            if ((span <= DMA_FIFO_SIZE) && ((memory & (span - 1U)) == 0) && ((bytes & (span - 1U)) == 0))
+            {
+                burst = (beats == 4U) ? 1U : ((beats == 8U) ? 2U : 3U);
+                threshold = span;
+                break;
+            }
+        }
+    }
+
+    /* Memory to memory: the source on the peripheral port can burst too */
+    if (dir == DMA_DIR_MEMORYTOMEMORY)
+    {
+        for (beats = 16U; beats >= 4U; beats >>= 1)
+        {
+            uint32_t span = beats * psize;
+
+            if ((span <= threshold) && ((threshold % span) == 0) &&
+                ((transfer->peripheral & (span - 1U)) == 0) && ((bytes & (span - 1U)) == 0))
+            {
+                pburst = (beats == 4U) ? 1U : ((beats == 8U) ? 2U : 3U);
+                break;
+            }
+        }
+    }
+
+    /* A peripheral that raises burst requests gets INC4 on its port; the
+       threshold must hold one such burst */
+    if ((transfer->flags & DMA_XFER_PERIPH_BURST) != 0)
+    {
+        pburst = 1U;
+        if (threshold < 4U * psize)
+        {
+            threshold = 4U * psize;
+        }
+    }
+
+    /* Threshold of 4, 8 or 16 bytes: quarter, half, full */
+    *fctrl = fifo ? (DMA_FCTRL_DMDEN | ((threshold == 4U) ? 0U : ((threshold == 8U) ? 1U : 3U))) : 0U;
+
+    scfg = (DmaSizeCode(psize) << DMA_SCFG_PSIZE_POS) | (DmaSizeCode(msize) << DMA_SCFG_MSIZE_POS) |
+           (pburst << DMA_SCFG_PBURST_POS) | (burst << DMA_SCFG_MBURST_POS);
+
+    return scfg;
+}
+
+/* Program and enable the stream for a transfer; interrupts masked */
+static void DmaStart(DmaStream_T* stream, DmaTransfer_T* transfer)
+{
+    DMA_Stream_T* regs = stream->regs;
+    uint32_t dir = (stream->request == DMA_REQ_MEM2MEM) ? DMA_DIR_MEMORYTOMEMORY : transfer->dir;
+    uint32_t fctrl;
+    uint32_t scfg = DmaFifoConfig(transfer, dir, &fctrl);
+
+    scfg |= ((uint32_t)stream->channel << DMA_SCFG_CHSEL_POS) | stream->priority |
+            (dir << DMA_SCFG_DIR_POS) | DMA_SCFG_TXCIEN | DMA_SCFG_TXEIEN;
+    if ((transfer->flags & DMA_XFER_MEM_FIXED) == 0)
+    {
+        scfg |= DMA_SCFG_MEMIM;
+    }
+    if (dir == DMA_DIR_MEMORYTOMEMORY)
+    {
+        scfg |= DMA_SCFG_PERIM;
+    }
+    else if ((transfer->flags & DMA_XFER_DOUBLE) != 0)
+    {
+        scfg |= DMA_SCFG_CIRCMEN | DMA_SCFG_DBM;
+    }
+    else if ((transfer->flags & DMA_XFER_CIRCULAR) != 0)
+    {
+        scfg |= DMA_SCFG_CIRCMEN;
+    }
+    if ((transfer->flags & DMA_XFER_HALF) != 0)
+    {
+        scfg |= DMA_SCFG_HTXIEN;
+    }
+    if ((fctrl & DMA_FCTRL_DMDEN) == 0)
+    {
+        scfg |= DMA_SCFG_DMEIEN;
+    }
+
+    regs->SCFG = 0;
+    while ((regs->SCFG & DMA_SCFG_EN) != 0)
+    {
+    }
+    *DmaClearReg(stream) = DMA_STS_ALL << DmaShift(stream);
+
+    regs->PADDR = transfer->peripheral;
+    regs->M0ADDR = transfer->memory;
+    regs->M1ADDR = transfer->memory1;
+    regs->NDATA = transfer->count;
+    regs->FCTRL = fctrl;
+    regs->SCFG = scfg;
+    regs->SCFG = scfg | DMA_SCFG_EN;
+}
+
+/*!
+ * @brief       Claim a free stream routed to a request.
+ *
+ * @param       request:      Peripheral request, or DMA_REQ_MEM2MEM
+ *
+ * @param       priority:     Stream priority between the streams of one controller
+ *
+ * @param       irqPriority:  NVIC preemption priority of the stream interrupt
+ *
+ * @retval      Stream, or NULL when every stream of the request is taken
+ *
+ * @note        Enables the controller clock and the stream interrupt.
+ */
+DmaStream_T* DmaClaim(DmaRequest_T request, DMA_PRIORITY_T priority, uint32_t irqPriority)
+{
+    DmaStream_T* stream = NULL;
+    const DmaRoute_T* route;
+    uint32_t index;
+
+    if ((uint32_t)request >= DMA_REQ_COUNT)
+    {
+        return NULL;
+    }
+
+    CRITICAL_ENTER();
+    for (route = dmaRoutes; route < &dmaRoutes[sizeof(dmaRoutes) / sizeof(dmaRoutes[0])]; route++)
+    {
+        index = DMA_STREAM_INDEX(route->dma, route->stream);
+        if ((route->request == request) && !dmaStreams[index].claimed)
+        {
+            stream = &dmaStreams[index];
+            stream->claimed = 1;
+            break;
+        }
+    }
+    CRITICAL_EXIT();
+
+    if (stream == NULL)
+    {
+        return NULL;
+    }
+
+    stream->regs = dmaRegs[index];
+    stream->dma = (route->dma == 1) ? DMA1 : DMA2;
+    stream->index = (uint8_t)index;
+    stream->channel = route->channel;
+    stream->request = (uint8_t)request;
+    stream->priority = (uint32_t)priority << DMA_SCFG_PRIL_POS;
+    stream->active = NULL;
+    stream->head = NULL;
+    stream->tail = NULL;
+
+    RCM_EnableAHB1PeriphClock((route->dma == 1) ? RCM_AHB1_PERIPH_DMA1 : RCM_AHB1_PERIPH_DMA2);
+    NVIC_EnableIRQRequest(dmaIrq[index], (uint8_t)irqPriority, 0);
+
+    return stream;
+}
+
+/*!
+ * @brief       Stop a stream and give it back.
+ *
+ * @param       stream:  Claimed stream
+ *
+ * @retval      None
+ */
+void DmaRelease(DmaStream_T* stream)
+{
+    DmaStop(stream);
+    NVIC_DisableIRQRequest(dmaIrq[stream->index]);
+    stream->claimed = 0;
+}
+
+/*!
+ * @brief       Queue a transfer on a stream.
+ *
+ * @param       stream:    Claimed stream
+ *
+ * @param       transfer:  Filled in by the caller, untouched until its
+ *                         final callback; count items of size bytes
+ *
+ * @retval      SUCCESS, or ERROR for an invalid transfer
+ *
+ * @note        Starts at once on an idle stream, otherwise when the
+ *              transfers queued before it are done. Transfers behind a
+ *              circular or double-buffered one wait for DmaStop(). Memory
+ *              to memory cannot be circular. Callable from interrupts,
+ *              including the callbacks.
+ */
+uint8_t DmaSubmit(DmaStream_T* stream, DmaTransfer_T* transfer)
+{
+    if (!stream->claimed || (transfer->count == 0) ||
+        ((transfer->size != 1U) && (transfer->size != 2U) && (transfer->size != 4U)) ||
+        (((transfer->flags & DMA_XFER_DOUBLE) != 0) && (stream->request == DMA_REQ_MEM2MEM)))
+    {
+        return ERROR;
+    }
+
+    transfer->next = NULL;
+
+    CRITICAL_ENTER();
+    if (stream->active == NULL)
+    {
+        stream->active = transfer;
+        DmaStart(stream, transfer);
+    }
+    else if (stream->head == NULL)
+    {
+        stream->head = transfer;
+        stream->tail = transfer;
+    }
+    else
+    {
+        stream->tail->next = transfer;
+        stream->tail = transfer;
+    }
+    CRITICAL_EXIT();
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stop the running transfer and drop the queued ones.
+ *
+ * @param       stream:  Claimed stream
+ *
+ * @retval      None
+ *
+ * @note        Each dropped transfer gets DMA_EVENT_ABORTED. The running
+ *              one may have moved part of its data.
+ */
+void DmaStop(DmaStream_T* stream)
+{
+    DmaTransfer_T* transfer;
+    DmaTransfer_T* next;
+
+    CRITICAL_ENTER();
+    stream->regs->SCFG &= ~DMA_SCFG_EN;
+    while ((stream->regs->SCFG & DMA_SCFG_EN) != 0)
+    {
+    }
+    *DmaClearReg(stream) = DMA_STS_ALL << DmaShift(stream);
+    NVIC_ClearPendingIRQ(dmaIrq[stream->index]);
+
+    transfer = stream->active;
+    if (transfer != NULL)
+    {
+        transfer->next = stream->head;
+    }
+    else
+    {
+        transfer = stream->head;
+    }
+    stream->active = NULL;
+    stream->head = NULL;
+    stream->tail = NULL;
+    CRITICAL_EXIT();
+
+    for (; transfer != NULL; transfer = next)
+    {
+        next = transfer->next;
+        if (transfer->done != NULL)
+        {
+            transfer->done(transfer, DMA_EVENT_ABORTED);
+        }
+    }
+}
+
+/*!
+ * @brief       Whether a transfer is running or queued.
+ *
+ * @param       stream:  Claimed stream
+ *
+ * @retval      Nonzero while busy
+ */
+uint8_t DmaBusy(const DmaStream_T* stream)
+{
+    return stream->active != NULL;
+}
+
+/*!
+ * @brief       Items the running transfer still has to move (in the
+ *              current pass, for a circular one).
+ *
+ * @param       stream:  Claimed stream
+ *
+ * @retval      NDATA
+ */
+uint16_t DmaRemaining(const DmaStream_T* stream)
+{
+    return (uint16_t)stream->regs->NDATA;
+}
+
+/*!
+ * @brief       Stream interrupt: report the running transfer and start the
+ *              next one.
+ *
+ * @param       index:   DMA_STREAM_INDEX() of the stream
+ *
+ * @retval      None
+ *
+ * @note        Call from every DMAx_STRy_IRQHandler the manager serves.
+ */
+void DmaIRQHandler(uint32_t index)
+{
+    DmaStream_T* stream = &dmaStreams[index];
+    DmaTransfer_T* transfer = stream->active;
+    uint32_t status;
+
+    if (!stream->claimed)
+    {
+        return;
+    }
+
+    status = (DmaStatus(stream) >> DmaShift(stream)) & DMA_STS_ALL;
+    *DmaClearReg(stream) = status << DmaShift(stream);
+
+    if (transfer == NULL)
+    {
+        return;
+    }
+
+    if ((status & (DMA_STS_TE | DMA_STS_DME)) != 0)
+    {
+        stream->regs->SCFG &= ~DMA_SCFG_EN;
+        status = DMA_STS_TE;
+    }
+    else if (((status & DMA_STS_HT) != 0) && ((transfer->flags & DMA_XFER_HALF) != 0) &&
+             (transfer->done != NULL))
+    {
+        transfer->done(transfer, DMA_EVENT_HALF);
+    }
+
+    if ((status & (DMA_STS_TE | DMA_STS_TC)) == 0)
+    {
+        return;
+    }
+
+    if (((status & DMA_STS_TC) != 0) && ((transfer->flags & (DMA_XFER_CIRCULAR | DMA_XFER_DOUBLE)) != 0))
+    {
+        if (transfer->done != NULL)
+        {
+            transfer->done(transfer, DMA_EVENT_DONE);
+        }
+        return;
+    }
+
+    /* Next transfer first, so the stream idles only for the callback's length of time */
+    stream->active = stream->head;
+    if (stream->head != NULL)
+    {
+        stream->head = stream->head->next;
+        DmaStart(stream, stream->active);
+    }
+
+    if (transfer->done != NULL)
+    {
+        transfer->done(transfer, ((status & DMA_STS_TE) != 0) ? DMA_EVENT_ERROR : DMA_EVENT_DONE);
+    }
+}
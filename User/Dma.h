@@ -0,0 +1,148 @@
+#ifndef DMA_H
+#define DMA_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_dma.h"
+
+/*
+ * DMA stream manager for DMA1 and DMA2.
+ *
+ * Each peripheral request reaches only a few (stream, channel) pairs of the
+ * two controllers. DmaClaim() looks the request up in the routing table of
+ * the APM32F407 and hands out the first of its streams that is still free,
+ * or NULL when all of them are taken, so two drivers can no longer program
+ * the same stream. DmaRelease() gives the stream back.
+ *
+ * DmaSubmit() queues a transfer on a claimed stream; queued transfers run
+ * back to back, each started from the interrupt of the previous one, and
+ * each reports to its own callback. All stream interrupts are dispatched by
+ * DmaIRQHandler() (apm32f4xx_int.c). Direct mode, FIFO threshold and memory
+ * burst are derived from the address alignment and length of every
+ * transfer: the widest memory accesses and longest bursts that both allow.
+ */
+
+/* Streams of DMA1 then DMA2, for DmaIRQHandler() */
+#define DMA_STREAM_COUNT        16U
+#define DMA_STREAM_INDEX(dma, stream)   (((dma) - 1U) * 8U + (stream))
+
+/**
+ * @brief DMA requests, routed in Dma.c
+ */
+typedef enum
+{
+    DMA_REQ_MEM2MEM,            /*!< Memory to memory, any DMA2 stream */
+    DMA_REQ_ADC1,
+    DMA_REQ_ADC2,
+    DMA_REQ_ADC3,
+    DMA_REQ_DAC1,
+    DMA_REQ_DAC2,
+    DMA_REQ_SPI1_RX,
+    DMA_REQ_SPI1_TX,
+    DMA_REQ_SPI2_RX,            /*!< Also I2S2 */
+    DMA_REQ_SPI2_TX,
+    DMA_REQ_SPI3_RX,            /*!< Also I2S3 */
+    DMA_REQ_SPI3_TX,
+    DMA_REQ_I2S2EXT_RX,
+    DMA_REQ_I2S2EXT_TX,
+    DMA_REQ_I2S3EXT_RX,
+    DMA_REQ_I2S3EXT_TX,
+    DMA_REQ_USART1_RX,
+    DMA_REQ_USART1_TX,
+    DMA_REQ_USART2_RX,
+    DMA_REQ_USART2_TX,
+    DMA_REQ_USART3_RX,
+    DMA_REQ_USART3_TX,
+    DMA_REQ_UART4_RX,
+    DMA_REQ_UART4_TX,
+    DMA_REQ_UART5_RX,
+    DMA_REQ_UART5_TX,
+    DMA_REQ_USART6_RX,
+    DMA_REQ_USART6_TX,
+    DMA_REQ_I2C1_RX,
+    DMA_REQ_I2C1_TX,
+    DMA_REQ_I2C2_RX,
+    DMA_REQ_I2C2_TX,
+    DMA_REQ_I2C3_RX,
+    DMA_REQ_I2C3_TX,
+    DMA_REQ_SDIO,
+    DMA_REQ_DCMI,
+    DMA_REQ_TMR1_UP,
+    DMA_REQ_TMR2_UP,
+    DMA_REQ_TMR6_UP,
+    DMA_REQ_TMR7_UP,
+    DMA_REQ_TMR8_UP,
+    DMA_REQ_COUNT
+} DmaRequest_T;
+
+/**
+ * @brief Transfer events, passed to the callback
+ */
+typedef enum
+{
+    DMA_EVENT_HALF,             /*!< First half done (DMA_XFER_HALF) */
+    DMA_EVENT_DONE,             /*!< All items moved; each pass (buffer) of a circular transfer */
+    DMA_EVENT_ERROR,            /*!< Bus or direct mode error, transfer stopped */
+    DMA_EVENT_ABORTED           /*!< Removed by DmaStop() or DmaRelease() */
+} DmaEvent_T;
+
+/* Transfer flags */
+#define DMA_XFER_MEM_FIXED      0x01U   /*!< Same memory address for every item */
+#define DMA_XFER_CIRCULAR       0x02U   /*!< Restart at the end until DmaStop() */
+#define DMA_XFER_HALF           0x04U   /*!< Also report DMA_EVENT_HALF */
+#define DMA_XFER_DOUBLE         0x08U   /*!< Circular, alternating memory and memory1 */
+#define DMA_XFER_PERIPH_BURST   0x10U   /*!< Peripheral requests 4-item bursts (SDIO) */
+
+typedef struct DmaTransfer DmaTransfer_T;
+typedef struct DmaStream DmaStream_T;
+
+/* Called from the stream interrupt */
+typedef void (*DmaCallback_T)(DmaTransfer_T* transfer, DmaEvent_T event);
+
+/**
+ * @brief One transfer; owned by the manager from DmaSubmit() until the
+ *        DONE, ERROR or ABORTED callback
+ */
+struct DmaTransfer
+{
+    uint32_t        peripheral;     /*!< Peripheral data register, or source (memory to memory) */
+    uint32_t        memory;         /*!< Memory buffer, or destination (memory to memory) */
+    uint32_t        memory1;        /*!< Second buffer with DMA_XFER_DOUBLE */
+    uint16_t        count;          /*!< Items of size bytes, 1..65535 */
+    uint8_t         size;           /*!< Peripheral item size: 1, 2 or 4 bytes */
+    uint8_t         dir;            /*!< DMA_DIR_T; forced for DMA_REQ_MEM2MEM */
+    uint8_t         flags;          /*!< DMA_XFER_* */
+    DmaCallback_T   done;           /*!< May be NULL */
+    void*           arg;            /*!< For the callback */
+    DmaTransfer_T*  next;           /*!< Queue link */
+};
+
+/**
+ * @brief Claimed stream; treat as opaque
+ */
+struct DmaStream
+{
+    DMA_Stream_T*   regs;           /*!< Stream registers, for drivers that program it themselves */
+    DMA_T*          dma;
+    uint8_t         index;          /*!< DMA_STREAM_INDEX() */
+    uint8_t         channel;        /*!< Request channel of the route */
+    uint8_t         request;        /*!< DmaRequest_T, while claimed */
+    uint8_t         claimed;
+    uint32_t        priority;       /*!< DMA_PRIORITY_T, in SCFG position */
+    DmaTransfer_T*  active;         /*!< Running transfer */
+    DmaTransfer_T*  head;           /*!< Queued behind it */
+    DmaTransfer_T*  tail;
+};
+
+DmaStream_T* DmaClaim(DmaRequest_T request, DMA_PRIORITY_T priority, uint32_t irqPriority);
+void DmaRelease(DmaStream_T* stream);
+
+uint8_t DmaSubmit(DmaStream_T* stream, DmaTransfer_T* transfer);
+void DmaStop(DmaStream_T* stream);
+uint8_t DmaBusy(const DmaStream_T* stream);
+uint16_t DmaRemaining(const DmaStream_T* stream);
+
+/* Stream interrupt dispatch, index from DMA_STREAM_INDEX() */
+void DmaIRQHandler(uint32_t index);
+
+#endif // DMA_H
@@ -0,0 +1,732 @@
+#include <stddef.h>
+#include <string.h>
+#include "apm32f4xx.h"
+#include "Dsp.h"
+
+/*
+ * Cortex-M4 DSP extension instructions, or plain C with the same results.
+ * Halfword lanes: lo = bits 15:0, hi = bits 31:16.
+ */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_SIMD 1
+#else
+#define DSP_SIMD 0
+#endif
+
+#define DSP_LO(x)   ((int32_t)(int16_t)(x))
+#define DSP_HI(x)   ((int32_t)(int16_t)((x) >> 16))
+
+/* Two halfwords from anywhere; one LDR on the Cortex-M4 */
+static inline uint32_t DspLoad32(const int16_t* p)
+{
+    uint32_t value;
+
+    memcpy(&value, p, sizeof(value));
+
+    return value;
+}
+
+static inline void DspStore32(int16_t* p, uint32_t value)
+{
+    memcpy(p, &value, sizeof(value));
+}
+
+static inline uint32_t DspPack(int32_t lo, int32_t hi)
+{
+#if DSP_SIMD
+    return __PKHBT(lo, hi, 16);
+#else
+    return ((uint32_t)lo & 0xFFFFU) | ((uint32_t)hi << 16);
+#endif
+}
+
+static inline int32_t DspSat16(int64_t value)
+{
+    return (value > 32767) ? 32767 : ((value < -32768) ? -32768 : (int32_t)value);
+}
+
+/* acc + x.lo * y.lo + x.hi * y.hi */
+static inline int64_t DspSmlald(uint32_t x, uint32_t y, int64_t acc)
+{
+#if DSP_SIMD
+    return (int64_t)__SMLALD(x, y, (uint64_t)acc);
+#else
+    return acc + (int64_t)DSP_LO(x) * DSP_LO(y) + (int64_t)DSP_HI(x) * DSP_HI(y);
+#endif
+}
+
+/* acc + x.lo * y.hi + x.hi * y.lo */
+static inline int64_t DspSmlaldx(uint32_t x, uint32_t y, int64_t acc)
+{
+#if DSP_SIMD
+    return (int64_t)__SMLALDX(x, y, (uint64_t)acc);
+#else
+    return acc + (int64_t)DSP_LO(x) * DSP_HI(y) + (int64_t)DSP_HI(x) * DSP_LO(y);
+#endif
+}
+
+/* x.lo * y.lo + x.hi * y.hi */
+static inline int32_t DspSmuad(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return (int32_t)__SMUAD(x, y);
+#else
+    return DSP_LO(x) * DSP_LO(y) + DSP_HI(x) * DSP_HI(y);
+#endif
+}
+
+/* x.lo * y.lo - x.hi * y.hi */
+static inline int32_t DspSmusd(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return (int32_t)__SMUSD(x, y);
+#else
+    return DSP_LO(x) * DSP_LO(y) - DSP_HI(x) * DSP_HI(y);
+#endif
+}
+
+/* x.lo * y.hi + x.hi * y.lo */
+static inline int32_t DspSmuadx(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return (int32_t)__SMUADX(x, y);
+#else
+    return DSP_LO(x) * DSP_HI(y) + DSP_HI(x) * DSP_LO(y);
+#endif
+}
+
+/* x.lo * y.hi - x.hi * y.lo */
+static inline int32_t DspSmusdx(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return (int32_t)__SMUSDX(x, y);
+#else
+    return DSP_LO(x) * DSP_HI(y) - DSP_HI(x) * DSP_LO(y);
+#endif
+}
+
+/* ((x.lo + y.lo) >> 1, (x.hi + y.hi) >> 1) */
+static inline uint32_t DspShadd16(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return __SHADD16(x, y);
+#else
+    return DspPack((DSP_LO(x) + DSP_LO(y)) >> 1, (DSP_HI(x) + DSP_HI(y)) >> 1);
+#endif
+}
+
+/* ((x.lo - y.lo) >> 1, (x.hi - y.hi) >> 1) */
+static inline uint32_t DspShsub16(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return __SHSUB16(x, y);
+#else
+    return DspPack((DSP_LO(x) - DSP_LO(y)) >> 1, (DSP_HI(x) - DSP_HI(y)) >> 1);
+#endif
+}
+
+/* ((x.lo - y.hi) >> 1, (x.hi + y.lo) >> 1): x + j y, halved */
+static inline uint32_t DspShasx(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return __SHASX(x, y);
+#else
+    return DspPack((DSP_LO(x) - DSP_HI(y)) >> 1, (DSP_HI(x) + DSP_LO(y)) >> 1);
+#endif
+}
+
+/* ((x.lo + y.hi) >> 1, (x.hi - y.lo) >> 1): x - j y, halved */
+static inline uint32_t DspShsax(uint32_t x, uint32_t y)
+{
+#if DSP_SIMD
+    return __SHSAX(x, y);
+#else
+    return DspPack((DSP_LO(x) + DSP_HI(y)) >> 1, (DSP_HI(x) - DSP_LO(y)) >> 1);
+#endif
+}
+
+/* Q15 result of a Q30 product or sum, saturated */
+static inline int32_t DspSatQ15(int32_t value)
+{
+#if DSP_SIMD
+    return __SSAT(value >> 15, 16);
+#else
+    return DspSat16(value >> 15);
+#endif
+}
+
+/* FIR ************************************************************************/
+
+/*!
+ * @brief       One FIR output: sum of h[taps - 1 - k] * x[k], x oldest first.
+ *
+ * @param       x:       taps samples ending with the newest
+ *
+ * @param       h:       Coefficients in natural order
+ *
+ * @param       taps:    Coefficients
+ *
+ * @retval      Exact Q30 sum
+ *
+ * @note        Pairs of samples meet pairs of coefficients in reverse
+ *              order, which the exchanging SMLALDX handles without
+ *              reversed coefficient storage.
+ */
+static inline int64_t DspFirDot(const int16_t* x, const int16_t* h, uint32_t taps)
+{
+    const int16_t* c = h + taps;
+    int64_t acc = 0;
+    uint32_t pairs = taps >> 1;
+
+    while (pairs >= 2U)
+    {
+        acc = DspSmlaldx(DspLoad32(x), DspLoad32(c - 2), acc);
+        acc = DspSmlaldx(DspLoad32(x + 2), DspLoad32(c - 4), acc);
+        x += 4;
+        c -= 4;
+        pairs -= 2U;
+    }
+    if (pairs != 0)
+    {
+        acc = DspSmlaldx(DspLoad32(x), DspLoad32(c - 2), acc);
+        x += 2;
+    }
+    if ((taps & 1U) != 0)
+    {
+        acc += (int32_t)x[0] * h[0];
+    }
+
+    return acc;
+}
+
+/*!
+ * @brief       Set up a Q15 FIR filter.
+ *
+ * @param       fir:     Filter
+ *
+ * @param       coeffs:  taps Q15 coefficients, h[0] first
+ *
+ * @param       taps:    Filter length, 1 or more
+ *
+ * @param       state:   DSP_FIR_STATE(taps, block) samples
+ *
+ * @param       block:   Most samples passed to one DspFirQ15() call
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t DspFirQ15Init(DspFirQ15_T* fir, const int16_t* coeffs, uint16_t taps, int16_t* state, uint32_t block)
+{
+    return DspDecimateQ15Init(fir, coeffs, taps, 1, state, block);
+}
+
+/*!
+ * @brief       Filter a block.
+ *
+ * @param       fir:     Filter from DspFirQ15Init()
+ *
+ * @param       input:   count samples
+ *
+ * @param       output:  count samples, may be input
+ *
+ * @param       count:   Up to the block size
+ *
+ * @retval      None
+ */
+void DspFirQ15(DspFirQ15_T* fir, const int16_t* input, int16_t* output, uint32_t count)
+{
+    uint32_t history = fir->taps - 1U;
+    uint32_t i;
+
+    memcpy(fir->state + history, input, count * sizeof(int16_t));
+
+    for (i = 0; i < count; i++)
+    {
+        output[i] = (int16_t)DspSat16(DspFirDot(fir->state + i, fir->coeffs, fir->taps) >> 15);
+    }
+
+    memmove(fir->state, fir->state + count, history * sizeof(int16_t));
+}
+
+/*!
+ * @brief       Set up a Q15 FIR decimator.
+ *
+ * @param       fir:     Decimator
+ *
+ * @param       coeffs:  taps Q15 anti-aliasing coefficients, h[0] first
+ *
+ * @param       taps:    Filter length, 1 or more
+ *
+ * @param       factor:  Keep one output in factor, 1 or more
+ *
+ * @param       state:   DSP_FIR_STATE(taps, block) samples
+ *
+ * @param       block:   Most input samples per DspDecimateQ15() call
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t DspDecimateQ15Init(DspFirQ15_T* fir, const int16_t* coeffs, uint16_t taps, uint16_t factor,
+                           int16_t* state, uint32_t block)
+{
+    if ((taps == 0) || (factor == 0) || (block == 0) || (coeffs == NULL) || (state == NULL))
+    {
+        return ERROR;
+    }
+
+    fir->coeffs = coeffs;
+    fir->state = state;
+    fir->taps = taps;
+    fir->factor = factor;
+    fir->block = block;
+    memset(state, 0, DSP_FIR_STATE(taps, block) * sizeof(int16_t));
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Filter and decimate a block.
+ *
+ * @param       fir:     Decimator from DspDecimateQ15Init()
+ *
+ * @param       input:   count samples
+ *
+ * @param       output:  count / factor samples, may be input
+ *
+ * @param       count:   A multiple of the factor, up to the block size
+ *
+ * @retval      Output samples
+ *
+ * @note        Only the kept outputs are computed; each one ends with the
+ *              last input of its group of factor samples.
+ */
+uint32_t DspDecimateQ15(DspFirQ15_T* fir, const int16_t* input, int16_t* output, uint32_t count)
+{
+    uint32_t history = fir->taps - 1U;
+    uint32_t outputs = count / fir->factor;
+    uint32_t i;
+    const int16_t* window = fir->state + fir->factor - 1U;
+
+    memcpy(fir->state + history, input, count * sizeof(int16_t));
+
+    for (i = 0; i < outputs; i++)
+    {
+        output[i] = (int16_t)DspSat16(DspFirDot(window, fir->coeffs, fir->taps) >> 15);
+        window += fir->factor;
+    }
+
+    memmove(fir->state, fir->state + count, history * sizeof(int16_t));
+
+    return outputs;
+}
+
+/* Biquad *********************************************************************/
+
+/*!
+ * @brief       Set up a Q15 biquad cascade.
+ *
+ * @param       biquad:      Cascade
+ *
+ * @param       coeffs:      {b0, 0, b1, b2, a1, a2} per stage, word-aligned;
+ *                           the zero pairs b0 with the new sample
+ *
+ * @param       stages:      Second-order sections, 1 or more
+ *
+ * @param       postShift:   Coefficients are Q(15 - postShift), so filters
+ *                           with coefficients up to 2^postShift fit
+ *
+ * @param       state:       DSP_BIQUAD_STATE(stages) samples, word-aligned
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t DspBiquadQ15Init(DspBiquadQ15_T* biquad, const int16_t* coeffs, uint8_t stages, uint8_t postShift,
+                         int16_t* state)
+{
+    if ((stages == 0) || (postShift > 15U) || (coeffs == NULL) || (state == NULL) ||
+        ((((uint32_t)(uintptr_t)coeffs | (uint32_t)(uintptr_t)state) & 3U) != 0))
+    {
+        return ERROR;
+    }
+
+    biquad->coeffs = coeffs;
+    biquad->state = state;
+    biquad->stages = stages;
+    biquad->postShift = postShift;
+    memset(state, 0, DSP_BIQUAD_STATE(stages) * sizeof(int16_t));
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Filter a block through the cascade.
+ *
+ * @param       biquad:  Cascade from DspBiquadQ15Init()
+ *
+ * @param       input:   count samples
+ *
+ * @param       output:  count samples, may be input
+ *
+ * @param       count:   Samples
+ *
+ * @retval      None
+ *
+ * @note        Each stage runs over the whole block, its state held in
+ *              registers as packed (x[n-1], x[n-2]) and (y[n-1], y[n-2]).
+ */
+void DspBiquadQ15(DspBiquadQ15_T* biquad, const int16_t* input, int16_t* output, uint32_t count)
+{
+    const int16_t* coeffs = biquad->coeffs;
+    int16_t* state = biquad->state;
+    uint32_t shift = 15U - biquad->postShift;
+    uint32_t stage, i;
+
+    for (stage = 0; stage < biquad->stages; stage++)
+    {
+        uint32_t b0 = DspLoad32(coeffs);
+        uint32_t b12 = DspLoad32(coeffs + 2);
+        uint32_t a12 = DspLoad32(coeffs + 4);
+        uint32_t x12 = DspLoad32(state);
+        uint32_t y12 = DspLoad32(state + 2);
+
+        for (i = 0; i < count; i++)
+        {
+            int32_t in = input[i];
+            int32_t out;
+            int64_t acc;
+
+            acc = DspSmlald(b0, (uint32_t)in & 0xFFFFU, 0);
+            acc = DspSmlald(b12, x12, acc);
+            acc = DspSmlald(a12, y12, acc);
+            out = DspSat16(acc >> shift);
+
+            x12 = DspPack(in, DSP_LO(x12));
+            y12 = DspPack(out, DSP_LO(y12));
+            output[i] = (int16_t)out;
+        }
+
+        DspStore32(state, x12);
+        DspStore32(state + 2, y12);
+        input = output;
+        coeffs += 6;
+        state += 4;
+    }
+}
+
+/* Level **********************************************************************/
+
+/*!
+ * @brief       Root mean square of a block.
+ *
+ * @param       input:   Samples
+ *
+ * @param       count:   Samples, 1 or more
+ *
+ * @retval      Q15 RMS, rounded down, at most 32767
+ */
+int16_t DspRmsQ15(const int16_t* input, uint32_t count)
+{
+    int64_t sum = 0;
+    uint32_t pairs = count >> 1;
+    uint32_t mean, root, bit;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    while (pairs-- > 0)
+    {
+        uint32_t x = DspLoad32(input);
+
+        sum = DspSmlald(x, x, sum);
+        input += 2;
+    }
+    if ((count & 1U) != 0)
+    {
+        sum += (int32_t)input[0] * input[0];
+    }
+
+    /* Integer square root of the Q30 mean: a Q15 result */
+    mean = (uint32_t)((uint64_t)sum / count);
+    root = 0;
+    for (bit = 1UL << 30; bit != 0; bit >>= 2)
+    {
+        if (mean >= root + bit)
+        {
+            mean -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+    }
+
+    return (int16_t)((root > 32767U) ? 32767U : root);
+}
+
+/*!
+ * @brief       Largest magnitude in a block.
+ *
+ * @param       input:   Samples
+ *
+ * @param       count:   Samples
+ *
+ * @param       index:   Position of its first occurrence (may be NULL)
+ *
+ * @retval      Peak magnitude; -32768 counts as 32767
+ */
+int16_t DspPeakQ15(const int16_t* input, uint32_t count, uint32_t* index)
+{
+    int32_t peak = -1;
+    uint32_t at = 0;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        int32_t magnitude = (input[i] < 0) ? -(int32_t)input[i] : input[i];
+
+        if (magnitude > peak)
+        {
+            peak = magnitude;
+            at = i;
+        }
+    }
+
+    if (index != NULL)
+    {
+        *index = at;
+    }
+
+    return (int16_t)((peak > 32767) ? 32767 : ((peak < 0) ? 0 : peak));
+}
+
+/* FFT ************************************************************************/
+
+/*!
+ * @brief       Set up an FFT.
+ *
+ * @param       fft:     FFT
+ *
+ * @param       length:  Complex points: 16, 64, 256 or 1024 (up to DSP_FFT_MAX)
+ *
+ * @param       inverse: Nonzero for the inverse transform
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t DspFftInit(DspFft_T* fft, uint16_t length, uint8_t inverse)
+{
+    uint32_t n = 16;
+
+    while (n < length)
+    {
+        n *= 4U;
+    }
+    if ((n != length) || (length > DSP_FFT_MAX))
+    {
+        return ERROR;
+    }
+
+    fft->length = length;
+    fft->stride = (uint16_t)(DSP_FFT_MAX / length);
+    fft->inverse = inverse ? 1U : 0U;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Base-4 digit reversal of an index.
+ *
+ * @param       index:   Index below length
+ *
+ * @param       length:  A power of 4
+ *
+ * @retval      Reversed index
+ */
+static uint32_t DspDigitReverse(uint32_t index, uint32_t length)
+{
+    uint32_t reversed = 0;
+
+    for (; length > 1U; length >>= 2)
+    {
+        reversed = (reversed << 2) | (index & 3U);
+        index >>= 2;
+    }
+
+    return reversed;
+}
+
+/*!
+ * @brief       Q15 FFT: radix-4 decimation in frequency, then digit reversal.
+ *
+ * @param       fft:     FFT from DspFftInit()
+ *
+ * @param       data:    length (re, im) pairs, word-aligned, in place
+ *
+ * @retval      None
+ *
+ * @note        A complex sample is one word (re low, im high), so each
+ *              butterfly is halving SIMD adds: two halvings per stage scale
+ *              the result by 1/length and keep it in range. Twiddle
+ *              products round down to Q15 and saturate.
+ */
+void DspFftQ15(const DspFft_T* fft, int16_t* data)
+{
+    uint32_t length = fft->length;
+    uint32_t stride = fft->stride;
+    uint32_t span, quarter, group, k, j;
+
+    for (span = length; span >= 4U; span >>= 2, stride <<= 2)
+    {
+        quarter = span >> 2;
+
+        for (group = 0; group < length; group += span)
+        {
+            int16_t* x = data + 2U * group;
+
+            for (k = 0; k < quarter; k++)
+            {
+                uint32_t a = DspLoad32(x + 2U * k);
+                uint32_t b = DspLoad32(x + 2U * (k + quarter));
+                uint32_t c = DspLoad32(x + 2U * (k + 2U * quarter));
+                uint32_t d = DspLoad32(x + 2U * (k + 3U * quarter));
+                uint32_t t0 = DspShadd16(a, c);
+                uint32_t t1 = DspShsub16(a, c);
+                uint32_t t2 = DspShadd16(b, d);
+                uint32_t t3 = DspShsub16(b, d);
+                uint32_t y[4];
+                uint32_t w;
+
+                y[0] = DspShadd16(t0, t2);
+                y[2] = DspShsub16(t0, t2);
+                if (fft->inverse)
+                {
+                    y[1] = DspShasx(t1, t3);
+                    y[3] = DspShsax(t1, t3);
+                }
+                else
+                {
+                    y[1] = DspShsax(t1, t3);
+                    y[3] = DspShasx(t1, t3);
+                }
+
+                DspStore32(x + 2U * k, y[0]);
+                for (j = 1; j < 4U; j++)
+                {
+                    /* W^(j k): forward multiplies by cos - j sin, inverse by cos + j sin */
+                    w = DspLoad32(dspTwiddleQ15 + 2U * j * k * stride);
+                    if (fft->inverse)
+                    {
+                        y[j] = DspPack(DspSatQ15(DspSmusd(y[j], w)), DspSatQ15(DspSmuadx(y[j], w)));
+                    }
+                    else
+                    {
+                        y[j] = DspPack(DspSatQ15(DspSmuad(y[j], w)), DspSatQ15(DspSmusdx(w, y[j])));
+                    }
+                    DspStore32(x + 2U * (k + j * quarter), y[j]);
+                }
+            }
+        }
+    }
+
+    for (k = 0; k < length; k++)
+    {
+        j = DspDigitReverse(k, length);
+        if (j > k)
+        {
+            uint32_t swap = DspLoad32(data + 2U * k);
+
+            DspStore32(data + 2U * k, DspLoad32(data + 2U * j));
+            DspStore32(data + 2U * j, swap);
+        }
+    }
+}
+
+/*!
+ * @brief       Single precision FFT, same structure as DspFftQ15().
+ *
+ * @param       fft:     FFT from DspFftInit()
+ *
+ * @param       data:    length (re, im) pairs, in place
+ *
+ * @retval      None
+ *
+ * @note        The forward transform is unscaled, the inverse scaled by
+ *              1/length, so a round trip returns the input.
+ */
+void DspFftF32(const DspFft_T* fft, float* data)
+{
+    uint32_t length = fft->length;
+    uint32_t stride = fft->stride;
+    float sign = fft->inverse ? 1.0f : -1.0f;
+    uint32_t span, quarter, group, k, j;
+
+    for (span = length; span >= 4U; span >>= 2, stride <<= 2)
+    {
+        quarter = span >> 2;
+
+        for (group = 0; group < length; group += span)
+        {
+            float* x = data + 2U * group;
+
+            for (k = 0; k < quarter; k++)
+            {
+                float* pa = x + 2U * k;
+                float* pb = x + 2U * (k + quarter);
+                float* pc = x + 2U * (k + 2U * quarter);
+                float* pd = x + 2U * (k + 3U * quarter);
+                float t0r = pa[0] + pc[0], t0i = pa[1] + pc[1];
+                float t1r = pa[0] - pc[0], t1i = pa[1] - pc[1];
+                float t2r = pb[0] + pd[0], t2i = pb[1] + pd[1];
+                float t3r = pb[0] - pd[0], t3i = pb[1] - pd[1];
+                float yr[4], yi[4];
+
+                yr[0] = t0r + t2r;
+                yi[0] = t0i + t2i;
+                yr[2] = t0r - t2r;
+                yi[2] = t0i - t2i;
+                /* t1 -/+ j t3 */
+                yr[1] = t1r - sign * t3i;
+                yi[1] = t1i + sign * t3r;
+                yr[3] = t1r + sign * t3i;
+                yi[3] = t1i - sign * t3r;
+
+                pa[0] = yr[0];
+                pa[1] = yi[0];
+                for (j = 1; j < 4U; j++)
+                {
+                    const float* w = dspTwiddleF32 + 2U * j * k * stride;
+                    float s = sign * w[1];
+                    float* p = x + 2U * (k + j * quarter);
+
+                    /* (yr + j yi) (cos + j s) */
+                    p[0] = yr[j] * w[0] - yi[j] * s;
+                    p[1] = yi[j] * w[0] + yr[j] * s;
+                }
+            }
+        }
+    }
+
+    for (k = 0; k < length; k++)
+    {
+        j = DspDigitReverse(k, length);
+        if (j > k)
+        {
+            float re = data[2U * k];
+            float im = data[2U * k + 1U];
+
+            data[2U * k] = data[2U * j];
+            data[2U * k + 1U] = data[2U * j + 1U];
+            data[2U * j] = re;
+            data[2U * j + 1U] = im;
+        }
+    }
+
+    if (fft->inverse)
+    {
+        float scale = 1.0f / (float)length;
+
+        for (k = 0; k < 2U * length; k++)
+        {
+            data[k] *= scale;
+        }
+    }
+}
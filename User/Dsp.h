@@ -0,0 +1,99 @@
+#ifndef DSP_H
+#define DSP_H
+
+#include <stdint.h>
+
+/*
+ * Fixed-point (Q15) and float signal processing for blocks of samples:
+ * FIR filter and decimator, biquad cascade, RMS and peak, and a radix-4
+ * complex FFT in Q15 and single precision.
+ *
+ * On the Cortex-M4 the Q15 kernels use the DSP extension: two 16-bit
+ * samples per register, dual multiply-accumulate into 64 bits (SMLALD),
+ * halving add/subtract for the FFT butterflies and saturation (SSAT) on the
+ * way out. Elsewhere (the host build) the same kernels run on plain C
+ * versions of those instructions, bit for bit, so host results are the
+ * reference for the firmware; the dsp host test checks each kernel against
+ * a straightforward scalar model.
+ *
+ * Q15 filters accumulate exactly in 64 bits and round toward minus
+ * infinity once, at the output, which saturates to [-32768, 32767].
+ *
+ * The FFT twiddle factors are generated on the host by Tools/twiddlegen
+ * (target dsp_tables) into DspTables.c for FFTs up to DSP_FFT_MAX points.
+ */
+
+/* Largest FFT; DspTables.c is generated for it */
+#define DSP_FFT_MAX         1024U
+
+/* State samples of an FIR filter or decimator for blocks of up to block samples */
+#define DSP_FIR_STATE(taps, block)  ((taps) + (block) - 1U)
+
+/* State samples of a biquad cascade */
+#define DSP_BIQUAD_STATE(stages)    (4U * (stages))
+
+/**
+ * @brief Q15 FIR filter or decimator; treat as opaque
+ */
+typedef struct
+{
+    const int16_t*  coeffs;         /*!< h[0] .. h[taps - 1], Q15 */
+    int16_t*        state;          /*!< DSP_FIR_STATE(taps, block) samples */
+    uint16_t        taps;
+    uint16_t        factor;         /*!< Decimation factor, 1 for a filter */
+    uint32_t        block;          /*!< Most input samples per call */
+} DspFirQ15_T;
+
+/**
+ * @brief Q15 biquad cascade, direct form I; treat as opaque
+ */
+typedef struct
+{
+    const int16_t*  coeffs;         /*!< {b0, 0, b1, b2, a1, a2} per stage, word-aligned */
+    int16_t*        state;          /*!< DSP_BIQUAD_STATE(stages) samples, word-aligned */
+    uint8_t         stages;
+    uint8_t         postShift;      /*!< Coefficients are Q(15 - postShift) */
+} DspBiquadQ15_T;
+
+/**
+ * @brief FFT size and direction
+ */
+typedef struct
+{
+    uint16_t        length;         /*!< Complex points, a power of 4 */
+    uint16_t        stride;         /*!< Twiddle table step, DSP_FFT_MAX / length */
+    uint8_t         inverse;
+} DspFft_T;
+
+/* Twiddle factors (DspTables.c): cos, sin of 2*pi*k/DSP_FFT_MAX, k < 3/4 DSP_FFT_MAX */
+extern const int16_t dspTwiddleQ15[];
+extern const float dspTwiddleF32[];
+
+/* y[n] = sum h[k] x[n - k]; state zeroed, history carried across calls */
+uint8_t DspFirQ15Init(DspFirQ15_T* fir, const int16_t* coeffs, uint16_t taps, int16_t* state, uint32_t block);
+void DspFirQ15(DspFirQ15_T* fir, const int16_t* input, int16_t* output, uint32_t count);
+
+/* FIR filter keeping every factor-th output; count a multiple of factor */
+uint8_t DspDecimateQ15Init(DspFirQ15_T* fir, const int16_t* coeffs, uint16_t taps, uint16_t factor,
+                           int16_t* state, uint32_t block);
+uint32_t DspDecimateQ15(DspFirQ15_T* fir, const int16_t* input, int16_t* output, uint32_t count);
+
+/* y = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2] per stage (a negated) */
+uint8_t DspBiquadQ15Init(DspBiquadQ15_T* biquad, const int16_t* coeffs, uint8_t stages, uint8_t postShift,
+                         int16_t* state);
+void DspBiquadQ15(DspBiquadQ15_T* biquad, const int16_t* input, int16_t* output, uint32_t count);
+
+/* Level of a block */
+int16_t DspRmsQ15(const int16_t* input, uint32_t count);
+int16_t DspPeakQ15(const int16_t* input, uint32_t count, uint32_t* index);
+
+/*
+ * In place on length interleaved (re, im) pairs, output in natural order.
+ * Q15 scales by 1/length both ways; float scales the inverse by 1/length.
+ * Q15 data must be word-aligned.
+ */
+uint8_t DspFftInit(DspFft_T* fft, uint16_t length, uint8_t inverse);
+void DspFftQ15(const DspFft_T* fft, int16_t* data);
+void DspFftF32(const DspFft_T* fft, float* data);
+
+#endif // DSP_H
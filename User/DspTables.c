@@ -0,0 +1,311 @@
+/*!
+ * @file        DspTables.c
+ *
+ * @brief       FFT twiddle factors. Generated by Tools/twiddlegen, do not
+ *              edit; regenerate with the dsp_tables target of the host
+ *              build.
+ */
+
+#include "Dsp.h"
+
+#if DSP_FFT_MAX != 1024U
+#error "DspTables.c was generated for DSP_FFT_MAX 1024"
+#endif
+
+/* cos, sin of 2*pi*k/1024 for k < 768, Q15 */
+const int16_t dspTwiddleQ15[1536] =
+{
+    32767, 0, 32767, 201, 32766, 402, 32762, 603, 32758, 804, 32753, 1005, 32746, 1206, 32738, 1407,
+    32729, 1608, 32718, 1809, 32706, 2009, 32693, 2210, 32679, 2411, 32664, 2611, 32647, 2811, 32629, 3012,
+    32610, 3212, 32590, 3412, 32568, 3612, 32546, 3812, 32522, 4011, 32496, 4211, 32470, 4410, 32442, 4609,
+    32413, 4808, 32383, 5007, 32352, 5205, 32319, 5404, 32286, 5602, 32251, 5800, 32214, 5998, 32177, 6195,
+    32138, 6393, 32099, 6590, 32058, 6787, 32015, 6983, 31972, 7180, 31927, 7376, 31881, 7571, 31834, 7767,
+    31786, 7962, 31737, 8157, 31686, 8351, 31634, 8546, 31581, 8740, 31527, 8933, 31471, 9127, 31415, 9319,
+    31357, 9512, 31298, 9704, 31238, 9896, 31177, 10088, 31114, 10279, 31050, 10469, 30986, 10660, 30920, 10850,
+    30853, 11039, 30784, 11228, 30715, 11417, 30644, 11605, 30572, 11793, 30499, 11980, 30425, 12167, 30350, 12354,
+    30274, 12540, 30196, 12725, 30118, 12910, 30038, 13095, 29957, 13279, 29875, 13463, 29792, 13646, 29707, 13828,
+    29622, 14010, 29535, 14192, 29448, 14373, 29359, 14553, 29269, 14733, 29178, 14912, 29086, 15091, 28993, 15269,
+    28899, 15447, 28803, 15624, 28707, 15800, 28610, 15976, 28511, 16151, 28411, 16326, 28311, 16500, 28209, 16673,
+    28106, 16846, 28002, 17018, 27897, 17190, 27791, 17361, 27684, 17531, 27576, 17700, 27467, 17869, 27357, 18037,
+    27246, 18205, 27133, 18372, 27020, 18538, 26906, 18703, 26791, 18868, 26674, 19032, 26557, 19195, 26439, 19358,
+    26320, 19520, 26199, 19681, 26078, 19841, 25956, 20001, 25833, 20160, 25708, 20318, 25583, 20475, 25457, 20632,
+    25330, 20788, 25202, 20943, 25073, 21097, 24943, 21251, 24812, 21403, 24680, 21555, 24548, 21706, 24414, 21856,
+    24279, 22006, 24144, 22154, 24008, 22302, 23870, 22449, 23732, 22595, 23593, 22740, 23453, 22884, 23312, 23028,
+    23170, 23170, 23028, 23312, 22884, 23453, 22740, 23593, 22595, 23732, 22449, 23870, 22302, 24008, 22154, 24144,
+    22006, 24279, 21856, 24414, 21706, 24548, 21555, 24680, 21403, 24812, 21251, 24943, 21097, 25073, 20943, 25202,
+    20788, 25330, 20632, 25457, 20475, 25583, 20318, 25708, 20160, 25833, 20001, 25956, 19841, 26078, 19681, 26199,
+    19520, 26320, 19358, 26439, 19195, 26557, 19032, 26674, 18868, 26791, 18703, 26906, 18538, 27020, 18372, 27133,
+    18205, 27246, 18037, 27357, 17869, 27467, 17700, 27576, 17531, 27684, 17361, 27791, 17190, 27897, 17018, 28002,
+    16846, 28106, 16673, 28209, 16500, 28311, 16326, 28411, 16151, 28511, 15976, 28610, 15800, 28707, 15624, 28803,
+    15447, 28899, 15269, 28993, 15091, 29086, 14912, 29178, 14733, 29269, 14553, 29359, 14373, 29448, 14192, 29535,
+    14010, 29622, 13828, 29707, 13646, 29792, 13463, 29875, 13279, 29957, 13095, 30038, 12910, 30118, 12725, 30196,
+    12540, 30274, 12354, 30350, 12167, 30425, 11980, 30499, 11793, 30572, 11605, 30644, 11417, 30715, 11228, 30784,
+    11039, 30853, 10850, 30920, 10660, 30986, 10469, 31050, 10279, 31114, 10088, 31177, 9896, 31238, 9704, 31298,
+    9512, 31357, 9319, 31415, 9127, 31471, 8933, 31527, 8740, 31581, 8546, 31634, 8351, 31686, 8157, 31737,
+    7962, 31786, 7767, 31834, 7571, 31881, 7376, 31927, 7180, 31972, 6983, 32015, 6787, 32058, 6590, 32099,
+    6393, 32138, 6195, 32177, 5998, 32214, 5800, 32251, 5602, 32286, 5404, 32319, 5205, 32352, 5007, 32383,
+    4808, 32413, 4609, 32442, 4410, 32470, 4211, 32496, 4011, 32522, 3812, 32546, 3612, 32568, 3412, 32590,
+    3212, 32610, 3012, 32629, 2811, 32647, 2611, 32664, 2411, 32679, 2210, 32693, 2009, 32706, 1809, 32718,
+    1608, 32729, 1407, 32738, 1206, 32746, 1005, 32753, 804, 32758, 603, 32762, 402, 32766, 201, 32767,
+    0, 32767, -201, 32767, -402, 32766, -603, 32762, -804, 32758, -1005, 32753, -1206, 32746, -1407, 32738,
+    -1608, 32729, -1809, 32718, -2009, 32706, -2210, 32693, -2411, 32679, -2611, 32664, -2811, 32647, -3012, 32629,
+    -3212, 32610, -3412, 32590, -3612, 32568, -3812, 32546, -4011, 32522, -4211, 32496, -4410, 32470, -4609, 32442,
+    -4808, 32413, -5007, 32383, -5205, 32352, -5404, 32319, -5602, 32286, -5800, 32251, -5998, 32214, -6195, 32177,
+    -6393, 32138, -6590, 32099, -6787, 32058, -6983, 32015, -7180, 31972, -7376, 31927, -7571, 31881, -7767, 31834,
+    -7962, 31786, -8157, 31737, -8351, 31686, -8546, 31634, -8740, 31581, -8933, 31527, -9127, 31471, -9319, 31415,
+    -9512, 31357, -9704, 31298, -9896, 31238, -10088, 31177, -10279, 31114, -10469, 31050, -10660, 30986, -10850, 30920,
+    -11039, 30853, -11228, 30784, -11417, 30715, -11605, 30644, -11793, 30572, -11980, 30499, -12167, 30425, -12354, 30350,
+    -12540, 30274, -12725, 30196, -12910, 30118, -13095, 30038, -13279, 29957, -13463, 29875, -13646, 29792, -13828, 29707,
+    -14010, 29622, -14192, 29535, -14373, 29448, -14553, 29359, -14733, 29269, -14912, 29178, -15091, 29086, -15269, 28993,
+    -15447, 28899, -15624, 28803, -15800, 28707, -15976, 28610, -16151, 28511, -16326, 28411, -16500, 28311, -16673, 28209,
+    -16846, 28106, -17018, 28002, -17190, 27897, -17361, 27791, -17531, 27684, -17700, 27576, -17869, 27467, -18037, 27357,
+    -18205, 27246, -18372, 27133, -18538, 27020, -18703, 26906, -18868, 26791, -19032, 26674, -19195, 26557, -19358, 26439,
+    -19520, 26320, -19681, 26199, -19841, 26078, -20001, 25956, -20160, 25833, -20318, 25708, -20475, 25583, -20632, 25457,
+    -20788, 25330, -20943, 25202, -21097, 25073, -21251, 24943, -21403, 24812, -21555, 24680, -21706, 24548, -21856, 24414,
+    -22006, 24279, -22154, 24144, -22302, 24008, -22449, 23870, -22595, 23732, -22740, 23593, -22884, 23453, -23028, 23312,
+    -23170, 23170, -23312, 23028, -23453, 22884, -23593, 22740, -23732, 22595, -23870, 22449, -24008, 22302, -24144, 22154,
+    -24279, 22006, -24414, 21856, -24548, 21706, -24680, 21555, -24812, 21403, -24943, 21251, -25073, 21097, -25202, 20943,
+    -25330, 20788, -25457, 20632, -25583, 20475, -25708, 20318, -25833, 20160, -25956, 20001, -26078, 19841, -26199, 19681,
+    -26320, 19520, -26439, 19358, -26557, 19195, -26674, 19032, -26791, 18868, -26906, 18703, -27020, 18538, -27133, 18372,
+    -27246, 18205, -27357, 18037, -27467, 17869, -27576, 17700, -27684, 17531, -27791, 17361, -27897, 17190, -28002, 17018,
+    -28106, 16846, -28209, 16673, -28311, 16500, -28411, 16326, -28511, 16151, -28610, 15976, -28707, 15800, -28803, 15624,
+    -28899, 15447, -28993, 15269, -29086, 15091, -29178, 14912, -29269, 14733, -29359, 14553, -29448, 14373, -29535, 14192,
+    -29622, 14010, -29707, 13828, -29792, 13646, -29875, 13463, -29957, 13279, -30038, 13095, -30118, 12910, -30196, 12725,
+    -30274, 12540, -30350, 12354, -30425, 12167, -30499, 11980, -30572, 11793, -30644, 11605, -30715, 11417, -30784, 11228,
+    -30853, 11039, -30920, 10850, -30986, 10660, -31050, 10469, -31114, 10279, -31177, 10088, -31238, 9896, -31298, 9704,
+    -31357, 9512, -31415, 9319, -31471, 9127, -31527, 8933, -31581, 8740, -31634, 8546, -31686, 8351, -31737, 8157,
+    -31786, 7962, -31834, 7767, -31881, 7571, -31927, 7376, -31972, 7180, -32015, 6983, -32058, 6787, -32099, 6590,
+    -32138, 6393, -32177, 6195, -32214, 5998, -32251, 5800, -32286, 5602, -32319, 5404, -32352, 5205, -32383, 5007,
+    -32413, 4808, -32442, 4609, -32470, 4410, -32496, 4211, -32522, 4011, -32546, 3812, -32568, 3612, -32590, 3412,
+    -32610, 3212, -32629, 3012, -32647, 2811, -32664, 2611, -32679, 2411, -32693, 2210, -32706, 2009, -32718, 1809,
+    -32729, 1608, -32738, 1407, -32746, 1206, -32753, 1005, -32758, 804, -32762, 603, -32766, 402, -32767, 201,
+    -32768, 0, -32767, -201, -32766, -402, -32762, -603, -32758, -804, -32753, -1005, -32746, -1206, -32738, -1407,
+    -32729, -1608, -32718, -1809, -32706, -2009, -32693, -2210, -32679, -2411, -32664, -2611, -32647, -2811, -32629, -3012,
+    -32610, -3212, -32590, -3412, -32568, -3612, -32546, -3812, -32522, -4011, -32496, -4211, -32470, -4410, -32442, -4609,
+    -32413, -4808, -32383, -5007, -32352, -5205, -32319, -5404, -32286, -5602, -32251, -5800, -32214, -5998, -32177, -6195,
+    -32138, -6393, -32099, -6590, -32058, -6787, -32015, -6983, -31972, -7180, -31927, -7376, -31881, -7571, -31834, -7767,
+    -31786, -7962, -31737, -8157, -31686, -8351, -31634, -8546, -31581, -8740, -31527, -8933, -31471, -9127, -31415, -9319,
+    -31357, -9512, -31298, -9704, -31238, -9896, -31177, -10088, -31114, -10279, -31050, -10469, -30986, -10660, -30920, -10850,
+    -30853, -11039, -30784, -11228, -30715, -11417, -30644, -11605, -30572, -11793, -30499, -11980, -30425, -12167, -30350, -12354,
+    -30274, -12540, -30196, -12725, -30118, -12910, -30038, -13095, -29957, -13279, -29875, -13463, -29792, -13646, -29707, -13828,
+    -29622, -14010, -29535, -14192, -29448, -14373, -29359, -14553, -29269, -14733, -29178, -14912, -29086, -15091, -28993, -15269,
+    -28899, -15447, -28803, -15624, -28707, -15800, -28610, -15976, -28511, -16151, -28411, -16326, -28311, -16500, -28209, -16673,
+    -28106, -16846, -28002, -17018, -27897, -17190, -27791, -17361, -27684, -17531, -27576, -17700, -27467, -17869, -27357, -18037,
+    -27246, -18205, -27133, -18372, -27020, -18538, -26906, -18703, -26791, -18868, -26674, -19032, -26557, -19195, -26439, -19358,
+    -26320, -19520, -26199, -19681, -26078, -19841, -25956, -20001, -25833, -20160, -25708, -20318, -25583, -20475, -25457, -20632,
+    -25330, -20788, -25202, -20943, -25073, -21097, -24943, -21251, -24812, -21403, -24680, -21555, -24548, -21706, -24414, -21856,
+    -24279, -22006, -24144, -22154, -24008, -22302, -23870, -22449, -23732, -22595, -23593, -22740, -23453, -22884, -23312, -23028,
+    -23170, -23170, -23028, -23312, -22884, -23453, -22740, -23593, -22595, -23732, -22449, -23870, -22302, -24008, -22154, -24144,
+    -22006, -24279, -21856, -24414, -21706, -24548, -21555, -24680, -21403, -24812, -21251, -24943, -21097, -25073, -20943, -25202,
+    -20788, -25330, -20632, -25457, -20475, -25583, -20318, -25708, -20160, -25833, -20001, -25956, -19841, -26078, -19681, -26199,
+    -19520, -26320, -19358, -26439, -19195, -26557, -19032, -26674, -18868, -26791, -18703, -26906, -18538, -27020, -18372, -27133,
+    -18205, -27246, -18037, -27357, -17869, -27467, -17700, -27576, -17531, -27684, -17361, -27791, -17190, -27897, -17018, -28002,
+    -16846, -28106, -16673, -28209, -16500, -28311, -16326, -28411, -16151, -28511, -15976, -28610, -15800, -28707, -15624, -28803,
+    -15447, -28899, -15269, -28993, -15091, -29086, -14912, -29178, -14733, -29269, -14553, -29359, -14373, -29448, -14192, -29535,
+    -14010, -29622, -13828, -29707, -13646, -29792, -13463, -29875, -13279, -29957, -13095, -30038, -12910, -30118, -12725, -30196,
+    -12540, -30274, -12354, -30350, -12167, -30425, -11980, -30499, -11793, -30572, -11605, -30644, -11417, -30715, -11228, -30784,
+    -11039, -30853, -10850, -30920, -10660, -30986, -10469, -31050, -10279, -31114, -10088, -31177, -9896, -31238, -9704, -31298,
+    -9512, -31357, -9319, -31415, -9127, -31471, -8933, -31527, -8740, -31581, -8546, -31634, -8351, -31686, -8157, -31737,
+    -7962, -31786, -7767, -31834, -7571, -31881, -7376, -31927, -7180, -31972, -6983, -32015, -6787, -32058, -6590, -32099,
+    -6393, -32138, -6195, -32177, -5998, -32214, -5800, -32251, -5602, -32286, -5404, -32319, -5205, -32352, -5007, -32383,
+    -4808, -32413, -4609, -32442, -4410, -32470, -4211, -32496, -4011, -32522, -3812, -32546, -3612, -32568, -3412, -32590,
+    -3212, -32610, -3012, -32629, -2811, -32647, -2611, -32664, -2411, -32679, -2210, -32693, -2009, -32706, -1809, -32718,
+    -1608, -32729, -1407, -32738, -1206, -32746, -1005, -32753, -804, -32758, -603, -32762, -402, -32766, -201, -32767,
+};
+
+/* Same, single precision */
+const float dspTwiddleF32[1536] =
+{
+    1.0f, 0.0f, 0.999981165f, 0.00613588467f, 0.999924719f, 0.0122715384f, 0.999830604f, 0.0184067301f,
+    0.999698818f, 0.024541229f, 0.999529421f, 0.030674804f, 0.999322355f, 0.0368072242f, 0.999077737f, 0.0429382585f,
+    0.99879545f, 0.0490676761f, 0.998475552f, 0.0551952459f, 0.998118103f, 0.061320737f, 0.997723043f, 0.0674439222f,
+    0.997290432f, 0.0735645667f, 0.996820271f, 0.0796824396f, 0.996312618f, 0.0857973099f, 0.995767415f, 0.0919089541f,
+    0.99518472f, 0.0980171412f, 0.994564593f, 0.104121633f, 0.993906975f, 0.110222206f, 0.993211925f, 0.116318628f,
+    0.992479563f, 0.122410677f, 0.991709769f, 0.128498107f, 0.990902662f, 0.134580702f, 0.990058184f, 0.140658244f,
+    0.989176512f, 0.146730468f, 0.988257587f, 0.152797192f, 0.987301409f, 0.15885815f, 0.986308098f, 0.164913118f,
+    0.985277653f, 0.170961887f, 0.984210074f, 0.177004218f, 0.983105481f, 0.183039889f, 0.981963873f, 0.18906866f,
+    0.980785251f, 0.195090324f, 0.979569793f, 0.201104641f, 0.97831738f, 0.207111374f, 0.977028131f, 0.213110313f,
+    0.975702107f, 0.219101235f, 0.974339366f, 0.225083917f, 0.972939968f, 0.231058106f, 0.971503913f, 0.237023607f,
+    0.970031261f, 0.242980182f, 0.968522072f, 0.248927608f, 0.966976464f, 0.254865646f, 0.965394437f, 0.260794103f,
+    0.963776052f, 0.266712755f, 0.962121427f, 0.272621363f, 0.960430503f, 0.27851969f, 0.958703458f, 0.284407526f,
+    0.956940353f, 0.290284663f, 0.955141187f, 0.296150893f, 0.953306019f, 0.302005947f, 0.95143503f, 0.307849646f,
+    0.949528158f, 0.313681751f, 0.947585583f, 0.319502026f, 0.945607305f, 0.32531029f, 0.943593442f, 0.331106305f,
+    0.941544056f, 0.336889863f, 0.939459205f, 0.342660725f, 0.937339008f, 0.348418683f, 0.935183525f, 0.354163527f,
+    0.932992816f, 0.359895051f, 0.93076694f, 0.365612984f, 0.928506076f, 0.371317208f, 0.926210225f, 0.377007425f,
+    0.923879504f, 0.382683426f, 0.921514034f, 0.388345033f, 0.919113874f, 0.393992037f, 0.916679084f, 0.399624199f,
+    0.914209783f, 0.405241311f, 0.91170603f, 0.410843164f, 0.909168005f, 0.416429549f, 0.906595707f, 0.422000259f,
+    0.903989315f, 0.427555084f, 0.901348829f, 0.433093816f, 0.898674488f, 0.438616246f, 0.895966232f, 0.444122136f,
+    0.893224299f, 0.449611336f, 0.890448749f, 0.455083579f, 0.887639642f, 0.460538715f, 0.884797096f, 0.465976506f,
+    0.881921291f, 0.471396744f, 0.879012227f, 0.47679922f, 0.876070082f, 0.482183784f, 0.873094976f, 0.487550169f,
+    0.870086968f, 0.492898196f, 0.867046237f, 0.498227656f, 0.863972843f, 0.50353837f, 0.860866964f, 0.50883013f,
+    0.857728601f, 0.514102757f, 0.854557991f, 0.519356012f, 0.851355195f, 0.524589658f, 0.848120332f, 0.529803634f,
+    0.84485358f, 0.534997642f, 0.841554999f, 0.540171444f, 0.838224709f, 0.545324981f, 0.834862888f, 0.550457954f,
+    0.831469595f, 0.555570245f, 0.82804507f, 0.560661554f, 0.824589312f, 0.565731823f, 0.8211025f, 0.570780754f,
+    0.817584813f, 0.575808167f, 0.81403631f, 0.580813944f, 0.81045717f, 0.585797846f, 0.806847572f, 0.590759695f,
+    0.803207517f, 0.59569931f, 0.799537241f, 0.600616455f, 0.795836926f, 0.605511069f, 0.792106569f, 0.610382795f,
+    0.78834641f, 0.615231574f, 0.784556568f, 0.620057225f, 0.780737221f, 0.624859512f, 0.77688849f, 0.629638255f,
+    0.773010433f, 0.634393275f, 0.769103348f, 0.639124453f, 0.765167236f, 0.643831551f, 0.761202395f, 0.64851439f,
+    0.757208824f, 0.653172851f, 0.753186822f, 0.657806695f, 0.749136388f, 0.662415802f, 0.745057762f, 0.666999936f,
+    0.740951121f, 0.671558976f, 0.736816585f, 0.676092684f, 0.732654274f, 0.680601001f, 0.728464365f, 0.685083687f,
+    0.724247098f, 0.689540565f, 0.720002532f, 0.693971455f, 0.715730846f, 0.698376238f, 0.711432219f, 0.702754736f,
+    0.707106769f, 0.707106769f, 0.702754736f, 0.711432219f, 0.698376238f, 0.715730846f, 0.693971455f, 0.720002532f,
+    0.689540565f, 0.724247098f, 0.685083687f, 0.728464365f, 0.680601001f, 0.732654274f, 0.676092684f, 0.736816585f,
+    0.671558976f, 0.740951121f, 0.666999936f, 0.745057762f, 0.662415802f, 0.749136388f, 0.657806695f, 0.753186822f,
+    0.653172851f, 0.757208824f, 0.64851439f, 0.761202395f, 0.643831551f, 0.765167236f, 0.639124453f, 0.769103348f,
+    0.634393275f, 0.773010433f, 0.629638255f, 0.77688849f, 0.624859512f, 0.780737221f, 0.620057225f, 0.784556568f,
+    0.615231574f, 0.78834641f, 0.610382795f, 0.792106569f, 0.605511069f, 0.795836926f, 0.600616455f, 0.799537241f,
+    0.59569931f, 0.803207517f, 0.590759695f, 0.806847572f, 0.585797846f, 0.81045717f, 0.580813944f, 0.81403631f,
+    0.575808167f, 0.817584813f, 0.570780754f, 0.8211025f, 0.565731823f, 0.824589312f, 0.560661554f, 0.82804507f,
+    0.555570245f, 0.831469595f, 0.550457954f, 0.834862888f, 0.545324981f, 0.838224709f, 0.540171444f, 0.841554999f,
+    0.534997642f, 0.84485358f, 0.529803634f, 0.848120332f, 0.524589658f, 0.851355195f, 0.519356012f, 0.854557991f,
+    0.514102757f, 0.857728601f, 0.50883013f, 0.860866964f, 0.50353837f, 0.863972843f, 0.498227656f, 0.867046237f,
+    0.492898196f, 0.870086968f, 0.487550169f, 0.873094976f, 0.482183784f, 0.876070082f, 0.47679922f, 0.879012227f,
+    0.471396744f, 0.881921291f, 0.465976506f, 0.884797096f, 0.460538715f, 0.887639642f, 0.455083579f, 0.890448749f,
+    0.449611336f, 0.893224299f, 0.444122136f, 0.895966232f, 0.438616246f, 0.898674488f, 0.433093816f, 0.901348829f,
+    0.427555084f, 0.903989315f, 0.422000259f, 0.906595707f, 0.416429549f, 0.909168005f, 0.410843164f, 0.91170603f,
+    0.405241311f, 0.914209783f, 0.399624199f, 0.916679084f, 0.393992037f, 0.919113874f, 0.388345033f, 0.921514034f,
+    0.382683426f, 0.923879504f, 0.377007425f, 0.926210225f, 0.371317208f, 0.928506076f, 0.365612984f, 0.93076694f,
+    0.359895051f, 0.932992816f, 0.354163527f, 0.935183525f, 0.348418683f, 0.937339008f, 0.342660725f, 0.939459205f,
+    0.336889863f, 0.941544056f, 0.331106305f, 0.943593442f, 0.32531029f, 0.945607305f, 0.319502026f, 0.947585583f,
+    0.313681751f, 0.949528158f, 0.307849646f, 0.95143503f, 0.302005947f, 0.953306019f, 0.296150893f, 0.955141187f,
+    0.290284663f, 0.956940353f, 0.284407526f, 0.958703458f, 0.27851969f, 0.960430503f, 0.272621363f, 0.962121427f,
+    0.266712755f, 0.963776052f, 0.260794103f, 0.965394437f, 0.254865646f, 0.966976464f, 0.248927608f, 0.968522072f,
+    0.242980182f, 0.970031261f, 0.237023607f, 0.971503913f, 0.231058106f, 0.972939968f, 0.225083917f, 0.974339366f,
+    0.219101235f, 0.975702107f, 0.213110313f, 0.977028131f, 0.207111374f, 0.97831738f, 0.201104641f, 0.979569793f,
+    0.195090324f, 0.980785251f, 0.18906866f, 0.981963873f, 0.183039889f, 0.983105481f, 0.177004218f, 0.984210074f,
+    0.170961887f, 0.985277653f, 0.164913118f, 0.986308098f, 0.15885815f, 0.987301409f, 0.152797192f, 0.988257587f,
+    0.146730468f, 0.989176512f, 0.140658244f, 0.990058184f, 0.134580702f, 0.990902662f, 0.128498107f, 0.991709769f,
+    0.122410677f, 0.992479563f, 0.116318628f, 0.993211925f, 0.110222206f, 0.993906975f, 0.104121633f, 0.994564593f,
+    0.0980171412f, 0.99518472f, 0.0919089541f, 0.995767415f, 0.0857973099f, 0.996312618f, 0.0796824396f, 0.996820271f,
+    0.0735645667f, 0.997290432f, 0.0674439222f, 0.997723043f, 0.061320737f, 0.998118103f, 0.0551952459f, 0.998475552f,
+    0.0490676761f, 0.99879545f, 0.0429382585f, 0.999077737f, 0.0368072242f, 0.999322355f, 0.030674804f, 0.999529421f,
+    0.024541229f, 0.999698818f, 0.0184067301f, 0.999830604f, 0.0122715384f, 0.999924719f, 0.00613588467f, 0.999981165f,
+    6.12323426e-17f, 1.0f, -0.00613588467f, 0.999981165f, -0.0122715384f, 0.999924719f, -0.0184067301f, 0.999830604f,
+    -0.024541229f, 0.999698818f, -0.030674804f, 0.999529421f, -0.0368072242f, 0.999322355f, -0.0429382585f, 0.999077737f,
+    -0.0490676761f, 0.99879545f, -0.0551952459f, 0.998475552f, -0.061320737f, 0.998118103f, -0.0674439222f, 0.997723043f,
+    -0.0735645667f, 0.997290432f, -0.0796824396f, 0.996820271f, -0.0857973099f, 0.996312618f, -0.0919089541f, 0.995767415f,
+    -0.0980171412f, 0.99518472f, -0.104121633f, 0.994564593f, -0.110222206f, 0.993906975f, -0.116318628f, 0.993211925f,
+    -0.122410677f, 0.992479563f, -0.128498107f, 0.991709769f, -0.134580702f, 0.990902662f, -0.140658244f, 0.990058184f,
+    -0.146730468f, 0.989176512f, -0.152797192f, 0.988257587f, -0.15885815f, 0.987301409f, -0.164913118f, 0.986308098f,
+    -0.170961887f, 0.985277653f, -0.177004218f, 0.984210074f, -0.183039889f, 0.983105481f, -0.18906866f, 0.981963873f,
+    -0.195090324f, 0.980785251f, -0.201104641f, 0.979569793f, -0.207111374f, 0.97831738f, -0.213110313f, 0.977028131f,
+    -0.219101235f, 0.975702107f, -0.225083917f, 0.974339366f, -0.231058106f, 0.972939968f, -0.237023607f, 0.971503913f,
+    -0.242980182f, 0.970031261f, -0.248927608f, 0.968522072f, -0.254865646f, 0.966976464f, -0.260794103f, 0.965394437f,
+    -0.266712755f, 0.963776052f, -0.272621363f, 0.962121427f, -0.27851969f, 0.960430503f, -0.284407526f, 0.958703458f,
+    -0.290284663f, 0.956940353f, -0.296150893f, 0.955141187f, -0.302005947f, 0.953306019f, -0.307849646f, 0.95143503f,
+    -0.313681751f, 0.949528158f, -0.319502026f, 0.947585583f, -0.32531029f, 0.945607305f, -0.331106305f, 0.943593442f,
+    -0.336889863f, 0.941544056f, -0.342660725f, 0.939459205f, -0.348418683f, 0.937339008f, -0.354163527f, 0.935183525f,
+    -0.359895051f, 0.932992816f, -0.365612984f, 0.93076694f, -0.371317208f, 0.928506076f, -0.377007425f, 0.926210225f,
+    -0.382683426f, 0.923879504f, -0.388345033f, 0.921514034f, -0.393992037f, 0.919113874f, -0.399624199f, 0.916679084f,
+    -0.405241311f, 0.914209783f, -0.410843164f, 0.91170603f, -0.416429549f, 0.909168005f, -0.422000259f, 0.906595707f,
+    -0.427555084f, 0.903989315f, -0.433093816f, 0.901348829f, -0.438616246f, 0.898674488f, -0.444122136f, 0.895966232f,
+    -0.449611336f, 0.893224299f, -0.455083579f, 0.890448749f, -0.460538715f, 0.887639642f, -0.465976506f, 0.884797096f,
+    -0.471396744f, 0.881921291f, -0.47679922f, 0.879012227f, -0.482183784f, 0.876070082f, -0.487550169f, 0.873094976f,
+    -0.492898196f, 0.870086968f, -0.498227656f, 0.867046237f, -0.50353837f, 0.863972843f, -0.50883013f, 0.860866964f,
+    -0.514102757f, 0.857728601f, -0.519356012f, 0.854557991f, -0.524589658f, 0.851355195f, -0.529803634f, 0.848120332f,
+    -0.534997642f, 0.84485358f, -0.540171444f, 0.841554999f, -0.545324981f, 0.838224709f, -0.550457954f, 0.834862888f,
+    -0.555570245f, 0.831469595f, -0.560661554f, 0.82804507f, -0.565731823f, 0.824589312f, -0.570780754f, 0.8211025f,
+    -0.575808167f, 0.817584813f, -0.580813944f, 0.81403631f, -0.585797846f, 0.81045717f, -0.590759695f, 0.806847572f,
+    -0.59569931f, 0.803207517f, -0.600616455f, 0.799537241f, -0.605511069f, 0.795836926f, -0.610382795f, 0.792106569f,
+    -0.615231574f, 0.78834641f, -0.620057225f, 0.784556568f, -0.624859512f, 0.780737221f, -0.629638255f, 0.77688849f,
+    -0.634393275f, 0.773010433f, -0.639124453f, 0.769103348f, -0.643831551f, 0.765167236f, -0.64851439f, 0.761202395f,
+    -0.653172851f, 0.757208824f, -0.657806695f, 0.753186822f, -0.662415802f, 0.749136388f, -0.666999936f, 0.745057762f,
+    -0.671558976f, 0.740951121f, -0.676092684f, 0.736816585f, -0.680601001f, 0.732654274f, -0.685083687f, 0.728464365f,
+    -0.689540565f, 0.724247098f, -0.693971455f, 0.720002532f, -0.698376238f, 0.715730846f, -0.702754736f, 0.711432219f,
+    -0.707106769f, 0.707106769f, -0.711432219f, 0.702754736f, -0.715730846f, 0.698376238f, -0.720002532f, 0.693971455f,
+    -0.724247098f, 0.689540565f, -0.728464365f, 0.685083687f, -0.732654274f, 0.680601001f, -0.736816585f, 0.676092684f,
+    -0.740951121f, 0.671558976f, -0.745057762f, 0.666999936f, -0.749136388f, 0.662415802f, -0.753186822f, 0.657806695f,
+    -0.757208824f, 0.653172851f, -0.761202395f, 0.64851439f, -0.765167236f, 0.643831551f, -0.769103348f, 0.639124453f,
+    -0.773010433f, 0.634393275f, -0.77688849f, 0.629638255f, -0.780737221f, 0.624859512f, -0.784556568f, 0.620057225f,
+    -0.78834641f, 0.615231574f, -0.792106569f, 0.610382795f, -0.795836926f, 0.605511069f, -0.799537241f, 0.600616455f,
+    -0.803207517f, 0.59569931f, -0.806847572f, 0.590759695f, -0.81045717f, 0.585797846f, -0.81403631f, 0.580813944f,
+    -0.817584813f, 0.575808167f, -0.8211025f, 0.570780754f, -0.824589312f, 0.565731823f, -0.82804507f, 0.560661554f,
+    -0.831469595f, 0.555570245f, -0.834862888f, 0.550457954f, -0.838224709f, 0.545324981f, -0.841554999f, 0.540171444f,
+    -0.84485358f, 0.534997642f, -0.848120332f, 0.529803634f, -0.851355195f, 0.524589658f, -0.854557991f, 0.519356012f,
+    -0.857728601f, 0.514102757f, -0.860866964f, 0.50883013f, -0.863972843f, 0.50353837f, -0.867046237f, 0.498227656f,
+    -0.870086968f, 0.492898196f, -0.873094976f, 0.487550169f, -0.876070082f, 0.482183784f, -0.879012227f, 0.47679922f,
+    -0.881921291f, 0.471396744f, -0.884797096f, 0.465976506f, -0.887639642f, 0.460538715f, -0.890448749f, 0.455083579f,
+    -0.893224299f, 0.449611336f, -0.895966232f, 0.444122136f, -0.898674488f, 0.438616246f, -0.901348829f, 0.433093816f,
+    -0.903989315f, 0.427555084f, -0.906595707f, 0.422000259f, -0.909168005f, 0.416429549f, -0.91170603f, 0.410843164f,
+    -0.914209783f, 0.405241311f, -0.916679084f, 0.399624199f, -0.919113874f, 0.393992037f, -0.921514034f, 0.388345033f,
+    -0.923879504f, 0.382683426f, -0.926210225f, 0.377007425f, -0.928506076f, 0.371317208f, -0.93076694f, 0.365612984f,
+    -0.932992816f, 0.359895051f, -0.935183525f, 0.354163527f, -0.937339008f, 0.348418683f, -0.939459205f, 0.342660725f,
+    -0.941544056f, 0.336889863f, -0.943593442f, 0.331106305f, -0.945607305f, 0.32531029f, -0.947585583f, 0.319502026f,
+    -0.949528158f, 0.313681751f, -0.95143503f, 0.307849646f, -0.953306019f, 0.302005947f, -0.955141187f, 0.296150893f,
+    -0.956940353f, 0.290284663f, -0.958703458f, 0.284407526f, -0.960430503f, 0.27851969f, -0.962121427f, 0.272621363f,
+    -0.963776052f, 0.266712755f, -0.965394437f, 0.260794103f, -0.966976464f, 0.254865646f, -0.968522072f, 0.248927608f,
+    -0.970031261f, 0.242980182f, -0.971503913f, 0.237023607f, -0.972939968f, 0.231058106f, -0.974339366f, 0.225083917f,
+    -0.975702107f, 0.219101235f, -0.977028131f, 0.213110313f, -0.97831738f, 0.207111374f, -0.979569793f, 0.201104641f,
+    -0.980785251f, 0.195090324f, -0.981963873f, 0.18906866f, -0.983105481f, 0.183039889f, -0.984210074f, 0.177004218f,
+    -0.985277653f, 0.170961887f, -0.986308098f, 0.164913118f, -0.987301409f, 0.15885815f, -0.988257587f, 0.152797192f,
+    -0.989176512f, 0.146730468f, -0.990058184f, 0.140658244f, -0.990902662f, 0.134580702f, -0.991709769f, 0.128498107f,
+    -0.992479563f, 0.122410677f, -0.993211925f, 0.116318628f, -0.993906975f, 0.110222206f, -0.994564593f, 0.104121633f,
+    -0.99518472f, 0.0980171412f, -0.995767415f, 0.0919089541f, -0.996312618f, 0.0857973099f, -0.996820271f, 0.0796824396f,
+    -0.997290432f, 0.0735645667f, -0.997723043f, 0.0674439222f, -0.998118103f, 0.061320737f, -0.998475552f, 0.0551952459f,
+    -0.99879545f, 0.0490676761f, -0.999077737f, 0.0429382585f, -0.999322355f, 0.0368072242f, -0.999529421f, 0.030674804f,
+    -0.999698818f, 0.024541229f, -0.999830604f, 0.0184067301f, -0.999924719f, 0.0122715384f, -0.999981165f, 0.00613588467f,
+    -1.0f, 1.22464685e-16f, -0.999981165f, -0.00613588467f, -0.999924719f, -0.0122715384f, -0.999830604f, -0.0184067301f,
+    -0.999698818f, -0.024541229f, -0.999529421f, -0.030674804f, -0.999322355f, -0.0368072242f, -0.999077737f, -0.0429382585f,
+    -0.99879545f, -0.0490676761f, -0.998475552f, -0.0551952459f, -0.998118103f, -0.061320737f, -0.997723043f, -0.0674439222f,
+    -0.997290432f, -0.0735645667f, -0.996820271f, -0.0796824396f, -0.996312618f, -0.0857973099f, -0.995767415f, -0.0919089541f,
+    -0.99518472f, -0.0980171412f, -0.994564593f, -0.104121633f, -0.993906975f, -0.110222206f, -0.993211925f, -0.116318628f,
+    -0.992479563f, -0.122410677f, -0.991709769f, -0.128498107f, -0.990902662f, -0.134580702f, -0.990058184f, -0.140658244f,
+    -0.989176512f, -0.146730468f, -0.988257587f, -0.152797192f, -0.987301409f, -0.15885815f, -0.986308098f, -0.164913118f,
+    -0.985277653f, -0.170961887f, -0.984210074f, -0.177004218f, -0.983105481f, -0.183039889f, -0.981963873f, -0.18906866f,
+    -0.980785251f, -0.195090324f, -0.979569793f, -0.201104641f, -0.97831738f, -0.207111374f, -0.977028131f, -0.213110313f,
+    -0.975702107f, -0.219101235f, -0.974339366f, -0.225083917f, -0.972939968f, -0.231058106f, -0.971503913f, -0.237023607f,
+    -0.970031261f, -0.242980182f, -0.968522072f, -0.248927608f, -0.966976464f, -0.254865646f, -0.965394437f, -0.260794103f,
+    -0.963776052f, -0.266712755f, -0.962121427f, -0.272621363f, -0.960430503f, -0.27851969f, -0.958703458f, -0.284407526f,
+    -0.956940353f, -0.290284663f, -0.955141187f, -0.296150893f, -0.953306019f, -0.302005947f, -0.95143503f, -0.307849646f,
+    -0.949528158f, -0.313681751f, -0.947585583f, -0.319502026f, -0.945607305f, -0.32531029f, -0.943593442f, -0.331106305f,
+    -0.941544056f, -0.336889863f, -0.939459205f, -0.342660725f, -0.937339008f, -0.348418683f, -0.935183525f, -0.354163527f,
+    -0.932992816f, -0.359895051f, -0.93076694f, -0.365612984f, -0.928506076f, -0.371317208f, -0.926210225f, -0.377007425f,
+    -0.923879504f, -0.382683426f, -0.921514034f, -0.388345033f, -0.919113874f, -0.393992037f, -0.916679084f, -0.399624199f,
+    -0.914209783f, -0.405241311f, -0.91170603f, -0.410843164f, -0.909168005f, -0.416429549f, -0.906595707f, -0.422000259f,
+    -0.903989315f, -0.427555084f, -0.901348829f, -0.433093816f, -0.898674488f, -0.438616246f, -0.895966232f, -0.444122136f,
+    -0.893224299f, -0.449611336f, -0.890448749f, -0.455083579f, -0.887639642f, -0.460538715f, -0.884797096f, -0.465976506f,
+    -0.881921291f, -0.471396744f, -0.879012227f, -0.47679922f, -0.876070082f, -0.482183784f, -0.873094976f, -0.487550169f,
+    -0.870086968f, -0.492898196f, -0.867046237f, -0.498227656f, -0.863972843f, -0.50353837f, -0.860866964f, -0.50883013f,
+    -0.857728601f, -0.514102757f, -0.854557991f, -0.519356012f, -0.851355195f, -0.524589658f, -0.848120332f, -0.529803634f,
+    -0.84485358f, -0.534997642f, -0.841554999f, -0.540171444f, -0.838224709f, -0.545324981f, -0.834862888f, -0.550457954f,
+    -0.831469595f, -0.555570245f, -0.82804507f, -0.560661554f, -0.824589312f, -0.565731823f, -0.8211025f, -0.570780754f,
+    -0.817584813f, -0.575808167f, -0.81403631f, -0.580813944f, -0.81045717f, -0.585797846f, -0.806847572f, -0.590759695f,
+    -0.803207517f, -0.59569931f, -0.799537241f, -0.600616455f, -0.795836926f, -0.605511069f, -0.792106569f, -0.610382795f,
+    -0.78834641f, -0.615231574f, -0.784556568f, -0.620057225f, -0.780737221f, -0.624859512f, -0.77688849f, -0.629638255f,
+    -0.773010433f, -0.634393275f, -0.769103348f, -0.639124453f, -0.765167236f, -0.643831551f, -0.761202395f, -0.64851439f,
+    -0.757208824f, -0.653172851f, -0.753186822f, -0.657806695f, -0.749136388f, -0.662415802f, -0.745057762f, -0.666999936f,
+    -0.740951121f, -0.671558976f, -0.736816585f, -0.676092684f, -0.732654274f, -0.680601001f, -0.728464365f, -0.685083687f,
+    -0.724247098f, -0.689540565f, -0.720002532f, -0.693971455f, -0.715730846f, -0.698376238f, -0.711432219f, -0.702754736f,
+    -0.707106769f, -0.707106769f, -0.702754736f, -0.711432219f, -0.698376238f, -0.715730846f, -0.693971455f, -0.720002532f,
+    -0.689540565f, -0.724247098f, -0.685083687f, -0.728464365f, -0.680601001f, -0.732654274f, -0.676092684f, -0.736816585f,
+    -0.671558976f, -0.740951121f, -0.666999936f, -0.745057762f, -0.662415802f, -0.749136388f, -0.657806695f, -0.753186822f,
+    -0.653172851f, -0.757208824f, -0.64851439f, -0.761202395f, -0.643831551f, -0.765167236f, -0.639124453f, -0.769103348f,
+    -0.634393275f, -0.773010433f, -0.629638255f, -0.77688849f, -0.624859512f, -0.780737221f, -0.620057225f, -0.784556568f,
+    -0.615231574f, -0.78834641f, -0.610382795f, -0.792106569f, -0.605511069f, -0.795836926f, -0.600616455f, -0.799537241f,
+    -0.59569931f, -0.803207517f, -0.590759695f, -0.806847572f, -0.585797846f, -0.81045717f, -0.580813944f, -0.81403631f,
+    -0.575808167f, -0.817584813f, -0.570780754f, -0.8211025f, -0.565731823f, -0.824589312f, -0.560661554f, -0.82804507f,
+    -0.555570245f, -0.831469595f, -0.550457954f, -0.834862888f, -0.545324981f, -0.838224709f, -0.540171444f, -0.841554999f,
+    -0.534997642f, -0.84485358f, -0.529803634f, -0.848120332f, -0.524589658f, -0.851355195f, -0.519356012f, -0.854557991f,
+    -0.514102757f, -0.857728601f, -0.50883013f, -0.860866964f, -0.50353837f, -0.863972843f, -0.498227656f, -0.867046237f,
+    -0.492898196f, -0.870086968f, -0.487550169f, -0.873094976f, -0.482183784f, -0.876070082f, -0.47679922f, -0.879012227f,
+    -0.471396744f, -0.881921291f, -0.465976506f, -0.884797096f, -0.460538715f, -0.887639642f, -0.455083579f, -0.890448749f,
+    -0.449611336f, -0.893224299f, -0.444122136f, -0.895966232f, -0.438616246f, -0.898674488f, -0.433093816f, -0.901348829f,
+    -0.427555084f, -0.903989315f, -0.422000259f, -0.906595707f, -0.416429549f, -0.909168005f, -0.410843164f, -0.91170603f,
+    -0.405241311f, -0.914209783f, -0.399624199f, -0.916679084f, -0.393992037f, -0.919113874f, -0.388345033f, -0.921514034f,
+    -0.382683426f, -0.923879504f, -0.377007425f, -0.926210225f, -0.371317208f, -0.928506076f, -0.365612984f, -0.93076694f,
+    -0.359895051f, -0.932992816f, -0.354163527f, -0.935183525f, -0.348418683f, -0.937339008f, -0.342660725f, -0.939459205f,
+    -0.336889863f, -0.941544056f, -0.331106305f, -0.943593442f, -0.32531029f, -0.945607305f, -0.319502026f, -0.947585583f,
+    -0.313681751f, -0.949528158f, -0.307849646f, -0.95143503f, -0.302005947f, -0.953306019f, -0.296150893f, -0.955141187f,
+    -0.290284663f, -0.956940353f, -0.284407526f, -0.958703458f, -0.27851969f, -0.960430503f, -0.272621363f, -0.962121427f,
+    -0.266712755f, -0.963776052f, -0.260794103f, -0.965394437f, -0.254865646f, -0.966976464f, -0.248927608f, -0.968522072f,
+    -0.242980182f, -0.970031261f, -0.237023607f, -0.971503913f, -0.231058106f, -0.972939968f, -0.225083917f, -0.974339366f,
+    -0.219101235f, -0.975702107f, -0.213110313f, -0.977028131f, -0.207111374f, -0.97831738f, -0.201104641f, -0.979569793f,
+    -0.195090324f, -0.980785251f, -0.18906866f, -0.981963873f, -0.183039889f, -0.983105481f, -0.177004218f, -0.984210074f,
+    -0.170961887f, -0.985277653f, -0.164913118f, -0.986308098f, -0.15885815f, -0.987301409f, -0.152797192f, -0.988257587f,
+    -0.146730468f, -0.989176512f, -0.140658244f, -0.990058184f, -0.134580702f, -0.990902662f, -0.128498107f, -0.991709769f,
+    -0.122410677f, -0.992479563f, -0.116318628f, -0.993211925f, -0.110222206f, -0.993906975f, -0.104121633f, -0.994564593f,
+    -0.0980171412f, -0.99518472f, -0.0919089541f, -0.995767415f, -0.0857973099f, -0.996312618f, -0.0796824396f, -0.996820271f,
+    -0.0735645667f, -0.997290432f, -0.0674439222f, -0.997723043f, -0.061320737f, -0.998118103f, -0.0551952459f, -0.998475552f,
+    -0.0490676761f, -0.99879545f, -0.0429382585f, -0.999077737f, -0.0368072242f, -0.999322355f, -0.030674804f, -0.999529421f,
+    -0.024541229f, -0.999698818f, -0.0184067301f, -0.999830604f, -0.0122715384f, -0.999924719f, -0.00613588467f, -0.999981165f,
+};
@@ -0,0 +1,704 @@
+#include "apm32f4xx_conf.h"
+#include "apm32f4xx_eth.h"
+#include "EthBuf.h"
+#include "Critical.h"
+
+#if ETHBUF_ENABLE
+
+#if (ETHBUF_SIZE % 4) != 0
+#error "ETHBUF_SIZE must be a multiple of 4"
+#endif
+#if ETHBUF_POOL_SIZE <= ETHBUF_RX_DESC
+#error "ETHBUF_POOL_SIZE must exceed ETHBUF_RX_DESC"
+#endif
+
+/* The FCS the MAC appends to the received frame length */
+#define ETHBUF_FCS_LEN      4U
+
+#define ETHBUF_NEXT(i, n)   (((i) + 1U == (n)) ? 0U : ((i) + 1U))
+
+/* Descriptor rings and buffer storage must stay reachable by the ETH DMA (not CCM) */
+static ETH_DMADescConfig_T rxDesc[ETHBUF_RX_DESC];
+static ETH_DMADescConfig_T txDesc[ETHBUF_TX_DESC];
+static uint32_t poolStorage[ETHBUF_POOL_SIZE][ETHBUF_SIZE / 4U];
+static EthBuf_T pool[ETHBUF_POOL_SIZE];
+static EthBuf_T* poolFree;
+static uint32_t poolCount;
+
+/* Receive ring: the buffer armed on each descriptor, NULL while it waits for one */
+static EthBuf_T* rxArmed[ETHBUF_RX_DESC];
+static uint32_t rxNext;         /* Next descriptor to harvest */
+static uint32_t rxRefill;       /* Next descriptor to re-arm */
+static uint32_t rxEmpty;        /* Descriptors waiting for a buffer */
+
+/* Received frames, produced by the ISR and consumed by EthBufReceive() */
+#define ETHBUF_RX_QUEUE     (ETHBUF_POOL_SIZE + 1U)
+static EthBuf_T* rxQueue[ETHBUF_RX_QUEUE];
+static volatile uint32_t rxQueueHead;
+static volatile uint32_t rxQueueTail;
+
+/* Transmit ring: the frame to free when its last descriptor completes */
+static EthBuf_T* txFrame[ETHBUF_TX_DESC];
+static uint32_t txNext;         /* Next descriptor to fill */
+static uint32_t txReclaim;      /* Oldest descriptor handed to DMA */
+static uint32_t txUsed;         /* Descriptors handed to DMA */
+
+static EthBufRxCallback_T rxCallback;
+static EthBufStats_T ethStats;
+
+/*!
+ * @brief       Take a buffer from the pool.
+ *
+ * @param       None
+ *
+ * @retval      Buffer with one reference and empty payload, NULL when the pool is empty
+ *
+ * @note        Called with interrupts masked.
+ */
+static EthBuf_T* EthBufPoolGet(void)
+{
+    EthBuf_T* buf = poolFree;
+
+    if (buf == NULL)
+    {
+        return NULL;
+    }
+
+    poolFree = buf->next;
+    poolCount--;
+    if (poolCount < ethStats.poolLow)
+    {
+        ethStats.poolLow = poolCount;
+    }
+
+    buf->next = NULL;
+    buf->payload = (uint8_t*)poolStorage[buf - pool];
+    buf->len = 0;
+    buf->totLen = 0;
+    buf->ref = 1;
+    buf->flags = 0;
+
+    return buf;
+}
+
+static void EthBufPoolPut(EthBuf_T* buf)
+{
+    buf->next = poolFree;
+    poolFree = buf;
+    poolCount++;
+}
+
+/*!
+ * @brief       Arm the empty receive descriptors with pool buffers, in ring
+ *              order, and resume a suspended receive DMA.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Called with interrupts masked.
+ */
+static void EthBufRxArm(void)
+{
+    __IO ETH_DMADescConfig_T* desc;
+    EthBuf_T* buf;
+    uint8_t armed = 0;
+
+    while (rxEmpty != 0)
+    {
+        buf = EthBufPoolGet();
+        if (buf == NULL)
+        {
+            ethStats.rxStarved++;
+            break;
+        }
+
+        desc = &rxDesc[rxRefill];
+        rxArmed[rxRefill] = buf;
+        desc->Buffer1Addr = (uint32_t)buf->payload;
+        desc->ControlBufferSize = ETH_DMARXDESC_RXCH | ETHBUF_SIZE;
+        __DMB();
+        desc->Status = ETH_DMARXDESC_OWN;
+
+        rxRefill = ETHBUF_NEXT(rxRefill, ETHBUF_RX_DESC);
+        rxEmpty--;
+        armed = 1;
+    }
+
+    if (armed && ((ETH->DMASTS & ETH_DMA_INT_RBU) != 0))
+    {
+        ETH->DMASTS = ETH_DMA_INT_RBU;
+        ETH->DMARXPD = 0;
+    }
+}
+
+/*!
+ * @brief       Checksum verdict of the MAC receive checksum engine.
+ *
+ * @param       desc:  Last descriptor of the frame
+ *
+ * @retval      ETHBUF_FLAG_RX_* flags
+ *
+ * @note        Needs ETH_CHECKSUMOFFLAOD_ENABLE in ETH_Config(). Without
+ *              enhanced descriptors only the header error bit is reported,
+ *              so the frame is left unchecked.
+ */
+static uint8_t EthBufRxChecksumFlags(const ETH_DMADescConfig_T* desc)
+{
+#if USE_ENHANCED_DMA_DESCRIPTORS
+    uint32_t ext = desc->ExtendedStatus;
+    uint8_t flags;
+
+    /* MAMPCE doubles as "extended status available" with enhanced descriptors */
+    if (((desc->Status & ETH_DMARXDESC_MAMPCE) == 0) || ((ext & ETH_DMAPTPRXDESC_IPV4P) == 0) ||
+        ((ext & ETH_DMAPTPRXDESC_IPCBP) != 0))
+    {
+        return 0;
+    }
+
+    flags = ETHBUF_FLAG_RX_CSUM_CHECKED;
+    if ((ext & ETH_DMAPTPRXDESC_IPHERR) != 0)
+    {
+        flags |= ETHBUF_FLAG_RX_IPHDR_ERR;
+    }
+    if ((ext & ETH_DMAPTPRXDESC_IPPERR) != 0)
+    {
+        flags |= ETHBUF_FLAG_RX_PAYLOAD_ERR;
+    }
+
+    return flags;
+#else
+    (void)desc;
+
+    return 0;
+#endif
+}
+
+/*!
+ * @brief       Hand the oldest received frame to the receive queue.
+ *
+ * @param       None
+ *
+ * @retval      1 when a frame was queued, 0 when a bad frame was recycled,
+ *              -1 when no complete frame is waiting
+ *
+ * @note        Called from the ETH ISR. Frames the MAC marked bad (or that
+ *              were cut short) keep their buffers and are re-armed in place.
+ */
+static int32_t EthBufRxHarvest(void)
+{
+    EthBuf_T* head = NULL;
+    EthBuf_T* tail = NULL;
+    EthBuf_T* buf;
+    uint32_t first = rxNext;
+    uint32_t index = first;
+    uint32_t segs = 0;
+    uint32_t status = 0;
+    uint32_t last = first;
+    uint32_t remaining, i;
+
+    /* Walk to the last segment; stop at a descriptor still owned by DMA */
+    do
+    {
+        if (rxArmed[index] == NULL)
+        {
+            return -1;
+        }
+        status = rxDesc[index].Status;
+        if ((status & ETH_DMARXDESC_OWN) != 0)
+        {
+            return -1;
+        }
+        segs++;
+        last = index;
+        index = ETHBUF_NEXT(index, ETHBUF_RX_DESC);
+    } while (((status & ETH_DMARXDESC_LDES) == 0) && (segs < ETHBUF_RX_DESC));
+
+    remaining = (status & ETH_DMARXDESC_FL) >> ETH_DMARXDESC_FRAMELENGTHSHIFT;
+    rxNext = index;
+
+    if (((rxDesc[first].Status & ETH_DMARXDESC_FDES) == 0) || ((status & ETH_DMARXDESC_LDES) == 0) ||
+        ((status & ETH_DMARXDESC_ERRS) != 0) || (remaining <= ETHBUF_FCS_LEN))
+    {
+        for (i = first; segs != 0; segs--, i = ETHBUF_NEXT(i, ETHBUF_RX_DESC))
+        {
+            rxDesc[i].Status = ETH_DMARXDESC_OWN;
+        }
+        ethStats.rxErrors++;
+        return 0;
+    }
+
+    /* Lend the buffers: the chain carries the frame without the FCS */
+    remaining -= ETHBUF_FCS_LEN;
+    for (i = first; segs != 0; segs--, i = ETHBUF_NEXT(i, ETHBUF_RX_DESC))
+    {
+        buf = rxArmed[i];
+        rxArmed[i] = NULL;
+        rxEmpty++;
+
+        if (remaining == 0)
+        {
+            /* Segment held only FCS bytes */
+            EthBufPoolPut(buf);
+            continue;
+        }
+
+        buf->len = (uint16_t)((remaining < ETHBUF_SIZE) ? remaining : ETHBUF_SIZE);
+        buf->totLen = (uint16_t)remaining;
+        remaining -= buf->len;
+
+        if (tail == NULL)
+        {
+            head = buf;
+        }
+        else
+        {
+            tail->next = buf;
+        }
+        tail = buf;
+    }
+
+    head->flags = EthBufRxChecksumFlags(&rxDesc[last]);
+    rxQueue[rxQueueHead] = head;
+    rxQueueHead = ETHBUF_NEXT(rxQueueHead, ETHBUF_RX_QUEUE);
+    ethStats.rxFrames++;
+
+    return 1;
+}
+
+/*!
+ * @brief       Free the frames whose transmit descriptors completed.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Called from the ETH ISR or with interrupts masked.
+ */
+static void EthBufTxReclaim(void)
+{
+    uint32_t status;
+
+    while ((txUsed != 0) && (((status = txDesc[txReclaim].Status) & ETH_DMATXDESC_OWN) == 0))
+    {
+        if (txFrame[txReclaim] != NULL)
+        {
+            if ((status & ETH_DMATXDESC_ERRS) != 0)
+            {
+                ethStats.txErrors++;
+            }
+            else
+            {
+                ethStats.txFrames++;
+            }
+            EthBufFree(txFrame[txReclaim]);
+            txFrame[txReclaim] = NULL;
+        }
+
+        txReclaim = ETHBUF_NEXT(txReclaim, ETHBUF_TX_DESC);
+        txUsed--;
+    }
+}
+
+/*!
+ * @brief       Build the descriptor rings, arm the receive ring and enable
+ *              the receive/transmit interrupts.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        Call after ETH_Config() and before ETH_Start(). Frames still
+ *              held by the stack must not be used afterwards.
+ */
+void EthBufInit(void)
+{
+    uint32_t i;
+
+    NVIC_DisableIRQ(ETH_IRQn);
+
+    poolFree = NULL;
+    poolCount = 0;
+    for (i = ETHBUF_POOL_SIZE; i != 0; i--)
+    {
+        EthBufPoolPut(&pool[i - 1U]);
+    }
+
+    ethStats = (EthBufStats_T){ 0 };
+    ethStats.poolLow = poolCount;
+
+    for (i = 0; i < ETHBUF_RX_DESC; i++)
+    {
+        rxDesc[i].Status = 0;
+        rxDesc[i].Buffer2NextDescAddr = (uint32_t)&rxDesc[ETHBUF_NEXT(i, ETHBUF_RX_DESC)];
+        rxArmed[i] = NULL;
+    }
+    rxNext = 0;
+    rxRefill = 0;
+    rxEmpty = ETHBUF_RX_DESC;
+    rxQueueHead = 0;
+    rxQueueTail = 0;
+    EthBufRxArm();
+
+    for (i = 0; i < ETHBUF_TX_DESC; i++)
+    {
+        txDesc[i].Status = ETH_DMATXDESC_TXCH;
+        txDesc[i].ControlBufferSize = 0;
+        txDesc[i].Buffer2NextDescAddr = (uint32_t)&txDesc[ETHBUF_NEXT(i, ETHBUF_TX_DESC)];
+        txFrame[i] = NULL;
+    }
+    txNext = 0;
+    txReclaim = 0;
+    txUsed = 0;
+
+#if USE_ENHANCED_DMA_DESCRIPTORS
+    /* Receive checksum results are reported in the extended status word */
+    ETH_EnableEnhancedDescriptor();
+#endif
+    ETH->DMARXDLADDR = (uint32_t)rxDesc;
+    ETH->DMATXDLADDR = (uint32_t)txDesc;
+
+    ETH_EnableDMAInterrupt(ETH_DMA_INT_NIS | ETH_DMA_INT_RX | ETH_DMA_INT_TX);
+    NVIC_EnableIRQ(ETH_IRQn);
+}
+
+/*!
+ * @brief       Set the function called after each batch of received frames.
+ *
+ * @param       callback:  Called from the ETH ISR with the number of frames
+ *                         queued (NULL: none, poll EthBufReceive())
+ *
+ * @retval      None
+ */
+void EthBufSetRxCallback(EthBufRxCallback_T callback)
+{
+    rxCallback = callback;
+}
+
+/*!
+ * @brief       Allocate a pool buffer chain for len bytes.
+ *
+ * @param       len:  Frame length, split over several buffers above ETHBUF_SIZE
+ *
+ * @retval      Chain with one reference per segment, NULL when the pool is short
+ */
+EthBuf_T* EthBufAlloc(uint16_t len)
+{
+    EthBuf_T* head = NULL;
+    EthBuf_T* tail = NULL;
+    EthBuf_T* buf;
+    uint32_t remaining = len;
+
+    CRITICAL_ENTER();
+    do
+    {
+        buf = EthBufPoolGet();
+        if (buf == NULL)
+        {
+            while (head != NULL)
+            {
+                buf = head->next;
+                EthBufPoolPut(head);
+                head = buf;
+            }
+            break;
+        }
+
+        buf->len = (uint16_t)((remaining < ETHBUF_SIZE) ? remaining : ETHBUF_SIZE);
+        buf->totLen = (uint16_t)remaining;
+        remaining -= buf->len;
+
+        if (tail == NULL)
+        {
+            head = buf;
+        }
+        else
+        {
+            tail->next = buf;
+        }
+        tail = buf;
+    } while (remaining != 0);
+    CRITICAL_EXIT();
+
+    return head;
+}
+
+/*!
+ * @brief       Wrap external memory in a caller-owned segment.
+ *
+ * @param       buf:      Segment to initialize
+ *
+ * @param       data:     Segment data, must be reachable by the ETH DMA
+ *
+ * @param       len:      Bytes
+ *
+ * @param       release:  Called when the last reference is dropped, possibly
+ *                        from the ETH ISR (may be NULL only if the segment is
+ *                        never freed)
+ *
+ * @retval      None
+ */
+void EthBufInitRef(EthBuf_T* buf, void* data, uint16_t len, void (*release)(EthBuf_T* buf))
+{
+    buf->next = NULL;
+    buf->payload = (uint8_t*)data;
+    buf->len = len;
+    buf->totLen = len;
+    buf->ref = 1;
+    buf->flags = 0;
+    buf->release = release;
+}
+
+/*!
+ * @brief       Append a chain to a frame.
+ *
+ * @param       head:  Frame
+ *
+ * @param       tail:  Chain to append; its reference passes to head
+ *
+ * @retval      None
+ */
+void EthBufChain(EthBuf_T* head, EthBuf_T* tail)
+{
+    EthBuf_T* buf;
+
+    for (buf = head; buf->next != NULL; buf = buf->next)
+    {
+        buf->totLen += tail->totLen;
+    }
+    buf->totLen += tail->totLen;
+    buf->next = tail;
+}
+
+/*!
+ * @brief       Take another reference to a segment, e.g. to keep a frame
+ *              that is handed to EthBufTransmit().
+ *
+ * @param       buf:  Segment
+ *
+ * @retval      None
+ */
+void EthBufRef(EthBuf_T* buf)
+{
+    CRITICAL_ENTER();
+    buf->ref++;
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Drop a reference to a chain. Segments reaching zero
+ *              references are released, pool buffers re-arm the receive ring.
+ *
+ * @param       buf:  First segment (may be NULL)
+ *
+ * @retval      None
+ *
+ * @note        As with lwIP pbufs, freeing stops at the first segment that
+ *              is still referenced elsewhere.
+ */
+void EthBufFree(EthBuf_T* buf)
+{
+    EthBuf_T* next;
+
+    CRITICAL_ENTER();
+    while (buf != NULL)
+    {
+        next = buf->next;
+        if (--buf->ref != 0)
+        {
+            break;
+        }
+
+        if (buf->release != NULL)
+        {
+            buf->release(buf);
+        }
+        else
+        {
+            EthBufPoolPut(buf);
+        }
+        buf = next;
+    }
+    EthBufRxArm();
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Take the oldest received frame.
+ *
+ * @param       None
+ *
+ * @retval      Frame (the stack owns it until EthBufFree()), NULL if none
+ */
+EthBuf_T* EthBufReceive(void)
+{
+    EthBuf_T* frame;
+    uint32_t tail = rxQueueTail;
+
+    if (tail == rxQueueHead)
+    {
+        return NULL;
+    }
+
+    frame = rxQueue[tail];
+    rxQueueTail = ETHBUF_NEXT(tail, ETHBUF_RX_QUEUE);
+
+    return frame;
+}
+
+/*!
+ * @brief       Queue a frame for transmission, one descriptor per non-empty
+ *              segment, without copying.
+ *
+ * @param       frame:  Frame; on success its reference passes to the driver
+ *                      and is dropped when transmission completes. With
+ *                      ETHBUF_FLAG_TX_CSUM the checksum fields must be zero
+ *                      and the MAC must run in transmit store-and-forward mode
+ *
+ * @retval      ETH_SUCCESS, or ETH_ERROR when there are not enough free
+ *              descriptors (the caller keeps the frame)
+ *
+ * @note        Segment data must stay untouched until the frame is freed.
+ */
+uint32_t EthBufTransmit(EthBuf_T* frame)
+{
+    __IO ETH_DMADescConfig_T* desc;
+    EthBuf_T* buf;
+    uint32_t segs = 0;
+    uint32_t first, last, index;
+    uint32_t status;
+
+    for (buf = frame; buf != NULL; buf = buf->next)
+    {
+        segs += (buf->len != 0) ? 1U : 0U;
+    }
+
+    CRITICAL_ENTER();
+    EthBufTxReclaim();
+
+    if ((segs == 0) || (segs > ETHBUF_TX_DESC - txUsed))
+    {
+        ethStats.txBusy++;
+        CRITICAL_EXIT();
+        return ETH_ERROR;
+    }
+
+    first = txNext;
+    last = first;
+    index = first;
+    for (buf = frame; buf != NULL; buf = buf->next)
+    {
+        if (buf->len == 0)
+        {
+            continue;
+        }
+
+        desc = &txDesc[index];
+        desc->Buffer1Addr = (uint32_t)buf->payload;
+        desc->ControlBufferSize = buf->len & ETH_DMATXDESC_TXBS1;
+
+        status = ETH_DMATXDESC_TXCH;
+        if (index == first)
+        {
+            status |= ETH_DMATXDESC_FS;
+        }
+        else
+        {
+            /* Following segments go to DMA now, the chain starts with the first */
+            status |= ETH_DMATXDESC_OWN;
+        }
+        if (--segs == 0)
+        {
+            status |= ETH_DMATXDESC_LS | ETH_DMATXDESC_INTC;
+        }
+        desc->Status = status;
+        if ((frame->flags & ETHBUF_FLAG_TX_CSUM) != 0)
+        {
+            ETH_ConfigDMATxDescChecksumInsertion((ETH_DMADescConfig_T*)desc, ETH_DMATXDESC_CHECKSUMTCPUDPICMPFULL);
+        }
+
+        last = index;
+        index = ETHBUF_NEXT(index, ETHBUF_TX_DESC);
+        txUsed++;
+    }
+    txFrame[last] = frame;
+    txNext = index;
+
+    __DMB();
+    txDesc[first].Status |= ETH_DMATXDESC_OWN;
+
+    /* Resume a transmit DMA suspended on an empty ring */
+    if ((ETH->DMASTS & ETH_DMA_INT_TBU) != 0)
+    {
+        ETH->DMASTS = ETH_DMA_INT_TBU;
+    }
+    ETH->DMATXPD = 0;
+    CRITICAL_EXIT();
+
+    return ETH_SUCCESS;
+}
+
+/*!
+ * @brief       Read the buffer counters.
+ *
+ * @param       stats:  Filled with a snapshot
+ *
+ * @retval      None
+ */
+void EthBufStats(EthBufStats_T* stats)
+{
+    CRITICAL_ENTER();
+    *stats = ethStats;
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       ETH interrupt: reclaim completed transmit descriptors, then
+ *              harvest up to ETHBUF_RX_BATCH received frames and report them
+ *              with one callback.
+ *
+ * @param       None
+ *
+ * @retval      None
+ *
+ * @note        With more frames waiting after a full batch the interrupt is
+ *              pended again, so other interrupts are not starved at line rate.
+ */
+void EthBufIRQHandler(void)
+{
+    uint32_t frames = 0;
+    uint32_t i;
+    int32_t result;
+
+    ETH->DMASTS = ETH_DMA_INT_NIS | ETH_DMA_INT_RX | ETH_DMA_INT_TX;
+
+    EthBufTxReclaim();
+
+    for (i = 0; i < ETHBUF_RX_BATCH; i++)
+    {
+        result = EthBufRxHarvest();
+        if (result < 0)
+        {
+            break;
+        }
+        frames += (uint32_t)result;
+    }
+    EthBufRxArm();
+
+    if ((i == ETHBUF_RX_BATCH) && (rxArmed[rxNext] != NULL) &&
+        ((rxDesc[rxNext].Status & ETH_DMARXDESC_OWN) == 0))
+    {
+        NVIC_SetPendingIRQ(ETH_IRQn);
+    }
+
+    if (frames != 0)
+    {
+        ethStats.rxBatches++;
+        if (rxCallback != NULL)
+        {
+            rxCallback(frames);
+        }
+    }
+}
+
+#endif // ETHBUF_ENABLE
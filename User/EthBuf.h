@@ -0,0 +1,111 @@
+#ifndef ETH_BUF_H
+#define ETH_BUF_H
+
+#include <stdint.h>
+
+/*
+ * Zero-copy Ethernet frame buffers on the ETH DMA descriptor rings.
+ *
+ * Received frames are handed to the stack in the pool buffers the DMA wrote
+ * them to; the descriptor is re-armed with a fresh buffer at once and the
+ * received one goes back to the pool on EthBufFree(). Transmit gathers a
+ * segment chain onto chained descriptors without copying.
+ *
+ * Enable with ETHBUF_ENABLE (the ETH_IRQHandler in apm32f4xx_int.c and the
+ * buffer pool are only built then). Configure the MAC and PHY with
+ * ETH_Config(), then call EthBufInit() and ETH_Start().
+ */
+
+#ifndef ETHBUF_ENABLE
+#define ETHBUF_ENABLE 0
+#endif
+
+/* Receive descriptors, each armed with one pool buffer */
+#ifndef ETHBUF_RX_DESC
+#define ETHBUF_RX_DESC 8
+#endif
+
+/* Transmit descriptors, one per frame segment */
+#ifndef ETHBUF_TX_DESC
+#define ETHBUF_TX_DESC 8
+#endif
+
+/* Pool buffers shared by receive and transmit, must exceed ETHBUF_RX_DESC */
+#ifndef ETHBUF_POOL_SIZE
+#define ETHBUF_POOL_SIZE 16
+#endif
+
+/* Bytes per pool buffer, a multiple of 4; smaller buffers chain long frames */
+#ifndef ETHBUF_SIZE
+#define ETHBUF_SIZE 1524
+#endif
+
+/* Most frames harvested per interrupt before the IRQ is re-pended */
+#ifndef ETHBUF_RX_BATCH
+#define ETHBUF_RX_BATCH 4
+#endif
+
+/**
+ * @brief Packet buffer: one segment of a frame.
+ *
+ * Segments are linked through next; totLen of the first segment is the
+ * frame length. Pool buffers own their storage. A caller-built segment
+ * (EthBufInitRef) points at external memory and gets release called when
+ * its last reference is dropped, which lets transmit gather a header from
+ * the pool and a payload from anywhere DMA can read (not CCM).
+ */
+typedef struct EthBuf
+{
+    struct EthBuf*  next;                       /*!< Next segment of the frame */
+    uint8_t*        payload;                    /*!< Segment data */
+    uint16_t        len;                        /*!< Bytes in this segment */
+    uint16_t        totLen;                     /*!< Bytes in this and the following segments */
+    uint8_t         ref;                        /*!< Reference count */
+    uint8_t         flags;                      /*!< ETHBUF_FLAG_* (first segment) */
+    void            (*release)(struct EthBuf* buf); /*!< Called at ref 0 (NULL: pool buffer) */
+} EthBuf_T;
+
+/* Transmit: have the MAC insert the IPv4 header and TCP/UDP/ICMP checksums */
+#define ETHBUF_FLAG_TX_CSUM         0x01
+/* Receive: the MAC checked the IPv4 header and payload checksums ... */
+#define ETHBUF_FLAG_RX_CSUM_CHECKED 0x10
+/* ... and found these errors */
+#define ETHBUF_FLAG_RX_IPHDR_ERR    0x20
+#define ETHBUF_FLAG_RX_PAYLOAD_ERR  0x40
+
+/* Called from the ETH interrupt after each batch of received frames */
+typedef void (*EthBufRxCallback_T)(uint32_t frames);
+
+/**
+ * @brief Ethernet buffer counters
+ */
+typedef struct
+{
+    uint32_t rxFrames;      /*!< Frames handed to the stack */
+    uint32_t rxErrors;      /*!< Frames the MAC marked bad, recycled */
+    uint32_t rxStarved;     /*!< Times a descriptor could not be re-armed for lack of buffers */
+    uint32_t rxBatches;     /*!< Receive interrupts that harvested at least one frame */
+    uint32_t txFrames;      /*!< Frames completed */
+    uint32_t txErrors;      /*!< Frames completed with an error status */
+    uint32_t txBusy;        /*!< EthBufTransmit() calls rejected for lack of descriptors */
+    uint32_t poolLow;       /*!< Fewest free pool buffers seen */
+} EthBufStats_T;
+
+void EthBufInit(void);
+void EthBufSetRxCallback(EthBufRxCallback_T callback);
+
+/* Buffers */
+EthBuf_T* EthBufAlloc(uint16_t len);
+void EthBufInitRef(EthBuf_T* buf, void* data, uint16_t len, void (*release)(EthBuf_T* buf));
+void EthBufChain(EthBuf_T* head, EthBuf_T* tail);
+void EthBufRef(EthBuf_T* buf);
+void EthBufFree(EthBuf_T* buf);
+
+/* Frames */
+EthBuf_T* EthBufReceive(void);
+uint32_t EthBufTransmit(EthBuf_T* frame);
+
+void EthBufStats(EthBufStats_T* stats);
+void EthBufIRQHandler(void);
+
+#endif // ETH_BUF_H
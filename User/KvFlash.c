@@ -0,0 +1,253 @@
+#include <string.h>
+#include "KvFlash.h"
+
+#define KVFLASH_FMC_SECTORS     12U     /* 1 MB parts */
+#define KVFLASH_FMC_ERRORS      (FMC_FLAG_ERROP | FMC_FLAG_ERRWRP | FMC_FLAG_ERRPGA | \
+                                 FMC_FLAG_ERRPGP | FMC_FLAG_ERRPGS)
+
+/* Internal flash geometry */
+static uint32_t KvFlashFmcSize(uint32_t sector)
+{
+    return (sector < 4U) ? 0x4000U : ((sector == 4U) ? 0x10000U : 0x20000U);
+}
+
+static uint32_t KvFlashFmcAddress(uint32_t sector)
+{
+    if (sector < 4U)
+    {
+        return FMC_BASE + sector * 0x4000U;
+    }
+
+    return (sector == 4U) ? FMC_BASE + 0x10000U : FMC_BASE + 0x20000U + (sector - 5U) * 0x20000U;
+}
+
+static uint8_t KvFlashFmcErase(KvFlash_T* flash, uint32_t sector)
+{
+    FMC_STATUS_T status;
+
+    FMC_Unlock();
+    FMC_ClearStatusFlag(KVFLASH_FMC_ERRORS);
+    status = FMC_EraseSector((FMC_SECTOR_T)((flash->first + sector) * 8U), KVFLASH_FMC_VOLTAGE);
+    FMC_Lock();
+
+    /* The data cache may still hold the old contents */
+    FMC_DisableDataCache();
+    FMC_ResetDataCache();
+    FMC_EnableDataCache();
+
+    flash->erases++;
+
+    return (status == FMC_COMPLETE) ? SUCCESS : ERROR;
+}
+
+static uint8_t KvFlashFmcProgram(KvFlash_T* flash, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+    uint32_t address = (uint32_t)(uintptr_t)flash->base + offset;
+    FMC_STATUS_T status = FMC_COMPLETE;
+    uint32_t i = 0;
+
+    FMC_Unlock();
+    FMC_ClearStatusFlag(KVFLASH_FMC_ERRORS);
+    while ((i < count) && (status == FMC_COMPLETE))
+    {
+        if ((KVFLASH_FMC_VOLTAGE == FMC_VOLTAGE_4) && (((address + i * 4U) & 7U) == 0) && ((count - i) >= 2U))
+        {
+            status = FMC_ProgramDoubleWord(address + i * 4U, ((uint64_t)words[i + 1U] << 32) | words[i]);
+            i += 2U;
+        }
+        else
+        {
+            status = FMC_ProgramWord(address + i * 4U, words[i]);
+            i++;
+        }
+    }
+    FMC_Lock();
+
+    flash->programs += i;
+
+    return (status == FMC_COMPLETE) ? SUCCESS : ERROR;
+}
+
+/*!
+ * @brief       Internal flash sectors as a store area.
+ *
+ * @param       flash:  Area to fill in
+ *
+ * @param       first:  First sector number (0-11)
+ *
+ * @param       count:  Sectors, all of one size
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t KvFlashFmcInit(KvFlash_T* flash, uint32_t first, uint32_t count)
+{
+    uint32_t i;
+
+    if ((count == 0) || (first + count > KVFLASH_FMC_SECTORS))
+    {
+        return ERROR;
+    }
+    for (i = 1; i < count; i++)
+    {
+        if (KvFlashFmcSize(first + i) != KvFlashFmcSize(first))
+        {
+            return ERROR;
+        }
+    }
+
+    memset(flash, 0, sizeof(*flash));
+    flash->base = (const uint8_t*)(uintptr_t)KvFlashFmcAddress(first);
+    flash->sectorSize = KvFlashFmcSize(first);
+    flash->sectors = count;
+    flash->erase = KvFlashFmcErase;
+    flash->program = KvFlashFmcProgram;
+    flash->first = first;
+
+    return SUCCESS;
+}
+
+/* RAM simulator **********************************************************/
+
+static uint32_t KvFlashSimRandom(KvFlashSim_T* sim)
+{
+    /* xorshift32 */
+    sim->seed ^= sim->seed << 13;
+    sim->seed ^= sim->seed >> 17;
+    sim->seed ^= sim->seed << 5;
+
+    return sim->seed;
+}
+
+/* Count an operation; 1 when it is the one the power cut hits */
+static uint8_t KvFlashSimTear(KvFlashSim_T* sim)
+{
+    if ((sim->countdown != 0) && (--sim->countdown == 0))
+    {
+        sim->off = 1;
+        return 1;
+    }
+
+    return 0;
+}
+
+static uint8_t KvFlashSimErase(KvFlash_T* flash, uint32_t sector)
+{
+    KvFlashSim_T* sim = (KvFlashSim_T*)flash;
+    uint32_t* words = (uint32_t*)(sim->memory + sector * flash->sectorSize);
+    uint32_t i;
+
+    if (sim->off)
+    {
+        return ERROR;
+    }
+    if (KvFlashSimTear(sim))
+    {
+        /* Some words erased, some untouched, some in between */
+        for (i = 0; i < flash->sectorSize / 4U; i++)
+        {
+            switch (KvFlashSimRandom(sim) % 3U)
+            {
+                case 0:
+                    words[i] = 0xFFFFFFFFU;
+                    break;
+
+                case 1:
+                    words[i] |= KvFlashSimRandom(sim);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        return ERROR;
+    }
+
+    memset(words, 0xFF, flash->sectorSize);
+    flash->erases++;
+
+    return SUCCESS;
+}
+
+static uint8_t KvFlashSimProgram(KvFlash_T* flash, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+    KvFlashSim_T* sim = (KvFlashSim_T*)flash;
+    uint32_t* target = (uint32_t*)(sim->memory + offset);
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (sim->off)
+        {
+            return ERROR;
+        }
+        if (KvFlashSimTear(sim))
+        {
+            /* Only some of the bits to clear are cleared */
+            target[i] &= words[i] | KvFlashSimRandom(sim);
+            return ERROR;
+        }
+
+        /* Programming only clears bits */
+        target[i] &= words[i];
+        flash->programs++;
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       RAM flash, erased.
+ *
+ * @param       sim:         Simulator
+ *
+ * @param       memory:      sectorSize * sectors bytes, word aligned
+ *
+ * @param       sectorSize:  Bytes per sector, a multiple of 8
+ *
+ * @param       sectors:     Sector count
+ *
+ * @retval      None
+ */
+void KvFlashSimInit(KvFlashSim_T* sim, uint8_t* memory, uint32_t sectorSize, uint32_t sectors)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->flash.base = memory;
+    sim->flash.sectorSize = sectorSize;
+    sim->flash.sectors = sectors;
+    sim->flash.erase = KvFlashSimErase;
+    sim->flash.program = KvFlashSimProgram;
+    sim->memory = memory;
+    sim->seed = 1;
+    memset(memory, 0xFF, sectorSize * sectors);
+}
+
+/*!
+ * @brief       Arm a power cut.
+ *
+ * @param       sim:    Simulator
+ *
+ * @param       after:  The operation (word program or sector erase) it
+ *                      tears, 1 for the next one
+ *
+ * @param       seed:   Pattern of torn bits, not 0
+ *
+ * @retval      None
+ */
+void KvFlashSimCut(KvFlashSim_T* sim, uint32_t after, uint32_t seed)
+{
+    sim->countdown = after;
+    sim->seed = (seed != 0) ? seed : 1U;
+}
+
+/*!
+ * @brief       Power back on: operations work again, no cut armed.
+ *
+ * @param       sim:  Simulator
+ *
+ * @retval      None
+ */
+void KvFlashSimRestore(KvFlashSim_T* sim)
+{
+    sim->countdown = 0;
+    sim->off = 0;
+}
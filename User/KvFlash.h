@@ -0,0 +1,66 @@
+#ifndef KV_FLASH_H
+#define KV_FLASH_H
+
+#include <stdint.h>
+#include "apm32f4xx_fmc.h"
+
+/*
+ * Flash access for the key-value store (KvStore.h): a run of equal-size
+ * sectors, read through memory and changed only by erasing a sector
+ * (all bits 1) or programming words (bits 1 to 0).
+ *
+ * KvFlashFmcInit() uses internal flash sectors through the FMC. Sectors
+ * 0-3 are 16 KB, 4 is 64 KB and 5-11 are 128 KB; the image must stay
+ * below the sectors given to the store. Erasing stalls every flash fetch
+ * for the erase time (hundreds of ms for 128 KB), interrupts included.
+ *
+ * KvFlashSimInit() emulates the same on RAM, for the host and self-tests.
+ * KvFlashSimCut() arms a power cut: the given operation is left torn (a
+ * word with only some of its bits programmed, a sector partly erased) and
+ * every later one fails until KvFlashSimRestore().
+ */
+
+/* Programming parallelism: FMC_VOLTAGE_4 (external Vpp) programs double
+   words, FMC_VOLTAGE_3 words */
+#ifndef KVFLASH_FMC_VOLTAGE
+#define KVFLASH_FMC_VOLTAGE FMC_VOLTAGE_3
+#endif
+
+typedef struct KvFlash KvFlash_T;
+
+/**
+ * @brief Flash area
+ */
+struct KvFlash
+{
+    const uint8_t*  base;           /*!< First sector, readable */
+    uint32_t        sectorSize;     /*!< Bytes, a multiple of 8 */
+    uint32_t        sectors;
+    uint8_t         (*erase)(KvFlash_T* flash, uint32_t sector);
+    uint8_t         (*program)(KvFlash_T* flash, uint32_t offset, const uint32_t* words, uint32_t count);
+    uint32_t        first;          /*!< FMC: first sector number */
+    uint32_t        erases;         /*!< Sector erases */
+    uint32_t        programs;       /*!< Words programmed */
+};
+
+/**
+ * @brief RAM flash with power cut injection
+ */
+typedef struct
+{
+    KvFlash_T       flash;
+    uint8_t*        memory;
+    uint32_t        countdown;      /*!< Operations left before the cut, 0: none armed */
+    uint8_t         off;            /*!< Power is cut */
+    uint32_t        seed;           /*!< Torn bits */
+} KvFlashSim_T;
+
+/* SUCCESS or ERROR; ERROR when the sectors differ in size or do not exist */
+uint8_t KvFlashFmcInit(KvFlash_T* flash, uint32_t first, uint32_t count);
+
+/* Starts erased */
+void KvFlashSimInit(KvFlashSim_T* sim, uint8_t* memory, uint32_t sectorSize, uint32_t sectors);
+void KvFlashSimCut(KvFlashSim_T* sim, uint32_t after, uint32_t seed);
+void KvFlashSimRestore(KvFlashSim_T* sim);
+
+#endif // KV_FLASH_H
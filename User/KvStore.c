@@ -0,0 +1,904 @@
+#include <stddef.h>
+#include <string.h>
+#include "KvStore.h"
+#include "Crc.h"
+
+#define KVSTORE_NONE        0xFFFFFFFFU
+#define KVSTORE_MAGIC       0x4B565331U     /* "KVS1" */
+
+/* Sector header words */
+#define KVSTORE_H_ERASES    0U      /* Erase count, complement; after each erase */
+#define KVSTORE_H_SEQUENCE  2U      /* Sequence, complement; when opened */
+#define KVSTORE_H_MAGIC     4U      /* Last: the sector is in use */
+#define KVSTORE_HEADER      24U
+
+/* Record types */
+#define KVSTORE_VALUE       0xA5U
+#define KVSTORE_DELETE      0x5AU
+#define KVSTORE_RETIRE      0x3CU   /* Sectors up to a sequence are being erased */
+
+/* Header word: type, key length, value length */
+#define KVSTORE_TYPE(w)         ((w) >> 24)
+#define KVSTORE_KEY_LENGTH(w)   (((w) >> 16) & 0xFFU)
+#define KVSTORE_VALUE_LENGTH(w) ((w) & 0xFFFFU)
+
+/* A retire record always fits after the last value */
+#define KVSTORE_RETIRE_SIZE 24U
+#define KVSTORE_LIMIT(kv)   ((kv)->flash->sectorSize - KVSTORE_RETIRE_SIZE)
+
+/*
+ * Live bytes a power cut can always be recovered from. A rescue moves one
+ * sector's live records into the spare after a header and before a retire
+ * record; of the n - 1 sectors in use, some two neighbours in age order
+ * must then fit one sector, or the rescues go round for ever.
+ */
+#define KVSTORE_CAPACITY(kv) \
+    (((kv)->flash->sectors - 1U) * (KVSTORE_LIMIT(kv) - KVSTORE_HEADER - KVSTORE_RETIRE_SIZE) / 2U)
+
+#define KVSTORE_KEYS        (KVSTORE_INDEX_SIZE * 3U / 4U)
+#define KVSTORE_CHUNK       64U     /* Bytes staged per program */
+
+static uint32_t KvStoreSize(uint32_t keyLength, uint32_t valueLength)
+{
+    return 16U + ((keyLength + valueLength + 7U) & ~7U);
+}
+
+static const uint32_t* KvStoreWords(const KvStore_T* kv, uint32_t location)
+{
+    return (const uint32_t*)(const void*)(kv->flash->base + location);
+}
+
+static uint8_t KvStoreBlank(const KvStore_T* kv, uint32_t location, uint32_t length)
+{
+    const uint32_t* words = KvStoreWords(kv, location);
+    uint32_t i;
+
+    for (i = 0; i < length / 4U; i++)
+    {
+        if (words[i] != 0xFFFFFFFFU)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Size of the record at location, 0 where the sector's log ends */
+static uint32_t KvStoreParse(const KvStore_T* kv, uint32_t location)
+{
+    uint32_t offset = location % kv->flash->sectorSize;
+    uint32_t word, keyLength, valueLength, size;
+    uint8_t known;
+
+    if (offset + 16U > kv->flash->sectorSize)
+    {
+        return 0;
+    }
+    word = KvStoreWords(kv, location)[0];
+    keyLength = KVSTORE_KEY_LENGTH(word);
+    valueLength = KVSTORE_VALUE_LENGTH(word);
+
+    switch (KVSTORE_TYPE(word))
+    {
+        case KVSTORE_VALUE:
+            known = (keyLength != 0) && (keyLength <= KVSTORE_KEY_MAX) && (valueLength <= KVSTORE_VALUE_MAX);
+            break;
+
+        case KVSTORE_DELETE:
+            known = (keyLength != 0) && (keyLength <= KVSTORE_KEY_MAX) && (valueLength == 0);
+            break;
+
+        case KVSTORE_RETIRE:
+            known = (keyLength == 0) && (valueLength == 4U);
+            break;
+
+        default:
+            known = 0;
+            break;
+    }
+    size = KvStoreSize(keyLength, valueLength);
+
+    return (known && (offset + size <= kv->flash->sectorSize)) ? size : 0;
+}
+
+/* Committed and intact */
+static uint8_t KvStoreValid(const KvStore_T* kv, uint32_t location, uint32_t size)
+{
+    const uint32_t* words = KvStoreWords(kv, location);
+    uint32_t crc;
+
+    if ((words[size / 4U - 2U] != 0) || (words[size / 4U - 1U] != 0))
+    {
+        return 0;
+    }
+    crc = CrcStart(&crcCrc32);
+    crc = CrcUpdate(&crcCrc32, crc, words, 4);
+    crc = CrcUpdate(&crcCrc32, crc, words + 2,
+                    KVSTORE_KEY_LENGTH(words[0]) + KVSTORE_VALUE_LENGTH(words[0]));
+
+    return CrcFinish(&crcCrc32, crc) == words[1];
+}
+
+/* Index *******************************************************************/
+
+static uint32_t KvStoreHash(const void* key, uint32_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)key;
+    uint32_t hash = 2166136261U;
+
+    /* FNV-1a */
+    while (length-- != 0)
+    {
+        hash ^= *bytes++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/* Slot holding key, or the empty slot that ends its probe sequence */
+static uint32_t KvStoreSlot(const KvStore_T* kv, const void* key, uint32_t length, uint32_t hash)
+{
+    uint32_t slot = hash & (KVSTORE_INDEX_SIZE - 1U);
+    const KvStoreEntry_T* entry;
+    const uint32_t* words;
+
+    for (;;)
+    {
+        entry = &kv->index[slot];
+        if (entry->location == 0)
+        {
+            return slot;
+        }
+        if (entry->hash == hash)
+        {
+            words = KvStoreWords(kv, entry->location);
+            if ((KVSTORE_KEY_LENGTH(words[0]) == length) && (memcmp(words + 2, key, length) == 0))
+            {
+                return slot;
+            }
+        }
+        slot = (slot + 1U) & (KVSTORE_INDEX_SIZE - 1U);
+    }
+}
+
+static uint8_t KvStorePut(KvStore_T* kv, uint32_t slot, uint32_t hash, uint32_t location)
+{
+    if (kv->index[slot].location == 0)
+    {
+        if (kv->keys >= KVSTORE_KEYS)
+        {
+            return ERROR;
+        }
+        kv->keys++;
+    }
+    else
+    {
+        kv->live -= KvStoreParse(kv, kv->index[slot].location);
+    }
+    kv->live += KvStoreParse(kv, location);
+    kv->index[slot].hash = hash;
+    kv->index[slot].location = location;
+
+    return SUCCESS;
+}
+
+/* Backward-shift deletion: later entries of the probe run close the gap */
+static void KvStoreRemove(KvStore_T* kv, uint32_t slot)
+{
+    uint32_t mask = KVSTORE_INDEX_SIZE - 1U;
+    uint32_t next = slot;
+    uint32_t home;
+
+    kv->live -= KvStoreParse(kv, kv->index[slot].location);
+    for (;;)
+    {
+        next = (next + 1U) & mask;
+        if (kv->index[next].location == 0)
+        {
+            break;
+        }
+        home = kv->index[next].hash & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            kv->index[slot] = kv->index[next];
+            slot = next;
+        }
+    }
+    kv->index[slot].location = 0;
+    kv->keys--;
+}
+
+/* Slot of the record's key when the index points at the record */
+static uint32_t KvStoreLive(const KvStore_T* kv, uint32_t location)
+{
+    const uint32_t* words = KvStoreWords(kv, location);
+    uint32_t length = KVSTORE_KEY_LENGTH(words[0]);
+    uint32_t slot;
+
+    if (KVSTORE_TYPE(words[0]) != KVSTORE_VALUE)
+    {
+        return KVSTORE_NONE;
+    }
+    slot = KvStoreSlot(kv, words + 2, length, KvStoreHash(words + 2, length));
+
+    return (kv->index[slot].location == location) ? slot : KVSTORE_NONE;
+}
+
+/* A record is superseded: compaction no longer has to copy it */
+static void KvStoreDrop(KvStore_T* kv, uint32_t location)
+{
+    if (kv->compacting && (location / kv->flash->sectorSize == kv->tail) &&
+        (location % kv->flash->sectorSize >= kv->tailOffset))
+    {
+        kv->tailLive -= KvStoreParse(kv, location);
+    }
+}
+
+/* Sectors *****************************************************************/
+
+static uint8_t KvStoreProgram(KvStore_T* kv, uint32_t location, const uint32_t* words, uint32_t count)
+{
+    return kv->flash->program(kv->flash, location, words, count);
+}
+
+static uint8_t KvStoreErase(KvStore_T* kv, uint32_t sector)
+{
+    uint32_t count[2];
+
+    count[0] = kv->erases[sector] + 1U;
+    count[1] = ~count[0];
+    if ((kv->flash->erase(kv->flash, sector) != SUCCESS) ||
+        (KvStoreProgram(kv, sector * kv->flash->sectorSize + KVSTORE_H_ERASES * 4U, count, 2) != SUCCESS))
+    {
+        return ERROR;
+    }
+    kv->erases[sector] = count[0];
+    kv->sequence[sector] = 0;
+    kv->erased++;
+
+    return SUCCESS;
+}
+
+/* Erased sector with the fewest erases */
+static uint32_t KvStoreSpare(const KvStore_T* kv)
+{
+    uint32_t best = KVSTORE_NONE;
+    uint32_t i;
+
+    for (i = 0; i < kv->flash->sectors; i++)
+    {
+        if ((kv->sequence[i] == 0) && ((best == KVSTORE_NONE) || (kv->erases[i] < kv->erases[best])))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/* Make an erased sector the head; a compaction target gets its magic once complete */
+static uint8_t KvStoreOpen(KvStore_T* kv, uint32_t sector, uint8_t target)
+{
+    uint32_t words[3];
+
+    words[0] = kv->next;
+    words[1] = ~kv->next;
+    words[2] = KVSTORE_MAGIC;
+    kv->sequence[sector] = kv->next++;
+    kv->erased--;
+    kv->head = sector;
+    kv->offset = KVSTORE_HEADER;
+
+    return KvStoreProgram(kv, sector * kv->flash->sectorSize + KVSTORE_H_SEQUENCE * 4U, words, target ? 2U : 3U);
+}
+
+/* Program a record at the end of the head: header, key and value, commit */
+static uint8_t KvStoreAppend(KvStore_T* kv, uint32_t type, const void* key, uint32_t keyLength,
+                             const void* value, uint32_t valueLength, uint32_t* location)
+{
+    uint32_t words[KVSTORE_CHUNK / 4U];
+    uint8_t* bytes = (uint8_t*)words;
+    uint32_t size = KvStoreSize(keyLength, valueLength);
+    uint32_t at = kv->head * kv->flash->sectorSize + kv->offset;
+    uint32_t done, count, i, position, crc;
+    uint8_t status;
+
+    words[0] = (type << 24) | (keyLength << 16) | valueLength;
+    crc = CrcStart(&crcCrc32);
+    crc = CrcUpdate(&crcCrc32, crc, words, 4);
+    crc = CrcUpdate(&crcCrc32, crc, key, keyLength);
+    crc = CrcUpdate(&crcCrc32, crc, value, valueLength);
+    words[1] = CrcFinish(&crcCrc32, crc);
+
+    /* Taken even if programming fails: the words may be dirty */
+    kv->offset += size;
+    *location = at;
+
+    status = KvStoreProgram(kv, at, words, 2);
+    for (done = 0; (status == SUCCESS) && (done < size - 16U); done += count)
+    {
+        count = size - 16U - done;
+        if (count > KVSTORE_CHUNK)
+        {
+            count = KVSTORE_CHUNK;
+        }
+        for (i = 0; i < count; i++)
+        {
+            position = done + i;
+            if (position < keyLength)
+            {
+                bytes[i] = ((const uint8_t*)key)[position];
+            }
+            else if (position < keyLength + valueLength)
+            {
+                bytes[i] = ((const uint8_t*)value)[position - keyLength];
+            }
+            else
+            {
+                bytes[i] = 0xFFU;
+            }
+        }
+        status = KvStoreProgram(kv, at + 8U + done, words, count / 4U);
+    }
+    if (status == SUCCESS)
+    {
+        words[0] = 0;
+        words[1] = 0;
+        status = KvStoreProgram(kv, at + size - 8U, words, 2);
+    }
+
+    return status;
+}
+
+/* Compaction **************************************************************/
+
+/* Empty the oldest sector other than the head */
+static void KvStoreStartCompaction(KvStore_T* kv)
+{
+    uint32_t tail = KVSTORE_NONE;
+    uint32_t base, offset, size, i;
+
+    for (i = 0; i < kv->flash->sectors; i++)
+    {
+        if ((kv->sequence[i] != 0) && (i != kv->head) &&
+            ((tail == KVSTORE_NONE) || (kv->sequence[i] < kv->sequence[tail])))
+        {
+            tail = i;
+        }
+    }
+    if (tail == KVSTORE_NONE)
+    {
+        return;
+    }
+
+    kv->compacting = 1;
+    kv->tail = tail;
+    kv->tailOffset = KVSTORE_HEADER;
+    kv->tailLive = 0;
+    base = tail * kv->flash->sectorSize;
+    for (offset = KVSTORE_HEADER; (size = KvStoreParse(kv, base + offset)) != 0; offset += size)
+    {
+        if (KvStoreLive(kv, base + offset) != KVSTORE_NONE)
+        {
+            kv->tailLive += size;
+        }
+    }
+}
+
+/* Note that the oldest sector is going: a cut erase cannot bring it back */
+static uint8_t KvStoreRetire(KvStore_T* kv)
+{
+    uint32_t sequence = kv->sequence[kv->tail];
+    uint32_t location;
+
+    return KvStoreAppend(kv, KVSTORE_RETIRE, "", 0, &sequence, 4, &location);
+}
+
+static uint8_t KvStoreEraseTail(KvStore_T* kv)
+{
+    if (KvStoreErase(kv, kv->tail) != SUCCESS)
+    {
+        return ERROR;
+    }
+    kv->compacting = 0;
+    kv->compactions++;
+
+    if (kv->erased <= 1U)
+    {
+        KvStoreStartCompaction(kv);
+    }
+
+    return SUCCESS;
+}
+
+/* Next record of the oldest sector: copy it to the head if live; past the last, retire */
+static uint8_t KvStoreCompactStep(KvStore_T* kv)
+{
+    uint32_t from = kv->tail * kv->flash->sectorSize + kv->tailOffset;
+    uint32_t size = KvStoreParse(kv, from);
+    uint32_t slot, location;
+
+    if (size == 0)
+    {
+        return (KvStoreRetire(kv) == SUCCESS) ? KvStoreEraseTail(kv) : ERROR;
+    }
+
+    slot = KvStoreLive(kv, from);
+    if (slot != KVSTORE_NONE)
+    {
+        if (kv->offset + size > KVSTORE_LIMIT(kv))
+        {
+            return ERROR;
+        }
+        location = kv->head * kv->flash->sectorSize + kv->offset;
+        kv->offset += size;
+        if (KvStoreProgram(kv, location, KvStoreWords(kv, from), size / 4U) != SUCCESS)
+        {
+            return ERROR;
+        }
+        kv->index[slot].location = location;
+        kv->tailLive -= size;
+        kv->copied++;
+    }
+    kv->tailOffset += size;
+
+    return SUCCESS;
+}
+
+static uint8_t KvStoreFinish(KvStore_T* kv)
+{
+    uint32_t tail = kv->tail;
+
+    while (kv->compacting && (kv->tail == tail))
+    {
+        if (KvStoreCompactStep(kv) != SUCCESS)
+        {
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/*
+ * Torn records left the head too little room for the oldest sector's live
+ * records: copy them into the spare, followed by the retire record, and
+ * only then give it its magic. Cut before that, it is erased at boot and
+ * the oldest sector still holds everything.
+ */
+static uint8_t KvStoreRescue(KvStore_T* kv)
+{
+    uint32_t target = KvStoreSpare(kv);
+    uint32_t magic = KVSTORE_MAGIC;
+
+    if ((target == KVSTORE_NONE) || (KvStoreOpen(kv, target, 1) != SUCCESS))
+    {
+        return ERROR;
+    }
+    while (KvStoreParse(kv, kv->tail * kv->flash->sectorSize + kv->tailOffset) != 0)
+    {
+        if (KvStoreCompactStep(kv) != SUCCESS)
+        {
+            return ERROR;
+        }
+    }
+    if ((KvStoreRetire(kv) != SUCCESS) ||
+        (KvStoreProgram(kv, target * kv->flash->sectorSize + KVSTORE_H_MAGIC * 4U, &magic, 1) != SUCCESS))
+    {
+        return ERROR;
+    }
+
+    return KvStoreEraseTail(kv);
+}
+
+/* Room in the head for size bytes beyond what compaction still has to copy */
+static uint8_t KvStoreMakeRoom(KvStore_T* kv, uint32_t size)
+{
+    uint32_t limit = KVSTORE_LIMIT(kv);
+    uint32_t room, tries;
+    uint8_t status;
+
+    for (tries = 0; tries < 2U * kv->flash->sectors + 2U; tries++)
+    {
+        room = (kv->offset <= limit) ? limit - kv->offset : 0;
+        if ((kv->offset <= limit) && (size + (kv->compacting ? kv->tailLive : 0) <= room))
+        {
+            return SUCCESS;
+        }
+
+        if (kv->compacting)
+        {
+            status = ((kv->offset <= limit) && (kv->tailLive <= room)) ? KvStoreFinish(kv) : KvStoreRescue(kv);
+        }
+        else if (kv->erased >= 2U)
+        {
+            /* One erased sector stays spare */
+            status = KvStoreOpen(kv, KvStoreSpare(kv), 0);
+            if (kv->erased <= 1U)
+            {
+                KvStoreStartCompaction(kv);
+            }
+        }
+        else
+        {
+            status = ERROR;
+        }
+
+        if (status != SUCCESS)
+        {
+            return ERROR;
+        }
+    }
+
+    return ERROR;
+}
+
+/* Mount *******************************************************************/
+
+/* Replay a sector's records into the index; returns where its log ends */
+static uint32_t KvStoreReplay(KvStore_T* kv, uint32_t sector, uint8_t* status)
+{
+    uint32_t base = sector * kv->flash->sectorSize;
+    uint32_t offset, size, length, hash, slot;
+    const uint32_t* words;
+
+    for (offset = KVSTORE_HEADER; (size = KvStoreParse(kv, base + offset)) != 0; offset += size)
+    {
+        words = KvStoreWords(kv, base + offset);
+        if ((KVSTORE_TYPE(words[0]) == KVSTORE_RETIRE) || !KvStoreValid(kv, base + offset, size))
+        {
+            continue;
+        }
+
+        length = KVSTORE_KEY_LENGTH(words[0]);
+        hash = KvStoreHash(words + 2, length);
+        slot = KvStoreSlot(kv, words + 2, length, hash);
+        if (KVSTORE_TYPE(words[0]) == KVSTORE_VALUE)
+        {
+            if (KvStorePut(kv, slot, hash, base + offset) != SUCCESS)
+            {
+                *status = ERROR;
+            }
+        }
+        else if (kv->index[slot].location != 0)
+        {
+            KvStoreRemove(kv, slot);
+        }
+    }
+
+    return offset;
+}
+
+/*!
+ * @brief       Mount a store: format blank flash, clean up after power cuts
+ *              and rebuild the index.
+ *
+ * @param       kv:     Store
+ *
+ * @param       flash:  Area, 3 to KVSTORE_SECTORS_MAX sectors
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        May erase sectors: a sector left half written or half erased
+ *              by a power cut, and one of the oldest when compaction has to
+ *              finish before anything fits.
+ */
+uint8_t KvStoreInit(KvStore_T* kv, KvFlash_T* flash)
+{
+    uint32_t size = flash->sectorSize;
+    uint32_t retired = 0;
+    uint32_t last = 0;
+    uint32_t most = 0;
+    uint32_t i, sector, offset, length;
+    const uint32_t* words;
+    uint8_t status = SUCCESS;
+
+    if ((flash->sectors < 3U) || (flash->sectors > KVSTORE_SECTORS_MAX) || ((size & 7U) != 0) || (size < 256U))
+    {
+        return ERROR;
+    }
+
+    memset(kv, 0, sizeof(*kv));
+    kv->flash = flash;
+    kv->head = KVSTORE_NONE;
+    kv->offset = size;
+
+    /* Erase counts a power cut lost: as worn as the most worn */
+    for (i = 0; i < flash->sectors; i++)
+    {
+        words = KvStoreWords(kv, i * size);
+        if ((words[1] == ~words[0]) && (words[0] > most))
+        {
+            most = words[0];
+        }
+    }
+
+    /* In use, erased, or torn by a power cut */
+    for (i = 0; i < flash->sectors; i++)
+    {
+        words = KvStoreWords(kv, i * size);
+        kv->erases[i] = (words[1] == ~words[0]) ? words[0] : most;
+        if ((words[3] == ~words[2]) && (words[2] != 0) && (words[2] != 0xFFFFFFFFU) &&
+            (words[KVSTORE_H_MAGIC] == KVSTORE_MAGIC))
+        {
+            kv->sequence[i] = words[2];
+        }
+        else if (!KvStoreBlank(kv, i * size + KVSTORE_H_SEQUENCE * 4U, size - KVSTORE_H_SEQUENCE * 4U) &&
+                 (KvStoreErase(kv, i) != SUCCESS))
+        {
+            return ERROR;
+        }
+    }
+
+    /* Sectors whose erase was cut short after their retire record */
+    for (i = 0; i < flash->sectors; i++)
+    {
+        for (offset = KVSTORE_HEADER; (kv->sequence[i] != 0) && ((length = KvStoreParse(kv, i * size + offset)) != 0);
+             offset += length)
+        {
+            words = KvStoreWords(kv, i * size + offset);
+            if ((KVSTORE_TYPE(words[0]) == KVSTORE_RETIRE) && KvStoreValid(kv, i * size + offset, length) &&
+                (words[2] > retired))
+            {
+                retired = words[2];
+            }
+        }
+    }
+    kv->next = retired + 1U;
+    for (i = 0; i < flash->sectors; i++)
+    {
+        if ((kv->sequence[i] != 0) && (kv->sequence[i] <= retired) && (KvStoreErase(kv, i) != SUCCESS))
+        {
+            return ERROR;
+        }
+        if (kv->sequence[i] >= kv->next)
+        {
+            kv->next = kv->sequence[i] + 1U;
+        }
+    }
+
+    /* Oldest first, so later records win; the newest sector is the head */
+    for (;;)
+    {
+        sector = KVSTORE_NONE;
+        for (i = 0; i < flash->sectors; i++)
+        {
+            if ((kv->sequence[i] > last) && ((sector == KVSTORE_NONE) || (kv->sequence[i] < kv->sequence[sector])))
+            {
+                sector = i;
+            }
+        }
+        if (sector == KVSTORE_NONE)
+        {
+            break;
+        }
+        last = kv->sequence[sector];
+        kv->head = sector;
+        kv->offset = KvStoreReplay(kv, sector, &status);
+    }
+    if (status != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Anything after the last record closes the head */
+    if ((kv->head != KVSTORE_NONE) && !KvStoreBlank(kv, kv->head * size + kv->offset, size - kv->offset))
+    {
+        kv->offset = size;
+    }
+
+    kv->erased = 0;
+    for (i = 0; i < flash->sectors; i++)
+    {
+        kv->erased += (kv->sequence[i] == 0) ? 1U : 0;
+    }
+    if (kv->erased <= 1U)
+    {
+        KvStoreStartCompaction(kv);
+    }
+
+    return KvStoreMakeRoom(kv, 0);
+}
+
+/* Access ******************************************************************/
+
+/* Key length, KVSTORE_KEY_MAX + 1 when too long */
+static uint32_t KvStoreKeyLength(const char* key)
+{
+    uint32_t length = 0;
+
+    while ((length <= KVSTORE_KEY_MAX) && (key[length] != '\0'))
+    {
+        length++;
+    }
+
+    return length;
+}
+
+/*!
+ * @brief       Store a value.
+ *
+ * @param       kv:      Store
+ *
+ * @param       key:     1 to KVSTORE_KEY_MAX characters
+ *
+ * @param       value:   Bytes to store
+ *
+ * @param       length:  0 to KVSTORE_VALUE_MAX
+ *
+ * @retval      SUCCESS or ERROR (bad arguments, index or flash full, flash error)
+ *
+ * @note        May finish a compaction first, erasing a sector. The flash is
+ *              full once live records would take more than (sectors - 1) / 2
+ *              sectors, less headers; a value no longer than the one it
+ *              replaces is still taken.
+ */
+uint8_t KvStoreSet(KvStore_T* kv, const char* key, const void* value, uint32_t length)
+{
+    uint32_t keyLength = KvStoreKeyLength(key);
+    uint32_t size = KvStoreSize(keyLength, length);
+    uint32_t old = 0;
+    uint32_t hash, slot, location;
+    const uint32_t* words;
+
+    if ((keyLength == 0) || (keyLength > KVSTORE_KEY_MAX) || (length > KVSTORE_VALUE_MAX) ||
+        ((value == NULL) && (length != 0)) || (size > KVSTORE_LIMIT(kv) - KVSTORE_HEADER))
+    {
+        return ERROR;
+    }
+
+    hash = KvStoreHash(key, keyLength);
+    slot = KvStoreSlot(kv, key, keyLength, hash);
+    if (kv->index[slot].location != 0)
+    {
+        /* Already stored: spare the flash */
+        words = KvStoreWords(kv, kv->index[slot].location);
+        if ((KVSTORE_VALUE_LENGTH(words[0]) == length) &&
+            ((length == 0) || (memcmp((const uint8_t*)(words + 2) + keyLength, value, length) == 0)))
+        {
+            return SUCCESS;
+        }
+        old = KvStoreParse(kv, kv->index[slot].location);
+    }
+    else if (kv->keys >= KVSTORE_KEYS)
+    {
+        return ERROR;
+    }
+    if ((size > old) && (kv->live - old + size > KVSTORE_CAPACITY(kv)))
+    {
+        return ERROR;
+    }
+
+    if (KvStoreMakeRoom(kv, size) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Compaction may have moved the old record */
+    slot = KvStoreSlot(kv, key, keyLength, hash);
+    if (KvStoreAppend(kv, KVSTORE_VALUE, key, keyLength, value, length, &location) != SUCCESS)
+    {
+        return ERROR;
+    }
+    if (kv->index[slot].location != 0)
+    {
+        KvStoreDrop(kv, kv->index[slot].location);
+    }
+
+    return KvStorePut(kv, slot, hash, location);
+}
+
+/*!
+ * @brief       Read a value.
+ *
+ * @param       kv:      Store
+ *
+ * @param       key:     Key
+ *
+ * @param       value:   Buffer
+ *
+ * @param       size:    Its size
+ *
+ * @param       length:  Value length when the key exists; may be NULL
+ *
+ * @retval      SUCCESS, or ERROR when the key is missing or the buffer short
+ */
+uint8_t KvStoreGet(KvStore_T* kv, const char* key, void* value, uint32_t size, uint32_t* length)
+{
+    uint32_t keyLength = KvStoreKeyLength(key);
+    uint32_t slot, valueLength;
+    const uint32_t* words;
+
+    if ((keyLength == 0) || (keyLength > KVSTORE_KEY_MAX))
+    {
+        return ERROR;
+    }
+    slot = KvStoreSlot(kv, key, keyLength, KvStoreHash(key, keyLength));
+    if (kv->index[slot].location == 0)
+    {
+        return ERROR;
+    }
+
+    words = KvStoreWords(kv, kv->index[slot].location);
+    valueLength = KVSTORE_VALUE_LENGTH(words[0]);
+    if (length != NULL)
+    {
+        *length = valueLength;
+    }
+    if (valueLength > size)
+    {
+        return ERROR;
+    }
+    if (valueLength != 0)
+    {
+        memcpy(value, (const uint8_t*)(words + 2) + keyLength, valueLength);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Remove a key.
+ *
+ * @param       kv:   Store
+ *
+ * @param       key:  Key
+ *
+ * @retval      SUCCESS or ERROR (flash full, flash error)
+ */
+uint8_t KvStoreDelete(KvStore_T* kv, const char* key)
+{
+    uint32_t keyLength = KvStoreKeyLength(key);
+    uint32_t hash, slot, location;
+
+    if ((keyLength == 0) || (keyLength > KVSTORE_KEY_MAX))
+    {
+        return ERROR;
+    }
+    hash = KvStoreHash(key, keyLength);
+    if (kv->index[KvStoreSlot(kv, key, keyLength, hash)].location == 0)
+    {
+        return SUCCESS;
+    }
+
+    if ((KvStoreMakeRoom(kv, KvStoreSize(keyLength, 0)) != SUCCESS) ||
+        (KvStoreAppend(kv, KVSTORE_DELETE, key, keyLength, NULL, 0, &location) != SUCCESS))
+    {
+        return ERROR;
+    }
+    slot = KvStoreSlot(kv, key, keyLength, hash);
+    KvStoreDrop(kv, kv->index[slot].location);
+    KvStoreRemove(kv, slot);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Background compaction, from the main loop.
+ *
+ * @param       kv:  Store
+ *
+ * @retval      1 while a compaction is pending, else 0
+ *
+ * @note        Copies up to KVSTORE_POLL_RECORDS records, or erases the
+ *              emptied sector.
+ */
+uint8_t KvStorePoll(KvStore_T* kv)
+{
+    uint32_t i;
+
+    uint32_t compactions = kv->compactions;
+
+    /* An erase ends the call */
+    for (i = 0; kv->compacting && (i < KVSTORE_POLL_RECORDS) && (kv->compactions == compactions); i++)
+    {
+        if (KvStoreCompactStep(kv) != SUCCESS)
+        {
+            break;
+        }
+    }
+
+    return kv->compacting;
+}
@@ -0,0 +1,112 @@
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include <stdint.h>
+#include "KvFlash.h"
+
+/*
+ * Log-structured key-value store on flash sectors (KvFlash.h).
+ *
+ * Every KvStoreSet() or KvStoreDelete() appends one record to the head
+ * sector: a header word (type, key and value length), a CRC-32 over header,
+ * key and value, the key and value padded to double words, and a commit
+ * double word programmed last. A record counts only once its commit
+ * marker reads 0 and its CRC matches, so a power cut mid-write leaves the
+ * previous value in place. Setting the value a key already has writes
+ * nothing.
+ *
+ * Sectors form a ring ordered by a sequence number in their header. A full
+ * head moves on to the erased sector with the fewest erases, one erased
+ * sector always staying spare. Once only the spare is left, the oldest
+ * sector is compacted: KvStorePoll() copies its live records to the head a
+ * few per call, then appends a retire record naming the sector and erases
+ * it. A write that would eat into the room the copies need finishes the
+ * compaction first. Copies are ordinary records, newer than the originals,
+ * and deleted keys are simply not copied; the retire record makes a sector
+ * whose erase was cut short count as garbage at boot, so nothing deleted
+ * comes back from it. When torn records have used up the head's room, the
+ * spare takes the copies instead and only counts once all of them are in.
+ *
+ * A RAM hash index maps each key to its latest record, so lookups are O(1)
+ * and read the value straight from flash. KvStoreInit() rebuilds it by
+ * scanning the sectors oldest first. Torn records are skipped; a head
+ * whose end cannot be made out is closed and the next write opens a new
+ * sector.
+ *
+ * Keys are C strings of 1 to KVSTORE_KEY_MAX characters; values 0 to
+ * KVSTORE_VALUE_MAX bytes. KvStoreSet() keeps live data to (sectors - 1) / 2
+ * sectors, so that however power cuts tear the head, some compaction always
+ * fits. After a flash error, mount again. The store is not reentrant.
+ */
+
+/* Sectors in the area, at least 3 */
+#ifndef KVSTORE_SECTORS_MAX
+#define KVSTORE_SECTORS_MAX 4U
+#endif
+
+/* Index slots, a power of two; keys up to 3/4 of it */
+#ifndef KVSTORE_INDEX_SIZE
+#define KVSTORE_INDEX_SIZE 128U
+#endif
+
+#ifndef KVSTORE_KEY_MAX
+#define KVSTORE_KEY_MAX 32U
+#endif
+
+#ifndef KVSTORE_VALUE_MAX
+#define KVSTORE_VALUE_MAX 1024U
+#endif
+
+/* Oldest-sector records examined per KvStorePoll() */
+#ifndef KVSTORE_POLL_RECORDS
+#define KVSTORE_POLL_RECORDS 8U
+#endif
+
+/**
+ * @brief Index slot
+ */
+typedef struct
+{
+    uint32_t    hash;           /*!< FNV-1a of the key */
+    uint32_t    location;       /*!< Record offset in the area, 0: empty */
+} KvStoreEntry_T;
+
+/**
+ * @brief Store state
+ */
+typedef struct
+{
+    KvFlash_T*      flash;
+    uint32_t        sequence[KVSTORE_SECTORS_MAX];  /*!< Per sector, 0: erased */
+    uint32_t        erases[KVSTORE_SECTORS_MAX];    /*!< Per sector, from its header */
+    uint32_t        erased;         /*!< Erased sectors */
+    uint32_t        next;           /*!< Sequence of the next sector opened */
+    uint32_t        head;           /*!< Sector being appended to */
+    uint32_t        offset;         /*!< Next record in the head, sectorSize: closed */
+    uint8_t         compacting;     /*!< Oldest sector being emptied */
+    uint32_t        tail;           /*!< Oldest sector */
+    uint32_t        tailOffset;     /*!< Next record to look at in it */
+    uint32_t        tailLive;       /*!< Bytes of live records still to copy */
+    uint32_t        keys;
+    uint32_t        live;           /*!< Bytes of the records the index points at */
+    uint32_t        compactions;
+    uint32_t        copied;         /*!< Records moved by compaction */
+    KvStoreEntry_T  index[KVSTORE_INDEX_SIZE];
+} KvStore_T;
+
+/* Mounts the area: formats blank flash, recovers from power cuts */
+uint8_t KvStoreInit(KvStore_T* kv, KvFlash_T* flash);
+
+uint8_t KvStoreSet(KvStore_T* kv, const char* key, const void* value, uint32_t length);
+
+/* ERROR when the key is missing or the value is longer than size; length
+   (may be NULL) gets the value length whenever the key exists */
+uint8_t KvStoreGet(KvStore_T* kv, const char* key, void* value, uint32_t size, uint32_t* length);
+
+/* SUCCESS also when the key did not exist */
+uint8_t KvStoreDelete(KvStore_T* kv, const char* key);
+
+/* From the main loop: one compaction step; 1 while compaction is pending */
+uint8_t KvStorePoll(KvStore_T* kv);
+
+#endif // KV_STORE_H
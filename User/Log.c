@@ -0,0 +1,32 @@
+#include <string.h>
+#include "Debug.h"
+#include "Log.h"
+
+#ifdef DEBUG
+
+/*!
+ * @brief       Emit one binary log frame to the debug transport.
+ *
+ * @param       level:  Log level (LOG_LEVEL_xxx)
+ *
+ * @param       words:  Format string id followed by nargs argument words
+ *
+ * @param       nargs:  Number of argument words (at most LOG_MAX_ARGS)
+ *
+ * @retval      None
+ *
+ * @note        Use through the LOG_xxx macros.
+ */
+void LogWrite(uint32_t level, const uint32_t* words, uint32_t nargs)
+{
+    uint8_t frame[2 + 4 * (1 + LOG_MAX_ARGS)];
+    uint32_t len = 4 * (1 + nargs);
+
+    frame[0] = LOG_FRAME_SYNC;
+    frame[1] = (uint8_t)((level << 4) | nargs);
+    memcpy(&frame[2], words, len);
+
+    DebugWrite((const char*)frame, (int)(2 + len));
+}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+/*
+ * Deferred binary logging.
+ *
+ * A LOG call emits a frame holding the address of its format string and the
+ * raw 32-bit argument words; no formatting happens on the target. Format
+ * strings are placed in the .logstr section, which the linker script keeps
+ * in the ELF as a non-loaded (INFO) section, so they cost no flash. The host
+ * decoder (Tools/logdecode) reads them back from the ELF.
+ *
+ * Frame layout (little-endian):
+ *   LOG_FRAME_SYNC, (level << 4) | nargs, id[4], arg0[4] ... argN-1[4]
+ *
+ * Arguments are converted with (uint32_t); use LOG_FLOAT() for float values
+ * and pass strings only if they live in flash (%s is resolved from the ELF).
+ *
+ * A frame is one DebugWrite(), and DebugWrite() has a single producer. A LOG
+ * from an interrupt handler that preempts a thread-level DebugWrite() (PRINT
+ * or LOG) in progress interleaves with it: when it lands between two ring
+ * writes of a long thread write its frame appears whole in the middle of the
+ * thread's bytes, and when it lands inside a ring write the frame or the
+ * thread's bytes are overwritten. The decoder resynchronizes on the next
+ * valid frame, so only the bytes involved are lost; mask interrupts around
+ * thread-level output that must not be split.
+ */
+
+#define LOG_LEVEL_ERR   1
+#define LOG_LEVEL_WRN   2
+#define LOG_LEVEL_INF   3
+#define LOG_LEVEL_DBG   4
+
+/* Calls above this level compile to nothing */
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INF
+#endif
+
+#define LOG_FRAME_SYNC  0xA5U
+#define LOG_MAX_ARGS    8
+
+void LogWrite(uint32_t level, const uint32_t* words, uint32_t nargs);
+
+/* Bit pattern of a float argument */
+static inline uint32_t LogFloat(float value)
+{
+    union { float f; uint32_t u; } conv;
+
+    conv.f = value;
+    return conv.u;
+}
+#define LOG_FLOAT(x) LogFloat((float)(x))
+
+/* Argument counting and per-argument conversion (up to LOG_MAX_ARGS) */
+#define LOG_NARGS(...)  LOG_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+
+#define LOG_W0()
+#define LOG_W1(a)                       , (uint32_t)(a)
+#define LOG_W2(a, b)                    LOG_W1(a) LOG_W1(b)
+#define LOG_W3(a, b, c)                 LOG_W2(a, b) LOG_W1(c)
+#define LOG_W4(a, b, c, d)              LOG_W3(a, b, c) LOG_W1(d)
+#define LOG_W5(a, b, c, d, e)           LOG_W4(a, b, c, d) LOG_W1(e)
+#define LOG_W6(a, b, c, d, e, f)        LOG_W5(a, b, c, d, e) LOG_W1(f)
+#define LOG_W7(a, b, c, d, e, f, g)     LOG_W6(a, b, c, d, e, f) LOG_W1(g)
+#define LOG_W8(a, b, c, d, e, f, g, h)  LOG_W7(a, b, c, d, e, f, g) LOG_W1(h)
+#define LOG_CAT(a, b)   LOG_CAT_(a, b)
+#define LOG_CAT_(a, b)  a##b
+
+#define LOG_STR_ATTR    __attribute__((section(".logstr"), used))
+
+#define LOG_AT(level, fmt, ...)                                                     \
+    do                                                                              \
+    {                                                                               \
+        static const char LOG_STR_ATTR logFmt[] = fmt;                              \
+        const uint32_t logWords[] =                                                 \
+            { (uint32_t)logFmt LOG_CAT(LOG_W, LOG_NARGS(__VA_ARGS__))(__VA_ARGS__) }; \
+        LogWrite((level), logWords, LOG_NARGS(__VA_ARGS__));                        \
+    } while (0)
+
+#if defined(DEBUG) && (LOG_LEVEL >= LOG_LEVEL_ERR)
+#define LOG_ERR(fmt, ...) LOG_AT(LOG_LEVEL_ERR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERR(fmt, ...) do { } while (0)
+#endif
+
+#if defined(DEBUG) && (LOG_LEVEL >= LOG_LEVEL_WRN)
+#define LOG_WRN(fmt, ...) LOG_AT(LOG_LEVEL_WRN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WRN(fmt, ...) do { } while (0)
+#endif
+
+#if defined(DEBUG) && (LOG_LEVEL >= LOG_LEVEL_INF)
+#define LOG_INF(fmt, ...) LOG_AT(LOG_LEVEL_INF, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INF(fmt, ...) do { } while (0)
+#endif
+
+#if defined(DEBUG) && (LOG_LEVEL >= LOG_LEVEL_DBG)
+#define LOG_DBG(fmt, ...) LOG_AT(LOG_LEVEL_DBG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DBG(fmt, ...) do { } while (0)
+#endif
+
+#define LOG(fmt, ...) LOG_INF(fmt, ##__VA_ARGS__)
+
+#endif // LOG_H
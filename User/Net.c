@@ -0,0 +1,95 @@
+#include <string.h>
+#include "Net.h"
+
+static inline uint32_t NetLoad32(const uint8_t* p)
+{
+    uint32_t word;
+
+    /* Single unaligned LDR on Cortex-M4 */
+    memcpy(&word, p, sizeof(word));
+
+    return word;
+}
+
+/*!
+ * @brief       Add data to an Internet checksum.
+ *
+ * @param       sum:   Partial sum from a previous call (0 to start)
+ *
+ * @param       data:  Bytes, any alignment
+ *
+ * @param       len:   Number of bytes; an odd length must be the last piece
+ *
+ * @retval      Partial sum, folded to 16 bits
+ *
+ * @note        Adds 32-bit words into a 64-bit accumulator, 16 bytes per
+ *              loop iteration, and folds the carries once at the end.
+ *              Byte-order independent (RFC 1071), little-endian memory.
+ */
+uint32_t NetChecksumAdd(uint32_t sum, const void* data, uint32_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t acc = sum;
+
+    while (len >= 16U)
+    {
+        acc += NetLoad32(p);
+        acc += NetLoad32(p + 4);
+        acc += NetLoad32(p + 8);
+        acc += NetLoad32(p + 12);
+        p += 16;
+        len -= 16U;
+    }
+    while (len >= 4U)
+    {
+        acc += NetLoad32(p);
+        p += 4;
+        len -= 4U;
+    }
+    if (len >= 2U)
+    {
+        acc += (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+        p += 2;
+        len -= 2U;
+    }
+    if (len != 0)
+    {
+        acc += p[0];
+    }
+
+    acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+    acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+    acc = (acc & 0xFFFFU) + (acc >> 16);
+    acc = (acc & 0xFFFFU) + (acc >> 16);
+
+    return (uint32_t)acc;
+}
+
+/*!
+ * @brief       Fold and complement a partial sum.
+ *
+ * @param       sum:  Partial sum from NetChecksumAdd()
+ *
+ * @retval      Checksum in memory byte order
+ */
+uint16_t NetChecksumFinish(uint32_t sum)
+{
+    sum = (sum & 0xFFFFU) + (sum >> 16);
+    sum = (sum & 0xFFFFU) + (sum >> 16);
+
+    return (uint16_t)~sum;
+}
+
+/*!
+ * @brief       Internet checksum of a block.
+ *
+ * @param       data:  Bytes
+ *
+ * @param       len:   Number of bytes
+ *
+ * @retval      Checksum in memory byte order
+ */
+uint16_t NetChecksum(const void* data, uint32_t len)
+{
+    return NetChecksumFinish(NetChecksumAdd(0, data, len));
+}
@@ -0,0 +1,47 @@
+#ifndef NET_H
+#define NET_H
+
+#include <stdint.h>
+
+/*
+ * Byte order and Internet checksum helpers shared by the network code.
+ *
+ * Multi-byte header fields are kept in network byte order as they sit in
+ * the frame; IPv4 addresses are uint32_t values loaded straight from memory
+ * (NET_IP4 builds one), so comparing them needs no swapping.
+ */
+
+/* Host (little-endian) <-> network byte order */
+#define NET_HTONS(x)    ((uint16_t)__builtin_bswap16((uint16_t)(x)))
+#define NET_NTOHS(x)    NET_HTONS(x)
+#define NET_HTONL(x)    ((uint32_t)__builtin_bswap32((uint32_t)(x)))
+#define NET_NTOHL(x)    NET_HTONL(x)
+
+/* a.b.c.d as stored in a frame */
+#define NET_IP4(a, b, c, d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+
+#define NET_MAC_LEN         6U
+
+/* Unaligned big-endian field access */
+static inline uint16_t NetRead16(const uint8_t* p)
+{
+    return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static inline void NetWrite16(uint8_t* p, uint16_t value)
+{
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+/*
+ * Software Internet checksum (RFC 1071), the fallback when the MAC checksum
+ * engines are not used. Partial sums are in memory byte order and may be
+ * chained; NetChecksumFinish() folds and complements, and the result is
+ * stored back in memory order (memcpy, not NetWrite16).
+ */
+uint32_t NetChecksumAdd(uint32_t sum, const void* data, uint32_t len);
+uint16_t NetChecksumFinish(uint32_t sum);
+uint16_t NetChecksum(const void* data, uint32_t len);
+
+#endif // NET_H
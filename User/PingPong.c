@@ -0,0 +1,358 @@
+#include <stddef.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_adc.h"
+#include "apm32f4xx_dac.h"
+#include "apm32f4xx_dma.h"
+#include "apm32f4xx_spi.h"
+#include "PingPong.h"
+
+/* Peripheral behind the stream, for PingPongStop() */
+#define PINGPONG_KIND_NONE  0U
+#define PINGPONG_KIND_ADC   1U
+#define PINGPONG_KIND_DAC   2U
+#define PINGPONG_KIND_I2S   3U
+
+/*!
+ * @brief       DMA callback: hand the finished buffer to the application.
+ *
+ * @param       transfer:  The double-buffered transfer
+ *
+ * @param       event:     DMA_EVENT_DONE at every buffer switch
+ *
+ * @retval      None
+ */
+static void PingPongDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    PingPong_T* pp = transfer->arg;
+    DMA_Stream_T* regs = pp->stream->regs;
+    uint32_t target, done;
+
+    if (event != DMA_EVENT_DONE)
+    {
+        pp->running = 0;
+        return;
+    }
+
+    /* The DMA is in the other buffer now */
+    target = DMA_ReadCurrentMemoryTarget(regs);
+    done = target ^ 1U;
+    if (done != pp->expect)
+    {
+        /* Two switches behind one interrupt: a buffer was never reported */
+        pp->overruns++;
+    }
+    pp->expect = (uint8_t)target;
+
+    pp->idle = (uint8_t)done;
+    pp->swapped = 0;
+    pp->callback(pp, pp->buffer[done]);
+
+    /* Still in the callback when the DMA switched back to its buffer */
+    if (DMA_ReadCurrentMemoryTarget(regs) != target)
+    {
+        pp->overruns++;
+    }
+    pp->buffers++;
+}
+
+/*!
+ * @brief       Set up a stream.
+ *
+ * @param       pp:          Streaming state
+ *
+ * @param       buffer0:     First buffer, samples * sampleSize bytes
+ *
+ * @param       buffer1:     Second buffer, same size
+ *
+ * @param       samples:     Samples per buffer, 1..65535
+ *
+ * @param       sampleSize:  Bytes per sample: 1, 2 or 4
+ *
+ * @param       callback:    Called with each finished buffer
+ *
+ * @param       arg:         For the callback, in pp->arg
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Buffers cannot be in CCM RAM. Word-aligned buffers with a
+ *              length of a multiple of 16 bytes give the DMA bursts.
+ */
+uint8_t PingPongInit(PingPong_T* pp, void* buffer0, void* buffer1, uint32_t samples,
+                     uint8_t sampleSize, PingPongCallback_T callback, void* arg)
+{
+    if ((samples == 0) || (samples > 0xFFFFU) || (callback == NULL) ||
+        ((sampleSize != 1U) && (sampleSize != 2U) && (sampleSize != 4U)))
+    {
+        return ERROR;
+    }
+
+    pp->stream = NULL;
+    pp->buffer[0] = buffer0;
+    pp->buffer[1] = buffer1;
+    pp->samples = samples;
+    pp->sampleSize = sampleSize;
+    pp->output = 0;
+    pp->idle = 0;
+    pp->swapped = 0;
+    pp->callback = callback;
+    pp->arg = arg;
+    pp->buffers = 0;
+    pp->overruns = 0;
+    pp->running = 0;
+    pp->expect = 0;
+    pp->peripheral = NULL;
+    pp->dacChannel = 0;
+    pp->kind = PINGPONG_KIND_NONE;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Start streaming between the buffers and a peripheral.
+ *
+ * @param       pp:              Streaming state from PingPongInit()
+ *
+ * @param       request:         DMA request of the peripheral
+ *
+ * @param       peripheralAddr:  Peripheral data register
+ *
+ * @param       output:          Nonzero for memory to peripheral
+ *
+ * @retval      SUCCESS, or ERROR when no stream of the request is free
+ *
+ * @note        An output stream first has the callback fill both buffers.
+ *              Enable the peripheral's DMA requests afterwards.
+ */
+uint8_t PingPongStart(PingPong_T* pp, DmaRequest_T request, uint32_t peripheralAddr, uint8_t output)
+{
+    if (pp->stream != NULL)
+    {
+        return ERROR;
+    }
+
+    pp->output = output ? 1U : 0U;
+    pp->buffers = 0;
+    pp->overruns = 0;
+    pp->expect = 0;
+
+    if (pp->output)
+    {
+        pp->idle = 0;
+        pp->callback(pp, pp->buffer[0]);
+        pp->idle = 1;
+        pp->callback(pp, pp->buffer[1]);
+    }
+
+    pp->stream = DmaClaim(request, DMA_PRIORITY_HIGH, PINGPONG_IRQ_PRIORITY);
+    if (pp->stream == NULL)
+    {
+        return ERROR;
+    }
+
+    pp->transfer.peripheral = peripheralAddr;
+    pp->transfer.memory = (uint32_t)pp->buffer[0];
+    pp->transfer.memory1 = (uint32_t)pp->buffer[1];
+    pp->transfer.count = (uint16_t)pp->samples;
+    pp->transfer.size = pp->sampleSize;
+    pp->transfer.dir = pp->output ? DMA_DIR_MEMORYTOPERIPHERAL : DMA_DIR_PERIPHERALTOMEMORY;
+    pp->transfer.flags = DMA_XFER_DOUBLE;
+    pp->transfer.done = PingPongDone;
+    pp->transfer.arg = pp;
+    pp->running = 1;
+
+    if (DmaSubmit(pp->stream, &pp->transfer) != SUCCESS)
+    {
+        DmaRelease(pp->stream);
+        pp->stream = NULL;
+        pp->running = 0;
+        return ERROR;
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stop streaming and release the DMA stream.
+ *
+ * @param       pp:      Streaming state
+ *
+ * @retval      None
+ *
+ * @note        Turns off the DMA requests of an adapter's peripheral first.
+ */
+void PingPongStop(PingPong_T* pp)
+{
+    switch (pp->kind)
+    {
+        case PINGPONG_KIND_ADC:
+            ADC_DisableDMA((ADC_T*)pp->peripheral);
+            break;
+
+        case PINGPONG_KIND_DAC:
+            DAC_DMA_Disable((DAC_CHANNEL_T)pp->dacChannel);
+            break;
+
+        case PINGPONG_KIND_I2S:
+            SPI_I2S_DisableDMA((SPI_T*)pp->peripheral, pp->output ? SPI_I2S_DMA_REQ_TX : SPI_I2S_DMA_REQ_RX);
+            break;
+
+        default:
+            break;
+    }
+    pp->kind = PINGPONG_KIND_NONE;
+
+    if (pp->stream != NULL)
+    {
+        DmaRelease(pp->stream);
+        pp->stream = NULL;
+    }
+    pp->running = 0;
+}
+
+/*!
+ * @brief       Stream into a different buffer from the next switch on.
+ *
+ * @param       pp:      Streaming state
+ *
+ * @param       buffer:  Replaces the buffer just passed to the callback,
+ *                       which then belongs to the application
+ *
+ * @retval      SUCCESS, or ERROR when the DMA has already gone back to
+ *              the old buffer (the callback overran)
+ *
+ * @note        Call from the callback, at most once per buffer. An output
+ *              buffer must be filled before the call.
+ */
+uint8_t PingPongSwap(PingPong_T* pp, void* buffer)
+{
+    if (pp->swapped)
+    {
+        return ERROR;
+    }
+
+    if (pp->running)
+    {
+        /* Only the register of the target the DMA is not using may be written */
+        if (DMA_ReadCurrentMemoryTarget(pp->stream->regs) == pp->idle)
+        {
+            return ERROR;
+        }
+        DMA_ConfigMemoryTarget(pp->stream->regs, (uint32_t)buffer, (DMA_MEMORY_T)pp->idle);
+    }
+
+    pp->buffer[pp->idle] = buffer;
+    pp->swapped = 1;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stream regular conversions of an ADC into the buffers.
+ *
+ * @param       pp:      Streaming state, 16-bit samples
+ *
+ * @param       adc:     ADC1, ADC2 or ADC3, channels and trigger configured
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Conversions are started by the caller (software start or the
+ *              trigger timer) once this returns.
+ */
+uint8_t PingPongStartAdc(PingPong_T* pp, ADC_T* adc)
+{
+    DmaRequest_T request = (adc == ADC1) ? DMA_REQ_ADC1 : ((adc == ADC2) ? DMA_REQ_ADC2 : DMA_REQ_ADC3);
+
+    if ((pp->sampleSize != 2U) || ((adc != ADC1) && (adc != ADC2) && (adc != ADC3)))
+    {
+        return ERROR;
+    }
+
+    if (PingPongStart(pp, request, (uint32_t)&adc->REGDATA, 0) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Keep requesting after each buffer: the stream never ends */
+    ADC_EnableDMARequest(adc);
+    ADC_EnableDMA(adc);
+    pp->peripheral = adc;
+    pp->kind = PINGPONG_KIND_ADC;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stream the buffers out of a DAC channel.
+ *
+ * @param       pp:      Streaming state, 16-bit samples, 12 bits right-aligned
+ *
+ * @param       channel: DAC_CHANNEL_1 or DAC_CHANNEL_2, with a trigger
+ *                       configured and the channel enabled
+ *
+ * @retval      SUCCESS or ERROR
+ */
+uint8_t PingPongStartDac(PingPong_T* pp, DAC_CHANNEL_T channel)
+{
+    uint8_t dac2 = (channel == DAC_CHANNEL_2);
+
+    if (pp->sampleSize != 2U)
+    {
+        return ERROR;
+    }
+
+    if (PingPongStart(pp, dac2 ? DMA_REQ_DAC2 : DMA_REQ_DAC1,
+                      dac2 ? (uint32_t)&DAC->DH12R2 : (uint32_t)&DAC->DH12R1, 1) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    DAC_DMA_Enable(channel);
+    pp->dacChannel = (uint32_t)channel;
+    pp->kind = PINGPONG_KIND_DAC;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Stream an I2S interface (SPI2 or SPI3) in or out.
+ *
+ * @param       pp:      Streaming state, 16-bit samples (24/32-bit data
+ *                       takes two per channel)
+ *
+ * @param       spi:     SPI2 or SPI3 in I2S mode, configured
+ *
+ * @param       output:  Nonzero to transmit
+ *
+ * @retval      SUCCESS or ERROR
+ *
+ * @note        Enable the interface (I2S_Enable()) after this returns.
+ */
+uint8_t PingPongStartI2s(PingPong_T* pp, SPI_T* spi, uint8_t output)
+{
+    DmaRequest_T request;
+
+    if ((pp->sampleSize != 2U) || ((spi != SPI2) && (spi != SPI3)))
+    {
+        return ERROR;
+    }
+
+    if (spi == SPI2)
+    {
+        request = output ? DMA_REQ_SPI2_TX : DMA_REQ_SPI2_RX;
+    }
+    else
+    {
+        request = output ? DMA_REQ_SPI3_TX : DMA_REQ_SPI3_RX;
+    }
+
+    if (PingPongStart(pp, request, (uint32_t)&spi->DATA, output) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    SPI_I2S_EnableDMA(spi, output ? SPI_I2S_DMA_REQ_TX : SPI_I2S_DMA_REQ_RX);
+    pp->peripheral = spi;
+    pp->kind = PINGPONG_KIND_I2S;
+
+    return SUCCESS;
+}
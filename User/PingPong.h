@@ -0,0 +1,82 @@
+#ifndef PING_PONG_H
+#define PING_PONG_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_dac.h"
+#include "Dma.h"
+
+/*
+ * Continuous double-buffered (ping-pong) DMA streaming.
+ *
+ * The stream runs in DMA double-buffer mode and never stops: while the DMA
+ * fills (input) or plays out (output) one buffer, the other belongs to the
+ * application. At every switch the callback gets the buffer the DMA has
+ * just let go of, from the DMA interrupt, once per buffer instead of once
+ * per sample. An input callback consumes the samples; an output callback
+ * produces the next ones. The callback may hand over a different buffer
+ * with PingPongSwap() to keep the filled one (zero copy); the DMA takes
+ * the new address at its next switch without stopping.
+ *
+ * The DMA current-target bit tells whether the callback kept up: when it
+ * has changed by the time the callback returns, or a switch went by
+ * unreported, the DMA was already back in the buffer the application was
+ * using. Such overruns are counted, not fatal.
+ *
+ * The adapters wire the stream to ADC regular conversions, a DAC channel
+ * or an I2S (SPI2/SPI3) data register; the peripheral itself (channels,
+ * trigger timer, I2S format) is configured by the caller before start.
+ */
+
+/* NVIC priority of the stream interrupts */
+#ifndef PINGPONG_IRQ_PRIORITY
+#define PINGPONG_IRQ_PRIORITY 5
+#endif
+
+typedef struct PingPong PingPong_T;
+
+/* Buffer the DMA has just finished with; from the DMA interrupt */
+typedef void (*PingPongCallback_T)(PingPong_T* pp, void* buffer);
+
+/**
+ * @brief Streaming state; treat as opaque
+ */
+struct PingPong
+{
+    DmaStream_T*        stream;
+    DmaTransfer_T       transfer;
+    void*               buffer[2];      /*!< Current addresses of target 0 and 1 */
+    uint32_t            samples;        /*!< Samples per buffer */
+    uint8_t             sampleSize;     /*!< Bytes per sample: 1, 2 or 4 */
+    uint8_t             output;         /*!< Memory to peripheral */
+    uint8_t             idle;           /*!< Target handed to the callback */
+    uint8_t             swapped;        /*!< PingPongSwap() in this callback */
+    PingPongCallback_T  callback;
+    void*               arg;            /*!< For the callback */
+    volatile uint32_t   buffers;        /*!< Buffers completed */
+    volatile uint32_t   overruns;       /*!< Buffers the callback fell behind on */
+    volatile uint8_t    running;        /*!< Cleared when a DMA error stopped the stream */
+    uint8_t             expect;         /*!< Target the next switch should finish */
+
+    /* Adapter */
+    void*               peripheral;     /*!< ADC_T or SPI_T, NULL for the DAC */
+    uint32_t            dacChannel;
+    uint8_t             kind;
+};
+
+uint8_t PingPongInit(PingPong_T* pp, void* buffer0, void* buffer1, uint32_t samples,
+                     uint8_t sampleSize, PingPongCallback_T callback, void* arg);
+
+/* Any DMA request; the adapters below use it */
+uint8_t PingPongStart(PingPong_T* pp, DmaRequest_T request, uint32_t peripheralAddr, uint8_t output);
+void PingPongStop(PingPong_T* pp);
+
+/* From the callback: stream into a different buffer next time */
+uint8_t PingPongSwap(PingPong_T* pp, void* buffer);
+
+/* Adapters; 16-bit samples */
+uint8_t PingPongStartAdc(PingPong_T* pp, ADC_T* adc);
+uint8_t PingPongStartDac(PingPong_T* pp, DAC_CHANNEL_T channel);
+uint8_t PingPongStartI2s(PingPong_T* pp, SPI_T* spi, uint8_t output);
+
+#endif // PING_PONG_H
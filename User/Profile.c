@@ -0,0 +1,268 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "Critical.h"
+#include "Debug.h"
+#include "Profile.h"
+
+/* Registered zones, in order of first use */
+static ProfileZone_T* zoneList;
+/* Innermost active scope (thread or interrupt) */
+static ProfileScope_T* current;
+/* Cycles an empty zone measures, subtracted from every sample */
+static uint32_t overhead;
+static volatile uint8_t dumpRequested;
+
+/*!
+ * @brief       Start the DWT cycle counter and calibrate the zone overhead.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void ProfileInit(void)
+{
+    ProfileZone_T cal = PROFILE_ZONE_INIT(NULL);
+    ProfileScope_T scope;
+    uint32_t i;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* Unnamed zones are never registered, so cal can live on the stack */
+    overhead = 0;
+    for (i = 0; i < 8; i++)
+    {
+        ProfileBegin(&scope, &cal);
+        ProfileEnd(&scope);
+    }
+    overhead = cal.min;
+}
+
+/*!
+ * @brief       Clear the statistics of every registered zone.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void ProfileReset(void)
+{
+    ProfileZone_T* zone;
+
+    for (zone = zoneList; zone != NULL; zone = zone->next)
+    {
+        CRITICAL_ENTER();
+        zone->count = 0;
+        zone->min = UINT32_MAX;
+        zone->max = 0;
+        zone->total = 0;
+        zone->self = 0;
+        memset(zone->hist, 0, sizeof(zone->hist));
+        CRITICAL_EXIT();
+    }
+}
+
+/*!
+ * @brief       Enter a zone. Use through PROFILE_ZONE().
+ *
+ * @param       scope:  Measurement state, must stay valid until ProfileEnd()
+ *
+ * @param       zone:   Zone statistics
+ *
+ * @retval      None
+ */
+void ProfileBegin(ProfileScope_T* scope, ProfileZone_T* zone)
+{
+    CRITICAL_ENTER();
+    if ((zone->registered == 0) && (zone->name != NULL))
+    {
+        zone->registered = 1;
+        zone->next = NULL;
+        if (zoneList == NULL)
+        {
+            zoneList = zone;
+        }
+        else
+        {
+            ProfileZone_T* last = zoneList;
+
+            while (last->next != NULL)
+            {
+                last = last->next;
+            }
+            last->next = zone;
+        }
+    }
+    scope->zone = zone;
+    scope->parent = current;
+    scope->child = 0;
+    current = scope;
+    CRITICAL_EXIT();
+
+    /* Sample last so the bookkeeping above is not measured */
+    scope->start = PROFILE_CYCLES();
+}
+
+/*!
+ * @brief       Leave a zone and record the sample. Called by the cleanup
+ *              attribute at the end of the PROFILE_ZONE() scope.
+ *
+ * @param       scope:  Measurement state passed to ProfileBegin()
+ *
+ * @retval      None
+ */
+void ProfileEnd(ProfileScope_T* scope)
+{
+    uint32_t elapsed = PROFILE_CYCLES() - scope->start;
+
+    elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0;
+
+    CRITICAL_ENTER();
+    current = scope->parent;
+    if (current != NULL)
+    {
+        current->child += elapsed;
+    }
+    ProfileRecord(scope->zone, elapsed, (elapsed > scope->child) ? (elapsed - scope->child) : 0);
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Histogram bin of a sample.
+ *
+ * @param       cycles:  Sample length
+ *
+ * @retval      0 for 0 cycles, n for [2^(n-1), 2^n), saturated to the last bin
+ */
+uint32_t ProfileHistBin(uint32_t cycles)
+{
+    uint32_t bin = (cycles == 0) ? 0 : (32U - __CLZ(cycles));
+
+    return (bin < PROFILE_HIST_BINS) ? bin : (PROFILE_HIST_BINS - 1);
+}
+
+/*!
+ * @brief       Aggregate one sample into a zone.
+ *
+ * @param       zone:        Zone statistics
+ *
+ * @param       cycles:      Inclusive sample length
+ *
+ * @param       selfCycles:  Sample length excluding nested zones
+ *
+ * @retval      None
+ *
+ * @note        Not reentrant for the same zone; ProfileEnd() calls it with
+ *              interrupts masked.
+ */
+void ProfileRecord(ProfileZone_T* zone, uint32_t cycles, uint32_t selfCycles)
+{
+    zone->count++;
+    zone->total += cycles;
+    zone->self += selfCycles;
+    if (cycles < zone->min)
+    {
+        zone->min = cycles;
+    }
+    if (cycles > zone->max)
+    {
+        zone->max = cycles;
+    }
+    zone->hist[ProfileHistBin(cycles)]++;
+}
+
+/*!
+ * @brief       First registered zone, iterate with zone->next.
+ *
+ * @param       None
+ *
+ * @retval      Zone list head (NULL when no zone ran yet)
+ */
+ProfileZone_T* ProfileFirstZone(void)
+{
+    return zoneList;
+}
+
+/*!
+ * @brief       Print the statistics of every zone on the debug UART.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void ProfileDump(void)
+{
+    ProfileZone_T* zone;
+    ProfileZone_T snap;
+    uint32_t bin;
+
+    PRINT("%-20s %10s %10s %10s %10s %10s\r\n", "zone", "count", "min", "mean", "max", "self/call");
+
+    for (zone = zoneList; zone != NULL; zone = zone->next)
+    {
+        {
+            CRITICAL_ENTER();
+            snap = *zone;
+            CRITICAL_EXIT();
+        }
+
+        if (snap.count == 0)
+        {
+            PRINT("%-20s %10lu\r\n", snap.name, 0UL);
+            continue;
+        }
+
+        PRINT("%-20s %10lu %10lu %10lu %10lu %10lu\r\n", snap.name,
+              (unsigned long)snap.count, (unsigned long)snap.min,
+              (unsigned long)(snap.total / snap.count), (unsigned long)snap.max,
+              (unsigned long)(snap.self / snap.count));
+
+        PRINT("  hist:");
+        for (bin = 0; bin < PROFILE_HIST_BINS; bin++)
+        {
+            if (snap.hist[bin] == 0)
+            {
+                continue;
+            }
+            if (bin == PROFILE_HIST_BINS - 1)
+            {
+                PRINT(" >=%lu:%lu", 1UL << (bin - 1), (unsigned long)snap.hist[bin]);
+            }
+            else
+            {
+                PRINT(" <%lu:%lu", 1UL << bin, (unsigned long)snap.hist[bin]);
+            }
+        }
+        PRINT("\r\n");
+    }
+}
+
+/*!
+ * @brief       Ask for a dump from interrupt context (e.g. DebugMon_Handler,
+ *              which a debugger can pend through DEMCR.MON_PEND).
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void ProfileDumpRequest(void)
+{
+    dumpRequested = 1;
+}
+
+/*!
+ * @brief       Run a requested dump. Call from the main loop.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void ProfilePoll(void)
+{
+    if (dumpRequested != 0)
+    {
+        dumpRequested = 0;
+        ProfileDump();
+    }
+}
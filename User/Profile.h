@@ -0,0 +1,91 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+/*
+ * Cycle-accurate profiling on the DWT cycle counter.
+ *
+ *   {
+ *       PROFILE_ZONE("aes-cbc");
+ *       CRYP_AES_CBC(...);
+ *   }
+ *
+ * A zone is measured from the PROFILE_ZONE statement to the end of the
+ * enclosing scope. Zones may nest (also across interrupts); each zone keeps
+ * inclusive min/max/mean, self time (excluding nested zones) and a log2
+ * histogram. Results are printed with ProfileDump().
+ */
+
+#ifndef PROFILE_ENABLE
+#ifdef DEBUG
+#define PROFILE_ENABLE 1
+#else
+#define PROFILE_ENABLE 0
+#endif
+#endif
+
+/* Histogram bin n counts samples in [2^(n-1), 2^n) cycles, the last bin is open */
+#ifndef PROFILE_HIST_BINS
+#define PROFILE_HIST_BINS 24
+#endif
+
+/* Cycle source, may be overridden (e.g. with a mock on a host build) */
+#ifndef PROFILE_CYCLES
+#define PROFILE_CYCLES() (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief Per-zone statistics
+ */
+typedef struct ProfileZone
+{
+    const char*         name;                       /*!< Zone name */
+    struct ProfileZone* next;                       /*!< Registered zone list */
+    uint8_t             registered;                 /*!< Linked into the zone list */
+    uint32_t            count;                      /*!< Number of samples */
+    uint32_t            min;                        /*!< Shortest sample (cycles) */
+    uint32_t            max;                        /*!< Longest sample (cycles) */
+    uint64_t            total;                      /*!< Sum of samples (cycles) */
+    uint64_t            self;                       /*!< Sum excluding nested zones */
+    uint32_t            hist[PROFILE_HIST_BINS];    /*!< log2 histogram */
+} ProfileZone_T;
+
+/**
+ * @brief Active measurement, lives on the stack of the measured scope
+ */
+typedef struct ProfileScope
+{
+    ProfileZone_T*       zone;      /*!< Zone being measured */
+    struct ProfileScope* parent;    /*!< Enclosing active scope */
+    uint32_t             start;     /*!< Cycle counter at entry */
+    uint32_t             child;     /*!< Cycles spent in nested zones */
+} ProfileScope_T;
+
+#define PROFILE_ZONE_INIT(zname) { .name = (zname), .min = UINT32_MAX }
+
+void ProfileInit(void);
+void ProfileReset(void);
+void ProfileBegin(ProfileScope_T* scope, ProfileZone_T* zone);
+void ProfileEnd(ProfileScope_T* scope);
+void ProfileRecord(ProfileZone_T* zone, uint32_t cycles, uint32_t selfCycles);
+uint32_t ProfileHistBin(uint32_t cycles);
+ProfileZone_T* ProfileFirstZone(void);
+void ProfileDump(void);
+void ProfileDumpRequest(void);
+void ProfilePoll(void);
+
+#define PROFILE_CAT(a, b)   PROFILE_CAT_(a, b)
+#define PROFILE_CAT_(a, b)  a##b
+
+#if PROFILE_ENABLE
+#define PROFILE_ZONE(zname)                                                             \
+    static ProfileZone_T PROFILE_CAT(profZone, __LINE__) = PROFILE_ZONE_INIT(zname);    \
+    ProfileScope_T PROFILE_CAT(profScope, __LINE__)                                     \
+        __attribute__((cleanup(ProfileEnd)));                                           \
+    ProfileBegin(&PROFILE_CAT(profScope, __LINE__), &PROFILE_CAT(profZone, __LINE__))
+#else
+#define PROFILE_ZONE(zname) do { } while (0)
+#endif
+
+#endif // PROFILE_H
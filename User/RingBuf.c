@@ -0,0 +1,177 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "RingBuf.h"
+
+/*!
+ * @brief       Initialize a ring buffer over caller-provided storage.
+ *
+ * @param       rb:    Ring buffer
+ *
+ * @param       buf:   Storage
+ *
+ * @param       size:  Storage size in bytes, must be a power of two
+ *
+ * @retval      None
+ */
+void RingBufInit(RingBuf_T* rb, uint8_t* buf, uint32_t size)
+{
+    rb->buf = buf;
+    rb->mask = size - 1U;
+    rb->head = 0;
+    rb->tail = 0;
+}
+
+/*!
+ * @brief       Discard all content. Only safe while neither side is active.
+ *
+ * @param       rb:  Ring buffer
+ *
+ * @retval      None
+ */
+void RingBufReset(RingBuf_T* rb)
+{
+    rb->head = 0;
+    rb->tail = 0;
+}
+
+uint32_t RingBufSize(const RingBuf_T* rb)
+{
+    return rb->mask + 1U;
+}
+
+uint32_t RingBufUsed(const RingBuf_T* rb)
+{
+    return rb->head - rb->tail;
+}
+
+uint32_t RingBufFree(const RingBuf_T* rb)
+{
+    return RingBufSize(rb) - RingBufUsed(rb);
+}
+
+/*!
+ * @brief       Append data (producer side).
+ *
+ * @param       rb:    Ring buffer
+ *
+ * @param       data:  Bytes to append
+ *
+ * @param       len:   Number of bytes
+ *
+ * @retval      Number of bytes actually stored (less than len when full)
+ */
+uint32_t RingBufWrite(RingBuf_T* rb, const uint8_t* data, uint32_t len)
+{
+    uint32_t head = rb->head;
+    uint32_t space = RingBufSize(rb) - (head - rb->tail);
+    uint32_t pos, first;
+
+    if (len > space)
+    {
+        len = space;
+    }
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    pos = head & rb->mask;
+    first = RingBufSize(rb) - pos;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&rb->buf[pos], data, first);
+    memcpy(rb->buf, data + first, len - first);
+
+    /* Data must be visible before the consumer sees the new head */
+    __DMB();
+    rb->head = head + len;
+
+    return len;
+}
+
+/*!
+ * @brief       Copy data out and release it (consumer side).
+ *
+ * @param       rb:    Ring buffer
+ *
+ * @param       data:  Destination
+ *
+ * @param       len:   Maximum number of bytes
+ *
+ * @retval      Number of bytes read
+ */
+uint32_t RingBufRead(RingBuf_T* rb, uint8_t* data, uint32_t len)
+{
+    uint32_t tail = rb->tail;
+    uint32_t used = rb->head - tail;
+    uint32_t pos, first;
+
+    if (len > used)
+    {
+        len = used;
+    }
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    pos = tail & rb->mask;
+    first = RingBufSize(rb) - pos;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(data, &rb->buf[pos], first);
+    memcpy(data + first, rb->buf, len - first);
+
+    __DMB();
+    rb->tail = tail + len;
+
+    return len;
+}
+
+/*!
+ * @brief       Get the longest contiguous readable block without releasing it.
+ *
+ * @param       rb:   Ring buffer
+ *
+ * @param       ptr:  Receives the start of the block
+ *
+ * @retval      Block length in bytes (0 when empty). The block stays owned
+ *              by the consumer until released with RingBufConsume().
+ */
+uint32_t RingBufPeekLinear(const RingBuf_T* rb, uint8_t** ptr)
+{
+    uint32_t tail = rb->tail;
+    uint32_t used = rb->head - tail;
+    uint32_t pos = tail & rb->mask;
+    uint32_t first = RingBufSize(rb) - pos;
+
+    *ptr = &rb->buf[pos];
+
+    return (used < first) ? used : first;
+}
+
+/*!
+ * @brief       Release bytes previously obtained with RingBufPeekLinear().
+ *
+ * @param       rb:   Ring buffer
+ *
+ * @param       len:  Number of bytes to release
+ *
+ * @retval      None
+ */
+void RingBufConsume(RingBuf_T* rb, uint32_t len)
+{
+    uint32_t used = rb->head - rb->tail;
+
+    if (len > used)
+    {
+        len = used;
+    }
+
+    __DMB();
+    rb->tail += len;
+}
@@ -0,0 +1,37 @@
+#ifndef RING_BUF_H
+#define RING_BUF_H
+
+#include <stdint.h>
+
+/**
+ * @brief Single-producer/single-consumer byte ring buffer.
+ *
+ * head is only written by the producer and tail only by the consumer, so
+ * one side may run in thread mode and the other in an ISR (or DMA
+ * completion handler) without locking. Indices are free-running and the
+ * size must be a power of two.
+ */
+typedef struct
+{
+    uint8_t*          buf;      /*!< Storage, size bytes */
+    uint32_t          mask;     /*!< size - 1 */
+    volatile uint32_t head;     /*!< Producer index (free-running) */
+    volatile uint32_t tail;     /*!< Consumer index (free-running) */
+} RingBuf_T;
+
+void RingBufInit(RingBuf_T* rb, uint8_t* buf, uint32_t size);
+void RingBufReset(RingBuf_T* rb);
+
+uint32_t RingBufSize(const RingBuf_T* rb);
+uint32_t RingBufUsed(const RingBuf_T* rb);
+uint32_t RingBufFree(const RingBuf_T* rb);
+
+/* Producer side */
+uint32_t RingBufWrite(RingBuf_T* rb, const uint8_t* data, uint32_t len);
+
+/* Consumer side */
+uint32_t RingBufRead(RingBuf_T* rb, uint8_t* data, uint32_t len);
+uint32_t RingBufPeekLinear(const RingBuf_T* rb, uint8_t** ptr);
+void RingBufConsume(RingBuf_T* rb, uint32_t len);
+
+#endif // RING_BUF_H
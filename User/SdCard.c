@@ -0,0 +1,911 @@
+#include <stddef.h>
+#include <string.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_gpio.h"
+#include "apm32f4xx_misc.h"
+#include "apm32f4xx_rcm.h"
+#include "Critical.h"
+#include "SdCard.h"
+
+/* SDIO registers */
+#define SDIO_PWRCTRL_ON         0x3UL
+#define SDIO_CLKCTRL_CLKDIV     0xFFUL
+#define SDIO_CLKCTRL_CLKEN      (1UL << 8)
+#define SDIO_CLKCTRL_BYPASSEN   (1UL << 10)
+#define SDIO_CLKCTRL_WBSEL_4B   (1UL << 11)
+#define SDIO_CMD_WAITRES_SHORT  (1UL << 6)
+#define SDIO_CMD_WAITRES_LONG   (3UL << 6)
+#define SDIO_CMD_CPSMEN         (1UL << 10)
+#define SDIO_DCTRL_DTEN         (1UL << 0)
+#define SDIO_DCTRL_DTDRCFG      (1UL << 1)      /* Card to controller */
+#define SDIO_DCTRL_DMAEN        (1UL << 3)
+#define SDIO_DCTRL_DBSIZE_POS   4U
+#define SDIO_STS_COMRESP        (1UL << 0)      /* Response CRC failed */
+#define SDIO_STS_DBDR           (1UL << 1)      /* Data CRC failed */
+#define SDIO_STS_CMDRESTO       (1UL << 2)
+#define SDIO_STS_DATATO         (1UL << 3)
+#define SDIO_STS_TXUDRER        (1UL << 4)
+#define SDIO_STS_RXOVRER        (1UL << 5)
+#define SDIO_STS_CMDRES         (1UL << 6)
+#define SDIO_STS_CMDSENT        (1UL << 7)
+#define SDIO_STS_DATAEND        (1UL << 8)
+#define SDIO_STS_SBE            (1UL << 9)
+#define SDIO_STS_RXDA           (1UL << 21)
+#define SDIO_STS_STATIC         0x00C007FFUL    /* Flags cleared through ICF */
+
+#define SDIO_STS_CMD_DONE       (SDIO_STS_COMRESP | SDIO_STS_CMDRESTO | SDIO_STS_CMDRES | SDIO_STS_CMDSENT)
+#define SDIO_STS_DATA_ERRORS    (SDIO_STS_DBDR | SDIO_STS_DATATO | SDIO_STS_TXUDRER | SDIO_STS_RXOVRER | \
+                                 SDIO_STS_SBE)
+
+/* Commands; ACMDs follow CMD55 */
+#define SD_CMD_GO_IDLE_STATE            0U
+#define SD_CMD_ALL_SEND_CID             2U
+#define SD_CMD_SEND_RELATIVE_ADDR       3U
+#define SD_CMD_SWITCH_FUNC              6U
+#define SD_CMD_SELECT_CARD              7U
+#define SD_CMD_SEND_IF_COND             8U
+#define SD_CMD_SEND_CSD                 9U
+#define SD_CMD_STOP_TRANSMISSION        12U
+#define SD_CMD_SEND_STATUS              13U
+#define SD_CMD_SET_BLOCKLEN             16U
+#define SD_CMD_READ_SINGLE_BLOCK        17U
+#define SD_CMD_READ_MULTIPLE_BLOCK      18U
+#define SD_CMD_WRITE_BLOCK              24U
+#define SD_CMD_WRITE_MULTIPLE_BLOCK     25U
+#define SD_CMD_APP_CMD                  55U
+#define SD_ACMD_SET_BUS_WIDTH           6U
+#define SD_ACMD_SET_WR_BLK_ERASE_COUNT  23U
+#define SD_ACMD_SD_SEND_OP_COND         41U
+#define SD_ACMD_SEND_SCR                51U
+
+/* Responses */
+#define SD_RESP_NONE        0U
+#define SD_RESP_R1          1U      /* Card status, error bits checked */
+#define SD_RESP_R1B         2U      /* R1, card busy after it */
+#define SD_RESP_R2          3U      /* CID or CSD */
+#define SD_RESP_R3          4U      /* OCR, without CRC */
+#define SD_RESP_R6          5U      /* Relative address */
+#define SD_RESP_R7          6U      /* Interface condition */
+#define SD_RESP_STATUS      7U      /* R1 of CMD13, error bits left to the caller */
+
+/* Card status (R1) */
+#define SD_R1_ERRORS            0xFDFFE008UL
+#define SD_R1_OUT_OF_RANGE      (1UL << 31)
+#define SD_R1_READY_FOR_DATA    (1UL << 8)
+#define SD_R1_STATE(status)     (((status) >> 9) & 0xFU)
+#define SD_STATE_TRAN           4U
+#define SD_R6_ERRORS            0xE000UL
+
+/* OCR, ACMD41 argument and CMD8 */
+#define SD_OCR_BUSY             (1UL << 31)     /* Set when power-up is done */
+#define SD_OCR_CCS              (1UL << 30)     /* Card capacity status; HCS in the argument */
+#define SD_OCR_XPC              (1UL << 28)     /* SDXC maximum performance */
+#define SD_OCR_VOLTAGES         0x00FF8000UL    /* 2.7-3.6 V */
+#define SD_CHECK_PATTERN        0x1AAUL         /* 2.7-3.6 V, check pattern 0xAA */
+
+/* SCR and CMD6 switch status */
+#define SD_SCR_SPEC(scr0)       (((scr0) >> 24) & 0xFU)
+#define SD_SCR_BUS_4BIT(scr0)   (((scr0) >> 18) & 1U)
+#define SD_SWITCH_CHECK_HS      0x00FFFFF1UL
+#define SD_SWITCH_SET_HS        0x80FFFFF1UL
+
+/* Operations */
+#define SD_OP_NONE          0U
+#define SD_OP_READ          1U
+#define SD_OP_WRITE         2U
+
+/* Card behind SDIO_IRQHandler */
+static SdCard_T* sdCard;
+
+static void SdCardStart(SdCard_T* card);
+
+/*!
+ * @brief       Send a command and wait for its response.
+ *
+ * @param       card:      Card; the response lands in card->response
+ *
+ * @param       index:     Command index
+ *
+ * @param       argument:  Command argument
+ *
+ * @param       response:  SD_RESP_*
+ *
+ * @retval      SUCCESS, or ERROR on timeout, CRC failure, a response to
+ *              another command or R1/R6 error bits
+ *
+ * @note        The controller gives up after 64 clocks without response,
+ *              so the wait is bounded. R3 carries no CRC and always
+ *              comes with COMRESP.
+ */
+static uint8_t SdCardCommand(SdCard_T* card, uint32_t index, uint32_t argument, uint32_t response)
+{
+    uint32_t cmd = index | SDIO_CMD_CPSMEN;
+    uint32_t sts;
+
+    if (response == SD_RESP_R2)
+    {
+        cmd |= SDIO_CMD_WAITRES_LONG;
+    }
+    else if (response != SD_RESP_NONE)
+    {
+        cmd |= SDIO_CMD_WAITRES_SHORT;
+    }
+
+    SDIO->ICF = SDIO_STS_CMD_DONE;
+    SDIO->ARG = argument;
+    SDIO->CMD = cmd;
+    do
+    {
+        sts = SDIO->STS;
+    } while ((sts & SDIO_STS_CMD_DONE) == 0);
+    SDIO->ICF = SDIO_STS_CMD_DONE;
+
+    if (response == SD_RESP_NONE)
+    {
+        return SUCCESS;
+    }
+    if ((sts & SDIO_STS_CMDRESTO) != 0)
+    {
+        return ERROR;
+    }
+
+    card->response[0] = SDIO->RES1;
+    card->response[1] = SDIO->RES2;
+    card->response[2] = SDIO->RES3;
+    card->response[3] = SDIO->RES4;
+
+    if (response == SD_RESP_R3)
+    {
+        return SUCCESS;
+    }
+    if ((sts & SDIO_STS_COMRESP) != 0)
+    {
+        return ERROR;
+    }
+    if (response == SD_RESP_R2)
+    {
+        return SUCCESS;
+    }
+    if ((SDIO->CMDRES & 0x3FU) != index)
+    {
+        return ERROR;
+    }
+
+    switch (response)
+    {
+        case SD_RESP_R1:
+        case SD_RESP_R1B:
+            return ((card->response[0] & SD_R1_ERRORS) == 0) ? SUCCESS : ERROR;
+
+        case SD_RESP_R6:
+            return ((card->response[0] & SD_R6_ERRORS) == 0) ? SUCCESS : ERROR;
+
+        default:
+            return SUCCESS;
+    }
+}
+
+/* CMD55 with the card's address, then the application command */
+static uint8_t SdCardAppCommand(SdCard_T* card, uint32_t index, uint32_t argument, uint32_t response)
+{
+    if (SdCardCommand(card, SD_CMD_APP_CMD, card->rca, SD_RESP_R1) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    return SdCardCommand(card, index, argument, response);
+}
+
+/* Busy wait on the DWT cycle counter */
+static void SdCardDelay(uint32_t ms)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = SystemCoreClock / 1000U * ms;
+
+    while (DWT->CYCCNT - start < cycles)
+    {
+    }
+}
+
+/*!
+ * @brief       CLKCTRL divider bits for a bus clock limit.
+ *
+ * @param       hz:      Fastest SDIO_CK allowed
+ *
+ * @param       actual:  Receives the SDIO_CK that results
+ *
+ * @retval      CLKDIV, or BYPASSEN when SDIOCLK itself is allowed
+ *
+ * @note        SDIO_CK = SDIOCLK / (CLKDIV + 2).
+ */
+static uint32_t SdCardClockDiv(uint32_t hz, uint32_t* actual)
+{
+    uint32_t div;
+
+    if (hz >= SDCARD_SDIOCLK)
+    {
+        *actual = SDCARD_SDIOCLK;
+        return SDIO_CLKCTRL_BYPASSEN;
+    }
+
+    div = (SDCARD_SDIOCLK + hz - 1U) / hz;
+    div = (div < 2U) ? 0 : ((div > 257U) ? 255U : div - 2U);
+    *actual = SDCARD_SDIOCLK / (div + 2U);
+
+    return div;
+}
+
+static void SdCardSetClock(SdCard_T* card, uint32_t hz)
+{
+    uint32_t clkctrl = SDIO->CLKCTRL & ~(SDIO_CLKCTRL_CLKDIV | SDIO_CLKCTRL_BYPASSEN);
+
+    SDIO->CLKCTRL = clkctrl | SdCardClockDiv(hz, &card->clock);
+}
+
+/*!
+ * @brief       Capacity from the CSD.
+ *
+ * @param       csd:  CSD, bits 127:96 first
+ *
+ * @retval      512-byte blocks, 0 for an unknown CSD structure
+ *
+ * @note        Version 1.0: (C_SIZE + 1) * 2^(C_SIZE_MULT + 2) blocks of
+ *              2^READ_BL_LEN bytes. Version 2.0: (C_SIZE + 1) * 512 KiB.
+ */
+static uint32_t SdCardCapacity(const uint32_t* csd)
+{
+    uint32_t size, mult, length;
+
+    switch (csd[0] >> 30)
+    {
+        case 0:
+            length = (csd[1] >> 16) & 0xFU;
+            size = ((csd[1] & 0x3FFU) << 2) | (csd[2] >> 30);
+            mult = (csd[2] >> 15) & 7U;
+            if ((length < 9U) || (length > 11U))
+            {
+                return 0;
+            }
+            return (size + 1U) << (mult + 2U + length - 9U);
+
+        case 1:
+            size = ((csd[1] & 0x3FU) << 16) | (csd[2] >> 16);
+            return (size + 1U) * 1024U;
+
+        default:
+            return 0;
+    }
+}
+
+/*!
+ * @brief       Read a short data block (SCR, switch status) with the CPU.
+ *
+ * @param       card:      Card in the transfer state
+ *
+ * @param       index:     Command index
+ *
+ * @param       argument:  Command argument
+ *
+ * @param       app:       1 for an application command
+ *
+ * @param       data:      Receives the bytes in bus order
+ *
+ * @param       bytes:     Block size, a power of two of 4 to 64
+ *
+ * @retval      SUCCESS or ERROR
+ */
+static uint8_t SdCardReadBlock(SdCard_T* card, uint32_t index, uint32_t argument, uint8_t app,
+                               uint32_t* data, uint32_t bytes)
+{
+    uint32_t sts, words = 0, code = 0;
+    uint8_t status;
+
+    while ((1UL << code) < bytes)
+    {
+        code++;
+    }
+
+    SDIO->ICF = SDIO_STS_STATIC;
+    SDIO->DATATIME = card->clock / 10U;
+    SDIO->DATALEN = bytes;
+    SDIO->DCTRL = SDIO_DCTRL_DTEN | SDIO_DCTRL_DTDRCFG | (code << SDIO_DCTRL_DBSIZE_POS);
+
+    status = app ? SdCardAppCommand(card, index, argument, SD_RESP_R1) :
+                   SdCardCommand(card, index, argument, SD_RESP_R1);
+    if (status != SUCCESS)
+    {
+        SDIO->DCTRL = 0;
+        return ERROR;
+    }
+
+    for (;;)
+    {
+        sts = SDIO->STS;
+        if ((sts & SDIO_STS_RXDA) != 0)
+        {
+            if (words < bytes / 4U)
+            {
+                data[words] = SDIO->FIFODATA;
+            }
+            words++;
+        }
+        else if ((sts & (SDIO_STS_DATAEND | SDIO_STS_DATA_ERRORS)) != 0)
+        {
+            break;
+        }
+    }
+    SDIO->ICF = SDIO_STS_STATIC;
+
+    return (((sts & SDIO_STS_DATA_ERRORS) == 0) && (words == bytes / 4U)) ? SUCCESS : ERROR;
+}
+
+/*!
+ * @brief       Switch to high speed if the card has it.
+ *
+ * @param       card:  Card in the transfer state, 4-bit bus
+ *
+ * @retval      SUCCESS, or ERROR when CMD6 fails
+ *
+ * @note        Function group 1: support in bits 415:400 of the switch
+ *              status (byte 13, bit 1 for function 1), the selected
+ *              function in bits 379:376 (low nibble of byte 16).
+ */
+static uint8_t SdCardHighSpeed(SdCard_T* card)
+{
+    uint32_t status[16];
+    const uint8_t* bytes = (const uint8_t*)status;
+
+    if (SD_SCR_SPEC(card->scr[0]) == 0)
+    {
+        /* CMD6 came with version 1.10 */
+        return SUCCESS;
+    }
+
+    if (SdCardReadBlock(card, SD_CMD_SWITCH_FUNC, SD_SWITCH_CHECK_HS, 0, status, sizeof(status)) != SUCCESS)
+    {
+        return ERROR;
+    }
+    if ((bytes[13] & 0x02U) == 0)
+    {
+        return SUCCESS;
+    }
+
+    if (SdCardReadBlock(card, SD_CMD_SWITCH_FUNC, SD_SWITCH_SET_HS, 0, status, sizeof(status)) != SUCCESS)
+    {
+        return ERROR;
+    }
+    if ((bytes[16] & 0x0FU) == 1U)
+    {
+        card->highSpeed = 1;
+        SdCardSetClock(card, 50000000U);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Identify and set up the card.
+ *
+ * @param       card:  Card state; must stay valid, transfers run from it
+ *
+ * @retval      SUCCESS, or ERROR without a card that completes the
+ *              sequence or when the SDIO stream is taken
+ */
+uint8_t SdCardInit(SdCard_T* card)
+{
+    GPIO_Config_T gpioConfig;
+    uint32_t raw[2];
+    uint32_t argument = SD_OCR_VOLTAGES;
+    uint32_t start, timeout;
+    const uint8_t* bytes = (const uint8_t*)raw;
+
+    if ((sdCard != NULL) && (sdCard->dma != NULL))
+    {
+        NVIC_DisableIRQRequest(SDIO_IRQn);
+        DmaRelease(sdCard->dma);
+        sdCard->dma = NULL;
+    }
+    sdCard = NULL;
+    memset(card, 0, sizeof(*card));
+
+    RCM_EnableAPB2PeriphClock(RCM_APB2_PERIPH_SDIO);
+    RCM_EnableAHB1PeriphClock(RCM_AHB1_PERIPH_GPIOC | RCM_AHB1_PERIPH_GPIOD);
+
+    GPIO_ConfigPinAF(GPIOC, GPIO_PIN_SOURCE_8, GPIO_AF_SDIO);
+    GPIO_ConfigPinAF(GPIOC, GPIO_PIN_SOURCE_9, GPIO_AF_SDIO);
+    GPIO_ConfigPinAF(GPIOC, GPIO_PIN_SOURCE_10, GPIO_AF_SDIO);
+    GPIO_ConfigPinAF(GPIOC, GPIO_PIN_SOURCE_11, GPIO_AF_SDIO);
+    GPIO_ConfigPinAF(GPIOC, GPIO_PIN_SOURCE_12, GPIO_AF_SDIO);
+    GPIO_ConfigPinAF(GPIOD, GPIO_PIN_SOURCE_2, GPIO_AF_SDIO);
+
+    /* Data and CMD are open-drain on the card side: pull-ups */
+    GPIO_ConfigStructInit(&gpioConfig);
+    gpioConfig.pin = GPIO_PIN_8 | GPIO_PIN_9 | GPIO_PIN_10 | GPIO_PIN_11;
+    gpioConfig.mode = GPIO_MODE_AF;
+    gpioConfig.speed = GPIO_SPEED_100MHz;
+    gpioConfig.otype = GPIO_OTYPE_PP;
+    gpioConfig.pupd = GPIO_PUPD_UP;
+    GPIO_Config(GPIOC, &gpioConfig);
+    gpioConfig.pin = GPIO_PIN_2;
+    GPIO_Config(GPIOD, &gpioConfig);
+    gpioConfig.pin = GPIO_PIN_12;
+    gpioConfig.pupd = GPIO_PUPD_NOPULL;
+    GPIO_Config(GPIOC, &gpioConfig);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* Identification at 400 kHz on one data line */
+    SDIO->DCTRL = 0;
+    SDIO->MASK = 0;
+    SDIO->CLKCTRL = 0;
+    SdCardSetClock(card, 400000U);
+    SDIO->PWRCTRL = SDIO_PWRCTRL_ON;
+    SDIO->CLKCTRL |= SDIO_CLKCTRL_CLKEN;
+
+    /* Supply ramp and the 74 initialization clocks */
+    SdCardDelay(2);
+
+    if (SdCardCommand(card, SD_CMD_GO_IDLE_STATE, 0, SD_RESP_NONE) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    /* Version 2.00 cards echo CMD8; older ones do not answer it */
+    if (SdCardCommand(card, SD_CMD_SEND_IF_COND, SD_CHECK_PATTERN, SD_RESP_R7) == SUCCESS)
+    {
+        if ((card->response[0] & 0xFFFU) != SD_CHECK_PATTERN)
+        {
+            return ERROR;
+        }
+        card->type = SDCARD_TYPE_SDSC_V2;
+        argument |= SD_OCR_CCS | SD_OCR_XPC;
+    }
+    else
+    {
+        card->type = SDCARD_TYPE_SDSC_V1;
+    }
+
+    start = DWT->CYCCNT;
+    timeout = SystemCoreClock / 1000U * SDCARD_INIT_TIMEOUT_MS;
+    do
+    {
+        if ((SdCardAppCommand(card, SD_ACMD_SD_SEND_OP_COND, argument, SD_RESP_R3) != SUCCESS) ||
+            (DWT->CYCCNT - start > timeout))
+        {
+            return ERROR;
+        }
+    } while ((card->response[0] & SD_OCR_BUSY) == 0);
+    card->ocr = card->response[0];
+    if ((card->type == SDCARD_TYPE_SDSC_V2) && ((card->ocr & SD_OCR_CCS) != 0))
+    {
+        card->type = SDCARD_TYPE_SDHC;
+    }
+
+    if (SdCardCommand(card, SD_CMD_ALL_SEND_CID, 0, SD_RESP_R2) != SUCCESS)
+    {
+        return ERROR;
+    }
+    memcpy(card->cid, card->response, sizeof(card->cid));
+
+    if (SdCardCommand(card, SD_CMD_SEND_RELATIVE_ADDR, 0, SD_RESP_R6) != SUCCESS)
+    {
+        return ERROR;
+    }
+    card->rca = card->response[0] & 0xFFFF0000U;
+
+    if (SdCardCommand(card, SD_CMD_SEND_CSD, card->rca, SD_RESP_R2) != SUCCESS)
+    {
+        return ERROR;
+    }
+    memcpy(card->csd, card->response, sizeof(card->csd));
+    card->blocks = SdCardCapacity(card->csd);
+
+    if ((card->blocks == 0) ||
+        (SdCardCommand(card, SD_CMD_SELECT_CARD, card->rca, SD_RESP_R1B) != SUCCESS))
+    {
+        return ERROR;
+    }
+
+    /* Data transfer mode: default speed, up to 25 MHz */
+    SdCardSetClock(card, 25000000U);
+
+    if (SdCardReadBlock(card, SD_ACMD_SEND_SCR, 0, 1, raw, sizeof(raw)) != SUCCESS)
+    {
+        return ERROR;
+    }
+    card->scr[0] = ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+    card->scr[1] = ((uint32_t)bytes[4] << 24) | ((uint32_t)bytes[5] << 16) | ((uint32_t)bytes[6] << 8) | bytes[7];
+
+    if (SD_SCR_BUS_4BIT(card->scr[0]))
+    {
+        if (SdCardAppCommand(card, SD_ACMD_SET_BUS_WIDTH, 2, SD_RESP_R1) != SUCCESS)
+        {
+            return ERROR;
+        }
+        SDIO->CLKCTRL |= SDIO_CLKCTRL_WBSEL_4B;
+    }
+
+    if ((SdCardHighSpeed(card) != SUCCESS) ||
+        ((card->type != SDCARD_TYPE_SDHC) &&
+         (SdCardCommand(card, SD_CMD_SET_BLOCKLEN, SDCARD_BLOCK_SIZE, SD_RESP_R1) != SUCCESS)))
+    {
+        return ERROR;
+    }
+
+    card->dma = DmaClaim(DMA_REQ_SDIO, DMA_PRIORITY_VERYHIGH, SDCARD_IRQ_PRIORITY);
+    if (card->dma == NULL)
+    {
+        return ERROR;
+    }
+    card->transfer.peripheral = (uint32_t)&SDIO->FIFODATA;
+    card->transfer.size = 4;
+    card->transfer.flags = DMA_XFER_PERIPH_BURST;
+    card->transfer.arg = card;
+
+    sdCard = card;
+    NVIC_EnableIRQRequest(SDIO_IRQn, SDCARD_IRQ_PRIORITY, 0);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       End the operation and report.
+ *
+ * @param       card:    Card
+ *
+ * @param       status:  SUCCESS or ERROR
+ *
+ * @retval      None
+ */
+static void SdCardFinish(SdCard_T* card, uint8_t status)
+{
+    card->busy = 0;
+    card->result = status;
+    card->op = SD_OP_NONE;
+
+    if (card->callback != NULL)
+    {
+        card->callback(card, status);
+    }
+}
+
+/* The running command is done (and the card back in the transfer state) */
+static void SdCardAdvance(SdCard_T* card)
+{
+    card->block += card->chunk;
+    card->buffer += card->chunk * SDCARD_BLOCK_SIZE;
+    card->remaining -= card->chunk;
+
+    if (card->remaining == 0)
+    {
+        SdCardFinish(card, SUCCESS);
+    }
+    else
+    {
+        SdCardStart(card);
+    }
+}
+
+/*!
+ * @brief       Abandon the running command.
+ *
+ * @param       card:  Card
+ *
+ * @retval      None
+ *
+ * @note        Stops the data path and the stream and sends CMD12; the
+ *              operation ends with ERROR once SdCardPoll() finds the card
+ *              in the transfer state again.
+ */
+static void SdCardFail(SdCard_T* card)
+{
+    SDIO->MASK = 0;
+    SDIO->DCTRL = 0;
+    SDIO->ICF = SDIO_STS_STATIC;
+    card->pending = 0;
+    DmaStop(card->dma);
+
+    (void)SdCardCommand(card, SD_CMD_STOP_TRANSMISSION, 0, SD_RESP_R1B);
+    card->result = ERROR;
+    card->busy = 1;
+}
+
+/*!
+ * @brief       One of the two completions of a command: the stream or
+ *              DATAEND.
+ *
+ * @param       card:  Card
+ *
+ * @retval      None
+ *
+ * @note        Both come from interrupts of SDCARD_IRQ_PRIORITY, which
+ *              cannot preempt each other. Multi-block commands are
+ *              stopped with CMD12; after a write the card programs.
+ */
+static void SdCardStep(SdCard_T* card)
+{
+    uint32_t errors;
+
+    if ((card->pending == 0) || (--card->pending != 0))
+    {
+        return;
+    }
+
+    /* Cards reading ahead report OUT_OF_RANGE in the CMD12 response of a
+       read that ends on the last block */
+    errors = ((card->op == SD_OP_READ) && ((card->block + card->chunk) == card->blocks)) ?
+             (SD_R1_ERRORS & ~SD_R1_OUT_OF_RANGE) : SD_R1_ERRORS;
+    if ((card->chunk > 1U) &&
+        ((SdCardCommand(card, SD_CMD_STOP_TRANSMISSION, 0, SD_RESP_STATUS) != SUCCESS) ||
+         ((card->response[0] & errors) != 0)))
+    {
+        card->result = ERROR;
+        card->busy = 1;
+        return;
+    }
+
+    if (card->op == SD_OP_READ)
+    {
+        SdCardAdvance(card);
+    }
+    else
+    {
+        card->busy = 1;
+    }
+}
+
+static void SdCardDmaDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    SdCard_T* card = transfer->arg;
+
+    if (event == DMA_EVENT_DONE)
+    {
+        SdCardStep(card);
+    }
+    else if (event == DMA_EVENT_ERROR)
+    {
+        card->errors = SDIO->STS;
+        SdCardFail(card);
+    }
+}
+
+/*!
+ * @brief       Issue the next command of the operation.
+ *
+ * @param       card:  Card with an operation in progress, in the
+ *                     transfer state
+ *
+ * @retval      None
+ *
+ * @note        The stream is armed first. A read enables the data path
+ *              before CMD18 so no block is missed; a write sends ACMD23
+ *              and CMD25 first. The data interrupts are unmasked last, so
+ *              the interrupt never sends CMD12 while a command here still
+ *              waits for its response.
+ */
+static void SdCardStart(SdCard_T* card)
+{
+    uint32_t address, dctrl;
+    uint8_t status;
+
+    card->chunk = (card->remaining < SDCARD_MAX_BLOCKS) ? card->remaining : SDCARD_MAX_BLOCKS;
+    address = (card->type == SDCARD_TYPE_SDHC) ? card->block : card->block * SDCARD_BLOCK_SIZE;
+
+    card->transfer.memory = (uint32_t)card->buffer;
+    card->transfer.count = (uint16_t)(card->chunk * (SDCARD_BLOCK_SIZE / 4U));
+    card->transfer.dir = (card->op == SD_OP_READ) ? DMA_DIR_PERIPHERALTOMEMORY : DMA_DIR_MEMORYTOPERIPHERAL;
+    card->transfer.done = SdCardDmaDone;
+    card->pending = 2;
+
+    SDIO->ICF = SDIO_STS_STATIC;
+    SDIO->DATATIME = (card->clock / 1000U) * SDCARD_DATA_TIMEOUT_MS;
+    SDIO->DATALEN = card->chunk * SDCARD_BLOCK_SIZE;
+    dctrl = SDIO_DCTRL_DTEN | SDIO_DCTRL_DMAEN | (9UL << SDIO_DCTRL_DBSIZE_POS);
+    (void)DmaSubmit(card->dma, &card->transfer);
+
+    if (card->op == SD_OP_READ)
+    {
+        SDIO->DCTRL = dctrl | SDIO_DCTRL_DTDRCFG;
+        status = SdCardCommand(card, (card->chunk > 1U) ? SD_CMD_READ_MULTIPLE_BLOCK : SD_CMD_READ_SINGLE_BLOCK,
+                               address, SD_RESP_R1);
+    }
+    else
+    {
+        status = SUCCESS;
+        if (card->chunk > 1U)
+        {
+            status = SdCardAppCommand(card, SD_ACMD_SET_WR_BLK_ERASE_COUNT, card->chunk, SD_RESP_R1);
+        }
+        if (status == SUCCESS)
+        {
+            status = SdCardCommand(card, (card->chunk > 1U) ? SD_CMD_WRITE_MULTIPLE_BLOCK : SD_CMD_WRITE_BLOCK,
+                                   address, SD_RESP_R1);
+        }
+        if (status == SUCCESS)
+        {
+            SDIO->DCTRL = dctrl;
+        }
+    }
+
+    if (status != SUCCESS)
+    {
+        SdCardFail(card);
+        return;
+    }
+    SDIO->MASK = SDIO_STS_DATAEND | SDIO_STS_DATA_ERRORS;
+}
+
+/*!
+ * @brief       SDIO interrupt: DATAEND or a data error.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void SdCardIRQHandler(void)
+{
+    SdCard_T* card = sdCard;
+    uint32_t sts = SDIO->STS & SDIO->MASK;
+
+    SDIO->ICF = sts & SDIO_STS_STATIC;
+    if ((card == NULL) || (card->op == SD_OP_NONE))
+    {
+        SDIO->MASK = 0;
+        return;
+    }
+
+    if ((sts & SDIO_STS_DATA_ERRORS) != 0)
+    {
+        card->errors = sts;
+        SdCardFail(card);
+    }
+    else if ((sts & SDIO_STS_DATAEND) != 0)
+    {
+        SDIO->MASK = 0;
+        SdCardStep(card);
+    }
+}
+
+/* Claim the card for count blocks at block */
+static uint8_t SdCardBegin(SdCard_T* card, uint8_t op, uint32_t block, const void* buffer, uint32_t count,
+                           SdCardCallback_T callback, void* arg)
+{
+    uint8_t ok;
+
+    if ((card->dma == NULL) || (count == 0) || (block >= card->blocks) || (count > card->blocks - block) ||
+        (((uint32_t)buffer & 3U) != 0))
+    {
+        return ERROR;
+    }
+
+    CRITICAL_ENTER();
+    ok = (card->op == SD_OP_NONE);
+    if (ok)
+    {
+        card->op = op;
+    }
+    CRITICAL_EXIT();
+    if (!ok)
+    {
+        return ERROR;
+    }
+
+    card->block = block;
+    card->remaining = count;
+    card->buffer = (uint8_t*)(uintptr_t)buffer;
+    card->busy = 0;
+    card->result = SUCCESS;
+    card->errors = 0;
+    card->callback = callback;
+    card->arg = arg;
+
+    SdCardStart(card);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Read blocks by DMA.
+ *
+ * @param       card:      Card from SdCardInit()
+ *
+ * @param       block:     First block
+ *
+ * @param       buffer:    Destination, word aligned, not in CCM RAM
+ *
+ * @param       count:     Blocks
+ *
+ * @param       callback:  Called at the end (may be NULL)
+ *
+ * @param       arg:       For the callback, in card->arg
+ *
+ * @retval      SUCCESS when started, ERROR when busy, out of range or
+ *              misaligned
+ */
+uint8_t SdCardRead(SdCard_T* card, uint32_t block, void* buffer, uint32_t count,
+                   SdCardCallback_T callback, void* arg)
+{
+    return SdCardBegin(card, SD_OP_READ, block, buffer, count, callback, arg);
+}
+
+/*!
+ * @brief       Write blocks by DMA.
+ *
+ * @param       card:      Card from SdCardInit()
+ *
+ * @param       block:     First block
+ *
+ * @param       buffer:    Source, word aligned, not in CCM RAM, untouched
+ *                         until the end
+ *
+ * @param       count:     Blocks
+ *
+ * @param       callback:  Called at the end (may be NULL)
+ *
+ * @param       arg:       For the callback, in card->arg
+ *
+ * @retval      SUCCESS when started, ERROR when busy, out of range or
+ *              misaligned
+ *
+ * @note        Needs SdCardPoll() calls to get past the programming
+ *              after each command.
+ */
+uint8_t SdCardWrite(SdCard_T* card, uint32_t block, const void* buffer, uint32_t count,
+                    SdCardCallback_T callback, void* arg)
+{
+    return SdCardBegin(card, SD_OP_WRITE, block, buffer, count, callback, arg);
+}
+
+/*!
+ * @brief       Check on a programming card; call from the main loop.
+ *
+ * @param       card:  Card
+ *
+ * @retval      1 while an operation runs, 0 when idle
+ *
+ * @note        Sends one CMD13 per call while the card is busy. Write
+ *              errors the card reports there fail the operation.
+ */
+uint8_t SdCardPoll(SdCard_T* card)
+{
+    if (card->busy)
+    {
+        card->polls++;
+        if (SdCardCommand(card, SD_CMD_SEND_STATUS, card->rca, SD_RESP_STATUS) != SUCCESS)
+        {
+            SdCardFinish(card, ERROR);
+        }
+        else if ((SD_R1_STATE(card->response[0]) == SD_STATE_TRAN) &&
+                 ((card->response[0] & SD_R1_READY_FOR_DATA) != 0))
+        {
+            card->busy = 0;
+            if (((card->response[0] & SD_R1_ERRORS) != 0) || (card->result != SUCCESS))
+            {
+                SdCardFinish(card, ERROR);
+            }
+            else
+            {
+                SdCardAdvance(card);
+            }
+        }
+    }
+
+    return card->op != SD_OP_NONE;
+}
+
+/*!
+ * @brief       Poll until the running operation ends.
+ *
+ * @param       card:  Card
+ *
+ * @retval      Result of the operation: SUCCESS or ERROR
+ */
+uint8_t SdCardWait(SdCard_T* card)
+{
+    while (SdCardPoll(card))
+    {
+    }
+
+    return card->result;
+}
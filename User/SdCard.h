@@ -0,0 +1,126 @@
+#ifndef SD_CARD_H
+#define SD_CARD_H
+
+#include <stdint.h>
+#include "Dma.h"
+
+/*
+ * SD memory card (SDSC, SDHC, SDXC) on the SDIO controller.
+ *
+ * SdCardInit() runs the identification sequence at 400 kHz (CMD0, CMD8,
+ * ACMD41 until the card is ready, CMD2, CMD3, CMD9, CMD7), reads the SCR,
+ * switches the card and the controller to the 4-bit bus and, when the
+ * card supports it, to high speed with CMD6: SDIO_CK is then SDIOCLK
+ * itself, 48 MHz, through the divider bypass (25 MHz cards run at 24).
+ *
+ * Reads and writes are multi-block commands (CMD18, CMD25) with the data
+ * moved by DMA2 straight between the FIFO and the caller's buffer, INC4
+ * bursts on both sides; up to SDCARD_MAX_BLOCKS go in one command, the
+ * rest in further ones. Each write is preceded by ACMD23 with its block
+ * count so the card can pre-erase. Completion needs both the stream
+ * interrupt and DATAEND from the SDIO interrupt; the interrupt then stops
+ * the transfer with CMD12 and either starts the next command (reads) or
+ * leaves the card programming. SdCardPoll() from the main loop sends CMD13
+ * while it programs, and the next command follows once the card is back in
+ * the transfer state. Commands themselves are short and polled.
+ *
+ * Enable with SDCARD_ENABLE (the SDIO interrupt handler in
+ * apm32f4xx_int.c is only built then). Pins: D0-D3 PC8-PC11, CK PC12,
+ * CMD PD2. Buffers must be word aligned and outside CCM RAM. Hardware
+ * flow control and the falling clock edge stay off (errata).
+ */
+
+#ifndef SDCARD_ENABLE
+#define SDCARD_ENABLE 0
+#endif
+
+/* SDIOCLK: the PLL 48 MHz output (system_apm32f4xx.c, PLL_D) */
+#ifndef SDCARD_SDIOCLK
+#define SDCARD_SDIOCLK 48000000U
+#endif
+
+/* Blocks per CMD18/CMD25; 65535 DMA words at most */
+#ifndef SDCARD_MAX_BLOCKS
+#define SDCARD_MAX_BLOCKS 128U
+#endif
+
+/* Preemption priority of the SDIO and stream interrupts */
+#ifndef SDCARD_IRQ_PRIORITY
+#define SDCARD_IRQ_PRIORITY 5
+#endif
+
+/* Power-up limit for ACMD41 */
+#ifndef SDCARD_INIT_TIMEOUT_MS
+#define SDCARD_INIT_TIMEOUT_MS 1000U
+#endif
+
+/* Data timeout per block, the SDHC write limit */
+#ifndef SDCARD_DATA_TIMEOUT_MS
+#define SDCARD_DATA_TIMEOUT_MS 250U
+#endif
+
+#define SDCARD_BLOCK_SIZE   512U
+
+/* Card types */
+#define SDCARD_TYPE_SDSC_V1 1U      /*!< Byte addresses */
+#define SDCARD_TYPE_SDSC_V2 2U      /*!< Byte addresses, answered CMD8 */
+#define SDCARD_TYPE_SDHC    3U      /*!< SDHC or SDXC, block addresses */
+
+typedef struct SdCard SdCard_T;
+
+/* SUCCESS or ERROR at the end of a read or write; from the interrupts or
+   SdCardPoll() */
+typedef void (*SdCardCallback_T)(SdCard_T* card, uint8_t status);
+
+/**
+ * @brief Card state; identity filled in by SdCardInit()
+ */
+struct SdCard
+{
+    DmaStream_T*        dma;
+    uint8_t             type;           /*!< SDCARD_TYPE_* */
+    uint8_t             highSpeed;      /*!< Switched with CMD6 */
+    uint32_t            rca;            /*!< Relative address, in bits 31:16 */
+    uint32_t            ocr;
+    uint32_t            cid[4];         /*!< Bits 127:96 first */
+    uint32_t            csd[4];
+    uint32_t            scr[2];
+    uint32_t            blocks;         /*!< Capacity in 512-byte blocks */
+    uint32_t            clock;          /*!< SDIO_CK in Hz */
+    uint32_t            response[4];    /*!< Of the last command */
+
+    /* Operation in progress */
+    volatile uint8_t    op;
+    volatile uint8_t    busy;           /*!< Card programming after a write */
+    volatile uint8_t    pending;        /*!< Stream and DATAEND still to come */
+    uint8_t             result;         /*!< SUCCESS or ERROR of the last operation */
+    uint32_t            block;
+    uint32_t            remaining;      /*!< Blocks */
+    uint32_t            chunk;          /*!< Blocks of the running command */
+    uint8_t*            buffer;
+    SdCardCallback_T    callback;
+    void*               arg;            /*!< For the callback */
+    uint32_t            errors;         /*!< SDIO status of the last failed transfer */
+    uint32_t            polls;          /*!< CMD13 sent while programming */
+    DmaTransfer_T       transfer;
+};
+
+uint8_t SdCardInit(SdCard_T* card);
+
+/* Asynchronous; ERROR when another operation runs, the range is bad or
+   the buffer is not word aligned */
+uint8_t SdCardRead(SdCard_T* card, uint32_t block, void* buffer, uint32_t count,
+                   SdCardCallback_T callback, void* arg);
+uint8_t SdCardWrite(SdCard_T* card, uint32_t block, const void* buffer, uint32_t count,
+                    SdCardCallback_T callback, void* arg);
+
+/* From the main loop: waits out programming; 1 while an operation runs */
+uint8_t SdCardPoll(SdCard_T* card);
+
+/* Poll until the operation ends; its result */
+uint8_t SdCardWait(SdCard_T* card);
+
+/* SDIO_IRQHandler (apm32f4xx_int.c) */
+void SdCardIRQHandler(void);
+
+#endif // SD_CARD_H
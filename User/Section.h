@@ -0,0 +1,29 @@
+#ifndef SECTION_H
+#define SECTION_H
+
+/*
+ * Placement of hot code and data, see Link/apm32f407xg_flash.ld.
+ *
+ * CCM_DATA   Initialized variable in CCM RAM (zero wait states, copied from
+ *            flash at startup)
+ * CCM_BSS    Zero-initialized variable in CCM RAM
+ * FAST_CODE  Function executed from SRAM (copied with .data at startup), for
+ *            ISR hot paths that should not wait on flash. Put it on the
+ *            declaration as well: it implies long_call, which callers in
+ *            flash need to reach SRAM.
+ *
+ * CCM RAM is on the CPU data bus only: DMA cannot access it and code cannot
+ * execute from it.
+ */
+
+#if defined(APM32_HOST)
+#define CCM_DATA
+#define CCM_BSS
+#define FAST_CODE
+#else
+#define CCM_DATA    __attribute__((section(".ccmram")))
+#define CCM_BSS     __attribute__((section(".ccmbss")))
+#define FAST_CODE   __attribute__((section(".ram_func"), noinline, long_call))
+#endif
+
+#endif // SECTION_H
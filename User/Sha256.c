@@ -0,0 +1,196 @@
+#include <string.h>
+#include "apm32f4xx.h"
+#include "Digest.h"
+#include "Sha256.h"
+
+#define SHA256_ROR(x, n)    (((x) >> (n)) | ((x) << (32U - (n))))
+
+#define SHA256_SUM0(x)      (SHA256_ROR(x, 2U) ^ SHA256_ROR(x, 13U) ^ SHA256_ROR(x, 22U))
+#define SHA256_SUM1(x)      (SHA256_ROR(x, 6U) ^ SHA256_ROR(x, 11U) ^ SHA256_ROR(x, 25U))
+#define SHA256_SIG0(x)      (SHA256_ROR(x, 7U) ^ SHA256_ROR(x, 18U) ^ ((x) >> 3))
+#define SHA256_SIG1(x)      (SHA256_ROR(x, 17U) ^ SHA256_ROR(x, 19U) ^ ((x) >> 10))
+#define SHA256_CH(e, f, g)  ((g) ^ ((e) & ((f) ^ (g))))
+#define SHA256_MAJ(a, b, c) (((a) & (b)) | ((c) & ((a) | (b))))
+
+#define HMAC_BLOCK_SIZE     64U
+
+/* Fractional parts of the cube roots of the first 64 primes */
+static const uint32_t sha256K[64] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U,
+    0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U,
+    0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU,
+    0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U,
+    0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U,
+    0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U,
+    0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U,
+    0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U,
+    0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+static inline uint32_t Sha256LoadBe(const uint8_t* p)
+{
+    uint32_t word;
+
+    memcpy(&word, p, sizeof(word));
+
+    return __builtin_bswap32(word);
+}
+
+/* Message word i < 16, big-endian from the block */
+#define SHA256_LOAD(i)      (w[i] = Sha256LoadBe(data + 4U * (i)))
+
+/* Message word i >= 16, computed in place in the 16-word ring */
+#define SHA256_SCHEDULE(i)  (w[(i) & 15U] += SHA256_SIG1(w[((i) - 2U) & 15U]) + w[((i) - 7U) & 15U] + \
+                                             SHA256_SIG0(w[((i) - 15U) & 15U]))
+
+/* One round; the caller rotates the variable names instead of moving values */
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i, x) \
+    do { \
+        uint32_t t1 = (h) + SHA256_SUM1(e) + SHA256_CH(e, f, g) + sha256K[i] + (x); \
+        (d) += t1; \
+        (h) = t1 + SHA256_SUM0(a) + SHA256_MAJ(a, b, c); \
+    } while (0)
+
+#define SHA256_ROUNDS8(i, word) \
+    SHA256_ROUND(a, b, c, d, e, f, g, h, (i) + 0U, word((i) + 0U)); \
+    SHA256_ROUND(h, a, b, c, d, e, f, g, (i) + 1U, word((i) + 1U)); \
+    SHA256_ROUND(g, h, a, b, c, d, e, f, (i) + 2U, word((i) + 2U)); \
+    SHA256_ROUND(f, g, h, a, b, c, d, e, (i) + 3U, word((i) + 3U)); \
+    SHA256_ROUND(e, f, g, h, a, b, c, d, (i) + 4U, word((i) + 4U)); \
+    SHA256_ROUND(d, e, f, g, h, a, b, c, (i) + 5U, word((i) + 5U)); \
+    SHA256_ROUND(c, d, e, f, g, h, a, b, (i) + 6U, word((i) + 6U)); \
+    SHA256_ROUND(b, c, d, e, f, g, h, a, (i) + 7U, word((i) + 7U))
+
+/*!
+ * @brief       SHA-256 compression of whole blocks.
+ *
+ * @param       state:   Chaining value, eight words
+ *
+ * @param       data:    Blocks, any alignment
+ *
+ * @param       blocks:  Number of 64-byte blocks
+ *
+ * @retval      None
+ *
+ * @note        All 64 rounds are unrolled; after eight rounds the names
+ *              are back in place, so no register moves are needed.
+ */
+SHA256_CODE void Sha256Blocks(uint32_t state[8], const uint8_t* data, uint32_t blocks)
+{
+    uint32_t w[16];
+    uint32_t a, b, c, d, e, f, g, h;
+
+    for (; blocks != 0U; blocks--, data += DIGEST_BLOCK_SIZE)
+    {
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+        f = state[5];
+        g = state[6];
+        h = state[7];
+
+        SHA256_ROUNDS8(0U, SHA256_LOAD);
+        SHA256_ROUNDS8(8U, SHA256_LOAD);
+        SHA256_ROUNDS8(16U, SHA256_SCHEDULE);
+        SHA256_ROUNDS8(24U, SHA256_SCHEDULE);
+        SHA256_ROUNDS8(32U, SHA256_SCHEDULE);
+        SHA256_ROUNDS8(40U, SHA256_SCHEDULE);
+        SHA256_ROUNDS8(48U, SHA256_SCHEDULE);
+        SHA256_ROUNDS8(56U, SHA256_SCHEDULE);
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+/*!
+ * @brief     Compute the SHA-256 digest
+ *
+ * @param     inBuffer: pointer to the input buffer to be treated
+ *
+ * @param     lenBuffer: length of the input buffer
+ *
+ * @param     outBuffer: the returned digest
+ *
+ * @retval    SUCCESS
+ */
+uint8_t Sha256Compute(uint8_t* inBuffer, uint32_t lenBuffer, uint8_t outBuffer[32])
+{
+    DigestCompute(DIGEST_SHA256, inBuffer, lenBuffer, outBuffer);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief     Compute the HMAC-SHA256 digest (RFC 2104)
+ *
+ * @param     key: pointer to the key used for HMAC
+ *
+ * @param     lenkey: length of the key; keys longer than 64 bytes are hashed first
+ *
+ * @param     inBuffer: pointer to the input buffer to be treated
+ *
+ * @param     lenBuffer: length of the input buffer
+ *
+ * @param     outBuffer: the returned digest
+ *
+ * @retval    SUCCESS
+ */
+uint8_t HmacSha256Compute(uint8_t* key, uint32_t lenkey, uint8_t* inBuffer,
+                          uint32_t lenBuffer, uint8_t outBuffer[32])
+{
+    DigestContext_T ctx;
+    uint8_t pad[HMAC_BLOCK_SIZE];
+    uint8_t inner[SHA256_DIGEST_SIZE];
+    uint32_t i;
+
+    memset(pad, 0, sizeof(pad));
+    if (lenkey > HMAC_BLOCK_SIZE)
+    {
+        DigestCompute(DIGEST_SHA256, key, lenkey, pad);
+    }
+    else
+    {
+        memcpy(pad, key, lenkey);
+    }
+
+    /* Inner hash over (K ^ ipad) || message */
+    for (i = 0; i < HMAC_BLOCK_SIZE; i++)
+    {
+        pad[i] ^= 0x36U;
+    }
+    DigestInit(&ctx, DIGEST_SHA256);
+    DigestUpdate(&ctx, pad, HMAC_BLOCK_SIZE);
+    DigestUpdate(&ctx, inBuffer, lenBuffer);
+    DigestFinal(&ctx, inner);
+
+    /* Outer hash over (K ^ opad) || inner */
+    for (i = 0; i < HMAC_BLOCK_SIZE; i++)
+    {
+        pad[i] ^= 0x36U ^ 0x5CU;
+    }
+    DigestInit(&ctx, DIGEST_SHA256);
+    DigestUpdate(&ctx, pad, HMAC_BLOCK_SIZE);
+    DigestUpdate(&ctx, inner, sizeof(inner));
+    DigestFinal(&ctx, outBuffer);
+
+    memset(pad, 0, sizeof(pad));
+
+    return SUCCESS;
+}
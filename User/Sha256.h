@@ -0,0 +1,40 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stdint.h>
+
+/*
+ * SHA-256 and HMAC-SHA256 for firmware signature checks, with the calling
+ * convention of the StdPeriph HASH_ComputeSHA1() / HMAC_ComputeSHA1().
+ * DigestInit(ctx, DIGEST_SHA256) hashes a message that arrives in pieces.
+ *
+ * The compression function is fully unrolled: the eight working variables
+ * rotate through macro arguments instead of being moved each round, the
+ * round constants become immediates, and the message schedule lives in a
+ * 16-word ring on the stack (in CCM with STACK_IN_CCM). The unrolled code
+ * is about 5 KiB, more than the flash accelerator caches; SHA256_FAST_CODE
+ * runs it from SRAM without wait states instead (CCM cannot hold code).
+ */
+
+/* Run the compression function from SRAM */
+#ifndef SHA256_FAST_CODE
+#define SHA256_FAST_CODE 0
+#endif
+
+#if SHA256_FAST_CODE
+#include "Section.h"
+#define SHA256_CODE FAST_CODE
+#else
+#define SHA256_CODE
+#endif
+
+#define SHA256_DIGEST_SIZE  32U
+
+/* Compression of whole 64-byte blocks, any alignment */
+SHA256_CODE void Sha256Blocks(uint32_t state[8], const uint8_t* data, uint32_t blocks);
+
+uint8_t Sha256Compute(uint8_t* inBuffer, uint32_t lenBuffer, uint8_t outBuffer[32]);
+uint8_t HmacSha256Compute(uint8_t* key, uint32_t lenkey, uint8_t* inBuffer,
+                          uint32_t lenBuffer, uint8_t outBuffer[32]);
+
+#endif // SHA256_H
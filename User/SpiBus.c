@@ -0,0 +1,565 @@
+#include <stddef.h>
+#include <string.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_gpio.h"
+#include "apm32f4xx_rcm.h"
+#include "apm32f4xx_spi.h"
+#include "Critical.h"
+#include "SpiBus.h"
+
+#define SPI_CTRL1_CPHA      (1UL << 0)
+#define SPI_CTRL1_CPOL      (1UL << 1)
+#define SPI_CTRL1_MSMCFG    (1UL << 2)
+#define SPI_CTRL1_BRSEL_POS 3U
+#define SPI_CTRL1_SPIEN     (1UL << 6)
+#define SPI_CTRL1_LSBSEL    (1UL << 7)
+#define SPI_CTRL1_ISSEL     (1UL << 8)
+#define SPI_CTRL1_SSEN      (1UL << 9)
+#define SPI_CTRL1_DFLSEL    (1UL << 11)
+
+/* Master with software NSS held high */
+#define SPI_CTRL1_MASTER    (SPI_CTRL1_MSMCFG | SPI_CTRL1_ISSEL | SPI_CTRL1_SSEN)
+
+#define SPI_CTRL2_RXDEN     (1UL << 0)
+#define SPI_CTRL2_TXDEN     (1UL << 1)
+
+#define SPI_STS_RXBNE       (1UL << 0)
+#define SPI_STS_BSY         (1UL << 7)
+
+/* No prescaler slows the clock down to the rate asked for */
+#define SPIBUS_PRESCALER_NONE 0xFFU
+
+/**
+ * @brief Pins and DMA requests of one SPI
+ */
+typedef struct
+{
+    SPI_T*          spi;
+    GPIO_T*         port;
+    uint32_t        gpioClock;      /*!< RCM_AHB1_PERIPH_GPIOx */
+    uint32_t        clock;          /*!< RCM_APB1/APB2_PERIPH_SPIx */
+    uint8_t         apb2;           /*!< Clocked from PCLK2 */
+    uint8_t         af;
+    uint8_t         sck;            /*!< GPIO_PIN_SOURCE_x */
+    uint8_t         miso;
+    uint8_t         mosi;
+    uint8_t         rxRequest;      /*!< DmaRequest_T */
+    uint8_t         txRequest;
+} SpiBusPort_T;
+
+static const SpiBusPort_T spiBusPorts[] =
+{
+    { SPI1, GPIOA, RCM_AHB1_PERIPH_GPIOA, RCM_APB2_PERIPH_SPI1, 1, GPIO_AF_SPI1,
+      GPIO_PIN_SOURCE_5, GPIO_PIN_SOURCE_6, GPIO_PIN_SOURCE_7, DMA_REQ_SPI1_RX, DMA_REQ_SPI1_TX },
+    { SPI2, GPIOB, RCM_AHB1_PERIPH_GPIOB, RCM_APB1_PERIPH_SPI2, 0, GPIO_AF_SPI2,
+      GPIO_PIN_SOURCE_13, GPIO_PIN_SOURCE_14, GPIO_PIN_SOURCE_15, DMA_REQ_SPI2_RX, DMA_REQ_SPI2_TX },
+    { SPI3, GPIOC, RCM_AHB1_PERIPH_GPIOC, RCM_APB1_PERIPH_SPI3, 0, GPIO_AF_SPI3,
+      GPIO_PIN_SOURCE_10, GPIO_PIN_SOURCE_11, GPIO_PIN_SOURCE_12, DMA_REQ_SPI3_RX, DMA_REQ_SPI3_TX },
+};
+
+#define SPIBUS_PORT_COUNT   (sizeof(spiBusPorts) / sizeof(spiBusPorts[0]))
+
+static void SpiBusStart(SpiBus_T* bus, SpiTransfer_T* transfer);
+
+/*!
+ * @brief       Baud rate prescaler for a clock limit.
+ *
+ * @param       pclk:     SPI kernel clock
+ *
+ * @param       maxBaud:  Highest acceptable SCK rate
+ *
+ * @retval      BRSEL value 0..7 (divide by 2 << BRSEL), or
+ *              SPIBUS_PRESCALER_NONE when even 256 is too fast
+ */
+static uint8_t SpiBusPrescaler(uint32_t pclk, uint32_t maxBaud)
+{
+    uint8_t div;
+
+    for (div = 0; div < 8U; div++)
+    {
+        if ((pclk >> (div + 1U)) <= maxBaud)
+        {
+            return div;
+        }
+    }
+
+    return SPIBUS_PRESCALER_NONE;
+}
+
+/*!
+ * @brief       Start the next transfer the bus may serve; interrupts masked.
+ *
+ * @param       bus:  Idle bus
+ *
+ * @retval      None
+ *
+ * @note        While a device holds the bus, only its transfers qualify;
+ *              the others wait in their order.
+ */
+static void SpiBusNext(SpiBus_T* bus)
+{
+    SpiTransfer_T* prev = NULL;
+    SpiTransfer_T* transfer = bus->head;
+
+    if (bus->holder != NULL)
+    {
+        while ((transfer != NULL) && (transfer->device != bus->holder))
+        {
+            prev = transfer;
+            transfer = transfer->next;
+        }
+    }
+    if (transfer == NULL)
+    {
+        return;
+    }
+
+    if (prev == NULL)
+    {
+        bus->head = transfer->next;
+    }
+    else
+    {
+        prev->next = transfer->next;
+    }
+    if (bus->tail == transfer)
+    {
+        bus->tail = prev;
+    }
+
+    bus->active = transfer;
+    SpiBusStart(bus, transfer);
+}
+
+/*!
+ * @brief       Both streams are done: release the chip select unless held,
+ *              start what comes next, then report.
+ *
+ * @param       bus:  Bus
+ *
+ * @retval      None
+ */
+static void SpiBusFinish(SpiBus_T* bus)
+{
+    SpiTransfer_T* transfer = bus->active;
+    SpiDevice_T* device = transfer->device;
+
+    bus->spi->CTRL2 &= ~(SPI_CTRL2_RXDEN | SPI_CTRL2_TXDEN);
+
+    if (((transfer->flags & SPI_XFER_HOLD_CS) != 0) && !bus->error)
+    {
+        bus->holder = device;
+    }
+    else
+    {
+        bus->holder = NULL;
+        if (device->csPort != NULL)
+        {
+            GPIO_SetBit(device->csPort, device->csPin);
+        }
+    }
+
+    if (bus->error)
+    {
+        transfer->status = SPI_STATUS_ERROR;
+        bus->errors++;
+    }
+    else
+    {
+        transfer->status = SPI_STATUS_DONE;
+    }
+    bus->transfers++;
+
+    bus->active = NULL;
+    SpiBusNext(bus);
+
+    if (transfer->done != NULL)
+    {
+        transfer->done(transfer);
+    }
+}
+
+/*!
+ * @brief       DMA callback of either stream.
+ *
+ * @param       transfer:  bus->rxDma or bus->txDma
+ *
+ * @param       event:     DMA_EVENT_DONE, or an error or abort
+ *
+ * @retval      None
+ *
+ * @note        The transfer ends when both streams have; after an error
+ *              the other stream is stopped, which reports ABORTED here.
+ */
+static void SpiBusDmaDone(DmaTransfer_T* transfer, DmaEvent_T event)
+{
+    SpiBus_T* bus = transfer->arg;
+
+    if (event != DMA_EVENT_DONE)
+    {
+        bus->error = 1;
+    }
+
+    bus->pending--;
+    if (bus->pending != 0)
+    {
+        if (bus->error)
+        {
+            DmaStop((transfer == &bus->rxDma) ? bus->txStream : bus->rxStream);
+        }
+        return;
+    }
+
+    SpiBusFinish(bus);
+}
+
+/*!
+ * @brief       Configure the SPI for a device and run a transfer as one
+ *              receive and one transmit DMA transfer; interrupts masked.
+ *
+ * @param       bus:       Idle bus
+ *
+ * @param       transfer:  Transfer, now bus->active
+ *
+ * @retval      None
+ */
+static void SpiBusStart(SpiBus_T* bus, SpiTransfer_T* transfer)
+{
+    SpiDevice_T* device = transfer->device;
+    SPI_T* spi = bus->spi;
+    uint8_t size = ((device->ctrl1 & SPI_CTRL1_DFLSEL) != 0) ? 2U : 1U;
+
+    /* Mode, rate and frame format only change with the SPI disabled */
+    if ((spi->CTRL1 & ~SPI_CTRL1_SPIEN) != device->ctrl1)
+    {
+        while ((spi->STS & SPI_STS_BSY) != 0)
+        {
+        }
+        spi->CTRL1 = device->ctrl1;
+    }
+    spi->CTRL1 = device->ctrl1 | SPI_CTRL1_SPIEN;
+
+    /* A frame left over from polled use would shift the data by one */
+    if ((spi->STS & SPI_STS_RXBNE) != 0)
+    {
+        (void)spi->DATA;
+    }
+
+    if ((device->csPort != NULL) && (bus->holder != device))
+    {
+        GPIO_ResetBit(device->csPort, device->csPin);
+    }
+
+    transfer->status = SPI_STATUS_ACTIVE;
+    bus->pending = 2;
+    bus->error = 0;
+
+    bus->rxDma.memory = (transfer->rx != NULL) ? (uint32_t)transfer->rx : (uint32_t)&bus->sink;
+    bus->rxDma.count = transfer->length;
+    bus->rxDma.size = size;
+    bus->rxDma.flags = (transfer->rx != NULL) ? 0U : DMA_XFER_MEM_FIXED;
+
+    bus->txDma.memory = (transfer->tx != NULL) ? (uint32_t)transfer->tx : (uint32_t)&bus->dummy;
+    bus->txDma.count = transfer->length;
+    bus->txDma.size = size;
+    bus->txDma.flags = (transfer->tx != NULL) ? 0U : DMA_XFER_MEM_FIXED;
+
+    /* Receive ready before the first frame goes out */
+    (void)DmaSubmit(bus->rxStream, &bus->rxDma);
+    spi->CTRL2 |= SPI_CTRL2_RXDEN;
+    (void)DmaSubmit(bus->txStream, &bus->txDma);
+    spi->CTRL2 |= SPI_CTRL2_TXDEN;
+}
+
+/*!
+ * @brief       Take over an SPI as bus master.
+ *
+ * @param       bus:  Bus state
+ *
+ * @param       spi:  SPI1, SPI2 or SPI3
+ *
+ * @retval      SUCCESS, or ERROR for another SPI or when its DMA streams
+ *              are taken
+ *
+ * @note        SCK, MISO and MOSI are PA5/PA6/PA7 (SPI1), PB13/PB14/PB15
+ *              (SPI2) or PC10/PC11/PC12 (SPI3). The receive stream gets
+ *              the higher DMA priority so it never falls behind.
+ */
+uint8_t SpiBusInit(SpiBus_T* bus, SPI_T* spi)
+{
+    const SpiBusPort_T* port = NULL;
+    GPIO_Config_T gpioConfig;
+    uint32_t pclk1, pclk2, i;
+
+    for (i = 0; i < SPIBUS_PORT_COUNT; i++)
+    {
+        if (spiBusPorts[i].spi == spi)
+        {
+            port = &spiBusPorts[i];
+        }
+    }
+    if (port == NULL)
+    {
+        return ERROR;
+    }
+
+    memset(bus, 0, sizeof(*bus));
+    bus->spi = spi;
+    bus->dummy = SPIBUS_DUMMY;
+
+    bus->rxStream = DmaClaim((DmaRequest_T)port->rxRequest, DMA_PRIORITY_VERYHIGH, SPIBUS_IRQ_PRIORITY);
+    bus->txStream = DmaClaim((DmaRequest_T)port->txRequest, DMA_PRIORITY_HIGH, SPIBUS_IRQ_PRIORITY);
+    if ((bus->rxStream == NULL) || (bus->txStream == NULL))
+    {
+        if (bus->rxStream != NULL)
+        {
+            DmaRelease(bus->rxStream);
+        }
+        if (bus->txStream != NULL)
+        {
+            DmaRelease(bus->txStream);
+        }
+        return ERROR;
+    }
+
+    bus->rxDma.peripheral = (uint32_t)&spi->DATA;
+    bus->rxDma.dir = DMA_DIR_PERIPHERALTOMEMORY;
+    bus->rxDma.done = SpiBusDmaDone;
+    bus->rxDma.arg = bus;
+    bus->txDma.peripheral = (uint32_t)&spi->DATA;
+    bus->txDma.dir = DMA_DIR_MEMORYTOPERIPHERAL;
+    bus->txDma.done = SpiBusDmaDone;
+    bus->txDma.arg = bus;
+
+    RCM_ReadPCLKFreq(&pclk1, &pclk2);
+    if (port->apb2)
+    {
+        RCM_EnableAPB2PeriphClock(port->clock);
+        bus->pclk = pclk2;
+    }
+    else
+    {
+        RCM_EnableAPB1PeriphClock(port->clock);
+        bus->pclk = pclk1;
+    }
+    RCM_EnableAHB1PeriphClock(port->gpioClock);
+
+    GPIO_ConfigPinAF(port->port, (GPIO_PIN_SOURCE_T)port->sck, (GPIO_AF_T)port->af);
+    GPIO_ConfigPinAF(port->port, (GPIO_PIN_SOURCE_T)port->miso, (GPIO_AF_T)port->af);
+    GPIO_ConfigPinAF(port->port, (GPIO_PIN_SOURCE_T)port->mosi, (GPIO_AF_T)port->af);
+
+    GPIO_ConfigStructInit(&gpioConfig);
+    gpioConfig.pin = (uint16_t)((1U << port->sck) | (1U << port->miso) | (1U << port->mosi));
+    gpioConfig.mode = GPIO_MODE_AF;
+    gpioConfig.speed = GPIO_SPEED_100MHz;
+    gpioConfig.otype = GPIO_OTYPE_PP;
+    gpioConfig.pupd = GPIO_PUPD_NOPULL;
+    GPIO_Config(port->port, &gpioConfig);
+
+    spi->CTRL2 = 0;
+    spi->CTRL1 = SPI_CTRL1_MASTER;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Give the SPI and its DMA streams back.
+ *
+ * @param       bus:  Bus from SpiBusInit()
+ *
+ * @retval      None
+ *
+ * @note        The running transfer and every queued one end with
+ *              SPI_STATUS_ERROR and get their callback.
+ */
+void SpiBusDeinit(SpiBus_T* bus)
+{
+    SpiTransfer_T* transfer;
+    SpiTransfer_T* next;
+
+    CRITICAL_ENTER();
+    transfer = bus->head;
+    bus->head = NULL;
+    bus->tail = NULL;
+    CRITICAL_EXIT();
+
+    /* Aborts the running transfer, nothing is left to follow it */
+    DmaRelease(bus->rxStream);
+    DmaRelease(bus->txStream);
+
+    for (; transfer != NULL; transfer = next)
+    {
+        next = transfer->next;
+        transfer->status = SPI_STATUS_ERROR;
+        if (transfer->done != NULL)
+        {
+            transfer->done(transfer);
+        }
+    }
+
+    if ((bus->holder != NULL) && (bus->holder->csPort != NULL))
+    {
+        GPIO_SetBit(bus->holder->csPort, bus->holder->csPin);
+    }
+    bus->holder = NULL;
+
+    bus->spi->CTRL2 = 0;
+    bus->spi->CTRL1 = 0;
+}
+
+/*!
+ * @brief       Whether a transfer is running or queued.
+ *
+ * @param       bus:  Bus
+ *
+ * @retval      1 or 0
+ */
+uint8_t SpiBusBusy(const SpiBus_T* bus)
+{
+    return (bus->active != NULL) || (bus->head != NULL);
+}
+
+/*!
+ * @brief       Describe a device on a bus.
+ *
+ * @param       device:   Device state
+ *
+ * @param       bus:      Bus from SpiBusInit()
+ *
+ * @param       csPort:   Chip select port, NULL when the device has none
+ *
+ * @param       csPin:    Chip select pin (GPIO_PIN_x), driven low to select
+ *
+ * @param       mode:     SPI mode 0..3: CPOL in bit 1, CPHA in bit 0
+ *
+ * @param       maxBaud:  Highest SCK rate the device takes
+ *
+ * @param       flags:    SPI_DEVICE_16BIT, SPI_DEVICE_LSB
+ *
+ * @retval      SUCCESS, or ERROR for a bad mode or a rate below PCLK/256;
+ *              device->baud holds the rate reached
+ *
+ * @note        The chip select pin becomes a push-pull output, high, and
+ *              its port clock is enabled.
+ */
+uint8_t SpiDeviceInit(SpiDevice_T* device, SpiBus_T* bus, GPIO_T* csPort, uint16_t csPin,
+                      uint8_t mode, uint32_t maxBaud, uint8_t flags)
+{
+    GPIO_Config_T gpioConfig;
+    uint8_t div = SpiBusPrescaler(bus->pclk, maxBaud);
+
+    if ((mode > 3U) || (div == SPIBUS_PRESCALER_NONE))
+    {
+        return ERROR;
+    }
+
+    device->bus = bus;
+    device->csPort = csPort;
+    device->csPin = csPin;
+    device->baud = bus->pclk >> (div + 1U);
+    device->ctrl1 = (uint16_t)(SPI_CTRL1_MASTER | ((uint32_t)div << SPI_CTRL1_BRSEL_POS) |
+                               (((mode & 2U) != 0) ? SPI_CTRL1_CPOL : 0U) |
+                               (((mode & 1U) != 0) ? SPI_CTRL1_CPHA : 0U) |
+                               (((flags & SPI_DEVICE_LSB) != 0) ? SPI_CTRL1_LSBSEL : 0U) |
+                               (((flags & SPI_DEVICE_16BIT) != 0) ? SPI_CTRL1_DFLSEL : 0U));
+
+    if (csPort != NULL)
+    {
+        /* GPIOA..GPIOI are 1 KiB apart, their clocks bits 0..8 */
+        RCM_EnableAHB1PeriphClock(1UL << (((uint32_t)csPort - GPIOA_BASE) / 0x400U));
+        GPIO_SetBit(csPort, csPin);
+
+        GPIO_ConfigStructInit(&gpioConfig);
+        gpioConfig.pin = csPin;
+        gpioConfig.mode = GPIO_MODE_OUT;
+        gpioConfig.speed = GPIO_SPEED_50MHz;
+        gpioConfig.otype = GPIO_OTYPE_PP;
+        gpioConfig.pupd = GPIO_PUPD_NOPULL;
+        GPIO_Config(csPort, &gpioConfig);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Queue a transfer on its device's bus.
+ *
+ * @param       transfer:  Filled in by the caller, untouched until its
+ *                         callback; buffers of length frames
+ *
+ * @retval      SUCCESS, or ERROR for a zero length
+ *
+ * @note        Starts at once on an idle bus. Callable from interrupts,
+ *              including the callbacks. Buffers cannot be in CCM RAM.
+ */
+uint8_t SpiSubmit(SpiTransfer_T* transfer)
+{
+    SpiBus_T* bus = transfer->device->bus;
+
+    if (transfer->length == 0)
+    {
+        return ERROR;
+    }
+
+    transfer->status = SPI_STATUS_QUEUED;
+    transfer->next = NULL;
+
+    CRITICAL_ENTER();
+    if (bus->head == NULL)
+    {
+        bus->head = transfer;
+    }
+    else
+    {
+        bus->tail->next = transfer;
+    }
+    bus->tail = transfer;
+
+    if (bus->active == NULL)
+    {
+        SpiBusNext(bus);
+    }
+    CRITICAL_EXIT();
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Run a transfer and wait for it.
+ *
+ * @param       device:  Device
+ *
+ * @param       tx:      Frames to send, NULL for dummy frames
+ *
+ * @param       rx:      Received frames, NULL to discard them
+ *
+ * @param       length:  Frames, 1..65535
+ *
+ * @retval      SUCCESS, or ERROR on a DMA error or when called from an
+ *              interrupt
+ */
+uint8_t SpiExchange(SpiDevice_T* device, const void* tx, void* rx, uint16_t length)
+{
+    SpiTransfer_T transfer;
+
+    if (CRITICAL_IN_ISR())
+    {
+        return ERROR;
+    }
+
+    memset(&transfer, 0, sizeof(transfer));
+    transfer.device = device;
+    transfer.tx = tx;
+    transfer.rx = rx;
+    transfer.length = length;
+    if (SpiSubmit(&transfer) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    while (transfer.status < SPI_STATUS_DONE)
+    {
+    }
+
+    return (transfer.status == SPI_STATUS_DONE) ? SUCCESS : ERROR;
+}
@@ -0,0 +1,129 @@
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#include <stdint.h>
+#include "apm32f4xx.h"
+#include "apm32f4xx_gpio.h"
+#include "Dma.h"
+
+/*
+ * SPI bus manager for SPI1, SPI2 and SPI3 as masters.
+ *
+ * A bus owns one SPI and a receive/transmit pair of DMA streams claimed
+ * from the DMA manager (Dma.h). Several devices share a bus, each with its
+ * own chip select pin, clock mode, frame size, bit order and clock rate;
+ * SpiDeviceInit() turns those into a CTRL1 image once, and the bus only
+ * rewrites CTRL1 when the next transfer is for a device with a different
+ * one. Every transfer is one full-duplex DMA pair: the receive stream is
+ * started first, then the transmit stream, then the SPI's DMA requests.
+ * With tx NULL the transmit stream repeats a dummy frame (SPIBUS_DUMMY);
+ * with rx NULL received frames land in one scratch word. Completion is
+ * the end of both streams, reported to the transfer's callback from the
+ * stream interrupt; the CPU never touches the data register.
+ *
+ * SpiSubmit() queues transfers from any device in arrival order. A
+ * transfer with SPI_XFER_HOLD_CS keeps its device selected afterwards and
+ * the bus serves only that device's transfers until one without the flag
+ * ends, so command and data phases stay in one chip select window.
+ */
+
+/* NVIC priority of the bus DMA streams */
+#ifndef SPIBUS_IRQ_PRIORITY
+#define SPIBUS_IRQ_PRIORITY 6
+#endif
+
+/* Frame sent while only receiving */
+#ifndef SPIBUS_DUMMY
+#define SPIBUS_DUMMY        0xFFFFU
+#endif
+
+/* Device flags */
+#define SPI_DEVICE_16BIT    0x01U   /*!< 16-bit frames, buffers of uint16_t */
+#define SPI_DEVICE_LSB      0x02U   /*!< LSB first */
+
+/* Transfer flags */
+#define SPI_XFER_HOLD_CS    0x01U   /*!< Leave the device selected, keep the bus */
+
+/**
+ * @brief Transfer status
+ */
+typedef enum
+{
+    SPI_STATUS_QUEUED,
+    SPI_STATUS_ACTIVE,
+    SPI_STATUS_DONE,
+    SPI_STATUS_ERROR            /*!< DMA error, or aborted by SpiBusDeinit() */
+} SpiStatus_T;
+
+typedef struct SpiBus SpiBus_T;
+typedef struct SpiDevice SpiDevice_T;
+typedef struct SpiTransfer SpiTransfer_T;
+
+/* Called from the stream interrupt when a transfer has ended */
+typedef void (*SpiCallback_T)(SpiTransfer_T* transfer);
+
+/**
+ * @brief Bus state; treat as opaque
+ */
+struct SpiBus
+{
+    SPI_T*          spi;
+    DmaStream_T*    rxStream;
+    DmaStream_T*    txStream;
+    DmaTransfer_T   rxDma;
+    DmaTransfer_T   txDma;
+    SpiTransfer_T*  active;         /*!< Running transfer */
+    SpiTransfer_T*  head;           /*!< Queued behind it */
+    SpiTransfer_T*  tail;
+    SpiDevice_T*    holder;         /*!< Device selected by SPI_XFER_HOLD_CS */
+    uint32_t        pclk;           /*!< SPI kernel clock */
+    uint16_t        dummy;          /*!< Transmitted with tx NULL */
+    uint16_t        sink;           /*!< Received with rx NULL */
+    uint8_t         pending;        /*!< Streams of the running transfer still busy */
+    uint8_t         error;
+    uint32_t        transfers;      /*!< Transfers completed */
+    uint32_t        errors;         /*!< Transfers ended in SPI_STATUS_ERROR */
+};
+
+/**
+ * @brief Device on a bus
+ */
+struct SpiDevice
+{
+    SpiBus_T*       bus;
+    GPIO_T*         csPort;         /*!< NULL: no chip select */
+    uint16_t        csPin;          /*!< GPIO_PIN_x, active low */
+    uint16_t        ctrl1;          /*!< CTRL1 image, SPI disabled */
+    uint32_t        baud;           /*!< Clock rate reached */
+};
+
+/**
+ * @brief One transfer; owned by the bus from SpiSubmit() until its callback
+ */
+struct SpiTransfer
+{
+    SpiDevice_T*    device;
+    const void*     tx;             /*!< NULL: dummy frames */
+    void*           rx;             /*!< NULL: discard */
+    uint16_t        length;         /*!< Frames, 1..65535 */
+    uint8_t         flags;          /*!< SPI_XFER_* */
+    volatile uint8_t status;        /*!< SpiStatus_T */
+    SpiCallback_T   done;           /*!< May be NULL */
+    void*           arg;            /*!< For the callback */
+    SpiTransfer_T*  next;           /*!< Queue link */
+};
+
+uint8_t SpiBusInit(SpiBus_T* bus, SPI_T* spi);
+void SpiBusDeinit(SpiBus_T* bus);
+uint8_t SpiBusBusy(const SpiBus_T* bus);
+
+/* mode 0..3 (CPOL << 1 | CPHA); the fastest rate up to maxBaud */
+uint8_t SpiDeviceInit(SpiDevice_T* device, SpiBus_T* bus, GPIO_T* csPort, uint16_t csPin,
+                      uint8_t mode, uint32_t maxBaud, uint8_t flags);
+
+uint8_t SpiSubmit(SpiTransfer_T* transfer);
+
+/* Submit and wait; not from interrupts */
+uint8_t SpiExchange(SpiDevice_T* device, const void* tx, void* rx, uint16_t length);
+
+#endif // SPI_BUS_H
@@ -0,0 +1,652 @@
+#include <stddef.h>
+#include <string.h>
+#include "Critical.h"
+#include "SpiNor.h"
+
+/* Operations */
+#define SPINOR_OP_NONE      0U
+#define SPINOR_OP_READ      1U
+#define SPINOR_OP_PROGRAM   2U
+#define SPINOR_OP_ERASE     3U
+
+/* SFDP */
+#define SPINOR_SFDP_SIGNATURE   0x50444653U     /* "SFDP" */
+#define SPINOR_SFDP_BASIC_ID    0xFF00U         /* JEDEC basic flash parameters */
+#define SPINOR_SFDP_HEADERS     8U              /* Parameter headers searched */
+#define SPINOR_SFDP_DWORDS      16U             /* Basic table DWORDs used */
+
+/* Largest command plus response of SpiNorCommandSync() */
+#define SPINOR_SYNC_MAX     (5U + 4U * SPINOR_SFDP_DWORDS)
+
+static void SpiNorNext(SpiNor_T* nor);
+
+/*!
+ * @brief       Run one command and wait, for probing.
+ *
+ * @param       nor:           Flash
+ *
+ * @param       header:        Command, address and dummy bytes
+ *
+ * @param       headerLength:  Their count
+ *
+ * @param       response:      Bytes clocked in after the header (may be NULL)
+ *
+ * @param       length:        Their count
+ *
+ * @retval      SUCCESS or ERROR
+ */
+static uint8_t SpiNorCommandSync(SpiNor_T* nor, const uint8_t* header, uint32_t headerLength,
+                                 uint8_t* response, uint32_t length)
+{
+    /* Static: DMA cannot reach CCM, where the stack may be */
+    static uint8_t tx[SPINOR_SYNC_MAX];
+    static uint8_t rx[SPINOR_SYNC_MAX];
+
+    if (headerLength + length > SPINOR_SYNC_MAX)
+    {
+        return ERROR;
+    }
+
+    memset(tx, 0xFF, headerLength + length);
+    memcpy(tx, header, headerLength);
+    if (SpiExchange(nor->device, tx, rx, (uint16_t)(headerLength + length)) != SUCCESS)
+    {
+        return ERROR;
+    }
+    if (response != NULL)
+    {
+        memcpy(response, &rx[headerLength], length);
+    }
+
+    return SUCCESS;
+}
+
+/* Little-endian DWORD of an SFDP table */
+static uint32_t SpiNorLoad32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*!
+ * @brief       Read SFDP bytes: 3-byte address and 8 dummy clocks whatever
+ *              the addressing mode.
+ *
+ * @param       nor:      Flash
+ *
+ * @param       address:  SFDP address
+ *
+ * @param       buffer:   Receives the bytes
+ *
+ * @param       length:   Up to 4 * SPINOR_SFDP_DWORDS
+ *
+ * @retval      SUCCESS or ERROR
+ */
+static uint8_t SpiNorReadSfdp(SpiNor_T* nor, uint32_t address, uint8_t* buffer, uint32_t length)
+{
+    uint8_t header[5];
+
+    header[0] = SPINOR_CMD_SFDP;
+    header[1] = (uint8_t)(address >> 16);
+    header[2] = (uint8_t)(address >> 8);
+    header[3] = (uint8_t)address;
+    header[4] = 0xFF;
+
+    return SpiNorCommandSync(nor, header, sizeof(header), buffer, length);
+}
+
+/*!
+ * @brief       Geometry and read modes from the JEDEC basic flash
+ *              parameter table.
+ *
+ * @param       nor:    Flash
+ *
+ * @param       dw:     Table DWORDs, dw[0] is the 1st DWORD
+ *
+ * @param       count:  DWORDs in the table, at least 9 (JESD216)
+ *
+ * @retval      SUCCESS, or ERROR for a table without a usable density
+ *              or erase command
+ *
+ * @note        The smallest erase type of DWORDs 8-9 is used, else the
+ *              4 KiB erase of DWORD 1. The page size is in DWORD 11 from
+ *              JESD216A on, 256 bytes before.
+ */
+static uint8_t SpiNorParseBasic(SpiNor_T* nor, const uint32_t* dw, uint32_t count)
+{
+    uint32_t i, type, exponent;
+
+    if (count < 9U)
+    {
+        return ERROR;
+    }
+
+    /* Density in bits: N - 1 below 2 Gbit, else 2^N */
+    if ((dw[1] & 0x80000000U) != 0)
+    {
+        exponent = dw[1] & 0x7FFFFFFFU;
+        if ((exponent < 16U) || (exponent > 34U))
+        {
+            return ERROR;
+        }
+        nor->size = 1UL << (exponent - 3U);
+    }
+    else
+    {
+        nor->size = (dw[1] >> 3) + 1U;
+    }
+
+    /* 3 or 4 address bytes: 4 beyond 16 MiB or when 3 are not supported */
+    nor->addressBytes = ((nor->size > 0x1000000U) || (((dw[0] >> 17) & 3U) == 2U)) ? 4U : 3U;
+
+    nor->eraseSize = 0;
+    for (i = 0; i < 4U; i++)
+    {
+        type = (dw[7U + i / 2U] >> (16U * (i & 1U))) & 0xFFFFU;
+        exponent = type & 0xFFU;
+        if ((exponent != 0) && ((nor->eraseSize == 0) || ((1UL << exponent) < nor->eraseSize)))
+        {
+            nor->eraseSize = 1UL << exponent;
+            nor->eraseOpcode = (uint8_t)(type >> 8);
+        }
+    }
+    if (nor->eraseSize == 0)
+    {
+        if ((dw[0] & 3U) != 1U)
+        {
+            return ERROR;
+        }
+        nor->eraseSize = 4096U;
+        nor->eraseOpcode = (uint8_t)(dw[0] >> 8);
+    }
+
+    nor->pageSize = (count >= 11U) ? (1UL << ((dw[10] >> 4) & 0xFU)) : 256U;
+
+    memset(&nor->read144, 0, sizeof(nor->read144));
+    memset(&nor->read114, 0, sizeof(nor->read114));
+    if ((dw[0] & (1UL << 21)) != 0)
+    {
+        nor->read144.opcode = (uint8_t)(dw[2] >> 8);
+        nor->read144.modeClocks = (uint8_t)((dw[2] >> 5) & 7U);
+        nor->read144.dummyClocks = (uint8_t)(dw[2] & 0x1FU);
+    }
+    if ((dw[0] & (1UL << 22)) != 0)
+    {
+        nor->read114.opcode = (uint8_t)(dw[2] >> 24);
+        nor->read114.modeClocks = (uint8_t)((dw[2] >> 21) & 7U);
+        nor->read114.dummyClocks = (uint8_t)((dw[2] >> 16) & 0x1FU);
+    }
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Find and parse the basic flash parameter table.
+ *
+ * @param       nor:  Flash
+ *
+ * @retval      SUCCESS, or ERROR without SFDP
+ */
+static uint8_t SpiNorProbeSfdp(SpiNor_T* nor)
+{
+    uint8_t buffer[4U * SPINOR_SFDP_DWORDS];
+    uint32_t dw[SPINOR_SFDP_DWORDS];
+    uint32_t headers, length, pointer, i;
+
+    if ((SpiNorReadSfdp(nor, 0, buffer, 8) != SUCCESS) || (SpiNorLoad32(buffer) != SPINOR_SFDP_SIGNATURE))
+    {
+        return ERROR;
+    }
+
+    headers = (uint32_t)buffer[6] + 1U;
+    for (i = 0; (i < headers) && (i < SPINOR_SFDP_HEADERS); i++)
+    {
+        if (SpiNorReadSfdp(nor, 8U + 8U * i, buffer, 8) != SUCCESS)
+        {
+            return ERROR;
+        }
+        if ((buffer[0] | ((uint32_t)buffer[7] << 8)) != SPINOR_SFDP_BASIC_ID)
+        {
+            continue;
+        }
+
+        length = (buffer[3] < SPINOR_SFDP_DWORDS) ? buffer[3] : SPINOR_SFDP_DWORDS;
+        pointer = buffer[4] | ((uint32_t)buffer[5] << 8) | ((uint32_t)buffer[6] << 16);
+        if (SpiNorReadSfdp(nor, pointer, buffer, 4U * length) != SUCCESS)
+        {
+            return ERROR;
+        }
+        for (i = 0; i < length; i++)
+        {
+            dw[i] = SpiNorLoad32(&buffer[4U * i]);
+        }
+
+        return SpiNorParseBasic(nor, dw, length);
+    }
+
+    return ERROR;
+}
+
+/* Opcode and address in nor->header; returns the length */
+static uint32_t SpiNorHeader(SpiNor_T* nor, uint8_t opcode, uint32_t address)
+{
+    uint32_t n = 0;
+
+    nor->header[n++] = opcode;
+    if (nor->addressBytes == 4U)
+    {
+        nor->header[n++] = (uint8_t)(address >> 24);
+    }
+    nor->header[n++] = (uint8_t)(address >> 16);
+    nor->header[n++] = (uint8_t)(address >> 8);
+    nor->header[n++] = (uint8_t)address;
+
+    return n;
+}
+
+/*!
+ * @brief       End the operation and report.
+ *
+ * @param       nor:     Flash
+ *
+ * @param       status:  SUCCESS or ERROR
+ *
+ * @retval      None
+ */
+static void SpiNorFinish(SpiNor_T* nor, uint8_t status)
+{
+    nor->busy = 0;
+    nor->result = status;
+    nor->op = SPINOR_OP_NONE;
+
+    if (nor->callback != NULL)
+    {
+        nor->callback(nor, status);
+    }
+}
+
+/* A step is done (and the flash no longer busy): the next one or the end */
+static void SpiNorAdvance(SpiNor_T* nor)
+{
+    nor->address += nor->chunk;
+    nor->remaining -= nor->chunk;
+    if (nor->rx != NULL)
+    {
+        nor->rx += nor->chunk;
+    }
+    if (nor->tx != NULL)
+    {
+        nor->tx += nor->chunk;
+    }
+
+    if (nor->remaining == 0)
+    {
+        SpiNorFinish(nor, SUCCESS);
+    }
+    else
+    {
+        SpiNorNext(nor);
+    }
+}
+
+/*!
+ * @brief       Bus callback of the last transfer of a step.
+ *
+ * @param       transfer:  nor->data or nor->command
+ *
+ * @retval      None
+ *
+ * @note        Reads go on at once; programs and erases wait for WIP.
+ */
+static void SpiNorStepDone(SpiTransfer_T* transfer)
+{
+    SpiNor_T* nor = transfer->arg;
+
+    if ((transfer->status != SPI_STATUS_DONE) || (nor->command.status != SPI_STATUS_DONE) ||
+        ((nor->op != SPINOR_OP_READ) && (nor->enable.status != SPI_STATUS_DONE)))
+    {
+        SpiNorFinish(nor, ERROR);
+        return;
+    }
+
+    if (nor->op == SPINOR_OP_READ)
+    {
+        SpiNorAdvance(nor);
+    }
+    else
+    {
+        nor->busy = 1;
+    }
+}
+
+/* Bus callback of a status register read from SpiNorPoll() */
+static void SpiNorStatusDone(SpiTransfer_T* transfer)
+{
+    SpiNor_T* nor = transfer->arg;
+
+    nor->polling = 0;
+    if (transfer->status != SPI_STATUS_DONE)
+    {
+        SpiNorFinish(nor, ERROR);
+    }
+    else if ((nor->statusRx[1] & SPINOR_STATUS_WIP) != 0)
+    {
+        nor->polls++;
+    }
+    else
+    {
+        nor->busy = 0;
+        SpiNorAdvance(nor);
+    }
+}
+
+/*!
+ * @brief       Queue the transfers of the next step of the operation.
+ *
+ * @param       nor:  Flash with an operation in progress
+ *
+ * @retval      None
+ *
+ * @note        Read: FAST READ header holding the chip select, then the
+ *              data. Program: WRITE ENABLE, PAGE PROGRAM header holding
+ *              the chip select, then up to the end of the page. Erase:
+ *              WRITE ENABLE, then the erase command.
+ */
+static void SpiNorNext(SpiNor_T* nor)
+{
+    uint32_t n;
+
+    switch (nor->op)
+    {
+        case SPINOR_OP_READ:
+            nor->chunk = (nor->remaining < SPINOR_READ_CHUNK) ? nor->remaining : SPINOR_READ_CHUNK;
+            n = SpiNorHeader(nor, SPINOR_CMD_FAST_READ, nor->address);
+            nor->header[n++] = 0xFF;
+            nor->command.length = (uint16_t)n;
+            nor->command.flags = SPI_XFER_HOLD_CS;
+            nor->command.done = NULL;
+            nor->data.tx = NULL;
+            nor->data.rx = nor->rx;
+            nor->data.length = (uint16_t)nor->chunk;
+            (void)SpiSubmit(&nor->command);
+            (void)SpiSubmit(&nor->data);
+            break;
+
+        case SPINOR_OP_PROGRAM:
+            nor->chunk = nor->pageSize - (nor->address & (nor->pageSize - 1U));
+            if (nor->chunk > nor->remaining)
+            {
+                nor->chunk = nor->remaining;
+            }
+            nor->command.length = (uint16_t)SpiNorHeader(nor, SPINOR_CMD_PP, nor->address);
+            nor->command.flags = SPI_XFER_HOLD_CS;
+            nor->command.done = NULL;
+            nor->data.tx = nor->tx;
+            nor->data.rx = NULL;
+            nor->data.length = (uint16_t)nor->chunk;
+            (void)SpiSubmit(&nor->enable);
+            (void)SpiSubmit(&nor->command);
+            (void)SpiSubmit(&nor->data);
+            break;
+
+        default:
+            nor->chunk = nor->eraseSize;
+            nor->command.length = (uint16_t)SpiNorHeader(nor, nor->eraseOpcode, nor->address);
+            nor->command.flags = 0;
+            nor->command.done = SpiNorStepDone;
+            (void)SpiSubmit(&nor->enable);
+            (void)SpiSubmit(&nor->command);
+            break;
+    }
+}
+
+/*!
+ * @brief       Identify the flash and set up its transfers.
+ *
+ * @param       nor:     Flash state; must stay valid, transfers run from it
+ *
+ * @param       device:  Bus device of the flash, mode 0 or 3, 8-bit frames
+ *
+ * @retval      SUCCESS, or ERROR when nothing answers or the geometry is
+ *              unknown
+ */
+uint8_t SpiNorInit(SpiNor_T* nor, SpiDevice_T* device)
+{
+    static const uint8_t rdid = SPINOR_CMD_RDID;
+    static const uint8_t en4b = SPINOR_CMD_EN4B;
+    uint8_t id[3];
+
+    memset(nor, 0, sizeof(*nor));
+    nor->device = device;
+
+    if (SpiNorCommandSync(nor, &rdid, 1, id, sizeof(id)) != SUCCESS)
+    {
+        return ERROR;
+    }
+    nor->jedecId = ((uint32_t)id[0] << 16) | ((uint32_t)id[1] << 8) | id[2];
+    if ((nor->jedecId == 0) || (nor->jedecId == 0xFFFFFFU))
+    {
+        return ERROR;
+    }
+
+    if (SpiNorProbeSfdp(nor) == SUCCESS)
+    {
+        nor->sfdp = 1;
+    }
+    else
+    {
+        /* Capacity byte of the ID: 2^n bytes on most parts */
+        if ((id[2] < 16U) || (id[2] > 31U))
+        {
+            return ERROR;
+        }
+        nor->size = 1UL << id[2];
+        nor->addressBytes = (nor->size > 0x1000000U) ? 4U : 3U;
+        nor->pageSize = 256U;
+        nor->eraseSize = 4096U;
+        nor->eraseOpcode = SPINOR_CMD_SE;
+    }
+
+    if ((nor->addressBytes == 4U) && (SpiNorCommandSync(nor, &en4b, 1, NULL, 0) != SUCCESS))
+    {
+        return ERROR;
+    }
+
+    nor->wren = SPINOR_CMD_WREN;
+    nor->enable.device = device;
+    nor->enable.tx = &nor->wren;
+    nor->enable.length = 1;
+
+    nor->command.device = device;
+    nor->command.tx = nor->header;
+    nor->command.arg = nor;
+
+    nor->data.device = device;
+    nor->data.done = SpiNorStepDone;
+    nor->data.arg = nor;
+
+    nor->statusTx[0] = SPINOR_CMD_RDSR;
+    nor->statusTx[1] = 0xFF;
+    nor->status.device = device;
+    nor->status.tx = nor->statusTx;
+    nor->status.rx = nor->statusRx;
+    nor->status.length = 2;
+    nor->status.done = SpiNorStatusDone;
+    nor->status.arg = nor;
+
+    return SUCCESS;
+}
+
+/* Claim the flash for an operation over [address, address + length) */
+static uint8_t SpiNorBegin(SpiNor_T* nor, uint8_t op, uint32_t address, uint32_t length,
+                           SpiNorCallback_T callback, void* arg)
+{
+    uint8_t ok;
+
+    if ((length == 0) || (address >= nor->size) || (length > nor->size - address))
+    {
+        return ERROR;
+    }
+
+    CRITICAL_ENTER();
+    ok = (nor->op == SPINOR_OP_NONE);
+    if (ok)
+    {
+        nor->op = op;
+    }
+    CRITICAL_EXIT();
+    if (!ok)
+    {
+        return ERROR;
+    }
+
+    nor->address = address;
+    nor->remaining = length;
+    nor->rx = NULL;
+    nor->tx = NULL;
+    nor->busy = 0;
+    nor->result = SUCCESS;
+    nor->callback = callback;
+    nor->arg = arg;
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Read into memory by DMA.
+ *
+ * @param       nor:       Flash from SpiNorInit()
+ *
+ * @param       address:   Flash address
+ *
+ * @param       buffer:    Destination, not in CCM RAM
+ *
+ * @param       length:    Bytes
+ *
+ * @param       callback:  Called at the end (may be NULL)
+ *
+ * @param       arg:       For the callback, in nor->arg
+ *
+ * @retval      SUCCESS when started, ERROR when busy or out of range
+ */
+uint8_t SpiNorRead(SpiNor_T* nor, uint32_t address, void* buffer, uint32_t length,
+                   SpiNorCallback_T callback, void* arg)
+{
+    if (SpiNorBegin(nor, SPINOR_OP_READ, address, length, callback, arg) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    nor->rx = buffer;
+    SpiNorNext(nor);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Program bytes, page by page.
+ *
+ * @param       nor:       Flash from SpiNorInit()
+ *
+ * @param       address:   Flash address, any alignment
+ *
+ * @param       data:      Source, not in CCM RAM, untouched until the end
+ *
+ * @param       length:    Bytes
+ *
+ * @param       callback:  Called at the end (may be NULL)
+ *
+ * @param       arg:       For the callback, in nor->arg
+ *
+ * @retval      SUCCESS when started, ERROR when busy or out of range
+ *
+ * @note        Programming only clears bits; erase first. Needs
+ *              SpiNorPoll() calls to get past each page.
+ */
+uint8_t SpiNorProgram(SpiNor_T* nor, uint32_t address, const void* data, uint32_t length,
+                      SpiNorCallback_T callback, void* arg)
+{
+    if (SpiNorBegin(nor, SPINOR_OP_PROGRAM, address, length, callback, arg) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    nor->tx = data;
+    SpiNorNext(nor);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Erase whole erase blocks.
+ *
+ * @param       nor:       Flash from SpiNorInit()
+ *
+ * @param       address:   Multiple of nor->eraseSize
+ *
+ * @param       length:    Multiple of nor->eraseSize
+ *
+ * @param       callback:  Called at the end (may be NULL)
+ *
+ * @param       arg:       For the callback, in nor->arg
+ *
+ * @retval      SUCCESS when started, ERROR when busy, misaligned or out
+ *              of range
+ *
+ * @note        Needs SpiNorPoll() calls to get past each block.
+ */
+uint8_t SpiNorErase(SpiNor_T* nor, uint32_t address, uint32_t length,
+                    SpiNorCallback_T callback, void* arg)
+{
+    if (((address | length) & (nor->eraseSize - 1U)) != 0)
+    {
+        return ERROR;
+    }
+    if (SpiNorBegin(nor, SPINOR_OP_ERASE, address, length, callback, arg) != SUCCESS)
+    {
+        return ERROR;
+    }
+
+    SpiNorNext(nor);
+
+    return SUCCESS;
+}
+
+/*!
+ * @brief       Check on a busy flash; call from the main loop.
+ *
+ * @param       nor:  Flash
+ *
+ * @retval      1 while an operation runs, 0 when idle
+ *
+ * @note        Queues one status register read while the flash is busy
+ *              and none is on the bus yet.
+ */
+uint8_t SpiNorPoll(SpiNor_T* nor)
+{
+    if (nor->busy && !nor->polling)
+    {
+        nor->polling = 1;
+        if (SpiSubmit(&nor->status) != SUCCESS)
+        {
+            nor->polling = 0;
+        }
+    }
+
+    return nor->op != SPINOR_OP_NONE;
+}
+
+/*!
+ * @brief       Poll until the running operation ends.
+ *
+ * @param       nor:  Flash
+ *
+ * @retval      Result of the operation: SUCCESS or ERROR
+ */
+uint8_t SpiNorWait(SpiNor_T* nor)
+{
+    while (SpiNorPoll(nor))
+    {
+    }
+
+    return nor->result;
+}
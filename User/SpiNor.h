@@ -0,0 +1,121 @@
+#ifndef SPI_NOR_H
+#define SPI_NOR_H
+
+#include <stdint.h>
+#include "SpiBus.h"
+
+/*
+ * Serial NOR flash (25-series command set) on an SPI bus device.
+ *
+ * SpiNorInit() reads the JEDEC ID and probes the JESD216 SFDP tables for
+ * the density, page size, smallest erase block and the multi-I/O read
+ * commands; parts without SFDP fall back to the density byte of the ID,
+ * 256-byte pages and 4 KiB erase. Parts over 16 MiB are switched to
+ * 4-byte addresses.
+ *
+ * Reads, programs and erases run asynchronously on the bus: a read is a
+ * FAST READ command followed by one DMA receive straight into the
+ * caller's buffer under the same chip select (SPI_XFER_HOLD_CS), so the
+ * CPU copies nothing. Programs are split at page boundaries, each page a
+ * WRITE ENABLE, PAGE PROGRAM command and DMA transmit. While a page or
+ * block is busy in the flash, SpiNorPoll(), called from the main loop,
+ * reads the status register one transfer at a time, leaving the bus to
+ * other devices in between, and moves on when WIP clears. The callback
+ * reports the end of each operation.
+ *
+ * The APM32F407 has no quad SPI controller and no memory-mapped serial
+ * flash interface, so reads use one data line and there is no XIP; the
+ * 1-1-4 and 1-4-4 read commands found in SFDP are kept in read114 and
+ * read144 for a controller that has the lines.
+ */
+
+/* Largest chunk per read command; more are issued for longer reads */
+#ifndef SPINOR_READ_CHUNK
+#define SPINOR_READ_CHUNK   0x8000U
+#endif
+
+/* Commands */
+#define SPINOR_CMD_PP           0x02U
+#define SPINOR_CMD_RDSR         0x05U
+#define SPINOR_CMD_WREN         0x06U
+#define SPINOR_CMD_FAST_READ    0x0BU
+#define SPINOR_CMD_SE           0x20U
+#define SPINOR_CMD_SFDP         0x5AU
+#define SPINOR_CMD_RDID         0x9FU
+#define SPINOR_CMD_EN4B         0xB7U
+
+#define SPINOR_STATUS_WIP       0x01U
+
+typedef struct SpiNor SpiNor_T;
+
+/* SUCCESS or ERROR at the end of an operation; from the stream interrupt
+   or SpiNorPoll() */
+typedef void (*SpiNorCallback_T)(SpiNor_T* nor, uint8_t status);
+
+/**
+ * @brief Fast read command of a multi-I/O mode, from SFDP
+ */
+typedef struct
+{
+    uint8_t opcode;             /*!< 0: not supported */
+    uint8_t modeClocks;
+    uint8_t dummyClocks;
+} SpiNorRead_T;
+
+/**
+ * @brief Flash state; geometry filled in by SpiNorInit()
+ */
+struct SpiNor
+{
+    SpiDevice_T*        device;
+    uint32_t            jedecId;        /*!< Manufacturer, type, capacity from MSB */
+    uint32_t            size;           /*!< Bytes */
+    uint32_t            pageSize;
+    uint32_t            eraseSize;      /*!< Smallest erase block */
+    uint8_t             eraseOpcode;
+    uint8_t             addressBytes;   /*!< 3 or 4 */
+    uint8_t             sfdp;           /*!< Geometry from SFDP */
+    SpiNorRead_T        read114;        /*!< 1-1-4 fast read */
+    SpiNorRead_T        read144;        /*!< 1-4-4 fast read */
+
+    /* Operation in progress */
+    volatile uint8_t    op;
+    volatile uint8_t    busy;           /*!< Waiting for WIP to clear */
+    volatile uint8_t    polling;        /*!< Status read on the bus */
+    uint8_t             result;         /*!< SUCCESS or ERROR of the last operation */
+    uint32_t            address;
+    uint32_t            remaining;
+    uint32_t            chunk;
+    uint8_t*            rx;
+    const uint8_t*      tx;
+    SpiNorCallback_T    callback;
+    void*               arg;            /*!< For the callback */
+    uint32_t            polls;          /*!< Status reads that found the flash busy */
+
+    SpiTransfer_T       enable;
+    SpiTransfer_T       command;
+    SpiTransfer_T       data;
+    SpiTransfer_T       status;
+    uint8_t             wren;
+    uint8_t             header[6];
+    uint8_t             statusTx[2];
+    uint8_t             statusRx[2];
+};
+
+uint8_t SpiNorInit(SpiNor_T* nor, SpiDevice_T* device);
+
+/* Asynchronous; ERROR when another operation runs or the range is bad */
+uint8_t SpiNorRead(SpiNor_T* nor, uint32_t address, void* buffer, uint32_t length,
+                   SpiNorCallback_T callback, void* arg);
+uint8_t SpiNorProgram(SpiNor_T* nor, uint32_t address, const void* data, uint32_t length,
+                      SpiNorCallback_T callback, void* arg);
+uint8_t SpiNorErase(SpiNor_T* nor, uint32_t address, uint32_t length,
+                    SpiNorCallback_T callback, void* arg);
+
+/* From the main loop: advances busy waits; 1 while an operation runs */
+uint8_t SpiNorPoll(SpiNor_T* nor);
+
+/* Poll until the operation ends; its result */
+uint8_t SpiNorWait(SpiNor_T* nor);
+
+#endif // SPI_NOR_H
@@ -0,0 +1,885 @@
+#include <string.h>
+#include "apm32f4xx_conf.h"
+#include "apm32f4xx_eth.h"
+#include "Udp.h"
+#include "Net.h"
+#include "Critical.h"
+
+#if ETHBUF_ENABLE
+
+/* Frame offsets */
+#define ETH_DST             0U
+#define ETH_SRC             6U
+#define ETH_TYPE            12U
+#define ETH_HDR_LEN         14U
+#define IP_VER_IHL          (ETH_HDR_LEN + 0U)
+#define IP_TOTAL_LEN        (ETH_HDR_LEN + 2U)
+#define IP_ID               (ETH_HDR_LEN + 4U)
+#define IP_FRAG             (ETH_HDR_LEN + 6U)
+#define IP_TTL              (ETH_HDR_LEN + 8U)
+#define IP_PROTO            (ETH_HDR_LEN + 9U)
+#define IP_CSUM             (ETH_HDR_LEN + 10U)
+#define IP_SRC              (ETH_HDR_LEN + 12U)
+#define IP_DST              (ETH_HDR_LEN + 16U)
+#define IP_HDR_LEN          20U
+#define UDP_HDR_LEN         8U
+#define ARP_OPER            (ETH_HDR_LEN + 6U)
+#define ARP_SHA             (ETH_HDR_LEN + 8U)
+#define ARP_SPA             (ETH_HDR_LEN + 14U)
+#define ARP_THA             (ETH_HDR_LEN + 18U)
+#define ARP_TPA             (ETH_HDR_LEN + 24U)
+#define ARP_FRAME_LEN       (ETH_HDR_LEN + 28U)
+
+#define ETHTYPE_IPV4        0x0800U
+#define ETHTYPE_ARP         0x0806U
+#define IP_PROTO_UDP        17U
+#define IP_FRAG_DF          0x4000U
+#define IP_FRAG_MF_OFFSET   0x3FFFU
+#define IP_TTL_DEFAULT      64U
+#define ARP_REQUEST         1U
+#define ARP_REPLY           2U
+
+#define IP_BROADCAST        0xFFFFFFFFU
+/* First octet 224..239 (the first octet is the low byte) */
+#define IP_IS_MULTICAST(ip) (((ip) & 0xF0U) == 0xE0U)
+
+#define ARP_FREE            0U
+#define ARP_PENDING         1U
+#define ARP_VALID           2U
+
+/**
+ * @brief ARP cache entry
+ */
+typedef struct
+{
+    uint32_t ip;                /*!< Protocol address */
+    uint8_t  mac[6];            /*!< Hardware address (ARP_VALID) */
+    uint8_t  state;             /*!< ARP_FREE, ARP_PENDING or ARP_VALID */
+    uint8_t  retry;             /*!< Sends left until the next request (ARP_PENDING) */
+    uint32_t used;              /*!< Last use, for LRU replacement */
+} UdpArpEntry_T;
+
+/**
+ * @brief Bound port
+ */
+typedef struct
+{
+    uint16_t          port;     /*!< Local port (0: free) */
+    UdpRecvCallback_T callback; /*!< Receive handler */
+} UdpSocket_T;
+
+static const uint8_t macBroadcast[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+static UdpConfig_T netConfig;
+static UdpArpEntry_T arpCache[UDP_ARP_ENTRIES];
+static uint32_t arpClock;
+static uint32_t arpLast;        /* Index of the last hit */
+static UdpSocket_T sockets[UDP_SOCKETS];
+static uint16_t ipId;
+static UdpStats_T udpStats;
+
+static uint32_t UdpLoadIp(const uint8_t* p)
+{
+    uint32_t ip;
+
+    memcpy(&ip, p, sizeof(ip));
+
+    return ip;
+}
+
+/*!
+ * @brief       Find the cache entry for an address.
+ *
+ * @param       ip:  Address
+ *
+ * @retval      Entry, NULL if not cached
+ *
+ * @note        Called with interrupts masked.
+ */
+static UdpArpEntry_T* UdpArpFind(uint32_t ip)
+{
+    uint32_t i;
+
+    if ((arpCache[arpLast].state != ARP_FREE) && (arpCache[arpLast].ip == ip))
+    {
+        return &arpCache[arpLast];
+    }
+
+    for (i = 0; i < UDP_ARP_ENTRIES; i++)
+    {
+        if ((arpCache[i].state != ARP_FREE) && (arpCache[i].ip == ip))
+        {
+            arpLast = i;
+            return &arpCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief       Claim a cache entry for an address: a free one, else the
+ *              least recently used.
+ *
+ * @param       ip:  Address
+ *
+ * @retval      Entry, state ARP_FREE
+ *
+ * @note        Called with interrupts masked.
+ */
+static UdpArpEntry_T* UdpArpClaim(uint32_t ip)
+{
+    UdpArpEntry_T* entry = &arpCache[0];
+    uint32_t i;
+
+    for (i = 0; i < UDP_ARP_ENTRIES; i++)
+    {
+        if (arpCache[i].state == ARP_FREE)
+        {
+            entry = &arpCache[i];
+            break;
+        }
+        if ((arpClock - arpCache[i].used) > (arpClock - entry->used))
+        {
+            entry = &arpCache[i];
+        }
+    }
+
+    entry->ip = ip;
+    entry->state = ARP_FREE;
+    entry->used = arpClock;
+
+    return entry;
+}
+
+/* Record ip -> mac, creating the entry only when asked to */
+static void UdpArpUpdate(uint32_t ip, const uint8_t* mac, uint8_t create)
+{
+    UdpArpEntry_T* entry;
+
+    CRITICAL_ENTER();
+    entry = UdpArpFind(ip);
+    if ((entry == NULL) && create)
+    {
+        entry = UdpArpClaim(ip);
+    }
+    if (entry != NULL)
+    {
+        memcpy(entry->mac, mac, NET_MAC_LEN);
+        entry->state = ARP_VALID;
+        entry->used = ++arpClock;
+    }
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Send an ARP request or reply.
+ *
+ * @param       oper:     ARP_REQUEST or ARP_REPLY
+ *
+ * @param       ethDst:   Frame destination
+ *
+ * @param       tha:      Target hardware address
+ *
+ * @param       tpa:      Target protocol address
+ *
+ * @retval      None
+ */
+static void UdpArpSend(uint16_t oper, const uint8_t* ethDst, const uint8_t* tha, uint32_t tpa)
+{
+    static const uint8_t arpHeader[6] = { 0x00, 0x01, 0x08, 0x00, 0x06, 0x04 };
+    EthBuf_T* buf = EthBufAlloc(ARP_FRAME_LEN);
+    uint8_t* p;
+
+    if (buf == NULL)
+    {
+        return;
+    }
+
+    p = buf->payload;
+    memcpy(&p[ETH_DST], ethDst, NET_MAC_LEN);
+    memcpy(&p[ETH_SRC], netConfig.mac, NET_MAC_LEN);
+    NetWrite16(&p[ETH_TYPE], ETHTYPE_ARP);
+    memcpy(&p[ETH_HDR_LEN], arpHeader, sizeof(arpHeader));
+    NetWrite16(&p[ARP_OPER], oper);
+    memcpy(&p[ARP_SHA], netConfig.mac, NET_MAC_LEN);
+    memcpy(&p[ARP_SPA], &netConfig.ip, 4);
+    memcpy(&p[ARP_THA], tha, NET_MAC_LEN);
+    memcpy(&p[ARP_TPA], &tpa, 4);
+
+    if (EthBufTransmit(buf) != ETH_SUCCESS)
+    {
+        EthBufFree(buf);
+        return;
+    }
+
+    if (oper == ARP_REQUEST)
+    {
+        udpStats.arpRequests++;
+    }
+    else
+    {
+        udpStats.arpReplies++;
+    }
+}
+
+/*!
+ * @brief       Destination MAC address for an IPv4 destination.
+ *
+ * @param       dstIp:  Destination
+ *
+ * @param       mac:    Filled with the address
+ *
+ * @retval      UDP_OK, UDP_ERR_ARP while the next hop is being resolved,
+ *              UDP_ERR_PARAM when there is no route
+ */
+static UdpStatus_T UdpResolve(uint32_t dstIp, uint8_t* mac)
+{
+    static const uint8_t macZero[6] = { 0 };
+    UdpArpEntry_T* entry;
+    uint32_t nextHop = dstIp;
+    uint8_t request = 0;
+    UdpStatus_T status = UDP_OK;
+
+    if ((dstIp == IP_BROADCAST) || (dstIp == (netConfig.ip | ~netConfig.netmask)))
+    {
+        memcpy(mac, macBroadcast, NET_MAC_LEN);
+        return UDP_OK;
+    }
+    if (IP_IS_MULTICAST(dstIp))
+    {
+        /* 01:00:5e + low 23 bits of the group */
+        mac[0] = 0x01;
+        mac[1] = 0x00;
+        mac[2] = 0x5E;
+        mac[3] = (uint8_t)((dstIp >> 8) & 0x7FU);
+        mac[4] = (uint8_t)(dstIp >> 16);
+        mac[5] = (uint8_t)(dstIp >> 24);
+        return UDP_OK;
+    }
+    if (((dstIp ^ netConfig.ip) & netConfig.netmask) != 0)
+    {
+        if (netConfig.gateway == 0)
+        {
+            return UDP_ERR_PARAM;
+        }
+        nextHop = netConfig.gateway;
+    }
+
+    CRITICAL_ENTER();
+    entry = UdpArpFind(nextHop);
+    if ((entry != NULL) && (entry->state == ARP_VALID))
+    {
+        memcpy(mac, entry->mac, NET_MAC_LEN);
+        entry->used = ++arpClock;
+    }
+    else
+    {
+        if (entry == NULL)
+        {
+            entry = UdpArpClaim(nextHop);
+            entry->state = ARP_PENDING;
+            entry->retry = 0;
+        }
+        /* Rate-limit requests while the address stays unresolved */
+        if (entry->retry == 0)
+        {
+            entry->retry = UDP_ARP_RETRY;
+            request = 1;
+        }
+        entry->retry--;
+        status = UDP_ERR_ARP;
+    }
+    CRITICAL_EXIT();
+
+    if (request)
+    {
+        UdpArpSend(ARP_REQUEST, macBroadcast, macZero, nextHop);
+    }
+
+    return status;
+}
+
+/*!
+ * @brief       Add a buffer chain to a checksum, segments of any length.
+ *
+ * @param       sum:  Partial sum
+ *
+ * @param       buf:  Chain
+ *
+ * @param       len:  Bytes to add
+ *
+ * @retval      Partial sum
+ */
+static uint32_t UdpChecksumChain(uint32_t sum, const EthBuf_T* buf, uint32_t len)
+{
+    uint32_t part, n;
+    uint8_t odd = 0;
+
+    for (; (buf != NULL) && (len != 0); buf = buf->next)
+    {
+        n = (buf->len < len) ? buf->len : len;
+        part = NetChecksumAdd(0, buf->payload, n);
+        if (odd)
+        {
+            /* A segment starting at an odd offset sums byte-swapped */
+            part = ((part & 0xFFU) << 8) | (part >> 8);
+        }
+        sum += part;
+        odd ^= (uint8_t)(n & 1U);
+        len -= n;
+    }
+
+    return sum;
+}
+
+/* Pseudo-header part of the UDP checksum, memory byte order */
+static uint32_t UdpPseudoSum(uint32_t srcIp, uint32_t dstIp, uint16_t udpLen)
+{
+    return (srcIp & 0xFFFFU) + (srcIp >> 16) + (dstIp & 0xFFFFU) + (dstIp >> 16) +
+           NET_HTONS(IP_PROTO_UDP) + NET_HTONS(udpLen);
+}
+
+/*!
+ * @brief       Write the Ethernet, IPv4 and UDP headers.
+ *
+ * @param       p:        UDP_HEADER_LEN bytes
+ *
+ * @param       mac:      Destination MAC
+ *
+ * @param       dstIp:    Destination address
+ *
+ * @param       dstPort:  Destination port
+ *
+ * @param       srcPort:  Source port
+ *
+ * @param       dataLen:  UDP payload bytes
+ *
+ * @retval      None
+ *
+ * @note        Checksum fields are left zero for the MAC to fill in.
+ */
+static void UdpBuildHeaders(uint8_t* p, const uint8_t* mac, uint32_t dstIp, uint16_t dstPort,
+                            uint16_t srcPort, uint16_t dataLen)
+{
+    uint16_t id;
+
+    CRITICAL_ENTER();
+    id = ipId++;
+    CRITICAL_EXIT();
+
+    memcpy(&p[ETH_DST], mac, NET_MAC_LEN);
+    memcpy(&p[ETH_SRC], netConfig.mac, NET_MAC_LEN);
+    NetWrite16(&p[ETH_TYPE], ETHTYPE_IPV4);
+
+    p[IP_VER_IHL] = 0x45;
+    p[IP_VER_IHL + 1U] = 0;
+    NetWrite16(&p[IP_TOTAL_LEN], (uint16_t)(IP_HDR_LEN + UDP_HDR_LEN + dataLen));
+    NetWrite16(&p[IP_ID], id);
+    NetWrite16(&p[IP_FRAG], IP_FRAG_DF);
+    p[IP_TTL] = IP_TTL_DEFAULT;
+    p[IP_PROTO] = IP_PROTO_UDP;
+    NetWrite16(&p[IP_CSUM], 0);
+    memcpy(&p[IP_SRC], &netConfig.ip, 4);
+    memcpy(&p[IP_DST], &dstIp, 4);
+
+    NetWrite16(&p[ETH_HDR_LEN + IP_HDR_LEN], srcPort);
+    NetWrite16(&p[ETH_HDR_LEN + IP_HDR_LEN + 2U], dstPort);
+    NetWrite16(&p[ETH_HDR_LEN + IP_HDR_LEN + 4U], (uint16_t)(UDP_HDR_LEN + dataLen));
+    NetWrite16(&p[ETH_HDR_LEN + IP_HDR_LEN + 6U], 0);
+}
+
+/*!
+ * @brief       Fill in the checksums, in hardware or software.
+ *
+ * @param       frame:  Headers in the first segment, payload behind them
+ *
+ * @param       dstIp:  Destination address
+ *
+ * @retval      None
+ */
+static void UdpFinishChecksums(EthBuf_T* frame, uint32_t dstIp)
+{
+#if UDP_SW_CHECKSUM
+    uint8_t* p = frame->payload;
+    uint16_t udpLen = (uint16_t)(frame->totLen - ETH_HDR_LEN - IP_HDR_LEN);
+    EthBuf_T udp = *frame;
+    uint32_t sum;
+    uint16_t csum;
+
+    csum = NetChecksum(&p[ETH_HDR_LEN], IP_HDR_LEN);
+    memcpy(&p[IP_CSUM], &csum, 2);
+
+    /* Headers are one segment: skip to the UDP header with a shallow copy */
+    udp.payload += ETH_HDR_LEN + IP_HDR_LEN;
+    udp.len -= ETH_HDR_LEN + IP_HDR_LEN;
+    sum = UdpChecksumChain(UdpPseudoSum(netConfig.ip, dstIp, udpLen), &udp, udpLen);
+    csum = NetChecksumFinish(sum);
+    if (csum == 0)
+    {
+        csum = 0xFFFF;
+    }
+    memcpy(&p[ETH_HDR_LEN + IP_HDR_LEN + 6U], &csum, 2);
+#else
+    (void)dstIp;
+
+    frame->flags |= ETHBUF_FLAG_TX_CSUM;
+#endif
+}
+
+/*!
+ * @brief       Set the interface addresses and clear the ARP cache and
+ *              sockets.
+ *
+ * @param       config:  Addresses
+ *
+ * @retval      None
+ *
+ * @note        Call after EthBufInit(); also program config->mac into the
+ *              MAC address filter (ETH_ConfigMACAddress).
+ */
+void UdpInit(const UdpConfig_T* config)
+{
+    CRITICAL_ENTER();
+    netConfig = *config;
+    memset(arpCache, 0, sizeof(arpCache));
+    memset(sockets, 0, sizeof(sockets));
+    memset(&udpStats, 0, sizeof(udpStats));
+    arpClock = 0;
+    arpLast = 0;
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Deliver datagrams for a local port to a callback.
+ *
+ * @param       port:      Local port
+ *
+ * @param       callback:  Receive handler, runs where UdpInput() is called
+ *
+ * @retval      UDP_OK, or UDP_ERR_PARAM when all sockets are taken
+ */
+UdpStatus_T UdpBind(uint16_t port, UdpRecvCallback_T callback)
+{
+    UdpStatus_T status = UDP_ERR_PARAM;
+    uint32_t i;
+
+    CRITICAL_ENTER();
+    for (i = 0; i < UDP_SOCKETS; i++)
+    {
+        if ((sockets[i].port == 0) || (sockets[i].port == port))
+        {
+            sockets[i].port = port;
+            sockets[i].callback = callback;
+            status = UDP_OK;
+            break;
+        }
+    }
+    CRITICAL_EXIT();
+
+    return status;
+}
+
+/*!
+ * @brief       Stop delivering datagrams for a local port.
+ *
+ * @param       port:  Local port
+ *
+ * @retval      None
+ */
+void UdpUnbind(uint16_t port)
+{
+    uint32_t i;
+
+    CRITICAL_ENTER();
+    for (i = 0; i < UDP_SOCKETS; i++)
+    {
+        if (sockets[i].port == port)
+        {
+            sockets[i].port = 0;
+            sockets[i].callback = NULL;
+        }
+    }
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Send a datagram without copying the payload: the headers go
+ *              into a pool buffer chained in front of it.
+ *
+ * @param       dstIp:    Destination address
+ *
+ * @param       dstPort:  Destination port
+ *
+ * @param       srcPort:  Source port
+ *
+ * @param       payload:  Payload chain; its reference passes to the driver on
+ *                        UDP_OK, otherwise the caller keeps it
+ *
+ * @retval      UdpStatus_T
+ */
+UdpStatus_T UdpSendTo(uint32_t dstIp, uint16_t dstPort, uint16_t srcPort, EthBuf_T* payload)
+{
+    uint8_t mac[6];
+    EthBuf_T* frame;
+    UdpStatus_T status;
+
+    if (payload->totLen > UDP_PAYLOAD_MAX)
+    {
+        return UDP_ERR_PARAM;
+    }
+
+    status = UdpResolve(dstIp, mac);
+    if (status != UDP_OK)
+    {
+        return status;
+    }
+
+    frame = EthBufAlloc(UDP_HEADER_LEN);
+    if (frame == NULL)
+    {
+        return UDP_ERR_NOBUF;
+    }
+
+    UdpBuildHeaders(frame->payload, mac, dstIp, dstPort, srcPort, payload->totLen);
+    EthBufChain(frame, payload);
+    UdpFinishChecksums(frame, dstIp);
+
+    if (EthBufTransmit(frame) != ETH_SUCCESS)
+    {
+        /* Hand the payload back untouched */
+        frame->next = NULL;
+        EthBufFree(frame);
+        return UDP_ERR_BUSY;
+    }
+
+    udpStats.txDatagrams++;
+
+    return UDP_OK;
+}
+
+/*!
+ * @brief       Send a datagram from a buffer. Payloads that fit in one pool
+ *              buffer behind the headers go out as a single segment.
+ *
+ * @param       dstIp:    Destination address
+ *
+ * @param       dstPort:  Destination port
+ *
+ * @param       srcPort:  Source port
+ *
+ * @param       data:     Payload, copied
+ *
+ * @param       len:      Payload bytes
+ *
+ * @retval      UdpStatus_T
+ */
+UdpStatus_T UdpSend(uint32_t dstIp, uint16_t dstPort, uint16_t srcPort, const void* data, uint16_t len)
+{
+    const uint8_t* src = (const uint8_t*)data;
+    uint8_t mac[6];
+    EthBuf_T* frame;
+    EthBuf_T* buf;
+    UdpStatus_T status;
+
+    if (len > UDP_PAYLOAD_MAX)
+    {
+        return UDP_ERR_PARAM;
+    }
+
+    if (UDP_HEADER_LEN + len > ETHBUF_SIZE)
+    {
+        frame = EthBufAlloc(len);
+        if (frame == NULL)
+        {
+            return UDP_ERR_NOBUF;
+        }
+        for (buf = frame; buf != NULL; buf = buf->next)
+        {
+            memcpy(buf->payload, src, buf->len);
+            src += buf->len;
+        }
+        status = UdpSendTo(dstIp, dstPort, srcPort, frame);
+        if (status != UDP_OK)
+        {
+            EthBufFree(frame);
+        }
+        return status;
+    }
+
+    status = UdpResolve(dstIp, mac);
+    if (status != UDP_OK)
+    {
+        return status;
+    }
+
+    frame = EthBufAlloc((uint16_t)(UDP_HEADER_LEN + len));
+    if (frame == NULL)
+    {
+        return UDP_ERR_NOBUF;
+    }
+
+    UdpBuildHeaders(frame->payload, mac, dstIp, dstPort, srcPort, len);
+    memcpy(&frame->payload[UDP_HEADER_LEN], data, len);
+    UdpFinishChecksums(frame, dstIp);
+
+    if (EthBufTransmit(frame) != ETH_SUCCESS)
+    {
+        EthBufFree(frame);
+        return UDP_ERR_BUSY;
+    }
+
+    udpStats.txDatagrams++;
+
+    return UDP_OK;
+}
+
+/*!
+ * @brief       Handle an ARP packet: learn the sender and answer requests
+ *              for our address.
+ *
+ * @param       p:    Frame
+ *
+ * @param       len:  Bytes in the first segment
+ *
+ * @retval      None
+ */
+static void UdpArpInput(const uint8_t* p, uint32_t len)
+{
+    uint32_t spa, tpa;
+    uint16_t oper;
+
+    if ((len < ARP_FRAME_LEN) || (NetRead16(&p[ETH_HDR_LEN]) != 1U) ||
+        (NetRead16(&p[ETH_HDR_LEN + 2U]) != ETHTYPE_IPV4) || (p[ETH_HDR_LEN + 4U] != 6U) ||
+        (p[ETH_HDR_LEN + 5U] != 4U))
+    {
+        udpStats.rxDropped++;
+        return;
+    }
+
+    oper = NetRead16(&p[ARP_OPER]);
+    spa = UdpLoadIp(&p[ARP_SPA]);
+    tpa = UdpLoadIp(&p[ARP_TPA]);
+
+    /* RFC 826: refresh a known sender, add it when we are the target */
+    UdpArpUpdate(spa, &p[ARP_SHA], tpa == netConfig.ip);
+
+    if ((oper == ARP_REQUEST) && (tpa == netConfig.ip))
+    {
+        UdpArpSend(ARP_REPLY, &p[ARP_SHA], &p[ARP_SHA], spa);
+    }
+}
+
+/* Limit a chain to len bytes */
+static void UdpTrim(EthBuf_T* buf, uint32_t len)
+{
+    for (; buf != NULL; buf = buf->next)
+    {
+        buf->totLen = (uint16_t)len;
+        if (buf->len > len)
+        {
+            buf->len = (uint16_t)len;
+        }
+        len -= buf->len;
+    }
+}
+
+/*!
+ * @brief       Handle an IPv4 frame: accept unfragmented UDP for a bound port.
+ *
+ * @param       frame:  Frame, the first segment is advanced to the UDP data
+ *
+ * @retval      None
+ */
+static void UdpIpInput(EthBuf_T* frame)
+{
+    const uint8_t* p = frame->payload;
+    const uint8_t* udp;
+    UdpRecvCallback_T callback = NULL;
+    uint32_t srcIp, dstIp, ihl, ipLen, udpLen, i;
+    uint16_t dstPort, srcPort;
+
+    ihl = (uint32_t)(p[IP_VER_IHL] & 0x0FU) * 4U;
+    if ((frame->len < ETH_HDR_LEN + IP_HDR_LEN) || ((p[IP_VER_IHL] >> 4) != 4U) || (ihl < IP_HDR_LEN) ||
+        (frame->len < ETH_HDR_LEN + ihl + UDP_HDR_LEN) || (p[IP_PROTO] != IP_PROTO_UDP) ||
+        ((NetRead16(&p[IP_FRAG]) & IP_FRAG_MF_OFFSET) != 0))
+    {
+        udpStats.rxDropped++;
+        return;
+    }
+
+    ipLen = NetRead16(&p[IP_TOTAL_LEN]);
+    udp = &p[ETH_HDR_LEN + ihl];
+    udpLen = NetRead16(&udp[4]);
+    srcIp = UdpLoadIp(&p[IP_SRC]);
+    dstIp = UdpLoadIp(&p[IP_DST]);
+    if ((ipLen > frame->totLen - ETH_HDR_LEN) || (ipLen < ihl + UDP_HDR_LEN) ||
+        (udpLen < UDP_HDR_LEN) || (udpLen > ipLen - ihl) ||
+        ((dstIp != netConfig.ip) && (dstIp != IP_BROADCAST) &&
+         (dstIp != (netConfig.ip | ~netConfig.netmask)) && !IP_IS_MULTICAST(dstIp)))
+    {
+        udpStats.rxDropped++;
+        return;
+    }
+
+    srcPort = NetRead16(&udp[0]);
+    dstPort = NetRead16(&udp[2]);
+
+    /* Strip the headers and the Ethernet padding */
+    frame->payload += ETH_HDR_LEN + ihl;
+    frame->len -= (uint16_t)(ETH_HDR_LEN + ihl);
+    UdpTrim(frame, udpLen);
+
+    if (UDP_SW_CHECKSUM || ((frame->flags & ETHBUF_FLAG_RX_CSUM_CHECKED) == 0))
+    {
+        /* The MAC did not check this one (or is not trusted to) */
+        udpStats.rxSwChecksum++;
+        if ((NetChecksum(&p[ETH_HDR_LEN], ihl) != 0) ||
+            ((NetRead16(&udp[6]) != 0) &&
+             (NetChecksumFinish(UdpChecksumChain(UdpPseudoSum(srcIp, dstIp, (uint16_t)udpLen), frame, udpLen)) != 0)))
+        {
+            udpStats.rxChecksumErr++;
+            return;
+        }
+    }
+    else if ((frame->flags & (ETHBUF_FLAG_RX_IPHDR_ERR | ETHBUF_FLAG_RX_PAYLOAD_ERR)) != 0)
+    {
+        udpStats.rxChecksumErr++;
+        return;
+    }
+
+    frame->payload += UDP_HDR_LEN;
+    frame->len -= UDP_HDR_LEN;
+    frame->totLen -= UDP_HDR_LEN;
+
+    for (i = 0; i < UDP_SOCKETS; i++)
+    {
+        if (sockets[i].port == dstPort)
+        {
+            callback = sockets[i].callback;
+            break;
+        }
+    }
+    if (callback == NULL)
+    {
+        udpStats.rxDropped++;
+        return;
+    }
+
+    udpStats.rxDatagrams++;
+    callback(srcIp, srcPort, dstPort, frame);
+}
+
+/*!
+ * @brief       Process one received frame and free it.
+ *
+ * @param       frame:  Frame from EthBufReceive()
+ *
+ * @retval      None
+ */
+void UdpInput(EthBuf_T* frame)
+{
+    if (frame->len >= ETH_HDR_LEN)
+    {
+        switch (NetRead16(&frame->payload[ETH_TYPE]))
+        {
+            case ETHTYPE_IPV4:
+                UdpIpInput(frame);
+                break;
+
+            case ETHTYPE_ARP:
+                UdpArpInput(frame->payload, frame->len);
+                break;
+
+            default:
+                udpStats.rxDropped++;
+                break;
+        }
+    }
+    else
+    {
+        udpStats.rxDropped++;
+    }
+
+    EthBufFree(frame);
+}
+
+/*!
+ * @brief       Process every received frame.
+ *
+ * @param       None
+ *
+ * @retval      Number of frames processed
+ *
+ * @note        Call from the main loop, or from the EthBuf receive callback
+ *              to handle datagrams in the ETH interrupt.
+ */
+uint32_t UdpPoll(void)
+{
+    EthBuf_T* frame;
+    uint32_t count = 0;
+
+    while ((frame = EthBufReceive()) != NULL)
+    {
+        UdpInput(frame);
+        count++;
+    }
+
+    return count;
+}
+
+/*!
+ * @brief       Look up the cached MAC address of an IPv4 address.
+ *
+ * @param       ip:   Address
+ *
+ * @param       mac:  Filled with the MAC address when found
+ *
+ * @retval      1 when resolved, 0 otherwise
+ */
+uint8_t UdpArpLookup(uint32_t ip, uint8_t* mac)
+{
+    UdpArpEntry_T* entry;
+    uint8_t found = 0;
+
+    CRITICAL_ENTER();
+    entry = UdpArpFind(ip);
+    if ((entry != NULL) && (entry->state == ARP_VALID))
+    {
+        memcpy(mac, entry->mac, NET_MAC_LEN);
+        found = 1;
+    }
+    CRITICAL_EXIT();
+
+    return found;
+}
+
+/*!
+ * @brief       Forget all cached addresses, e.g. after a link change.
+ *
+ * @param       None
+ *
+ * @retval      None
+ */
+void UdpArpFlush(void)
+{
+    CRITICAL_ENTER();
+    memset(arpCache, 0, sizeof(arpCache));
+    CRITICAL_EXIT();
+}
+
+/*!
+ * @brief       Read the counters.
+ *
+ * @param       stats:  Filled with a snapshot
+ *
+ * @retval      None
+ */
+void UdpStats(UdpStats_T* stats)
+{
+    CRITICAL_ENTER();
+    *stats = udpStats;
+    CRITICAL_EXIT();
+}
+
+#endif // ETHBUF_ENABLE
@@ -0,0 +1,110 @@
+#ifndef UDP_H
+#define UDP_H
+
+#include <stdint.h>
+#include "EthBuf.h"
+
+/*
+ * UDP/IPv4 fast path on the zero-copy Ethernet buffers (EthBuf.h).
+ *
+ * Handles ARP (cache, requests, replies) and unfragmented IPv4/UDP. Headers
+ * are built in one pool buffer in front of the payload chain and the MAC
+ * inserts the IPv4 header and UDP checksums (ETHBUF_FLAG_TX_CSUM); received
+ * datagrams are accepted on the MAC checksum verdict. The software checksum
+ * (Net.h) only runs for frames the MAC did not check, or for everything
+ * with UDP_SW_CHECKSUM.
+ *
+ * ETH_Config() must enable checksum offload and transmit store-and-forward.
+ */
+
+/* ARP cache entries, least recently used is replaced */
+#ifndef UDP_ARP_ENTRIES
+#define UDP_ARP_ENTRIES 8
+#endif
+
+/* Sends to an unresolved address between two ARP requests */
+#ifndef UDP_ARP_RETRY
+#define UDP_ARP_RETRY 16
+#endif
+
+/* Bound ports */
+#ifndef UDP_SOCKETS
+#define UDP_SOCKETS 4
+#endif
+
+/* 1: compute and verify checksums in software (MAC engines not used) */
+#ifndef UDP_SW_CHECKSUM
+#define UDP_SW_CHECKSUM 0
+#endif
+
+/* Ethernet + IPv4 + UDP header bytes in front of the payload */
+#define UDP_HEADER_LEN  42U
+
+/* Largest payload in one unfragmented datagram */
+#define UDP_PAYLOAD_MAX 1472U
+
+/**
+ * @brief Interface addresses, IPv4 values as built with NET_IP4()
+ */
+typedef struct
+{
+    uint8_t  mac[6];        /*!< Station MAC address */
+    uint32_t ip;            /*!< Interface address */
+    uint32_t netmask;       /*!< Subnet mask */
+    uint32_t gateway;       /*!< Next hop outside the subnet (0: none) */
+} UdpConfig_T;
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    UDP_OK,                 /*!< Queued for transmission */
+    UDP_ERR_ARP,            /*!< Next hop not resolved yet, an ARP request went out; retry later */
+    UDP_ERR_NOBUF,          /*!< No pool buffer for the headers */
+    UDP_ERR_BUSY,           /*!< Transmit descriptors full */
+    UDP_ERR_PARAM,          /*!< Payload too large, no route or no free socket */
+} UdpStatus_T;
+
+/*
+ * Received datagram. payload is the first segment, already advanced past the
+ * headers (len/totLen cover the UDP data only). The frame is freed after the
+ * callback returns; take EthBufRef() on it to keep it.
+ */
+typedef void (*UdpRecvCallback_T)(uint32_t srcIp, uint16_t srcPort, uint16_t dstPort, EthBuf_T* payload);
+
+/**
+ * @brief UDP/IPv4 counters
+ */
+typedef struct
+{
+    uint32_t rxDatagrams;   /*!< Datagrams delivered to a socket */
+    uint32_t rxDropped;     /*!< Frames not for us, malformed, fragmented or for an unbound port */
+    uint32_t rxChecksumErr; /*!< Datagrams dropped for a bad checksum */
+    uint32_t rxSwChecksum;  /*!< Datagrams checked in software */
+    uint32_t txDatagrams;   /*!< Datagrams queued */
+    uint32_t arpRequests;   /*!< ARP requests sent */
+    uint32_t arpReplies;    /*!< ARP replies sent */
+} UdpStats_T;
+
+void UdpInit(const UdpConfig_T* config);
+
+/* Sockets */
+UdpStatus_T UdpBind(uint16_t port, UdpRecvCallback_T callback);
+void UdpUnbind(uint16_t port);
+
+/* Transmit */
+UdpStatus_T UdpSendTo(uint32_t dstIp, uint16_t dstPort, uint16_t srcPort, EthBuf_T* payload);
+UdpStatus_T UdpSend(uint32_t dstIp, uint16_t dstPort, uint16_t srcPort, const void* data, uint16_t len);
+
+/* Receive */
+void UdpInput(EthBuf_T* frame);
+uint32_t UdpPoll(void);
+
+/* ARP cache */
+uint8_t UdpArpLookup(uint32_t ip, uint8_t* mac);
+void UdpArpFlush(void);
+
+void UdpStats(UdpStats_T* stats);
+
+#endif // UDP_H
@@ -27,6 +27,12 @@
 #include "apm32f4xx_int.h"
 
 /* Private includes *******************************************************/
+#include "apm32f4xx_conf.h"
+#include "CanBus.h"
+#include "Dma.h"
+#include "EthBuf.h"
+#include "Profile.h"
+#include "SdCard.h"
 
 /* Private macro **********************************************************/
 
@@ -138,6 +144,10 @@ void SVC_Handler(void)
  */
 void DebugMon_Handler(void)
 {
+#if PROFILE_ENABLE
+    /* Pended by a debugger through DEMCR.MON_PEND to get a profile dump */
+    ProfileDumpRequest();
+#endif
 }
 
 /*!
@@ -163,3 +173,295 @@ void PendSV_Handler(void)
 void SysTick_Handler(void)
 {
 }
+
+/*!
+ * @brief   This function handles DMA1 Stream 0 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR0_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 0));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 1 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR1_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 1));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 2 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR2_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 2));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 3 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR3_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 3));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 4 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR4_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 4));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 5 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR5_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 5));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 6 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR6_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 6));
+}
+
+/*!
+ * @brief   This function handles DMA1 Stream 7 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA1_STR7_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(1, 7));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 0 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR0_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 0));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 1 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR1_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 1));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 2 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR2_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 2));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 3 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR3_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 3));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 4 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR4_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 4));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 5 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR5_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 5));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 6 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR6_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 6));
+}
+
+/*!
+ * @brief   This function handles DMA2 Stream 7 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void DMA2_STR7_IRQHandler(void)
+{
+    DmaIRQHandler(DMA_STREAM_INDEX(2, 7));
+}
+
+#if ETHBUF_ENABLE
+/*!
+ * @brief   This function handles ETH Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void ETH_IRQHandler(void)
+{
+    EthBufIRQHandler();
+}
+#endif
+
+#if CANBUS_ENABLE
+/*!
+ * @brief   This function handles CAN1 TX Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void CAN1_TX_IRQHandler(void)
+{
+    CanBusTxIRQHandler();
+}
+
+/*!
+ * @brief   This function handles CAN1 RX0 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void CAN1_RX0_IRQHandler(void)
+{
+    CanBusRx0IRQHandler();
+}
+
+/*!
+ * @brief   This function handles CAN1 RX1 Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void CAN1_RX1_IRQHandler(void)
+{
+    CanBusRx1IRQHandler();
+}
+
+/*!
+ * @brief   This function handles CAN1 SCE Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void CAN1_SCE_IRQHandler(void)
+{
+    CanBusSceIRQHandler();
+}
+#endif
+
+#if SDCARD_ENABLE
+/*!
+ * @brief   This function handles SDIO Handler
+ *
+ * @param   None
+ *
+ * @retval  None
+ *
+ */
+void SDIO_IRQHandler(void)
+{
+    SdCardIRQHandler();
+}
+#endif
@@ -48,6 +48,28 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void DMA1_STR0_IRQHandler(void);
+void DMA1_STR1_IRQHandler(void);
+void DMA1_STR2_IRQHandler(void);
+void DMA1_STR3_IRQHandler(void);
+void DMA1_STR4_IRQHandler(void);
+void DMA1_STR5_IRQHandler(void);
+void DMA1_STR6_IRQHandler(void);
+void DMA1_STR7_IRQHandler(void);
+void DMA2_STR0_IRQHandler(void);
+void DMA2_STR1_IRQHandler(void);
+void DMA2_STR2_IRQHandler(void);
+void DMA2_STR3_IRQHandler(void);
+void DMA2_STR4_IRQHandler(void);
+void DMA2_STR5_IRQHandler(void);
+void DMA2_STR6_IRQHandler(void);
+void DMA2_STR7_IRQHandler(void);
+void ETH_IRQHandler(void);
+void CAN1_TX_IRQHandler(void);
+void CAN1_RX0_IRQHandler(void);
+void CAN1_RX1_IRQHandler(void);
+void CAN1_SCE_IRQHandler(void);
+void SDIO_IRQHandler(void);
 
 #ifdef __cplusplus
 }
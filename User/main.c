@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include "apm32f4xx_conf.h"
 #include "Debug.h"
+#include "Profile.h"
 
 /* Private includes *******************************************************/
 
@@ -55,10 +56,16 @@ int main(void)
 #ifdef DEBUG
     DebugInit();
 #endif
+#if PROFILE_ENABLE
+    ProfileInit();
+#endif
 
     PRINT("APM32F407 Demo (HCLK=%luHz)\r\n", SystemCoreClock);
 
     while (1)
     {
+#if PROFILE_ENABLE
+        ProfilePoll();
+#endif
     }
 }
@@ -0,0 +1,84 @@
+# Compare two benchmark reports (bench.json) case by case
+#
+#   cmake -DBENCH_BASE=<old.json> -DBENCH_NEW=<new.json> -P BenchCompare.cmake
+#
+# Also included by RunBench.cmake to compare against the previous run.
+# Needs CMake 3.19 (string(JSON)).
+
+# Format a value in hundredths as N.NN
+function(bench_hundredths out value)
+    math(EXPR INT "${value} / 100")
+    math(EXPR FRAC "${value} % 100")
+    if(FRAC LESS 10)
+        set(FRAC "0${FRAC}")
+    endif()
+    set(${out} "${INT}.${FRAC}" PARENT_SCOPE)
+endfunction()
+
+function(bench_compare base new)
+    if(CMAKE_VERSION VERSION_LESS 3.19)
+        message(STATUS "Benchmark comparison needs CMake 3.19 or later")
+        return()
+    endif()
+
+    file(READ ${base} BASE_JSON)
+    file(READ ${new} NEW_JSON)
+    string(JSON BASE_REV ERROR_VARIABLE err GET "${BASE_JSON}" revision)
+    string(JSON NEW_REV ERROR_VARIABLE err GET "${NEW_JSON}" revision)
+    string(JSON BASE_COUNT ERROR_VARIABLE err LENGTH "${BASE_JSON}" results)
+    string(JSON NEW_COUNT ERROR_VARIABLE err LENGTH "${NEW_JSON}" results)
+    if(err)
+        message(STATUS "Benchmark comparison skipped: ${err}")
+        return()
+    endif()
+
+    message("ticks_per_iter: ${BASE_REV} -> ${NEW_REV}")
+    math(EXPR NEW_LAST "${NEW_COUNT} - 1")
+    math(EXPR BASE_LAST "${BASE_COUNT} - 1")
+    foreach(i RANGE ${NEW_LAST})
+        string(JSON NAME GET "${NEW_JSON}" results ${i} name)
+        string(JSON NEW_TICKS GET "${NEW_JSON}" results ${i} ticks)
+        string(JSON NEW_ITER GET "${NEW_JSON}" results ${i} iterations)
+        math(EXPR NEW_PER "${NEW_TICKS} * 100 / ${NEW_ITER}")
+
+        set(BASE_PER "")
+        if(BASE_COUNT GREATER 0)
+            foreach(j RANGE ${BASE_LAST})
+                string(JSON BASE_NAME GET "${BASE_JSON}" results ${j} name)
+                if(BASE_NAME STREQUAL NAME)
+                    string(JSON BASE_TICKS GET "${BASE_JSON}" results ${j} ticks)
+                    string(JSON BASE_ITER GET "${BASE_JSON}" results ${j} iterations)
+                    math(EXPR BASE_PER "${BASE_TICKS} * 100 / ${BASE_ITER}")
+                endif()
+            endforeach()
+        endif()
+
+        bench_hundredths(NEW_TEXT ${NEW_PER})
+        if(BASE_PER STREQUAL "")
+            message("  ${NAME}: ${NEW_TEXT} (new)")
+            continue()
+        endif()
+        bench_hundredths(BASE_TEXT ${BASE_PER})
+        if(BASE_PER EQUAL 0)
+            message("  ${NAME}: ${BASE_TEXT} -> ${NEW_TEXT}")
+        else()
+            # Percent change with one decimal
+            math(EXPR PERMILLE "(${NEW_PER} - ${BASE_PER}) * 1000 / ${BASE_PER}")
+            math(EXPR PCT_INT "${PERMILLE} / 10")
+            math(EXPR PCT_FRAC "${PERMILLE} % 10")
+            if(PCT_FRAC LESS 0)
+                math(EXPR PCT_FRAC "-${PCT_FRAC}")
+            endif()
+            if(PERMILLE GREATER_EQUAL 0)
+                set(PCT_INT "+${PCT_INT}")
+            elseif(PERMILLE GREATER -10)
+                set(PCT_INT "-0")
+            endif()
+            message("  ${NAME}: ${BASE_TEXT} -> ${NEW_TEXT} (${PCT_INT}.${PCT_FRAC}%)")
+        endif()
+    endforeach()
+endfunction()
+
+if(CMAKE_SCRIPT_MODE_FILE STREQUAL CMAKE_CURRENT_LIST_FILE)
+    bench_compare(${BENCH_BASE} ${BENCH_NEW})
+endif()
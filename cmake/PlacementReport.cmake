@@ -0,0 +1,56 @@
+# List what the linker placed in CCM RAM and in the SRAM code section
+#
+#   cmake -DNM_TOOL=<arm-none-eabi-nm> -DELF=<image.elf> -P PlacementReport.cmake
+
+execute_process(
+    COMMAND ${NM_TOOL} -S -n ${ELF}
+    OUTPUT_VARIABLE NM_OUTPUT
+    RESULT_VARIABLE NM_RESULT
+)
+if(NOT NM_RESULT EQUAL 0)
+    message(FATAL_ERROR "${NM_TOOL} failed on ${ELF}")
+endif()
+
+string(REPLACE "\n" ";" NM_LINES "${NM_OUTPUT}")
+
+# Section bounds from the linker script symbols
+foreach(LINE IN LISTS NM_LINES)
+    if(LINE MATCHES "^([0-9a-fA-F]+) [A-Za-z] (_sram_func|_eram_func|_sccmram|_eccmram|_sccmbss|_eccmbss|_end_stack)$")
+        math(EXPR ${CMAKE_MATCH_2} "0x${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+if(NOT DEFINED _sram_func OR NOT DEFINED _sccmram OR NOT DEFINED _sccmbss)
+    message(STATUS "No placement symbols in ${ELF}")
+    return()
+endif()
+
+set(REPORT_CCM_DATA "")
+set(REPORT_CCM_BSS "")
+set(REPORT_RAM_FUNC "")
+foreach(LINE IN LISTS NM_LINES)
+    if(NOT LINE MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+) [A-Za-z] (.+)$")
+        continue()
+    endif()
+    math(EXPR ADDR "0x${CMAKE_MATCH_1}")
+    math(EXPR SIZE "0x${CMAKE_MATCH_2}")
+    set(ENTRY "    ${CMAKE_MATCH_3} (${SIZE})")
+    if(ADDR GREATER_EQUAL _sccmram AND ADDR LESS _eccmram)
+        string(APPEND REPORT_CCM_DATA "${ENTRY}\n")
+    elseif(ADDR GREATER_EQUAL _sccmbss AND ADDR LESS _eccmbss)
+        string(APPEND REPORT_CCM_BSS "${ENTRY}\n")
+    elseif(ADDR GREATER_EQUAL _sram_func AND ADDR LESS _eram_func)
+        string(APPEND REPORT_RAM_FUNC "${ENTRY}\n")
+    endif()
+endforeach()
+
+math(EXPR SIZE_CCM_DATA "${_eccmram} - ${_sccmram}")
+math(EXPR SIZE_CCM_BSS "${_eccmbss} - ${_sccmbss}")
+math(EXPR SIZE_RAM_FUNC "${_eram_func} - ${_sram_func}")
+math(EXPR STACK_TOP "${_end_stack}" OUTPUT_FORMAT HEXADECIMAL)
+
+message("Placement:")
+message("  .ccmram (CCM_DATA): ${SIZE_CCM_DATA} bytes\n${REPORT_CCM_DATA}")
+message("  .ccmbss (CCM_BSS): ${SIZE_CCM_BSS} bytes\n${REPORT_CCM_BSS}")
+message("  .ram_func (FAST_CODE): ${SIZE_RAM_FUNC} bytes\n${REPORT_RAM_FUNC}")
+message("  main stack top: ${STACK_TOP}")
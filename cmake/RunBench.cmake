@@ -0,0 +1,47 @@
+# Run a benchmark image and store its JSON report
+#
+#   cmake -DBENCH_IMAGE=<elf> -DBENCH_OUTPUT=<json> [-DQEMU=<qemu-system-arm>] -P RunBench.cmake
+#
+# With QEMU set, BENCH_IMAGE is firmware booted on the netduinoplus2 machine
+# (Cortex-M4, same flash/SRAM map) with semihosting for stdout and exit.
+# -icount shift=0 makes virtual time advance 1 ns per instruction, so the
+# report is deterministic and ns_per_iter reads as an instruction count.
+# Without QEMU, BENCH_IMAGE is a host executable. The previous report is
+# kept as <BENCH_OUTPUT>.prev and compared with the new one.
+
+include(${CMAKE_CURRENT_LIST_DIR}/BenchCompare.cmake)
+
+if(QEMU)
+    set(BENCH_COMMAND ${QEMU}
+        -M netduinoplus2
+        -nographic -monitor none -serial null
+        -semihosting-config enable=on,target=native
+        -icount shift=0,align=off
+        -kernel ${BENCH_IMAGE}
+    )
+else()
+    set(BENCH_COMMAND ${BENCH_IMAGE})
+endif()
+
+if(EXISTS ${BENCH_OUTPUT})
+    file(RENAME ${BENCH_OUTPUT} ${BENCH_OUTPUT}.prev)
+endif()
+
+execute_process(
+    COMMAND ${BENCH_COMMAND}
+    OUTPUT_FILE ${BENCH_OUTPUT}
+    RESULT_VARIABLE BENCH_RESULT
+    TIMEOUT 600
+)
+
+if(NOT BENCH_RESULT EQUAL 0)
+    message(FATAL_ERROR "Benchmark failed (${BENCH_RESULT}), partial output in ${BENCH_OUTPUT}")
+endif()
+
+file(READ ${BENCH_OUTPUT} BENCH_JSON)
+message("${BENCH_JSON}")
+message(STATUS "Benchmark report: ${BENCH_OUTPUT}")
+
+if(EXISTS ${BENCH_OUTPUT}.prev)
+    bench_compare(${BENCH_OUTPUT}.prev ${BENCH_OUTPUT})
+endif()
@@ -0,0 +1,43 @@
+# Print the image size and its change since the previous build
+#
+#   cmake -DSIZE_TOOL=<arm-none-eabi-size> -DELF=<image.elf> -P SizeReport.cmake
+#
+# The previous figures are kept next to the image in <image.elf>.size.
+
+execute_process(
+    COMMAND ${SIZE_TOOL} --format=berkeley ${ELF}
+    OUTPUT_VARIABLE SIZE_OUTPUT
+    RESULT_VARIABLE SIZE_RESULT
+)
+if(NOT SIZE_RESULT EQUAL 0)
+    message(FATAL_ERROR "${SIZE_TOOL} failed on ${ELF}")
+endif()
+message("${SIZE_OUTPUT}")
+
+# Last line: text data bss dec hex filename
+string(REGEX MATCH "([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+[^\n]*\n?$" SIZE_LINE "${SIZE_OUTPUT}")
+if(NOT SIZE_LINE)
+    return()
+endif()
+math(EXPR SIZE_FLASH "${CMAKE_MATCH_1} + ${CMAKE_MATCH_2}")
+math(EXPR SIZE_RAM "${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}")
+
+set(SIZE_FILE ${ELF}.size)
+if(EXISTS ${SIZE_FILE})
+    file(STRINGS ${SIZE_FILE} SIZE_PREVIOUS)
+    list(GET SIZE_PREVIOUS 0 PREV_FLASH)
+    list(GET SIZE_PREVIOUS 1 PREV_RAM)
+    math(EXPR DELTA_FLASH "${SIZE_FLASH} - ${PREV_FLASH}")
+    math(EXPR DELTA_RAM "${SIZE_RAM} - ${PREV_RAM}")
+    if(DELTA_FLASH GREATER_EQUAL 0)
+        set(DELTA_FLASH "+${DELTA_FLASH}")
+    endif()
+    if(DELTA_RAM GREATER_EQUAL 0)
+        set(DELTA_RAM "+${DELTA_RAM}")
+    endif()
+    message("flash ${SIZE_FLASH} (${DELTA_FLASH}), ram ${SIZE_RAM} (${DELTA_RAM}) since the previous build")
+else()
+    message("flash ${SIZE_FLASH}, ram ${SIZE_RAM}")
+endif()
+
+file(WRITE ${SIZE_FILE} "${SIZE_FLASH}\n${SIZE_RAM}\n")
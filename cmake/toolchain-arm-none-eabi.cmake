@@ -14,5 +14,6 @@ set(CMAKE_ASM_COMPILER ${TOOLCHAIN_PATH}/arm-none-eabi-gcc.exe)
 set(CMAKE_OBJCOPY ${TOOLCHAIN_PATH}/arm-none-eabi-objcopy.exe)
 set(CMAKE_OBJDUMP ${TOOLCHAIN_PATH}/arm-none-eabi-objdump.exe)
 set(CMAKE_SIZE ${TOOLCHAIN_PATH}/arm-none-eabi-size.exe)
+set(CMAKE_NM ${TOOLCHAIN_PATH}/arm-none-eabi-nm.exe)
 
 set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)